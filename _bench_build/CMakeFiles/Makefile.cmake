@@ -0,0 +1,289 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/benchmark/CMakeLists.txt"
+  "/root/repo/test/CMakeLists.txt"
+  "/root/repo/test/coordinate/CMakeLists.txt"
+  "/root/repo/test/header/CMakeLists.txt"
+  "/root/repo/test/io/CMakeLists.txt"
+  "/root/repo/test/units/CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/BoostDetectToolset-1.74.0.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_date_time-1.74.0/boost_date_time-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_date_time-1.74.0/boost_date_time-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_date_time-1.74.0/libboost_date_time-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_date_time-1.74.0/libboost_date_time-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_unit_test_framework-1.74.0/boost_unit_test_framework-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_unit_test_framework-1.74.0/boost_unit_test_framework-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_unit_test_framework-1.74.0/libboost_unit_test_framework-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_unit_test_framework-1.74.0/libboost_unit_test_framework-variant-static.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompilerABI.cpp"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCompilerIdDetection.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompileFeatures.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerABI.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerId.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitIncludeInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseLibraryArchitecture.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystem.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCompilerCommon.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeUnixFindMake.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ADSP-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMCC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/AppleClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Borland-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompilerInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Comeau-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Cray-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Embarcadero-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Fujitsu-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/FujitsuClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GHS-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-FindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IAR-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-CXX-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Intel-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IntelLLVM-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/MSVC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVHPC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVIDIA-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/OpenWatcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PGI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PathScale-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SCO-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Tasking-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Watcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/FeatureTesting.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-Determine-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/header/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/coordinate/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/io/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/units/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "benchmark/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "test/header/CMakeFiles/test_headers_self_contained.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-alt_az.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-alt_az_track.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-arithmetic.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-base_differential.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-base_ecliptic_frame.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-base_equatorial_frame.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-base_frame.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-base_representation.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-base_representation_batch.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-batch_arithmetic.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-batch_expression.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-batch_file.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-cartesian_differential.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-cartesian_representation.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-cartesian_representation_batch.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-catalog_columns.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-cirs.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-coordinate.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-cross_match.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-differential.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-earth_orientation.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-epoch_propagation.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-frame.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-frame_transform.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-galactic.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-geocentric.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-healpix.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-heliocentric.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-icrs.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-io.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-kd_tree.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-raw_kernel.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-representation.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-representation_batch.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-separation.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-sky_point.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-spherical_coslat_differential.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-spherical_differential.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-spherical_equatorial_differential.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-spherical_equatorial_representation.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-spherical_equatorial_representation_batch.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-spherical_representation.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-spherical_representation_batch.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-supergalactic.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-time_transform.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_coordinate-wcs.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_detail-ascii_number.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_detail-batch_conversion.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_detail-batch_execution.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_detail-bounded_queue.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_detail-endian.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_detail-host_offload_device.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_detail-is_base_template_of.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_detail-is_trivial_storage.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_detail-lru_cache.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_detail-monotonic_arena.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_detail-offload_device.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_detail-parallel_bands.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_detail-polynomial_trigonometry.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_detail-precision.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_detail-tile_compression.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_detail-unit_scale.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_exception-fits_exception.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-ascii_table.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-binary_table.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-bitpix.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-card.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-checksum.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-column.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-column_data.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-column_projection.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-column_view.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-compressed_image.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-data_source.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-extension_hdu.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-fits.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-fits_pipeline.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-fits_writer.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-hdu.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-header_cache.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-header_scanner.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-image.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-image_background.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-image_coadd.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-image_convolution.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-image_extension.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-image_section.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-image_statistics.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-image_tile_reader.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-image_view.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-io_counters.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-mapped_fits.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-primary_hdu.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-robust_statistics.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-scaled_image.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-source_fits.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-table_appender.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-table_extension.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_io-visit_image.dir/DependInfo.cmake"
+  "test/header/CMakeFiles/test_header_units-length.dir/DependInfo.cmake"
+  "test/coordinate/CMakeFiles/test_coordinate_cartesian_representation.dir/DependInfo.cmake"
+  "test/coordinate/CMakeFiles/test_coordinate_cartesian_differential.dir/DependInfo.cmake"
+  "test/coordinate/CMakeFiles/test_coordinate_spherical_representation.dir/DependInfo.cmake"
+  "test/coordinate/CMakeFiles/test_coordinate_spherical_differential.dir/DependInfo.cmake"
+  "test/coordinate/CMakeFiles/test_coordinate_spherical_equatorial_representation.dir/DependInfo.cmake"
+  "test/coordinate/CMakeFiles/test_coordinate_spherical_equatorial_differential.dir/DependInfo.cmake"
+  "test/coordinate/CMakeFiles/test_coordinate_representation_batch.dir/DependInfo.cmake"
+  "test/coordinate/CMakeFiles/test_coordinate_frame_transform.dir/DependInfo.cmake"
+  "test/coordinate/CMakeFiles/test_coordinate_time_transform.dir/DependInfo.cmake"
+  "test/coordinate/CMakeFiles/test_coordinate_alt_az_track.dir/DependInfo.cmake"
+  "test/coordinate/CMakeFiles/test_coordinate_single_precision.dir/DependInfo.cmake"
+  "test/coordinate/CMakeFiles/test_coordinate_healpix.dir/DependInfo.cmake"
+  "test/coordinate/CMakeFiles/test_coordinate_cross_match.dir/DependInfo.cmake"
+  "test/coordinate/CMakeFiles/test_coordinate_separation.dir/DependInfo.cmake"
+  "test/coordinate/CMakeFiles/test_coordinate_epoch_propagation.dir/DependInfo.cmake"
+  "test/coordinate/CMakeFiles/test_coordinate_trivial_storage.dir/DependInfo.cmake"
+  "test/coordinate/CMakeFiles/test_coordinate_batch_file.dir/DependInfo.cmake"
+  "test/coordinate/CMakeFiles/test_coordinate_batch_expression.dir/DependInfo.cmake"
+  "test/coordinate/CMakeFiles/test_coordinate_raw_kernel.dir/DependInfo.cmake"
+  "test/coordinate/CMakeFiles/test_coordinate_batch_execution.dir/DependInfo.cmake"
+  "test/coordinate/CMakeFiles/test_coordinate_offload_device.dir/DependInfo.cmake"
+  "test/coordinate/CMakeFiles/test_coordinate_wcs.dir/DependInfo.cmake"
+  "test/io/CMakeFiles/test_io_ascii_table.dir/DependInfo.cmake"
+  "test/io/CMakeFiles/test_io_binary_table.dir/DependInfo.cmake"
+  "test/io/CMakeFiles/test_io_catalog_columns.dir/DependInfo.cmake"
+  "test/io/CMakeFiles/test_io_checksum.dir/DependInfo.cmake"
+  "test/io/CMakeFiles/test_io_column_projection.dir/DependInfo.cmake"
+  "test/io/CMakeFiles/test_io_compressed_image.dir/DependInfo.cmake"
+  "test/io/CMakeFiles/test_io_data_source.dir/DependInfo.cmake"
+  "test/io/CMakeFiles/test_io_fits.dir/DependInfo.cmake"
+  "test/io/CMakeFiles/test_io_fits_pipeline.dir/DependInfo.cmake"
+  "test/io/CMakeFiles/test_io_fits_writer.dir/DependInfo.cmake"
+  "test/io/CMakeFiles/test_io_header.dir/DependInfo.cmake"
+  "test/io/CMakeFiles/test_io_header_cache.dir/DependInfo.cmake"
+  "test/io/CMakeFiles/test_io_image.dir/DependInfo.cmake"
+  "test/io/CMakeFiles/test_io_image_background.dir/DependInfo.cmake"
+  "test/io/CMakeFiles/test_io_image_coadd.dir/DependInfo.cmake"
+  "test/io/CMakeFiles/test_io_image_convolution.dir/DependInfo.cmake"
+  "test/io/CMakeFiles/test_io_image_section.dir/DependInfo.cmake"
+  "test/io/CMakeFiles/test_io_image_tile_reader.dir/DependInfo.cmake"
+  "test/io/CMakeFiles/test_io_io_counters.dir/DependInfo.cmake"
+  "test/io/CMakeFiles/test_io_mapped_fits.dir/DependInfo.cmake"
+  "test/io/CMakeFiles/test_io_robust_statistics.dir/DependInfo.cmake"
+  "test/io/CMakeFiles/test_io_scaled_image.dir/DependInfo.cmake"
+  "test/io/CMakeFiles/test_io_table_appender.dir/DependInfo.cmake"
+  "test/io/CMakeFiles/test_io_visit_image.dir/DependInfo.cmake"
+  "test/units/CMakeFiles/test_units_length.dir/DependInfo.cmake"
+  "benchmark/CMakeFiles/benchmark.dir/DependInfo.cmake"
+  "benchmark/CMakeFiles/run_benchmark.dir/DependInfo.cmake"
+  "benchmark/CMakeFiles/benchmark_coordinate_kernels.dir/DependInfo.cmake"
+  "benchmark/CMakeFiles/benchmark_fits_io.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_coordinate_kernels.dir/coordinate_kernels.cpp.o"
+  "CMakeFiles/benchmark_coordinate_kernels.dir/coordinate_kernels.cpp.o.d"
+  "benchmark_coordinate_kernels"
+  "benchmark_coordinate_kernels.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_coordinate_kernels.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
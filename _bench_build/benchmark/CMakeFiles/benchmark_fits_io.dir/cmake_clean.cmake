@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_fits_io.dir/fits_io.cpp.o"
+  "CMakeFiles/benchmark_fits_io.dir/fits_io.cpp.o.d"
+  "benchmark_fits_io"
+  "benchmark_fits_io.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_fits_io.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/benchmark
+# Build directory: /root/repo/_bench_build/benchmark
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(benchmark.astro.coordinate_kernels "/root/repo/_bench_build/benchmark/benchmark_coordinate_kernels" "--quick")
+set_tests_properties(benchmark.astro.coordinate_kernels PROPERTIES  LABELS "benchmark" _BACKTRACE_TRIPLES "/root/repo/benchmark/CMakeLists.txt;25;add_test;/root/repo/benchmark/CMakeLists.txt;0;")
+add_test(benchmark.astro.fits_io "/root/repo/_bench_build/benchmark/benchmark_fits_io" "--quick")
+set_tests_properties(benchmark.astro.fits_io PROPERTIES  LABELS "benchmark" _BACKTRACE_TRIPLES "/root/repo/benchmark/CMakeLists.txt;25;add_test;/root/repo/benchmark/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_coordinate_alt_az_track.dir/alt_az_track.cpp.o"
+  "CMakeFiles/test_coordinate_alt_az_track.dir/alt_az_track.cpp.o.d"
+  "test_coordinate_alt_az_track"
+  "test_coordinate_alt_az_track.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_coordinate_alt_az_track.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_coordinate_batch_execution.dir/batch_execution.cpp.o"
+  "CMakeFiles/test_coordinate_batch_execution.dir/batch_execution.cpp.o.d"
+  "test_coordinate_batch_execution"
+  "test_coordinate_batch_execution.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_coordinate_batch_execution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_coordinate_batch_expression.dir/batch_expression.cpp.o"
+  "CMakeFiles/test_coordinate_batch_expression.dir/batch_expression.cpp.o.d"
+  "test_coordinate_batch_expression"
+  "test_coordinate_batch_expression.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_coordinate_batch_expression.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_coordinate_batch_file.dir/batch_file.cpp.o"
+  "CMakeFiles/test_coordinate_batch_file.dir/batch_file.cpp.o.d"
+  "test_coordinate_batch_file"
+  "test_coordinate_batch_file.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_coordinate_batch_file.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_coordinate_cartesian_differential.dir/cartesian_differential.cpp.o"
+  "CMakeFiles/test_coordinate_cartesian_differential.dir/cartesian_differential.cpp.o.d"
+  "test_coordinate_cartesian_differential"
+  "test_coordinate_cartesian_differential.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_coordinate_cartesian_differential.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_coordinate_cross_match.dir/cross_match.cpp.o"
+  "CMakeFiles/test_coordinate_cross_match.dir/cross_match.cpp.o.d"
+  "test_coordinate_cross_match"
+  "test_coordinate_cross_match.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_coordinate_cross_match.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
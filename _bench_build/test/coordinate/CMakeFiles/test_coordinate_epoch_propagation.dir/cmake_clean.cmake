@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_coordinate_epoch_propagation.dir/epoch_propagation.cpp.o"
+  "CMakeFiles/test_coordinate_epoch_propagation.dir/epoch_propagation.cpp.o.d"
+  "test_coordinate_epoch_propagation"
+  "test_coordinate_epoch_propagation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_coordinate_epoch_propagation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_coordinate_frame_transform.dir/frame_transform.cpp.o"
+  "CMakeFiles/test_coordinate_frame_transform.dir/frame_transform.cpp.o.d"
+  "test_coordinate_frame_transform"
+  "test_coordinate_frame_transform.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_coordinate_frame_transform.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
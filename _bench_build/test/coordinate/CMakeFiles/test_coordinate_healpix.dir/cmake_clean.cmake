@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_coordinate_healpix.dir/healpix.cpp.o"
+  "CMakeFiles/test_coordinate_healpix.dir/healpix.cpp.o.d"
+  "test_coordinate_healpix"
+  "test_coordinate_healpix.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_coordinate_healpix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_coordinate_offload_device.dir/offload_device.cpp.o"
+  "CMakeFiles/test_coordinate_offload_device.dir/offload_device.cpp.o.d"
+  "test_coordinate_offload_device"
+  "test_coordinate_offload_device.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_coordinate_offload_device.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
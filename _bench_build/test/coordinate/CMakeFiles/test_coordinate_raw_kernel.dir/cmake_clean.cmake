@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_coordinate_raw_kernel.dir/raw_kernel.cpp.o"
+  "CMakeFiles/test_coordinate_raw_kernel.dir/raw_kernel.cpp.o.d"
+  "test_coordinate_raw_kernel"
+  "test_coordinate_raw_kernel.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_coordinate_raw_kernel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
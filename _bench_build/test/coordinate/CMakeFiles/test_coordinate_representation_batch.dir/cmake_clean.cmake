@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_coordinate_representation_batch.dir/representation_batch.cpp.o"
+  "CMakeFiles/test_coordinate_representation_batch.dir/representation_batch.cpp.o.d"
+  "test_coordinate_representation_batch"
+  "test_coordinate_representation_batch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_coordinate_representation_batch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
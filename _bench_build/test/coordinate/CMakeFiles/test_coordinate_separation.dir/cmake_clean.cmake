@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_coordinate_separation.dir/separation.cpp.o"
+  "CMakeFiles/test_coordinate_separation.dir/separation.cpp.o.d"
+  "test_coordinate_separation"
+  "test_coordinate_separation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_coordinate_separation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
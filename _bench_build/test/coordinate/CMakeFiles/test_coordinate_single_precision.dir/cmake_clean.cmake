@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_coordinate_single_precision.dir/single_precision.cpp.o"
+  "CMakeFiles/test_coordinate_single_precision.dir/single_precision.cpp.o.d"
+  "test_coordinate_single_precision"
+  "test_coordinate_single_precision.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_coordinate_single_precision.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
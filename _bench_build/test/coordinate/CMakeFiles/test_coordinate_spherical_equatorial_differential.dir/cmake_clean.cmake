@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_coordinate_spherical_equatorial_differential.dir/spherical_equatorial_differential.cpp.o"
+  "CMakeFiles/test_coordinate_spherical_equatorial_differential.dir/spherical_equatorial_differential.cpp.o.d"
+  "test_coordinate_spherical_equatorial_differential"
+  "test_coordinate_spherical_equatorial_differential.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_coordinate_spherical_equatorial_differential.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_coordinate_spherical_representation.dir/spherical_representation.cpp.o"
+  "CMakeFiles/test_coordinate_spherical_representation.dir/spherical_representation.cpp.o.d"
+  "test_coordinate_spherical_representation"
+  "test_coordinate_spherical_representation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_coordinate_spherical_representation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
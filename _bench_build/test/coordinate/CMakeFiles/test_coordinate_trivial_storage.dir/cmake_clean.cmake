@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_coordinate_trivial_storage.dir/trivial_storage.cpp.o"
+  "CMakeFiles/test_coordinate_trivial_storage.dir/trivial_storage.cpp.o.d"
+  "test_coordinate_trivial_storage"
+  "test_coordinate_trivial_storage.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_coordinate_trivial_storage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_coordinate_wcs.dir/wcs.cpp.o"
+  "CMakeFiles/test_coordinate_wcs.dir/wcs.cpp.o.d"
+  "test_coordinate_wcs"
+  "test_coordinate_wcs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_coordinate_wcs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
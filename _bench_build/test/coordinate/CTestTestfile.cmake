@@ -0,0 +1,50 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/coordinate
+# Build directory: /root/repo/_bench_build/test/coordinate
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test.astro.cartesian_representation "/root/repo/_bench_build/test/coordinate/test_coordinate_cartesian_representation")
+set_tests_properties(test.astro.cartesian_representation PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/coordinate/CMakeLists.txt;33;add_test;/root/repo/test/coordinate/CMakeLists.txt;0;")
+add_test(test.astro.cartesian_differential "/root/repo/_bench_build/test/coordinate/test_coordinate_cartesian_differential")
+set_tests_properties(test.astro.cartesian_differential PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/coordinate/CMakeLists.txt;33;add_test;/root/repo/test/coordinate/CMakeLists.txt;0;")
+add_test(test.astro.spherical_representation "/root/repo/_bench_build/test/coordinate/test_coordinate_spherical_representation")
+set_tests_properties(test.astro.spherical_representation PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/coordinate/CMakeLists.txt;33;add_test;/root/repo/test/coordinate/CMakeLists.txt;0;")
+add_test(test.astro.spherical_differential "/root/repo/_bench_build/test/coordinate/test_coordinate_spherical_differential")
+set_tests_properties(test.astro.spherical_differential PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/coordinate/CMakeLists.txt;33;add_test;/root/repo/test/coordinate/CMakeLists.txt;0;")
+add_test(test.astro.spherical_equatorial_representation "/root/repo/_bench_build/test/coordinate/test_coordinate_spherical_equatorial_representation")
+set_tests_properties(test.astro.spherical_equatorial_representation PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/coordinate/CMakeLists.txt;33;add_test;/root/repo/test/coordinate/CMakeLists.txt;0;")
+add_test(test.astro.spherical_equatorial_differential "/root/repo/_bench_build/test/coordinate/test_coordinate_spherical_equatorial_differential")
+set_tests_properties(test.astro.spherical_equatorial_differential PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/coordinate/CMakeLists.txt;33;add_test;/root/repo/test/coordinate/CMakeLists.txt;0;")
+add_test(test.astro.representation_batch "/root/repo/_bench_build/test/coordinate/test_coordinate_representation_batch")
+set_tests_properties(test.astro.representation_batch PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/coordinate/CMakeLists.txt;33;add_test;/root/repo/test/coordinate/CMakeLists.txt;0;")
+add_test(test.astro.frame_transform "/root/repo/_bench_build/test/coordinate/test_coordinate_frame_transform")
+set_tests_properties(test.astro.frame_transform PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/coordinate/CMakeLists.txt;33;add_test;/root/repo/test/coordinate/CMakeLists.txt;0;")
+add_test(test.astro.time_transform "/root/repo/_bench_build/test/coordinate/test_coordinate_time_transform")
+set_tests_properties(test.astro.time_transform PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/coordinate/CMakeLists.txt;33;add_test;/root/repo/test/coordinate/CMakeLists.txt;0;")
+add_test(test.astro.alt_az_track "/root/repo/_bench_build/test/coordinate/test_coordinate_alt_az_track")
+set_tests_properties(test.astro.alt_az_track PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/coordinate/CMakeLists.txt;33;add_test;/root/repo/test/coordinate/CMakeLists.txt;0;")
+add_test(test.astro.single_precision "/root/repo/_bench_build/test/coordinate/test_coordinate_single_precision")
+set_tests_properties(test.astro.single_precision PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/coordinate/CMakeLists.txt;33;add_test;/root/repo/test/coordinate/CMakeLists.txt;0;")
+add_test(test.astro.healpix "/root/repo/_bench_build/test/coordinate/test_coordinate_healpix")
+set_tests_properties(test.astro.healpix PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/coordinate/CMakeLists.txt;33;add_test;/root/repo/test/coordinate/CMakeLists.txt;0;")
+add_test(test.astro.cross_match "/root/repo/_bench_build/test/coordinate/test_coordinate_cross_match")
+set_tests_properties(test.astro.cross_match PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/coordinate/CMakeLists.txt;33;add_test;/root/repo/test/coordinate/CMakeLists.txt;0;")
+add_test(test.astro.separation "/root/repo/_bench_build/test/coordinate/test_coordinate_separation")
+set_tests_properties(test.astro.separation PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/coordinate/CMakeLists.txt;33;add_test;/root/repo/test/coordinate/CMakeLists.txt;0;")
+add_test(test.astro.epoch_propagation "/root/repo/_bench_build/test/coordinate/test_coordinate_epoch_propagation")
+set_tests_properties(test.astro.epoch_propagation PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/coordinate/CMakeLists.txt;33;add_test;/root/repo/test/coordinate/CMakeLists.txt;0;")
+add_test(test.astro.trivial_storage "/root/repo/_bench_build/test/coordinate/test_coordinate_trivial_storage")
+set_tests_properties(test.astro.trivial_storage PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/coordinate/CMakeLists.txt;33;add_test;/root/repo/test/coordinate/CMakeLists.txt;0;")
+add_test(test.astro.batch_file "/root/repo/_bench_build/test/coordinate/test_coordinate_batch_file")
+set_tests_properties(test.astro.batch_file PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/coordinate/CMakeLists.txt;33;add_test;/root/repo/test/coordinate/CMakeLists.txt;0;")
+add_test(test.astro.batch_expression "/root/repo/_bench_build/test/coordinate/test_coordinate_batch_expression")
+set_tests_properties(test.astro.batch_expression PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/coordinate/CMakeLists.txt;33;add_test;/root/repo/test/coordinate/CMakeLists.txt;0;")
+add_test(test.astro.raw_kernel "/root/repo/_bench_build/test/coordinate/test_coordinate_raw_kernel")
+set_tests_properties(test.astro.raw_kernel PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/coordinate/CMakeLists.txt;33;add_test;/root/repo/test/coordinate/CMakeLists.txt;0;")
+add_test(test.astro.batch_execution "/root/repo/_bench_build/test/coordinate/test_coordinate_batch_execution")
+set_tests_properties(test.astro.batch_execution PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/coordinate/CMakeLists.txt;33;add_test;/root/repo/test/coordinate/CMakeLists.txt;0;")
+add_test(test.astro.offload_device "/root/repo/_bench_build/test/coordinate/test_coordinate_offload_device")
+set_tests_properties(test.astro.offload_device PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/coordinate/CMakeLists.txt;33;add_test;/root/repo/test/coordinate/CMakeLists.txt;0;")
+add_test(test.astro.wcs "/root/repo/_bench_build/test/coordinate/test_coordinate_wcs")
+set_tests_properties(test.astro.wcs PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/coordinate/CMakeLists.txt;33;add_test;/root/repo/test/coordinate/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-alt_az.dir/__/headers/coordinate-alt_az.cpp.o"
+  "CMakeFiles/test_header_coordinate-alt_az.dir/__/headers/coordinate-alt_az.cpp.o.d"
+  "test_header_coordinate-alt_az"
+  "test_header_coordinate-alt_az.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-alt_az.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
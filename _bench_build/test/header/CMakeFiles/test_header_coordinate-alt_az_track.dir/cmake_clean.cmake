@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-alt_az_track.dir/__/headers/coordinate-alt_az_track.cpp.o"
+  "CMakeFiles/test_header_coordinate-alt_az_track.dir/__/headers/coordinate-alt_az_track.cpp.o.d"
+  "test_header_coordinate-alt_az_track"
+  "test_header_coordinate-alt_az_track.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-alt_az_track.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-arithmetic.dir/__/headers/coordinate-arithmetic.cpp.o"
+  "CMakeFiles/test_header_coordinate-arithmetic.dir/__/headers/coordinate-arithmetic.cpp.o.d"
+  "test_header_coordinate-arithmetic"
+  "test_header_coordinate-arithmetic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-arithmetic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-base_frame.dir/__/headers/coordinate-base_frame.cpp.o"
+  "CMakeFiles/test_header_coordinate-base_frame.dir/__/headers/coordinate-base_frame.cpp.o.d"
+  "test_header_coordinate-base_frame"
+  "test_header_coordinate-base_frame.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-base_frame.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
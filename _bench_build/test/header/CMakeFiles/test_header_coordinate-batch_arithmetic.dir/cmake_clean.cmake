@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-batch_arithmetic.dir/__/headers/coordinate-batch_arithmetic.cpp.o"
+  "CMakeFiles/test_header_coordinate-batch_arithmetic.dir/__/headers/coordinate-batch_arithmetic.cpp.o.d"
+  "test_header_coordinate-batch_arithmetic"
+  "test_header_coordinate-batch_arithmetic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-batch_arithmetic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-batch_expression.dir/__/headers/coordinate-batch_expression.cpp.o"
+  "CMakeFiles/test_header_coordinate-batch_expression.dir/__/headers/coordinate-batch_expression.cpp.o.d"
+  "test_header_coordinate-batch_expression"
+  "test_header_coordinate-batch_expression.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-batch_expression.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-batch_file.dir/__/headers/coordinate-batch_file.cpp.o"
+  "CMakeFiles/test_header_coordinate-batch_file.dir/__/headers/coordinate-batch_file.cpp.o.d"
+  "test_header_coordinate-batch_file"
+  "test_header_coordinate-batch_file.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-batch_file.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
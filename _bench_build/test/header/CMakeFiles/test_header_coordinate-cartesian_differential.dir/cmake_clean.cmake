@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-cartesian_differential.dir/__/headers/coordinate-cartesian_differential.cpp.o"
+  "CMakeFiles/test_header_coordinate-cartesian_differential.dir/__/headers/coordinate-cartesian_differential.cpp.o.d"
+  "test_header_coordinate-cartesian_differential"
+  "test_header_coordinate-cartesian_differential.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-cartesian_differential.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
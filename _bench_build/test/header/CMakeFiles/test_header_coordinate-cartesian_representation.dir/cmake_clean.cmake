@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-cartesian_representation.dir/__/headers/coordinate-cartesian_representation.cpp.o"
+  "CMakeFiles/test_header_coordinate-cartesian_representation.dir/__/headers/coordinate-cartesian_representation.cpp.o.d"
+  "test_header_coordinate-cartesian_representation"
+  "test_header_coordinate-cartesian_representation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-cartesian_representation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
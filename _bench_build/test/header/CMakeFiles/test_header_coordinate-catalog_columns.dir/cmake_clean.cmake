@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-catalog_columns.dir/__/headers/coordinate-catalog_columns.cpp.o"
+  "CMakeFiles/test_header_coordinate-catalog_columns.dir/__/headers/coordinate-catalog_columns.cpp.o.d"
+  "test_header_coordinate-catalog_columns"
+  "test_header_coordinate-catalog_columns.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-catalog_columns.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-cirs.dir/__/headers/coordinate-cirs.cpp.o"
+  "CMakeFiles/test_header_coordinate-cirs.dir/__/headers/coordinate-cirs.cpp.o.d"
+  "test_header_coordinate-cirs"
+  "test_header_coordinate-cirs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-cirs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-coordinate.dir/__/headers/coordinate-coordinate.cpp.o"
+  "CMakeFiles/test_header_coordinate-coordinate.dir/__/headers/coordinate-coordinate.cpp.o.d"
+  "test_header_coordinate-coordinate"
+  "test_header_coordinate-coordinate.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-coordinate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-cross_match.dir/__/headers/coordinate-cross_match.cpp.o"
+  "CMakeFiles/test_header_coordinate-cross_match.dir/__/headers/coordinate-cross_match.cpp.o.d"
+  "test_header_coordinate-cross_match"
+  "test_header_coordinate-cross_match.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-cross_match.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
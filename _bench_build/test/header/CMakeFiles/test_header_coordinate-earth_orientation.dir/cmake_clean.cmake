@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-earth_orientation.dir/__/headers/coordinate-earth_orientation.cpp.o"
+  "CMakeFiles/test_header_coordinate-earth_orientation.dir/__/headers/coordinate-earth_orientation.cpp.o.d"
+  "test_header_coordinate-earth_orientation"
+  "test_header_coordinate-earth_orientation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-earth_orientation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
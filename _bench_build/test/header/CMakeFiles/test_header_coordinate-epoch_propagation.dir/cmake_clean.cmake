@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-epoch_propagation.dir/__/headers/coordinate-epoch_propagation.cpp.o"
+  "CMakeFiles/test_header_coordinate-epoch_propagation.dir/__/headers/coordinate-epoch_propagation.cpp.o.d"
+  "test_header_coordinate-epoch_propagation"
+  "test_header_coordinate-epoch_propagation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-epoch_propagation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-frame.dir/__/headers/coordinate-frame.cpp.o"
+  "CMakeFiles/test_header_coordinate-frame.dir/__/headers/coordinate-frame.cpp.o.d"
+  "test_header_coordinate-frame"
+  "test_header_coordinate-frame.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-frame.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
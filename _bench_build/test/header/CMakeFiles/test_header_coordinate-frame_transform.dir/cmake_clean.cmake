@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-frame_transform.dir/__/headers/coordinate-frame_transform.cpp.o"
+  "CMakeFiles/test_header_coordinate-frame_transform.dir/__/headers/coordinate-frame_transform.cpp.o.d"
+  "test_header_coordinate-frame_transform"
+  "test_header_coordinate-frame_transform.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-frame_transform.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-galactic.dir/__/headers/coordinate-galactic.cpp.o"
+  "CMakeFiles/test_header_coordinate-galactic.dir/__/headers/coordinate-galactic.cpp.o.d"
+  "test_header_coordinate-galactic"
+  "test_header_coordinate-galactic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-galactic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
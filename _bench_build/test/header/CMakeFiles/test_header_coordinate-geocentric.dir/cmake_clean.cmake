@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-geocentric.dir/__/headers/coordinate-geocentric.cpp.o"
+  "CMakeFiles/test_header_coordinate-geocentric.dir/__/headers/coordinate-geocentric.cpp.o.d"
+  "test_header_coordinate-geocentric"
+  "test_header_coordinate-geocentric.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-geocentric.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-healpix.dir/__/headers/coordinate-healpix.cpp.o"
+  "CMakeFiles/test_header_coordinate-healpix.dir/__/headers/coordinate-healpix.cpp.o.d"
+  "test_header_coordinate-healpix"
+  "test_header_coordinate-healpix.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-healpix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-heliocentric.dir/__/headers/coordinate-heliocentric.cpp.o"
+  "CMakeFiles/test_header_coordinate-heliocentric.dir/__/headers/coordinate-heliocentric.cpp.o.d"
+  "test_header_coordinate-heliocentric"
+  "test_header_coordinate-heliocentric.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-heliocentric.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-icrs.dir/__/headers/coordinate-icrs.cpp.o"
+  "CMakeFiles/test_header_coordinate-icrs.dir/__/headers/coordinate-icrs.cpp.o.d"
+  "test_header_coordinate-icrs"
+  "test_header_coordinate-icrs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-icrs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-io.dir/__/headers/coordinate-io.cpp.o"
+  "CMakeFiles/test_header_coordinate-io.dir/__/headers/coordinate-io.cpp.o.d"
+  "test_header_coordinate-io"
+  "test_header_coordinate-io.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-io.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-kd_tree.dir/__/headers/coordinate-kd_tree.cpp.o"
+  "CMakeFiles/test_header_coordinate-kd_tree.dir/__/headers/coordinate-kd_tree.cpp.o.d"
+  "test_header_coordinate-kd_tree"
+  "test_header_coordinate-kd_tree.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-kd_tree.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
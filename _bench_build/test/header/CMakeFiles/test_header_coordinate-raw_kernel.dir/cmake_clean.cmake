@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-raw_kernel.dir/__/headers/coordinate-raw_kernel.cpp.o"
+  "CMakeFiles/test_header_coordinate-raw_kernel.dir/__/headers/coordinate-raw_kernel.cpp.o.d"
+  "test_header_coordinate-raw_kernel"
+  "test_header_coordinate-raw_kernel.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-raw_kernel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
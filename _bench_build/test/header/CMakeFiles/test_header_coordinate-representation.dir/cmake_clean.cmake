@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-representation.dir/__/headers/coordinate-representation.cpp.o"
+  "CMakeFiles/test_header_coordinate-representation.dir/__/headers/coordinate-representation.cpp.o.d"
+  "test_header_coordinate-representation"
+  "test_header_coordinate-representation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-representation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
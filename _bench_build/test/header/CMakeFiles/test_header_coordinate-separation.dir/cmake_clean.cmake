@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-separation.dir/__/headers/coordinate-separation.cpp.o"
+  "CMakeFiles/test_header_coordinate-separation.dir/__/headers/coordinate-separation.cpp.o.d"
+  "test_header_coordinate-separation"
+  "test_header_coordinate-separation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-separation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-sky_point.dir/__/headers/coordinate-sky_point.cpp.o"
+  "CMakeFiles/test_header_coordinate-sky_point.dir/__/headers/coordinate-sky_point.cpp.o.d"
+  "test_header_coordinate-sky_point"
+  "test_header_coordinate-sky_point.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-sky_point.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
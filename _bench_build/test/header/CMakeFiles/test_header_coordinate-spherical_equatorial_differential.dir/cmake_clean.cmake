@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-spherical_equatorial_differential.dir/__/headers/coordinate-spherical_equatorial_differential.cpp.o"
+  "CMakeFiles/test_header_coordinate-spherical_equatorial_differential.dir/__/headers/coordinate-spherical_equatorial_differential.cpp.o.d"
+  "test_header_coordinate-spherical_equatorial_differential"
+  "test_header_coordinate-spherical_equatorial_differential.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-spherical_equatorial_differential.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-spherical_equatorial_representation_batch.dir/__/headers/coordinate-spherical_equatorial_representation_batch.cpp.o"
+  "CMakeFiles/test_header_coordinate-spherical_equatorial_representation_batch.dir/__/headers/coordinate-spherical_equatorial_representation_batch.cpp.o.d"
+  "test_header_coordinate-spherical_equatorial_representation_batch"
+  "test_header_coordinate-spherical_equatorial_representation_batch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-spherical_equatorial_representation_batch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
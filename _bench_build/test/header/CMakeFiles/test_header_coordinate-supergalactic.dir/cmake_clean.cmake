@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-supergalactic.dir/__/headers/coordinate-supergalactic.cpp.o"
+  "CMakeFiles/test_header_coordinate-supergalactic.dir/__/headers/coordinate-supergalactic.cpp.o.d"
+  "test_header_coordinate-supergalactic"
+  "test_header_coordinate-supergalactic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-supergalactic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
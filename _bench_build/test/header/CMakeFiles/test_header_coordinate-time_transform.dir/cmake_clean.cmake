@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-time_transform.dir/__/headers/coordinate-time_transform.cpp.o"
+  "CMakeFiles/test_header_coordinate-time_transform.dir/__/headers/coordinate-time_transform.cpp.o.d"
+  "test_header_coordinate-time_transform"
+  "test_header_coordinate-time_transform.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-time_transform.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_coordinate-wcs.dir/__/headers/coordinate-wcs.cpp.o"
+  "CMakeFiles/test_header_coordinate-wcs.dir/__/headers/coordinate-wcs.cpp.o.d"
+  "test_header_coordinate-wcs"
+  "test_header_coordinate-wcs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_coordinate-wcs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_detail-ascii_number.dir/__/headers/detail-ascii_number.cpp.o"
+  "CMakeFiles/test_header_detail-ascii_number.dir/__/headers/detail-ascii_number.cpp.o.d"
+  "test_header_detail-ascii_number"
+  "test_header_detail-ascii_number.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_detail-ascii_number.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_detail-batch_conversion.dir/__/headers/detail-batch_conversion.cpp.o"
+  "CMakeFiles/test_header_detail-batch_conversion.dir/__/headers/detail-batch_conversion.cpp.o.d"
+  "test_header_detail-batch_conversion"
+  "test_header_detail-batch_conversion.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_detail-batch_conversion.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_detail-batch_execution.dir/__/headers/detail-batch_execution.cpp.o"
+  "CMakeFiles/test_header_detail-batch_execution.dir/__/headers/detail-batch_execution.cpp.o.d"
+  "test_header_detail-batch_execution"
+  "test_header_detail-batch_execution.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_detail-batch_execution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_detail-bounded_queue.dir/__/headers/detail-bounded_queue.cpp.o"
+  "CMakeFiles/test_header_detail-bounded_queue.dir/__/headers/detail-bounded_queue.cpp.o.d"
+  "test_header_detail-bounded_queue"
+  "test_header_detail-bounded_queue.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_detail-bounded_queue.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_detail-endian.dir/__/headers/detail-endian.cpp.o"
+  "CMakeFiles/test_header_detail-endian.dir/__/headers/detail-endian.cpp.o.d"
+  "test_header_detail-endian"
+  "test_header_detail-endian.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_detail-endian.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
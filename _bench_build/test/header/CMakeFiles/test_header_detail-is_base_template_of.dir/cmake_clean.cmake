@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_detail-is_base_template_of.dir/__/headers/detail-is_base_template_of.cpp.o"
+  "CMakeFiles/test_header_detail-is_base_template_of.dir/__/headers/detail-is_base_template_of.cpp.o.d"
+  "test_header_detail-is_base_template_of"
+  "test_header_detail-is_base_template_of.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_detail-is_base_template_of.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_detail-is_trivial_storage.dir/__/headers/detail-is_trivial_storage.cpp.o"
+  "CMakeFiles/test_header_detail-is_trivial_storage.dir/__/headers/detail-is_trivial_storage.cpp.o.d"
+  "test_header_detail-is_trivial_storage"
+  "test_header_detail-is_trivial_storage.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_detail-is_trivial_storage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_detail-lru_cache.dir/__/headers/detail-lru_cache.cpp.o"
+  "CMakeFiles/test_header_detail-lru_cache.dir/__/headers/detail-lru_cache.cpp.o.d"
+  "test_header_detail-lru_cache"
+  "test_header_detail-lru_cache.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_detail-lru_cache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_detail-monotonic_arena.dir/__/headers/detail-monotonic_arena.cpp.o"
+  "CMakeFiles/test_header_detail-monotonic_arena.dir/__/headers/detail-monotonic_arena.cpp.o.d"
+  "test_header_detail-monotonic_arena"
+  "test_header_detail-monotonic_arena.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_detail-monotonic_arena.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_detail-parallel_bands.dir/__/headers/detail-parallel_bands.cpp.o"
+  "CMakeFiles/test_header_detail-parallel_bands.dir/__/headers/detail-parallel_bands.cpp.o.d"
+  "test_header_detail-parallel_bands"
+  "test_header_detail-parallel_bands.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_detail-parallel_bands.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
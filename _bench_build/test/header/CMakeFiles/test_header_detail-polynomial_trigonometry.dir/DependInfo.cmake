@@ -0,0 +1,19 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_bench_build/test/headers/detail-polynomial_trigonometry.cpp" "test/header/CMakeFiles/test_header_detail-polynomial_trigonometry.dir/__/headers/detail-polynomial_trigonometry.cpp.o" "gcc" "test/header/CMakeFiles/test_header_detail-polynomial_trigonometry.dir/__/headers/detail-polynomial_trigonometry.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
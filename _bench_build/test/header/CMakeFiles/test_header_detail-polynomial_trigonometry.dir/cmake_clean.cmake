@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_detail-polynomial_trigonometry.dir/__/headers/detail-polynomial_trigonometry.cpp.o"
+  "CMakeFiles/test_header_detail-polynomial_trigonometry.dir/__/headers/detail-polynomial_trigonometry.cpp.o.d"
+  "test_header_detail-polynomial_trigonometry"
+  "test_header_detail-polynomial_trigonometry.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_detail-polynomial_trigonometry.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
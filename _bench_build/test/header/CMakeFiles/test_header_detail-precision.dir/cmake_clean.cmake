@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_detail-precision.dir/__/headers/detail-precision.cpp.o"
+  "CMakeFiles/test_header_detail-precision.dir/__/headers/detail-precision.cpp.o.d"
+  "test_header_detail-precision"
+  "test_header_detail-precision.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_detail-precision.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
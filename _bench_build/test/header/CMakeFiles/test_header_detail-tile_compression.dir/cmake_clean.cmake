@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_detail-tile_compression.dir/__/headers/detail-tile_compression.cpp.o"
+  "CMakeFiles/test_header_detail-tile_compression.dir/__/headers/detail-tile_compression.cpp.o.d"
+  "test_header_detail-tile_compression"
+  "test_header_detail-tile_compression.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_detail-tile_compression.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_detail-unit_scale.dir/__/headers/detail-unit_scale.cpp.o"
+  "CMakeFiles/test_header_detail-unit_scale.dir/__/headers/detail-unit_scale.cpp.o.d"
+  "test_header_detail-unit_scale"
+  "test_header_detail-unit_scale.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_detail-unit_scale.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
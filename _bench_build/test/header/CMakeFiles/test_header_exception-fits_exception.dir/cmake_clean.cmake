@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_exception-fits_exception.dir/__/headers/exception-fits_exception.cpp.o"
+  "CMakeFiles/test_header_exception-fits_exception.dir/__/headers/exception-fits_exception.cpp.o.d"
+  "test_header_exception-fits_exception"
+  "test_header_exception-fits_exception.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_exception-fits_exception.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-ascii_table.dir/__/headers/io-ascii_table.cpp.o"
+  "CMakeFiles/test_header_io-ascii_table.dir/__/headers/io-ascii_table.cpp.o.d"
+  "test_header_io-ascii_table"
+  "test_header_io-ascii_table.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-ascii_table.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-binary_table.dir/__/headers/io-binary_table.cpp.o"
+  "CMakeFiles/test_header_io-binary_table.dir/__/headers/io-binary_table.cpp.o.d"
+  "test_header_io-binary_table"
+  "test_header_io-binary_table.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-binary_table.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-bitpix.dir/__/headers/io-bitpix.cpp.o"
+  "CMakeFiles/test_header_io-bitpix.dir/__/headers/io-bitpix.cpp.o.d"
+  "test_header_io-bitpix"
+  "test_header_io-bitpix.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-bitpix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
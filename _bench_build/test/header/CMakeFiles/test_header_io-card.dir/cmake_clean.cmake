@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-card.dir/__/headers/io-card.cpp.o"
+  "CMakeFiles/test_header_io-card.dir/__/headers/io-card.cpp.o.d"
+  "test_header_io-card"
+  "test_header_io-card.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-card.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
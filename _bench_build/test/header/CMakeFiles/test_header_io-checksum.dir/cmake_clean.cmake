@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-checksum.dir/__/headers/io-checksum.cpp.o"
+  "CMakeFiles/test_header_io-checksum.dir/__/headers/io-checksum.cpp.o.d"
+  "test_header_io-checksum"
+  "test_header_io-checksum.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-checksum.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
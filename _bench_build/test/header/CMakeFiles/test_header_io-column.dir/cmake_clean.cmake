@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-column.dir/__/headers/io-column.cpp.o"
+  "CMakeFiles/test_header_io-column.dir/__/headers/io-column.cpp.o.d"
+  "test_header_io-column"
+  "test_header_io-column.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-column.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-column_data.dir/__/headers/io-column_data.cpp.o"
+  "CMakeFiles/test_header_io-column_data.dir/__/headers/io-column_data.cpp.o.d"
+  "test_header_io-column_data"
+  "test_header_io-column_data.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-column_data.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
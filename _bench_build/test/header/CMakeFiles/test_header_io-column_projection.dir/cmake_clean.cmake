@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-column_projection.dir/__/headers/io-column_projection.cpp.o"
+  "CMakeFiles/test_header_io-column_projection.dir/__/headers/io-column_projection.cpp.o.d"
+  "test_header_io-column_projection"
+  "test_header_io-column_projection.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-column_projection.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
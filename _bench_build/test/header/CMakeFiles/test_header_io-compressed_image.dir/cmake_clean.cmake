@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-compressed_image.dir/__/headers/io-compressed_image.cpp.o"
+  "CMakeFiles/test_header_io-compressed_image.dir/__/headers/io-compressed_image.cpp.o.d"
+  "test_header_io-compressed_image"
+  "test_header_io-compressed_image.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-compressed_image.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
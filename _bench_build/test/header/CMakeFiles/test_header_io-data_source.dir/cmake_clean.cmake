@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-data_source.dir/__/headers/io-data_source.cpp.o"
+  "CMakeFiles/test_header_io-data_source.dir/__/headers/io-data_source.cpp.o.d"
+  "test_header_io-data_source"
+  "test_header_io-data_source.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-data_source.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-fits.dir/__/headers/io-fits.cpp.o"
+  "CMakeFiles/test_header_io-fits.dir/__/headers/io-fits.cpp.o.d"
+  "test_header_io-fits"
+  "test_header_io-fits.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-fits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-fits_pipeline.dir/__/headers/io-fits_pipeline.cpp.o"
+  "CMakeFiles/test_header_io-fits_pipeline.dir/__/headers/io-fits_pipeline.cpp.o.d"
+  "test_header_io-fits_pipeline"
+  "test_header_io-fits_pipeline.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-fits_pipeline.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-fits_writer.dir/__/headers/io-fits_writer.cpp.o"
+  "CMakeFiles/test_header_io-fits_writer.dir/__/headers/io-fits_writer.cpp.o.d"
+  "test_header_io-fits_writer"
+  "test_header_io-fits_writer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-fits_writer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-hdu.dir/__/headers/io-hdu.cpp.o"
+  "CMakeFiles/test_header_io-hdu.dir/__/headers/io-hdu.cpp.o.d"
+  "test_header_io-hdu"
+  "test_header_io-hdu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-hdu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
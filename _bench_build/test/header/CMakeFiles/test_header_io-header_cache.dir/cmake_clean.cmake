@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-header_cache.dir/__/headers/io-header_cache.cpp.o"
+  "CMakeFiles/test_header_io-header_cache.dir/__/headers/io-header_cache.cpp.o.d"
+  "test_header_io-header_cache"
+  "test_header_io-header_cache.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-header_cache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-header_scanner.dir/__/headers/io-header_scanner.cpp.o"
+  "CMakeFiles/test_header_io-header_scanner.dir/__/headers/io-header_scanner.cpp.o.d"
+  "test_header_io-header_scanner"
+  "test_header_io-header_scanner.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-header_scanner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
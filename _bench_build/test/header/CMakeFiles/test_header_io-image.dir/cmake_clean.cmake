@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-image.dir/__/headers/io-image.cpp.o"
+  "CMakeFiles/test_header_io-image.dir/__/headers/io-image.cpp.o.d"
+  "test_header_io-image"
+  "test_header_io-image.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-image.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-image_background.dir/__/headers/io-image_background.cpp.o"
+  "CMakeFiles/test_header_io-image_background.dir/__/headers/io-image_background.cpp.o.d"
+  "test_header_io-image_background"
+  "test_header_io-image_background.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-image_background.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
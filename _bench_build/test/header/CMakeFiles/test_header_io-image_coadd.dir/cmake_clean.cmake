@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-image_coadd.dir/__/headers/io-image_coadd.cpp.o"
+  "CMakeFiles/test_header_io-image_coadd.dir/__/headers/io-image_coadd.cpp.o.d"
+  "test_header_io-image_coadd"
+  "test_header_io-image_coadd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-image_coadd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-image_convolution.dir/__/headers/io-image_convolution.cpp.o"
+  "CMakeFiles/test_header_io-image_convolution.dir/__/headers/io-image_convolution.cpp.o.d"
+  "test_header_io-image_convolution"
+  "test_header_io-image_convolution.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-image_convolution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-image_section.dir/__/headers/io-image_section.cpp.o"
+  "CMakeFiles/test_header_io-image_section.dir/__/headers/io-image_section.cpp.o.d"
+  "test_header_io-image_section"
+  "test_header_io-image_section.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-image_section.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-image_statistics.dir/__/headers/io-image_statistics.cpp.o"
+  "CMakeFiles/test_header_io-image_statistics.dir/__/headers/io-image_statistics.cpp.o.d"
+  "test_header_io-image_statistics"
+  "test_header_io-image_statistics.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-image_statistics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-image_tile_reader.dir/__/headers/io-image_tile_reader.cpp.o"
+  "CMakeFiles/test_header_io-image_tile_reader.dir/__/headers/io-image_tile_reader.cpp.o.d"
+  "test_header_io-image_tile_reader"
+  "test_header_io-image_tile_reader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-image_tile_reader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-image_view.dir/__/headers/io-image_view.cpp.o"
+  "CMakeFiles/test_header_io-image_view.dir/__/headers/io-image_view.cpp.o.d"
+  "test_header_io-image_view"
+  "test_header_io-image_view.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-image_view.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
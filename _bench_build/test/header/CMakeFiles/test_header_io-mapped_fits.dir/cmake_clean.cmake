@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-mapped_fits.dir/__/headers/io-mapped_fits.cpp.o"
+  "CMakeFiles/test_header_io-mapped_fits.dir/__/headers/io-mapped_fits.cpp.o.d"
+  "test_header_io-mapped_fits"
+  "test_header_io-mapped_fits.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-mapped_fits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-primary_hdu.dir/__/headers/io-primary_hdu.cpp.o"
+  "CMakeFiles/test_header_io-primary_hdu.dir/__/headers/io-primary_hdu.cpp.o.d"
+  "test_header_io-primary_hdu"
+  "test_header_io-primary_hdu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-primary_hdu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-source_fits.dir/__/headers/io-source_fits.cpp.o"
+  "CMakeFiles/test_header_io-source_fits.dir/__/headers/io-source_fits.cpp.o.d"
+  "test_header_io-source_fits"
+  "test_header_io-source_fits.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-source_fits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
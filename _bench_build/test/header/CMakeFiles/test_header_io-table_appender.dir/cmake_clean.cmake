@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-table_appender.dir/__/headers/io-table_appender.cpp.o"
+  "CMakeFiles/test_header_io-table_appender.dir/__/headers/io-table_appender.cpp.o.d"
+  "test_header_io-table_appender"
+  "test_header_io-table_appender.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-table_appender.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_io-table_extension.dir/__/headers/io-table_extension.cpp.o"
+  "CMakeFiles/test_header_io-table_extension.dir/__/headers/io-table_extension.cpp.o.d"
+  "test_header_io-table_extension"
+  "test_header_io-table_extension.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_io-table_extension.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
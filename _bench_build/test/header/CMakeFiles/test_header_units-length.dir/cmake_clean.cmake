@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_header_units-length.dir/__/headers/units-length.cpp.o"
+  "CMakeFiles/test_header_units-length.dir/__/headers/units-length.cpp.o.d"
+  "test_header_units-length"
+  "test_header_units-length.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_header_units-length.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
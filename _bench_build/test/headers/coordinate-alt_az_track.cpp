@@ -0,0 +1,8 @@
+#define BOOST_ASTRONOMY_TEST_INCLUDE_HEADER() <boost/astronomy/coordinate/alt_az_track.hpp>
+
+#include BOOST_ASTRONOMY_TEST_INCLUDE_HEADER()
+
+int main()
+{
+    return 0;
+}
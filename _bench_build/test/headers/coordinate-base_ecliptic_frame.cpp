@@ -0,0 +1,8 @@
+#define BOOST_ASTRONOMY_TEST_INCLUDE_HEADER() <boost/astronomy/coordinate/base_ecliptic_frame.hpp>
+
+#include BOOST_ASTRONOMY_TEST_INCLUDE_HEADER()
+
+int main()
+{
+    return 0;
+}
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_io_ascii_table.dir/ascii_table.cpp.o"
+  "CMakeFiles/test_io_ascii_table.dir/ascii_table.cpp.o.d"
+  "test_io_ascii_table"
+  "test_io_ascii_table.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_io_ascii_table.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_io_binary_table.dir/binary_table.cpp.o"
+  "CMakeFiles/test_io_binary_table.dir/binary_table.cpp.o.d"
+  "test_io_binary_table"
+  "test_io_binary_table.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_io_binary_table.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_io_catalog_columns.dir/catalog_columns.cpp.o"
+  "CMakeFiles/test_io_catalog_columns.dir/catalog_columns.cpp.o.d"
+  "test_io_catalog_columns"
+  "test_io_catalog_columns.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_io_catalog_columns.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_io_checksum.dir/checksum.cpp.o"
+  "CMakeFiles/test_io_checksum.dir/checksum.cpp.o.d"
+  "test_io_checksum"
+  "test_io_checksum.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_io_checksum.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_io_column_projection.dir/column_projection.cpp.o"
+  "CMakeFiles/test_io_column_projection.dir/column_projection.cpp.o.d"
+  "test_io_column_projection"
+  "test_io_column_projection.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_io_column_projection.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
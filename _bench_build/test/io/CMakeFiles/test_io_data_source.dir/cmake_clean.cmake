@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_io_data_source.dir/data_source.cpp.o"
+  "CMakeFiles/test_io_data_source.dir/data_source.cpp.o.d"
+  "test_io_data_source"
+  "test_io_data_source.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_io_data_source.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
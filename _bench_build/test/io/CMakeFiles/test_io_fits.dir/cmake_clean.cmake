@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_io_fits.dir/fits.cpp.o"
+  "CMakeFiles/test_io_fits.dir/fits.cpp.o.d"
+  "test_io_fits"
+  "test_io_fits.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_io_fits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
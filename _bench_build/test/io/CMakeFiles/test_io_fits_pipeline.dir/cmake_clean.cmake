@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_io_fits_pipeline.dir/fits_pipeline.cpp.o"
+  "CMakeFiles/test_io_fits_pipeline.dir/fits_pipeline.cpp.o.d"
+  "test_io_fits_pipeline"
+  "test_io_fits_pipeline.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_io_fits_pipeline.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_io_header.dir/header.cpp.o"
+  "CMakeFiles/test_io_header.dir/header.cpp.o.d"
+  "test_io_header"
+  "test_io_header.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_io_header.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_io_header_cache.dir/header_cache.cpp.o"
+  "CMakeFiles/test_io_header_cache.dir/header_cache.cpp.o.d"
+  "test_io_header_cache"
+  "test_io_header_cache.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_io_header_cache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
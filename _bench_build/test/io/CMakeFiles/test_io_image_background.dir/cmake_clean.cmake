@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_io_image_background.dir/image_background.cpp.o"
+  "CMakeFiles/test_io_image_background.dir/image_background.cpp.o.d"
+  "test_io_image_background"
+  "test_io_image_background.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_io_image_background.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
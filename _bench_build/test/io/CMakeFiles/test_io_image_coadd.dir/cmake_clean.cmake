@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_io_image_coadd.dir/image_coadd.cpp.o"
+  "CMakeFiles/test_io_image_coadd.dir/image_coadd.cpp.o.d"
+  "test_io_image_coadd"
+  "test_io_image_coadd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_io_image_coadd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_io_image_convolution.dir/image_convolution.cpp.o"
+  "CMakeFiles/test_io_image_convolution.dir/image_convolution.cpp.o.d"
+  "test_io_image_convolution"
+  "test_io_image_convolution.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_io_image_convolution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
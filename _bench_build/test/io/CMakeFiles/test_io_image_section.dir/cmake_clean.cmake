@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_io_image_section.dir/image_section.cpp.o"
+  "CMakeFiles/test_io_image_section.dir/image_section.cpp.o.d"
+  "test_io_image_section"
+  "test_io_image_section.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_io_image_section.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_io_image_tile_reader.dir/image_tile_reader.cpp.o"
+  "CMakeFiles/test_io_image_tile_reader.dir/image_tile_reader.cpp.o.d"
+  "test_io_image_tile_reader"
+  "test_io_image_tile_reader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_io_image_tile_reader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
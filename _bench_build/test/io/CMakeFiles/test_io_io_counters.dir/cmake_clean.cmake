@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_io_io_counters.dir/io_counters.cpp.o"
+  "CMakeFiles/test_io_io_counters.dir/io_counters.cpp.o.d"
+  "test_io_io_counters"
+  "test_io_io_counters.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_io_io_counters.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
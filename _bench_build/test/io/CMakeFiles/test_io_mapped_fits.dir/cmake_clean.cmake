@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_io_mapped_fits.dir/mapped_fits.cpp.o"
+  "CMakeFiles/test_io_mapped_fits.dir/mapped_fits.cpp.o.d"
+  "test_io_mapped_fits"
+  "test_io_mapped_fits.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_io_mapped_fits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
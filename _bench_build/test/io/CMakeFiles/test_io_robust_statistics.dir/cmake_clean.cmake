@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_io_robust_statistics.dir/robust_statistics.cpp.o"
+  "CMakeFiles/test_io_robust_statistics.dir/robust_statistics.cpp.o.d"
+  "test_io_robust_statistics"
+  "test_io_robust_statistics.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_io_robust_statistics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_io_scaled_image.dir/scaled_image.cpp.o"
+  "CMakeFiles/test_io_scaled_image.dir/scaled_image.cpp.o.d"
+  "test_io_scaled_image"
+  "test_io_scaled_image.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_io_scaled_image.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_io_table_appender.dir/table_appender.cpp.o"
+  "CMakeFiles/test_io_table_appender.dir/table_appender.cpp.o.d"
+  "test_io_table_appender"
+  "test_io_table_appender.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_io_table_appender.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
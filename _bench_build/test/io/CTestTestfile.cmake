@@ -0,0 +1,54 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/io
+# Build directory: /root/repo/_bench_build/test/io
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test.astro.ascii_table "/root/repo/_bench_build/test/io/test_io_ascii_table")
+set_tests_properties(test.astro.ascii_table PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/io/CMakeLists.txt;35;add_test;/root/repo/test/io/CMakeLists.txt;0;")
+add_test(test.astro.binary_table "/root/repo/_bench_build/test/io/test_io_binary_table")
+set_tests_properties(test.astro.binary_table PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/io/CMakeLists.txt;35;add_test;/root/repo/test/io/CMakeLists.txt;0;")
+add_test(test.astro.catalog_columns "/root/repo/_bench_build/test/io/test_io_catalog_columns")
+set_tests_properties(test.astro.catalog_columns PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/io/CMakeLists.txt;35;add_test;/root/repo/test/io/CMakeLists.txt;0;")
+add_test(test.astro.checksum "/root/repo/_bench_build/test/io/test_io_checksum")
+set_tests_properties(test.astro.checksum PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/io/CMakeLists.txt;35;add_test;/root/repo/test/io/CMakeLists.txt;0;")
+add_test(test.astro.column_projection "/root/repo/_bench_build/test/io/test_io_column_projection")
+set_tests_properties(test.astro.column_projection PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/io/CMakeLists.txt;35;add_test;/root/repo/test/io/CMakeLists.txt;0;")
+add_test(test.astro.compressed_image "/root/repo/_bench_build/test/io/test_io_compressed_image")
+set_tests_properties(test.astro.compressed_image PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/io/CMakeLists.txt;35;add_test;/root/repo/test/io/CMakeLists.txt;0;")
+add_test(test.astro.data_source "/root/repo/_bench_build/test/io/test_io_data_source")
+set_tests_properties(test.astro.data_source PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/io/CMakeLists.txt;35;add_test;/root/repo/test/io/CMakeLists.txt;0;")
+add_test(test.astro.fits "/root/repo/_bench_build/test/io/test_io_fits")
+set_tests_properties(test.astro.fits PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/io/CMakeLists.txt;35;add_test;/root/repo/test/io/CMakeLists.txt;0;")
+add_test(test.astro.fits_pipeline "/root/repo/_bench_build/test/io/test_io_fits_pipeline")
+set_tests_properties(test.astro.fits_pipeline PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/io/CMakeLists.txt;35;add_test;/root/repo/test/io/CMakeLists.txt;0;")
+add_test(test.astro.fits_writer "/root/repo/_bench_build/test/io/test_io_fits_writer")
+set_tests_properties(test.astro.fits_writer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/io/CMakeLists.txt;35;add_test;/root/repo/test/io/CMakeLists.txt;0;")
+add_test(test.astro.header "/root/repo/_bench_build/test/io/test_io_header")
+set_tests_properties(test.astro.header PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/io/CMakeLists.txt;35;add_test;/root/repo/test/io/CMakeLists.txt;0;")
+add_test(test.astro.header_cache "/root/repo/_bench_build/test/io/test_io_header_cache")
+set_tests_properties(test.astro.header_cache PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/io/CMakeLists.txt;35;add_test;/root/repo/test/io/CMakeLists.txt;0;")
+add_test(test.astro.image "/root/repo/_bench_build/test/io/test_io_image")
+set_tests_properties(test.astro.image PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/io/CMakeLists.txt;35;add_test;/root/repo/test/io/CMakeLists.txt;0;")
+add_test(test.astro.image_background "/root/repo/_bench_build/test/io/test_io_image_background")
+set_tests_properties(test.astro.image_background PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/io/CMakeLists.txt;35;add_test;/root/repo/test/io/CMakeLists.txt;0;")
+add_test(test.astro.image_coadd "/root/repo/_bench_build/test/io/test_io_image_coadd")
+set_tests_properties(test.astro.image_coadd PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/io/CMakeLists.txt;35;add_test;/root/repo/test/io/CMakeLists.txt;0;")
+add_test(test.astro.image_convolution "/root/repo/_bench_build/test/io/test_io_image_convolution")
+set_tests_properties(test.astro.image_convolution PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/io/CMakeLists.txt;35;add_test;/root/repo/test/io/CMakeLists.txt;0;")
+add_test(test.astro.image_section "/root/repo/_bench_build/test/io/test_io_image_section")
+set_tests_properties(test.astro.image_section PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/io/CMakeLists.txt;35;add_test;/root/repo/test/io/CMakeLists.txt;0;")
+add_test(test.astro.image_tile_reader "/root/repo/_bench_build/test/io/test_io_image_tile_reader")
+set_tests_properties(test.astro.image_tile_reader PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/io/CMakeLists.txt;35;add_test;/root/repo/test/io/CMakeLists.txt;0;")
+add_test(test.astro.io_counters "/root/repo/_bench_build/test/io/test_io_io_counters")
+set_tests_properties(test.astro.io_counters PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/io/CMakeLists.txt;35;add_test;/root/repo/test/io/CMakeLists.txt;0;")
+add_test(test.astro.mapped_fits "/root/repo/_bench_build/test/io/test_io_mapped_fits")
+set_tests_properties(test.astro.mapped_fits PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/io/CMakeLists.txt;35;add_test;/root/repo/test/io/CMakeLists.txt;0;")
+add_test(test.astro.robust_statistics "/root/repo/_bench_build/test/io/test_io_robust_statistics")
+set_tests_properties(test.astro.robust_statistics PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/io/CMakeLists.txt;35;add_test;/root/repo/test/io/CMakeLists.txt;0;")
+add_test(test.astro.scaled_image "/root/repo/_bench_build/test/io/test_io_scaled_image")
+set_tests_properties(test.astro.scaled_image PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/io/CMakeLists.txt;35;add_test;/root/repo/test/io/CMakeLists.txt;0;")
+add_test(test.astro.table_appender "/root/repo/_bench_build/test/io/test_io_table_appender")
+set_tests_properties(test.astro.table_appender PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/io/CMakeLists.txt;35;add_test;/root/repo/test/io/CMakeLists.txt;0;")
+add_test(test.astro.visit_image "/root/repo/_bench_build/test/io/test_io_visit_image")
+set_tests_properties(test.astro.visit_image PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/io/CMakeLists.txt;35;add_test;/root/repo/test/io/CMakeLists.txt;0;")
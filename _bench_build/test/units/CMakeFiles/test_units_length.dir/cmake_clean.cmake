@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_units_length.dir/length.cpp.o"
+  "CMakeFiles/test_units_length.dir/length.cpp.o.d"
+  "test_units_length"
+  "test_units_length.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_units_length.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
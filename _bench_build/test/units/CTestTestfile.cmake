@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/units
+# Build directory: /root/repo/_bench_build/test/units
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test.astro.length "/root/repo/_bench_build/test/units/test_units_length")
+set_tests_properties(test.astro.length PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/units/CMakeLists.txt;12;add_test;/root/repo/test/units/CMakeLists.txt;0;")
@@ -0,0 +1,128 @@
+#ifndef BOOST_ASTRONOMY_BENCHMARK_BENCHMARK_HPP
+#define BOOST_ASTRONOMY_BENCHMARK_BENCHMARK_HPP
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include <cstddef>
+#include <cstdlib>
+#include <utility>
+#include <functional>
+
+//! Minimal timing harness shared by the benchmarks
+//!
+//! every case is run until it took at least the minimum time and is reported with the
+//! time per iteration and the throughput, in MB/s for cases reading bytes and in points
+//! (pixels, rows) per second for the others. Options:
+//!   --quick          runs every case once, used by ctest to check that the cases work
+//!   --filter=text    only runs the cases whose name contains text
+//!   --min-time=s     minimum time spent in every case (default 0.5 seconds)
+
+//! sink for results the compiler must not optimize away
+inline void keep(double value)
+{
+    static volatile double sink;
+    sink = value;
+    (void)sink; //the volatile read back marks the store as used
+}
+
+struct benchmark_case
+{
+    std::string name;
+    std::size_t bytes = 0; //! bytes processed by one iteration
+    std::size_t points = 0; //! points, pixels or rows processed by one iteration
+    std::function<void()> run;
+};
+
+class benchmark_suite
+{
+public:
+    //!adds a case reporting MB/s
+    void add_bytes(std::string const& name, std::size_t bytes, std::function<void()> run)
+    {
+        benchmark_case entry;
+        entry.name = name;
+        entry.bytes = bytes;
+        entry.run = std::move(run);
+        this->cases.push_back(std::move(entry));
+    }
+
+    //!adds a case reporting points/s
+    void add_points(std::string const& name, std::size_t points, std::function<void()> run)
+    {
+        benchmark_case entry;
+        entry.name = name;
+        entry.points = points;
+        entry.run = std::move(run);
+        this->cases.push_back(std::move(entry));
+    }
+
+    //!runs the cases selected by the command line and prints one line per case
+    int run(int argc, char** argv) const
+    {
+        bool quick = false;
+        double min_time = 0.5;
+        std::string filter;
+        for (int i = 1; i < argc; i++)
+        {
+            std::string const argument = argv[i];
+            if (argument == "--quick")
+            {
+                quick = true;
+            }
+            else if (argument.compare(0, 9, "--filter=") == 0)
+            {
+                filter = argument.substr(9);
+            }
+            else if (argument.compare(0, 11, "--min-time=") == 0)
+            {
+                min_time = std::atof(argument.c_str() + 11);
+            }
+            else
+            {
+                std::fprintf(stderr, "usage: %s [--quick] [--filter=text] [--min-time=seconds]\n",
+                    argv[0]);
+                return 1;
+            }
+        }
+
+        std::printf("%-48s %10s %12s %14s\n", "case", "iterations", "ms/iteration", "throughput");
+        for (auto const& entry : this->cases)
+        {
+            if (!filter.empty() && entry.name.find(filter) == std::string::npos)
+            {
+                continue;
+            }
+
+            typedef std::chrono::steady_clock clock;
+            std::size_t iterations = 0;
+            double elapsed = 0;
+            clock::time_point const start = clock::now();
+            do
+            {
+                entry.run();
+                iterations++;
+                elapsed = std::chrono::duration<double>(clock::now() - start).count();
+            } while (!quick && elapsed < min_time);
+
+            double const per_iteration = elapsed / static_cast<double>(iterations);
+            if (entry.bytes > 0)
+            {
+                std::printf("%-48s %10zu %12.3f %9.1f MB/s\n", entry.name.c_str(), iterations,
+                    per_iteration * 1e3, static_cast<double>(entry.bytes) / per_iteration / 1e6);
+            }
+            else
+            {
+                std::printf("%-48s %10zu %12.3f %9.3g pt/s\n", entry.name.c_str(), iterations,
+                    per_iteration * 1e3, static_cast<double>(entry.points) / per_iteration);
+            }
+        }
+        return 0;
+    }
+
+private:
+    std::vector<benchmark_case> cases;
+};
+
+#endif // !BOOST_ASTRONOMY_BENCHMARK_BENCHMARK_HPP
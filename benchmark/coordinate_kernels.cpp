@@ -0,0 +1,194 @@
+//! Throughput of representation conversions, frame transforms and arithmetic.hpp operations
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstddef>
+
+#include <boost/units/quantity.hpp>
+#include <boost/units/systems/si/length.hpp>
+#include <boost/units/systems/si/plane_angle.hpp>
+#include <boost/astronomy/coordinate/arithmetic.hpp>
+#include <boost/astronomy/coordinate/cartesian_representation.hpp>
+#include <boost/astronomy/coordinate/spherical_equatorial_representation.hpp>
+#include <boost/astronomy/coordinate/representation_batch.hpp>
+#include <boost/astronomy/coordinate/frame_transform.hpp>
+#include <boost/astronomy/coordinate/wcs.hpp>
+
+#include "benchmark.hpp"
+
+using namespace boost::astronomy::coordinate;
+using namespace boost::units;
+
+namespace {
+
+typedef spherical_equatorial_representation_batch<double, quantity<si::plane_angle>,
+    quantity<si::plane_angle>, quantity<si::length>> equatorial_batch;
+typedef spherical_representation_batch<double, quantity<si::plane_angle>,
+    quantity<si::plane_angle>, quantity<si::length>> spherical_batch;
+typedef cartesian_representation_batch<double, quantity<si::length>, quantity<si::length>,
+    quantity<si::length>> cartesian_batch;
+typedef cartesian_representation_batch<float, quantity<si::length, float>,
+    quantity<si::length, float>, quantity<si::length, float>> float_cartesian_batch;
+typedef cartesian_representation<double, quantity<si::length>, quantity<si::length>,
+    quantity<si::length>> cartesian_point;
+
+std::size_t const batch_points = 1 << 20;
+std::size_t const single_points = 1 << 16;
+
+//! points spread over the whole sky at distances from 1 to 8 units
+equatorial_batch sky_points(std::size_t count)
+{
+    equatorial_batch points(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        double const t = static_cast<double>(i);
+        points.data<0>()[i] = std::fmod(0.7548776662466927 * t, 1.0) * 6.283185307179586;
+        points.data<1>()[i] = std::asin(2 * std::fmod(0.5698402909980532 * t, 1.0) - 1);
+        points.data<2>()[i] = 1 + std::fmod(0.5 * t, 7.0);
+    }
+    return points;
+}
+
+//! adds the conversion from equatorial to Batch and back with every accuracy
+template <typename Batch>
+void add_conversion_cases
+(
+    benchmark_suite& suite,
+    std::string const& name,
+    equatorial_batch const& points
+)
+{
+    std::size_t const count = points.size();
+    suite.add_points("convert/equatorial to " + name, count, [&points]() {
+        Batch const converted(points);
+        keep(converted.template data<0>()[1]);
+    });
+    suite.add_points("convert/equatorial to " + name + " fast", count, [&points]() {
+        Batch const converted(points, conversion_accuracy::fast);
+        keep(converted.template data<0>()[1]);
+    });
+    suite.add_points("convert/equatorial to " + name + " threaded", count, [&points]() {
+        Batch const converted = points.to_representation<Batch>(conversion_accuracy::exact,
+            batch_execution(0));
+        keep(converted.template data<0>()[1]);
+    });
+
+    auto const converted = std::make_shared<Batch>(points);
+    suite.add_points("convert/" + name + " to equatorial", count, [converted]() {
+        equatorial_batch const back(*converted);
+        keep(back.data<0>()[1]);
+    });
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    benchmark_suite suite;
+    equatorial_batch const points = sky_points(batch_points);
+
+    add_conversion_cases<cartesian_batch>(suite, "cartesian", points);
+    add_conversion_cases<float_cartesian_batch>(suite, "float cartesian", points);
+    add_conversion_cases<spherical_batch>(suite, "spherical", points);
+
+    suite.add_points("transform_batch/icrs to galactic", batch_points, [&points]() {
+        keep(transform_batch<icrs_axes, galactic_axes>(points).data<0>()[1]);
+    });
+    suite.add_points("transform_batch/icrs to galactic threaded", batch_points, [&points]() {
+        keep(transform_batch<icrs_axes, galactic_axes>(points, conversion_accuracy::exact,
+            batch_execution(0)).data<0>()[1]);
+    });
+    cartesian_batch const cartesian(points);
+    suite.add_points("transform_batch/cartesian icrs to galactic", batch_points, [&cartesian]() {
+        keep(transform_batch<icrs_axes, galactic_axes>(cartesian).x_data()[1]);
+    });
+
+    //pixels of detections to the sky and back through a TAN projection with SIP terms
+    sip_distortion sip;
+    sip.a = sip_polynomial(3);
+    sip.b = sip_polynomial(3);
+    sip.a(2, 0) = 2e-6;
+    sip.a(1, 2) = -1e-9;
+    sip.b(0, 2) = 3e-6;
+    sip.b(3, 0) = 1e-9;
+    wcs_transform const wcs(wcs_projection::tan, 2048, 2048, 150, 30, -1e-4, 0, 0, 1e-4, sip);
+    std::vector<double> columns(batch_points), rows(batch_points);
+    for (std::size_t i = 0; i < batch_points; i++)
+    {
+        columns[i] = static_cast<double>(i % 4096);
+        rows[i] = static_cast<double>(i / 4096);
+    }
+    suite.add_points("wcs/pixel_to_sky TAN-SIP", batch_points, [&wcs, &columns, &rows]() {
+        keep(wcs.pixel_to_sky<equatorial_batch>(batch_points, columns.data(),
+            rows.data()).data<0>()[1]);
+    });
+    suite.add_points("wcs/pixel_to_sky TAN-SIP fast", batch_points, [&wcs, &columns, &rows]() {
+        keep(wcs.pixel_to_sky<equatorial_batch>(batch_points, columns.data(), rows.data(),
+            conversion_accuracy::fast).data<0>()[1]);
+    });
+    equatorial_batch const detections = wcs.pixel_to_sky<equatorial_batch>(batch_points,
+        columns.data(), rows.data());
+    suite.add_points("wcs/sky_to_pixel TAN-SIP", batch_points, [&wcs, &detections]() {
+        std::vector<double> column(batch_points), row(batch_points);
+        wcs.sky_to_pixel(detections, column.data(), row.data());
+        keep(column[1]);
+    });
+
+    //batch arithmetic read cartesian batches in place and convert the others by blocks
+    cartesian_batch const shifted(sky_points(batch_points / 2));
+    suite.add_points("batch arithmetic/dot", batch_points / 2, [&cartesian, &shifted]() {
+        keep(dot(cartesian, shifted)[1].value());
+    });
+    suite.add_points("batch arithmetic/cross", batch_points / 2, [&cartesian, &shifted]() {
+        keep(cross(cartesian, shifted).x_data()[1]);
+    });
+    suite.add_points("batch arithmetic/magnitude", batch_points, [&cartesian]() {
+        keep(magnitude(cartesian)[1].value());
+    });
+    suite.add_points("batch arithmetic/magnitude of equatorial", batch_points, [&points]() {
+        keep(magnitude(points)[1].value());
+    });
+
+    //operations of arithmetic.hpp on single representations, one call per point
+    std::vector<cartesian_point> singles;
+    for (std::size_t i = 0; i < single_points; i++)
+    {
+        singles.push_back(cartesian[i]);
+    }
+    suite.add_points("arithmetic.hpp/sum", single_points, [&singles]() {
+        double total = 0;
+        for (std::size_t i = 1; i < singles.size(); i++)
+        {
+            total += sum(singles[i - 1], singles[i]).get_x().value();
+        }
+        keep(total);
+    });
+    suite.add_points("arithmetic.hpp/dot", single_points, [&singles]() {
+        double total = 0;
+        for (std::size_t i = 1; i < singles.size(); i++)
+        {
+            total += dot(singles[i - 1], singles[i]).value();
+        }
+        keep(total);
+    });
+    suite.add_points("arithmetic.hpp/cross", single_points, [&singles]() {
+        double total = 0;
+        for (std::size_t i = 1; i < singles.size(); i++)
+        {
+            total += cross(singles[i - 1], singles[i]).get_z().value();
+        }
+        keep(total);
+    });
+    suite.add_points("arithmetic.hpp/magnitude", single_points, [&singles]() {
+        double total = 0;
+        for (auto const& point : singles)
+        {
+            total += magnitude(point).value();
+        }
+        keep(total);
+    });
+
+    return suite.run(argc, argv);
+}
@@ -0,0 +1,221 @@
+//! Throughput of reading FITS headers, images and binary table columns
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <memory>
+#include <fstream>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <algorithm>
+
+#include <boost/astronomy/io/fits.hpp>
+#include <boost/astronomy/io/hdu.hpp>
+#include <boost/astronomy/io/image.hpp>
+#include <boost/astronomy/io/image_coadd.hpp>
+#include <boost/astronomy/io/image_convolution.hpp>
+#include <boost/astronomy/io/image_background.hpp>
+#include <boost/astronomy/io/table_appender.hpp>
+#include <boost/astronomy/io/checksum.hpp>
+#include <boost/astronomy/io/header_cache.hpp>
+
+#include "benchmark.hpp"
+#include "synthetic_fits.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace {
+
+std::size_t const image_width = 1024;
+std::size_t const image_height = 1024;
+std::size_t const table_rows = 200000;
+
+//! image<DataType> decoded from a file of synthetic pixels
+template <bitpix DataType>
+void add_image_cases(benchmark_suite& suite, std::string const& name)
+{
+    typedef typename bitpix_traits<DataType>::type pixel_type;
+    std::string const header = synthetic_image_header(bitpix_traits<DataType>::value,
+        image_width, image_height, 0);
+    auto file = std::make_shared<synthetic_file>("benchmark_image_" + name + ".fits",
+        header + synthetic_pad_data(synthetic_pixels<DataType>(image_width, image_height)));
+    std::streamoff const start = static_cast<std::streamoff>(header.size());
+
+    suite.add_bytes("image<" + name + ">/load", image_width * image_height * sizeof(pixel_type),
+        [file, start]() {
+            std::fstream stream(file->path, std::ios_base::in | std::ios_base::binary);
+            image<DataType> const loaded(stream, image_width, image_height, start);
+            keep(static_cast<double>(loaded(0, 0)));
+        });
+
+    auto const loaded = std::make_shared<image<DataType>>();
+    {
+        std::fstream stream(file->path, std::ios_base::in | std::ios_base::binary);
+        loaded->read_image(stream, image_width, image_height, start);
+    }
+    suite.add_points("image<" + name + ">/statistics", image_width * image_height, [loaded]() {
+        keep(loaded->statistics(1).mean);
+    });
+    suite.add_points("image<" + name + ">/statistics threaded", image_width * image_height,
+        [loaded]() {
+            keep(loaded->statistics(0).mean);
+        });
+    suite.add_points("image<" + name + ">/median", image_width * image_height, [loaded]() {
+        keep(static_cast<double>(loaded->median()));
+    });
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    benchmark_suite suite;
+
+    //headers of 1000 keywords parsed from memory and from a file
+    std::string const header = synthetic_image_header(16, 10, 10, 1000);
+    suite.add_bytes("hdu::read_header/memory", header.size(), [&header]() {
+        hdu parsed;
+        parsed.read_header(header.data(), header.data() + header.size());
+        keep(static_cast<double>(parsed.get_cards().size()));
+    });
+    synthetic_file const header_file("benchmark_header.fits",
+        header + synthetic_pad_data(std::string(200, '\0')));
+    suite.add_bytes("hdu::read_header/file", header.size(), [&header_file]() {
+        std::fstream stream(header_file.path, std::ios_base::in | std::ios_base::binary);
+        hdu parsed;
+        parsed.read_header(stream);
+        keep(static_cast<double>(parsed.get_cards().size()));
+    });
+
+    add_image_cases<bitpix::B8>(suite, "B8");
+    add_image_cases<bitpix::B16>(suite, "B16");
+    add_image_cases<bitpix::B32>(suite, "B32");
+    add_image_cases<bitpix::_B32>(suite, "_B32");
+    add_image_cases<bitpix::_B64>(suite, "_B64");
+
+    //a frame resampled onto a slightly rotated grid of the same size with every kernel
+    std::vector<float> frame(image_width * image_height);
+    for (std::size_t i = 0; i < frame.size(); i++)
+    {
+        frame[i] = static_cast<float>(i % 977);
+    }
+    namespace bac = boost::astronomy::coordinate;
+    bac::wcs_transform const frame_wcs(bac::wcs_projection::tan, 512, 512, 150, 30, -1e-4, 0, 0,
+        1e-4);
+    bac::wcs_transform const grid_wcs(bac::wcs_projection::tan, 512, 512, 150.001, 30.001,
+        -1e-4, 1e-6, 1e-6, 1e-4);
+    for (auto const& kernel : {std::make_pair(resample_kernel::nearest, "nearest"),
+        std::make_pair(resample_kernel::bilinear, "bilinear"),
+        std::make_pair(resample_kernel::lanczos, "lanczos3")})
+    {
+        resample_options options;
+        options.kernel = kernel.first;
+        suite.add_points(std::string("image_coadd/") + kernel.second, image_width * image_height,
+            [&frame, &frame_wcs, &grid_wcs, options]() {
+                image_coadd coadd(grid_wcs, image_width, image_height, options);
+                coadd.add(frame.data(), image_width, image_height, frame_wcs);
+                keep(coadd.sums()[1]);
+            });
+    }
+
+    //PSF convolutions and the background map of the same frame
+    std::vector<double> const psf = gaussian_kernel(1.5);
+    suite.add_points("convolve_separable/gaussian9", image_width * image_height, [&frame, &psf]() {
+        keep(convolve_separable(frame.data(), image_width, image_height, psf, psf)[1]);
+    });
+    convolution_kernel const small_psf(psf, psf);
+    convolution_kernel const large_psf(gaussian_kernel(5), gaussian_kernel(5));
+    for (auto const& kernel : {std::make_pair(&small_psf, "direct9x9"),
+        std::make_pair(&large_psf, "fft31x31")})
+    {
+        suite.add_points(std::string("convolve/") + kernel.second, image_width * image_height,
+            [&frame, kernel]() {
+                keep(convolve(frame.data(), image_width, image_height, *kernel.first)[1]);
+            });
+    }
+    suite.add_points("background_map/mesh64", image_width * image_height, [&frame]() {
+        background_map const map(frame.data(), image_width, image_height);
+        keep(map.background()[1]);
+    });
+
+    //columns decoded from a binary table already read in memory
+    synthetic_file const table_file("benchmark_table.fits", synthetic_table(table_rows));
+    fits fits_file(table_file.path, fits_open_mode::directory);
+    auto const table = std::dynamic_pointer_cast<binary_table_extension>(fits_file.get_hdu(1));
+    if (!table || !table->get_column("ID"))
+    {
+        return 1;
+    }
+    suite.add_bytes("binary_table_extension::get_column/D", table_rows * 8, [&table]() {
+        keep(static_cast<double>(table->get_column("RA") != nullptr));
+    });
+    suite.add_bytes("binary_table_extension::get_column/3E", table_rows * 12, [&table]() {
+        keep(static_cast<double>(table->get_column("MAG") != nullptr));
+    });
+    suite.add_bytes("binary_table_extension::get_column_view/D", table_rows * 8, [&table]() {
+        column_view<double> const ra = table->get_column_view<double>("RA");
+        double total = 0;
+        for (std::size_t row = 0; row < ra.size(); row++)
+        {
+            total += ra[row];
+        }
+        keep(total);
+    });
+
+    //event rows of 22 bytes appended in batches of 4096 with one checkpoint at the end
+    std::vector<double> event_time(table_rows);
+    std::vector<std::int32_t> event_channel(table_rows);
+    std::vector<float> event_position(2 * table_rows);
+    std::vector<char> event_flags(2 * table_rows, 1);
+    for (std::size_t i = 0; i < table_rows; i++)
+    {
+        event_time[i] = 1e-3 * static_cast<double>(i);
+        event_channel[i] = static_cast<std::int32_t>(i % 4096);
+        event_position[2 * i] = static_cast<float>(i % 1000);
+        event_position[2 * i + 1] = static_cast<float>(i % 777);
+    }
+    synthetic_file const events_file("benchmark_events.fits", "");
+    suite.add_points("table_appender::append_rows/22B", table_rows, [&]() {
+        table_appender appender(events_file.path, {{"TIME", "1D", "s"}, {"PHA", "1J", ""},
+            {"XY", "2E", ""}, {"STATUS", "12X", ""}});
+        for (std::size_t row = 0; row < table_rows; row += 4096)
+        {
+            std::size_t const count = std::min<std::size_t>(4096, table_rows - row);
+            appender.append_rows(count, event_time.data() + row, event_channel.data() + row,
+                event_position.data() + 2 * row, event_flags.data() + 2 * row);
+        }
+        appender.close();
+        keep(static_cast<double>(appender.rows()));
+    });
+
+    //DATASUM of a 16 MiB data unit on one and on all the hardware threads
+    std::vector<char> data_unit(2880 * 5826);
+    for (std::size_t i = 0; i < data_unit.size(); i++)
+    {
+        data_unit[i] = static_cast<char>(i * 131);
+    }
+    for (std::size_t threads : {1, 0})
+    {
+        suite.add_bytes("fits_checksum/threads" + std::to_string(threads), data_unit.size(),
+            [&data_unit, threads]() {
+                keep(fits_checksum(data_unit.data(), data_unit.size(), threads));
+            });
+    }
+
+    //opening the table file by parsing its headers and from its sidecar index
+    header_cache const sidecar;
+    fits const indexed(table_file.path, sidecar);
+    suite.add_points("fits::open/parsed", fits_file.size(), [&table_file]() {
+        fits opened(table_file.path, fits_open_mode::directory);
+        keep(static_cast<double>(opened.size()));
+    });
+    suite.add_points("fits::open/header_cache", fits_file.size(), [&table_file, &sidecar]() {
+        fits opened(table_file.path, sidecar);
+        keep(static_cast<double>(opened.size()));
+    });
+
+    int const result = suite.run(argc, argv);
+    std::remove(sidecar.index_path(table_file.path).c_str());
+    return result;
+}
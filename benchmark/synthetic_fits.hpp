@@ -0,0 +1,154 @@
+#ifndef BOOST_ASTRONOMY_BENCHMARK_SYNTHETIC_FITS_HPP
+#define BOOST_ASTRONOMY_BENCHMARK_SYNTHETIC_FITS_HPP
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include <boost/astronomy/detail/endian.hpp>
+#include <boost/astronomy/io/bitpix.hpp>
+
+//! Generators of synthetic FITS files of any size used by the benchmarks
+
+//! creates 80 char card with value written from column 11
+inline std::string synthetic_card(std::string const& key, std::string const& value)
+{
+    std::string card = key;
+    card.append(8 - key.length(), ' ');
+    card += "= " + value;
+    card.append(80 - card.length(), ' ');
+    return card;
+}
+
+//! creates a header unit with END card and padding of 2880 bytes block
+inline std::string synthetic_header(std::vector<std::string> const& cards)
+{
+    std::string header;
+    for (auto const& card : cards)
+    {
+        header += card;
+    }
+    header += std::string("END").append(77, ' ');
+    header.append((2880 - header.length() % 2880) % 2880, ' ');
+    return header;
+}
+
+//! pads data unit to the multiple of 2880 bytes
+inline std::string synthetic_pad_data(std::string data)
+{
+    data.append((2880 - data.length() % 2880) % 2880, '\0');
+    return data;
+}
+
+//! primary header of an image followed by extra keyword cards, as written by pipelines
+inline std::string synthetic_image_header
+(
+    int bitpix,
+    std::size_t width,
+    std::size_t height,
+    std::size_t extra_cards
+)
+{
+    std::vector<std::string> cards = {
+        synthetic_card("SIMPLE", "T"),
+        synthetic_card("BITPIX", std::to_string(bitpix)),
+        synthetic_card("NAXIS", "2"),
+        synthetic_card("NAXIS1", std::to_string(width)),
+        synthetic_card("NAXIS2", std::to_string(height))
+    };
+    for (std::size_t i = 0; i < extra_cards; i++)
+    {
+        cards.push_back(synthetic_card("KEY" + std::to_string(i), std::to_string(static_cast<double>(i) * 0.5)));
+    }
+    return synthetic_header(cards);
+}
+
+//! big endian pixels of a width x height image with a gradient and some noise
+//! values stay between 0 and 177 so that they fit every BITPIX
+template <boost::astronomy::io::bitpix DataType>
+std::string synthetic_pixels(std::size_t width, std::size_t height)
+{
+    typedef typename boost::astronomy::io::bitpix_traits<DataType>::type pixel_type;
+    std::string bytes(width * height * sizeof(pixel_type), '\0');
+    std::uint32_t state = 12345;
+    for (std::size_t i = 0; i < width * height; i++)
+    {
+        state = state * 1664525u + 1013904223u;
+        double const value = static_cast<double>((i % width + i / width) % 100) * 0.5 +
+            static_cast<double>(state >> 25);
+        boost::astronomy::detail::store_big_endian(static_cast<pixel_type>(value),
+            &bytes[i * sizeof(pixel_type)]);
+    }
+    return bytes;
+}
+
+//! primary HDU without data followed by a binary table of rows with the columns
+//! ID (J), RA (D), DEC (D), FLUX (E) and MAG (3E), 36 bytes per row
+inline std::string synthetic_table(std::size_t rows)
+{
+    std::string content = synthetic_header({
+        synthetic_card("SIMPLE", "T"),
+        synthetic_card("BITPIX", "8"),
+        synthetic_card("NAXIS", "0"),
+        synthetic_card("EXTEND", "T")
+    });
+    content += synthetic_header({
+        synthetic_card("XTENSION", "'BINTABLE'"),
+        synthetic_card("BITPIX", "8"),
+        synthetic_card("NAXIS", "2"),
+        synthetic_card("NAXIS1", "36"),
+        synthetic_card("NAXIS2", std::to_string(rows)),
+        synthetic_card("PCOUNT", "0"),
+        synthetic_card("GCOUNT", "1"),
+        synthetic_card("TFIELDS", "5"),
+        synthetic_card("TFORM1", "'J'"),
+        synthetic_card("TTYPE1", "'ID'"),
+        synthetic_card("TFORM2", "'D'"),
+        synthetic_card("TTYPE2", "'RA'"),
+        synthetic_card("TFORM3", "'D'"),
+        synthetic_card("TTYPE3", "'DEC'"),
+        synthetic_card("TFORM4", "'E'"),
+        synthetic_card("TTYPE4", "'FLUX'"),
+        synthetic_card("TFORM5", "'3E'"),
+        synthetic_card("TTYPE5", "'MAG'"),
+        synthetic_card("EXTNAME", "'SOURCES'")
+    });
+
+    std::string data(rows * 36, '\0');
+    namespace bad = boost::astronomy::detail;
+    for (std::size_t row = 0; row < rows; row++)
+    {
+        char* bytes = &data[row * 36];
+        double const t = static_cast<double>(row);
+        bad::store_big_endian(static_cast<std::int32_t>(row), bytes);
+        bad::store_big_endian(t * 0.001, bytes + 4);
+        bad::store_big_endian(t * -0.0005, bytes + 12);
+        bad::store_big_endian(static_cast<float>(row % 1000), bytes + 20);
+        bad::store_big_endian(12.5f, bytes + 24);
+        bad::store_big_endian(13.0f, bytes + 28);
+        bad::store_big_endian(13.5f, bytes + 32);
+    }
+    return content + synthetic_pad_data(data);
+}
+
+//! writes the content into file and removes it when object is destroyed
+struct synthetic_file
+{
+    std::string path;
+
+    synthetic_file(std::string const& file_path, std::string const& content) : path(file_path)
+    {
+        std::ofstream file(path, std::ios_base::out | std::ios_base::binary);
+        file.write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+
+    ~synthetic_file()
+    {
+        std::remove(path.c_str());
+    }
+};
+
+#endif // !BOOST_ASTRONOMY_BENCHMARK_SYNTHETIC_FITS_HPP
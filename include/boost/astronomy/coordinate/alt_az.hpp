@@ -146,16 +146,7 @@ public:
         this->motion = dif_temp;
     }
 
-    alt_az(alt_az<Representation, Differential> const& other)
-    {
-        this->data = other.get_data();
-        this->motion = other.get_differential();
-        this->earth_location = other.get_location();
-        this->obs_time = other.get_obs_time();
-        this->pressure = other.get_pressure();
-        this->temperature = other.get_temprature();
-        this->relative_humidity = other.get_relative_humidity();
-    }
+    alt_az(alt_az<Representation, Differential> const& other) = default;
 
     //!returns altitude component of the coordinate
     typename Representation::quantity1 get_alt() const
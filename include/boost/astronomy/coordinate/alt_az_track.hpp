@@ -0,0 +1,312 @@
+#ifndef BOOST_ASTRONOMY_COORDINATE_ALT_AZ_TRACK_HPP
+#define BOOST_ASTRONOMY_COORDINATE_ALT_AZ_TRACK_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include <memory>
+#include <algorithm>
+
+#include <boost/static_assert.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <boost/astronomy/detail/is_base_template_of.hpp>
+#include <boost/astronomy/detail/batch_conversion.hpp>
+#include <boost/astronomy/coordinate/base_representation_batch.hpp>
+#include <boost/astronomy/coordinate/earth_orientation.hpp>
+#include <boost/astronomy/coordinate/time_transform.hpp>
+
+
+namespace boost { namespace astronomy { namespace coordinate {
+
+//!Observed alt_az directions of a fixed list of targets tracked over a time interval
+/*!
+The unrefracted horizontal unit vectors of all the targets are evaluated exactly
+at the Chebyshev nodes of segments of the interval and replaced in between by
+their Chebyshev expansion. All the targets share the segments, so the orientation
+of the earth is computed once per node and evaluating a time costs a handful of
+additions per target instead of the full transform. A segment is accepted when
+the interpolant agrees with the exact transform within tolerance (radian) at the
+points halfway between its nodes and at its ends, and the last two coefficients
+are below tolerance, otherwise it is split in two. Refraction is applied after
+the interpolation since it does not vary smoothly below the horizon.
+*/
+struct alt_az_track
+{
+protected:
+    boost::posix_time::ptime first_time; //! beginning of the tracked interval
+    double duration = 0; //! length of the interval (second)
+    std::size_t order = 0; //! number of Chebyshev coefficients per component
+    std::size_t count = 0; //! number of tracked targets
+    double accepted_error = 0; //! accepted interpolation error (radian)
+    double error = 0; //! largest error found while checking the segments (radian)
+    observing_site observer; //! site and weather of the observer
+    refraction_constants refraction; //! refraction for the weather of the site
+    std::vector<double> bounds; //! segment i covers [bounds[i], bounds[i + 1]] seconds from start
+    std::vector<double> coefficients; //! [segment][component][coefficient][target]
+    std::vector<double> distances; //! distances of the targets copied to the results
+    double ut1_minus_utc = 0; //! UT1 - UTC used for the exact transforms (second)
+
+    //unit vectors of the targets in GCRS
+    std::vector<double> gcrs_x, gcrs_y, gcrs_z;
+
+public:
+    //!tracks the ICRS directions of the batch targets from start to end
+    //!polynomial_degree is the degree of the Chebyshev expansion of every segment and
+    //!min_segment (second) the length below which segments are no longer split
+    template <typename Batch>
+    alt_az_track
+    (
+        Batch const& targets,
+        observing_site const& site,
+        boost::posix_time::ptime const& start,
+        boost::posix_time::ptime const& end,
+        double tolerance = 1e-9,
+        std::size_t polynomial_degree = 10,
+        double dut1 = 0,
+        double min_segment = 1
+    ) :
+        first_time(start),
+        order(std::max<std::size_t>(polynomial_degree, 2) + 1),
+        count(targets.size()),
+        accepted_error(tolerance),
+        observer(site),
+        refraction(refraction_constants::from_weather(site.pressure, site.temperature,
+            site.relative_humidity)),
+        ut1_minus_utc(dut1)
+    {
+        BOOST_STATIC_ASSERT_MSG((boost::astronomy::detail::is_base_frame_of
+            <boost::astronomy::coordinate::base_representation_batch, Batch>::value),
+            "argument type is expected to be a batch representation class");
+
+        this->duration = std::max(0.0,
+            static_cast<double>((end - start).total_microseconds()) * 1e-6);
+
+        std::vector<typename Batch::type> x(this->count), y(this->count), z(this->count);
+        std::vector<typename Batch::type> ones(this->count, 1);
+        boost::astronomy::detail::batch_to_cartesian(typename Batch::system(), this->count,
+            targets.template data<0>(), targets.template data<1>(), ones.data(),
+            x.data(), y.data(), z.data());
+        this->gcrs_x.assign(x.begin(), x.end());
+        this->gcrs_y.assign(y.begin(), y.end());
+        this->gcrs_z.assign(z.begin(), z.end());
+        this->distances.assign(targets.template data<2>(),
+            targets.template data<2>() + this->count);
+
+        this->bounds.push_back(0);
+        fit(0, this->duration, std::max(min_segment, 1e-3));
+    }
+
+    //!returns the number of segments of the interval
+    std::size_t segments() const
+    {
+        return this->bounds.size() - 1;
+    }
+
+    //!returns the largest error found while checking the segments (radian)
+    //!it exceeds the tolerance only for segments shorter than min_segment
+    double max_error() const
+    {
+        return this->error;
+    }
+
+    //!returns the observed directions of all the targets at time
+    /*!
+    The result has the layout of transform_batch_to_alt_az(), for a spherical_equatorial
+    batch azimuth is component 0 and altitude component 1. Times outside the tracked
+    interval are extrapolated from the first or last segment and lose the error bound.
+    */
+    template <typename Batch>
+    Batch at(boost::posix_time::ptime const& time) const
+    {
+        typedef typename Batch::type coordinate_type;
+        namespace bad = boost::astronomy::detail;
+
+        double const seconds = static_cast<double>((time - this->first_time).total_microseconds()) * 1e-6;
+        std::size_t const segment = static_cast<std::size_t>(std::max<std::ptrdiff_t>(0,
+            std::min<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(this->segments()) - 1,
+            std::upper_bound(this->bounds.begin(), this->bounds.end(), seconds) -
+            this->bounds.begin() - 1)));
+
+        std::vector<double> polynomials(this->order);
+        chebyshev_polynomials(scaled_time(segment, seconds), polynomials.data());
+
+        Batch result(this->count);
+        std::size_t const block = 256;
+        double north[block], east[block], up[block];
+        coordinate_type n[block], e[block], u[block], r[block];
+        for (std::size_t begin = 0; begin < this->count; begin += block)
+        {
+            std::size_t const length = std::min(block, this->count - begin);
+            double* components[3] = {north, east, up};
+            for (std::size_t component = 0; component < 3; component++)
+            {
+                double* values = components[component];
+                std::fill(values, values + length, 0.0);
+                for (std::size_t j = 0; j < this->order; j++)
+                {
+                    double const weight = polynomials[j];
+                    double const* c = coefficient_row(segment, component, j) + begin;
+                    for (std::size_t i = 0; i < length; i++)
+                    {
+                        values[i] += weight * c[i];
+                    }
+                }
+            }
+
+            for (std::size_t i = 0; i < length; i++)
+            {
+                double const scale = 1 / std::sqrt(north[i] * north[i] + east[i] * east[i] +
+                    up[i] * up[i]);
+                n[i] = static_cast<coordinate_type>(north[i] * scale);
+                e[i] = static_cast<coordinate_type>(east[i] * scale);
+                u[i] = static_cast<coordinate_type>(up[i] * scale);
+            }
+            detail_time_transform::batch_refract(this->refraction, length, n, e, u);
+            bad::batch_from_cartesian(typename Batch::system(), length, n, e, u,
+                result.template data<0>() + begin, result.template data<1>() + begin, r);
+            for (std::size_t i = 0; i < length; i++)
+            {
+                result.template data<2>()[begin + i] =
+                    static_cast<coordinate_type>(this->distances[begin + i]);
+            }
+        }
+        return result;
+    }
+
+protected:
+    //!writes exact unrefracted (north, east, up) vectors of all the targets at seconds from start
+    void exact(double seconds, double* north, double* east, double* up) const
+    {
+        boost::posix_time::ptime const time = this->first_time +
+            boost::posix_time::microseconds(static_cast<long long>(std::llround(seconds * 1e6)));
+        std::shared_ptr<earth_orientation const> const orientation =
+            std::make_shared<earth_orientation const>(earth_orientation::at(
+                observation_epoch::from_utc(time, this->ut1_minus_utc)));
+        observing_context const context = observing_context::at(orientation, this->observer);
+
+        std::copy(this->gcrs_x.begin(), this->gcrs_x.end(), north);
+        std::copy(this->gcrs_y.begin(), this->gcrs_y.end(), east);
+        std::copy(this->gcrs_z.begin(), this->gcrs_z.end(), up);
+        detail_time_transform::batch_aberrate(orientation->earth_velocity, this->count,
+            north, east, up);
+        boost::astronomy::detail::batch_rotate(context.gcrs_to_horizon.m, this->count,
+            north, east, up, north, east, up);
+    }
+
+    //!fits [begin, end] appending the accepted segments in order
+    void fit(double begin, double end, double min_segment)
+    {
+        std::size_t const n = this->order;
+        std::size_t const points = this->count;
+        double const pi = 3.14159265358979323846;
+
+        //exact values at the nodes x_k = cos(pi (k + 1/2) / n)
+        std::vector<double> values(3 * n * points);
+        for (std::size_t k = 0; k < n; k++)
+        {
+            double const x = std::cos(pi * (static_cast<double>(k) + 0.5) / static_cast<double>(n));
+            exact(begin + (x + 1) * 0.5 * (end - begin), &values[(0 * n + k) * points],
+                &values[(1 * n + k) * points], &values[(2 * n + k) * points]);
+        }
+
+        std::vector<double> fitted(3 * n * points, 0.0);
+        for (std::size_t component = 0; component < 3; component++)
+        {
+            for (std::size_t j = 0; j < n; j++)
+            {
+                double* c = &fitted[(component * n + j) * points];
+                for (std::size_t k = 0; k < n; k++)
+                {
+                    double const weight = (j == 0 ? 1.0 : 2.0) / static_cast<double>(n) *
+                        std::cos(pi * static_cast<double>(j) * (static_cast<double>(k) + 0.5) /
+                        static_cast<double>(n));
+                    double const* f = &values[(component * n + k) * points];
+                    for (std::size_t i = 0; i < points; i++)
+                    {
+                        c[i] += weight * f[i];
+                    }
+                }
+            }
+        }
+
+        //the tail of the expansion and the exact transform between the nodes
+        double segment_error = 0;
+        for (std::size_t component = 0; component < 3; component++)
+        {
+            for (std::size_t i = 0; i < points; i++)
+            {
+                segment_error = std::max(segment_error,
+                    std::abs(fitted[(component * n + n - 1) * points + i]) +
+                    std::abs(fitted[(component * n + n - 2) * points + i]));
+            }
+        }
+
+        std::vector<double> polynomials(n);
+        std::vector<double> north(points), east(points), up(points);
+        for (std::size_t k = 0; k <= n && segment_error <= this->accepted_error; k++)
+        {
+            //ends of the segment and points halfway between the nodes
+            double const x = k == 0 ? 1 : k == n ? -1 :
+                std::cos(pi * static_cast<double>(k) / static_cast<double>(n));
+            exact(begin + (x + 1) * 0.5 * (end - begin), north.data(), east.data(), up.data());
+            chebyshev_polynomials(x, polynomials.data());
+            for (std::size_t i = 0; i < points; i++)
+            {
+                double v[3] = {0, 0, 0};
+                for (std::size_t component = 0; component < 3; component++)
+                {
+                    for (std::size_t j = 0; j < n; j++)
+                    {
+                        v[component] += polynomials[j] * fitted[(component * n + j) * points + i];
+                    }
+                }
+                double const dx = v[0] - north[i];
+                double const dy = v[1] - east[i];
+                double const dz = v[2] - up[i];
+                segment_error = std::max(segment_error, std::sqrt(dx * dx + dy * dy + dz * dz));
+            }
+        }
+
+        if (segment_error > this->accepted_error && end - begin > min_segment)
+        {
+            double const middle = 0.5 * (begin + end);
+            fit(begin, middle, min_segment);
+            fit(middle, end, min_segment);
+            return;
+        }
+
+        this->error = std::max(this->error, segment_error);
+        this->bounds.push_back(end);
+        this->coefficients.insert(this->coefficients.end(), fitted.begin(), fitted.end());
+    }
+
+    //!position of seconds inside the segment mapped to [-1, 1]
+    double scaled_time(std::size_t segment, double seconds) const
+    {
+        double const begin = this->bounds[segment];
+        double const end = this->bounds[segment + 1];
+        return end > begin ? 2 * (seconds - begin) / (end - begin) - 1 : 0;
+    }
+
+    //!writes T_0(x) ... T_{order - 1}(x)
+    void chebyshev_polynomials(double x, double* polynomials) const
+    {
+        polynomials[0] = 1;
+        polynomials[1] = x;
+        for (std::size_t j = 2; j < this->order; j++)
+        {
+            polynomials[j] = 2 * x * polynomials[j - 1] - polynomials[j - 2];
+        }
+    }
+
+    double const* coefficient_row(std::size_t segment, std::size_t component, std::size_t j) const
+    {
+        return this->coefficients.data() +
+            ((segment * 3 + component) * this->order + j) * this->count;
+    }
+};
+
+}}} //namespace boost::astronomy::coordinate
+
+#endif // !BOOST_ASTRONOMY_COORDINATE_ALT_AZ_TRACK_HPP
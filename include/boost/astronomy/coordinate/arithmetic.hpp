@@ -11,6 +11,7 @@
 #include <boost/geometry/core/cs.hpp>
 #include <boost/units/conversion.hpp>
 
+#include <boost/astronomy/detail/unit_scale.hpp>
 #include <boost/astronomy/coordinate/base_representation.hpp>
 #include <boost/astronomy/coordinate/cartesian_representation.hpp>
 
@@ -20,6 +21,45 @@ namespace boost { namespace astronomy { namespace coordinate {
 namespace bg = boost::geometry;
 namespace bu = boost::units;
 
+///@cond INTERNAL
+namespace detail_arithmetic {
+
+// factor converting values of From unit into values of To unit, no work for the same unit
+template <typename From, typename To>
+inline double unit_factor()
+{
+    return boost::astronomy::detail::unit_scale<From, To>::value();
+}
+
+// scale times the sum of two cartesian representations in the quantities of the first one
+// the stored values are used directly, one factor per component converts the second one
+template <typename Cartesian1, typename Cartesian2, typename Point>
+inline void cartesian_sum
+(
+    Cartesian1 const& cartesian1,
+    Cartesian2 const& cartesian2,
+    double scale,
+    Point& result
+)
+{
+    typedef typename bg::coordinate_type<Point>::type coordinate_type;
+    auto const point1 = cartesian1.get_point();
+    auto const point2 = cartesian2.get_point();
+
+    bg::set<0>(result, static_cast<coordinate_type>(scale * (static_cast<double>(bg::get<0>(point1)) +
+        static_cast<double>(bg::get<0>(point2)) * unit_factor<typename Cartesian2::quantity1::unit_type,
+        typename Cartesian1::quantity1::unit_type>())));
+    bg::set<1>(result, static_cast<coordinate_type>(scale * (static_cast<double>(bg::get<1>(point1)) +
+        static_cast<double>(bg::get<1>(point2)) * unit_factor<typename Cartesian2::quantity2::unit_type,
+        typename Cartesian1::quantity2::unit_type>())));
+    bg::set<2>(result, static_cast<coordinate_type>(scale * (static_cast<double>(bg::get<2>(point1)) +
+        static_cast<double>(bg::get<2>(point2)) * unit_factor<typename Cartesian2::quantity3::unit_type,
+        typename Cartesian1::quantity3::unit_type>())));
+}
+
+} //namespace detail_arithmetic
+///@endcond
+
 
 //!Returns the cross product of representation1 and representation2
 template
@@ -72,8 +112,8 @@ auto cross
         bg::cs::cartesian
     > tempPoint1, tempPoint2, result;
 
-    bg::transform(representation1.get_point(), tempPoint1);
-    bg::transform(representation2.get_point(), tempPoint2);
+    detail_representation::to_cartesian_point(representation1.get_point(), tempPoint1);
+    detail_representation::to_cartesian_point(representation2.get_point(), tempPoint2);
 
     bg::set<0>(result, (bg::get<1>(tempPoint1)*bg::get<2>(tempPoint2)) -
         ((bg::get<2>(tempPoint1)*
@@ -167,6 +207,112 @@ auto dot(Representation1 const& representation1, Representation2 const& represen
 }
 
 
+//! Returns dot product of two cartesian vectors using the stored components directly
+template
+<
+    typename CoordinateType1,
+    typename XQuantity1,
+    typename YQuantity1,
+    typename ZQuantity1,
+    typename CoordinateType2,
+    typename XQuantity2,
+    typename YQuantity2,
+    typename ZQuantity2
+>
+auto dot
+(
+    cartesian_representation<CoordinateType1, XQuantity1, YQuantity1, ZQuantity1> const& representation1,
+    cartesian_representation<CoordinateType2, XQuantity2, YQuantity2, ZQuantity2> const& representation2
+)
+{
+    namespace bda = detail_arithmetic;
+    typedef typename std::conditional
+        <
+            sizeof(CoordinateType2) >= sizeof(CoordinateType1),
+            CoordinateType2,
+            CoordinateType1
+        >::type coordinate_type;
+
+    auto const point1 = representation1.get_point();
+    auto const point2 = representation2.get_point();
+
+    //y and z components are expressed in the unit of the x component like the generic version
+    double const y_factor = bda::unit_factor<typename YQuantity1::unit_type,
+        typename XQuantity1::unit_type>() * bda::unit_factor<typename YQuantity2::unit_type,
+        typename XQuantity2::unit_type>();
+    double const z_factor = bda::unit_factor<typename ZQuantity1::unit_type,
+        typename XQuantity1::unit_type>() * bda::unit_factor<typename ZQuantity2::unit_type,
+        typename XQuantity2::unit_type>();
+
+    coordinate_type const result = static_cast<coordinate_type>(
+        static_cast<double>(bg::get<0>(point1)) * static_cast<double>(bg::get<0>(point2)) +
+        static_cast<double>(bg::get<1>(point1)) * static_cast<double>(bg::get<1>(point2)) * y_factor +
+        static_cast<double>(bg::get<2>(point1)) * static_cast<double>(bg::get<2>(point2)) * z_factor);
+
+    return result * typename XQuantity1::unit_type() * typename XQuantity2::unit_type();
+}
+
+
+//! Returns cross product of two cartesian vectors using the stored components directly
+template
+<
+    typename CoordinateType1,
+    typename XQuantity1,
+    typename YQuantity1,
+    typename ZQuantity1,
+    typename CoordinateType2,
+    typename XQuantity2,
+    typename YQuantity2,
+    typename ZQuantity2
+>
+auto cross
+(
+    cartesian_representation<CoordinateType1, XQuantity1, YQuantity1, ZQuantity1> const& representation1,
+    cartesian_representation<CoordinateType2, XQuantity2, YQuantity2, ZQuantity2> const& representation2
+)
+{
+    namespace bda = detail_arithmetic;
+    typedef typename XQuantity1::unit_type x1_unit;
+    typedef typename YQuantity1::unit_type y1_unit;
+    typedef typename ZQuantity1::unit_type z1_unit;
+    typedef typename XQuantity2::unit_type x2_unit;
+    typedef typename YQuantity2::unit_type y2_unit;
+    typedef typename ZQuantity2::unit_type z2_unit;
+    typedef typename std::conditional
+        <
+            sizeof(CoordinateType2) >= sizeof(CoordinateType1),
+            CoordinateType2,
+            CoordinateType1
+        >::type coordinate_type;
+
+    auto const point1 = representation1.get_point();
+    auto const point2 = representation2.get_point();
+    double const x1 = static_cast<double>(bg::get<0>(point1));
+    double const y1 = static_cast<double>(bg::get<1>(point1));
+    double const z1 = static_cast<double>(bg::get<2>(point1));
+    double const x2 = static_cast<double>(bg::get<0>(point2));
+    double const y2 = static_cast<double>(bg::get<1>(point2));
+    double const z2 = static_cast<double>(bg::get<2>(point2));
+
+    //every component is expressed in the unit product of its first term
+    bg::model::point<coordinate_type, 3, bg::cs::cartesian> result;
+    bg::set<0>(result, static_cast<coordinate_type>(y1 * z2 - z1 * y2 *
+        bda::unit_factor<z1_unit, y1_unit>() * bda::unit_factor<y2_unit, z2_unit>()));
+    bg::set<1>(result, static_cast<coordinate_type>(z1 * x2 - x1 * z2 *
+        bda::unit_factor<x1_unit, z1_unit>() * bda::unit_factor<z2_unit, x2_unit>()));
+    bg::set<2>(result, static_cast<coordinate_type>(x1 * y2 - y1 * x2 *
+        bda::unit_factor<y1_unit, x1_unit>() * bda::unit_factor<x2_unit, y2_unit>()));
+
+    return cartesian_representation
+        <
+            CoordinateType1,
+            bu::quantity<typename bu::multiply_typeof_helper<y1_unit, z2_unit>::type>,
+            bu::quantity<typename bu::multiply_typeof_helper<z1_unit, x2_unit>::type>,
+            bu::quantity<typename bu::multiply_typeof_helper<x1_unit, y2_unit>::type>
+        >(result);
+}
+
+
 //! Returns magnitude of the cartesian vector
 template
 <
@@ -186,23 +332,16 @@ auto magnitude
     > const& vector
 )
 {
-    CoordinateType result = 0;
-    bg::model::point
-    <
-        CoordinateType,
-        3,
-        bg::cs::cartesian
-    > tempPoint;
-
-    bg::set<0>(tempPoint, vector.get_x().value());
-    bg::set<1>(tempPoint, static_cast<XQuantity>(vector.get_y()).value());
-    bg::set<2>(tempPoint, static_cast<XQuantity>(vector.get_z()).value());
-
-    result += std::pow(bg::get<0>(tempPoint), 2) +
-        std::pow(bg::get<1>(tempPoint), 2) +
-        std::pow(bg::get<2>(tempPoint), 2);
-
-    return std::sqrt(result) * typename XQuantity::unit_type();
+    namespace bda = detail_arithmetic;
+    auto const point = vector.get_point();
+    double const x = static_cast<double>(bg::get<0>(point));
+    double const y = static_cast<double>(bg::get<1>(point)) * bda::unit_factor
+        <typename YQuantity::unit_type, typename XQuantity::unit_type>();
+    double const z = static_cast<double>(bg::get<2>(point)) * bda::unit_factor
+        <typename ZQuantity::unit_type, typename XQuantity::unit_type>();
+    CoordinateType const result = static_cast<CoordinateType>(std::sqrt(x * x + y * y + z * z));
+
+    return result * typename XQuantity::unit_type();
 }
 
 
@@ -219,22 +358,21 @@ template <typename ...Args>
 cartesian_representation<Args...>
 unit_vector(cartesian_representation<Args...> const& vector)
 {
-    bg::model::point
-    <
-        typename cartesian_representation<Args...>::type,
-        3,
-        bg::cs::cartesian
-    > tempPoint;
-    auto mag = magnitude(vector); //magnitude of vector
+    namespace bda = detail_arithmetic;
+    typedef cartesian_representation<Args...> representation_type;
+    typedef typename representation_type::type coordinate_type;
+    typedef typename representation_type::quantity1::unit_type x_unit;
+
+    auto const point = vector.get_point();
+    double const mag = static_cast<double>(magnitude(vector).value()); //magnitude in unit of x
 
     //performing calculations to find unit vector
-    bg::set<0>(tempPoint, vector.get_x().value() / mag.value());
-    bg::set<1>(tempPoint,
-        vector.get_y().value() /
-        static_cast<typename cartesian_representation<Args...>::quantity2>(mag).value());
-    bg::set<2>(tempPoint,
-        vector.get_z().value() /
-        static_cast<typename cartesian_representation<Args...>::quantity3>(mag).value());
+    bg::model::point<coordinate_type, 3, bg::cs::cartesian> tempPoint;
+    bg::set<0>(tempPoint, static_cast<coordinate_type>(static_cast<double>(bg::get<0>(point)) / mag));
+    bg::set<1>(tempPoint, static_cast<coordinate_type>(static_cast<double>(bg::get<1>(point)) /
+        (mag * bda::unit_factor<x_unit, typename representation_type::quantity2::unit_type>())));
+    bg::set<2>(tempPoint, static_cast<coordinate_type>(static_cast<double>(bg::get<2>(point)) /
+        (mag * bda::unit_factor<x_unit, typename representation_type::quantity3::unit_type>())));
 
     return cartesian_representation<Args...>(tempPoint);
 }
@@ -294,18 +432,8 @@ Representation1 sum
         bg::cs::cartesian
     > result;
 
-    auto cartesian1 = make_cartesian_representation(representation1);
-    auto cartesian2 = make_cartesian_representation(representation2);
-
-    typedef decltype(cartesian1) cartesian1_type;
-
-    //performing calculation to find the sum
-    bg::set<0>(result, (cartesian1.get_x().value() +
-        static_cast<typename cartesian1_type::quantity1>(cartesian2.get_x()).value()));
-    bg::set<1>(result, (cartesian1.get_y().value() +
-        static_cast<typename cartesian1_type::quantity2>(cartesian2.get_y()).value()));
-    bg::set<2>(result, (cartesian1.get_z().value() +
-        static_cast<typename cartesian1_type::quantity3>(cartesian2.get_z()).value()));
+    detail_arithmetic::cartesian_sum(make_cartesian_representation(representation1),
+        make_cartesian_representation(representation2), 1.0, result);
 
     return Representation1(result);
 }
@@ -344,18 +472,8 @@ Representation1 mean
         bg::cs::cartesian
     > result;
 
-    auto cartesian1 = make_cartesian_representation(representation1);
-    auto cartesian2 = make_cartesian_representation(representation2);
-
-    typedef decltype(cartesian1) cartesian1_type;
-
-    //performing calculation to find the mean
-    bg::set<0>(result, (cartesian1.get_x().value() +
-        static_cast<typename cartesian1_type::quantity1>(cartesian2.get_x()).value())/2);
-    bg::set<1>(result, (cartesian1.get_y().value() +
-        static_cast<typename cartesian1_type::quantity2>(cartesian2.get_y()).value())/2);
-    bg::set<2>(result, (cartesian1.get_z().value() +
-        static_cast<typename cartesian1_type::quantity3>(cartesian2.get_z()).value())/2);
+    detail_arithmetic::cartesian_sum(make_cartesian_representation(representation1),
+        make_cartesian_representation(representation2), 0.5, result);
 
     return Representation1(result);
 }
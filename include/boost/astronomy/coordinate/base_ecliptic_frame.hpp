@@ -38,6 +38,12 @@ public:
     //default constructor no initialization
     base_ecliptic_frame() {}
 
+    //!constructs object from representation of the frame type, the data is copied as it is
+    base_ecliptic_frame(Representation const& representation_data)
+    {
+        this->data = representation_data;
+    }
+
     //!constructs object from another representation object
     template <typename OtherRepresentation>
     base_ecliptic_frame(OtherRepresentation const& representation_data)
@@ -85,6 +91,18 @@ public:
         this->motion.set_dlat_dlon_coslat_ddist(pm_lat, pm_lon_coslat, radial_velocity);
     }
 
+    //!constructs object from representation and differential of the frame types,
+    //!both are copied as they are without any conversion
+    base_ecliptic_frame
+    (
+        Representation const& representation_data,
+        Differential const& differential_data
+    )
+    {
+        this->data = representation_data;
+        this->motion = differential_data;
+    }
+
     //!constructs object from other representation and differential
     template <typename OtherRepresentation, typename OtherDifferential>
     base_ecliptic_frame
@@ -34,6 +34,12 @@ public:
     //default constructor no initialization
     base_equatorial_frame() {}
 
+    //!constructs object from representation of the frame type, the data is copied as it is
+    base_equatorial_frame(Representation const& representation_data)
+    {
+        this->data = representation_data;
+    }
+
     //!constructs object from another representation object
     template <typename OtherRepresentation>
     base_equatorial_frame(OtherRepresentation const& representation_data)
@@ -83,6 +89,18 @@ public:
         this->motion.set_dlat_dlon_coslat_ddist(pm_dec, pm_ra_cosdec, radial_velocity);
     }
 
+    //!constructs object from representation and differential of the frame types,
+    //!both are copied as they are without any conversion
+    base_equatorial_frame
+    (
+        Representation const& representation_data,
+        Differential const& differential_data
+    )
+    {
+        this->data = representation_data;
+        this->motion = differential_data;
+    }
+
     //!constructs object from other representation and differential
     template <typename OtherRepresentation, typename OtherDifferential>
     base_equatorial_frame
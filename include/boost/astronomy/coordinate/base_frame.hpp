@@ -13,6 +13,7 @@
 #include <boost/astronomy/coordinate/representation.hpp>
 #include <boost/astronomy/coordinate/differential.hpp>
 #include <boost/astronomy/detail/is_base_template_of.hpp>
+#include <boost/astronomy/detail/is_trivial_storage.hpp>
 #include <boost/astronomy/coordinate/arithmetic.hpp>
 
 
@@ -34,6 +35,9 @@ struct base_frame
     BOOST_STATIC_ASSERT_MSG((boost::astronomy::detail::is_base_template_of
         <boost::astronomy::coordinate::base_differential, Differential>::value),
         "Second template argument is expected to be a differential class");
+    BOOST_STATIC_ASSERT_MSG((boost::astronomy::detail::is_trivial_storage<Representation>::value &&
+        boost::astronomy::detail::is_trivial_storage<Differential>::value),
+        "representation and differential of a frame are expected to be trivially copyable");
     ///@endcond
 
 protected:
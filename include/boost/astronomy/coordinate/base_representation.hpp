@@ -18,6 +18,31 @@ namespace bg = boost::geometry;
 typedef bg::degree degree;
 typedef bg::radian radian;
 
+///@cond INTERNAL
+namespace detail_representation {
+
+// converts point into the cartesian result, cartesian points are copied without bg::transform
+template <typename Result, typename Point>
+inline void to_cartesian_point(Point const& point, Result& result)
+{
+    bg::transform(point, result);
+}
+
+template <typename Result, typename CoordinateType>
+inline void to_cartesian_point
+(
+    bg::model::point<CoordinateType, 3, bg::cs::cartesian> const& point,
+    Result& result
+)
+{
+    bg::set<0>(result, bg::get<0>(point));
+    bg::set<1>(result, bg::get<1>(point));
+    bg::set<2>(result, bg::get<2>(point));
+}
+
+} //namespace detail_representation
+///@endcond
+
 // structure which is the base for all the representation
 template
 <
@@ -88,8 +113,8 @@ public:
             3,
             bg::cs::cartesian
         > tempPoint1, tempPoint2;
-        bg::transform(this->point, tempPoint1);
-        bg::transform(other.get_point(), tempPoint2);
+        detail_representation::to_cartesian_point(this->point, tempPoint1);
+        detail_representation::to_cartesian_point(other.get_point(), tempPoint2);
 
         return (bg::get<0>(tempPoint1) == bg::get<0>(tempPoint2)) &&
             (bg::get<1>(tempPoint1) == bg::get<1>(tempPoint2)) &&
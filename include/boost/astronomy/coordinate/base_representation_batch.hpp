@@ -0,0 +1,220 @@
+#ifndef BOOST_ASTRONOMY_COORDINATE_BASE_REPRESENTATION_BATCH_HPP
+#define BOOST_ASTRONOMY_COORDINATE_BASE_REPRESENTATION_BATCH_HPP
+
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+
+#include <boost/static_assert.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/geometries/point.hpp>
+
+#include <boost/astronomy/detail/is_base_template_of.hpp>
+#include <boost/astronomy/detail/batch_conversion.hpp>
+#include <boost/astronomy/detail/batch_execution.hpp>
+#include <boost/astronomy/detail/offload_transform.hpp>
+#include <boost/astronomy/coordinate/base_representation.hpp>
+
+
+namespace boost { namespace astronomy { namespace coordinate {
+
+namespace bg = boost::geometry;
+
+//!Base of all the batch representations storing many points as structure of arrays
+/*!
+Every component of the points is kept in its own contiguous array, so the
+conversions between representations are tight loops over plain arrays.
+The components are stored exactly like the point of the matching single
+representation (angles in radian), the quantities are a property of the batch.
+*/
+template
+<
+    typename CoordinateSystem,
+    typename CoordinateType = double
+>
+struct base_representation_batch
+{
+    ///@cond INTERNAL
+    BOOST_STATIC_ASSERT_MSG((std::is_arithmetic<CoordinateType>::value),
+        "Coordinate Type must be an arithmetic type");
+    ///@endcond
+
+protected:
+    std::vector<CoordinateType> component1; //! first component of every point
+    std::vector<CoordinateType> component2; //! second component of every point
+    std::vector<CoordinateType> component3; //! third component of every point
+
+public:
+    typedef CoordinateSystem system;
+    typedef CoordinateType type;
+
+    //!returns the number of points in the batch
+    std::size_t size() const
+    {
+        return this->component1.size();
+    }
+
+    bool empty() const
+    {
+        return this->component1.empty();
+    }
+
+    //!changes the number of points, new points are initialized with 0
+    void resize(std::size_t count)
+    {
+        this->component1.resize(count);
+        this->component2.resize(count);
+        this->component3.resize(count);
+    }
+
+    void reserve(std::size_t count)
+    {
+        this->component1.reserve(count);
+        this->component2.reserve(count);
+        this->component3.reserve(count);
+    }
+
+    void clear()
+    {
+        this->component1.clear();
+        this->component2.clear();
+        this->component3.clear();
+    }
+
+    //!returns the array of given component (0, 1 or 2) of all the points
+    template <std::size_t Index>
+    CoordinateType* data()
+    {
+        BOOST_STATIC_ASSERT_MSG(Index < 3, "Index of component must be 0, 1 or 2");
+        return Index == 0 ? this->component1.data() :
+            Index == 1 ? this->component2.data() : this->component3.data();
+    }
+
+    template <std::size_t Index>
+    CoordinateType const* data() const
+    {
+        BOOST_STATIC_ASSERT_MSG(Index < 3, "Index of component must be 0, 1 or 2");
+        return Index == 0 ? this->component1.data() :
+            Index == 1 ? this->component2.data() : this->component3.data();
+    }
+
+    //!returns the point at given index as boost::geometry::model::point
+    bg::model::point<CoordinateType, 3, CoordinateSystem> get_point(std::size_t index) const
+    {
+        return bg::model::point<CoordinateType, 3, CoordinateSystem>(this->component1[index],
+            this->component2[index], this->component3[index]);
+    }
+
+    //!sets the point at given index from boost::geometry::model::point of same system
+    void set_point
+    (
+        std::size_t index,
+        bg::model::point<CoordinateType, 3, CoordinateSystem> const& point
+    )
+    {
+        this->component1[index] = bg::get<0>(point);
+        this->component2[index] = bg::get<1>(point);
+        this->component3[index] = bg::get<2>(point);
+    }
+
+    //!converts all the points into specified batch representation
+    //!like base_representation::to_representation the raw component values are converted
+    template <typename ReturnType>
+    ReturnType to_representation(conversion_accuracy accuracy = conversion_accuracy::exact) const
+    {
+        BOOST_STATIC_ASSERT_MSG((boost::astronomy::detail::is_base_frame_of
+            <boost::astronomy::coordinate::base_representation_batch, ReturnType>::value),
+            "return type is expected to be a batch representation class");
+
+        return ReturnType(*this, accuracy);
+    }
+
+    //!converts all the points into specified batch representation with the points split
+    //!across threads or run on the offload device as given by execution
+    template <typename ReturnType>
+    ReturnType to_representation
+    (
+        conversion_accuracy accuracy,
+        batch_execution const& execution
+    ) const
+    {
+        BOOST_STATIC_ASSERT_MSG((boost::astronomy::detail::is_base_frame_of
+            <boost::astronomy::coordinate::base_representation_batch, ReturnType>::value),
+            "return type is expected to be a batch representation class");
+
+        namespace bad = boost::astronomy::detail;
+        ReturnType result(this->size());
+        static double const identity[3][3] = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+        if (bad::try_offload_transform(execution.device, execution.min_offload_points,
+            CoordinateSystem(), typename ReturnType::system(), identity, accuracy, this->size(),
+            this->component1.data(), this->component2.data(), this->component3.data(),
+            result.template data<0>(), result.template data<1>(), result.template data<2>()))
+        {
+            return result;
+        }
+        bad::dispatch_accuracy(accuracy, [&](auto math) {
+            bad::parallel_ranges(this->size(), execution, [&](std::size_t begin, std::size_t length) {
+                bad::batch_convert<decltype(math)>(CoordinateSystem(), typename ReturnType::system(),
+                    length, this->component1.data() + begin, this->component2.data() + begin,
+                    this->component3.data() + begin, result.template data<0>() + begin,
+                    result.template data<1>() + begin, result.template data<2>() + begin);
+            });
+        });
+        return result;
+    }
+
+protected:
+    //!replaces the points by the points of other stored in the same coordinate system
+    template <typename OtherCoordinateType>
+    void assign_representation
+    (
+        base_representation_batch<CoordinateSystem, OtherCoordinateType> const& other,
+        conversion_accuracy = conversion_accuracy::exact
+    )
+    {
+        std::size_t const count = other.size();
+        this->component1.assign(other.template data<0>(), other.template data<0>() + count);
+        this->component2.assign(other.template data<1>(), other.template data<1>() + count);
+        this->component3.assign(other.template data<2>(), other.template data<2>() + count);
+    }
+
+    //!replaces the points by the points of other converted into this coordinate system
+    //!points are converted a block at a time through cartesian components kept in cache
+    template <typename OtherCoordinateSystem, typename OtherCoordinateType>
+    void assign_representation
+    (
+        base_representation_batch<OtherCoordinateSystem, OtherCoordinateType> const& other,
+        conversion_accuracy accuracy = conversion_accuracy::exact
+    )
+    {
+        this->resize(other.size());
+        boost::astronomy::detail::dispatch_accuracy(accuracy, [&](auto math) {
+            this->template convert_blocks<decltype(math)>(other);
+        });
+    }
+
+    //!block wise conversion using trigonometric functions of Math
+    //!blocks are converted in the wider of both coordinate types and rounded once when stored
+    template <typename Math, typename OtherCoordinateSystem, typename OtherCoordinateType>
+    void convert_blocks
+    (
+        base_representation_batch<OtherCoordinateSystem, OtherCoordinateType> const& other
+    )
+    {
+        boost::astronomy::detail::batch_convert<Math>(OtherCoordinateSystem(), CoordinateSystem(),
+            other.size(), other.template data<0>(), other.template data<1>(),
+            other.template data<2>(), this->component1.data(), this->component2.data(),
+            this->component3.data());
+    }
+}; //base_representation_batch
+
+//!true for batch representations and for the read only views laying out their points
+//!like them (batch_view, mapped_batch), algorithms which only read points accept both
+template <typename T>
+struct is_representation_batch : boost::astronomy::detail::is_base_frame_of
+    <boost::astronomy::coordinate::base_representation_batch, T> {};
+
+}}} //namespace boost::astronomy::coordinate
+
+#endif // !BOOST_ASTRONOMY_COORDINATE_BASE_REPRESENTATION_BATCH_HPP
@@ -0,0 +1,354 @@
+#ifndef BOOST_ASTRONOMY_COORDINATE_BATCH_ARITHMETIC_HPP
+#define BOOST_ASTRONOMY_COORDINATE_BATCH_ARITHMETIC_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+
+#include <boost/static_assert.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/units/quantity.hpp>
+
+#include <boost/astronomy/detail/is_base_template_of.hpp>
+#include <boost/astronomy/detail/precision.hpp>
+#include <boost/astronomy/detail/batch_conversion.hpp>
+#include <boost/astronomy/coordinate/base_representation_batch.hpp>
+#include <boost/astronomy/coordinate/cartesian_representation_batch.hpp>
+
+
+namespace boost { namespace astronomy { namespace coordinate {
+
+namespace bu = boost::units;
+namespace bg = boost::geometry;
+
+///@cond INTERNAL
+namespace detail_batch_arithmetic {
+
+template <typename Batch>
+struct is_batch : std::integral_constant<bool, is_representation_batch<Batch>::value> {};
+
+template <typename Batch>
+struct is_cartesian : std::is_same<typename Batch::system, bg::cs::cartesian> {};
+
+// quantity of the cartesian components of a batch, x of cartesian batches and distance otherwise
+template <typename Batch, bool Cartesian = is_cartesian<Batch>::value>
+struct length_quantity
+{
+    typedef typename Batch::quantity3 type;
+};
+
+template <typename Batch>
+struct length_quantity<Batch, true>
+{
+    typedef typename Batch::quantity1 type;
+};
+
+std::size_t const block_size = 256;
+
+// cartesian components of a block of points in the unit of length_quantity
+// non cartesian batches are converted into the buffers
+template <typename Batch, bool Cartesian = is_cartesian<Batch>::value>
+struct cartesian_block
+{
+    typedef typename Batch::type type;
+    type buffer_x[block_size], buffer_y[block_size], buffer_z[block_size];
+    type const* x = buffer_x;
+    type const* y = buffer_y;
+    type const* z = buffer_z;
+
+    void load(Batch const& points, std::size_t begin, std::size_t count)
+    {
+        boost::astronomy::detail::batch_to_cartesian(typename Batch::system(), count,
+            points.template data<0>() + begin, points.template data<1>() + begin,
+            points.template data<2>() + begin, buffer_x, buffer_y, buffer_z);
+    }
+};
+
+// components of cartesian batches are used in place, y and z are only scaled
+// when their quantity differs from the quantity of x
+template <typename Batch>
+struct cartesian_block<Batch, true>
+{
+    typedef typename Batch::type type;
+    type buffer_y[block_size], buffer_z[block_size];
+    type const* x = nullptr;
+    type const* y = nullptr;
+    type const* z = nullptr;
+
+    void load(Batch const& points, std::size_t begin, std::size_t count)
+    {
+        namespace bad = boost::astronomy::detail;
+        typedef typename Batch::quantity1 x_quantity;
+        typedef typename Batch::quantity2 y_quantity;
+        typedef typename Batch::quantity3 z_quantity;
+
+        this->x = points.x_data() + begin;
+        this->y = points.y_data() + begin;
+        this->z = points.z_data() + begin;
+        if (!std::is_same<x_quantity, y_quantity>::value)
+        {
+            bad::batch_scale(count, this->y, static_cast<type>
+                (bad::quantity_factor<x_quantity, y_quantity>()), buffer_y);
+            this->y = buffer_y;
+        }
+        if (!std::is_same<x_quantity, z_quantity>::value)
+        {
+            bad::batch_scale(count, this->z, static_cast<type>
+                (bad::quantity_factor<x_quantity, z_quantity>()), buffer_z);
+            this->z = buffer_z;
+        }
+    }
+};
+
+template <typename Batch1, typename Batch2>
+struct common_type
+{
+    typedef typename std::conditional
+        <
+            sizeof(typename Batch2::type) >= sizeof(typename Batch1::type),
+            typename Batch2::type,
+            typename Batch1::type
+        >::type type;
+};
+
+template <typename Batch1, typename Batch2>
+struct dot_quantity
+{
+    typedef bu::quantity
+        <
+            typename bu::multiply_typeof_helper
+            <
+                typename length_quantity<Batch1>::type::unit_type,
+                typename length_quantity<Batch2>::type::unit_type
+            >::type,
+            typename common_type<Batch1, Batch2>::type
+        > type;
+};
+
+} //namespace detail_batch_arithmetic
+///@endcond
+
+
+//!Returns the dot products of corresponding points of two batches of the same size
+//!cartesian batches are read in place, other batches are converted a block at a time
+template
+<
+    template<typename ...> class Batch1,
+    template<typename ...> class Batch2,
+    typename ...Args1,
+    typename ...Args2
+>
+typename std::enable_if
+<
+    detail_batch_arithmetic::is_batch<Batch1<Args1...>>::value &&
+        detail_batch_arithmetic::is_batch<Batch2<Args2...>>::value,
+    std::vector<typename detail_batch_arithmetic::dot_quantity
+        <Batch1<Args1...>, Batch2<Args2...>>::type>
+>::type dot(Batch1<Args1...> const& points1, Batch2<Args2...> const& points2)
+{
+    namespace dba = detail_batch_arithmetic;
+    typedef typename dba::dot_quantity<Batch1<Args1...>, Batch2<Args2...>>::type quantity_type;
+    typedef typename quantity_type::value_type value_type;
+    //sums of products cancel for nearly orthogonal points so they are always accumulated wide
+    typedef typename boost::astronomy::detail::precision_traits<value_type>::accumulate_type wide;
+
+    std::size_t const count = std::min(points1.size(), points2.size());
+    std::vector<quantity_type> result(count);
+    dba::cartesian_block<Batch1<Args1...>> block1;
+    dba::cartesian_block<Batch2<Args2...>> block2;
+    value_type values[dba::block_size];
+
+    for (std::size_t begin = 0; begin < count; begin += dba::block_size)
+    {
+        std::size_t const length = std::min(dba::block_size, count - begin);
+        block1.load(points1, begin, length);
+        block2.load(points2, begin, length);
+        for (std::size_t i = 0; i < length; i++)
+        {
+            values[i] = static_cast<value_type>(
+                static_cast<wide>(block1.x[i]) * static_cast<wide>(block2.x[i]) +
+                static_cast<wide>(block1.y[i]) * static_cast<wide>(block2.y[i]) +
+                static_cast<wide>(block1.z[i]) * static_cast<wide>(block2.z[i]));
+        }
+        for (std::size_t i = 0; i < length; i++)
+        {
+            result[begin + i] = quantity_type::from_value(values[i]);
+        }
+    }
+    return result;
+}
+
+
+//!Returns the magnitudes of all the points of a batch
+//!distances of non cartesian batches are copied without any conversion
+template <template<typename ...> class Batch, typename ...Args>
+typename std::enable_if
+<
+    detail_batch_arithmetic::is_batch<Batch<Args...>>::value,
+    std::vector<typename detail_batch_arithmetic::length_quantity<Batch<Args...>>::type>
+>::type magnitude(Batch<Args...> const& points)
+{
+    namespace dba = detail_batch_arithmetic;
+    typedef Batch<Args...> batch_type;
+    typedef typename dba::length_quantity<batch_type>::type quantity_type;
+    typedef typename batch_type::type coordinate_type;
+    typedef typename boost::astronomy::detail::precision_traits<coordinate_type>::compute_type real;
+
+    std::vector<quantity_type> result(points.size());
+    if (!dba::is_cartesian<batch_type>::value)
+    {
+        for (std::size_t i = 0; i < points.size(); i++)
+        {
+            result[i] = quantity_type::from_value(points.template data<2>()[i]);
+        }
+        return result;
+    }
+
+    dba::cartesian_block<batch_type> block;
+    coordinate_type values[dba::block_size];
+    for (std::size_t begin = 0; begin < points.size(); begin += dba::block_size)
+    {
+        std::size_t const length = std::min(dba::block_size, points.size() - begin);
+        block.load(points, begin, length);
+        for (std::size_t i = 0; i < length; i++)
+        {
+            real const x = static_cast<real>(block.x[i]);
+            real const y = static_cast<real>(block.y[i]);
+            real const z = static_cast<real>(block.z[i]);
+            values[i] = static_cast<coordinate_type>(std::sqrt(x * x + y * y + z * z));
+        }
+        for (std::size_t i = 0; i < length; i++)
+        {
+            result[begin + i] = quantity_type::from_value(values[i]);
+        }
+    }
+    return result;
+}
+
+
+//!Returns the unit vectors of all the points of a batch, the quantities are kept
+//!non cartesian batches only get their distances set to 1
+template <template<typename ...> class Batch, typename ...Args>
+typename std::enable_if
+<
+    detail_batch_arithmetic::is_batch<Batch<Args...>>::value,
+    Batch<Args...>
+>::type unit_vector(Batch<Args...> const& points)
+{
+    namespace dba = detail_batch_arithmetic;
+    typedef Batch<Args...> batch_type;
+    typedef typename batch_type::type coordinate_type;
+    typedef typename boost::astronomy::detail::precision_traits<coordinate_type>::compute_type real;
+
+    batch_type result(points);
+    if (!dba::is_cartesian<batch_type>::value)
+    {
+        std::fill(result.template data<2>(), result.template data<2>() + result.size(),
+            coordinate_type(1));
+        return result;
+    }
+
+    //like unit_vector() of single representations every component stores the ratio
+    //of the component to the magnitude
+    dba::cartesian_block<batch_type> block;
+    for (std::size_t begin = 0; begin < points.size(); begin += dba::block_size)
+    {
+        std::size_t const length = std::min(dba::block_size, points.size() - begin);
+        block.load(points, begin, length);
+        coordinate_type* x = result.template data<0>() + begin;
+        coordinate_type* y = result.template data<1>() + begin;
+        coordinate_type* z = result.template data<2>() + begin;
+        for (std::size_t i = 0; i < length; i++)
+        {
+            real const bx = static_cast<real>(block.x[i]);
+            real const by = static_cast<real>(block.y[i]);
+            real const bz = static_cast<real>(block.z[i]);
+            real const inverse = 1 / std::sqrt(bx * bx + by * by + bz * bz);
+            x[i] = static_cast<coordinate_type>(bx * inverse);
+            y[i] = static_cast<coordinate_type>(by * inverse);
+            z[i] = static_cast<coordinate_type>(bz * inverse);
+        }
+    }
+    return result;
+}
+
+
+//!Returns the cross products of corresponding points of two cartesian batches of the same size
+//!the quantities of the result are the same as for cross() of single representations
+template
+<
+    typename CoordinateType1,
+    typename XQuantity1,
+    typename YQuantity1,
+    typename ZQuantity1,
+    typename CoordinateType2,
+    typename XQuantity2,
+    typename YQuantity2,
+    typename ZQuantity2
+>
+cartesian_representation_batch
+<
+    CoordinateType1,
+    bu::quantity<typename bu::multiply_typeof_helper
+        <typename YQuantity1::unit_type, typename ZQuantity2::unit_type>::type, CoordinateType1>,
+    bu::quantity<typename bu::multiply_typeof_helper
+        <typename ZQuantity1::unit_type, typename XQuantity2::unit_type>::type, CoordinateType1>,
+    bu::quantity<typename bu::multiply_typeof_helper
+        <typename XQuantity1::unit_type, typename YQuantity2::unit_type>::type, CoordinateType1>
+>
+cross
+(
+    cartesian_representation_batch<CoordinateType1, XQuantity1, YQuantity1, ZQuantity1> const& points1,
+    cartesian_representation_batch<CoordinateType2, XQuantity2, YQuantity2, ZQuantity2> const& points2
+)
+{
+    namespace bad = boost::astronomy::detail;
+    std::size_t const count = std::min(points1.size(), points2.size());
+    cartesian_representation_batch
+    <
+        CoordinateType1,
+        bu::quantity<typename bu::multiply_typeof_helper
+            <typename YQuantity1::unit_type, typename ZQuantity2::unit_type>::type, CoordinateType1>,
+        bu::quantity<typename bu::multiply_typeof_helper
+            <typename ZQuantity1::unit_type, typename XQuantity2::unit_type>::type, CoordinateType1>,
+        bu::quantity<typename bu::multiply_typeof_helper
+            <typename XQuantity1::unit_type, typename YQuantity2::unit_type>::type, CoordinateType1>
+    > result(count);
+
+    //differences of products cancel for nearly parallel points so they are always computed wide
+    typedef typename bad::precision_traits<CoordinateType1>::accumulate_type wide;
+
+    //the second term of every component is converted into the unit of the first term
+    wide const x_factor = static_cast<wide>(bad::quantity_scale<YQuantity1, ZQuantity1>::value() *
+        bad::quantity_scale<ZQuantity2, YQuantity2>::value());
+    wide const y_factor = static_cast<wide>(bad::quantity_scale<ZQuantity1, XQuantity1>::value() *
+        bad::quantity_scale<XQuantity2, ZQuantity2>::value());
+    wide const z_factor = static_cast<wide>(bad::quantity_scale<XQuantity1, YQuantity1>::value() *
+        bad::quantity_scale<YQuantity2, XQuantity2>::value());
+
+    CoordinateType1 const* x1 = points1.x_data();
+    CoordinateType1 const* y1 = points1.y_data();
+    CoordinateType1 const* z1 = points1.z_data();
+    CoordinateType2 const* x2 = points2.x_data();
+    CoordinateType2 const* y2 = points2.y_data();
+    CoordinateType2 const* z2 = points2.z_data();
+    CoordinateType1* x = result.x_data();
+    CoordinateType1* y = result.y_data();
+    CoordinateType1* z = result.z_data();
+    for (std::size_t i = 0; i < count; i++)
+    {
+        x[i] = static_cast<CoordinateType1>(static_cast<wide>(y1[i]) * static_cast<wide>(z2[i]) -
+            static_cast<wide>(z1[i]) * static_cast<wide>(y2[i]) * x_factor);
+        y[i] = static_cast<CoordinateType1>(static_cast<wide>(z1[i]) * static_cast<wide>(x2[i]) -
+            static_cast<wide>(x1[i]) * static_cast<wide>(z2[i]) * y_factor);
+        z[i] = static_cast<CoordinateType1>(static_cast<wide>(x1[i]) * static_cast<wide>(y2[i]) -
+            static_cast<wide>(y1[i]) * static_cast<wide>(x2[i]) * z_factor);
+    }
+    return result;
+}
+
+}}} //namespace boost::astronomy::coordinate
+
+#endif // !BOOST_ASTRONOMY_COORDINATE_BATCH_ARITHMETIC_HPP
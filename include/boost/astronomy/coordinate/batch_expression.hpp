@@ -0,0 +1,447 @@
+#ifndef BOOST_ASTRONOMY_COORDINATE_BATCH_EXPRESSION_HPP
+#define BOOST_ASTRONOMY_COORDINATE_BATCH_EXPRESSION_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+
+#include <boost/static_assert.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/get_dimension.hpp>
+
+#include <boost/astronomy/detail/unit_scale.hpp>
+#include <boost/astronomy/detail/precision.hpp>
+#include <boost/astronomy/coordinate/base_representation_batch.hpp>
+#include <boost/astronomy/coordinate/cartesian_representation_batch.hpp>
+#include <boost/astronomy/coordinate/batch_arithmetic.hpp>
+
+
+namespace boost { namespace astronomy { namespace coordinate {
+
+namespace bu = boost::units;
+
+//!Expressions of batches built by +, - and scalar * or / are evaluated lazily
+/*!
+An expression like a + b * dt - c only stores references to the batches and the
+scalars, no point is computed until it is given to evaluate() or assign(). These
+compute the whole expression with a single loop over the points, a block at a time,
+without any temporary batch. Every operand is read as cartesian components in the
+unit of its x component (or distance): cartesian batches in place and other batches
+converted a block at a time. The unit of an expression is the unit of its first
+operand; the factors between units are computed once for the whole expression, the
+same units need no factor at all. Batches of velocities scaled by a time give
+lengths, so differentials are held by cartesian batches of velocity quantities.
+The batches have to outlive the expression; its size is the size of the smallest
+batch.
+*/
+template <typename Derived>
+struct batch_expression
+{
+    Derived const& derived() const
+    {
+        return static_cast<Derived const&>(*this);
+    }
+};
+
+//!A batch read as an operand of an expression
+template <typename Batch>
+struct batch_term : batch_expression<batch_term<Batch>>
+{
+    typedef typename Batch::type type;
+    typedef typename detail_batch_arithmetic::length_quantity<Batch>::type::unit_type unit_type;
+
+    Batch const& points;
+
+    explicit batch_term(Batch const& batch) : points(batch) {}
+
+    std::size_t size() const
+    {
+        return this->points.size();
+    }
+
+    ///@cond INTERNAL
+    // cartesian components of a block of points
+    struct block_type
+    {
+        detail_batch_arithmetic::cartesian_block<Batch> block;
+
+        void load(batch_term const& term, std::size_t begin, std::size_t count)
+        {
+            this->block.load(term.points, begin, count);
+        }
+
+        type x(batch_term const&, std::size_t i) const { return this->block.x[i]; }
+        type y(batch_term const&, std::size_t i) const { return this->block.y[i]; }
+        type z(batch_term const&, std::size_t i) const { return this->block.z[i]; }
+    };
+    ///@endcond
+};
+
+///@cond INTERNAL
+namespace detail_batch_expression {
+
+template <typename T>
+struct is_quantity : std::false_type {};
+
+template <typename Unit, typename T>
+struct is_quantity<bu::quantity<Unit, T>> : std::true_type {};
+
+template <typename T>
+struct is_scalar : std::integral_constant<bool,
+    std::is_arithmetic<T>::value || is_quantity<T>::value> {};
+
+// operands of expressions are batches and expressions
+template <typename T, bool Batch = is_representation_batch<T>::value>
+struct operand
+{
+    static constexpr bool value = std::is_base_of<batch_expression<T>, T>::value;
+    typedef T type;
+
+    static T const& make(T const& expression)
+    {
+        return expression;
+    }
+};
+
+template <typename T>
+struct operand<T, true>
+{
+    static constexpr bool value = true;
+    typedef batch_term<T> type;
+
+    static type make(T const& batch)
+    {
+        return type(batch);
+    }
+};
+
+// factor converting values of From into values of To applied only for different units
+template <typename From, typename To, typename T>
+struct to_unit
+{
+    typedef boost::astronomy::detail::unit_scale<From, To> scale;
+
+    T factor = static_cast<T>(scale::value());
+
+    T apply(T value) const
+    {
+        return scale::identity ? value : value * this->factor;
+    }
+};
+
+// unit and value of scalar multiplying an expression of unit Unit
+template <typename Unit, typename Scalar, bool Quantity = is_quantity<Scalar>::value>
+struct scaled_unit
+{
+    typedef Unit type;
+    typedef Unit inverse;
+
+    static double value(Scalar const& scalar)
+    {
+        return static_cast<double>(scalar);
+    }
+};
+
+template <typename Unit, typename Scalar>
+struct scaled_unit<Unit, Scalar, true>
+{
+    typedef typename bu::multiply_typeof_helper<Unit, typename Scalar::unit_type>::type type;
+    typedef typename bu::divide_typeof_helper<Unit, typename Scalar::unit_type>::type inverse;
+
+    static double value(Scalar const& scalar)
+    {
+        return static_cast<double>(scalar.value());
+    }
+};
+
+template <typename T1, typename T2>
+struct wider
+{
+    typedef typename std::conditional<sizeof(T2) >= sizeof(T1), T2, T1>::type type;
+};
+
+} //namespace detail_batch_expression
+///@endcond
+
+//!Sum (Sign = 1) or difference (Sign = -1) of two expressions in the unit of the first one
+template <typename Left, typename Right, int Sign>
+struct batch_sum : batch_expression<batch_sum<Left, Right, Sign>>
+{
+    ///@cond INTERNAL
+    BOOST_STATIC_ASSERT_MSG((std::is_same<typename bu::get_dimension<typename Left::unit_type>::type,
+        typename bu::get_dimension<typename Right::unit_type>::type>::value),
+        "only expressions of the same dimensions can be added");
+    ///@endcond
+
+    typedef typename detail_batch_expression::wider<typename Left::type,
+        typename Right::type>::type type;
+    typedef typename Left::unit_type unit_type;
+
+    Left left;
+    Right right;
+    detail_batch_expression::to_unit<typename Right::unit_type, unit_type, type> right_factor;
+
+    batch_sum(Left const& lhs, Right const& rhs) : left(lhs), right(rhs) {}
+
+    std::size_t size() const
+    {
+        return std::min(this->left.size(), this->right.size());
+    }
+
+    ///@cond INTERNAL
+    struct block_type
+    {
+        typename Left::block_type left;
+        typename Right::block_type right;
+
+        void load(batch_sum const& sum, std::size_t begin, std::size_t count)
+        {
+            this->left.load(sum.left, begin, count);
+            this->right.load(sum.right, begin, count);
+        }
+
+        type x(batch_sum const& sum, std::size_t i) const
+        {
+            return static_cast<type>(this->left.x(sum.left, i)) + Sign *
+                sum.right_factor.apply(static_cast<type>(this->right.x(sum.right, i)));
+        }
+
+        type y(batch_sum const& sum, std::size_t i) const
+        {
+            return static_cast<type>(this->left.y(sum.left, i)) + Sign *
+                sum.right_factor.apply(static_cast<type>(this->right.y(sum.right, i)));
+        }
+
+        type z(batch_sum const& sum, std::size_t i) const
+        {
+            return static_cast<type>(this->left.z(sum.left, i)) + Sign *
+                sum.right_factor.apply(static_cast<type>(this->right.z(sum.right, i)));
+        }
+    };
+    ///@endcond
+};
+
+//!Expression multiplied by a number or a quantity, the units are multiplied as well
+template <typename Expression, typename Unit>
+struct batch_scaled : batch_expression<batch_scaled<Expression, Unit>>
+{
+    typedef typename Expression::type type;
+    typedef Unit unit_type;
+
+    Expression expression;
+    type factor;
+
+    batch_scaled(Expression const& operand, double scale) :
+        expression(operand), factor(static_cast<type>(scale)) {}
+
+    std::size_t size() const
+    {
+        return this->expression.size();
+    }
+
+    ///@cond INTERNAL
+    struct block_type
+    {
+        typename Expression::block_type block;
+
+        void load(batch_scaled const& scaled, std::size_t begin, std::size_t count)
+        {
+            this->block.load(scaled.expression, begin, count);
+        }
+
+        type x(batch_scaled const& scaled, std::size_t i) const
+        {
+            return scaled.factor * this->block.x(scaled.expression, i);
+        }
+
+        type y(batch_scaled const& scaled, std::size_t i) const
+        {
+            return scaled.factor * this->block.y(scaled.expression, i);
+        }
+
+        type z(batch_scaled const& scaled, std::size_t i) const
+        {
+            return scaled.factor * this->block.z(scaled.expression, i);
+        }
+    };
+    ///@endcond
+};
+
+
+//!Returns the lazy sum of two batches or expressions
+template
+<
+    typename Left,
+    typename Right,
+    typename = typename std::enable_if<detail_batch_expression::operand<Left>::value &&
+        detail_batch_expression::operand<Right>::value>::type
+>
+batch_sum
+<
+    typename detail_batch_expression::operand<Left>::type,
+    typename detail_batch_expression::operand<Right>::type,
+    1
+>
+operator+(Left const& lhs, Right const& rhs)
+{
+    namespace dbe = detail_batch_expression;
+    return batch_sum<typename dbe::operand<Left>::type, typename dbe::operand<Right>::type, 1>(
+        dbe::operand<Left>::make(lhs), dbe::operand<Right>::make(rhs));
+}
+
+//!Returns the lazy difference of two batches or expressions
+template
+<
+    typename Left,
+    typename Right,
+    typename = typename std::enable_if<detail_batch_expression::operand<Left>::value &&
+        detail_batch_expression::operand<Right>::value>::type
+>
+batch_sum
+<
+    typename detail_batch_expression::operand<Left>::type,
+    typename detail_batch_expression::operand<Right>::type,
+    -1
+>
+operator-(Left const& lhs, Right const& rhs)
+{
+    namespace dbe = detail_batch_expression;
+    return batch_sum<typename dbe::operand<Left>::type, typename dbe::operand<Right>::type, -1>(
+        dbe::operand<Left>::make(lhs), dbe::operand<Right>::make(rhs));
+}
+
+//!Returns the lazy product of a batch or expression and a number or a quantity
+template
+<
+    typename Operand,
+    typename Scalar,
+    typename = typename std::enable_if<detail_batch_expression::operand<Operand>::value &&
+        detail_batch_expression::is_scalar<Scalar>::value>::type
+>
+batch_scaled
+<
+    typename detail_batch_expression::operand<Operand>::type,
+    typename detail_batch_expression::scaled_unit
+        <typename detail_batch_expression::operand<Operand>::type::unit_type, Scalar>::type
+>
+operator*(Operand const& operand, Scalar const& scalar)
+{
+    namespace dbe = detail_batch_expression;
+    typedef typename dbe::operand<Operand>::type expression_type;
+    typedef dbe::scaled_unit<typename expression_type::unit_type, Scalar> scaled;
+    return batch_scaled<expression_type, typename scaled::type>(dbe::operand<Operand>::make(operand),
+        scaled::value(scalar));
+}
+
+template
+<
+    typename Scalar,
+    typename Operand,
+    typename = typename std::enable_if<detail_batch_expression::operand<Operand>::value &&
+        detail_batch_expression::is_scalar<Scalar>::value>::type
+>
+batch_scaled
+<
+    typename detail_batch_expression::operand<Operand>::type,
+    typename detail_batch_expression::scaled_unit
+        <typename detail_batch_expression::operand<Operand>::type::unit_type, Scalar>::type
+>
+operator*(Scalar const& scalar, Operand const& operand)
+{
+    return operand * scalar;
+}
+
+//!Returns the lazy quotient of a batch or expression by a number or a quantity
+template
+<
+    typename Operand,
+    typename Scalar,
+    typename = typename std::enable_if<detail_batch_expression::operand<Operand>::value &&
+        detail_batch_expression::is_scalar<Scalar>::value>::type
+>
+batch_scaled
+<
+    typename detail_batch_expression::operand<Operand>::type,
+    typename detail_batch_expression::scaled_unit
+        <typename detail_batch_expression::operand<Operand>::type::unit_type, Scalar>::inverse
+>
+operator/(Operand const& operand, Scalar const& scalar)
+{
+    namespace dbe = detail_batch_expression;
+    typedef typename dbe::operand<Operand>::type expression_type;
+    typedef dbe::scaled_unit<typename expression_type::unit_type, Scalar> scaled;
+    return batch_scaled<expression_type, typename scaled::inverse>(
+        dbe::operand<Operand>::make(operand), 1 / scaled::value(scalar));
+}
+
+
+//!Computes expression into points converting it into the quantities of points
+//!points is resized to the size of the expression and may not be an operand of it
+template
+<
+    typename CoordinateType,
+    typename XQuantity,
+    typename YQuantity,
+    typename ZQuantity,
+    typename Expression
+>
+void assign
+(
+    cartesian_representation_batch<CoordinateType, XQuantity, YQuantity, ZQuantity>& points,
+    batch_expression<Expression> const& expression
+)
+{
+    namespace dbe = detail_batch_expression;
+    namespace dba = detail_batch_arithmetic;
+    typedef typename Expression::type type;
+    typedef typename Expression::unit_type unit_type;
+    BOOST_STATIC_ASSERT_MSG((std::is_same<typename bu::get_dimension<unit_type>::type,
+        typename bu::get_dimension<XQuantity>::type>::value),
+        "expression and points must have the same dimensions");
+
+    Expression const& tree = expression.derived();
+    dbe::to_unit<unit_type, typename XQuantity::unit_type, type> const x_factor;
+    dbe::to_unit<unit_type, typename YQuantity::unit_type, type> const y_factor;
+    dbe::to_unit<unit_type, typename ZQuantity::unit_type, type> const z_factor;
+
+    std::size_t const count = tree.size();
+    points.resize(count);
+    CoordinateType* x = points.x_data();
+    CoordinateType* y = points.y_data();
+    CoordinateType* z = points.z_data();
+
+    typename Expression::block_type block;
+    for (std::size_t begin = 0; begin < count; begin += dba::block_size)
+    {
+        std::size_t const length = std::min(dba::block_size, count - begin);
+        block.load(tree, begin, length);
+        for (std::size_t i = 0; i < length; i++)
+        {
+            x[begin + i] = static_cast<CoordinateType>(x_factor.apply(block.x(tree, i)));
+            y[begin + i] = static_cast<CoordinateType>(y_factor.apply(block.y(tree, i)));
+            z[begin + i] = static_cast<CoordinateType>(z_factor.apply(block.z(tree, i)));
+        }
+    }
+}
+
+//!Returns the cartesian batch computed from expression in the unit of the expression
+template <typename Expression>
+cartesian_representation_batch
+<
+    typename Expression::type,
+    bu::quantity<typename Expression::unit_type, typename Expression::type>,
+    bu::quantity<typename Expression::unit_type, typename Expression::type>,
+    bu::quantity<typename Expression::unit_type, typename Expression::type>
+>
+evaluate(batch_expression<Expression> const& expression)
+{
+    typedef bu::quantity<typename Expression::unit_type, typename Expression::type> quantity_type;
+    cartesian_representation_batch<typename Expression::type, quantity_type, quantity_type,
+        quantity_type> result;
+    assign(result, expression);
+    return result;
+}
+
+}}} //namespace boost::astronomy::coordinate
+
+#endif // !BOOST_ASTRONOMY_COORDINATE_BATCH_EXPRESSION_HPP
@@ -0,0 +1,670 @@
+#ifndef BOOST_ASTRONOMY_COORDINATE_BATCH_FILE_HPP
+#define BOOST_ASTRONOMY_COORDINATE_BATCH_FILE_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <algorithm>
+#include <type_traits>
+
+#include <boost/static_assert.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/units/unit.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/get_dimension.hpp>
+#include <boost/units/systems/si.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <boost/astronomy/detail/unit_scale.hpp>
+#include <boost/astronomy/detail/batch_conversion.hpp>
+#include <boost/astronomy/coordinate/base_representation_batch.hpp>
+#include <boost/astronomy/coordinate/epoch_propagation.hpp>
+#include <boost/astronomy/coordinate/frame.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+
+namespace boost { namespace astronomy { namespace coordinate {
+
+namespace bu = boost::units;
+namespace bg = boost::geometry;
+
+//!frame of the points stored in a batch file
+enum class batch_frame : std::uint32_t
+{
+    none = 0,
+    icrs = 1,
+    cirs = 2,
+    galactic = 3,
+    supergalactic = 4,
+    geocentric = 5,
+    heliocentric = 6,
+    alt_az = 7
+};
+
+//!batch_frame matching a frame class, e.g. batch_frame_of<icrs<R, D>>::value
+template <typename Frame>
+struct batch_frame_of;
+
+///@cond INTERNAL
+#define BOOST_ASTRONOMY_DETAIL_BATCH_FRAME(Frame)                                             \
+template <typename Representation, typename Differential>                                   \
+struct batch_frame_of<Frame<Representation, Differential>>                                  \
+    : std::integral_constant<batch_frame, batch_frame::Frame> {};
+
+BOOST_ASTRONOMY_DETAIL_BATCH_FRAME(icrs)
+BOOST_ASTRONOMY_DETAIL_BATCH_FRAME(cirs)
+BOOST_ASTRONOMY_DETAIL_BATCH_FRAME(galactic)
+BOOST_ASTRONOMY_DETAIL_BATCH_FRAME(supergalactic)
+BOOST_ASTRONOMY_DETAIL_BATCH_FRAME(geocentric)
+BOOST_ASTRONOMY_DETAIL_BATCH_FRAME(heliocentric)
+BOOST_ASTRONOMY_DETAIL_BATCH_FRAME(alt_az)
+
+#undef BOOST_ASTRONOMY_DETAIL_BATCH_FRAME
+
+namespace detail_batch_file {
+
+std::uint32_t const format_version = 1;
+std::uint32_t const byte_order_mark = 0x01020304;
+std::size_t const array_alignment = 64;
+char const magic[8] = {'A', 'S', 'T', 'R', 'O', 'B', 'A', 'T'};
+
+// dimensions of the stored components
+std::uint32_t const dimension_none = 0;
+std::uint32_t const dimension_angle = 1;
+std::uint32_t const dimension_length = 2;
+std::uint32_t const dimension_velocity = 3;
+std::uint32_t const dimension_other = 255;
+
+// header at the start of every batch file, all the values are in the byte order of the writer
+// which is checked with byte_order, arrays start at offsets from the start of the header
+struct file_header
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order;
+    std::uint32_t system; //! 0 cartesian, 1 spherical, 2 spherical_equatorial
+    std::uint32_t frame; //! batch_frame
+    std::uint32_t value_type; //! size of CoordinateType, plus 256 for floating point types
+    std::uint32_t array_count; //! 3 for positions, 6 with space motions
+    std::uint64_t count; //! number of points
+    std::uint64_t offsets[6]; //! position of every array in bytes
+    std::uint32_t dimensions[3]; //! dimension of every position component
+    std::uint32_t reserved;
+    double scales[3]; //! factor converting stored position components into SI units
+};
+
+BOOST_STATIC_ASSERT_MSG(sizeof(file_header) == 128, "unexpected padding of batch file header");
+
+template <typename System>
+struct system_code;
+
+template <>
+struct system_code<bg::cs::cartesian> : std::integral_constant<std::uint32_t, 0> {};
+
+template <>
+struct system_code<bg::cs::spherical<bg::radian>> : std::integral_constant<std::uint32_t, 1> {};
+
+template <>
+struct system_code<bg::cs::spherical_equatorial<bg::radian>>
+    : std::integral_constant<std::uint32_t, 2> {};
+
+template <typename T>
+struct value_type_code : std::integral_constant<std::uint32_t, static_cast<std::uint32_t>(
+    sizeof(T) + (std::is_floating_point<T>::value ? 256 : 0))> {};
+
+template <typename Batch, std::size_t Index>
+struct component_quantity
+{
+    typedef typename Batch::quantity3 type;
+};
+
+template <typename Batch>
+struct component_quantity<Batch, 0>
+{
+    typedef typename Batch::quantity1 type;
+};
+
+template <typename Batch>
+struct component_quantity<Batch, 1>
+{
+    typedef typename Batch::quantity2 type;
+};
+
+template <typename Quantity>
+inline std::uint32_t dimension_code()
+{
+    typedef typename bu::get_dimension<Quantity>::type dimension;
+    return std::is_same<dimension, bu::dimensionless_type>::value ? dimension_none :
+        std::is_same<dimension, bu::plane_angle_dimension>::value ? dimension_angle :
+        std::is_same<dimension, bu::length_dimension>::value ? dimension_length :
+        std::is_same<dimension, bu::velocity_dimension>::value ? dimension_velocity :
+        dimension_other;
+}
+
+// unit of component Index of a batch, angles of spherical batches are always stored in radian
+template <typename Batch, std::size_t Index>
+inline void component_unit(std::uint32_t& dimension, double& scale)
+{
+    typedef typename component_quantity<Batch, Index>::type quantity;
+    typedef bu::quantity<bu::unit<typename bu::get_dimension<quantity>::type, bu::si::system>>
+        si_quantity;
+
+    if (system_code<typename Batch::system>::value != 0 && Index < 2)
+    {
+        dimension = dimension_angle;
+        scale = 1;
+    }
+    else
+    {
+        dimension = dimension_code<quantity>();
+        scale = boost::astronomy::detail::quantity_scale<si_quantity, quantity>::value();
+    }
+}
+
+inline std::uint64_t aligned(std::uint64_t offset)
+{
+    return (offset + array_alignment - 1) / array_alignment * array_alignment;
+}
+
+// header of count points of Batch with or without space motions
+template <typename Batch>
+inline file_header make_header(std::size_t count, batch_frame frame, bool motions)
+{
+    file_header header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.version = format_version;
+    header.byte_order = byte_order_mark;
+    header.system = system_code<typename Batch::system>::value;
+    header.frame = static_cast<std::uint32_t>(frame);
+    header.value_type = value_type_code<typename Batch::type>::value;
+    header.array_count = motions ? 6 : 3;
+    header.count = count;
+
+    std::uint64_t const array_size = static_cast<std::uint64_t>(count) * sizeof(typename Batch::type);
+    std::uint64_t offset = aligned(sizeof(file_header));
+    for (std::uint32_t i = 0; i < header.array_count; i++)
+    {
+        header.offsets[i] = offset;
+        offset = aligned(offset + array_size);
+    }
+
+    component_unit<Batch, 0>(header.dimensions[0], header.scales[0]);
+    component_unit<Batch, 1>(header.dimensions[1], header.scales[1]);
+    component_unit<Batch, 2>(header.dimensions[2], header.scales[2]);
+    return header;
+}
+
+inline bool same_scale(double a, double b)
+{
+    return std::abs(a - b) <= 1e-12 * std::max(std::abs(a), std::abs(b));
+}
+
+// checks that a header describes a file of Batch holding at most available bytes,
+// the factors converting the stored components into the units of Batch are returned
+template <typename Batch>
+inline void check_header
+(
+    file_header const& header,
+    std::uint64_t available,
+    double (&factors)[3]
+)
+{
+    typedef typename Batch::type type;
+    if (std::memcmp(header.magic, magic, sizeof(magic)) != 0 || header.version != format_version ||
+        header.byte_order != byte_order_mark ||
+        header.system != system_code<typename Batch::system>::value ||
+        header.value_type != value_type_code<type>::value ||
+        (header.array_count != 3 && header.array_count != 6) ||
+        header.count > std::numeric_limits<std::uint64_t>::max() / (6 * sizeof(type) + array_alignment))
+    {
+        throw invalid_batch_file_exception();
+    }
+
+    std::uint64_t const array_size = header.count * sizeof(type);
+    std::uint64_t end = sizeof(file_header);
+    for (std::uint32_t i = 0; i < header.array_count; i++)
+    {
+        if (header.offsets[i] < end || header.offsets[i] % alignof(type) != 0 ||
+            header.offsets[i] > available || available - header.offsets[i] < array_size)
+        {
+            throw invalid_batch_file_exception();
+        }
+        end = header.offsets[i] + array_size;
+    }
+
+    file_header const expected = make_header<Batch>(0, batch_frame::none, false);
+    for (std::size_t i = 0; i < 3; i++)
+    {
+        if (header.dimensions[i] != expected.dimensions[i] || !(header.scales[i] > 0))
+        {
+            throw invalid_batch_file_exception();
+        }
+        factors[i] = same_scale(header.scales[i], expected.scales[i]) ? 1 :
+            header.scales[i] / expected.scales[i];
+    }
+}
+
+inline void write_array(std::ostream& stream, std::uint64_t& position, std::uint64_t offset,
+    void const* values, std::uint64_t size)
+{
+    char const padding[array_alignment] = {};
+    stream.write(padding, static_cast<std::streamsize>(offset - position));
+    stream.write(static_cast<char const*>(values), static_cast<std::streamsize>(size));
+    position = offset + size;
+}
+
+inline void read_array(std::istream& stream, std::uint64_t& position, std::uint64_t offset,
+    void* values, std::uint64_t size)
+{
+    stream.ignore(static_cast<std::streamsize>(offset - position));
+    stream.read(static_cast<char*>(values), static_cast<std::streamsize>(size));
+    if (!stream)
+    {
+        throw invalid_batch_file_exception();
+    }
+    position = offset + size;
+}
+
+template <typename Batch, typename MotionType>
+inline void write(std::ostream& stream, Batch const& points,
+    space_motion_batch<MotionType> const* motions, batch_frame frame)
+{
+    BOOST_STATIC_ASSERT_MSG((is_representation_batch<Batch>::value),
+        "argument type is expected to be a batch representation class");
+    BOOST_STATIC_ASSERT_MSG((std::is_same<MotionType, typename Batch::type>::value),
+        "space motions must have the coordinate type of the positions");
+
+    std::size_t const count = points.size();
+    file_header const header = make_header<Batch>(count, frame, motions != nullptr);
+    std::uint64_t const size = static_cast<std::uint64_t>(count) * sizeof(typename Batch::type);
+    void const* arrays[6] = {points.template data<0>(), points.template data<1>(),
+        points.template data<2>(), nullptr, nullptr, nullptr};
+    if (motions != nullptr)
+    {
+        arrays[3] = motions->pm_lon_coslat_data();
+        arrays[4] = motions->pm_lat_data();
+        arrays[5] = motions->radial_velocity_data();
+    }
+
+    stream.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    std::uint64_t position = sizeof(header);
+    for (std::uint32_t i = 0; i < header.array_count; i++)
+    {
+        write_array(stream, position, header.offsets[i], arrays[i], size);
+    }
+    if (!stream)
+    {
+        throw batch_file_write_exception();
+    }
+}
+
+template <typename Batch, typename MotionType>
+inline batch_frame read(std::istream& stream, Batch& points, space_motion_batch<MotionType>* motions)
+{
+    BOOST_STATIC_ASSERT_MSG((std::is_same<MotionType, typename Batch::type>::value),
+        "space motions must have the coordinate type of the positions");
+
+    file_header header;
+    stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!stream)
+    {
+        throw invalid_batch_file_exception();
+    }
+    double factors[3];
+    check_header<Batch>(header, std::numeric_limits<std::uint64_t>::max(), factors);
+    if (motions != nullptr && header.array_count != 6)
+    {
+        throw invalid_batch_file_exception();
+    }
+
+    std::size_t const count = static_cast<std::size_t>(header.count);
+    std::uint64_t const size = header.count * sizeof(typename Batch::type);
+    points.resize(count);
+    typename Batch::type* arrays[6] = {points.template data<0>(), points.template data<1>(),
+        points.template data<2>(), nullptr, nullptr, nullptr};
+    std::uint32_t arrays_read = 3;
+    if (motions != nullptr)
+    {
+        motions->resize(count);
+        arrays[3] = motions->pm_lon_coslat_data();
+        arrays[4] = motions->pm_lat_data();
+        arrays[5] = motions->radial_velocity_data();
+        arrays_read = 6;
+    }
+
+    std::uint64_t position = sizeof(header);
+    for (std::uint32_t i = 0; i < arrays_read; i++)
+    {
+        read_array(stream, position, header.offsets[i], arrays[i], size);
+    }
+    for (std::uint32_t i = arrays_read; i < header.array_count; i++)
+    {
+        //motions which are not wanted are skipped
+        stream.ignore(static_cast<std::streamsize>(header.offsets[i] + size - position));
+        position = header.offsets[i] + size;
+    }
+
+    //components stored in other units of the same dimension are converted
+    for (std::size_t i = 0; i < 3; i++)
+    {
+        if (!(factors[i] < 1) && !(factors[i] > 1))
+        {
+            continue;
+        }
+        boost::astronomy::detail::batch_scale(count, arrays[i],
+            static_cast<typename Batch::type>(factors[i]), arrays[i]);
+    }
+    return static_cast<batch_frame>(header.frame);
+}
+
+} //namespace detail_batch_file
+///@endcond
+
+
+//!Writes the points of a batch in the binary batch format
+/*!
+The format is a 128 byte header describing the coordinate system, the coordinate type,
+the units of the components and the frame, followed by one array per component aligned
+to 64 bytes. Values are written in the byte order of the machine, readers on machines
+with another byte order reject the file. Files can be read back into a batch with
+read_batch or memory mapped and used in place with mapped_batch.
+*/
+template <typename Batch>
+void write_batch(std::ostream& stream, Batch const& points, batch_frame frame = batch_frame::none)
+{
+    detail_batch_file::write(stream, points,
+        static_cast<space_motion_batch<typename Batch::type> const*>(nullptr), frame);
+}
+
+//!Writes the points of a batch together with their space motions in the binary batch format
+template <typename Batch, typename MotionType>
+void write_batch
+(
+    std::ostream& stream,
+    Batch const& points,
+    space_motion_batch<MotionType> const& motions,
+    batch_frame frame = batch_frame::none
+)
+{
+    if (motions.size() != points.size())
+    {
+        throw invalid_batch_file_exception();
+    }
+    detail_batch_file::write(stream, points, &motions, frame);
+}
+
+//!Writes the points of a batch into a file in the binary batch format
+template <typename Batch>
+void write_batch(std::string const& file_path, Batch const& points,
+    batch_frame frame = batch_frame::none)
+{
+    std::ofstream file(file_path, std::ios::binary);
+    if (!file)
+    {
+        throw batch_file_write_exception();
+    }
+    write_batch(file, points, frame);
+}
+
+//!Writes the points of a batch and their space motions into a file in the binary batch format
+template <typename Batch, typename MotionType>
+void write_batch
+(
+    std::string const& file_path,
+    Batch const& points,
+    space_motion_batch<MotionType> const& motions,
+    batch_frame frame = batch_frame::none
+)
+{
+    std::ofstream file(file_path, std::ios::binary);
+    if (!file)
+    {
+        throw batch_file_write_exception();
+    }
+    write_batch(file, points, motions, frame);
+}
+
+//!Reads points written by write_batch into a batch and returns their frame
+//!components stored in other units (parsec instead of metre, ...) are converted,
+//!space motions stored in the file are skipped
+template <typename Batch>
+batch_frame read_batch(std::istream& stream, Batch& points)
+{
+    return detail_batch_file::read(stream, points,
+        static_cast<space_motion_batch<typename Batch::type>*>(nullptr));
+}
+
+//!Reads points and their space motions written by write_batch and returns their frame
+template <typename Batch, typename MotionType>
+batch_frame read_batch(std::istream& stream, Batch& points, space_motion_batch<MotionType>& motions)
+{
+    return detail_batch_file::read(stream, points, &motions);
+}
+
+//!Reads points from a file written by write_batch and returns their frame
+template <typename Batch>
+batch_frame read_batch(std::string const& file_path, Batch& points)
+{
+    std::ifstream file(file_path, std::ios::binary);
+    return read_batch(file, points);
+}
+
+//!Reads points and their space motions from a file written by write_batch
+template <typename Batch, typename MotionType>
+batch_frame read_batch
+(
+    std::string const& file_path,
+    Batch& points,
+    space_motion_batch<MotionType>& motions
+)
+{
+    std::ifstream file(file_path, std::ios::binary);
+    return read_batch(file, points, motions);
+}
+
+
+//!Read only view of points stored in the binary batch format in memory
+/*!
+The arrays are used where they are, so the memory must outlive the view. A view can be
+passed to the algorithms which only read batches (separation, healpix, sky_kd_tree,
+catalog_index, ...) like a Batch. The units of the file must be the units of Batch.
+*/
+template <typename Batch>
+struct batch_view
+{
+    ///@cond INTERNAL
+    BOOST_STATIC_ASSERT_MSG((is_representation_batch<Batch>::value),
+        "argument type is expected to be a batch representation class");
+    ///@endcond
+
+    typedef typename Batch::system system;
+    typedef typename Batch::type type;
+    typedef typename Batch::quantity1 quantity1;
+    typedef typename Batch::quantity2 quantity2;
+    typedef typename Batch::quantity3 quantity3;
+
+protected:
+    std::size_t count = 0; //! number of points
+    batch_frame frame_tag = batch_frame::none; //! frame of the points
+    type const* arrays[6] = {}; //! position components and space motions, if any
+
+public:
+    batch_view() {}
+
+    //!creates view of the batch file of size bytes starting at bytes
+    //!bytes must be aligned like the coordinate type, e.g. the start of a mapped region
+    batch_view(char const* bytes, std::size_t size)
+    {
+        this->assign(bytes, size);
+    }
+
+    //!returns the number of points
+    std::size_t size() const
+    {
+        return this->count;
+    }
+
+    bool empty() const
+    {
+        return this->count == 0;
+    }
+
+    //!returns the frame the file was written with
+    batch_frame frame() const
+    {
+        return this->frame_tag;
+    }
+
+    //!returns the array of given component (0, 1 or 2) of all the points
+    template <std::size_t Index>
+    type const* data() const
+    {
+        BOOST_STATIC_ASSERT_MSG(Index < 3, "Index of component must be 0, 1 or 2");
+        return this->arrays[Index];
+    }
+
+    //!returns the arrays of cartesian components of cartesian batches
+    type const* x_data() const
+    {
+        return this->arrays[0];
+    }
+
+    type const* y_data() const
+    {
+        return this->arrays[1];
+    }
+
+    type const* z_data() const
+    {
+        return this->arrays[2];
+    }
+
+    //!returns true when the file holds space motions of the points
+    bool has_motions() const
+    {
+        return this->arrays[3] != nullptr;
+    }
+
+    //!returns proper motions in longitude times cos(latitude) (radian per second) or nullptr
+    type const* pm_lon_coslat_data() const
+    {
+        return this->arrays[3];
+    }
+
+    //!returns proper motions in latitude (radian per second) or nullptr
+    type const* pm_lat_data() const
+    {
+        return this->arrays[4];
+    }
+
+    //!returns radial velocities (metre per second) or nullptr
+    type const* radial_velocity_data() const
+    {
+        return this->arrays[5];
+    }
+
+    //!returns the point at given index as boost::geometry::model::point
+    bg::model::point<type, 3, system> get_point(std::size_t index) const
+    {
+        return bg::model::point<type, 3, system>(this->arrays[0][index], this->arrays[1][index],
+            this->arrays[2][index]);
+    }
+
+    //!copies the points into a batch
+    Batch to_batch() const
+    {
+        Batch result;
+        result.resize(this->count);
+        std::copy(this->arrays[0], this->arrays[0] + this->count, result.template data<0>());
+        std::copy(this->arrays[1], this->arrays[1] + this->count, result.template data<1>());
+        std::copy(this->arrays[2], this->arrays[2] + this->count, result.template data<2>());
+        return result;
+    }
+
+protected:
+    void assign(char const* bytes, std::size_t size)
+    {
+        detail_batch_file::file_header header;
+        if (size < sizeof(header) || reinterpret_cast<std::uintptr_t>(bytes) % alignof(type) != 0)
+        {
+            throw invalid_batch_file_exception();
+        }
+        std::memcpy(&header, bytes, sizeof(header));
+
+        double factors[3];
+        detail_batch_file::check_header<Batch>(header, size, factors);
+        for (double factor : factors)
+        {
+            if (factor < 1 || factor > 1)
+            {
+                throw invalid_batch_file_exception();
+            }
+        }
+
+        this->count = static_cast<std::size_t>(header.count);
+        this->frame_tag = static_cast<batch_frame>(header.frame);
+        for (std::uint32_t i = 0; i < header.array_count; i++)
+        {
+            this->arrays[i] = reinterpret_cast<type const*>(bytes + header.offsets[i]);
+        }
+    }
+};
+
+///@cond INTERNAL
+namespace detail_batch_file {
+
+// keeps a file mapped for the lifetime of a mapped_batch, it is a base of mapped_batch
+// so that the mapping exists before the view is created
+struct mapped_file
+{
+    boost::interprocess::file_mapping file_map;
+    boost::interprocess::mapped_region region;
+
+    explicit mapped_file(std::string const& file_path) :
+        file_map(file_path.c_str(), boost::interprocess::read_only),
+        region(file_map, boost::interprocess::read_only) {}
+};
+
+} //namespace detail_batch_file
+///@endcond
+
+//!batch_view of a batch file mapped into memory as a whole
+/*!
+Opening costs only the mapping and the check of the header, pages of the arrays are read
+by the operating system when they are used and are shared by all the processes mapping
+the same file. The mapped_batch must outlive everything using its arrays.
+*/
+template <typename Batch>
+struct mapped_batch : protected detail_batch_file::mapped_file, public batch_view<Batch>
+{
+    explicit mapped_batch(std::string const& file_path) : detail_batch_file::mapped_file(file_path)
+    {
+        this->assign(static_cast<char const*>(this->region.get_address()), this->region.get_size());
+    }
+
+    //!returns the size of the mapped file in bytes
+    std::size_t file_size() const
+    {
+        return this->region.get_size();
+    }
+};
+
+template <typename Batch>
+struct is_representation_batch<batch_view<Batch>> : std::true_type {};
+
+template <typename Batch>
+struct is_representation_batch<mapped_batch<Batch>> : std::true_type {};
+
+}}} //namespace boost::astronomy::coordinate
+
+#endif // !BOOST_ASTRONOMY_COORDINATE_BATCH_FILE_HPP
@@ -86,10 +86,7 @@ public:
             YQuantity,
             ZQuantity
         > const& object
-    )
-    {
-        this->diff = object.get_differential();
-    }
+    ) = default;
 
     //!constructs object from any type of differential
     template <typename Differential>
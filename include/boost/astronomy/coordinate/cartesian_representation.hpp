@@ -15,6 +15,7 @@
 #include <boost/units/systems/si/dimensionless.hpp>
 
 #include <boost/astronomy/detail/is_base_template_of.hpp>
+#include <boost/astronomy/detail/unit_scale.hpp>
 #include <boost/astronomy/coordinate/base_representation.hpp>
 
 
@@ -93,10 +94,7 @@ public:
             YQuantity,
             ZQuantity
         > const& object
-    )
-    {
-        this->point = object.get_point();
-    }
+    ) = default;
 
     //!Constructs object from any type of representation
     //!Quantities have to be specified explicitly
@@ -266,9 +264,9 @@ make_cartesian_representation
 (cartesian_representation<CoordinateType, XQuantity, YQuantity, ZQuantity> const& other)
 {
     return make_cartesian_representation(
-        static_cast<ReturnXQuantity>(other.get_x()),
-        static_cast<ReturnYQuantity>(other.get_y()),
-        static_cast<ReturnZQuantity>(other.get_z())
+        boost::astronomy::detail::convert_quantity<ReturnXQuantity>(other.get_x()),
+        boost::astronomy::detail::convert_quantity<ReturnYQuantity>(other.get_y()),
+        boost::astronomy::detail::convert_quantity<ReturnZQuantity>(other.get_z())
     );
 }
 
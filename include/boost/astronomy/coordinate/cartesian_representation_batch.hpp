@@ -0,0 +1,259 @@
+#ifndef BOOST_ASTRONOMY_COORDINATE_CARTESIAN_REPRESENTATION_BATCH_HPP
+#define BOOST_ASTRONOMY_COORDINATE_CARTESIAN_REPRESENTATION_BATCH_HPP
+
+#include <cstddef>
+#include <vector>
+#include <type_traits>
+
+#include <boost/static_assert.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/get_dimension.hpp>
+#include <boost/units/systems/si/dimensionless.hpp>
+
+#include <boost/astronomy/detail/is_base_template_of.hpp>
+#include <boost/astronomy/detail/batch_conversion.hpp>
+#include <boost/astronomy/coordinate/base_representation_batch.hpp>
+#include <boost/astronomy/coordinate/cartesian_representation.hpp>
+
+
+namespace boost { namespace astronomy { namespace coordinate {
+
+namespace bu = boost::units;
+namespace bg = boost::geometry;
+
+//!Stores many points in cartesian representation as contiguous x, y and z arrays
+//!Every point of the batch uses the same quantities like cartesian_representation
+template
+<
+    typename CoordinateType = double,
+    typename XQuantity = bu::quantity<bu::si::dimensionless, CoordinateType>,
+    typename YQuantity = bu::quantity<bu::si::dimensionless, CoordinateType>,
+    typename ZQuantity = bu::quantity<bu::si::dimensionless, CoordinateType>
+>
+struct cartesian_representation_batch : base_representation_batch<bg::cs::cartesian, CoordinateType>
+{
+    ///@cond INTERNAL
+    BOOST_STATIC_ASSERT_MSG(
+        ((std::is_same<typename bu::get_dimension<XQuantity>::type,
+        typename bu::get_dimension<YQuantity>::type>::value) &&
+        (std::is_same<typename bu::get_dimension<YQuantity>::type,
+        typename bu::get_dimension<ZQuantity>::type>::value)),
+        "All components must have same dimensions");
+    ///@endcond
+
+public:
+    typedef XQuantity quantity1;
+    typedef YQuantity quantity2;
+    typedef ZQuantity quantity3;
+    typedef cartesian_representation<CoordinateType, XQuantity, YQuantity, ZQuantity> value_type;
+
+    cartesian_representation_batch() {}
+
+    //!creates batch of count points at the origin
+    explicit cartesian_representation_batch(std::size_t count)
+    {
+        this->resize(count);
+    }
+
+    //!creates batch from the points of single representations
+    explicit cartesian_representation_batch(std::vector<value_type> const& points)
+    {
+        this->reserve(points.size());
+        for (auto const& point : points)
+        {
+            this->push_back(point);
+        }
+    }
+
+    //!converts points of any batch representation, quantities have to be specified explicitly
+    template <typename Representation>
+    cartesian_representation_batch
+    (
+        Representation const& other,
+        conversion_accuracy accuracy = conversion_accuracy::exact
+    )
+    {
+        BOOST_STATIC_ASSERT_MSG((boost::astronomy::detail::is_base_frame_of
+            <boost::astronomy::coordinate::base_representation_batch, Representation>::value),
+            "No constructor found with given argument type");
+
+        this->assign_representation(other, accuracy);
+    }
+
+    //!appends a point
+    void push_back(XQuantity const& x, YQuantity const& y, ZQuantity const& z)
+    {
+        this->component1.push_back(x.value());
+        this->component2.push_back(y.value());
+        this->component3.push_back(z.value());
+    }
+
+    //!appends a point
+    void push_back(value_type const& point)
+    {
+        this->push_back(point.get_x(), point.get_y(), point.get_z());
+    }
+
+    //!returns the point at given index
+    value_type operator[](std::size_t index) const
+    {
+        return value_type(this->get_x(index), this->get_y(index), this->get_z(index));
+    }
+
+    //!sets the point at given index
+    void set(std::size_t index, value_type const& point)
+    {
+        this->set_x_y_z(index, point.get_x(), point.get_y(), point.get_z());
+    }
+
+    void set_x_y_z(std::size_t index, XQuantity const& x, YQuantity const& y, ZQuantity const& z)
+    {
+        this->component1[index] = x.value();
+        this->component2[index] = y.value();
+        this->component3[index] = z.value();
+    }
+
+    XQuantity get_x(std::size_t index) const
+    {
+        return XQuantity::from_value(this->component1[index]);
+    }
+
+    YQuantity get_y(std::size_t index) const
+    {
+        return YQuantity::from_value(this->component2[index]);
+    }
+
+    ZQuantity get_z(std::size_t index) const
+    {
+        return ZQuantity::from_value(this->component3[index]);
+    }
+
+    //!returns the values of x of all the points in the unit of XQuantity
+    CoordinateType* x_data()
+    {
+        return this->component1.data();
+    }
+
+    CoordinateType const* x_data() const
+    {
+        return this->component1.data();
+    }
+
+    //!returns the values of y of all the points in the unit of YQuantity
+    CoordinateType* y_data()
+    {
+        return this->component2.data();
+    }
+
+    CoordinateType const* y_data() const
+    {
+        return this->component2.data();
+    }
+
+    //!returns the values of z of all the points in the unit of ZQuantity
+    CoordinateType* z_data()
+    {
+        return this->component3.data();
+    }
+
+    CoordinateType const* z_data() const
+    {
+        return this->component3.data();
+    }
+}; //cartesian_representation_batch
+
+
+//!Convert quantities of all the points to new quantities, one factor per component is
+//!computed for the whole batch, same quantities select the copy overload
+template
+<
+    typename ReturnCoordinateType,
+    typename ReturnXQuantity,
+    typename ReturnYQuantity,
+    typename ReturnZQuantity,
+    typename CoordinateType,
+    typename XQuantity,
+    typename YQuantity,
+    typename ZQuantity,
+    typename = typename std::enable_if<!std::is_same
+    <
+        cartesian_representation_batch<ReturnCoordinateType, ReturnXQuantity, ReturnYQuantity, ReturnZQuantity>,
+        cartesian_representation_batch<CoordinateType, XQuantity, YQuantity, ZQuantity>
+    >::value>::type
+>
+cartesian_representation_batch
+<
+    ReturnCoordinateType,
+    ReturnXQuantity,
+    ReturnYQuantity,
+    ReturnZQuantity
+>
+make_cartesian_representation_batch
+(
+    cartesian_representation_batch<CoordinateType, XQuantity, YQuantity, ZQuantity> const& other
+)
+{
+    cartesian_representation_batch
+    <
+        ReturnCoordinateType,
+        ReturnXQuantity,
+        ReturnYQuantity,
+        ReturnZQuantity
+    > result(other.size());
+
+    namespace bad = boost::astronomy::detail;
+    bad::batch_scale(other.size(), other.x_data(), static_cast<ReturnCoordinateType>
+        (bad::quantity_factor<ReturnXQuantity, XQuantity>()), result.x_data());
+    bad::batch_scale(other.size(), other.y_data(), static_cast<ReturnCoordinateType>
+        (bad::quantity_factor<ReturnYQuantity, YQuantity>()), result.y_data());
+    bad::batch_scale(other.size(), other.z_data(), static_cast<ReturnCoordinateType>
+        (bad::quantity_factor<ReturnZQuantity, ZQuantity>()), result.z_data());
+    return result;
+}
+
+//!Create copy of cartesian_representation_batch
+template
+<
+    typename CoordinateType,
+    typename XQuantity,
+    typename YQuantity,
+    typename ZQuantity
+>
+cartesian_representation_batch<CoordinateType, XQuantity, YQuantity, ZQuantity>
+make_cartesian_representation_batch
+(
+    cartesian_representation_batch<CoordinateType, XQuantity, YQuantity, ZQuantity> const& other
+)
+{
+    return other;
+}
+
+//!Create cartesian_representation_batch from other type of batch representations
+//!all the components get the quantity of distance of other
+template <typename OtherRepresentation>
+cartesian_representation_batch
+<
+    typename OtherRepresentation::type,
+    typename OtherRepresentation::quantity3,
+    typename OtherRepresentation::quantity3,
+    typename OtherRepresentation::quantity3
+>
+make_cartesian_representation_batch
+(
+    OtherRepresentation const& other,
+    conversion_accuracy accuracy = conversion_accuracy::exact
+)
+{
+    return cartesian_representation_batch
+        <
+            typename OtherRepresentation::type,
+            typename OtherRepresentation::quantity3,
+            typename OtherRepresentation::quantity3,
+            typename OtherRepresentation::quantity3
+        >(other, accuracy);
+}
+
+}}} //namespace boost::astronomy::coordinate
+
+#endif // !BOOST_ASTRONOMY_COORDINATE_CARTESIAN_REPRESENTATION_BATCH_HPP
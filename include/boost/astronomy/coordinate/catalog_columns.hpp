@@ -0,0 +1,262 @@
+#ifndef BOOST_ASTRONOMY_COORDINATE_CATALOG_COLUMNS_HPP
+#define BOOST_ASTRONOMY_COORDINATE_CATALOG_COLUMNS_HPP
+
+#include <cstddef>
+#include <string>
+#include <algorithm>
+#include <type_traits>
+
+#include <boost/static_assert.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/get_dimension.hpp>
+#include <boost/units/systems/si/length.hpp>
+
+#include <boost/astronomy/detail/is_base_template_of.hpp>
+#include <boost/astronomy/detail/unit_scale.hpp>
+#include <boost/astronomy/io/column_view.hpp>
+#include <boost/astronomy/coordinate/base_representation_batch.hpp>
+#include <boost/astronomy/coordinate/epoch_propagation.hpp>
+
+
+namespace boost { namespace astronomy { namespace coordinate {
+
+namespace bu = boost::units;
+namespace bg = boost::geometry;
+
+//!Columns of a binary table holding the astrometry of a catalogue
+/*!
+Only ra and dec are required, the other views may be left empty. All the views
+must come from the same table; the first value of every row is used. pmra is the
+proper motion in right ascension times cos(dec), as given by Hipparcos and Gaia.
+*/
+template <typename T = double>
+struct catalog_columns
+{
+    io::column_view<T> ra;
+    io::column_view<T> dec;
+    io::column_view<T> parallax;
+    io::column_view<T> pmra;
+    io::column_view<T> pmdec;
+    io::column_view<T> radial_velocity;
+
+    //!returns the number of rows of the catalogue
+    std::size_t rows() const
+    {
+        return this->ra.rows();
+    }
+};
+
+//!Returns views of the named columns of table (binary_table_extension or alike)
+//!empty names leave the columns out, missing columns throw key_not_defined_exception
+template <typename T = double, typename Table>
+catalog_columns<T> make_catalog_columns
+(
+    Table const& table,
+    std::string const& ra,
+    std::string const& dec,
+    std::string const& parallax = "",
+    std::string const& pmra = "",
+    std::string const& pmdec = "",
+    std::string const& radial_velocity = ""
+)
+{
+    auto view = [&table](std::string const& name) {
+        return name.empty() ? io::column_view<T>() : table.template get_column_view<T>(name);
+    };
+
+    catalog_columns<T> columns;
+    columns.ra = view(ra);
+    columns.dec = view(dec);
+    columns.parallax = view(parallax);
+    columns.pmra = view(pmra);
+    columns.pmdec = view(pmdec);
+    columns.radial_velocity = view(radial_velocity);
+    return columns;
+}
+
+//!Factors converting the values of catalogue columns into SI units
+//!the defaults are the units of Hipparcos and Gaia
+struct catalog_units
+{
+    double angle = 0.017453292519943295; //! degree to radian
+    double parallax = 4.84813681109536e-9; //! milliarcsecond to radian
+    double proper_motion = 4.84813681109536e-9 / 31557600.0; //! mas per Julian year to radian per second
+    double radial_velocity = 1000; //! kilometre per second to metre per second
+};
+
+///@cond INTERNAL
+namespace detail_catalog_columns {
+
+double const astronomical_unit = 149597870700.0; //metre
+
+// decodes count rows starting at first into the component arrays in a single pass
+// over the rows, motions are skipped when pm_lon_coslat is null and distances are
+// 1 when to_distance is 0 (dimensionless batches)
+template <typename T, typename U, typename V>
+inline void decode_rows
+(
+    catalog_columns<T> const& columns,
+    std::size_t first,
+    std::size_t count,
+    U* lon, U* lat, U* distance,
+    V* pm_lon_coslat, V* pm_lat, V* radial_velocity,
+    catalog_units const& units,
+    double to_distance
+)
+{
+    bool const has_parallax = !columns.parallax.empty();
+    bool const has_pmra = !columns.pmra.empty();
+    bool const has_pmdec = !columns.pmdec.empty();
+    bool const has_radial_velocity = !columns.radial_velocity.empty();
+    double const distance_scale = astronomical_unit * to_distance / units.parallax;
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        std::size_t const row = first + i;
+        lon[i] = static_cast<U>(static_cast<double>(columns.ra(row, 0)) * units.angle);
+        lat[i] = static_cast<U>(static_cast<double>(columns.dec(row, 0)) * units.angle);
+
+        double d = 1;
+        if (to_distance > 0)
+        {
+            double const p = has_parallax ? static_cast<double>(columns.parallax(row, 0)) : 0;
+            d = p > 0 ? distance_scale / p : 0;
+        }
+        distance[i] = static_cast<U>(d);
+
+        if (pm_lon_coslat != nullptr)
+        {
+            pm_lon_coslat[i] = static_cast<V>(has_pmra ?
+                static_cast<double>(columns.pmra(row, 0)) * units.proper_motion : 0);
+            pm_lat[i] = static_cast<V>(has_pmdec ?
+                static_cast<double>(columns.pmdec(row, 0)) * units.proper_motion : 0);
+            radial_velocity[i] = static_cast<V>(has_radial_velocity ?
+                static_cast<double>(columns.radial_velocity(row, 0)) * units.radial_velocity : 0);
+        }
+    }
+}
+
+// returns the factor from metre into the distance unit of Batch, 0 if it is dimensionless
+template <typename Batch>
+inline double distance_factor(std::true_type)
+{
+    return boost::astronomy::detail::quantity_scale<typename Batch::quantity3,
+        bu::quantity<bu::si::length>>::value();
+}
+
+template <typename Batch>
+inline double distance_factor(std::false_type)
+{
+    return 0;
+}
+
+template <typename Batch>
+inline double distance_factor()
+{
+    typedef typename bu::get_dimension<typename Batch::quantity3>::type dimension;
+    BOOST_STATIC_ASSERT_MSG((std::is_same<typename Batch::system,
+        bg::cs::spherical_equatorial<bg::radian>>::value),
+        "catalogues are read into spherical_equatorial batches");
+    BOOST_STATIC_ASSERT_MSG((std::is_same<dimension, bu::length_dimension>::value ||
+        std::is_same<dimension, bu::dimensionless_type>::value),
+        "distances must be of length or dimensionless type");
+
+    return distance_factor<Batch>(std::is_same<dimension, bu::length_dimension>());
+}
+
+} //namespace detail_catalog_columns
+///@endcond
+
+
+//!Decodes the positions of a catalogue straight from its columns into positions
+/*!
+The big endian values of all the columns are converted while the rows are read
+once, without intermediate copies. Angles become radian and parallaxes distances
+in the unit of the batch; rows without a positive parallax get distance 0, which
+epoch propagation takes as a very distant point. Dimensionless batches get the
+distance 1.
+*/
+template <typename Batch, typename T>
+void read_catalog
+(
+    catalog_columns<T> const& columns,
+    Batch& positions,
+    catalog_units const& units = catalog_units()
+)
+{
+    BOOST_STATIC_ASSERT_MSG((boost::astronomy::detail::is_base_frame_of
+        <boost::astronomy::coordinate::base_representation_batch, Batch>::value),
+        "argument type is expected to be a batch representation class");
+
+    double const to_distance = detail_catalog_columns::distance_factor<Batch>();
+    positions.resize(columns.rows());
+    detail_catalog_columns::decode_rows(columns, 0, columns.rows(), positions.template data<0>(),
+        positions.template data<1>(), positions.template data<2>(),
+        static_cast<typename Batch::type*>(nullptr), static_cast<typename Batch::type*>(nullptr),
+        static_cast<typename Batch::type*>(nullptr), units, to_distance);
+}
+
+//!Decodes the positions and space motions of a catalogue straight from its columns
+//!missing motion columns give motions of 0
+template <typename Batch, typename T, typename MotionType>
+void read_catalog
+(
+    catalog_columns<T> const& columns,
+    Batch& positions,
+    space_motion_batch<MotionType>& motions,
+    catalog_units const& units = catalog_units()
+)
+{
+    BOOST_STATIC_ASSERT_MSG((boost::astronomy::detail::is_base_frame_of
+        <boost::astronomy::coordinate::base_representation_batch, Batch>::value),
+        "argument type is expected to be a batch representation class");
+
+    double const to_distance = detail_catalog_columns::distance_factor<Batch>();
+    positions.resize(columns.rows());
+    motions.resize(columns.rows());
+    detail_catalog_columns::decode_rows(columns, 0, columns.rows(), positions.template data<0>(),
+        positions.template data<1>(), positions.template data<2>(), motions.pm_lon_coslat_data(),
+        motions.pm_lat_data(), motions.radial_velocity_data(), units, to_distance);
+}
+
+//!Streams a catalogue from its columns through function a block of rows at a time
+/*!
+function(positions, motions, first_row) is called with batches holding the block of
+rows starting at first_row, decoded like read_catalog() does. The batches are reused
+for all the blocks and may be modified, so a transform or propagation kernel runs on
+the block while it is still in cache and the whole catalogue never has to be stored.
+*/
+template <typename Batch, typename T, typename Function>
+void for_each_catalog_block
+(
+    catalog_columns<T> const& columns,
+    Function function,
+    catalog_units const& units = catalog_units(),
+    std::size_t block = 4096
+)
+{
+    BOOST_STATIC_ASSERT_MSG((boost::astronomy::detail::is_base_frame_of
+        <boost::astronomy::coordinate::base_representation_batch, Batch>::value),
+        "argument type is expected to be a batch representation class");
+
+    double const to_distance = detail_catalog_columns::distance_factor<Batch>();
+    block = std::max<std::size_t>(block, 1);
+    Batch positions;
+    space_motion_batch<typename Batch::type> motions;
+
+    for (std::size_t begin = 0; begin < columns.rows(); begin += block)
+    {
+        std::size_t const length = std::min(block, columns.rows() - begin);
+        positions.resize(length);
+        motions.resize(length);
+        detail_catalog_columns::decode_rows(columns, begin, length, positions.template data<0>(),
+            positions.template data<1>(), positions.template data<2>(), motions.pm_lon_coslat_data(),
+            motions.pm_lat_data(), motions.radial_velocity_data(), units, to_distance);
+        function(positions, motions, begin);
+    }
+}
+
+}}} //namespace boost::astronomy::coordinate
+
+#endif // !BOOST_ASTRONOMY_COORDINATE_CATALOG_COLUMNS_HPP
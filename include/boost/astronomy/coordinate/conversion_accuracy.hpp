@@ -0,0 +1,16 @@
+#ifndef BOOST_ASTRONOMY_COORDINATE_CONVERSION_ACCURACY_HPP
+#define BOOST_ASTRONOMY_COORDINATE_CONVERSION_ACCURACY_HPP
+
+namespace boost { namespace astronomy { namespace coordinate {
+
+//!trigonometric functions used by bulk conversions of batch representations
+enum class conversion_accuracy
+{
+    exact, //! functions of the standard library
+    fast, //! vectorizable polynomials accurate to a few ulp
+    coarse //! vectorizable polynomials accurate to about 1e-7 radian
+};
+
+}}} //namespace boost::astronomy::coordinate
+
+#endif // !BOOST_ASTRONOMY_COORDINATE_CONVERSION_ACCURACY_HPP
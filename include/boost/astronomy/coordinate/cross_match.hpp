@@ -0,0 +1,381 @@
+#ifndef BOOST_ASTRONOMY_COORDINATE_CROSS_MATCH_HPP
+#define BOOST_ASTRONOMY_COORDINATE_CROSS_MATCH_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <numeric>
+#include <algorithm>
+
+#include <boost/static_assert.hpp>
+
+#include <boost/astronomy/detail/is_base_template_of.hpp>
+#include <boost/astronomy/detail/batch_conversion.hpp>
+#include <boost/astronomy/coordinate/base_representation_batch.hpp>
+#include <boost/astronomy/coordinate/healpix.hpp>
+
+
+namespace boost { namespace astronomy { namespace coordinate {
+
+//!pair of points of two catalogues closer than the match radius
+struct match_pair
+{
+    std::size_t first; //! index of the point in the matched batch
+    std::size_t second; //! index of the point in the indexed catalogue
+    double separation; //! angle between the two points (radian)
+};
+
+///@cond INTERNAL
+namespace detail_cross_match {
+
+// unit vectors sorted by pixel of the ring scheme along with their original indices
+struct sorted_vectors
+{
+    std::vector<std::int64_t> pixels;
+    std::vector<std::size_t> indices;
+    std::vector<double> x, y, z;
+};
+
+// runs task(begin, length) for consecutive parts of [0, size) on up to threads threads
+template <typename Task>
+inline void split_range(std::size_t size, std::size_t threads, Task const& task)
+{
+    std::size_t const min_points_per_thread = 1 << 16;
+    if (threads == 0)
+    {
+        threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    threads = std::max<std::size_t>(std::min(threads, size / min_points_per_thread), 1);
+
+    std::vector<std::thread> workers;
+    std::size_t const chunk = (size + threads - 1) / threads;
+    for (std::size_t t = 1; t < threads; t++)
+    {
+        std::size_t const begin = std::min(size, t * chunk);
+        std::size_t const length = std::min(chunk, size - begin);
+        workers.emplace_back([&task, begin, length]() {
+            task(begin, length);
+        });
+    }
+    task(0, std::min(chunk, size));
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+// ring pixels and unit vectors of count points of a batch starting at first,
+// the results are stored sorted by pixel
+template <typename Batch>
+inline void sort_by_pixel
+(
+    detail_healpix::grid const& cells,
+    Batch const& points,
+    std::size_t first,
+    std::size_t count,
+    std::size_t threads,
+    sorted_vectors& sorted
+)
+{
+    typedef typename Batch::system system;
+    typedef boost::astronomy::detail::libm_trigonometry math_type;
+
+    std::vector<std::int64_t> pixels(count);
+    std::vector<double> x(count), y(count), z(count);
+    split_range(count, threads, [&](std::size_t part_begin, std::size_t part_length) {
+        std::size_t const block = 256;
+        double block_z[block], phi[block], sin_theta[block];
+        for (std::size_t begin = part_begin; begin < part_begin + part_length; begin += block)
+        {
+            std::size_t const length = std::min(block, part_begin + part_length - begin);
+            detail_healpix::block_locations<math_type>(system(), length,
+                points.template data<0>() + first + begin, points.template data<1>() + first + begin,
+                points.template data<2>() + first + begin, block_z, phi, sin_theta);
+            for (std::size_t i = 0; i < length; i++)
+            {
+                pixels[begin + i] = cells.location_to_pixel(block_z[i], phi[i], sin_theta[i],
+                    healpix_scheme::ring);
+                x[begin + i] = sin_theta[i] * std::cos(phi[i]);
+                y[begin + i] = sin_theta[i] * std::sin(phi[i]);
+                z[begin + i] = block_z[i];
+            }
+        }
+    });
+
+    std::vector<std::size_t> order(count);
+    std::iota(order.begin(), order.end(), std::size_t(0));
+    std::stable_sort(order.begin(), order.end(), [&pixels](std::size_t a, std::size_t b) {
+        return pixels[a] < pixels[b];
+    });
+
+    sorted.pixels.resize(count);
+    sorted.indices.resize(count);
+    sorted.x.resize(count);
+    sorted.y.resize(count);
+    sorted.z.resize(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        std::size_t const from = order[i];
+        sorted.pixels[i] = pixels[from];
+        sorted.indices[i] = first + from;
+        sorted.x[i] = x[from];
+        sorted.y[i] = y[from];
+        sorted.z[i] = z[from];
+    }
+}
+
+} //namespace detail_cross_match
+///@endcond
+
+
+//!Spatial index of a catalogue for matching other catalogues by angular separation
+/*!
+Points of the catalogue are binned in the pixels of a HEALPix grid whose pixel radius
+is about half the match radius and kept as unit vectors sorted by pixel of the ring
+scheme. Every pixel of the matched points is compared only with the catalogue points
+of the pixels overlapping the cone of radius (match radius + pixel radius) around its
+center, the cone covers a few runs of consecutive pixels along the rings so that the
+candidates are contiguous in memory.
+Separations are compared as chord lengths between unit vectors, the angle is only
+computed for pairs which match. Only directions of the points are used.
+*/
+struct catalog_index
+{
+protected:
+    double radius = 0; //! match radius (radian)
+    double max_chord_squared = 0; //! squared chord length of the match radius
+    healpix grid; //! grid binning the points
+    detail_healpix::grid cells; //! pixel numbering of grid
+    detail_cross_match::sorted_vectors catalog; //! points of the catalogue sorted by pixel
+
+public:
+    //!indexes all the points of a batch for matching within max_separation (radian)
+    //!threads equal to 0 uses all the hardware threads
+    template <typename Batch>
+    catalog_index(Batch const& points, double max_separation, std::size_t threads = 1) :
+        radius(max_separation),
+        max_chord_squared(chord_squared(max_separation)),
+        grid(order_for(max_separation)),
+        cells(order_for(max_separation))
+    {
+        BOOST_STATIC_ASSERT_MSG((is_representation_batch<Batch>::value),
+            "argument type is expected to be a batch representation class");
+
+        detail_cross_match::sort_by_pixel(this->cells, points, 0, points.size(), threads,
+            this->catalog);
+    }
+
+    //!returns the match radius (radian)
+    double match_radius() const
+    {
+        return this->radius;
+    }
+
+    //!returns the grid binning the points
+    healpix const& get_grid() const
+    {
+        return this->grid;
+    }
+
+    //!returns the number of points indexed
+    std::size_t size() const
+    {
+        return this->catalog.indices.size();
+    }
+
+    //!matches count points of a batch starting at first against the indexed catalogue
+    /*!
+    Matched points are sorted by pixel and split into partitions of neighbouring pixels,
+    idle threads take the next partition until all are done so that crowded regions do
+    not hold up the other threads. Pairs of every partition are handed to
+    sink(std::vector<match_pair> const&) as soon as the partition is done, calls of sink
+    never overlap but their order is unspecified. Large catalogues can be matched as a
+    stream by calling this for consecutive parts of a batch.
+    */
+    template <typename Batch, typename Sink>
+    void match
+    (
+        Batch const& points,
+        std::size_t first,
+        std::size_t count,
+        Sink&& sink,
+        std::size_t threads = 1
+    ) const
+    {
+        BOOST_STATIC_ASSERT_MSG((is_representation_batch<Batch>::value),
+            "argument type is expected to be a batch representation class");
+
+        detail_cross_match::sorted_vectors sorted;
+        detail_cross_match::sort_by_pixel(this->cells, points, first, count, threads, sorted);
+
+        //partitions end at pixel boundaries once they have enough points
+        std::size_t const partition_points = 1024;
+        std::vector<std::size_t> bounds(1, 0);
+        for (std::size_t i = 1; i < count; i++)
+        {
+            if (i - bounds.back() >= partition_points && sorted.pixels[i] != sorted.pixels[i - 1])
+            {
+                bounds.push_back(i);
+            }
+        }
+        bounds.push_back(count);
+        std::size_t const partitions = bounds.size() - 1;
+
+        if (threads == 0)
+        {
+            threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+        }
+        threads = std::max<std::size_t>(std::min(threads, partitions), 1);
+
+        std::atomic<std::size_t> next(0);
+        std::mutex sink_mutex;
+        auto work = [&]() {
+            std::vector<match_pair> pairs;
+            std::vector<pixel_range> ranges;
+            for (std::size_t partition = next++; partition < partitions; partition = next++)
+            {
+                pairs.clear();
+                this->match_partition(sorted, bounds[partition], bounds[partition + 1], ranges,
+                    pairs);
+                if (!pairs.empty())
+                {
+                    std::lock_guard<std::mutex> lock(sink_mutex);
+                    sink(static_cast<std::vector<match_pair> const&>(pairs));
+                }
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (std::size_t t = 1; t < threads; t++)
+        {
+            workers.emplace_back(work);
+        }
+        work();
+
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    //!matches all the points of a batch against the indexed catalogue
+    template <typename Batch, typename Sink>
+    void match(Batch const& points, Sink&& sink, std::size_t threads = 1) const
+    {
+        this->match(points, 0, points.size(), sink, threads);
+    }
+
+    //!returns all the pairs of a batch and the indexed catalogue, sorted by first then second
+    template <typename Batch>
+    std::vector<match_pair> match_all(Batch const& points, std::size_t threads = 1) const
+    {
+        std::vector<match_pair> result;
+        this->match(points, [&result](std::vector<match_pair> const& pairs) {
+            result.insert(result.end(), pairs.begin(), pairs.end());
+        }, threads);
+
+        std::sort(result.begin(), result.end(), [](match_pair const& a, match_pair const& b) {
+            return a.first < b.first || (a.first == b.first && a.second < b.second);
+        });
+        return result;
+    }
+
+protected:
+    // squared chord length between two unit vectors separated by angle
+    static double chord_squared(double angle)
+    {
+        double const half_chord = std::sin(std::max(0.0, std::min(angle, detail_healpix::pi)) / 2);
+        return 4 * half_chord * half_chord;
+    }
+
+    // finest order whose pixel radius is still half the match radius, candidates of a
+    // pixel then lie in a cone of about twice the match radius
+    static int order_for(double radius)
+    {
+        int order = 0;
+        while (order < 20 && 2 * healpix(order + 1).max_pixel_radius() >= radius)
+        {
+            order++;
+        }
+        return order;
+    }
+
+    // matches the sorted points [begin, end) and appends the pairs
+    void match_partition
+    (
+        detail_cross_match::sorted_vectors const& sorted,
+        std::size_t begin,
+        std::size_t end,
+        std::vector<pixel_range>& ranges,
+        std::vector<match_pair>& pairs
+    ) const
+    {
+        std::vector<std::int64_t> const& pixels = this->catalog.pixels;
+        double const* x = this->catalog.x.data();
+        double const* y = this->catalog.y.data();
+        double const* z = this->catalog.z.data();
+
+        for (std::size_t pixel_begin = begin; pixel_begin < end;)
+        {
+            std::size_t pixel_end = pixel_begin + 1;
+            while (pixel_end < end && sorted.pixels[pixel_end] == sorted.pixels[pixel_begin])
+            {
+                pixel_end++;
+            }
+
+            double lon, lat;
+            this->grid.pixel_center(sorted.pixels[pixel_begin], healpix_scheme::ring, lon, lat);
+            ranges = this->grid.query_cone(lon, lat, this->radius + this->grid.max_pixel_radius(),
+                healpix_scheme::ring);
+
+            for (pixel_range const& range : ranges)
+            {
+                std::size_t const first = static_cast<std::size_t>(
+                    std::lower_bound(pixels.begin(), pixels.end(), range.first) - pixels.begin());
+                std::size_t const last = static_cast<std::size_t>(
+                    std::lower_bound(pixels.begin() + static_cast<std::ptrdiff_t>(first),
+                    pixels.end(), range.last) - pixels.begin());
+
+                for (std::size_t i = pixel_begin; i < pixel_end; i++)
+                {
+                    double const xi = sorted.x[i], yi = sorted.y[i], zi = sorted.z[i];
+                    for (std::size_t j = first; j < last; j++)
+                    {
+                        double const dx = x[j] - xi, dy = y[j] - yi, dz = z[j] - zi;
+                        double const distance = dx * dx + dy * dy + dz * dz;
+                        if (distance <= this->max_chord_squared)
+                        {
+                            pairs.push_back(match_pair{sorted.indices[i], this->catalog.indices[j],
+                                2 * std::asin(std::min(1.0, std::sqrt(distance) / 2))});
+                        }
+                    }
+                }
+            }
+            pixel_begin = pixel_end;
+        }
+    }
+};
+
+//!returns all the pairs of points of two batches separated by atmost radius (radian)
+//!pairs are sorted by index in first then index in second
+template <typename FirstBatch, typename SecondBatch>
+inline std::vector<match_pair> cross_match
+(
+    FirstBatch const& first,
+    SecondBatch const& second,
+    double radius,
+    std::size_t threads = 1
+)
+{
+    return catalog_index(second, radius, threads).match_all(first, threads);
+}
+
+}}} //namespace boost::astronomy::coordinate
+
+#endif // !BOOST_ASTRONOMY_COORDINATE_CROSS_MATCH_HPP
@@ -0,0 +1,246 @@
+#ifndef BOOST_ASTRONOMY_COORDINATE_EARTH_ORIENTATION_HPP
+#define BOOST_ASTRONOMY_COORDINATE_EARTH_ORIENTATION_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <algorithm>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <boost/astronomy/coordinate/frame_transform.hpp>
+
+
+namespace boost { namespace astronomy { namespace coordinate {
+
+///@cond INTERNAL
+namespace detail_orientation {
+
+double const arcsec_to_radian = 4.848136811095359935899141e-6;
+double const two_pi = 6.283185307179586476925287;
+
+inline double normalize_angle(double angle)
+{
+    angle = std::fmod(angle, two_pi);
+    return angle < 0 ? angle + two_pi : angle;
+}
+
+} //namespace detail_orientation
+///@endcond
+
+//!Epoch of observation in the time scales used by the orientation of the earth
+struct observation_epoch
+{
+    double ut1_days = 0; //! days of UT1 since 2000-01-01 12:00
+    double tt_centuries = 0; //! Julian centuries of TT since J2000.0
+
+    //!converts UTC using UT1 = UTC + dut1 and TT = UTC + tt_minus_utc (both in seconds)
+    //!the default of tt_minus_utc holds from 2017 until the next leap second
+    static observation_epoch from_utc
+    (
+        boost::posix_time::ptime const& utc,
+        double dut1 = 0,
+        double tt_minus_utc = 69.184
+    )
+    {
+        boost::posix_time::ptime const j2000(boost::gregorian::date(2000, 1, 1),
+            boost::posix_time::hours(12));
+        double const seconds = static_cast<double>((utc - j2000).total_microseconds()) * 1e-6;
+
+        observation_epoch epoch;
+        epoch.ut1_days = (seconds + dut1) / 86400.0;
+        epoch.tt_centuries = (seconds + tt_minus_utc) / (86400.0 * 36525.0);
+        return epoch;
+    }
+};
+
+//!returns the earth rotation angle (radian) at ut1_days (IAU 2000)
+inline double earth_rotation_angle(double ut1_days)
+{
+    double const fraction = ut1_days - std::floor(ut1_days);
+    return detail_orientation::normalize_angle(detail_orientation::two_pi *
+        (fraction + 0.7790572732640 + 0.00273781191135448 * ut1_days));
+}
+
+//!returns the mean obliquity of the ecliptic (radian) at tt_centuries (IAU 2006)
+inline double mean_obliquity(double t)
+{
+    return (84381.406 + (-46.836769 + (-0.0001831 + (0.00200340 + (-0.000000576
+        - 0.0000000434 * t) * t) * t) * t) * t) * detail_orientation::arcsec_to_radian;
+}
+
+//!Nutation in longitude and obliquity (radian)
+struct nutation_angles
+{
+    double longitude = 0; //! delta psi
+    double obliquity = 0; //! delta epsilon
+};
+
+//!returns the nutation at tt_centuries from the ten largest terms of IAU 2000B, good to about 0.05"
+inline nutation_angles nutation(double t)
+{
+    //multipliers of l, l', F, D, Omega and coefficients in 0.1 microarcsecond
+    static double const terms[10][11] = {
+        {0, 0, 0, 0, 1, -172064161, -174666, 33386, 92052331, 9086, 15377},
+        {0, 0, 2, -2, 2, -13170906, -1675, -13696, 5730336, -3015, -4587},
+        {0, 0, 2, 0, 2, -2276413, -234, 2796, 978459, -485, 1374},
+        {0, 0, 0, 0, 2, 2074554, 207, -698, -897492, 470, -291},
+        {0, 1, 0, 0, 0, 1475877, -3633, 11817, 73871, -184, -1924},
+        {0, 1, 2, -2, 2, -516821, 1226, -524, 224386, -677, -174},
+        {1, 0, 0, 0, 0, 711159, 73, -872, -6750, 0, 358},
+        {0, 0, 2, 0, 1, -387298, -367, 380, 200728, 18, 318},
+        {1, 0, 2, 0, 2, -301461, -36, 816, 129025, -63, 367},
+        {0, -1, 2, -2, 2, 215829, -494, 111, -95929, 299, 132}};
+
+    //Delaunay arguments (arcsecond)
+    double const arguments[5] = {
+        485868.249036 + 1717915923.2178 * t,
+        1287104.79305 + 129596581.0481 * t,
+        335779.526232 + 1739527262.8478 * t,
+        1072260.70369 + 1602961601.2090 * t,
+        450160.398036 - 6962890.5431 * t};
+
+    double longitude = 0, obliquity = 0;
+    for (auto const& term : terms)
+    {
+        double argument = 0;
+        for (std::size_t i = 0; i < 5; i++)
+        {
+            argument += term[i] * arguments[i];
+        }
+        argument = std::fmod(argument, 1296000.0) * detail_orientation::arcsec_to_radian;
+
+        double const s = std::sin(argument);
+        double const c = std::cos(argument);
+        longitude += (term[5] + term[6] * t) * s + term[7] * c;
+        obliquity += (term[8] + term[9] * t) * c + term[10] * s;
+    }
+
+    nutation_angles result;
+    result.longitude = longitude * 1e-7 * detail_orientation::arcsec_to_radian;
+    result.obliquity = obliquity * 1e-7 * detail_orientation::arcsec_to_radian;
+    return result;
+}
+
+//!returns the rotation from GCRS to true equator and equinox of date (bias, precession, nutation)
+//!precession uses the Fukushima-Williams angles of IAU 2006
+inline rotation_matrix precession_nutation_matrix(double t, nutation_angles const& nut)
+{
+    double const gamma = (-0.052928 + (10.556378 + (0.4932044 + (-0.00031238 + (-0.000002788
+        + 0.0000000260 * t) * t) * t) * t) * t) * detail_orientation::arcsec_to_radian;
+    double const phi = (84381.412819 + (-46.811016 + (0.0511268 + (0.00053289 + (-0.000000440
+        - 0.0000000176 * t) * t) * t) * t) * t) * detail_orientation::arcsec_to_radian;
+    double const psi = (-0.041775 + (5038.481484 + (1.5584175 + (-0.00018522 + (-0.000026452
+        - 0.0000000148 * t) * t) * t) * t) * t) * detail_orientation::arcsec_to_radian;
+
+    return multiply(rotation_about_x(-(mean_obliquity(t) + nut.obliquity)),
+        multiply(rotation_about_z(-(psi + nut.longitude)),
+            multiply(rotation_about_x(phi), rotation_about_z(gamma))));
+}
+
+//!returns the Greenwich mean sidereal time (radian, IAU 2006)
+inline double greenwich_mean_sidereal_time(double ut1_days, double t)
+{
+    return detail_orientation::normalize_angle(earth_rotation_angle(ut1_days) +
+        (0.014506 + (4612.156534 + (1.3915817 + (-0.00000044 + (-0.000029956
+        - 0.0000000368 * t) * t) * t) * t) * t) * detail_orientation::arcsec_to_radian);
+}
+
+//!Orientation of the earth and the terms of the apparent place at an epoch
+/*!
+Everything depending only on the time of observation is computed once here,
+transforming many sources at the same epoch then needs a matrix product and
+the aberration per source. Polar motion, light deflection and the complementary
+terms of the equation of the equinoxes are neglected.
+*/
+struct earth_orientation
+{
+    observation_epoch epoch; //! epoch of the orientation
+    double era = 0; //! earth rotation angle (radian)
+    double gst = 0; //! Greenwich apparent sidereal time (radian)
+    nutation_angles nut; //! nutation in longitude and obliquity
+    rotation_matrix precession_nutation{}; //! GCRS to true equator and equinox of date
+    rotation_matrix gcrs_to_cirs{}; //! GCRS to CIRS (true equator, origin at CIO)
+    double earth_velocity[3] = {0, 0, 0}; //! velocity of the earth in units of c, GCRS axes
+
+    //!computes the orientation at epoch
+    static earth_orientation at(observation_epoch const& epoch)
+    {
+        double const t = epoch.tt_centuries;
+        earth_orientation result;
+        result.epoch = epoch;
+        result.nut = nutation(t);
+        result.era = earth_rotation_angle(epoch.ut1_days);
+        result.gst = detail_orientation::normalize_angle(
+            greenwich_mean_sidereal_time(epoch.ut1_days, t) +
+            result.nut.longitude * std::cos(mean_obliquity(t)));
+        result.precession_nutation = precession_nutation_matrix(t, result.nut);
+
+        //frame rotations about z add up: Rz(era) * gcrs_to_cirs = Rz(gst) * precession_nutation
+        result.gcrs_to_cirs = multiply(rotation_about_z(result.gst - result.era),
+            result.precession_nutation);
+
+        //annual aberration from the low precision solar longitude, good to about 0.01"
+        double const days = t * 36525.0;
+        double const degree_to_radian = 0.017453292519943295769;
+        double const mean_anomaly = (357.528 + 0.9856003 * days) * degree_to_radian;
+        double const sun_longitude = (280.460 + 0.9856474 * days) * degree_to_radian +
+            (1.915 * std::sin(mean_anomaly) + 0.020 * std::sin(2 * mean_anomaly)) * degree_to_radian;
+        double const kappa = 20.49552 * detail_orientation::arcsec_to_radian;
+        double const eccentricity = 0.016708634;
+        double const perihelion = 102.93735 * degree_to_radian;
+
+        double const vx = kappa * (std::sin(sun_longitude) - eccentricity * std::sin(perihelion));
+        double const vy = -kappa * (std::cos(sun_longitude) - eccentricity * std::cos(perihelion));
+        double const obliquity = mean_obliquity(t);
+        result.earth_velocity[0] = vx;
+        result.earth_velocity[1] = vy * std::cos(obliquity);
+        result.earth_velocity[2] = vy * std::sin(obliquity);
+        return result;
+    }
+};
+
+//!Constants A, B of the refraction dz = A tan(z) + B tan^3(z) (radian) of the observed zenith distance
+struct refraction_constants
+{
+    double a = 0;
+    double b = 0;
+
+    //!computes the constants for pressure (Pa), temperature (celsius), relative humidity (0 to 1)
+    //!and wavelength (micrometre) following the model of SOFA iauRefco for optical wavelengths
+    static refraction_constants from_weather
+    (
+        double pressure,
+        double temperature,
+        double relative_humidity,
+        double wavelength = 0.574
+    )
+    {
+        refraction_constants result;
+        double const p = std::min(std::max(pressure * 0.01, 0.0), 10000.0);
+        if (!(p > 0))
+        {
+            return result;
+        }
+
+        double const t = std::min(std::max(temperature, -150.0), 200.0);
+        double const r = std::min(std::max(relative_humidity, 0.0), 1.0);
+        double const w = std::min(std::max(wavelength, 0.1), 1e6);
+
+        double const saturation = std::pow(10.0, (0.7859 + 0.03477 * t) / (1 + 0.00412 * t)) *
+            (1 + p * (4.5e-6 + 6e-10 * t * t));
+        double const vapour = r * saturation / (1 - (1 - r) * saturation / p);
+        double const kelvin = t + 273.15;
+        double const wavelength_squared = w * w;
+        double const gamma = ((77.53484e-6 + (4.39108e-7 + 3.666e-9 / wavelength_squared) /
+            wavelength_squared) * p - 11.2684e-6 * vapour) / kelvin;
+        double const beta = 4.4474e-6 * kelvin;
+
+        result.a = gamma * (1 - beta);
+        result.b = -gamma * (beta - gamma / 2);
+        return result;
+    }
+};
+
+}}} //namespace boost::astronomy::coordinate
+
+#endif // !BOOST_ASTRONOMY_COORDINATE_EARTH_ORIENTATION_HPP
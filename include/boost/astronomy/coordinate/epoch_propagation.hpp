@@ -0,0 +1,295 @@
+#ifndef BOOST_ASTRONOMY_COORDINATE_EPOCH_PROPAGATION_HPP
+#define BOOST_ASTRONOMY_COORDINATE_EPOCH_PROPAGATION_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+
+#include <boost/static_assert.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/get_dimension.hpp>
+#include <boost/units/systems/si/angular_velocity.hpp>
+#include <boost/units/systems/si/velocity.hpp>
+#include <boost/units/systems/si/length.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <boost/astronomy/detail/is_base_template_of.hpp>
+#include <boost/astronomy/detail/precision.hpp>
+#include <boost/astronomy/detail/unit_scale.hpp>
+#include <boost/astronomy/detail/batch_conversion.hpp>
+#include <boost/astronomy/detail/batch_execution.hpp>
+#include <boost/astronomy/coordinate/base_representation_batch.hpp>
+
+
+namespace boost { namespace astronomy { namespace coordinate {
+
+namespace bu = boost::units;
+namespace bg = boost::geometry;
+
+//!Stores the space motion of many points as contiguous arrays
+//!proper motions are stored in radian per second and radial velocities in metre per second
+template <typename CoordinateType = double>
+struct space_motion_batch
+{
+    ///@cond INTERNAL
+    BOOST_STATIC_ASSERT_MSG((std::is_floating_point<CoordinateType>::value),
+        "CoordinateType must be a floating-point type");
+    ///@endcond
+
+protected:
+    std::vector<CoordinateType> component1; //! proper motion in longitude times cos(latitude)
+    std::vector<CoordinateType> component2; //! proper motion in latitude
+    std::vector<CoordinateType> component3; //! radial velocity
+
+public:
+    typedef CoordinateType type;
+
+    space_motion_batch() {}
+
+    //!creates batch of count points without any motion
+    explicit space_motion_batch(std::size_t count)
+    {
+        this->resize(count);
+    }
+
+    //!returns the number of points
+    std::size_t size() const
+    {
+        return this->component1.size();
+    }
+
+    //!reserves memory for count points
+    void reserve(std::size_t count)
+    {
+        this->component1.reserve(count);
+        this->component2.reserve(count);
+        this->component3.reserve(count);
+    }
+
+    //!resizes batch to count points, new points do not move
+    void resize(std::size_t count)
+    {
+        this->component1.resize(count);
+        this->component2.resize(count);
+        this->component3.resize(count);
+    }
+
+    //!appends the motion of a point, proper motions may be in any unit of angular velocity
+    //!(milliarcsecond per year, ...) and the radial velocity in any unit of velocity
+    template <typename AngularVelocity, typename Velocity>
+    void push_back
+    (
+        AngularVelocity const& pm_lon_coslat,
+        AngularVelocity const& pm_lat,
+        Velocity const& radial_velocity
+    )
+    {
+        ///@cond INTERNAL
+        BOOST_STATIC_ASSERT_MSG((std::is_same<typename bu::get_dimension<AngularVelocity>::type,
+            bu::angular_velocity_dimension>::value),
+            "proper motions must be of angular velocity type");
+        BOOST_STATIC_ASSERT_MSG((std::is_same<typename bu::get_dimension<Velocity>::type,
+            bu::velocity_dimension>::value),
+            "radial velocity must be of velocity type");
+        ///@endcond
+
+        namespace bad = boost::astronomy::detail;
+        this->component1.push_back(bad::convert_quantity
+            <bu::quantity<bu::si::angular_velocity, CoordinateType>>(pm_lon_coslat).value());
+        this->component2.push_back(bad::convert_quantity
+            <bu::quantity<bu::si::angular_velocity, CoordinateType>>(pm_lat).value());
+        this->component3.push_back(bad::convert_quantity
+            <bu::quantity<bu::si::velocity, CoordinateType>>(radial_velocity).value());
+    }
+
+    //!returns proper motions in longitude times cos(latitude) (radian per second)
+    CoordinateType* pm_lon_coslat_data()
+    {
+        return this->component1.data();
+    }
+
+    CoordinateType const* pm_lon_coslat_data() const
+    {
+        return this->component1.data();
+    }
+
+    //!returns proper motions in latitude (radian per second)
+    CoordinateType* pm_lat_data()
+    {
+        return this->component2.data();
+    }
+
+    CoordinateType const* pm_lat_data() const
+    {
+        return this->component2.data();
+    }
+
+    //!returns radial velocities (metre per second)
+    CoordinateType* radial_velocity_data()
+    {
+        return this->component3.data();
+    }
+
+    CoordinateType const* radial_velocity_data() const
+    {
+        return this->component3.data();
+    }
+};
+
+///@cond INTERNAL
+namespace detail_epoch_propagation {
+
+double const two_pi = 6.28318530717958647693;
+
+// moves a block of points along straight lines at constant velocity for seconds
+// lon, lat in radian and distance in metre are updated together with the motions,
+// points without a positive distance keep it and only move on the sphere
+template <typename Math, typename T, typename U>
+inline void block_propagate
+(
+    std::size_t count,
+    T* lon, T* lat, T* distance,
+    U* pm_lon_coslat, U* pm_lat, U* radial_velocity,
+    double to_metre,
+    double seconds
+)
+{
+    for (std::size_t i = 0; i < count; i++)
+    {
+        double sin_lon, cos_lon, sin_lat, cos_lat;
+        Math::sincos(static_cast<double>(lon[i]), sin_lon, cos_lon);
+        Math::sincos(static_cast<double>(lat[i]), sin_lat, cos_lat);
+
+        double const stored = static_cast<double>(distance[i]) * to_metre;
+        bool const known = stored > 0;
+        double const d = known ? stored : 1;
+        double const vr = known ? static_cast<double>(radial_velocity[i]) : 0;
+        double const ve = d * static_cast<double>(pm_lon_coslat[i]);
+        double const vn = d * static_cast<double>(pm_lat[i]);
+
+        //velocity from the east, north and radial directions
+        double const vx = -ve * sin_lon - vn * sin_lat * cos_lon + vr * cos_lat * cos_lon;
+        double const vy = ve * cos_lon - vn * sin_lat * sin_lon + vr * cos_lat * sin_lon;
+        double const vz = vn * cos_lat + vr * sin_lat;
+
+        double const px = d * cos_lat * cos_lon + vx * seconds;
+        double const py = d * cos_lat * sin_lon + vy * seconds;
+        double const pz = d * sin_lat + vz * seconds;
+        double const rho = std::sqrt(px * px + py * py);
+        double const r = std::sqrt(rho * rho + pz * pz);
+
+        double new_lon = Math::atan2(py, px);
+        if (lon[i] >= 0 && new_lon < 0)
+        {
+            new_lon += two_pi;
+        }
+        lon[i] = static_cast<T>(new_lon);
+        lat[i] = static_cast<T>(Math::atan2(pz, rho));
+
+        //the velocity in the directions at the new position
+        double const east_x = rho > 0 ? -py / rho : 0;
+        double const east_y = rho > 0 ? px / rho : 1;
+        double const radial = (vx * px + vy * py + vz * pz) / r;
+        double const east = vx * east_x + vy * east_y;
+        double const north = (vz * rho * rho - pz * (vx * px + vy * py)) / (rho * r > 0 ? rho * r : 1);
+
+        pm_lon_coslat[i] = static_cast<U>(east / r);
+        pm_lat[i] = static_cast<U>(north / r);
+        if (known)
+        {
+            distance[i] = static_cast<T>(r / to_metre);
+            radial_velocity[i] = static_cast<U>(radial);
+        }
+    }
+}
+
+} //namespace detail_epoch_propagation
+///@endcond
+
+
+//!Propagates count points of a batch starting at first by seconds along their space motion
+/*!
+Every point moves along a straight line at constant velocity, the velocity is built from
+the proper motions, the distance and the radial velocity. The new position and the proper
+motions and radial velocity at the new position replace the old ones, so propagating to
+an epoch and back restores the points. Distances have to be in a unit of length; points
+whose distance is not positive are taken as very distant and only follow their proper
+motions. Light travel time is not taken into account. Large catalogues can be propagated
+as a stream by calling this for consecutive parts of the batches.
+*/
+template <typename Batch, typename MotionType>
+void propagate_epoch
+(
+    Batch& positions,
+    space_motion_batch<MotionType>& motions,
+    std::size_t first,
+    std::size_t count,
+    double seconds,
+    conversion_accuracy accuracy = conversion_accuracy::exact
+)
+{
+    BOOST_STATIC_ASSERT_MSG((boost::astronomy::detail::is_base_frame_of
+        <boost::astronomy::coordinate::base_representation_batch, Batch>::value),
+        "argument type is expected to be a batch representation class");
+    BOOST_STATIC_ASSERT_MSG((std::is_same<typename Batch::system,
+        bg::cs::spherical_equatorial<bg::radian>>::value),
+        "positions are expected to be a spherical_equatorial batch");
+    BOOST_STATIC_ASSERT_MSG((std::is_same<typename bu::get_dimension<typename Batch::quantity3>::type,
+        bu::length_dimension>::value),
+        "distances of positions must be of length type");
+
+    namespace bad = boost::astronomy::detail;
+    double const to_metre = bad::quantity_scale<bu::quantity<bu::si::length>,
+        typename Batch::quantity3>::value();
+
+    bad::dispatch_accuracy(accuracy, [&](auto math) {
+        detail_epoch_propagation::block_propagate<decltype(math)>(count,
+            positions.template data<0>() + first, positions.template data<1>() + first,
+            positions.template data<2>() + first, motions.pm_lon_coslat_data() + first,
+            motions.pm_lat_data() + first, motions.radial_velocity_data() + first, to_metre,
+            seconds);
+    });
+}
+
+//!Propagates all the points of a batch by seconds along their space motion
+//!the batch is split across threads as given by execution, a number of threads converts
+//!to a batch_execution and threads equal to 0 uses all the hardware threads
+template <typename Batch, typename MotionType>
+void propagate_epoch
+(
+    Batch& positions,
+    space_motion_batch<MotionType>& motions,
+    double seconds,
+    batch_execution const& execution = batch_execution(),
+    conversion_accuracy accuracy = conversion_accuracy::exact
+)
+{
+    std::size_t const size = std::min(positions.size(), motions.size());
+    boost::astronomy::detail::parallel_ranges(size, execution,
+        [&](std::size_t begin, std::size_t length) {
+            propagate_epoch(positions, motions, begin, length, seconds, accuracy);
+        });
+}
+
+//!Propagates all the points of a batch from the epoch from to the epoch to
+template <typename Batch, typename MotionType>
+void propagate_epoch
+(
+    Batch& positions,
+    space_motion_batch<MotionType>& motions,
+    boost::posix_time::ptime const& from,
+    boost::posix_time::ptime const& to,
+    batch_execution const& execution = batch_execution(),
+    conversion_accuracy accuracy = conversion_accuracy::exact
+)
+{
+    double const seconds = static_cast<double>((to - from).total_microseconds()) * 1e-6;
+    propagate_epoch(positions, motions, seconds, execution, accuracy);
+}
+
+}}} //namespace boost::astronomy::coordinate
+
+#endif // !BOOST_ASTRONOMY_COORDINATE_EPOCH_PROPAGATION_HPP
@@ -3,6 +3,7 @@
 
 #include <boost/astronomy/coordinate/alt_az.hpp>
 #include <boost/astronomy/coordinate/cirs.hpp>
+#include <boost/astronomy/coordinate/frame_transform.hpp>
 #include <boost/astronomy/coordinate/galactic.hpp>
 #include <boost/astronomy/coordinate/geocentric.hpp>
 #include <boost/astronomy/coordinate/heliocentric.hpp>
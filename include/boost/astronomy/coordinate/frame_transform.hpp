@@ -0,0 +1,389 @@
+#ifndef BOOST_ASTRONOMY_COORDINATE_FRAME_TRANSFORM_HPP
+#define BOOST_ASTRONOMY_COORDINATE_FRAME_TRANSFORM_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+
+#include <boost/static_assert.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/systems/si/plane_angle.hpp>
+
+#include <boost/astronomy/detail/is_base_template_of.hpp>
+#include <boost/astronomy/detail/batch_conversion.hpp>
+#include <boost/astronomy/detail/batch_execution.hpp>
+#include <boost/astronomy/detail/offload_transform.hpp>
+#include <boost/astronomy/coordinate/icrs.hpp>
+#include <boost/astronomy/coordinate/galactic.hpp>
+#include <boost/astronomy/coordinate/supergalactic.hpp>
+#include <boost/astronomy/coordinate/base_ecliptic_frame.hpp>
+#include <boost/astronomy/coordinate/base_representation_batch.hpp>
+#include <boost/astronomy/coordinate/cartesian_representation_batch.hpp>
+
+
+namespace boost { namespace astronomy { namespace coordinate {
+
+namespace bu = boost::units;
+
+//!3x3 rotation applied to column vectors of cartesian components
+struct rotation_matrix
+{
+    double m[3][3]; //! row major elements
+
+    constexpr double operator()(std::size_t row, std::size_t column) const
+    {
+        return this->m[row][column];
+    }
+};
+
+//!returns the rotation applying rhs first and then lhs
+constexpr rotation_matrix multiply(rotation_matrix const& lhs, rotation_matrix const& rhs)
+{
+    rotation_matrix result{};
+    for (std::size_t row = 0; row < 3; row++)
+    {
+        for (std::size_t column = 0; column < 3; column++)
+        {
+            double sum = 0;
+            for (std::size_t k = 0; k < 3; k++)
+            {
+                sum += lhs.m[row][k] * rhs.m[k][column];
+            }
+            result.m[row][column] = sum;
+        }
+    }
+    return result;
+}
+
+//!returns the inverse rotation
+constexpr rotation_matrix transpose(rotation_matrix const& matrix)
+{
+    rotation_matrix result{};
+    for (std::size_t row = 0; row < 3; row++)
+    {
+        for (std::size_t column = 0; column < 3; column++)
+        {
+            result.m[row][column] = matrix.m[column][row];
+        }
+    }
+    return result;
+}
+
+//!returns the rotation of the axes by angle (radian) about the x axis
+inline rotation_matrix rotation_about_x(double angle)
+{
+    double const c = std::cos(angle);
+    double const s = std::sin(angle);
+    return rotation_matrix{{{1, 0, 0}, {0, c, s}, {0, -s, c}}};
+}
+
+//!returns the rotation of the axes by angle (radian) about the z axis
+inline rotation_matrix rotation_about_z(double angle)
+{
+    double const c = std::cos(angle);
+    double const s = std::sin(angle);
+    return rotation_matrix{{{c, s, 0}, {-s, c, 0}, {0, 0, 1}}};
+}
+
+//!Orientation of the axes of a frame, from_icrs() rotates ICRS vectors into the frame
+//!the axes form a graph whose edges all lead to ICRS
+struct icrs_axes
+{
+    static constexpr rotation_matrix from_icrs()
+    {
+        return rotation_matrix{{{1, 0, 0}, {0, 1, 0}, {0, 0, 1}}};
+    }
+};
+
+//!galactic axes of Hipparcos (ESA 1997, vol. 1, section 1.5.3)
+struct galactic_axes
+{
+    //!returns the right ascension of the north galactic pole (degree)
+    static constexpr double pole_ra() { return 192.85948; }
+    //!returns the declination of the north galactic pole (degree)
+    static constexpr double pole_dec() { return 27.12825; }
+    //!returns the longitude of the north celestial pole (degree)
+    static constexpr double celestial_pole_l() { return 122.93192; }
+
+    static constexpr rotation_matrix from_icrs()
+    {
+        return rotation_matrix{{
+            {-0.0548755604162154, -0.8734370902348850, -0.4838350155487132},
+            {+0.4941094278755837, -0.4448296299600112, +0.7469822444972189},
+            {-0.8676661490190047, -0.1980763734312015, +0.4559837761750669}}};
+    }
+};
+
+//!supergalactic axes, pole at l = 47.37, b = 6.32 and origin at l = 137.37, b = 0 degree
+struct supergalactic_axes
+{
+    //!returns the galactic longitude of the supergalactic pole (degree)
+    static constexpr double pole_l() { return 47.37; }
+    //!returns the galactic latitude of the supergalactic pole (degree)
+    static constexpr double pole_b() { return 6.32; }
+    //!returns the galactic longitude of the origin (degree)
+    static constexpr double origin_l() { return 137.37; }
+
+    static constexpr rotation_matrix from_galactic()
+    {
+        return rotation_matrix{{
+            {-7.3574257480437488e-01, +6.7726129641389432e-01, 0.0},
+            {-7.4553778365233761e-02, -8.0991471306976731e-02, +9.9392259039977504e-01},
+            {+6.7314530210920764e-01, +7.3127116581696450e-01, +1.1008126222478207e-01}}};
+    }
+
+    static constexpr rotation_matrix from_icrs()
+    {
+        return multiply(from_galactic(), galactic_axes::from_icrs());
+    }
+};
+
+//!mean ecliptic and equinox of J2000, obliquity of IAU 2006 (84381.406 arcsecond)
+//!the frame bias between ICRS and J2000 (some milliarcsecond) is neglected
+struct ecliptic_axes
+{
+    //!returns the obliquity of the ecliptic (arcsecond)
+    static constexpr double obliquity() { return 84381.406; }
+
+    static constexpr rotation_matrix from_icrs()
+    {
+        return rotation_matrix{{
+            {1, 0, 0},
+            {0, +0.9174821430652419, +0.39777696911260596},
+            {0, -0.39777696911260596, +0.9174821430652419}}};
+    }
+};
+
+//!Maps a frame (or axes) type to the axes it is expressed in
+//!cirs is not mapped as its axes depend on the time of observation
+template <typename Frame, typename Enable = void>
+struct frame_axes {};
+
+template <typename Representation, typename Differential>
+struct frame_axes<icrs<Representation, Differential>>
+{
+    typedef icrs_axes type;
+};
+
+template <typename Representation, typename Differential>
+struct frame_axes<galactic<Representation, Differential>>
+{
+    typedef galactic_axes type;
+};
+
+template <typename Representation, typename Differential>
+struct frame_axes<supergalactic<Representation, Differential>>
+{
+    typedef supergalactic_axes type;
+};
+
+//!geocentric, heliocentric and other ecliptic frames
+template <typename Frame>
+struct frame_axes<Frame, typename std::enable_if<boost::astronomy::detail::is_base_frame_of
+    <boost::astronomy::coordinate::base_ecliptic_frame, Frame>::value>::type>
+{
+    typedef ecliptic_axes type;
+};
+
+template <typename Axes>
+struct frame_axes<Axes, typename std::enable_if<std::is_same<Axes, icrs_axes>::value ||
+    std::is_same<Axes, galactic_axes>::value || std::is_same<Axes, supergalactic_axes>::value ||
+    std::is_same<Axes, ecliptic_axes>::value>::type>
+{
+    typedef Axes type;
+};
+
+//!Rotation from axes of From to axes of To (frames or axes types)
+//!the composite matrix of the path through ICRS is computed once at compile time,
+//!frames sharing their axes get the exact identity and identity is true
+template <typename From, typename To>
+struct frame_rotation
+{
+    typedef typename frame_axes<From>::type from_axes;
+    typedef typename frame_axes<To>::type to_axes;
+
+    static constexpr bool identity = std::is_same<from_axes, to_axes>::value;
+    static constexpr rotation_matrix value = identity ? icrs_axes::from_icrs() :
+        multiply(to_axes::from_icrs(), transpose(from_axes::from_icrs()));
+};
+
+template <typename From, typename To>
+constexpr bool frame_rotation<From, To>::identity;
+
+template <typename From, typename To>
+constexpr rotation_matrix frame_rotation<From, To>::value;
+
+///@cond INTERNAL
+namespace detail_frame_transform {
+
+double const two_pi = 6.28318530717958647693;
+
+// direction (radian) rotated by Rotation, the matrix is a compile time constant
+// so every element is folded into the code, frames sharing their axes only get
+// the longitude wrapped and no trigonometric function is called
+template <typename Rotation, bool Identity = Rotation::identity>
+struct rotate_direction
+{
+    static void apply(double lat, double lon, double& new_lat, double& new_lon)
+    {
+        double const x = std::cos(lat) * std::cos(lon);
+        double const y = std::cos(lat) * std::sin(lon);
+        double const z = std::sin(lat);
+
+        constexpr rotation_matrix r = Rotation::value;
+        double const rx = r.m[0][0] * x + r.m[0][1] * y + r.m[0][2] * z;
+        double const ry = r.m[1][0] * x + r.m[1][1] * y + r.m[1][2] * z;
+        double const rz = r.m[2][0] * x + r.m[2][1] * y + r.m[2][2] * z;
+
+        new_lon = std::atan2(ry, rx);
+        new_lon = new_lon < 0 ? new_lon + two_pi : new_lon;
+        new_lat = std::atan2(rz, std::sqrt(rx * rx + ry * ry));
+    }
+};
+
+template <typename Rotation>
+struct rotate_direction<Rotation, true>
+{
+    static void apply(double lat, double lon, double& new_lat, double& new_lon)
+    {
+        new_lon = lon - two_pi * std::floor(lon / two_pi);
+        new_lon = new_lon < two_pi ? new_lon : 0;
+        new_lat = lat;
+    }
+};
+
+} //namespace detail_frame_transform
+///@endcond
+
+//!Converts a coordinate to ToFrame rotating its direction, the distance is kept
+//!lat and lon of both the frames are the usual astronomical latitude and longitude,
+//!longitude is returned in [0, 2 pi)
+//!The proper motion is not transformed.
+template <typename ToFrame, typename FromFrame>
+ToFrame transform_frame(FromFrame const& coordinate)
+{
+    typedef bu::quantity<bu::si::plane_angle, double> radian_quantity;
+    typedef typename ToFrame::representation to_representation;
+
+    auto const data = coordinate.get_data();
+    double const lat = static_cast<radian_quantity>(data.get_lat()).value();
+    double const lon = static_cast<radian_quantity>(data.get_lon()).value();
+    double new_lat, new_lon;
+    detail_frame_transform::rotate_direction<frame_rotation<FromFrame, ToFrame>>::apply(lat, lon,
+        new_lat, new_lon);
+
+    return ToFrame(
+        static_cast<typename to_representation::quantity1>(radian_quantity::from_value(new_lat)),
+        static_cast<typename to_representation::quantity2>(radian_quantity::from_value(new_lon)),
+        static_cast<typename to_representation::quantity3>(data.get_dist()));
+}
+
+//!Rotates all the points of a cartesian batch with a single pass over the components
+//!no trigonometric function is involved so the accuracy is not used, the points are split
+//!across threads or run on the offload device as given by execution
+template
+<
+    typename CoordinateType,
+    typename XQuantity,
+    typename YQuantity,
+    typename ZQuantity
+>
+cartesian_representation_batch<CoordinateType, XQuantity, YQuantity, ZQuantity> transform_batch
+(
+    rotation_matrix const& rotation,
+    cartesian_representation_batch<CoordinateType, XQuantity, YQuantity, ZQuantity> const& points,
+    conversion_accuracy = conversion_accuracy::exact,
+    batch_execution const& execution = batch_execution()
+)
+{
+    BOOST_STATIC_ASSERT_MSG((std::is_same<XQuantity, YQuantity>::value &&
+        std::is_same<XQuantity, ZQuantity>::value),
+        "All the components must have same quantity to be rotated");
+
+    cartesian_representation_batch<CoordinateType, XQuantity, YQuantity, ZQuantity>
+        result(points.size());
+    if (boost::astronomy::detail::try_offload_transform(execution.device,
+        execution.min_offload_points, boost::geometry::cs::cartesian(),
+        boost::geometry::cs::cartesian(), rotation.m,
+        conversion_accuracy::exact, points.size(), points.x_data(), points.y_data(),
+        points.z_data(), result.x_data(), result.y_data(), result.z_data()))
+    {
+        return result;
+    }
+    boost::astronomy::detail::parallel_ranges(points.size(), execution,
+        [&](std::size_t begin, std::size_t length) {
+            boost::astronomy::detail::batch_rotate(rotation.m, length, points.x_data() + begin,
+                points.y_data() + begin, points.z_data() + begin, result.x_data() + begin,
+                result.y_data() + begin, result.z_data() + begin);
+        });
+    return result;
+}
+
+//!Rotates all the points of a spherical or spherical_equatorial batch
+//!the points are converted to cartesian, rotated and converted back a block at a time
+//!the points are split across threads or run on the offload device as given by execution
+template <typename Batch>
+Batch transform_batch
+(
+    rotation_matrix const& rotation,
+    Batch const& points,
+    conversion_accuracy accuracy = conversion_accuracy::exact,
+    batch_execution const& execution = batch_execution()
+)
+{
+    BOOST_STATIC_ASSERT_MSG((boost::astronomy::detail::is_base_frame_of
+        <boost::astronomy::coordinate::base_representation_batch, Batch>::value),
+        "argument type is expected to be a batch representation class");
+
+    typedef typename Batch::type coordinate_type;
+    typedef typename Batch::system system;
+    namespace bad = boost::astronomy::detail;
+
+    Batch result(points.size());
+    if (bad::try_offload_transform(execution.device, execution.min_offload_points, system(),
+        system(), rotation.m, accuracy, points.size(), points.template data<0>(),
+        points.template data<1>(), points.template data<2>(), result.template data<0>(),
+        result.template data<1>(), result.template data<2>()))
+    {
+        return result;
+    }
+    bad::dispatch_accuracy(accuracy, [&](auto math) {
+        typedef decltype(math) math_type;
+        bad::parallel_ranges(points.size(), execution, [&](std::size_t first, std::size_t count) {
+            std::size_t const block = 256;
+            coordinate_type x[block], y[block], z[block];
+
+            for (std::size_t begin = first; begin < first + count; begin += block)
+            {
+                std::size_t const length = std::min(block, first + count - begin);
+                bad::batch_to_cartesian<math_type>(system(), length,
+                    points.template data<0>() + begin, points.template data<1>() + begin,
+                    points.template data<2>() + begin, x, y, z);
+                bad::batch_rotate(rotation.m, length, x, y, z, x, y, z);
+                bad::batch_from_cartesian<math_type>(system(), length, x, y, z,
+                    result.template data<0>() + begin, result.template data<1>() + begin,
+                    result.template data<2>() + begin);
+            }
+        });
+    });
+    return result;
+}
+
+//!Rotates all the points of a batch from axes of From to axes of To (frames or axes types)
+//!the points are only copied when both have the same axes
+template <typename From, typename To, typename Batch>
+Batch transform_batch
+(
+    Batch const& points,
+    conversion_accuracy accuracy = conversion_accuracy::exact,
+    batch_execution const& execution = batch_execution()
+)
+{
+    return frame_rotation<From, To>::identity ? points :
+        transform_batch(frame_rotation<From, To>::value, points, accuracy, execution);
+}
+
+}}} //namespace boost::astronomy::coordinate
+
+#endif // !BOOST_ASTRONOMY_COORDINATE_FRAME_TRANSFORM_HPP
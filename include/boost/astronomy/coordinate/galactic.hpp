@@ -27,6 +27,12 @@ public:
     //default constructor no initialization
     galactic() {}
 
+    //!constructs object from representation of the frame type, the data is copied as it is
+    galactic(Representation const& representation_data)
+    {
+        this->data = representation_data;
+    }
+
     //!creates coordinate in galactic frame using any subclass of base_representation
     template <typename OtherRepresentation>
     galactic(OtherRepresentation const& representation_data)
@@ -77,6 +83,18 @@ public:
         this->motion.set_dlat_dlon_coslat_ddist(pm_b, pm_l_cosb, radial_velocity);
     }
 
+    //!constructs object from representation and differential of the frame types,
+    //!both are copied as they are without any conversion
+    galactic
+    (
+        Representation const& representation_data,
+        Differential const& differential_data
+    )
+    {
+        this->data = representation_data;
+        this->motion = differential_data;
+    }
+
     //!creates coordinate with motion
     //!representation class is used for coordinate data
     //!differential class is used for motion data
@@ -123,11 +141,7 @@ public:
     }
 
     //copy constructor
-    galactic(galactic<Representation, Differential> const& other)
-    {
-        this->data = other.get_data();
-        this->motion = other.get_differential();
-    }
+    galactic(galactic<Representation, Differential> const& other) = default;
 
     //!returns component b of the galactic coordinate
     typename Representation::quantity1 get_b() const
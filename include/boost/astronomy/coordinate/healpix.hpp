@@ -0,0 +1,993 @@
+#ifndef BOOST_ASTRONOMY_COORDINATE_HEALPIX_HPP
+#define BOOST_ASTRONOMY_COORDINATE_HEALPIX_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <limits>
+#include <vector>
+#include <thread>
+#include <algorithm>
+
+#include <boost/static_assert.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/systems/si/plane_angle.hpp>
+
+#include <boost/astronomy/detail/is_base_template_of.hpp>
+#include <boost/astronomy/detail/batch_conversion.hpp>
+#include <boost/astronomy/coordinate/base_representation_batch.hpp>
+#include <boost/astronomy/coordinate/sky_point.hpp>
+
+
+namespace boost { namespace astronomy { namespace coordinate {
+
+namespace bu = boost::units;
+namespace bg = boost::geometry;
+
+//!numbering of the pixels of a HEALPix grid
+enum class healpix_scheme
+{
+    nested, //! pixels of a parent pixel at coarser order are consecutive
+    ring //! pixels are numbered along rings of constant latitude from north to south
+};
+
+//!consecutive pixel numbers [first, last)
+struct pixel_range
+{
+    std::int64_t first; //! first pixel of the range
+    std::int64_t last; //! one past the last pixel of the range
+};
+
+///@cond INTERNAL
+namespace detail_healpix {
+
+double const pi = 3.14159265358979323846;
+double const half_pi = 1.57079632679489661923;
+double const two_pi = 6.28318530717958647693;
+
+// ring of the northern corner of the base faces in units of nside
+inline std::int64_t face_ring(int face)
+{
+    static int const jrll[12] = {2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4};
+    return jrll[face];
+}
+
+// longitude of the center of the base faces in units of pi / 4
+inline std::int64_t face_longitude(int face)
+{
+    static int const jpll[12] = {1, 3, 5, 7, 0, 2, 4, 6, 1, 3, 5, 7};
+    return jpll[face];
+}
+
+// moves the bits of value to the even bits of the result
+inline std::int64_t spread_bits(std::int64_t value)
+{
+    std::uint64_t x = static_cast<std::uint64_t>(value) & 0xffffffffull;
+    x = (x | (x << 16)) & 0x0000ffff0000ffffull;
+    x = (x | (x << 8)) & 0x00ff00ff00ff00ffull;
+    x = (x | (x << 4)) & 0x0f0f0f0f0f0f0f0full;
+    x = (x | (x << 2)) & 0x3333333333333333ull;
+    x = (x | (x << 1)) & 0x5555555555555555ull;
+    return static_cast<std::int64_t>(x);
+}
+
+// inverse of spread_bits
+inline std::int64_t compress_bits(std::int64_t value)
+{
+    std::uint64_t x = static_cast<std::uint64_t>(value) & 0x5555555555555555ull;
+    x = (x | (x >> 1)) & 0x3333333333333333ull;
+    x = (x | (x >> 2)) & 0x0f0f0f0f0f0f0f0full;
+    x = (x | (x >> 4)) & 0x00ff00ff00ff00ffull;
+    x = (x | (x >> 8)) & 0x0000ffff0000ffffull;
+    x = (x | (x >> 16)) & 0x00000000ffffffffull;
+    return static_cast<std::int64_t>(x);
+}
+
+// floor of the square root of value
+inline std::int64_t integer_sqrt(std::int64_t value)
+{
+    std::int64_t root = static_cast<std::int64_t>(std::sqrt(static_cast<double>(value) + 0.5));
+    while (root * root > value)
+    {
+        root--;
+    }
+    while ((root + 1) * (root + 1) <= value)
+    {
+        root++;
+    }
+    return root;
+}
+
+// appends [first, last) merging it with the last range when they touch
+inline void append_range(std::vector<pixel_range>& ranges, std::int64_t first, std::int64_t last)
+{
+    if (first >= last)
+    {
+        return;
+    }
+    if (!ranges.empty() && ranges.back().last >= first)
+    {
+        ranges.back().last = std::max(ranges.back().last, last);
+        return;
+    }
+    ranges.push_back(pixel_range{first, last});
+}
+
+// sorts the pixels and merges them into ranges
+inline std::vector<pixel_range> to_ranges(std::vector<std::int64_t>& pixels)
+{
+    std::sort(pixels.begin(), pixels.end());
+    std::vector<pixel_range> ranges;
+    for (std::int64_t pixel : pixels)
+    {
+        append_range(ranges, pixel, pixel + 1);
+    }
+    return ranges;
+}
+
+// pixel numbers of the grid of given order, as in Healpix_Base of the HEALPix C++ library
+// locations are given by z = cos(colatitude), the longitude phi and
+// sin_theta = sin(colatitude) which keeps the precision near the poles
+struct grid
+{
+    int order;
+    std::int64_t nside;
+    std::int64_t npix;
+    std::int64_t ncap; // pixels in the polar cap above the northern ring of the equatorial region
+    double fact1;
+    double fact2;
+
+    explicit grid(int level) :
+        order(level),
+        nside(std::int64_t(1) << level),
+        npix(12 * nside * nside),
+        ncap(2 * nside * (nside - 1)),
+        fact1(static_cast<double>(2 * nside) * 4.0 / static_cast<double>(npix)),
+        fact2(4.0 / static_cast<double>(npix)) {}
+
+    std::int64_t xyf_to_nested(std::int64_t ix, std::int64_t iy, int face) const
+    {
+        return (static_cast<std::int64_t>(face) << (2 * this->order)) +
+            spread_bits(ix) + (spread_bits(iy) << 1);
+    }
+
+    void nested_to_xyf(std::int64_t pixel, std::int64_t& ix, std::int64_t& iy, int& face) const
+    {
+        face = static_cast<int>(pixel >> (2 * this->order));
+        pixel &= this->npix / 12 - 1;
+        ix = compress_bits(pixel);
+        iy = compress_bits(pixel >> 1);
+    }
+
+    // first pixel, number of pixels and shift of the ring counted from 1 at the north pole
+    void ring_info(std::int64_t ring, std::int64_t& first, std::int64_t& count, bool& shifted) const
+    {
+        if (ring < this->nside)
+        {
+            shifted = true;
+            count = 4 * ring;
+            first = 2 * ring * (ring - 1);
+        }
+        else if (ring < 3 * this->nside)
+        {
+            shifted = ((ring - this->nside) & 1) == 0;
+            count = 4 * this->nside;
+            first = this->ncap + (ring - this->nside) * count;
+        }
+        else
+        {
+            std::int64_t const south = 4 * this->nside - ring;
+            shifted = true;
+            count = 4 * south;
+            first = this->npix - 2 * south * (south + 1);
+        }
+    }
+
+    // z of the centers of the pixels of a ring
+    double ring_z(std::int64_t ring) const
+    {
+        if (ring < this->nside)
+        {
+            return 1 - static_cast<double>(ring * ring) * this->fact2;
+        }
+        if (ring <= 3 * this->nside)
+        {
+            return static_cast<double>(2 * this->nside - ring) * this->fact1;
+        }
+        std::int64_t const south = 4 * this->nside - ring;
+        return static_cast<double>(south * south) * this->fact2 - 1;
+    }
+
+    // number of the southernmost ring whose centers lie north of z (0 north of the first ring)
+    std::int64_t ring_above(double z) const
+    {
+        double const az = std::abs(z);
+        if (az <= 2.0 / 3.0)
+        {
+            return static_cast<std::int64_t>(static_cast<double>(this->nside) * (2 - 1.5 * z));
+        }
+        std::int64_t const ring = static_cast<std::int64_t>(
+            static_cast<double>(this->nside) * std::sqrt(3 * (1 - az)));
+        return z > 0 ? ring : 4 * this->nside - ring - 1;
+    }
+
+    std::int64_t xyf_to_ring(std::int64_t ix, std::int64_t iy, int face) const
+    {
+        std::int64_t const nl4 = 4 * this->nside;
+        std::int64_t const jr = face_ring(face) * this->nside - ix - iy - 1;
+
+        std::int64_t first, count;
+        bool shifted;
+        ring_info(jr, first, count, shifted);
+        std::int64_t const nr = count >> 2;
+        std::int64_t const kshift = shifted ? 0 : 1;
+        std::int64_t jp = (face_longitude(face) * nr + ix - iy + 1 + kshift) / 2;
+        if (jp < 1)
+        {
+            jp += nl4;
+        }
+        return first + jp - 1;
+    }
+
+    void ring_to_xyf(std::int64_t pixel, std::int64_t& ix, std::int64_t& iy, int& face) const
+    {
+        std::int64_t const nl2 = 2 * this->nside;
+        std::int64_t iring, iphi, kshift, nr;
+
+        if (pixel < this->ncap)
+        {
+            iring = (1 + integer_sqrt(1 + 2 * pixel)) >> 1;
+            iphi = (pixel + 1) - 2 * iring * (iring - 1);
+            kshift = 0;
+            nr = iring;
+            face = static_cast<int>((iphi - 1) / nr);
+        }
+        else if (pixel < this->npix - this->ncap)
+        {
+            std::int64_t const ip = pixel - this->ncap;
+            std::int64_t const tmp = ip >> (this->order + 2);
+            iring = tmp + this->nside;
+            iphi = ip - tmp * 4 * this->nside + 1;
+            kshift = (iring + this->nside) & 1;
+            nr = this->nside;
+            std::int64_t const ire = tmp + 1;
+            std::int64_t const irm = nl2 + 1 - tmp;
+            std::int64_t const ifm = (iphi - (ire >> 1) + this->nside - 1) >> this->order;
+            std::int64_t const ifp = (iphi - (irm >> 1) + this->nside - 1) >> this->order;
+            face = static_cast<int>(ifp == ifm ? (ifp | 4) : (ifp < ifm ? ifp : ifm + 8));
+        }
+        else
+        {
+            std::int64_t const ip = this->npix - pixel;
+            iring = (1 + integer_sqrt(2 * ip - 1)) >> 1;
+            iphi = 4 * iring + 1 - (ip - 2 * iring * (iring - 1));
+            kshift = 0;
+            nr = iring;
+            iring = 2 * nl2 - iring;
+            face = static_cast<int>((iphi - 1) / nr + 8);
+        }
+
+        std::int64_t const irt = iring - (2 + (face >> 2)) * this->nside + 1;
+        std::int64_t ipt = 2 * iphi - face_longitude(face) * nr - kshift - 1;
+        if (ipt >= nl2)
+        {
+            ipt -= 8 * this->nside;
+        }
+        ix = (ipt - irt) >> 1;
+        iy = (-ipt - irt) >> 1;
+    }
+
+    std::int64_t location_to_pixel
+    (
+        double z,
+        double phi,
+        double sin_theta,
+        healpix_scheme scheme
+    ) const
+    {
+        double const nside_value = static_cast<double>(this->nside);
+        double const za = std::abs(z);
+        double tt = phi / half_pi; //longitude in [0, 4)
+        tt = tt - 4 * std::floor(tt / 4);
+        tt = tt < 4 ? tt : 0;
+
+        if (za <= 2.0 / 3.0)
+        {
+            double const temp1 = nside_value * (0.5 + tt);
+            double const temp2 = nside_value * z * 0.75;
+            std::int64_t const jp = static_cast<std::int64_t>(temp1 - temp2); //ascending edge line
+            std::int64_t const jm = static_cast<std::int64_t>(temp1 + temp2); //descending edge line
+
+            if (scheme == healpix_scheme::ring)
+            {
+                std::int64_t const nl4 = 4 * this->nside;
+                std::int64_t const ir = this->nside + 1 + jp - jm; //ring counted from z = 2/3
+                std::int64_t const kshift = 1 - (ir & 1);
+                std::int64_t const t1 = jp + jm - this->nside + kshift + 1 + nl4 + nl4;
+                std::int64_t const ip = (t1 >> 1) & (nl4 - 1);
+                return this->ncap + (ir - 1) * nl4 + ip;
+            }
+
+            std::int64_t const ifp = jp >> this->order;
+            std::int64_t const ifm = jm >> this->order;
+            int const face = static_cast<int>(ifp == ifm ? (ifp | 4) : (ifp < ifm ? ifp : ifm + 8));
+            std::int64_t const ix = jm & (this->nside - 1);
+            std::int64_t const iy = this->nside - (jp & (this->nside - 1)) - 1;
+            return xyf_to_nested(ix, iy, face);
+        }
+
+        int const ntt = std::min(3, static_cast<int>(tt));
+        double const tp = tt - ntt;
+        double const tmp = za < 0.99 ? nside_value * std::sqrt(3 * (1 - za)) :
+            nside_value * sin_theta / std::sqrt((1 + za) / 3);
+        std::int64_t jp = static_cast<std::int64_t>(tp * tmp);
+        std::int64_t jm = static_cast<std::int64_t>((1 - tp) * tmp);
+
+        if (scheme == healpix_scheme::ring)
+        {
+            std::int64_t const ir = jp + jm + 1; //ring counted from the closest pole
+            std::int64_t ip = static_cast<std::int64_t>(tt * static_cast<double>(ir));
+            ip = std::min(ip, 4 * ir - 1);
+            return z > 0 ? 2 * ir * (ir - 1) + ip : this->npix - 2 * ir * (ir + 1) + ip;
+        }
+
+        jp = std::min(jp, this->nside - 1);
+        jm = std::min(jm, this->nside - 1);
+        return z >= 0 ? xyf_to_nested(this->nside - jm - 1, this->nside - jp - 1, ntt) :
+            xyf_to_nested(jp, jm, ntt + 8);
+    }
+
+    void pixel_to_location
+    (
+        std::int64_t pixel,
+        healpix_scheme scheme,
+        double& z,
+        double& phi,
+        double& sin_theta
+    ) const
+    {
+        if (scheme == healpix_scheme::ring)
+        {
+            std::int64_t ix, iy;
+            int face;
+            ring_to_xyf(pixel, ix, iy, face);
+            pixel = xyf_to_nested(ix, iy, face);
+        }
+
+        std::int64_t ix, iy;
+        int face;
+        nested_to_xyf(pixel, ix, iy, face);
+        std::int64_t const jr = (face_ring(face) << this->order) - ix - iy - 1;
+
+        std::int64_t nr;
+        if (jr < this->nside)
+        {
+            nr = jr;
+            double const tmp = static_cast<double>(nr * nr) * this->fact2;
+            z = 1 - tmp;
+            sin_theta = std::sqrt(tmp * (2 - tmp));
+        }
+        else if (jr > 3 * this->nside)
+        {
+            nr = 4 * this->nside - jr;
+            double const tmp = static_cast<double>(nr * nr) * this->fact2;
+            z = tmp - 1;
+            sin_theta = std::sqrt(tmp * (2 - tmp));
+        }
+        else
+        {
+            nr = this->nside;
+            z = static_cast<double>(2 * this->nside - jr) * this->fact1;
+            sin_theta = std::sqrt((1 - z) * (1 + z));
+        }
+
+        std::int64_t tmp = face_longitude(face) * nr + ix - iy;
+        if (tmp < 0)
+        {
+            tmp += 8 * nr;
+        }
+        phi = nr == this->nside ? 0.75 * half_pi * static_cast<double>(tmp) * this->fact1 :
+            (0.5 * half_pi * static_cast<double>(tmp)) / static_cast<double>(nr);
+    }
+
+    // largest angle between the center of a pixel and its corners
+    double max_pixel_radius() const
+    {
+        double const nside_value = static_cast<double>(this->nside);
+        double const za = 2.0 / 3.0;
+        double const phi_a = pi / (4 * nside_value);
+        double t1 = 1 - 1 / nside_value;
+        t1 *= t1;
+        double const zb = 1 - t1 / 3;
+
+        double const sa = std::sqrt((1 - za) * (1 + za));
+        double const sb = std::sqrt((1 - zb) * (1 + zb));
+        double const dx = sa * std::cos(phi_a) - sb;
+        double const dy = sa * std::sin(phi_a);
+        double const dz = za - zb;
+        double const chord = std::sqrt(dx * dx + dy * dy + dz * dz);
+        return 2 * std::asin(std::min(1.0, chord / 2));
+    }
+};
+
+// unit vector from z, phi and sin_theta
+inline void location_to_vector(double z, double phi, double sin_theta, double (&v)[3])
+{
+    v[0] = sin_theta * std::cos(phi);
+    v[1] = sin_theta * std::sin(phi);
+    v[2] = z;
+}
+
+inline double dot(double const (&a)[3], double const (&b)[3])
+{
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+// location of a block of points of a batch, component 0 of spherical_equatorial batches is
+// the longitude and component 1 the latitude as for transform_batch()
+template <typename Math, typename T>
+inline void block_locations
+(
+    bg::cs::spherical_equatorial<bg::radian>,
+    std::size_t count,
+    T const* lon, T const* lat, T const*,
+    double* z, double* phi, double* sin_theta
+)
+{
+    for (std::size_t i = 0; i < count; i++)
+    {
+        double sine, cosine;
+        Math::sincos(static_cast<double>(lat[i]), sine, cosine);
+        z[i] = sine;
+        sin_theta[i] = std::abs(cosine);
+        phi[i] = static_cast<double>(lon[i]);
+    }
+}
+
+template <typename Math, typename T>
+inline void block_locations
+(
+    bg::cs::spherical<bg::radian>,
+    std::size_t count,
+    T const* azimuth, T const* polar, T const*,
+    double* z, double* phi, double* sin_theta
+)
+{
+    for (std::size_t i = 0; i < count; i++)
+    {
+        double sine, cosine;
+        Math::sincos(static_cast<double>(polar[i]), sine, cosine);
+        z[i] = cosine;
+        sin_theta[i] = std::abs(sine);
+        phi[i] = static_cast<double>(azimuth[i]);
+    }
+}
+
+// the direction of the origin is taken as the north pole
+template <typename Math, typename T>
+inline void block_locations
+(
+    bg::cs::cartesian,
+    std::size_t count,
+    T const* x, T const* y, T const* z_component,
+    double* z, double* phi, double* sin_theta
+)
+{
+    for (std::size_t i = 0; i < count; i++)
+    {
+        double const xi = static_cast<double>(x[i]);
+        double const yi = static_cast<double>(y[i]);
+        double const zi = static_cast<double>(z_component[i]);
+        double const rho = std::sqrt(xi * xi + yi * yi);
+        double const inverse = 1 / std::max(std::sqrt(rho * rho + zi * zi),
+            std::numeric_limits<double>::min());
+        z[i] = rho > 0 ? zi * inverse : (zi < 0 ? -1 : 1);
+        sin_theta[i] = rho * inverse;
+        phi[i] = Math::atan2(yi, xi);
+    }
+}
+
+// how a pixel relates to a query region
+enum class overlap
+{
+    outside, //! no point of the pixel is inside the region
+    inside, //! all the points of the pixel are inside the region
+    partial //! the pixel may be partly inside the region
+};
+
+// descends the nested hierarchy from the base pixels, region(v, radius) classifies the cap
+// of given radius around unit vector v and contains(v) tells whether the center of a pixel
+// is inside, ranges are appended in increasing order
+template <typename Region, typename Contains>
+inline void descend
+(
+    int order,
+    int level,
+    std::int64_t pixel,
+    std::vector<double> const& radii,
+    bool inclusive,
+    Region const& region,
+    Contains const& contains,
+    std::vector<pixel_range>& ranges
+)
+{
+    grid const coarse(level);
+    double z, phi, sin_theta, v[3];
+    coarse.pixel_to_location(pixel, healpix_scheme::nested, z, phi, sin_theta);
+    location_to_vector(z, phi, sin_theta, v);
+
+    overlap const relation = region(v, radii[static_cast<std::size_t>(level)]);
+    if (relation == overlap::outside)
+    {
+        return;
+    }
+
+    int const shift = 2 * (order - level);
+    if (relation == overlap::inside)
+    {
+        append_range(ranges, pixel << shift, (pixel + 1) << shift);
+        return;
+    }
+
+    if (level == order)
+    {
+        if (inclusive || contains(v))
+        {
+            append_range(ranges, pixel, pixel + 1);
+        }
+        return;
+    }
+
+    for (std::int64_t child = 4 * pixel; child < 4 * pixel + 4; child++)
+    {
+        descend(order, level + 1, child, radii, inclusive, region, contains, ranges);
+    }
+}
+
+} //namespace detail_healpix
+///@endcond
+
+
+//!HEALPix grid of 12 * 4^order pixels of equal area
+/*!
+Pixel numbers follow the HEALPix conventions (Gorski et al. 2005) so that they can be
+exchanged with other HEALPix libraries, nside = 2^order is limited to orders up to 29.
+Directions are given by longitude and latitude in radian, for single points and for
+every batch representation (spherical_equatorial batches use component 0 as longitude
+and component 1 as latitude like transform_batch()).
+
+Cone and polygon queries return the pixels as sorted ranges of consecutive numbers.
+Inclusive queries return every pixel which may overlap the region, others return the
+pixels whose centers lie inside it.
+*/
+struct healpix
+{
+protected:
+    detail_healpix::grid cells; //! pixel numbering of the grid
+
+public:
+    //!creates the grid with nside = 2^order
+    explicit healpix(int order = 0) : cells(std::max(0, std::min(order, 29))) {}
+
+    //!returns the order of the grid
+    int order() const
+    {
+        return this->cells.order;
+    }
+
+    //!returns the number of pixels along a side of the base pixels (2^order)
+    std::int64_t nside() const
+    {
+        return this->cells.nside;
+    }
+
+    //!returns the number of pixels of the grid
+    std::int64_t pixels() const
+    {
+        return this->cells.npix;
+    }
+
+    //!returns the solid angle of every pixel (steradian)
+    double pixel_area() const
+    {
+        return 4 * detail_healpix::pi / static_cast<double>(this->cells.npix);
+    }
+
+    //!returns the largest angle between the center of a pixel and its corners (radian)
+    double max_pixel_radius() const
+    {
+        return this->cells.max_pixel_radius();
+    }
+
+    //!returns the pixel containing the direction of longitude lon and latitude lat (radian)
+    std::int64_t pixel(double lon, double lat, healpix_scheme scheme) const
+    {
+        return this->cells.location_to_pixel(std::sin(lat), lon, std::abs(std::cos(lat)), scheme);
+    }
+
+    //!returns the pixel containing the direction of a frame
+    template <typename Frame>
+    std::int64_t pixel(Frame const& coordinate, healpix_scheme scheme) const
+    {
+        typedef bu::quantity<bu::si::plane_angle, double> radian_quantity;
+        auto const data = coordinate.get_data();
+        return this->pixel(static_cast<radian_quantity>(data.get_lon()).value(),
+            static_cast<radian_quantity>(data.get_lat()).value(), scheme);
+    }
+
+    //!returns the pixel containing a sky_point
+    template <typename CoordinateSystem>
+    std::int64_t pixel(sky_point<CoordinateSystem> const& point, healpix_scheme scheme) const
+    {
+        return this->pixel(point.get_point(), scheme);
+    }
+
+    //!returns the longitude and latitude (radian) of the center of a pixel
+    void pixel_center(std::int64_t pixel, healpix_scheme scheme, double& lon, double& lat) const
+    {
+        double z, sin_theta;
+        this->cells.pixel_to_location(pixel, scheme, z, lon, sin_theta);
+        lat = std::atan2(z, sin_theta);
+    }
+
+    //!returns the number of a pixel of the nested scheme in the ring scheme
+    std::int64_t nested_to_ring(std::int64_t pixel) const
+    {
+        std::int64_t ix, iy;
+        int face;
+        this->cells.nested_to_xyf(pixel, ix, iy, face);
+        return this->cells.xyf_to_ring(ix, iy, face);
+    }
+
+    //!returns the number of a pixel of the ring scheme in the nested scheme
+    std::int64_t ring_to_nested(std::int64_t pixel) const
+    {
+        std::int64_t ix, iy;
+        int face;
+        this->cells.ring_to_xyf(pixel, ix, iy, face);
+        return this->cells.xyf_to_nested(ix, iy, face);
+    }
+
+    //!computes the pixels of count points of a batch starting at first
+    /*!
+    Points are processed a block at a time, angles are evaluated with the trigonometric
+    functions of accuracy. Large catalogues can be indexed as a stream by calling this for
+    consecutive parts of a batch (or for consecutive batches) without keeping all pixels.
+    */
+    template <typename Batch>
+    void batch_pixels
+    (
+        Batch const& points,
+        std::size_t first,
+        std::size_t count,
+        healpix_scheme scheme,
+        std::int64_t* result,
+        conversion_accuracy accuracy = conversion_accuracy::exact
+    ) const
+    {
+        BOOST_STATIC_ASSERT_MSG((is_representation_batch<Batch>::value),
+            "argument type is expected to be a batch representation class");
+
+        typedef typename Batch::system system;
+        namespace bad = boost::astronomy::detail;
+
+        bad::dispatch_accuracy(accuracy, [&](auto math) {
+            typedef decltype(math) math_type;
+            std::size_t const block = 256;
+            double z[block], phi[block], sin_theta[block];
+
+            for (std::size_t begin = first; begin < first + count; begin += block)
+            {
+                std::size_t const length = std::min(block, first + count - begin);
+                detail_healpix::block_locations<math_type>(system(), length,
+                    points.template data<0>() + begin, points.template data<1>() + begin,
+                    points.template data<2>() + begin, z, phi, sin_theta);
+                for (std::size_t i = 0; i < length; i++)
+                {
+                    result[begin - first + i] =
+                        this->cells.location_to_pixel(z[i], phi[i], sin_theta[i], scheme);
+                }
+            }
+        });
+    }
+
+    //!returns the pixels of all the points of a batch
+    //!the batch is split across threads, threads equal to 0 uses all the hardware threads
+    template <typename Batch>
+    std::vector<std::int64_t> batch_pixels
+    (
+        Batch const& points,
+        healpix_scheme scheme,
+        conversion_accuracy accuracy = conversion_accuracy::exact,
+        std::size_t threads = 1
+    ) const
+    {
+        std::size_t const size = points.size();
+        std::size_t const min_points_per_thread = 1 << 16;
+        if (threads == 0)
+        {
+            threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+        }
+        threads = std::max<std::size_t>(std::min(threads, size / min_points_per_thread), 1);
+
+        std::vector<std::int64_t> result(size);
+        std::vector<std::thread> workers;
+        std::size_t const chunk = (size + threads - 1) / threads;
+        for (std::size_t t = 1; t < threads; t++)
+        {
+            std::size_t const begin = std::min(size, t * chunk);
+            std::size_t const length = std::min(chunk, size - begin);
+            workers.emplace_back([this, &points, &result, begin, length, scheme, accuracy]() {
+                this->batch_pixels(points, begin, length, scheme, result.data() + begin, accuracy);
+            });
+        }
+        this->batch_pixels(points, 0, std::min(chunk, size), scheme, result.data(), accuracy);
+
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+        return result;
+    }
+
+    //!returns the pixels of the cone of given radius around longitude lon and latitude lat
+    //!(all in radian)
+    std::vector<pixel_range> query_cone
+    (
+        double lon,
+        double lat,
+        double radius,
+        healpix_scheme scheme,
+        bool inclusive = true
+    ) const
+    {
+        namespace dh = detail_healpix;
+        std::vector<pixel_range> ranges;
+        double const outer = inclusive ? radius + this->max_pixel_radius() : radius;
+        if (outer >= dh::pi)
+        {
+            ranges.push_back(pixel_range{0, this->cells.npix});
+            return ranges;
+        }
+        if (radius < 0)
+        {
+            return ranges;
+        }
+
+        if (scheme == healpix_scheme::ring)
+        {
+            return query_cone_rings(lon, lat, outer);
+        }
+
+        double center[3];
+        dh::location_to_vector(std::sin(lat), lon, std::abs(std::cos(lat)), center);
+        double const cos_radius = std::cos(radius);
+        auto region = [&](double const (&v)[3], double pixel_radius) {
+            double const distance = std::acos(std::max(-1.0, std::min(1.0, dh::dot(v, center))));
+            if (distance > radius + pixel_radius)
+            {
+                return dh::overlap::outside;
+            }
+            return distance + pixel_radius <= radius ? dh::overlap::inside : dh::overlap::partial;
+        };
+        auto contains = [&](double const (&v)[3]) {
+            return dh::dot(v, center) >= cos_radius;
+        };
+        return query_hierarchy(region, contains, inclusive);
+    }
+
+    //!returns the pixels of the convex spherical polygon with the points of vertices as corners
+    /*!
+    Vertices may be any batch representation, only their directions are used and they
+    have to be given in order (clockwise or counter clockwise) along the boundary.
+    Polygons with less than 3 vertices are empty. Results in the ring scheme are built
+    from the nested pixels so their cost grows with the number of pixels returned.
+    */
+    template <typename Batch>
+    std::vector<pixel_range> query_polygon
+    (
+        Batch const& vertices,
+        healpix_scheme scheme,
+        bool inclusive = true
+    ) const
+    {
+        namespace dh = detail_healpix;
+        std::size_t const count = vertices.size();
+        if (count < 3)
+        {
+            return std::vector<pixel_range>();
+        }
+
+        std::vector<double> location(3 * count);
+        dh::block_locations<boost::astronomy::detail::libm_trigonometry>(typename Batch::system(),
+            count, vertices.template data<0>(), vertices.template data<1>(),
+            vertices.template data<2>(), location.data(), location.data() + count,
+            location.data() + 2 * count);
+
+        std::vector<std::array<double, 3>> corners(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            double v[3];
+            dh::location_to_vector(location[i], location[count + i], location[2 * count + i], v);
+            corners[i] = {{v[0], v[1], v[2]}};
+        }
+
+        //inner normals of the great circles through consecutive vertices
+        std::vector<std::array<double, 3>> normals(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            std::array<double, 3> const& a = corners[i];
+            std::array<double, 3> const& b = corners[(i + 1) % count];
+            std::array<double, 3> n = {{a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2],
+                a[0] * b[1] - a[1] * b[0]}};
+            double const length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+            for (double& component : n)
+            {
+                component /= length;
+            }
+            normals[i] = n;
+        }
+        std::array<double, 3> const& other = corners[2 % count];
+        double const side = normals[0][0] * other[0] + normals[0][1] * other[1] +
+            normals[0][2] * other[2];
+        if (side < 0)
+        {
+            for (auto& n : normals)
+            {
+                n = {{-n[0], -n[1], -n[2]}};
+            }
+        }
+
+        auto region = [&](double const (&v)[3], double pixel_radius) {
+            double const reach = std::sin(std::min(pixel_radius, dh::half_pi));
+            bool inside = pixel_radius < dh::half_pi;
+            for (auto const& n : normals)
+            {
+                double const distance = n[0] * v[0] + n[1] * v[1] + n[2] * v[2];
+                if (distance < -reach)
+                {
+                    return dh::overlap::outside;
+                }
+                inside = inside && distance > reach;
+            }
+            return inside ? dh::overlap::inside : dh::overlap::partial;
+        };
+        auto contains = [&](double const (&v)[3]) {
+            for (auto const& n : normals)
+            {
+                if (n[0] * v[0] + n[1] * v[1] + n[2] * v[2] < 0)
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        std::vector<pixel_range> ranges = query_hierarchy(region, contains, inclusive);
+        if (scheme == healpix_scheme::nested)
+        {
+            return ranges;
+        }
+
+        std::vector<std::int64_t> ring_pixels;
+        for (pixel_range const& range : ranges)
+        {
+            for (std::int64_t pixel = range.first; pixel < range.last; pixel++)
+            {
+                ring_pixels.push_back(this->nested_to_ring(pixel));
+            }
+        }
+        return dh::to_ranges(ring_pixels);
+    }
+
+protected:
+    //!nested ranges of the pixels of a region found by descending from the base pixels
+    template <typename Region, typename Contains>
+    std::vector<pixel_range> query_hierarchy
+    (
+        Region const& region,
+        Contains const& contains,
+        bool inclusive
+    ) const
+    {
+        std::vector<double> radii;
+        for (int level = 0; level <= this->order(); level++)
+        {
+            radii.push_back(detail_healpix::grid(level).max_pixel_radius());
+        }
+
+        std::vector<pixel_range> ranges;
+        for (std::int64_t base = 0; base < 12; base++)
+        {
+            detail_healpix::descend(this->order(), 0, base, radii, inclusive, region, contains,
+                ranges);
+        }
+        return ranges;
+    }
+
+    //!ring ranges of the pixels whose centers lie within radius of the direction
+    std::vector<pixel_range> query_cone_rings(double lon, double lat, double radius) const
+    {
+        namespace dh = detail_healpix;
+        dh::grid const& g = this->cells;
+        std::vector<pixel_range> ranges;
+
+        double const theta = dh::half_pi - lat;
+        double const z0 = std::sin(lat);
+        double const sin_theta0 = std::abs(std::cos(lat));
+        double const cos_radius = std::cos(radius);
+
+        //northern and southern rings which may intersect the cone
+        double const north = theta - radius;
+        double const south = theta + radius;
+        std::int64_t const first_ring = north <= 0 ? 1 : g.ring_above(std::cos(north)) + 1;
+        std::int64_t const last_ring = south >= dh::pi ? 4 * g.nside - 1 :
+            g.ring_above(std::cos(south));
+
+        for (std::int64_t ring = first_ring; ring <= last_ring; ring++)
+        {
+            double const z = g.ring_z(ring);
+            std::int64_t first, count;
+            bool shifted;
+            g.ring_info(ring, first, count, shifted);
+
+            //half width in longitude of the cone on the ring
+            double dphi;
+            double const sin_theta = std::sqrt((1 - z) * (1 + z));
+            if (sin_theta * sin_theta0 > 0)
+            {
+                double const cosine = (cos_radius - z * z0) / (sin_theta * sin_theta0);
+                dphi = cosine <= -1 ? dh::pi : cosine >= 1 ? -1 : std::acos(cosine);
+            }
+            else
+            {
+                dphi = z * z0 >= cos_radius ? dh::pi : -1;
+            }
+
+            if (dphi < 0)
+            {
+                continue;
+            }
+            if (dphi >= dh::pi)
+            {
+                dh::append_range(ranges, first, first + count);
+                continue;
+            }
+
+            double const shift = shifted ? 0.5 : 0;
+            double const rate = static_cast<double>(count) / dh::two_pi;
+            std::int64_t low = static_cast<std::int64_t>(std::floor(rate * (lon - dphi) - shift)) + 1;
+            std::int64_t high = static_cast<std::int64_t>(std::floor(rate * (lon + dphi) - shift));
+            if (high - low + 1 >= count)
+            {
+                dh::append_range(ranges, first, first + count);
+                continue;
+            }
+            if (low > high)
+            {
+                continue;
+            }
+
+            //moving the interval so that low is inside [0, count)
+            std::int64_t const turns = low >= 0 ? low / count : -((-low + count - 1) / count);
+            low -= turns * count;
+            high -= turns * count;
+            if (high >= count)
+            {
+                dh::append_range(ranges, first, first + high - count + 1);
+                dh::append_range(ranges, first + low, first + count);
+            }
+            else
+            {
+                dh::append_range(ranges, first + low, first + high + 1);
+            }
+        }
+        return ranges;
+    }
+};
+
+}}} //namespace boost::astronomy::coordinate
+
+#endif // !BOOST_ASTRONOMY_COORDINATE_HEALPIX_HPP
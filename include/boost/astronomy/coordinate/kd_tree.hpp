@@ -0,0 +1,336 @@
+#ifndef BOOST_ASTRONOMY_COORDINATE_KD_TREE_HPP
+#define BOOST_ASTRONOMY_COORDINATE_KD_TREE_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+#include <thread>
+#include <numeric>
+#include <utility>
+#include <algorithm>
+
+#include <boost/static_assert.hpp>
+
+#include <boost/astronomy/detail/is_base_template_of.hpp>
+#include <boost/astronomy/coordinate/base_representation_batch.hpp>
+#include <boost/astronomy/coordinate/batch_arithmetic.hpp>
+
+
+namespace boost { namespace astronomy { namespace coordinate {
+
+//!point of a sky_kd_tree found by a nearest neighbour search
+struct neighbour
+{
+    std::size_t index; //! index of the point in the batch the tree was built from
+    double separation; //! angle between the point and the query direction (radian)
+};
+
+//!Static 3-D k-d tree of the directions of a batch for nearest neighbour searches
+/*!
+Points are stored as cartesian unit vectors, the tree is implicit: every node is the
+median of its range of points along the axis of largest spread and its two halves are
+the subtrees, ranges of at most leaf_size points are searched linearly. Distances are
+compared as squared chord lengths which order the points like their separations.
+*/
+struct sky_kd_tree
+{
+protected:
+    static std::size_t const leaf_size = 8;
+
+    std::vector<double> x, y, z; //! unit vectors in tree order
+    std::vector<std::size_t> indices; //! index in the batch of every point in tree order
+    std::vector<unsigned char> axes; //! split axis of the node whose median is at a position
+
+    //!largest squared chords found so far, the worst is on top
+    typedef std::vector<std::pair<double, std::size_t>> heap_type;
+
+public:
+    //!builds the tree from all the points of a batch
+    template <typename Batch>
+    explicit sky_kd_tree(Batch const& points)
+    {
+        BOOST_STATIC_ASSERT_MSG((is_representation_batch<Batch>::value),
+            "argument type is expected to be a batch representation class");
+
+        std::size_t const count = points.size();
+        std::vector<double> px(count), py(count), pz(count);
+        unit_vectors(points, 0, count, px.data(), py.data(), pz.data());
+
+        std::vector<std::size_t> order(count);
+        std::iota(order.begin(), order.end(), std::size_t(0));
+        this->axes.resize(count);
+        double const* components[3] = {px.data(), py.data(), pz.data()};
+        build(order, components, 0, count);
+
+        this->x.resize(count);
+        this->y.resize(count);
+        this->z.resize(count);
+        this->indices = order;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            this->x[i] = px[order[i]];
+            this->y[i] = py[order[i]];
+            this->z[i] = pz[order[i]];
+        }
+    }
+
+    //!returns the number of points of the tree
+    std::size_t size() const
+    {
+        return this->indices.size();
+    }
+
+    //!returns the k points nearest to the direction of longitude lon and latitude lat (radian)
+    //!sorted by separation, less points are returned when the tree has less than k
+    std::vector<neighbour> nearest(double lon, double lat, std::size_t k) const
+    {
+        double const v[3] = {std::cos(lat) * std::cos(lon), std::cos(lat) * std::sin(lon),
+            std::sin(lat)};
+        std::vector<neighbour> result(std::min(k, this->size()));
+        heap_type heap;
+        this->search_vector(v, result.size(), heap, result.data());
+        return result;
+    }
+
+    //!returns the k nearest points of every point of a batch
+    /*!
+    Neighbours of point i are stored at [i * m, (i + 1) * m) sorted by separation where
+    m = min(k, size()). The batch is split across threads, threads equal to 0 uses all
+    the hardware threads.
+    */
+    template <typename Batch>
+    std::vector<neighbour> batch_nearest
+    (
+        Batch const& points,
+        std::size_t k,
+        std::size_t threads = 1
+    ) const
+    {
+        BOOST_STATIC_ASSERT_MSG((is_representation_batch<Batch>::value),
+            "argument type is expected to be a batch representation class");
+
+        std::size_t const size = points.size();
+        std::size_t const m = std::min(k, this->size());
+        std::size_t const min_points_per_thread = 1 << 12;
+        if (threads == 0)
+        {
+            threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+        }
+        threads = std::max<std::size_t>(std::min(threads, size / min_points_per_thread), 1);
+
+        std::vector<neighbour> result(size * m);
+        auto task = [this, &points, &result, m](std::size_t first, std::size_t count) {
+            std::size_t const block = detail_batch_arithmetic::block_size;
+            double qx[block], qy[block], qz[block];
+            heap_type heap;
+            for (std::size_t begin = first; begin < first + count; begin += block)
+            {
+                std::size_t const length = std::min(block, first + count - begin);
+                unit_vectors(points, begin, length, qx, qy, qz);
+                for (std::size_t i = 0; i < length; i++)
+                {
+                    double const v[3] = {qx[i], qy[i], qz[i]};
+                    this->search_vector(v, m, heap, result.data() + (begin + i) * m);
+                }
+            }
+        };
+
+        std::vector<std::thread> workers;
+        std::size_t const chunk = (size + threads - 1) / threads;
+        for (std::size_t t = 1; t < threads; t++)
+        {
+            std::size_t const begin = std::min(size, t * chunk);
+            std::size_t const length = std::min(chunk, size - begin);
+            workers.emplace_back([&task, begin, length]() {
+                task(begin, length);
+            });
+        }
+        task(0, std::min(chunk, size));
+
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+        return result;
+    }
+
+protected:
+    // unit vectors of count points of a batch starting at first
+    template <typename Batch>
+    static void unit_vectors
+    (
+        Batch const& points,
+        std::size_t first,
+        std::size_t count,
+        double* ux,
+        double* uy,
+        double* uz
+    )
+    {
+        namespace dba = detail_batch_arithmetic;
+        dba::cartesian_block<Batch> block;
+        for (std::size_t begin = 0; begin < count; begin += dba::block_size)
+        {
+            std::size_t const length = std::min(dba::block_size, count - begin);
+            block.load(points, first + begin, length);
+            for (std::size_t i = 0; i < length; i++)
+            {
+                double const bx = static_cast<double>(block.x[i]);
+                double const by = static_cast<double>(block.y[i]);
+                double const bz = static_cast<double>(block.z[i]);
+                double const inverse = 1 / std::max(std::sqrt(bx * bx + by * by + bz * bz),
+                    std::numeric_limits<double>::min());
+                ux[begin + i] = bx * inverse;
+                uy[begin + i] = by * inverse;
+                uz[begin + i] = bz * inverse;
+            }
+        }
+    }
+
+    // arranges order[begin, end) into the subtree of the range
+    void build
+    (
+        std::vector<std::size_t>& order,
+        double const* const (&components)[3],
+        std::size_t begin,
+        std::size_t end
+    )
+    {
+        if (end - begin <= leaf_size)
+        {
+            return;
+        }
+
+        double low[3], high[3];
+        for (int axis = 0; axis < 3; axis++)
+        {
+            low[axis] = std::numeric_limits<double>::infinity();
+            high[axis] = -std::numeric_limits<double>::infinity();
+        }
+        for (std::size_t i = begin; i < end; i++)
+        {
+            for (int axis = 0; axis < 3; axis++)
+            {
+                low[axis] = std::min(low[axis], components[axis][order[i]]);
+                high[axis] = std::max(high[axis], components[axis][order[i]]);
+            }
+        }
+        int split = 0;
+        for (int axis = 1; axis < 3; axis++)
+        {
+            if (high[axis] - low[axis] > high[split] - low[split])
+            {
+                split = axis;
+            }
+        }
+
+        std::size_t const middle = begin + (end - begin) / 2;
+        double const* values = components[split];
+        std::nth_element(order.begin() + static_cast<std::ptrdiff_t>(begin),
+            order.begin() + static_cast<std::ptrdiff_t>(middle),
+            order.begin() + static_cast<std::ptrdiff_t>(end),
+            [values](std::size_t a, std::size_t b) { return values[a] < values[b]; });
+        this->axes[middle] = static_cast<unsigned char>(split);
+
+        build(order, components, begin, middle);
+        build(order, components, middle + 1, end);
+    }
+
+    // offers the point at position to the heap of the k nearest points
+    void offer(double const (&v)[3], std::size_t position, std::size_t k, heap_type& heap) const
+    {
+        double const dx = this->x[position] - v[0];
+        double const dy = this->y[position] - v[1];
+        double const dz = this->z[position] - v[2];
+        std::pair<double, std::size_t> const candidate(dx * dx + dy * dy + dz * dz,
+            this->indices[position]);
+        if (heap.size() < k)
+        {
+            heap.push_back(candidate);
+            std::push_heap(heap.begin(), heap.end());
+        }
+        else if (candidate < heap.front())
+        {
+            std::pop_heap(heap.begin(), heap.end());
+            heap.back() = candidate;
+            std::push_heap(heap.begin(), heap.end());
+        }
+    }
+
+    // nearest points of the subtree of the range [begin, end)
+    void search
+    (
+        double const (&v)[3],
+        std::size_t begin,
+        std::size_t end,
+        std::size_t k,
+        heap_type& heap
+    ) const
+    {
+        if (end - begin <= leaf_size)
+        {
+            for (std::size_t i = begin; i < end; i++)
+            {
+                offer(v, i, k, heap);
+            }
+            return;
+        }
+
+        std::size_t const middle = begin + (end - begin) / 2;
+        int const axis = this->axes[middle];
+        double const* values = axis == 0 ? this->x.data() : axis == 1 ? this->y.data() :
+            this->z.data();
+        double const difference = v[axis] - values[middle];
+
+        offer(v, middle, k, heap);
+        if (difference < 0)
+        {
+            search(v, begin, middle, k, heap);
+        }
+        else
+        {
+            search(v, middle + 1, end, k, heap);
+        }
+
+        //the other half can only hold nearer points if the splitting plane is nearer
+        if (heap.size() < k || difference * difference < heap.front().first)
+        {
+            if (difference < 0)
+            {
+                search(v, middle + 1, end, k, heap);
+            }
+            else
+            {
+                search(v, begin, middle, k, heap);
+            }
+        }
+    }
+
+    // stores the k nearest points of a unit vector sorted by separation into result
+    void search_vector
+    (
+        double const (&v)[3],
+        std::size_t k,
+        heap_type& heap,
+        neighbour* result
+    ) const
+    {
+        heap.clear();
+        if (k == 0)
+        {
+            return;
+        }
+        search(v, 0, this->size(), k, heap);
+        std::sort_heap(heap.begin(), heap.end());
+        for (std::size_t i = 0; i < heap.size(); i++)
+        {
+            result[i] = neighbour{heap[i].second,
+                2 * std::asin(std::min(1.0, std::sqrt(heap[i].first) / 2))};
+        }
+    }
+};
+
+}}} //namespace boost::astronomy::coordinate
+
+#endif // !BOOST_ASTRONOMY_COORDINATE_KD_TREE_HPP
@@ -0,0 +1,254 @@
+#ifndef BOOST_ASTRONOMY_COORDINATE_RAW_KERNEL_HPP
+#define BOOST_ASTRONOMY_COORDINATE_RAW_KERNEL_HPP
+
+#include <cstddef>
+#include <typeinfo>
+#include <algorithm>
+#include <type_traits>
+
+#include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/get_dimension.hpp>
+#include <boost/units/systems/si/plane_angle.hpp>
+
+#include <boost/astronomy/detail/is_base_template_of.hpp>
+#include <boost/astronomy/detail/unit_scale.hpp>
+#include <boost/astronomy/coordinate/base_representation_batch.hpp>
+#include <boost/astronomy/coordinate/cartesian_representation_batch.hpp>
+
+
+namespace boost { namespace astronomy { namespace coordinate {
+
+namespace bu = boost::units;
+namespace bg = boost::geometry;
+
+///@cond INTERNAL
+namespace detail_raw_kernel {
+
+// unit of the values stored in component Index of Batch, angles are stored in radian
+template <typename Batch, std::size_t Index,
+    bool Cartesian = std::is_same<typename Batch::system, bg::cs::cartesian>::value>
+struct stored_unit
+{
+    typedef typename std::conditional<Index == 2, typename Batch::quantity3::unit_type,
+        bu::si::plane_angle>::type type;
+};
+
+template <typename Batch>
+struct stored_unit<Batch, 0, true>
+{
+    typedef typename Batch::quantity1::unit_type type;
+};
+
+template <typename Batch>
+struct stored_unit<Batch, 1, true>
+{
+    typedef typename Batch::quantity2::unit_type type;
+};
+
+template <typename Batch>
+struct stored_unit<Batch, 2, true>
+{
+    typedef typename Batch::quantity3::unit_type type;
+};
+
+} //namespace detail_raw_kernel
+///@endcond
+
+
+//!Plain arrays of the three components of the points of a batch
+/*!
+raw_components are made from a batch by make_raw_components() or expect_units(),
+where the quantities are checked at compile time; kernels working on them only see
+arrays of T, so their loops carry no unit or quantity the compiler has to see
+through. Defining BOOST_ASTRONOMY_CHECK_RAW_KERNELS makes the components remember
+the units and the batch they come from: every kernel then asserts again that the
+batch has not been resized (which leaves the arrays dangling) and has_units()
+compares the recorded units. Without the macro the checks compile to nothing.
+*/
+template <typename T>
+struct raw_components
+{
+    T* component1 = nullptr; //! first component of every point
+    T* component2 = nullptr; //! second component of every point
+    T* component3 = nullptr; //! third component of every point
+    std::size_t count = 0; //! number of points
+
+#if defined(BOOST_ASTRONOMY_CHECK_RAW_KERNELS)
+    std::type_info const* units[3] = {nullptr, nullptr, nullptr};
+    void const* source = nullptr;
+    bool (*source_unchanged)(void const*, raw_components const&) = nullptr;
+#endif
+
+    std::size_t size() const
+    {
+        return this->count;
+    }
+
+    //!returns false if the batch the arrays come from has been resized since
+    //!always true unless BOOST_ASTRONOMY_CHECK_RAW_KERNELS is defined
+    bool valid() const
+    {
+#if defined(BOOST_ASTRONOMY_CHECK_RAW_KERNELS)
+        return this->source_unchanged == nullptr ||
+            this->source_unchanged(this->source, *this);
+#else
+        return true;
+#endif
+    }
+
+    //!returns false if the components are not stored in the given units
+    //!always true unless BOOST_ASTRONOMY_CHECK_RAW_KERNELS is defined
+    template <typename Unit1, typename Unit2 = Unit1, typename Unit3 = Unit2>
+    bool has_units() const
+    {
+#if defined(BOOST_ASTRONOMY_CHECK_RAW_KERNELS)
+        return this->units[0] != nullptr && *this->units[0] == typeid(Unit1) &&
+            *this->units[1] == typeid(Unit2) && *this->units[2] == typeid(Unit3);
+#else
+        return true;
+#endif
+    }
+};
+
+//!Returns the components of all the points of batch in the units they are stored in
+template <typename Batch>
+raw_components<typename std::conditional<std::is_const<Batch>::value,
+    typename Batch::type const, typename Batch::type>::type>
+make_raw_components(Batch& batch)
+{
+    typedef typename std::remove_const<Batch>::type batch_type;
+    typedef typename std::conditional<std::is_const<Batch>::value,
+        typename Batch::type const, typename Batch::type>::type value_type;
+    BOOST_STATIC_ASSERT_MSG((boost::astronomy::detail::is_base_frame_of
+        <boost::astronomy::coordinate::base_representation_batch, batch_type>::value),
+        "argument type is expected to be a batch representation class");
+
+    raw_components<value_type> components;
+    components.component1 = batch.template data<0>();
+    components.component2 = batch.template data<1>();
+    components.component3 = batch.template data<2>();
+    components.count = batch.size();
+
+#if defined(BOOST_ASTRONOMY_CHECK_RAW_KERNELS)
+    namespace drk = detail_raw_kernel;
+    components.units[0] = &typeid(typename drk::stored_unit<batch_type, 0>::type);
+    components.units[1] = &typeid(typename drk::stored_unit<batch_type, 1>::type);
+    components.units[2] = &typeid(typename drk::stored_unit<batch_type, 2>::type);
+    components.source = &batch;
+    components.source_unchanged = [](void const* source, raw_components<value_type> const& raw) {
+        batch_type const& points = *static_cast<batch_type const*>(source);
+        return points.size() == raw.count && points.template data<0>() == raw.component1 &&
+            points.template data<1>() == raw.component2 && points.template data<2>() == raw.component3;
+    };
+#endif
+    return components;
+}
+
+//!Returns the components of batch after checking at compile time that they are stored
+//!in Unit1, Unit2 and Unit3, so that kernels need no conversion factor
+template <typename Unit1, typename Unit2 = Unit1, typename Unit3 = Unit2, typename Batch>
+auto expect_units(Batch& batch)
+{
+    typedef typename std::remove_const<Batch>::type batch_type;
+    namespace drk = detail_raw_kernel;
+    BOOST_STATIC_ASSERT_MSG((std::is_same<typename bu::get_dimension<Unit1>::type,
+        typename bu::get_dimension<typename drk::stored_unit<batch_type, 0>::type>::type>::value &&
+        std::is_same<typename bu::get_dimension<Unit2>::type,
+        typename bu::get_dimension<typename drk::stored_unit<batch_type, 1>::type>::type>::value &&
+        std::is_same<typename bu::get_dimension<Unit3>::type,
+        typename bu::get_dimension<typename drk::stored_unit<batch_type, 2>::type>::type>::value),
+        "components of the batch have other dimensions");
+    BOOST_STATIC_ASSERT_MSG((std::is_same<Unit1, typename drk::stored_unit<batch_type, 0>::type>::value &&
+        std::is_same<Unit2, typename drk::stored_unit<batch_type, 1>::type>::value &&
+        std::is_same<Unit3, typename drk::stored_unit<batch_type, 2>::type>::value),
+        "components of the batch are stored in other units, convert the batch first");
+
+    return make_raw_components(batch);
+}
+
+
+//!Multiplies all the components of count points by factor
+template <typename T>
+void raw_scale(raw_components<T> const& points, T factor)
+{
+    BOOST_ASSERT_MSG(points.valid(), "batch of raw components has been resized");
+
+    T* __restrict x = points.component1;
+    T* __restrict y = points.component2;
+    T* __restrict z = points.component3;
+    for (std::size_t i = 0; i < points.count; i++)
+    {
+        x[i] *= factor;
+        y[i] *= factor;
+        z[i] *= factor;
+    }
+}
+
+//!Adds factor times the components of rates to the components of points
+//!the points updated are the first of both
+template <typename T, typename U>
+void raw_add_scaled(raw_components<T> const& points, raw_components<U> const& rates, T factor)
+{
+    BOOST_ASSERT_MSG(points.valid() && rates.valid(), "batch of raw components has been resized");
+
+    std::size_t const count = std::min(points.count, rates.count);
+    T* __restrict x = points.component1;
+    T* __restrict y = points.component2;
+    T* __restrict z = points.component3;
+    U const* __restrict rx = rates.component1;
+    U const* __restrict ry = rates.component2;
+    U const* __restrict rz = rates.component3;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        x[i] += factor * static_cast<T>(rx[i]);
+        y[i] += factor * static_cast<T>(ry[i]);
+        z[i] += factor * static_cast<T>(rz[i]);
+    }
+}
+
+
+//!Adds rates scaled by a quantity (velocities times a time, ...) to cartesian points in place
+/*!
+The dimensions of the points must be those of rates times scale, which is checked at
+compile time; the unit factors are folded with the value of scale into a single
+number and the points are then updated by raw_add_scaled().
+*/
+template
+<
+    typename CoordinateType,
+    typename Quantity,
+    typename RateType,
+    typename RateQuantity,
+    typename Scale
+>
+void add_scaled
+(
+    cartesian_representation_batch<CoordinateType, Quantity, Quantity, Quantity>& points,
+    cartesian_representation_batch<RateType, RateQuantity, RateQuantity, RateQuantity> const& rates,
+    Scale const& scale
+)
+{
+    typedef typename bu::multiply_typeof_helper<typename RateQuantity::unit_type,
+        typename Scale::unit_type>::type product_unit;
+    BOOST_STATIC_ASSERT_MSG((std::is_same<typename bu::get_dimension<product_unit>::type,
+        typename bu::get_dimension<Quantity>::type>::value),
+        "points must have the dimensions of rates times scale");
+
+    raw_components<CoordinateType> const raw_points = expect_units<typename Quantity::unit_type>(points);
+    raw_components<RateType const> const raw_rates =
+        expect_units<typename RateQuantity::unit_type>(rates);
+    BOOST_ASSERT_MSG((raw_points.template has_units<typename Quantity::unit_type>() &&
+        raw_rates.template has_units<typename RateQuantity::unit_type>()),
+        "raw components are not stored in the units of the quantities");
+
+    double const factor = static_cast<double>(scale.value()) * boost::astronomy::detail::unit_scale
+        <product_unit, typename Quantity::unit_type>::value();
+    raw_add_scaled(raw_points, raw_rates, static_cast<CoordinateType>(factor));
+}
+
+}}} //namespace boost::astronomy::coordinate
+
+#endif // !BOOST_ASTRONOMY_COORDINATE_RAW_KERNEL_HPP
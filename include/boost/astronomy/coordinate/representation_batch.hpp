@@ -0,0 +1,9 @@
+#ifndef BOOST_ASTRONOMY_COORDINATE_REPRESENTATION_BATCH_HPP
+#define BOOST_ASTRONOMY_COORDINATE_REPRESENTATION_BATCH_HPP
+
+#include <boost/astronomy/coordinate/batch_arithmetic.hpp>
+#include <boost/astronomy/coordinate/cartesian_representation_batch.hpp>
+#include <boost/astronomy/coordinate/spherical_equatorial_representation_batch.hpp>
+#include <boost/astronomy/coordinate/spherical_representation_batch.hpp>
+
+#endif // !BOOST_ASTRONOMY_COORDINATE_REPRESENTATION_BATCH_HPP
@@ -0,0 +1,282 @@
+#ifndef BOOST_ASTRONOMY_COORDINATE_SEPARATION_HPP
+#define BOOST_ASTRONOMY_COORDINATE_SEPARATION_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+
+#include <boost/static_assert.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/systems/si/plane_angle.hpp>
+
+#include <boost/astronomy/detail/is_base_template_of.hpp>
+#include <boost/astronomy/detail/precision.hpp>
+#include <boost/astronomy/detail/batch_conversion.hpp>
+#include <boost/astronomy/coordinate/base_representation.hpp>
+#include <boost/astronomy/coordinate/cartesian_representation.hpp>
+#include <boost/astronomy/coordinate/batch_arithmetic.hpp>
+#include <boost/astronomy/coordinate/spherical_equatorial_representation_batch.hpp>
+#include <boost/astronomy/coordinate/sky_point.hpp>
+
+
+namespace boost { namespace astronomy { namespace coordinate {
+
+namespace bu = boost::units;
+namespace bg = boost::geometry;
+
+///@cond INTERNAL
+namespace detail_separation {
+
+// result of separation() of two batches, empty for other arguments so that the
+// overload of sky_point collections is not hidden
+template
+<
+    typename Batch1,
+    typename Batch2,
+    bool Enable = detail_batch_arithmetic::is_batch<Batch1>::value &&
+        detail_batch_arithmetic::is_batch<Batch2>::value
+>
+struct separation_result {};
+
+template <typename Batch1, typename Batch2>
+struct separation_result<Batch1, Batch2, true>
+{
+    typedef std::vector<bu::quantity<bu::si::plane_angle,
+        typename detail_batch_arithmetic::common_type<Batch1, Batch2>::type>> type;
+};
+
+template <typename Batch>
+struct is_equatorial : std::is_same<typename Batch::system, bg::cs::spherical_equatorial<bg::radian>> {};
+
+// Vincenty formula for a block of longitude and latitude pairs, it stays accurate for
+// both nearly coincident and nearly antipodal points unlike the acos of the dot product
+template <typename Math, typename T, typename U, typename R>
+inline void block_separation
+(
+    std::size_t count,
+    T const* lon1, T const* lat1,
+    U const* lon2, U const* lat2,
+    R* result
+)
+{
+    typedef typename boost::astronomy::detail::precision_traits<R>::compute_type real;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        real sin_lat1, cos_lat1, sin_lat2, cos_lat2, sin_lon, cos_lon;
+        Math::sincos(static_cast<real>(lat1[i]), sin_lat1, cos_lat1);
+        Math::sincos(static_cast<real>(lat2[i]), sin_lat2, cos_lat2);
+        Math::sincos(static_cast<real>(lon2[i]) - static_cast<real>(lon1[i]), sin_lon, cos_lon);
+
+        real const a = cos_lat2 * sin_lon;
+        real const b = cos_lat1 * sin_lat2 - sin_lat1 * cos_lat2 * cos_lon;
+        result[i] = static_cast<R>(Math::atan2(std::sqrt(a * a + b * b),
+            sin_lat1 * sin_lat2 + cos_lat1 * cos_lat2 * cos_lon));
+    }
+}
+
+// angle between directions of cartesian vectors as atan2(|a x b|, a . b), the sums are
+// accumulated wide as they cancel for nearly parallel or orthogonal vectors
+template <typename Math, typename T, typename U, typename R>
+inline void block_separation
+(
+    std::size_t count,
+    T const* x1, T const* y1, T const* z1,
+    U const* x2, U const* y2, U const* z2,
+    R* result
+)
+{
+    typedef typename boost::astronomy::detail::precision_traits<R>::accumulate_type wide;
+    typedef typename boost::astronomy::detail::precision_traits<R>::compute_type real;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        wide const ax = static_cast<wide>(x1[i]), ay = static_cast<wide>(y1[i]),
+            az = static_cast<wide>(z1[i]);
+        wide const bx = static_cast<wide>(x2[i]), by = static_cast<wide>(y2[i]),
+            bz = static_cast<wide>(z2[i]);
+        wide const cx = ay * bz - az * by;
+        wide const cy = az * bx - ax * bz;
+        wide const cz = ax * by - ay * bx;
+        result[i] = static_cast<R>(Math::atan2(
+            static_cast<real>(std::sqrt(cx * cx + cy * cy + cz * cz)),
+            static_cast<real>(ax * bx + ay * by + az * bz)));
+    }
+}
+
+// both batches are spherical_equatorial, the angles are used directly
+template <typename Math, typename Batch1, typename Batch2, typename R>
+inline void batch_separation
+(
+    std::true_type,
+    Batch1 const& points1,
+    Batch2 const& points2,
+    std::size_t count,
+    R* result
+)
+{
+    block_separation<Math>(count, points1.template data<0>(), points1.template data<1>(),
+        points2.template data<0>(), points2.template data<1>(), result);
+}
+
+// any other pair of batches is compared as cartesian vectors a block at a time
+template <typename Math, typename Batch1, typename Batch2, typename R>
+inline void batch_separation
+(
+    std::false_type,
+    Batch1 const& points1,
+    Batch2 const& points2,
+    std::size_t count,
+    R* result
+)
+{
+    namespace dba = detail_batch_arithmetic;
+    dba::cartesian_block<Batch1> block1;
+    dba::cartesian_block<Batch2> block2;
+    for (std::size_t begin = 0; begin < count; begin += dba::block_size)
+    {
+        std::size_t const length = std::min(dba::block_size, count - begin);
+        block1.load(points1, begin, length);
+        block2.load(points2, begin, length);
+        block_separation<Math>(length, block1.x, block1.y, block1.z, block2.x, block2.y,
+            block2.z, result + begin);
+    }
+}
+
+// longitudes and latitudes in radian of a collection of sky_point
+template <typename CoordinateSystem>
+inline spherical_equatorial_representation_batch<double> sky_point_batch
+(
+    std::vector<sky_point<CoordinateSystem>> const& points
+)
+{
+    typedef bu::quantity<bu::si::plane_angle, double> radian_quantity;
+    spherical_equatorial_representation_batch<double> batch;
+    batch.reserve(points.size());
+    for (auto const& point : points)
+    {
+        auto const data = point.get_point().get_data();
+        batch.push_back(static_cast<radian_quantity>(data.get_lon()),
+            static_cast<radian_quantity>(data.get_lat()), bu::quantity<bu::si::dimensionless>(1.0));
+    }
+    return batch;
+}
+
+} //namespace detail_separation
+///@endcond
+
+
+//!Returns the angular separations of corresponding points of two batches of the same size
+/*!
+Pairs of spherical_equatorial batches are compared with the Vincenty formula on their
+angles, other batches are converted into cartesian vectors a block at a time and
+compared as atan2(|a x b|, a . b). Both forms are accurate for every separation,
+accuracy chooses the trigonometric functions. Only directions of the points are used.
+*/
+template
+<
+    template<typename ...> class Batch1,
+    template<typename ...> class Batch2,
+    typename ...Args1,
+    typename ...Args2
+>
+typename detail_separation::separation_result<Batch1<Args1...>, Batch2<Args2...>>::type separation
+(
+    Batch1<Args1...> const& points1,
+    Batch2<Args2...> const& points2,
+    conversion_accuracy accuracy = conversion_accuracy::exact
+)
+{
+    namespace dsp = detail_separation;
+    typedef typename detail_batch_arithmetic::common_type<Batch1<Args1...>, Batch2<Args2...>>::type
+        value_type;
+    typedef bu::quantity<bu::si::plane_angle, value_type> quantity_type;
+    typedef std::integral_constant<bool, dsp::is_equatorial<Batch1<Args1...>>::value &&
+        dsp::is_equatorial<Batch2<Args2...>>::value> equatorial;
+
+    std::size_t const count = std::min(points1.size(), points2.size());
+    std::vector<value_type> values(count);
+    boost::astronomy::detail::dispatch_accuracy(accuracy, [&](auto math) {
+        dsp::batch_separation<decltype(math)>(equatorial(), points1, points2, count, values.data());
+    });
+
+    std::vector<quantity_type> result(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        result[i] = quantity_type::from_value(values[i]);
+    }
+    return result;
+}
+
+
+//!Returns the angular separations between every point of a batch and a single representation
+template <template<typename ...> class Batch, typename ...Args, typename Representation>
+typename std::enable_if
+<
+    detail_batch_arithmetic::is_batch<Batch<Args...>>::value &&
+        boost::astronomy::detail::is_base_template_of
+        <boost::astronomy::coordinate::base_representation, Representation>::value,
+    std::vector<bu::quantity<bu::si::plane_angle, typename Batch<Args...>::type>>
+>::type separation
+(
+    Batch<Args...> const& points,
+    Representation const& point,
+    conversion_accuracy accuracy = conversion_accuracy::exact
+)
+{
+    typedef typename Batch<Args...>::type value_type;
+    typedef bu::quantity<bu::si::plane_angle, value_type> quantity_type;
+    typedef typename boost::astronomy::detail::precision_traits<value_type>::accumulate_type wide;
+    namespace dba = detail_batch_arithmetic;
+
+    auto const cartesian = make_cartesian_representation(point);
+    typedef typename decltype(cartesian)::quantity1 length_type;
+    wide const px = static_cast<wide>(cartesian.get_x().value());
+    wide const py = static_cast<wide>(static_cast<length_type>(cartesian.get_y()).value());
+    wide const pz = static_cast<wide>(static_cast<length_type>(cartesian.get_z()).value());
+
+    std::size_t const count = points.size();
+    std::vector<quantity_type> result(count);
+    value_type values[dba::block_size];
+    boost::astronomy::detail::dispatch_accuracy(accuracy, [&](auto math) {
+        typedef decltype(math) math_type;
+        dba::cartesian_block<Batch<Args...>> block;
+        wide target_x[dba::block_size], target_y[dba::block_size], target_z[dba::block_size];
+        std::fill(target_x, target_x + dba::block_size, px);
+        std::fill(target_y, target_y + dba::block_size, py);
+        std::fill(target_z, target_z + dba::block_size, pz);
+
+        for (std::size_t begin = 0; begin < count; begin += dba::block_size)
+        {
+            std::size_t const length = std::min(dba::block_size, count - begin);
+            block.load(points, begin, length);
+            detail_separation::block_separation<math_type>(length, block.x, block.y, block.z,
+                target_x, target_y, target_z, values);
+            for (std::size_t i = 0; i < length; i++)
+            {
+                result[begin + i] = quantity_type::from_value(values[i]);
+            }
+        }
+    });
+    return result;
+}
+
+
+//!Returns the angular separations of corresponding sky_point of two collections of the same size
+//!points are compared by their longitude and latitude in their own frame
+template <typename CoordinateSystem>
+std::vector<bu::quantity<bu::si::plane_angle>> separation
+(
+    std::vector<sky_point<CoordinateSystem>> const& points1,
+    std::vector<sky_point<CoordinateSystem>> const& points2,
+    conversion_accuracy accuracy = conversion_accuracy::exact
+)
+{
+    return separation(detail_separation::sky_point_batch(points1),
+        detail_separation::sky_point_batch(points2), accuracy);
+}
+
+}}} //namespace boost::astronomy::coordinate
+
+#endif // !BOOST_ASTRONOMY_COORDINATE_SEPARATION_HPP
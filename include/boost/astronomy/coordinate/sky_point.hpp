@@ -16,7 +16,10 @@ namespace boost { namespace astronomy { namespace coordinate {
 namespace bu = boost::units;
 namespace bg = boost::geometry;
 
-/*!sky_point is used to represent a point(coordinate) in the sky*/
+/*!sky_point is used to represent a point(coordinate) in the sky
+sky_point only holds its frame, when the frame is trivially copyable and standard layout
+(see boost::astronomy::detail::is_trivial_storage) so is the sky_point and arrays of them
+can be copied as bytes, memory mapped or sent between processes as they are*/
 template <typename CoordinateSystem>
 struct sky_point
 {
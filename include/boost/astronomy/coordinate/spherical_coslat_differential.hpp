@@ -102,10 +102,7 @@ public:
             LonQuantity,
             DistQuantity
         > const& other
-    )
-    {
-        this->diff = other.get_differential();
-    }
+    ) = default;
 
     // !constructs object from any type of differential
     template <typename Differential>
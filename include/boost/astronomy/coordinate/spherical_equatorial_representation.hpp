@@ -16,6 +16,7 @@
 #include <boost/units/systems/si/dimensionless.hpp>
 
 #include <boost/astronomy/detail/is_base_template_of.hpp>
+#include <boost/astronomy/detail/unit_scale.hpp>
 #include <boost/astronomy/coordinate/base_representation.hpp>
 #include <boost/astronomy/coordinate/cartesian_representation.hpp>
 
@@ -110,10 +111,7 @@ public:
             LonQuantity,
             DistQuantity
         > const& object
-    )
-    {
-        this->point = object.get_point();
-    }
+    ) = default;
 
     //!constructs object from any type of representation
     template <typename Representation>
@@ -136,21 +134,15 @@ public:
     //!returns the lat component of point
     LatQuantity get_lat() const
     {
-        return static_cast<LatQuantity>
-            (
-                bu::quantity<bu::si::plane_angle, CoordinateType>::from_value
-                    (bg::get<0>(this->point))
-            );
+        return boost::astronomy::detail::convert_quantity<LatQuantity>
+            (bu::quantity<bu::si::plane_angle, CoordinateType>::from_value(bg::get<0>(this->point)));
     }
 
     //!returns the lon component of point
     LonQuantity get_lon() const
     {
-        return static_cast<LonQuantity>
-            (
-                bu::quantity<bu::si::plane_angle, CoordinateType>::from_value
-                    (bg::get<1>(this->point))
-            );
+        return boost::astronomy::detail::convert_quantity<LonQuantity>
+            (bu::quantity<bu::si::plane_angle, CoordinateType>::from_value(bg::get<1>(this->point)));
     }
 
     //!returns the distance component of point
@@ -178,7 +170,8 @@ public:
         bg::set<0>
             (
             this->point,
-            static_cast<bu::quantity<bu::si::plane_angle, CoordinateType>>(lat).value()
+            boost::astronomy::detail::convert_quantity
+                <bu::quantity<bu::si::plane_angle, CoordinateType>>(lat).value()
             );
     }
 
@@ -188,7 +181,8 @@ public:
         bg::set<1>
             (
             this->point,
-            static_cast<bu::quantity<bu::si::plane_angle, CoordinateType>>(lon).value()
+            boost::astronomy::detail::convert_quantity
+                <bu::quantity<bu::si::plane_angle, CoordinateType>>(lon).value()
             );
     }
 
@@ -296,9 +290,9 @@ make_spherical_equatorial_representation
 )
 {
     return make_spherical_equatorial_representation(
-        static_cast<ReturnLatQuantity>(other.get_lat()),
-        static_cast<ReturnLonQuantity>(other.get_lon()),
-        static_cast<ReturnDistQuantity>(other.get_dist())
+        boost::astronomy::detail::convert_quantity<ReturnLatQuantity>(other.get_lat()),
+        boost::astronomy::detail::convert_quantity<ReturnLonQuantity>(other.get_lon()),
+        boost::astronomy::detail::convert_quantity<ReturnDistQuantity>(other.get_dist())
     );
 }
 
@@ -395,9 +389,9 @@ auto make_spherical_equatorial_representation
         > tempPoint;
 
     bg::set<0>(tempPoint, temp.get_x().value());
-    bg::set<1>(tempPoint, static_cast<typename cartesian_type::quantity1>
+    bg::set<1>(tempPoint, boost::astronomy::detail::convert_quantity<typename cartesian_type::quantity1>
         (temp.get_y()).value());
-    bg::set<2>(tempPoint, static_cast<typename cartesian_type::quantity1>
+    bg::set<2>(tempPoint, boost::astronomy::detail::convert_quantity<typename cartesian_type::quantity1>
         (temp.get_z()).value());
 
     bg::model::point<typename cartesian_type::type, 3, bg::cs::spherical_equatorial
@@ -0,0 +1,314 @@
+#ifndef BOOST_ASTRONOMY_COORDINATE_SPHERICAL_REPRESENTATION_BATCH_HPP
+#define BOOST_ASTRONOMY_COORDINATE_SPHERICAL_REPRESENTATION_BATCH_HPP
+
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+
+#include <boost/static_assert.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/get_dimension.hpp>
+#include <boost/units/physical_dimensions/plane_angle.hpp>
+#include <boost/units/systems/si/plane_angle.hpp>
+#include <boost/units/systems/si/dimensionless.hpp>
+
+#include <boost/astronomy/detail/is_base_template_of.hpp>
+#include <boost/astronomy/detail/batch_conversion.hpp>
+#include <boost/astronomy/coordinate/base_representation_batch.hpp>
+#include <boost/astronomy/coordinate/cartesian_representation_batch.hpp>
+#include <boost/astronomy/coordinate/spherical_representation.hpp>
+
+
+namespace boost { namespace astronomy { namespace coordinate {
+
+namespace bu = boost::units;
+namespace bg = boost::geometry;
+
+//!Stores many points in spherical representation as contiguous lat, lon and distance arrays
+//!Every point of the batch uses the same quantities like spherical_representation,
+//!angles are stored in radian
+template
+<
+    typename CoordinateType = double,
+    typename LatQuantity = bu::quantity<bu::si::plane_angle, CoordinateType>,
+    typename LonQuantity = bu::quantity<bu::si::plane_angle, CoordinateType>,
+    typename DistQuantity = bu::quantity<bu::si::dimensionless, CoordinateType>
+>
+struct spherical_representation_batch : public base_representation_batch
+    <bg::cs::spherical<radian>, CoordinateType>
+{
+    ///@cond INTERNAL
+    BOOST_STATIC_ASSERT_MSG(
+        ((std::is_same<typename bu::get_dimension<LatQuantity>::type,
+            bu::plane_angle_dimension>::value) &&
+            (std::is_same<typename bu::get_dimension<LonQuantity>::type,
+            bu::plane_angle_dimension>::value)),
+        "Latitude and Longitude must be of plane angle type");
+    BOOST_STATIC_ASSERT_MSG((std::is_floating_point<CoordinateType>::value),
+        "CoordinateType must be a floating-point type");
+    ///@endcond
+
+    typedef bu::quantity<bu::si::plane_angle, CoordinateType> radian_quantity;
+
+public:
+    typedef LatQuantity quantity1;
+    typedef LonQuantity quantity2;
+    typedef DistQuantity quantity3;
+    typedef spherical_representation<CoordinateType, LatQuantity, LonQuantity, DistQuantity>
+        value_type;
+
+    spherical_representation_batch() {}
+
+    //!creates batch of count points with all the components 0
+    explicit spherical_representation_batch(std::size_t count)
+    {
+        this->resize(count);
+    }
+
+    //!creates batch from the points of single representations
+    explicit spherical_representation_batch(std::vector<value_type> const& points)
+    {
+        this->reserve(points.size());
+        for (auto const& point : points)
+        {
+            this->push_back(point);
+        }
+    }
+
+    //!converts points of any batch representation, quantities have to be specified explicitly
+    template <typename Representation>
+    spherical_representation_batch
+    (
+        Representation const& other,
+        conversion_accuracy accuracy = conversion_accuracy::exact
+    )
+    {
+        BOOST_STATIC_ASSERT_MSG((boost::astronomy::detail::is_base_frame_of
+            <boost::astronomy::coordinate::base_representation_batch, Representation>::value),
+            "No constructor found with given argument type");
+
+        this->assign_representation(other, accuracy);
+    }
+
+    //!appends a point
+    void push_back(LatQuantity const& lat, LonQuantity const& lon, DistQuantity const& distance)
+    {
+        this->component1.push_back(
+            boost::astronomy::detail::convert_quantity<radian_quantity>(lat).value());
+        this->component2.push_back(
+            boost::astronomy::detail::convert_quantity<radian_quantity>(lon).value());
+        this->component3.push_back(distance.value());
+    }
+
+    //!appends a point
+    void push_back(value_type const& point)
+    {
+        this->component1.push_back(bg::get<0>(point.get_point()));
+        this->component2.push_back(bg::get<1>(point.get_point()));
+        this->component3.push_back(bg::get<2>(point.get_point()));
+    }
+
+    //!returns the point at given index
+    value_type operator[](std::size_t index) const
+    {
+        return value_type(this->get_point(index));
+    }
+
+    //!sets the point at given index
+    void set(std::size_t index, value_type const& point)
+    {
+        this->set_point(index, point.get_point());
+    }
+
+    void set_lat_lon_dist
+    (
+        std::size_t index,
+        LatQuantity const& lat,
+        LonQuantity const& lon,
+        DistQuantity const& distance
+    )
+    {
+        this->component1[index] =
+            boost::astronomy::detail::convert_quantity<radian_quantity>(lat).value();
+        this->component2[index] =
+            boost::astronomy::detail::convert_quantity<radian_quantity>(lon).value();
+        this->component3[index] = distance.value();
+    }
+
+    LatQuantity get_lat(std::size_t index) const
+    {
+        return boost::astronomy::detail::convert_quantity<LatQuantity>
+            (radian_quantity::from_value(this->component1[index]));
+    }
+
+    LonQuantity get_lon(std::size_t index) const
+    {
+        return boost::astronomy::detail::convert_quantity<LonQuantity>
+            (radian_quantity::from_value(this->component2[index]));
+    }
+
+    DistQuantity get_dist(std::size_t index) const
+    {
+        return DistQuantity::from_value(this->component3[index]);
+    }
+
+    //!returns the lat of all the points in radian
+    CoordinateType* lat_data()
+    {
+        return this->component1.data();
+    }
+
+    CoordinateType const* lat_data() const
+    {
+        return this->component1.data();
+    }
+
+    //!returns the lon of all the points in radian
+    CoordinateType* lon_data()
+    {
+        return this->component2.data();
+    }
+
+    CoordinateType const* lon_data() const
+    {
+        return this->component2.data();
+    }
+
+    //!returns the distance of all the points in the unit of DistQuantity
+    CoordinateType* dist_data()
+    {
+        return this->component3.data();
+    }
+
+    CoordinateType const* dist_data() const
+    {
+        return this->component3.data();
+    }
+}; //spherical_representation_batch
+
+
+//!Convert quantities of all the points to new quantities
+//!angles are stored in radian so only the distances are scaled,
+//!same quantities select the copy overload
+template
+<
+    typename ReturnCoordinateType,
+    typename ReturnLatQuantity,
+    typename ReturnLonQuantity,
+    typename ReturnDistQuantity,
+    typename CoordinateType,
+    typename LatQuantity,
+    typename LonQuantity,
+    typename DistQuantity,
+    typename = typename std::enable_if<!std::is_same
+    <
+        spherical_representation_batch<ReturnCoordinateType, ReturnLatQuantity, ReturnLonQuantity, ReturnDistQuantity>,
+        spherical_representation_batch<CoordinateType, LatQuantity, LonQuantity, DistQuantity>
+    >::value>::type
+>
+spherical_representation_batch
+<
+    ReturnCoordinateType,
+    ReturnLatQuantity,
+    ReturnLonQuantity,
+    ReturnDistQuantity
+>
+make_spherical_representation_batch
+(
+    spherical_representation_batch<CoordinateType, LatQuantity, LonQuantity, DistQuantity> const& other
+)
+{
+    spherical_representation_batch
+    <
+        ReturnCoordinateType,
+        ReturnLatQuantity,
+        ReturnLonQuantity,
+        ReturnDistQuantity
+    > result(other.size());
+
+    namespace bad = boost::astronomy::detail;
+    std::copy(other.lat_data(), other.lat_data() + other.size(), result.lat_data());
+    std::copy(other.lon_data(), other.lon_data() + other.size(), result.lon_data());
+    bad::batch_scale(other.size(), other.dist_data(), static_cast<ReturnCoordinateType>
+        (bad::quantity_factor<ReturnDistQuantity, DistQuantity>()), result.dist_data());
+    return result;
+}
+
+//!Create copy of spherical_representation_batch
+template
+<
+    typename CoordinateType,
+    typename LatQuantity,
+    typename LonQuantity,
+    typename DistQuantity
+>
+spherical_representation_batch<CoordinateType, LatQuantity, LonQuantity, DistQuantity>
+make_spherical_representation_batch
+(
+    spherical_representation_batch<CoordinateType, LatQuantity, LonQuantity, DistQuantity> const& other
+)
+{
+    return other;
+}
+
+//!Create spherical_representation_batch from cartesian_representation_batch
+//!y and z are converted to the quantity of x which becomes the quantity of distance
+template
+<
+    typename CoordinateType,
+    typename XQuantity,
+    typename YQuantity,
+    typename ZQuantity
+>
+spherical_representation_batch
+<
+    CoordinateType,
+    bu::quantity<bu::si::plane_angle, CoordinateType>,
+    bu::quantity<bu::si::plane_angle, CoordinateType>,
+    XQuantity
+>
+make_spherical_representation_batch
+(
+    cartesian_representation_batch<CoordinateType, XQuantity, YQuantity, ZQuantity> const& other,
+    conversion_accuracy accuracy = conversion_accuracy::exact
+)
+{
+    return spherical_representation_batch
+        <
+            CoordinateType,
+            bu::quantity<bu::si::plane_angle, CoordinateType>,
+            bu::quantity<bu::si::plane_angle, CoordinateType>,
+            XQuantity
+        >(make_cartesian_representation_batch<CoordinateType, XQuantity, XQuantity, XQuantity>(other),
+            accuracy);
+}
+
+//!Create spherical_representation_batch from other type of batch representations
+template <typename OtherRepresentation>
+spherical_representation_batch
+<
+    typename OtherRepresentation::type,
+    bu::quantity<bu::si::plane_angle, typename OtherRepresentation::type>,
+    bu::quantity<bu::si::plane_angle, typename OtherRepresentation::type>,
+    typename OtherRepresentation::quantity3
+>
+make_spherical_representation_batch
+(
+    OtherRepresentation const& other,
+    conversion_accuracy accuracy = conversion_accuracy::exact
+)
+{
+    return spherical_representation_batch
+        <
+            typename OtherRepresentation::type,
+            bu::quantity<bu::si::plane_angle, typename OtherRepresentation::type>,
+            bu::quantity<bu::si::plane_angle, typename OtherRepresentation::type>,
+            typename OtherRepresentation::quantity3
+        >(other, accuracy);
+}
+
+}}} //namespace boost::astronomy::coordinate
+
+#endif // !BOOST_ASTRONOMY_COORDINATE_SPHERICAL_REPRESENTATION_BATCH_HPP
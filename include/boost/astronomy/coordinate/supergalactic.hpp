@@ -27,6 +27,12 @@ public:
     //default constructor no initialization
     supergalactic() {}
 
+    //!constructs object from representation of the frame type, the data is copied as it is
+    supergalactic(Representation const& representation_data)
+    {
+        this->data = representation_data;
+    }
+
     //!creates coordinate in supergalactic frame using any subclass of base_representation
     template <typename OtherRepresentation>
     supergalactic(OtherRepresentation const& representation_data)
@@ -78,6 +84,18 @@ public:
         this->motion.set_dlat_dlon_coslat_ddist(pm_sgb, pm_sgl_cossgb, radial_velocity);
     }
 
+    //!constructs object from representation and differential of the frame types,
+    //!both are copied as they are without any conversion
+    supergalactic
+    (
+        Representation const& representation_data,
+        Differential const& differential_data
+    )
+    {
+        this->data = representation_data;
+        this->motion = differential_data;
+    }
+
     //!creates coordinate with motion
     //!representation class is used for coordinate data
     //!differential class is used for motion data
@@ -124,11 +142,7 @@ public:
     }
 
     //copy constructor
-    supergalactic(supergalactic<Representation, Differential> const& other)
-    {
-        this->data = other.get_data();
-        this->motion = other.get_differential();
-    }
+    supergalactic(supergalactic<Representation, Differential> const& other) = default;
 
     //!returns component sgb of the supergalactic coordinate
     typename Representation::quantity1 get_sgb() const
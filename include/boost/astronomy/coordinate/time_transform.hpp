@@ -0,0 +1,418 @@
+#ifndef BOOST_ASTRONOMY_COORDINATE_TIME_TRANSFORM_HPP
+#define BOOST_ASTRONOMY_COORDINATE_TIME_TRANSFORM_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <algorithm>
+
+#include <boost/static_assert.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/systems/si/plane_angle.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <boost/astronomy/detail/lru_cache.hpp>
+#include <boost/astronomy/detail/precision.hpp>
+#include <boost/astronomy/detail/is_base_template_of.hpp>
+#include <boost/astronomy/detail/batch_conversion.hpp>
+#include <boost/astronomy/coordinate/base_representation_batch.hpp>
+#include <boost/astronomy/coordinate/frame_transform.hpp>
+#include <boost/astronomy/coordinate/earth_orientation.hpp>
+
+
+namespace boost { namespace astronomy { namespace coordinate {
+
+namespace bu = boost::units;
+
+//!Geodetic position and weather of an observatory
+struct observing_site
+{
+    double longitude = 0; //! east longitude (radian)
+    double latitude = 0; //! geodetic latitude (radian)
+    double pressure = 0; //! atmospheric pressure (Pa), 0 disables refraction
+    double temperature = 0; //! temperature (celsius)
+    double relative_humidity = 0; //! relative humidity (0 to 1)
+
+    //!returns the site and weather stored in the parameters of an alt_az frame
+    template <typename AltAzFrame>
+    static observing_site of(AltAzFrame const& frame)
+    {
+        typedef bu::quantity<bu::si::plane_angle, double> radian_quantity;
+        auto const location = frame.get_location();
+
+        observing_site site;
+        site.latitude = static_cast<radian_quantity>(location.get_lat()).value();
+        site.longitude = static_cast<radian_quantity>(location.get_lon()).value();
+        site.pressure = frame.get_pressure().value();
+        site.temperature = frame.get_temprature().value();
+        site.relative_humidity = frame.get_relative_humidity().value();
+        return site;
+    }
+
+    friend bool operator==(observing_site const& lhs, observing_site const& rhs)
+    {
+        return same(lhs.longitude, rhs.longitude) && same(lhs.latitude, rhs.latitude) &&
+            same(lhs.pressure, rhs.pressure) && same(lhs.temperature, rhs.temperature) &&
+            same(lhs.relative_humidity, rhs.relative_humidity);
+    }
+
+protected:
+    static bool same(double lhs, double rhs)
+    {
+        return !(lhs < rhs) && !(rhs < lhs);
+    }
+};
+
+//!Everything needed to turn ICRS directions into observed alt_az at one epoch and site
+struct observing_context
+{
+    std::shared_ptr<earth_orientation const> orientation; //! orientation of the earth at the epoch
+    rotation_matrix gcrs_to_horizon{}; //! rows point to north, east and zenith
+    refraction_constants refraction; //! refraction for the weather of the site
+
+    //!computes the context of site from the orientation of the earth, polar motion is neglected
+    static observing_context at
+    (
+        std::shared_ptr<earth_orientation const> const& orientation,
+        observing_site const& site
+    )
+    {
+        double const sin_lat = std::sin(site.latitude);
+        double const cos_lat = std::cos(site.latitude);
+        rotation_matrix const local{{{-sin_lat, 0, cos_lat}, {0, 1, 0}, {cos_lat, 0, sin_lat}}};
+
+        observing_context context;
+        context.orientation = orientation;
+        context.gcrs_to_horizon = multiply(local, multiply(
+            rotation_about_z(orientation->era + site.longitude), orientation->gcrs_to_cirs));
+        context.refraction = refraction_constants::from_weather(site.pressure, site.temperature,
+            site.relative_humidity);
+        return context;
+    }
+};
+
+//!Least recently used cache of the time dependent terms of the cirs and alt_az transforms
+/*!
+The orientation of the earth (precession-nutation matrix, earth rotation angle,
+sidereal time, aberration) is cached per observation time and the horizon matrix
+and refraction constants per observation time and site. Transforming any number
+of sources of an exposure therefore computes these terms once, the sources
+only pay for a matrix product. The cache may be shared between threads.
+*/
+struct time_transform_cache
+{
+protected:
+    ///@cond INTERNAL
+    struct observing_key
+    {
+        boost::posix_time::ptime time;
+        observing_site site;
+
+        friend bool operator==(observing_key const& lhs, observing_key const& rhs)
+        {
+            return lhs.time == rhs.time && lhs.site == rhs.site;
+        }
+    };
+    ///@endcond
+
+    double dut1 = 0; //! UT1 - UTC (second)
+    boost::astronomy::detail::lru_cache<boost::posix_time::ptime, earth_orientation> orientations;
+    boost::astronomy::detail::lru_cache<observing_key, observing_context> contexts;
+
+public:
+    //!creates cache keeping capacity epochs and capacity (epoch, site) pairs
+    //!dut1 (UT1 - UTC in seconds) is used for all the epochs
+    explicit time_transform_cache(std::size_t capacity = 16, double ut1_minus_utc = 0) :
+        dut1(ut1_minus_utc), orientations(capacity), contexts(capacity) {}
+
+    //!returns the orientation of the earth at UTC time
+    std::shared_ptr<earth_orientation const> orientation(boost::posix_time::ptime const& time)
+    {
+        double const ut1_minus_utc = this->dut1;
+        return this->orientations.get(time, [ut1_minus_utc](boost::posix_time::ptime const& utc) {
+            return earth_orientation::at(observation_epoch::from_utc(utc, ut1_minus_utc));
+        });
+    }
+
+    //!returns the observing context of site at UTC time
+    std::shared_ptr<observing_context const> observing
+    (
+        boost::posix_time::ptime const& time,
+        observing_site const& site
+    )
+    {
+        return this->contexts.get(observing_key{time, site}, [this](observing_key const& key) {
+            return observing_context::at(this->orientation(key.time), key.site);
+        });
+    }
+
+    //!returns the observing context of the site and time stored in an alt_az frame
+    template <typename AltAzFrame>
+    std::shared_ptr<observing_context const> observing(AltAzFrame const& frame)
+    {
+        return this->observing(frame.get_obs_time(), observing_site::of(frame));
+    }
+
+    //!returns the number of lookups served from the cache
+    std::size_t hits() const
+    {
+        return this->orientations.hits() + this->contexts.hits();
+    }
+
+    //!returns the number of lookups which had to compute their terms
+    std::size_t misses() const
+    {
+        return this->orientations.misses() + this->contexts.misses();
+    }
+
+    //!removes all the cached terms
+    void clear()
+    {
+        this->orientations.clear();
+        this->contexts.clear();
+    }
+};
+
+///@cond INTERNAL
+namespace detail_time_transform {
+
+// moves unit vectors toward the apex of the motion of the observer (first order in v / c)
+template <typename T>
+inline void batch_aberrate
+(
+    double const (&velocity)[3],
+    std::size_t count,
+    T* x, T* y, T* z
+)
+{
+    typedef typename boost::astronomy::detail::precision_traits<T>::compute_type real;
+    real const vx = static_cast<real>(velocity[0]);
+    real const vy = static_cast<real>(velocity[1]);
+    real const vz = static_cast<real>(velocity[2]);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        real const xi = static_cast<real>(x[i]) + vx;
+        real const yi = static_cast<real>(y[i]) + vy;
+        real const zi = static_cast<real>(z[i]) + vz;
+        real const scale = 1 / std::sqrt(xi * xi + yi * yi + zi * zi);
+        x[i] = static_cast<T>(xi * scale);
+        y[i] = static_cast<T>(yi * scale);
+        z[i] = static_cast<T>(zi * scale);
+    }
+}
+
+// raises unit (north, east, up) vectors by the refraction, the zenith distance is
+// clamped below an altitude of about 3 degrees where the model is no longer valid
+template <typename T>
+inline void batch_refract
+(
+    refraction_constants const& refraction,
+    std::size_t count,
+    T* north, T* east, T* up
+)
+{
+    if (!(refraction.a > 0))
+    {
+        return;
+    }
+
+    typedef typename boost::astronomy::detail::precision_traits<T>::compute_type real;
+    real const a = static_cast<real>(refraction.a);
+    real const b = static_cast<real>(refraction.b);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        real const n = static_cast<real>(north[i]);
+        real const e = static_cast<real>(east[i]);
+        real const u = static_cast<real>(up[i]);
+        real const rho = std::sqrt(n * n + e * e);
+        if (!(rho > 0))
+        {
+            continue;
+        }
+
+        real const tan_z = rho / std::max(u, static_cast<real>(0.05));
+        real const shift = (a + b * tan_z * tan_z) * tan_z;
+        real const c = std::cos(shift);
+        real const s = std::sin(shift);
+        real const scale = (rho * c - u * s) / rho;
+        north[i] = static_cast<T>(n * scale);
+        east[i] = static_cast<T>(e * scale);
+        up[i] = static_cast<T>(u * c + rho * s);
+    }
+}
+
+// unit vector of the astronomical latitude and longitude of a frame
+template <typename Frame>
+inline void frame_direction(Frame const& coordinate, double (&v)[3])
+{
+    typedef bu::quantity<bu::si::plane_angle, double> radian_quantity;
+    auto const data = coordinate.get_data();
+    double const lat = static_cast<radian_quantity>(data.get_lat()).value();
+    double const lon = static_cast<radian_quantity>(data.get_lon()).value();
+    v[0] = std::cos(lat) * std::cos(lon);
+    v[1] = std::cos(lat) * std::sin(lon);
+    v[2] = std::sin(lat);
+}
+
+// latitude and longitude in [0, 2 pi) of a vector
+inline void direction_angles(double const (&v)[3], double& lat, double& lon)
+{
+    double const two_pi = 6.28318530717958647693;
+    lon = std::atan2(v[1], v[0]);
+    lon = lon < 0 ? lon + two_pi : lon;
+    lat = std::atan2(v[2], std::sqrt(v[0] * v[0] + v[1] * v[1]));
+}
+
+// converts a batch to unit vectors, applies f(count, x, y, z) and converts back a block at a time
+template <typename Batch, typename Function>
+inline Batch transform_directions(Batch const& points, conversion_accuracy accuracy, Function f)
+{
+    BOOST_STATIC_ASSERT_MSG((boost::astronomy::detail::is_base_frame_of
+        <boost::astronomy::coordinate::base_representation_batch, Batch>::value),
+        "argument type is expected to be a batch representation class");
+
+    typedef typename Batch::type coordinate_type;
+    typedef typename Batch::system system;
+    namespace bad = boost::astronomy::detail;
+
+    Batch result(points.size());
+    bad::dispatch_accuracy(accuracy, [&](auto math) {
+        typedef decltype(math) math_type;
+        std::size_t const block = 256;
+        coordinate_type x[block], y[block], z[block], r[block];
+        std::fill(r, r + block, coordinate_type(1));
+
+        for (std::size_t begin = 0; begin < points.size(); begin += block)
+        {
+            std::size_t const length = std::min(block, points.size() - begin);
+            bad::batch_to_cartesian<math_type>(system(), length, points.template data<0>() + begin,
+                points.template data<1>() + begin, r, x, y, z);
+            f(length, x, y, z);
+            bad::batch_from_cartesian<math_type>(system(), length, x, y, z,
+                result.template data<0>() + begin, result.template data<1>() + begin, r);
+            std::copy(points.template data<2>() + begin, points.template data<2>() + begin + length,
+                result.template data<2>() + begin);
+        }
+    });
+    return result;
+}
+
+} //namespace detail_time_transform
+///@endcond
+
+//!Converts an ICRS coordinate into the apparent place in CirsFrame at UTC obs_time
+//!annual aberration is applied, parallax and light deflection are neglected
+template <typename CirsFrame, typename IcrsFrame>
+CirsFrame transform_to_cirs
+(
+    IcrsFrame const& coordinate,
+    boost::posix_time::ptime const& obs_time,
+    time_transform_cache& cache
+)
+{
+    typedef bu::quantity<bu::si::plane_angle, double> radian_quantity;
+    typedef typename CirsFrame::representation to_representation;
+    namespace dtt = detail_time_transform;
+
+    std::shared_ptr<earth_orientation const> const orientation = cache.orientation(obs_time);
+    double v[3];
+    dtt::frame_direction(coordinate, v);
+    dtt::batch_aberrate(orientation->earth_velocity, 1, v, v + 1, v + 2);
+    boost::astronomy::detail::batch_rotate(orientation->gcrs_to_cirs.m, 1, v, v + 1, v + 2,
+        v, v + 1, v + 2);
+
+    double lat, lon;
+    dtt::direction_angles(v, lat, lon);
+    CirsFrame result(
+        static_cast<typename to_representation::quantity1>(radian_quantity::from_value(lat)),
+        static_cast<typename to_representation::quantity2>(radian_quantity::from_value(lon)),
+        static_cast<typename to_representation::quantity3>(coordinate.get_data().get_dist()));
+    result.set_obs_time(obs_time);
+    return result;
+}
+
+//!Converts an ICRS coordinate into the observed alt_az at the site, time and weather of parameters
+//!the returned frame is a copy of parameters with altitude, azimuth (east of north) and distance set
+template <typename AltAzFrame, typename IcrsFrame>
+AltAzFrame transform_to_alt_az
+(
+    IcrsFrame const& coordinate,
+    AltAzFrame const& parameters,
+    time_transform_cache& cache
+)
+{
+    typedef bu::quantity<bu::si::plane_angle, double> radian_quantity;
+    typedef typename AltAzFrame::representation to_representation;
+    namespace dtt = detail_time_transform;
+
+    std::shared_ptr<observing_context const> const context = cache.observing(parameters);
+    double v[3];
+    dtt::frame_direction(coordinate, v);
+    dtt::batch_aberrate(context->orientation->earth_velocity, 1, v, v + 1, v + 2);
+    boost::astronomy::detail::batch_rotate(context->gcrs_to_horizon.m, 1, v, v + 1, v + 2,
+        v, v + 1, v + 2);
+    dtt::batch_refract(context->refraction, 1, v, v + 1, v + 2);
+
+    double alt, az;
+    dtt::direction_angles(v, alt, az);
+    AltAzFrame result(parameters);
+    result.set_alt_az_dist(
+        static_cast<typename to_representation::quantity1>(radian_quantity::from_value(alt)),
+        static_cast<typename to_representation::quantity2>(radian_quantity::from_value(az)),
+        static_cast<typename to_representation::quantity3>(coordinate.get_data().get_dist()));
+    return result;
+}
+
+//!Converts a batch of ICRS directions into CIRS apparent places at UTC obs_time
+/*!
+Points use the geometry convention of the coordinate system of the batch, for a
+spherical_equatorial batch right ascension is component 0 and declination component 1,
+as in transform_batch(). Distances are copied unchanged.
+*/
+template <typename Batch>
+Batch transform_batch_to_cirs
+(
+    Batch const& points,
+    boost::posix_time::ptime const& obs_time,
+    time_transform_cache& cache,
+    conversion_accuracy accuracy = conversion_accuracy::exact
+)
+{
+    std::shared_ptr<earth_orientation const> const orientation = cache.orientation(obs_time);
+    return detail_time_transform::transform_directions(points, accuracy,
+        [&orientation](std::size_t count, auto* x, auto* y, auto* z) {
+            detail_time_transform::batch_aberrate(orientation->earth_velocity, count, x, y, z);
+            boost::astronomy::detail::batch_rotate(orientation->gcrs_to_cirs.m, count,
+                x, y, z, x, y, z);
+        });
+}
+
+//!Converts a batch of ICRS directions into observed horizontal directions of site at UTC obs_time
+/*!
+For a spherical_equatorial batch azimuth (east of north) is returned as component 0 and
+altitude as component 1, azimuths are in (-pi, pi]. Distances are copied unchanged.
+*/
+template <typename Batch>
+Batch transform_batch_to_alt_az
+(
+    Batch const& points,
+    boost::posix_time::ptime const& obs_time,
+    observing_site const& site,
+    time_transform_cache& cache,
+    conversion_accuracy accuracy = conversion_accuracy::exact
+)
+{
+    std::shared_ptr<observing_context const> const context = cache.observing(obs_time, site);
+    return detail_time_transform::transform_directions(points, accuracy,
+        [&context](std::size_t count, auto* x, auto* y, auto* z) {
+            detail_time_transform::batch_aberrate(context->orientation->earth_velocity,
+                count, x, y, z);
+            boost::astronomy::detail::batch_rotate(context->gcrs_to_horizon.m, count,
+                x, y, z, x, y, z);
+            detail_time_transform::batch_refract(context->refraction, count, x, y, z);
+        });
+}
+
+}}} //namespace boost::astronomy::coordinate
+
+#endif // !BOOST_ASTRONOMY_COORDINATE_TIME_TRANSFORM_HPP
@@ -0,0 +1,659 @@
+#ifndef BOOST_ASTRONOMY_COORDINATE_WCS_HPP
+#define BOOST_ASTRONOMY_COORDINATE_WCS_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <type_traits>
+
+#include <boost/static_assert.hpp>
+#include <boost/geometry/core/cs.hpp>
+
+#include <boost/astronomy/exception/fits_exception.hpp>
+#include <boost/astronomy/detail/batch_conversion.hpp>
+#include <boost/astronomy/detail/batch_execution.hpp>
+#include <boost/astronomy/coordinate/base_representation_batch.hpp>
+
+
+namespace boost { namespace astronomy { namespace coordinate {
+
+namespace bg = boost::geometry;
+
+///@cond INTERNAL
+namespace detail_wcs {
+
+std::size_t const block_size = 256;
+double const pi = 3.141592653589793238462643383279502884;
+double const degree = pi / 180;
+
+} // namespace detail_wcs
+///@endcond
+
+//!zenithal projections of the FITS world coordinate system (Calabretta and Greisen 2002)
+enum class wcs_projection
+{
+    tan, //! gnomonic
+    sin, //! orthographic, without the slant parameters PV2_1 and PV2_2
+    zea //! zenithal equal area
+};
+
+//!Polynomial of the SIP distortion convention, sum of c[p][q] * u^p * v^q for p + q <= order
+struct sip_polynomial
+{
+    std::size_t order = 0;
+    std::vector<double> coefficients; //! c[p][q] stored at p * (order + 1) + q
+
+    sip_polynomial() {}
+
+    //!creates polynomial of given order with all the coefficients 0
+    explicit sip_polynomial(std::size_t polynomial_order)
+        : order(polynomial_order),
+          coefficients((polynomial_order + 1) * (polynomial_order + 1), 0.0) {}
+
+    //!returns false for the polynomial without any coefficient
+    bool empty() const
+    {
+        return this->coefficients.empty();
+    }
+
+    //!returns the coefficient of u^p * v^q
+    double& operator()(std::size_t p, std::size_t q)
+    {
+        return this->coefficients[p * (this->order + 1) + q];
+    }
+
+    double operator()(std::size_t p, std::size_t q) const
+    {
+        return this->coefficients[p * (this->order + 1) + q];
+    }
+
+    //!evaluates the polynomial with the Horner scheme in both variables
+    double evaluate(double u, double v) const
+    {
+        double result = 0;
+        for (std::size_t p = this->order + 1; p-- > 0;)
+        {
+            double row = 0;
+            for (std::size_t q = this->order - p + 1; q-- > 0;)
+            {
+                row = row * v + (*this)(p, q);
+            }
+            result = result * u + row;
+        }
+        return result;
+    }
+};
+
+//!SIP distortion applied to the pixel offsets from CRPIX before the CD matrix
+/*!
+a and b distort the offsets (u, v) into u + a(u, v), v + b(u, v). The inverse
+polynomials ap and bp are optional, sky to pixel transforms start from them when they
+are given and refine the offsets by fixed point iteration of a and b in any case.
+*/
+struct sip_distortion
+{
+    sip_polynomial a;
+    sip_polynomial b;
+    sip_polynomial ap;
+    sip_polynomial bp;
+
+    //!returns true when no forward polynomial is given
+    bool empty() const
+    {
+        return this->a.empty() && this->b.empty();
+    }
+};
+
+//!Compiled celestial WCS of a 2D image mapping pixels to longitude and latitude
+/*!
+The keywords are parsed once, the transforms then run over arrays by blocks with
+only multiplications, square roots and one atan2 per angle, so whole pixel grids and
+detection lists convert at the rate of the batch conversions.
+
+Pixel coordinates are zero based: column is the index along NAXIS1 (y of
+image_buffer) and row the index along NAXIS2 (x of image_buffer), the centre of the
+first pixel is (0, 0) which is (1, 1) in the FITS convention used by CRPIX. World
+coordinates are the longitude and latitude of the celestial axes (ra and dec, or the
+galactic l and b...) in radian; the frame (RADESYS, EQUINOX) is left to the caller.
+
+Only the celestial axes 1 and 2 are supported with the longitude on axis 1, headers
+describing anything else throw invalid_wcs_exception.
+*/
+class wcs_transform
+{
+public:
+    //!creates TAN projection of (0, 0) on the first pixel with one degree per pixel
+    wcs_transform()
+    {
+        this->compile(std::numeric_limits<double>::quiet_NaN());
+    }
+
+    /*!
+    crpix are the 1 based FITS reference pixel, crval the world coordinates of the
+    reference pixel in degree and cd the CDi_j matrix in degree per pixel. lonpole is
+    LONPOLE in degree, NaN uses the FITS default (180, or 0 for crval2 at 90).
+    */
+    wcs_transform
+    (
+        wcs_projection projection_type,
+        double crpix1, double crpix2,
+        double crval1, double crval2,
+        double cd1_1, double cd1_2,
+        double cd2_1, double cd2_2,
+        sip_distortion const& distortion = sip_distortion(),
+        double lonpole = std::numeric_limits<double>::quiet_NaN()
+    ) : projection_(projection_type), sip_(distortion)
+    {
+        this->crpix_[0] = crpix1;
+        this->crpix_[1] = crpix2;
+        this->crval_[0] = crval1 * detail_wcs::degree;
+        this->crval_[1] = crval2 * detail_wcs::degree;
+        this->cd_[0] = cd1_1 * detail_wcs::degree;
+        this->cd_[1] = cd1_2 * detail_wcs::degree;
+        this->cd_[2] = cd2_1 * detail_wcs::degree;
+        this->cd_[3] = cd2_2 * detail_wcs::degree;
+        this->compile(lonpole);
+    }
+
+    //!parses the WCS keywords of header (hdu or any type with has_key and value_of)
+    /*!
+    The linear part is taken from CDi_j when any of them is present, else from CDELTi
+    times PCi_j (identity by default), else from CDELTi and the legacy CROTA2. SIP
+    coefficients are read when both CTYPE end with -SIP.
+    */
+    template <typename Header>
+    static wcs_transform from_header(Header const& header)
+    {
+        std::string const ctype1 = header_string(header, "CTYPE1");
+        std::string const ctype2 = header_string(header, "CTYPE2");
+        if (ctype1.size() < 8 || ctype2.size() < 8 || ctype1[4] != '-' || ctype2[4] != '-' ||
+            !is_longitude(ctype1.substr(0, 4)) || is_longitude(ctype2.substr(0, 4)) ||
+            ctype1.compare(5, std::string::npos, ctype2, 5, std::string::npos) != 0)
+        {
+            throw invalid_wcs_exception();
+        }
+
+        wcs_projection projection_type;
+        std::string const code = ctype1.substr(5, 3);
+        if (code == "TAN")
+        {
+            projection_type = wcs_projection::tan;
+        }
+        else if (code == "SIN")
+        {
+            projection_type = wcs_projection::sin;
+        }
+        else if (code == "ZEA")
+        {
+            projection_type = wcs_projection::zea;
+        }
+        else
+        {
+            throw invalid_wcs_exception();
+        }
+
+        sip_distortion distortion;
+        if (ctype1.size() > 8)
+        {
+            if (ctype1.substr(8) != "-SIP")
+            {
+                throw invalid_wcs_exception();
+            }
+            distortion.a = read_sip(header, "A");
+            distortion.b = read_sip(header, "B");
+            distortion.ap = read_sip(header, "AP");
+            distortion.bp = read_sip(header, "BP");
+            if (distortion.a.empty() || distortion.b.empty())
+            {
+                throw invalid_wcs_exception();
+            }
+        }
+
+        double cd[4] = {1, 0, 0, 1};
+        if (header.has_key("CD1_1") || header.has_key("CD1_2") ||
+            header.has_key("CD2_1") || header.has_key("CD2_2"))
+        {
+            cd[0] = header_value(header, "CD1_1", 0);
+            cd[1] = header_value(header, "CD1_2", 0);
+            cd[2] = header_value(header, "CD2_1", 0);
+            cd[3] = header_value(header, "CD2_2", 0);
+        }
+        else
+        {
+            double const cdelt1 = header_value(header, "CDELT1", 1);
+            double const cdelt2 = header_value(header, "CDELT2", 1);
+            double pc[4] = {1, 0, 0, 1};
+            if (header.has_key("PC1_1") || header.has_key("PC1_2") ||
+                header.has_key("PC2_1") || header.has_key("PC2_2"))
+            {
+                pc[0] = header_value(header, "PC1_1", 1);
+                pc[1] = header_value(header, "PC1_2", 0);
+                pc[2] = header_value(header, "PC2_1", 0);
+                pc[3] = header_value(header, "PC2_2", 1);
+            }
+            else if (header.has_key("CROTA2"))
+            {
+                double const rotation =
+                    header.template value_of<double>("CROTA2") * detail_wcs::degree;
+                double const ratio = cdelt2 / cdelt1;
+                pc[0] = std::cos(rotation);
+                pc[1] = -std::sin(rotation) * ratio;
+                pc[2] = std::sin(rotation) / ratio;
+                pc[3] = std::cos(rotation);
+            }
+            cd[0] = cdelt1 * pc[0];
+            cd[1] = cdelt1 * pc[1];
+            cd[2] = cdelt2 * pc[2];
+            cd[3] = cdelt2 * pc[3];
+        }
+
+        return wcs_transform(projection_type,
+            header_value(header, "CRPIX1", 0), header_value(header, "CRPIX2", 0),
+            header_value(header, "CRVAL1", 0), header_value(header, "CRVAL2", 0),
+            cd[0], cd[1], cd[2], cd[3], distortion,
+            header_value(header, "LONPOLE", std::numeric_limits<double>::quiet_NaN()));
+    }
+
+    //!returns the projection
+    wcs_projection projection() const
+    {
+        return this->projection_;
+    }
+
+    //!returns the SIP distortion, empty when the header has none
+    sip_distortion const& distortion() const
+    {
+        return this->sip_;
+    }
+
+    //!returns the world coordinates of the reference pixel in radian
+    double reference_longitude() const
+    {
+        return this->crval_[0];
+    }
+
+    double reference_latitude() const
+    {
+        return this->crval_[1];
+    }
+
+    //!Transforms count pixels into longitude and latitude in radian
+    //!points outside of the projection (beyond the horizon of SIN or ZEA) give NaN
+    template <typename T, typename R>
+    void pixel_to_sky
+    (
+        std::size_t count,
+        T const* column, T const* row,
+        R* lon, R* lat,
+        conversion_accuracy accuracy = conversion_accuracy::exact
+    ) const
+    {
+        boost::astronomy::detail::dispatch_accuracy(accuracy, [&](auto math) {
+            typedef decltype(math) math_type;
+            double u[detail_wcs::block_size], v[detail_wcs::block_size];
+            for (std::size_t begin = 0; begin < count; begin += detail_wcs::block_size)
+            {
+                std::size_t const length = std::min(detail_wcs::block_size, count - begin);
+                for (std::size_t i = 0; i < length; i++)
+                {
+                    u[i] = static_cast<double>(column[begin + i]) + 1 - this->crpix_[0];
+                    v[i] = static_cast<double>(row[begin + i]) + 1 - this->crpix_[1];
+                }
+                this->offsets_to_sky<math_type>(length, u, v, lon + begin, lat + begin);
+            }
+        });
+    }
+
+    //!Transforms count longitudes and latitudes in radian into pixels
+    //!points without projection (behind the tangent plane of TAN...) give NaN
+    template <typename T, typename R>
+    void sky_to_pixel
+    (
+        std::size_t count,
+        T const* lon, T const* lat,
+        R* column, R* row,
+        conversion_accuracy accuracy = conversion_accuracy::exact
+    ) const
+    {
+        boost::astronomy::detail::dispatch_accuracy(accuracy, [&](auto math) {
+            typedef decltype(math) math_type;
+            double u[detail_wcs::block_size], v[detail_wcs::block_size];
+            for (std::size_t begin = 0; begin < count; begin += detail_wcs::block_size)
+            {
+                std::size_t const length = std::min(detail_wcs::block_size, count - begin);
+                this->sky_to_offsets<math_type>(length, lon + begin, lat + begin, u, v);
+                for (std::size_t i = 0; i < length; i++)
+                {
+                    column[begin + i] = static_cast<R>(u[i] + this->crpix_[0] - 1);
+                    row[begin + i] = static_cast<R>(v[i] + this->crpix_[1] - 1);
+                }
+            }
+        });
+    }
+
+    //!Returns a spherical_equatorial batch of the count pixels with distance 1
+    //!the pixels are split across threads as given by execution
+    template <typename Batch, typename T>
+    Batch pixel_to_sky
+    (
+        std::size_t count,
+        T const* column, T const* row,
+        conversion_accuracy accuracy = conversion_accuracy::exact,
+        batch_execution const& execution = batch_execution()
+    ) const
+    {
+        assert_equatorial<Batch>();
+        Batch points(count);
+        boost::astronomy::detail::parallel_ranges(count, execution,
+            [&](std::size_t begin, std::size_t length) {
+                this->pixel_to_sky(length, column + begin, row + begin,
+                    points.template data<0>() + begin, points.template data<1>() + begin, accuracy);
+            });
+        std::fill(points.template data<2>(), points.template data<2>() + count,
+            static_cast<typename Batch::type>(1));
+        return points;
+    }
+
+    //!Returns a spherical_equatorial batch of every pixel of a width x height image
+    //!points are in the order of image_buffer, pixel (x, y) is point x * width + y
+    template <typename Batch>
+    Batch pixel_grid_to_sky
+    (
+        std::size_t width,
+        std::size_t height,
+        conversion_accuracy accuracy = conversion_accuracy::exact,
+        batch_execution const& execution = batch_execution()
+    ) const
+    {
+        assert_equatorial<Batch>();
+        std::size_t const count = width * height;
+        Batch points(count);
+        boost::astronomy::detail::parallel_ranges(count, execution,
+            [&](std::size_t begin, std::size_t length) {
+                std::size_t const block = detail_wcs::block_size;
+                double column[detail_wcs::block_size], row[detail_wcs::block_size];
+                for (std::size_t first = begin; first < begin + length; first += block)
+                {
+                    std::size_t const size = std::min(block, begin + length - first);
+                    for (std::size_t i = 0; i < size; i++)
+                    {
+                        column[i] = static_cast<double>((first + i) % width);
+                        row[i] = static_cast<double>((first + i) / width);
+                    }
+                    this->pixel_to_sky(size, column, row, points.template data<0>() + first,
+                        points.template data<1>() + first, accuracy);
+                }
+            });
+        std::fill(points.template data<2>(), points.template data<2>() + count,
+            static_cast<typename Batch::type>(1));
+        return points;
+    }
+
+    //!Transforms the points of a spherical_equatorial batch into pixels,
+    //!the distances are ignored and the points are split across threads as given by execution
+    template <typename Batch, typename R>
+    void sky_to_pixel
+    (
+        Batch const& points,
+        R* column, R* row,
+        conversion_accuracy accuracy = conversion_accuracy::exact,
+        batch_execution const& execution = batch_execution()
+    ) const
+    {
+        assert_equatorial<Batch>();
+        boost::astronomy::detail::parallel_ranges(points.size(), execution,
+            [&](std::size_t begin, std::size_t length) {
+                this->sky_to_pixel(length, points.template data<0>() + begin,
+                    points.template data<1>() + begin, column + begin, row + begin, accuracy);
+            });
+    }
+
+private:
+    wcs_projection projection_ = wcs_projection::tan;
+    sip_distortion sip_;
+    double crpix_[2] = {0, 0};
+    double crval_[2] = {0, 0};
+    double cd_[4] = {detail_wcs::degree, 0, 0, detail_wcs::degree}; // radian per pixel
+    double inverse_cd_[4] = {}; // pixel per radian
+    double sin_lonpole_ = 0;
+    double cos_lonpole_ = -1;
+    double sin_dec_ = 0;
+    double cos_dec_ = 1;
+
+    void compile(double lonpole)
+    {
+        if (std::isnan(lonpole))
+        {
+            lonpole = this->crval_[1] < detail_wcs::pi / 2 ? 180 : 0;
+        }
+        this->sin_lonpole_ = std::sin(lonpole * detail_wcs::degree);
+        this->cos_lonpole_ = std::cos(lonpole * detail_wcs::degree);
+        this->sin_dec_ = std::sin(this->crval_[1]);
+        this->cos_dec_ = std::cos(this->crval_[1]);
+
+        double const determinant = this->cd_[0] * this->cd_[3] - this->cd_[1] * this->cd_[2];
+        this->inverse_cd_[0] = this->cd_[3] / determinant;
+        this->inverse_cd_[1] = -this->cd_[1] / determinant;
+        this->inverse_cd_[2] = -this->cd_[2] / determinant;
+        this->inverse_cd_[3] = this->cd_[0] / determinant;
+    }
+
+    // pixel offsets from CRPIX into world coordinates
+    // with the native coordinates (phi, theta) of the projected point (x, y) and
+    // k = cos(theta) / R, the point on the native sphere is k * x, k * y, sin(theta) which
+    // is rotated to the celestial sphere, no trigonometric function is needed before the
+    // final atan2 of the celestial longitude and latitude
+    template <typename Math, typename R>
+    void offsets_to_sky(std::size_t count, double* u, double* v, R* lon, R* lat) const
+    {
+        if (!this->sip_.empty())
+        {
+            for (std::size_t i = 0; i < count; i++)
+            {
+                double const du = this->sip_.a.evaluate(u[i], v[i]);
+                double const dv = this->sip_.b.evaluate(u[i], v[i]);
+                u[i] += du;
+                v[i] += dv;
+            }
+        }
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            double const x = this->cd_[0] * u[i] + this->cd_[1] * v[i];
+            double const y = this->cd_[2] * u[i] + this->cd_[3] * v[i];
+            double const r2 = x * x + y * y;
+
+            double k, sin_theta;
+            switch (this->projection_)
+            {
+            case wcs_projection::sin:
+                k = 1;
+                sin_theta = std::sqrt(1 - r2);
+                break;
+            case wcs_projection::zea:
+                k = std::sqrt(1 - r2 / 4);
+                sin_theta = 1 - r2 / 2;
+                break;
+            default:
+                k = 1 / std::sqrt(1 + r2);
+                sin_theta = k;
+                break;
+            }
+            if (!(r2 <= this->max_radius2()))
+            {
+                k = std::numeric_limits<double>::quiet_NaN();
+            }
+
+            // cos(theta) times sine and cosine of phi - phi_p
+            double const a = k * (x * this->cos_lonpole_ + y * this->sin_lonpole_);
+            double const b = k * (x * this->sin_lonpole_ - y * this->cos_lonpole_);
+
+            double const cx = sin_theta * this->cos_dec_ - b * this->sin_dec_;
+            double const cy = -a;
+            double const cz = sin_theta * this->sin_dec_ + b * this->cos_dec_;
+
+            double longitude = this->crval_[0] + Math::atan2(cy, cx);
+            longitude = longitude < 0 ? longitude + 2 * detail_wcs::pi :
+                (longitude < 2 * detail_wcs::pi ? longitude : longitude - 2 * detail_wcs::pi);
+            lon[i] = static_cast<R>(longitude);
+            lat[i] = static_cast<R>(Math::atan2(cz, std::sqrt(cx * cx + cy * cy)));
+        }
+    }
+
+    // world coordinates into pixel offsets from CRPIX, inverse of offsets_to_sky
+    template <typename Math, typename T>
+    void sky_to_offsets(std::size_t count, T const* lon, T const* lat, double* u, double* v) const
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            double sin_lat, cos_lat, sin_lon, cos_lon;
+            Math::sincos(static_cast<double>(lat[i]), sin_lat, cos_lat);
+            Math::sincos(static_cast<double>(lon[i]) - this->crval_[0], sin_lon, cos_lon);
+
+            // celestial point with x towards the reference longitude, rotated to native
+            double const cx = cos_lat * cos_lon;
+            double const cz = sin_lat;
+
+            double const sin_theta = cx * this->cos_dec_ + cz * this->sin_dec_;
+            double const a = -cos_lat * sin_lon;
+            double const b = cz * this->cos_dec_ - cx * this->sin_dec_;
+
+            double k;
+            switch (this->projection_)
+            {
+            case wcs_projection::sin:
+                k = sin_theta < 0 ? std::numeric_limits<double>::quiet_NaN() : 1;
+                break;
+            case wcs_projection::zea:
+                k = std::sqrt((1 + sin_theta) / 2);
+                break;
+            default:
+                k = sin_theta > 0 ? sin_theta : std::numeric_limits<double>::quiet_NaN();
+                break;
+            }
+
+            double const x = (a * this->cos_lonpole_ + b * this->sin_lonpole_) / k;
+            double const y = (a * this->sin_lonpole_ - b * this->cos_lonpole_) / k;
+            u[i] = this->inverse_cd_[0] * x + this->inverse_cd_[1] * y;
+            v[i] = this->inverse_cd_[2] * x + this->inverse_cd_[3] * y;
+        }
+
+        if (!this->sip_.empty())
+        {
+            for (std::size_t i = 0; i < count; i++)
+            {
+                this->undistort(u[i], v[i]);
+            }
+        }
+    }
+
+    // largest squared radius of the projection plane reached by the sphere
+    double max_radius2() const
+    {
+        switch (this->projection_)
+        {
+        case wcs_projection::sin:
+            return 1;
+        case wcs_projection::zea:
+            return 4;
+        default:
+            return std::numeric_limits<double>::infinity();
+        }
+    }
+
+    // finds (u, v) with u + a(u, v) = distorted u and v + b(u, v) = distorted v
+    void undistort(double& u, double& v) const
+    {
+        double const target_u = u;
+        double const target_v = v;
+        if (!this->sip_.ap.empty() && !this->sip_.bp.empty())
+        {
+            u = target_u + this->sip_.ap.evaluate(target_u, target_v);
+            v = target_v + this->sip_.bp.evaluate(target_u, target_v);
+        }
+        for (int iteration = 0; iteration < 50; iteration++)
+        {
+            double const next_u = target_u - this->sip_.a.evaluate(u, v);
+            double const next_v = target_v - this->sip_.b.evaluate(u, v);
+            double const change = std::abs(next_u - u) + std::abs(next_v - v);
+            u = next_u;
+            v = next_v;
+            if (!(change > 1e-12))
+            {
+                break;
+            }
+        }
+    }
+
+    template <typename Batch>
+    static void assert_equatorial()
+    {
+        BOOST_STATIC_ASSERT_MSG((std::is_same<typename Batch::system,
+            bg::cs::spherical_equatorial<bg::radian>>::value),
+            "sky points are expected to be a spherical_equatorial batch");
+    }
+
+    static bool is_longitude(std::string const& axis)
+    {
+        return axis == "RA--" || axis.compare(1, 3, "LON") == 0;
+    }
+
+    // value of a string keyword without the quotes and the padding spaces
+    template <typename Header>
+    static std::string header_string(Header const& header, std::string const& key)
+    {
+        if (!header.has_key(key))
+        {
+            throw invalid_wcs_exception();
+        }
+        std::string value = header.template value_of<std::string>(key);
+        std::size_t const first = value.find_first_not_of("' ");
+        std::size_t const last = value.find_last_not_of("' ");
+        return first == std::string::npos ? std::string() : value.substr(first, last - first + 1);
+    }
+
+    template <typename Header>
+    static double header_value(Header const& header, std::string const& key, double fallback)
+    {
+        return header.has_key(key) ? header.template value_of<double>(key) : fallback;
+    }
+
+    // coefficients Name_p_q of the polynomial of order Name_ORDER, empty without the order
+    template <typename Header>
+    static sip_polynomial read_sip(Header const& header, std::string const& name)
+    {
+        if (!header.has_key(name + "_ORDER"))
+        {
+            return sip_polynomial();
+        }
+        int const order = header.template value_of<int>(name + "_ORDER");
+        if (order < 0 || order > 9)
+        {
+            throw invalid_wcs_exception();
+        }
+        sip_polynomial polynomial(static_cast<std::size_t>(order));
+        for (std::size_t p = 0; p <= polynomial.order; p++)
+        {
+            for (std::size_t q = 0; p + q <= polynomial.order; q++)
+            {
+                polynomial(p, q) = header_value(header,
+                    name + "_" + std::to_string(p) + "_" + std::to_string(q), 0);
+            }
+        }
+        return polynomial;
+    }
+};
+
+//!Returns the compiled WCS of the header of an image HDU
+template <typename Header>
+inline wcs_transform make_wcs(Header const& header)
+{
+    return wcs_transform::from_header(header);
+}
+
+}}} //namespace boost::astronomy::coordinate
+
+#endif // !BOOST_ASTRONOMY_COORDINATE_WCS_HPP
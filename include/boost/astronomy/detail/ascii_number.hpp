@@ -0,0 +1,239 @@
+#ifndef BOOST_ASTRONOMY_DETAIL_ASCII_NUMBER_HPP
+#define BOOST_ASTRONOMY_DETAIL_ASCII_NUMBER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <limits>
+#include <type_traits>
+
+namespace boost { namespace astronomy { namespace detail {
+
+///@cond INTERNAL
+// trims the blanks around a fixed width field, returns false if only blanks are left
+inline bool trim_field(char const*& begin, char const*& end)
+{
+    while (begin != end && *begin == ' ')
+    {
+        ++begin;
+    }
+    while (end != begin && *(end - 1) == ' ')
+    {
+        --end;
+    }
+    return begin != end;
+}
+
+// parses an integer field (TFORM Iw), blank fields are 0
+// returns false if the field is not a number or does not fit in T
+template <typename T>
+inline bool parse_ascii_integer(char const* begin, char const* end, T& value)
+{
+    static_assert(std::is_integral<T>::value, "integer fields are stored in integral types");
+    if (!trim_field(begin, end))
+    {
+        value = 0;
+        return true;
+    }
+
+    bool negative = false;
+    if (*begin == '+' || *begin == '-')
+    {
+        negative = *begin == '-';
+        if (++begin == end)
+        {
+            return false;
+        }
+    }
+
+    //accumulating the magnitude as unsigned so that the minimum value is accepted
+    std::uint64_t limit = static_cast<std::uint64_t>(std::numeric_limits<T>::max());
+    if (negative)
+    {
+        limit = std::is_signed<T>::value ? limit + 1 : 0;
+    }
+
+    std::uint64_t magnitude = 0;
+    for (; begin != end; ++begin)
+    {
+        unsigned const digit = static_cast<unsigned>(*begin - '0');
+        if (digit > 9 || magnitude > limit / 10 || magnitude * 10 + digit > limit)
+        {
+            return false;
+        }
+        magnitude = magnitude * 10 + digit;
+    }
+
+    if (negative && magnitude != 0)
+    {
+        value = static_cast<T>(-static_cast<std::int64_t>(magnitude - 1) - 1);
+    }
+    else
+    {
+        value = static_cast<T>(magnitude);
+    }
+    return true;
+}
+
+// powers of ten which are exactly representable as double
+inline double exact_power_of_ten(int exponent)
+{
+    static double const powers[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    return powers[exponent];
+}
+
+// parses a real field (TFORM Fw.d, Ew.d or Dw.d), blank fields are NaN
+// a field without decimal point has an implied one decimals digits from the right
+// values with atmost 15 significant digits and a small exponent are converted exactly with
+// one multiplication or division (Clinger's fast path), others are handed to strtod
+// returns false if the field is not a number
+inline bool parse_ascii_real(char const* begin, char const* end, std::size_t decimals, double& value)
+{
+    if (!trim_field(begin, end))
+    {
+        value = std::numeric_limits<double>::quiet_NaN();
+        return true;
+    }
+
+    bool negative = false;
+    if (*begin == '+' || *begin == '-')
+    {
+        negative = *begin == '-';
+        ++begin;
+    }
+
+    //significant digits without leading zeros, used if the fast path does not apply
+    char digits[40];
+    std::size_t digit_count = 0;
+    std::size_t total_digits = 0; //digits including the ones not stored
+    std::uint64_t mantissa = 0;
+    int exponent = 0;
+    bool point = false;
+    bool any_digit = false;
+
+    for (; begin != end; ++begin)
+    {
+        char const c = *begin;
+        if (c >= '0' && c <= '9')
+        {
+            any_digit = true;
+            if (digit_count == 0 && c == '0')
+            {
+                //leading zeros only move the decimal point
+                if (point)
+                {
+                    exponent--;
+                }
+                continue;
+            }
+
+            if (digit_count < sizeof(digits))
+            {
+                digits[digit_count++] = c;
+                if (digit_count <= 19)
+                {
+                    mantissa = mantissa * 10 + static_cast<unsigned>(c - '0');
+                }
+            }
+            else if (!point)
+            {
+                exponent++; //dropped digit before the decimal point
+            }
+            total_digits++;
+            if (point && total_digits <= sizeof(digits))
+            {
+                exponent--;
+            }
+        }
+        else if (c == '.' && !point)
+        {
+            point = true;
+        }
+        else
+        {
+            break;
+        }
+    }
+    if (!any_digit)
+    {
+        return false;
+    }
+
+    if (begin != end)
+    {
+        if (*begin != 'E' && *begin != 'e' && *begin != 'D' && *begin != 'd')
+        {
+            return false;
+        }
+        if (++begin == end)
+        {
+            return false;
+        }
+
+        bool negative_exponent = false;
+        if (*begin == '+' || *begin == '-')
+        {
+            negative_exponent = *begin == '-';
+            if (++begin == end)
+            {
+                return false;
+            }
+        }
+
+        int written = 0;
+        for (; begin != end; ++begin)
+        {
+            unsigned const digit = static_cast<unsigned>(*begin - '0');
+            if (digit > 9)
+            {
+                return false;
+            }
+            if (written < 100000)
+            {
+                written = written * 10 + static_cast<int>(digit);
+            }
+        }
+        exponent += negative_exponent ? -written : written;
+    }
+
+    if (!point)
+    {
+        exponent -= static_cast<int>(decimals);
+    }
+
+    if (digit_count == 0)
+    {
+        value = negative ? -0.0 : 0.0;
+        return true;
+    }
+
+    if (digit_count <= 15 && exponent >= -22 && exponent <= 22)
+    {
+        double const significand = static_cast<double>(mantissa);
+        value = exponent >= 0 ? significand * exact_power_of_ten(exponent) :
+            significand / exact_power_of_ten(-exponent);
+        value = negative ? -value : value;
+        return true;
+    }
+
+    //slow path: digits and exponent are written without a decimal point for strtod
+    char text[64];
+    std::size_t length = 0;
+    text[length++] = negative ? '-' : '+';
+    for (std::size_t i = 0; i < digit_count; i++)
+    {
+        text[length++] = digits[i];
+    }
+    std::snprintf(text + length, sizeof(text) - length, "e%d", exponent);
+    value = std::strtod(text, nullptr);
+    return true;
+}
+///@endcond
+
+}}} //namespace boost::astronomy::detail
+
+#endif // !BOOST_ASTRONOMY_DETAIL_ASCII_NUMBER_HPP
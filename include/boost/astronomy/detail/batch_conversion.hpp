@@ -0,0 +1,264 @@
+#ifndef BOOST_ASTRONOMY_DETAIL_BATCH_CONVERSION_HPP
+#define BOOST_ASTRONOMY_DETAIL_BATCH_CONVERSION_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+
+#include <boost/geometry/core/cs.hpp>
+
+#include <boost/astronomy/coordinate/conversion_accuracy.hpp>
+#include <boost/astronomy/detail/precision.hpp>
+#include <boost/astronomy/detail/polynomial_trigonometry.hpp>
+#include <boost/astronomy/detail/unit_scale.hpp>
+
+namespace boost { namespace astronomy { namespace detail {
+
+///@cond INTERNAL
+// kernels converting arrays of components between coordinate systems
+// angles are in radian and follow the conventions of boost::geometry transform:
+// spherical (phi, theta, r) with theta measured from z axis and
+// spherical_equatorial (lambda, delta, r) with delta measured from xy plane
+// Math is one of the structs of polynomial_trigonometry.hpp
+// values are computed in precision_traits<T>::compute_type, float arrays stay in float
+
+// calls f with the Math struct implementing given accuracy
+template <typename Function>
+inline void dispatch_accuracy(coordinate::conversion_accuracy accuracy, Function&& f)
+{
+    switch (accuracy)
+    {
+    case coordinate::conversion_accuracy::fast:
+        f(polynomial_trigonometry());
+        break;
+    case coordinate::conversion_accuracy::coarse:
+        f(coarse_polynomial_trigonometry());
+        break;
+    default:
+        f(libm_trigonometry());
+        break;
+    }
+}
+
+template <typename Math = libm_trigonometry, typename T>
+inline void batch_to_cartesian
+(
+    boost::geometry::cs::cartesian,
+    std::size_t count,
+    T const* c1, T const* c2, T const* c3,
+    T* x, T* y, T* z
+)
+{
+    std::copy(c1, c1 + count, x);
+    std::copy(c2, c2 + count, y);
+    std::copy(c3, c3 + count, z);
+}
+
+template <typename Math = libm_trigonometry, typename T>
+inline void batch_to_cartesian
+(
+    boost::geometry::cs::spherical<boost::geometry::radian>,
+    std::size_t count,
+    T const* phi, T const* theta, T const* r,
+    T* x, T* y, T* z
+)
+{
+    typedef typename precision_traits<T>::compute_type real;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        real sin_phi, cos_phi, sin_theta, cos_theta;
+        Math::sincos(static_cast<real>(phi[i]), sin_phi, cos_phi);
+        Math::sincos(static_cast<real>(theta[i]), sin_theta, cos_theta);
+        real const r_sin_theta = static_cast<real>(r[i]) * sin_theta;
+        x[i] = static_cast<T>(r_sin_theta * cos_phi);
+        y[i] = static_cast<T>(r_sin_theta * sin_phi);
+        z[i] = static_cast<T>(static_cast<real>(r[i]) * cos_theta);
+    }
+}
+
+template <typename Math = libm_trigonometry, typename T>
+inline void batch_to_cartesian
+(
+    boost::geometry::cs::spherical_equatorial<boost::geometry::radian>,
+    std::size_t count,
+    T const* lambda, T const* delta, T const* r,
+    T* x, T* y, T* z
+)
+{
+    typedef typename precision_traits<T>::compute_type real;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        real sin_lambda, cos_lambda, sin_delta, cos_delta;
+        Math::sincos(static_cast<real>(lambda[i]), sin_lambda, cos_lambda);
+        Math::sincos(static_cast<real>(delta[i]), sin_delta, cos_delta);
+        real const r_cos_delta = static_cast<real>(r[i]) * cos_delta;
+        x[i] = static_cast<T>(r_cos_delta * cos_lambda);
+        y[i] = static_cast<T>(r_cos_delta * sin_lambda);
+        z[i] = static_cast<T>(static_cast<real>(r[i]) * sin_delta);
+    }
+}
+
+template <typename Math = libm_trigonometry, typename T>
+inline void batch_from_cartesian
+(
+    boost::geometry::cs::cartesian,
+    std::size_t count,
+    T const* x, T const* y, T const* z,
+    T* c1, T* c2, T* c3
+)
+{
+    std::copy(x, x + count, c1);
+    std::copy(y, y + count, c2);
+    std::copy(z, z + count, c3);
+}
+
+// angles are computed with atan2 which is accurate near the poles,
+// the polar angle of the origin is 0
+// (std::sqrt keeps the loop scalar unless errno is not set, e.g. -fno-math-errno)
+template <typename Math = libm_trigonometry, typename T>
+inline void batch_from_cartesian
+(
+    boost::geometry::cs::spherical<boost::geometry::radian>,
+    std::size_t count,
+    T const* x, T const* y, T const* z,
+    T* phi, T* theta, T* r
+)
+{
+    typedef typename precision_traits<T>::compute_type real;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        real const xi = static_cast<real>(x[i]);
+        real const yi = static_cast<real>(y[i]);
+        real const zi = static_cast<real>(z[i]);
+        real const rho = std::sqrt(xi * xi + yi * yi);
+        phi[i] = static_cast<T>(Math::atan2(yi, xi));
+        theta[i] = static_cast<T>(Math::atan2(rho, zi));
+        r[i] = static_cast<T>(std::sqrt(rho * rho + zi * zi));
+    }
+}
+
+// the latitude of the origin is 0
+template <typename Math = libm_trigonometry, typename T>
+inline void batch_from_cartesian
+(
+    boost::geometry::cs::spherical_equatorial<boost::geometry::radian>,
+    std::size_t count,
+    T const* x, T const* y, T const* z,
+    T* lambda, T* delta, T* r
+)
+{
+    typedef typename precision_traits<T>::compute_type real;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        real const xi = static_cast<real>(x[i]);
+        real const yi = static_cast<real>(y[i]);
+        real const zi = static_cast<real>(z[i]);
+        real const rho = std::sqrt(xi * xi + yi * yi);
+        lambda[i] = static_cast<T>(Math::atan2(yi, xi));
+        delta[i] = static_cast<T>(Math::atan2(zi, rho));
+        r[i] = static_cast<T>(std::sqrt(rho * rho + zi * zi));
+    }
+}
+
+// applies the row major 3x3 matrix to count vectors in a single pass,
+// output may be the same arrays as input
+template <typename T>
+inline void batch_rotate
+(
+    double const (&matrix)[3][3],
+    std::size_t count,
+    T const* x, T const* y, T const* z,
+    T* out_x, T* out_y, T* out_z
+)
+{
+    typedef typename precision_traits<T>::compute_type real;
+    real const m00 = static_cast<real>(matrix[0][0]), m01 = static_cast<real>(matrix[0][1]),
+        m02 = static_cast<real>(matrix[0][2]);
+    real const m10 = static_cast<real>(matrix[1][0]), m11 = static_cast<real>(matrix[1][1]),
+        m12 = static_cast<real>(matrix[1][2]);
+    real const m20 = static_cast<real>(matrix[2][0]), m21 = static_cast<real>(matrix[2][1]),
+        m22 = static_cast<real>(matrix[2][2]);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        real const xi = static_cast<real>(x[i]);
+        real const yi = static_cast<real>(y[i]);
+        real const zi = static_cast<real>(z[i]);
+        out_x[i] = static_cast<T>(m00 * xi + m01 * yi + m02 * zi);
+        out_y[i] = static_cast<T>(m10 * xi + m11 * yi + m12 * zi);
+        out_z[i] = static_cast<T>(m20 * xi + m21 * yi + m22 * zi);
+    }
+}
+
+// converts count points from FromSystem to ToSystem a block at a time through cartesian
+// components kept in cache, blocks are converted in the wider of both types and rounded
+// once when stored
+template <typename Math, typename FromSystem, typename ToSystem, typename T, typename U>
+inline void batch_convert
+(
+    FromSystem,
+    ToSystem,
+    std::size_t count,
+    U const* c1, U const* c2, U const* c3,
+    T* out1, T* out2, T* out3
+)
+{
+    typedef typename std::conditional<(sizeof(U) > sizeof(T)), U, T>::type block_type;
+    std::size_t const block = 256;
+    block_type input1[block], input2[block], input3[block];
+    block_type x[block], y[block], z[block];
+
+    for (std::size_t begin = 0; begin < count; begin += block)
+    {
+        std::size_t const length = std::min(block, count - begin);
+        std::copy(c1 + begin, c1 + begin + length, input1);
+        std::copy(c2 + begin, c2 + begin + length, input2);
+        std::copy(c3 + begin, c3 + begin + length, input3);
+
+        batch_to_cartesian<Math>(FromSystem(), length, input1, input2, input3, x, y, z);
+        batch_from_cartesian<Math>(ToSystem(), length, x, y, z, input1, input2, input3);
+
+        std::copy(input1, input1 + length, out1 + begin);
+        std::copy(input2, input2 + length, out2 + begin);
+        std::copy(input3, input3 + length, out3 + begin);
+    }
+}
+
+// points of the same system are only copied
+template <typename Math, typename System, typename T, typename U>
+inline void batch_convert
+(
+    System,
+    System,
+    std::size_t count,
+    U const* c1, U const* c2, U const* c3,
+    T* out1, T* out2, T* out3
+)
+{
+    std::copy(c1, c1 + count, out1);
+    std::copy(c2, c2 + count, out2);
+    std::copy(c3, c3 + count, out3);
+}
+
+// factor converting values of From quantity into values of To quantity, folded once per
+// instantiation by quantity_scale
+template <typename To, typename From>
+inline typename To::value_type quantity_factor()
+{
+    return static_cast<typename To::value_type>(quantity_scale<To, From>::value());
+}
+
+// multiplies count values by factor writing them into output
+template <typename T, typename U>
+inline void batch_scale(std::size_t count, U const* input, T factor, T* output)
+{
+    for (std::size_t i = 0; i < count; i++)
+    {
+        output[i] = factor * static_cast<T>(input[i]);
+    }
+}
+///@endcond
+
+}}} //namespace boost::astronomy::detail
+
+#endif // !BOOST_ASTRONOMY_DETAIL_BATCH_CONVERSION_HPP
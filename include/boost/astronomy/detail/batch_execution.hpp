@@ -0,0 +1,185 @@
+#ifndef BOOST_ASTRONOMY_DETAIL_BATCH_EXECUTION_HPP
+#define BOOST_ASTRONOMY_DETAIL_BATCH_EXECUTION_HPP
+
+#include <cstddef>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <exception>
+
+#include <boost/astronomy/offload_device.hpp>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace boost { namespace astronomy { namespace coordinate {
+
+//!How bulk operations on batches split the points across threads
+/*!
+The points are split into one contiguous range per thread made of whole blocks of
+256 points, and every thread goes through its range a block at a time so that the
+intermediate values stay in cache. The calling thread processes the first range.
+The split only depends on the size and the policy, so passes with the same policy
+over batches of the same size give every thread the same range; with pin_threads
+the thread processing range t is bound to the t-th processor the process may run on
+(Linux only) before it starts on its range, which keeps every range on the same core
+and on the memory of its node from one pass to the next. The calling thread is bound
+only while it processes the first range and then gets its own affinity back.
+An exception thrown while processing any range is rethrown to the caller once all
+the threads are done.
+
+With a device the bulk operations it supports are run on it instead, a chunk per
+stream at a time, when the batch has at least min_offload_points points; the
+threads are then unused. Without a device (the default) only the CPU is used.
+*/
+struct batch_execution
+{
+    std::size_t threads = 1; //! number of threads, 0 uses all the hardware threads
+    bool pin_threads = false; //! binds the worker threads to processors
+    std::size_t min_points_per_thread = 1 << 16; //! smaller ranges are not worth a thread
+    offload_device* device = nullptr; //! accelerator running the supported operations
+    std::size_t min_offload_points = 1 << 20; //! smaller batches stay on the CPU
+
+    batch_execution(std::size_t thread_count = 1, bool pin = false)
+        : threads(thread_count), pin_threads(pin) {}
+};
+
+}}} //namespace boost::astronomy::coordinate
+
+namespace boost { namespace astronomy { namespace detail {
+
+///@cond INTERNAL
+// number of threads used for size points
+inline std::size_t execution_threads
+(
+    std::size_t size,
+    coordinate::batch_execution const& execution
+)
+{
+    std::size_t threads = execution.threads;
+    if (threads == 0)
+    {
+        threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    std::size_t const min_points = std::max<std::size_t>(execution.min_points_per_thread, 1);
+    return std::max<std::size_t>(std::min(threads, size / min_points), 1);
+}
+
+// binds the calling thread to the index-th processor of the affinity mask of the process
+// for its lifetime and restores the previous mask of the thread on destruction
+struct scoped_thread_pin
+{
+#if defined(__linux__)
+    cpu_set_t previous; //! mask of the thread before it was pinned
+    bool pinned = false;
+#endif
+
+    scoped_thread_pin(std::size_t index, bool enabled)
+    {
+#if defined(__linux__)
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        if (!enabled || sched_getaffinity(0, sizeof(cpu_set_t), &allowed) != 0 ||
+            CPU_COUNT(&allowed) == 0 ||
+            pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &this->previous) != 0)
+        {
+            return;
+        }
+
+        std::size_t const skip = index % static_cast<std::size_t>(CPU_COUNT(&allowed));
+        std::size_t seen = 0;
+        for (std::size_t cpu = 0; cpu < CPU_SETSIZE; cpu++)
+        {
+            if (CPU_ISSET(cpu, &allowed) && seen++ == skip)
+            {
+                cpu_set_t set;
+                CPU_ZERO(&set);
+                CPU_SET(cpu, &set);
+                this->pinned = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &set) == 0;
+                return;
+            }
+        }
+#else
+        (void)index;
+        (void)enabled;
+#endif
+    }
+
+    scoped_thread_pin(scoped_thread_pin const&) = delete;
+    scoped_thread_pin& operator=(scoped_thread_pin const&) = delete;
+
+    ~scoped_thread_pin()
+    {
+#if defined(__linux__)
+        if (this->pinned)
+        {
+            pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &this->previous);
+        }
+#endif
+    }
+};
+
+// calls f(begin, length) for the range of size points of every thread
+// the first exception thrown by any range is rethrown after all the threads finish
+template <typename Function>
+inline void parallel_ranges
+(
+    std::size_t size,
+    coordinate::batch_execution const& execution,
+    Function f
+)
+{
+    std::size_t const block = 256;
+    std::size_t const threads = execution_threads(size, execution);
+    std::size_t const chunk = ((size + threads - 1) / threads + block - 1) / block * block;
+    bool const pin = execution.pin_threads;
+
+    std::vector<std::exception_ptr> errors(threads);
+    std::vector<std::thread> workers;
+    try
+    {
+        for (std::size_t t = 1; t < threads && t * chunk < size; t++)
+        {
+            std::size_t const begin = t * chunk;
+            std::size_t const length = std::min(chunk, size - begin);
+            workers.emplace_back([&f, &errors, pin, t, begin, length]() {
+                try
+                {
+                    scoped_thread_pin const pinned(t, pin);
+                    f(begin, length);
+                }
+                catch (...)
+                {
+                    errors[t] = std::current_exception();
+                }
+            });
+        }
+
+        //the calling thread goes back to its own mask once its range is done
+        scoped_thread_pin const pinned(0, pin);
+        f(0, std::min(chunk, size));
+    }
+    catch (...)
+    {
+        errors[0] = std::current_exception();
+    }
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+    for (auto const& error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
+///@endcond
+
+}}} //namespace boost::astronomy::detail
+
+#endif // !BOOST_ASTRONOMY_DETAIL_BATCH_EXECUTION_HPP
@@ -0,0 +1,103 @@
+#ifndef BOOST_ASTRONOMY_DETAIL_BOUNDED_QUEUE_HPP
+#define BOOST_ASTRONOMY_DETAIL_BOUNDED_QUEUE_HPP
+
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <algorithm>
+#include <condition_variable>
+
+namespace boost { namespace astronomy { namespace detail {
+
+///@cond INTERNAL
+// queue of at most capacity items between the threads of two stages of a pipeline
+// push blocks while the queue is full so that a fast stage waits for the next one,
+// pop blocks while it is empty and returns false once every producer has called close
+// cancel wakes up all the threads, push and pop return false after it
+template <typename T>
+class bounded_queue
+{
+public:
+    bounded_queue(std::size_t max_items, std::size_t producer_count) :
+        capacity(std::max<std::size_t>(max_items, 1)), producers(producer_count) {}
+
+    bounded_queue(bounded_queue const&) = delete;
+    bounded_queue& operator=(bounded_queue const&) = delete;
+
+    bool push(T item)
+    {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        this->not_full.wait(lock, [this]() {
+            return this->cancelled || this->items.size() < this->capacity;
+        });
+        if (this->cancelled)
+        {
+            return false;
+        }
+        this->items.push_back(std::move(item));
+        this->peak = std::max(this->peak, this->items.size());
+        lock.unlock();
+        this->not_empty.notify_one();
+        return true;
+    }
+
+    bool pop(T& item)
+    {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        this->not_empty.wait(lock, [this]() {
+            return this->cancelled || !this->items.empty() || this->producers == 0;
+        });
+        if (this->cancelled || this->items.empty())
+        {
+            return false;
+        }
+        item = std::move(this->items.front());
+        this->items.pop_front();
+        lock.unlock();
+        this->not_full.notify_one();
+        return true;
+    }
+
+    // called by every producer once it has pushed its last item
+    void close()
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (this->producers > 0 && --this->producers == 0)
+        {
+            this->not_empty.notify_all();
+        }
+    }
+
+    void cancel()
+    {
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->cancelled = true;
+        }
+        this->not_empty.notify_all();
+        this->not_full.notify_all();
+    }
+
+    // largest number of items waiting in the queue so far
+    std::size_t max_size()
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->peak;
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable not_empty;
+    std::condition_variable not_full;
+    std::deque<T> items;
+    std::size_t capacity;
+    std::size_t producers;
+    std::size_t peak = 0;
+    bool cancelled = false;
+};
+///@endcond
+
+}}} //namespace boost::astronomy::detail
+
+#endif // !BOOST_ASTRONOMY_DETAIL_BOUNDED_QUEUE_HPP
@@ -0,0 +1,214 @@
+#ifndef BOOST_ASTRONOMY_DETAIL_ENDIAN_HPP
+#define BOOST_ASTRONOMY_DETAIL_ENDIAN_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <boost/endian/conversion.hpp>
+#include <boost/predef/other/endian.h>
+
+// SIMD byte swapping kernels are selected at runtime on x86 (GCC and Clang)
+// and at compile time on ARM, define BOOST_ASTRONOMY_NO_SIMD to use scalar code only
+#if !defined(BOOST_ASTRONOMY_NO_SIMD)
+#  if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#    define BOOST_ASTRONOMY_DETAIL_X86_SIMD
+#    include <immintrin.h>
+#  elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#    define BOOST_ASTRONOMY_DETAIL_NEON_SIMD
+#    include <arm_neon.h>
+#  endif
+#endif
+
+
+namespace boost { namespace astronomy { namespace detail {
+
+///@cond INTERNAL
+// unsigned integer type having the same size as the given type
+template <std::size_t Size>
+struct unsigned_by_size {};
+
+template <>
+struct unsigned_by_size<1> { typedef std::uint8_t type; };
+
+template <>
+struct unsigned_by_size<2> { typedef std::uint16_t type; };
+
+template <>
+struct unsigned_by_size<4> { typedef std::uint32_t type; };
+
+template <>
+struct unsigned_by_size<8> { typedef std::uint64_t type; };
+
+// reads a big endian value of type T from unaligned memory
+template <typename T>
+inline T load_big_endian(char const* source)
+{
+    typename unsigned_by_size<sizeof(T)>::type bits;
+    std::memcpy(&bits, source, sizeof(T));
+    boost::endian::big_to_native_inplace(bits);
+
+    T value;
+    std::memcpy(&value, &bits, sizeof(T));
+    return value;
+}
+
+// writes value of type T as big endian into unaligned memory
+template <typename T>
+inline void store_big_endian(T value, char* destination)
+{
+    typename unsigned_by_size<sizeof(T)>::type bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    boost::endian::native_to_big_inplace(bits);
+    std::memcpy(destination, &bits, sizeof(T));
+}
+
+// reverses the bytes of every element of given size using scalar code
+template <std::size_t Size>
+inline void reverse_bytes_scalar(unsigned char* bytes, std::size_t count)
+{
+    typedef typename unsigned_by_size<Size>::type unsigned_type;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        unsigned_type bits;
+        std::memcpy(&bits, bytes + i * Size, Size);
+        boost::endian::endian_reverse_inplace(bits);
+        std::memcpy(bytes + i * Size, &bits, Size);
+    }
+}
+
+#if defined(BOOST_ASTRONOMY_DETAIL_X86_SIMD)
+// shuffle mask which reverses every Size bytes of a 32 byte register
+template <std::size_t Size>
+inline void byte_reverse_mask(unsigned char (&mask)[32])
+{
+    for (std::size_t i = 0; i < 32; i++)
+    {
+        mask[i] = static_cast<unsigned char>(((i % 16) / Size) * Size + (Size - 1 - i % Size));
+    }
+}
+
+// reverses bytes of elements using SSSE3, returns the number of elements processed
+template <std::size_t Size>
+__attribute__((target("ssse3")))
+inline std::size_t reverse_bytes_ssse3(unsigned char* bytes, std::size_t count)
+{
+    unsigned char mask_bytes[32];
+    byte_reverse_mask<Size>(mask_bytes);
+    __m128i const mask = _mm_loadu_si128(reinterpret_cast<__m128i const*>(mask_bytes));
+
+    std::size_t const length = (count * Size) / 16 * 16;
+    for (std::size_t i = 0; i < length; i += 16)
+    {
+        __m128i value = _mm_loadu_si128(reinterpret_cast<__m128i const*>(bytes + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(bytes + i), _mm_shuffle_epi8(value, mask));
+    }
+    return length / Size;
+}
+
+// reverses bytes of elements using AVX2, returns the number of elements processed
+template <std::size_t Size>
+__attribute__((target("avx2")))
+inline std::size_t reverse_bytes_avx2(unsigned char* bytes, std::size_t count)
+{
+    unsigned char mask_bytes[32];
+    byte_reverse_mask<Size>(mask_bytes);
+    __m256i const mask = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(mask_bytes));
+
+    std::size_t const length = (count * Size) / 32 * 32;
+    for (std::size_t i = 0; i < length; i += 32)
+    {
+        __m256i value = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(bytes + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(bytes + i),
+            _mm256_shuffle_epi8(value, mask));
+    }
+    return length / Size;
+}
+
+// instruction sets available on the processor, detected once
+enum class simd_level { none, ssse3, avx2 };
+
+inline simd_level detected_simd_level()
+{
+    static simd_level const level = __builtin_cpu_supports("avx2") ? simd_level::avx2 :
+        (__builtin_cpu_supports("ssse3") ? simd_level::ssse3 : simd_level::none);
+    return level;
+}
+#endif
+
+#if defined(BOOST_ASTRONOMY_DETAIL_NEON_SIMD)
+// reverses bytes of elements using NEON, returns the number of elements processed
+template <std::size_t Size>
+inline std::size_t reverse_bytes_neon(unsigned char* bytes, std::size_t count)
+{
+    std::size_t const length = (count * Size) / 16 * 16;
+    for (std::size_t i = 0; i < length; i += 16)
+    {
+        uint8x16_t value = vld1q_u8(bytes + i);
+        switch (Size)
+        {
+        case 2:
+            value = vrev16q_u8(value);
+            break;
+        case 4:
+            value = vrev32q_u8(value);
+            break;
+        default:
+            value = vrev64q_u8(value);
+            break;
+        }
+        vst1q_u8(bytes + i, value);
+    }
+    return length / Size;
+}
+#endif
+
+// reverses the bytes of count elements of given size stored at bytes
+template <std::size_t Size>
+inline void reverse_bytes(unsigned char* bytes, std::size_t count)
+{
+    std::size_t done = 0;
+#if defined(BOOST_ASTRONOMY_DETAIL_X86_SIMD)
+    switch (detected_simd_level())
+    {
+    case simd_level::avx2:
+        done = reverse_bytes_avx2<Size>(bytes, count);
+        break;
+    case simd_level::ssse3:
+        done = reverse_bytes_ssse3<Size>(bytes, count);
+        break;
+    default:
+        break;
+    }
+#elif defined(BOOST_ASTRONOMY_DETAIL_NEON_SIMD)
+    done = reverse_bytes_neon<Size>(bytes, count);
+#endif
+    reverse_bytes_scalar<Size>(bytes + done * Size, count - done);
+}
+
+template <>
+inline void reverse_bytes<1>(unsigned char*, std::size_t) {}
+
+// converts count big endian values stored at data into native byte order in place
+template <typename T>
+inline void big_to_native_array(T* data, std::size_t count)
+{
+#if !BOOST_ENDIAN_BIG_BYTE
+    reverse_bytes<sizeof(T)>(reinterpret_cast<unsigned char*>(data), count);
+#else
+    (void)data;
+    (void)count;
+#endif
+}
+
+// converts count native values stored at data into big endian byte order in place
+template <typename T>
+inline void native_to_big_array(T* data, std::size_t count)
+{
+    big_to_native_array(data, count);
+}
+///@endcond
+
+}}} //namespace boost::astronomy::detail
+
+#endif // !BOOST_ASTRONOMY_DETAIL_ENDIAN_HPP
@@ -0,0 +1,20 @@
+#ifndef BOOST_ASTRONOMY_DETAIL_IS_TRIVIAL_STORAGE_HPP
+#define BOOST_ASTRONOMY_DETAIL_IS_TRIVIAL_STORAGE_HPP
+
+#include <type_traits>
+
+
+namespace boost { namespace astronomy { namespace detail {
+
+//!true when objects of type T are plain bytes: they can be copied with std::memcpy,
+//!placed in memory mapped arrays and sent to other processes without serialization
+template <typename T>
+struct is_trivial_storage : std::integral_constant
+    <
+        bool,
+        std::is_trivially_copyable<T>::value && std::is_standard_layout<T>::value
+    > {};
+
+}}} //namespace boost::astronomy::detail
+
+#endif // !BOOST_ASTRONOMY_DETAIL_IS_TRIVIAL_STORAGE_HPP
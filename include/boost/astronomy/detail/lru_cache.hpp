@@ -0,0 +1,90 @@
+#ifndef BOOST_ASTRONOMY_DETAIL_LRU_CACHE_HPP
+#define BOOST_ASTRONOMY_DETAIL_LRU_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <algorithm>
+
+namespace boost { namespace astronomy { namespace detail {
+
+///@cond INTERNAL
+// small thread safe cache keeping the capacity most recently used values
+// entries are searched linearly, the caches hold a handful of keys (epochs, sites)
+// and are hit far more often than they are filled
+template <typename Key, typename Value>
+struct lru_cache
+{
+protected:
+    struct entry
+    {
+        Key key;
+        std::shared_ptr<Value const> value;
+        std::uint64_t last_use;
+    };
+
+    std::size_t capacity;
+    std::vector<entry> entries;
+    std::uint64_t clock = 0;
+    std::size_t hit_count = 0;
+    std::size_t miss_count = 0;
+    mutable std::mutex mutex;
+
+public:
+    explicit lru_cache(std::size_t max_entries) : capacity(std::max<std::size_t>(max_entries, 1)) {}
+
+    // returns the value of key, make(key) computes it when it is not cached
+    template <typename Factory>
+    std::shared_ptr<Value const> get(Key const& key, Factory&& make)
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        for (auto& cached : this->entries)
+        {
+            if (cached.key == key)
+            {
+                cached.last_use = ++this->clock;
+                this->hit_count++;
+                return cached.value;
+            }
+        }
+
+        this->miss_count++;
+        std::shared_ptr<Value const> value = std::make_shared<Value const>(make(key));
+        if (this->entries.size() < this->capacity)
+        {
+            this->entries.push_back(entry{key, value, ++this->clock});
+        }
+        else
+        {
+            auto oldest = std::min_element(this->entries.begin(), this->entries.end(),
+                [](entry const& lhs, entry const& rhs) { return lhs.last_use < rhs.last_use; });
+            *oldest = entry{key, value, ++this->clock};
+        }
+        return value;
+    }
+
+    std::size_t hits() const
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->hit_count;
+    }
+
+    std::size_t misses() const
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->miss_count;
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->entries.clear();
+    }
+};
+///@endcond
+
+}}} //namespace boost::astronomy::detail
+
+#endif // !BOOST_ASTRONOMY_DETAIL_LRU_CACHE_HPP
@@ -0,0 +1,107 @@
+#ifndef BOOST_ASTRONOMY_DETAIL_MONOTONIC_ARENA_HPP
+#define BOOST_ASTRONOMY_DETAIL_MONOTONIC_ARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <algorithm>
+
+namespace boost { namespace astronomy { namespace detail {
+
+///@cond INTERNAL
+// allocates memory from large blocks which are released only when the arena is destroyed
+// allocation is thread safe so that HDUs may be created by many loading threads
+class monotonic_arena
+{
+public:
+    explicit monotonic_arena(std::size_t block_bytes = 1 << 16) : block_size(block_bytes) {}
+
+    monotonic_arena(monotonic_arena const&) = delete;
+    monotonic_arena& operator=(monotonic_arena const&) = delete;
+
+    void* allocate(std::size_t size, std::size_t alignment)
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        std::size_t padding = (alignment - reinterpret_cast<std::uintptr_t>(this->current) % alignment)
+            % alignment;
+        if (this->current == nullptr || padding + size > this->remaining)
+        {
+            std::size_t const length = std::max(this->block_size, size + alignment);
+            this->blocks.emplace_back(new char[length]);
+            this->current = this->blocks.back().get();
+            this->remaining = length;
+            padding = (alignment - reinterpret_cast<std::uintptr_t>(this->current) % alignment)
+                % alignment;
+        }
+
+        char* result = this->current + padding;
+        this->current = result + size;
+        this->remaining -= padding + size;
+        this->allocated += size;
+        return result;
+    }
+
+    // bytes handed out by allocate
+    std::size_t bytes_allocated() const
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->allocated;
+    }
+
+    // number of blocks requested from the system allocator
+    std::size_t block_count() const
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->blocks.size();
+    }
+
+private:
+    mutable std::mutex mutex;
+    std::vector<std::unique_ptr<char[]>> blocks;
+    std::size_t block_size;
+    char* current = nullptr;
+    std::size_t remaining = 0;
+    std::size_t allocated = 0;
+};
+
+// allocator drawing from a shared arena, deallocation is a no-op and the arena
+// stays alive as long as any allocator (e.g. inside a shared_ptr control block) uses it
+template <typename T>
+struct arena_allocator
+{
+    typedef T value_type;
+
+    std::shared_ptr<monotonic_arena> arena;
+
+    explicit arena_allocator(std::shared_ptr<monotonic_arena> shared) : arena(std::move(shared)) {}
+
+    template <typename U>
+    arena_allocator(arena_allocator<U> const& other) : arena(other.arena) {}
+
+    T* allocate(std::size_t count)
+    {
+        return static_cast<T*>(this->arena->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, std::size_t) {}
+};
+
+template <typename T, typename U>
+inline bool operator==(arena_allocator<T> const& lhs, arena_allocator<U> const& rhs)
+{
+    return lhs.arena == rhs.arena;
+}
+
+template <typename T, typename U>
+inline bool operator!=(arena_allocator<T> const& lhs, arena_allocator<U> const& rhs)
+{
+    return lhs.arena != rhs.arena;
+}
+///@endcond
+
+}}} //namespace boost::astronomy::detail
+
+#endif // !BOOST_ASTRONOMY_DETAIL_MONOTONIC_ARENA_HPP
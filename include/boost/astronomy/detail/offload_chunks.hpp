@@ -0,0 +1,129 @@
+#ifndef BOOST_ASTRONOMY_DETAIL_OFFLOAD_CHUNKS_HPP
+#define BOOST_ASTRONOMY_DETAIL_OFFLOAD_CHUNKS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+
+#include <boost/astronomy/offload_device.hpp>
+
+namespace boost { namespace astronomy { namespace detail {
+
+///@cond INTERNAL
+// offload_value of the type T, supported is false for other types
+template <typename T>
+struct offload_value_of
+{
+    static constexpr bool supported = false;
+    static constexpr offload_value value = offload_value::float64;
+};
+
+#define BOOST_ASTRONOMY_DETAIL_OFFLOAD_VALUE(type, name) \
+template <> \
+struct offload_value_of<type> \
+{ \
+    static constexpr bool supported = true; \
+    static constexpr offload_value value = offload_value::name; \
+};
+
+BOOST_ASTRONOMY_DETAIL_OFFLOAD_VALUE(std::uint8_t, uint8)
+BOOST_ASTRONOMY_DETAIL_OFFLOAD_VALUE(std::int16_t, int16)
+BOOST_ASTRONOMY_DETAIL_OFFLOAD_VALUE(std::int32_t, int32)
+BOOST_ASTRONOMY_DETAIL_OFFLOAD_VALUE(std::int64_t, int64)
+BOOST_ASTRONOMY_DETAIL_OFFLOAD_VALUE(float, float32)
+BOOST_ASTRONOMY_DETAIL_OFFLOAD_VALUE(double, float64)
+#undef BOOST_ASTRONOMY_DETAIL_OFFLOAD_VALUE
+
+// true when count items of item_size bytes running kernel should go to device
+inline bool use_offload
+(
+    offload_device* device,
+    std::size_t min_points,
+    offload_kernel const& kernel,
+    std::size_t count,
+    std::size_t item_size
+)
+{
+    return device != nullptr && count > 0 && count >= min_points &&
+        device->staging_size() >= item_size && device->streams() > 0 &&
+        device->supports(kernel);
+}
+
+// runs kernel on count items of item_size bytes a chunk at a time over the streams of device
+// pack(staging, begin, length) fills a staging buffer with the items [begin, begin + length)
+// and unpack(staging, begin, length) reads their results, chunks are unpacked in order
+// the streams are always drained before returning, also when an exception is thrown
+template <typename Pack, typename Unpack>
+inline void offload_chunks
+(
+    offload_device& device,
+    offload_kernel const& kernel,
+    std::size_t count,
+    std::size_t item_size,
+    Pack pack,
+    Unpack unpack
+)
+{
+    struct chunk_in_flight
+    {
+        std::size_t begin = 0;
+        std::size_t length = 0;
+        bool busy = false;
+    };
+
+    std::size_t const streams = device.streams();
+    std::size_t const chunk = device.staging_size() / item_size;
+    std::vector<chunk_in_flight> in_flight(streams);
+
+    auto finish = [&](std::size_t stream) {
+        chunk_in_flight& pending = in_flight[stream];
+        if (pending.busy)
+        {
+            pending.busy = false;
+            device.synchronize(stream);
+            unpack(device.staging(stream), pending.begin, pending.length);
+        }
+    };
+
+    try
+    {
+        std::size_t next = 0;
+        for (std::size_t begin = 0; begin < count; begin += chunk, next = (next + 1) % streams)
+        {
+            finish(next);
+            std::size_t const length = std::min(chunk, count - begin);
+            pack(device.staging(next), begin, length);
+            device.enqueue(next, kernel, length);
+            in_flight[next].begin = begin;
+            in_flight[next].length = length;
+            in_flight[next].busy = true;
+        }
+        for (std::size_t i = 0; i < streams; i++)
+        {
+            finish((next + i) % streams);
+        }
+    }
+    catch (...)
+    {
+        for (std::size_t stream = 0; stream < streams; stream++)
+        {
+            if (in_flight[stream].busy)
+            {
+                try
+                {
+                    device.synchronize(stream);
+                }
+                catch (...)
+                {
+                }
+            }
+        }
+        throw;
+    }
+}
+///@endcond
+
+}}} //namespace boost::astronomy::detail
+
+#endif // !BOOST_ASTRONOMY_DETAIL_OFFLOAD_CHUNKS_HPP
@@ -0,0 +1,120 @@
+#ifndef BOOST_ASTRONOMY_DETAIL_OFFLOAD_TRANSFORM_HPP
+#define BOOST_ASTRONOMY_DETAIL_OFFLOAD_TRANSFORM_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+
+#include <boost/geometry/core/cs.hpp>
+
+#include <boost/astronomy/offload_device.hpp>
+#include <boost/astronomy/detail/offload_chunks.hpp>
+#include <boost/astronomy/detail/batch_conversion.hpp>
+
+namespace boost { namespace astronomy { namespace detail {
+
+///@cond INTERNAL
+inline offload_system offload_system_of(boost::geometry::cs::cartesian)
+{
+    return offload_system::cartesian;
+}
+
+inline offload_system offload_system_of
+(
+    boost::geometry::cs::spherical<boost::geometry::radian>
+)
+{
+    return offload_system::spherical;
+}
+
+inline offload_system offload_system_of
+(
+    boost::geometry::cs::spherical_equatorial<boost::geometry::radian>
+)
+{
+    return offload_system::spherical_equatorial;
+}
+
+// runs the transform kernel on count points of the 3 input arrays into the output arrays
+template <typename T>
+inline void offload_transform
+(
+    offload_device& device,
+    offload_kernel const& kernel,
+    std::size_t count,
+    T const* c1, T const* c2, T const* c3,
+    T* out1, T* out2, T* out3
+)
+{
+    offload_chunks(device, kernel, count, 3 * sizeof(T),
+        [=](void* staging, std::size_t begin, std::size_t length) {
+            T* buffer = static_cast<T*>(staging);
+            std::memcpy(buffer, c1 + begin, length * sizeof(T));
+            std::memcpy(buffer + length, c2 + begin, length * sizeof(T));
+            std::memcpy(buffer + 2 * length, c3 + begin, length * sizeof(T));
+        },
+        [=](void* staging, std::size_t begin, std::size_t length) {
+            T const* buffer = static_cast<T const*>(staging);
+            std::memcpy(out1 + begin, buffer, length * sizeof(T));
+            std::memcpy(out2 + begin, buffer + length, length * sizeof(T));
+            std::memcpy(out3 + begin, buffer + 2 * length, length * sizeof(T));
+        });
+}
+
+// runs the transform kernel converting count points from FromSystem to ToSystem through
+// matrix on device when it applies (see use_offload), returns false when it does not
+template <typename T, typename FromSystem, typename ToSystem>
+inline bool try_offload_transform
+(
+    offload_device* device,
+    std::size_t min_points,
+    FromSystem from,
+    ToSystem to,
+    double const (&matrix)[3][3],
+    coordinate::conversion_accuracy accuracy,
+    std::size_t count,
+    T const* c1, T const* c2, T const* c3,
+    T* out1, T* out2, T* out3
+)
+{
+    if (!offload_value_of<T>::supported || device == nullptr)
+    {
+        return false;
+    }
+    offload_kernel kernel;
+    kernel.operation = offload_operation::transform;
+    kernel.value = offload_value_of<T>::value;
+    kernel.from = offload_system_of(from);
+    kernel.to = offload_system_of(to);
+    kernel.accuracy = accuracy;
+    std::copy(&matrix[0][0], &matrix[0][0] + 9, &kernel.matrix[0][0]);
+    if (!use_offload(device, min_points, kernel, count, 3 * sizeof(T)))
+    {
+        return false;
+    }
+    offload_transform(*device, kernel, count, c1, c2, c3, out1, out2, out3);
+    return true;
+}
+
+// points converted between coordinate types stay on the CPU
+template <typename T, typename U, typename FromSystem, typename ToSystem>
+inline bool try_offload_transform
+(
+    offload_device*,
+    std::size_t,
+    FromSystem,
+    ToSystem,
+    double const (&)[3][3],
+    coordinate::conversion_accuracy,
+    std::size_t,
+    U const*, U const*, U const*,
+    T*, T*, T*
+)
+{
+    return false;
+}
+///@endcond
+
+}}} //namespace boost::astronomy::detail
+
+#endif // !BOOST_ASTRONOMY_DETAIL_OFFLOAD_TRANSFORM_HPP
@@ -0,0 +1,49 @@
+#ifndef BOOST_ASTRONOMY_DETAIL_PARALLEL_BANDS_HPP
+#define BOOST_ASTRONOMY_DETAIL_PARALLEL_BANDS_HPP
+
+#include <cstddef>
+#include <vector>
+#include <thread>
+#include <algorithm>
+
+namespace boost { namespace astronomy { namespace detail {
+
+///@cond INTERNAL
+// calls f(begin, end) for consecutive bands of count rows (of an image, of FITS blocks...)
+// on up to threads threads (0 uses all the hardware threads), bands hold at least
+// min_rows rows and f must only write the rows of its band
+template <typename Function>
+inline void parallel_bands
+(
+    std::size_t count,
+    std::size_t threads,
+    std::size_t min_rows,
+    Function&& f
+)
+{
+    if (threads == 0)
+    {
+        threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    threads = std::max<std::size_t>(std::min(threads, count / std::max<std::size_t>(min_rows, 1)),
+        1);
+    std::size_t const chunk = (count + threads - 1) / threads;
+
+    std::vector<std::thread> workers;
+    for (std::size_t t = 1; t < threads && t * chunk < count; t++)
+    {
+        std::size_t const begin = t * chunk;
+        std::size_t const end = std::min(count, begin + chunk);
+        workers.emplace_back([&f, begin, end]() { f(begin, end); });
+    }
+    f(std::size_t(0), std::min(count, chunk));
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+}
+///@endcond
+
+}}} //namespace boost::astronomy::detail
+
+#endif // !BOOST_ASTRONOMY_DETAIL_PARALLEL_BANDS_HPP
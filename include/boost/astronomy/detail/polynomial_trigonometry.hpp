@@ -0,0 +1,222 @@
+#ifndef BOOST_ASTRONOMY_DETAIL_POLYNOMIAL_TRIGONOMETRY_HPP
+#define BOOST_ASTRONOMY_DETAIL_POLYNOMIAL_TRIGONOMETRY_HPP
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+namespace boost { namespace astronomy { namespace detail {
+
+///@cond INTERNAL
+// Trigonometric functions used by the bulk coordinate conversion kernels.
+// The polynomial versions contain no calls and no data dependent branches
+// so loops calling them are vectorized by the compiler for the instruction
+// set enabled at build time (SSE2/AVX2/AVX-512/NEON) without any flag
+// changing floating point semantics.
+// Coefficients are the minimax fits of the Cephes library, double values are
+// evaluated in double precision and float values in single precision so
+// that loops over float arrays use twice as many SIMD lanes.
+
+// angle = result + quadrant * pi / 2 with result in [-pi/4, pi/4] and quadrant in {0, 1, 2, 3}
+// three part Cody-Waite reduction, exact for |angle| below about 1e6 radian
+// rounding goes through int as std::floor is not vectorized without -fno-trapping-math
+inline double reduce_half_pi(double angle, int& quadrant)
+{
+    double const turns = angle * 0.63661977236758134308;
+    int const nearest = static_cast<int>(turns + (turns < 0 ? -0.5 : 0.5));
+    double const k = static_cast<double>(nearest);
+    quadrant = nearest & 3;
+    return ((angle - k * 1.57079632673412561417e+00) - k * 6.07710050630396597660e-11)
+        - k * 2.02226624879595063154e-21;
+}
+
+// single precision reduction, exact for |angle| below about 1e4 radian
+inline float reduce_half_pi(float angle, int& quadrant)
+{
+    float const turns = angle * 0.636619772f;
+    int const nearest = static_cast<int>(turns + (turns < 0 ? -0.5f : 0.5f));
+    float const k = static_cast<float>(nearest);
+    quadrant = nearest & 3;
+    return ((angle - k * 1.5703125f) - k * 4.83751296997e-4f) - k * 7.54978995489e-8f;
+}
+
+// sine and cosine of angle from their values on the reduced range
+// the quadrant is applied as 0/1 and +-1 factors to keep the loops free of branches
+template <typename T>
+inline void sincos_from_quadrant
+(
+    int quadrant,
+    T sin_r,
+    T cos_r,
+    T& sine,
+    T& cosine
+)
+{
+    T const swap = static_cast<T>(quadrant & 1);
+    T const sin_sign = static_cast<T>(1 - (quadrant & 2));
+    T const cos_sign = static_cast<T>(1 - ((quadrant + 1) & 2));
+    sine = sin_sign * (sin_r + swap * (cos_r - sin_r));
+    cosine = cos_sign * (cos_r + swap * (sin_r - cos_r));
+}
+
+// atan2 from atan of the ratio t in [0, 1] of smaller to larger component,
+// t is always mapped to |u| <= tan(pi/8) by atan(t) = pi/8 + atan((t - tan(pi/8)) / (1 + t tan(pi/8)))
+// so the reduction needs no condition
+template <typename T, typename Atan>
+inline T atan2_from_ratio(T y, T x, Atan atan_reduced)
+{
+    T const tan_pi_8 = static_cast<T>(0.41421356237309504880);
+    T const ax = std::abs(x);
+    T const ay = std::abs(y);
+    // the smallest normal value as divisor keeps the ratio 0 at the origin
+    T const high = std::max(std::max(ax, ay), std::numeric_limits<T>::min());
+    T const t = std::min(ax, ay) / high;
+    T const angle = static_cast<T>(0.39269908169872415481) +
+        atan_reduced((t - tan_pi_8) / (1 + t * tan_pi_8));
+
+    // signs as +-1 factors, std::copysign keeps the loop free of branches
+    T const swap = std::copysign(T(1), ax - ay);
+    T const left = std::copysign(T(1), x);
+    T const octant = (1 - swap) * static_cast<T>(0.78539816339744830962) + swap * angle;
+    return std::copysign((1 - left) * static_cast<T>(1.57079632679489661923) + left * octant, y);
+}
+
+// single precision sine and cosine accurate to about an ulp of float (sinf and cosf of Cephes)
+inline void single_sincos(float angle, float& sine, float& cosine)
+{
+    int quadrant;
+    float const r = reduce_half_pi(angle, quadrant);
+    float const z = r * r;
+
+    float const sin_r = r + r * z * ((-1.9515295891e-4f * z + 8.3321608736e-3f) * z
+        - 1.6666654611e-1f);
+    float const cos_r = 1 - 0.5f * z + z * z * ((2.443315711809948e-5f * z
+        - 1.388731625493765e-3f) * z + 4.166664568298827e-2f);
+
+    sincos_from_quadrant(quadrant, sin_r, cos_r, sine, cosine);
+}
+
+// single precision atan2 accurate to about an ulp of float (atanf of Cephes)
+inline float single_atan2(float y, float x)
+{
+    return atan2_from_ratio(y, x, [](float t) {
+        float const z = t * t;
+        return t + t * z * (((8.05374449538e-2f * z - 1.38776856032e-1f) * z
+            + 1.99777106478e-1f) * z - 3.33329491539e-1f);
+    });
+}
+
+// functions of the standard library, reference results
+struct libm_trigonometry
+{
+    static void sincos(double angle, double& sine, double& cosine)
+    {
+        sine = std::sin(angle);
+        cosine = std::cos(angle);
+    }
+
+    static double atan2(double y, double x)
+    {
+        return std::atan2(y, x);
+    }
+
+    static void sincos(float angle, float& sine, float& cosine)
+    {
+        sine = std::sin(angle);
+        cosine = std::cos(angle);
+    }
+
+    static float atan2(float y, float x)
+    {
+        return std::atan2(y, x);
+    }
+};
+
+// polynomials accurate to a few ulp of double (of float for float arguments)
+struct polynomial_trigonometry
+{
+    static void sincos(double angle, double& sine, double& cosine)
+    {
+        int quadrant;
+        double const r = reduce_half_pi(angle, quadrant);
+        double const z = r * r;
+
+        double const sin_r = r + r * z * (((((1.58962301576546568060e-10 * z
+            - 2.50507477628578072866e-8) * z + 2.75573136213857245213e-6) * z
+            - 1.98412698295895385996e-4) * z + 8.33333333332211858878e-3) * z
+            - 1.66666666666666307295e-1);
+        double const cos_r = 1 - 0.5 * z + z * z * (((((-1.13585365213876817300e-11 * z
+            + 2.08757008419747316778e-9) * z - 2.75573141792967388112e-7) * z
+            + 2.48015872888517045348e-5) * z - 1.38888888888730564116e-3) * z
+            + 4.16666666666665929218e-2);
+
+        sincos_from_quadrant(quadrant, sin_r, cos_r, sine, cosine);
+    }
+
+    static double atan2(double y, double x)
+    {
+        return atan2_from_ratio(y, x, [](double t) {
+            double const z = t * t;
+            double const p = (((-8.750608600031904122785e-1 * z - 1.615753718733365076637e1) * z
+                - 7.500855792314704667340e1) * z - 1.228866684490136173410e2) * z
+                - 6.485021904942025371773e1;
+            double const q = ((((z + 2.485846490142306297962e1) * z + 1.650270098316988542046e2) * z
+                + 4.328810604912902668951e2) * z + 4.853903996359136964868e2) * z
+                + 1.945506571482613964425e2;
+            return t + t * z * p / q;
+        });
+    }
+
+    static void sincos(float angle, float& sine, float& cosine)
+    {
+        single_sincos(angle, sine, cosine);
+    }
+
+    static float atan2(float y, float x)
+    {
+        return single_atan2(y, x);
+    }
+};
+
+// shorter polynomials accurate to about 1e-7 (0.02 arcsecond)
+struct coarse_polynomial_trigonometry
+{
+    static void sincos(double angle, double& sine, double& cosine)
+    {
+        int quadrant;
+        double const r = reduce_half_pi(angle, quadrant);
+        double const z = r * r;
+
+        double const sin_r = r + r * z * ((-1.9515295891e-4 * z + 8.3321608736e-3) * z
+            - 1.6666654611e-1);
+        double const cos_r = 1 - 0.5 * z + z * z * ((2.443315711809948e-5 * z
+            - 1.388731625493765e-3) * z + 4.166664568298827e-2);
+
+        sincos_from_quadrant(quadrant, sin_r, cos_r, sine, cosine);
+    }
+
+    static double atan2(double y, double x)
+    {
+        return atan2_from_ratio(y, x, [](double t) {
+            double const z = t * t;
+            return t + t * z * (((8.05374449538e-2 * z - 1.38776856032e-1) * z
+                + 1.99777106478e-1) * z - 3.33329491539e-1);
+        });
+    }
+
+    // float is already coarser than the double polynomials above
+    static void sincos(float angle, float& sine, float& cosine)
+    {
+        single_sincos(angle, sine, cosine);
+    }
+
+    static float atan2(float y, float x)
+    {
+        return single_atan2(y, x);
+    }
+};
+///@endcond
+
+}}} //namespace boost::astronomy::detail
+
+#endif // !BOOST_ASTRONOMY_DETAIL_POLYNOMIAL_TRIGONOMETRY_HPP
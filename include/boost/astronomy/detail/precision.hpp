@@ -0,0 +1,30 @@
+#ifndef BOOST_ASTRONOMY_DETAIL_PRECISION_HPP
+#define BOOST_ASTRONOMY_DETAIL_PRECISION_HPP
+
+namespace boost { namespace astronomy { namespace detail {
+
+///@cond INTERNAL
+// floating point types used by the batch kernels for values stored as T
+// compute_type is used for the work done on a single element, float elements are
+// computed in float so that a SIMD register holds twice as many of them, every other
+// type is computed in double as are the trigonometric kernels
+// accumulate_type is used wherever many elements or many terms are summed, and for
+// quantities computed from differences of nearly equal values
+template <typename T>
+struct precision_traits
+{
+    typedef double compute_type;
+    typedef double accumulate_type;
+};
+
+template <>
+struct precision_traits<float>
+{
+    typedef float compute_type;
+    typedef double accumulate_type;
+};
+///@endcond
+
+}}} //namespace boost::astronomy::detail
+
+#endif // !BOOST_ASTRONOMY_DETAIL_PRECISION_HPP
@@ -0,0 +1,252 @@
+#ifndef BOOST_ASTRONOMY_DETAIL_TILE_COMPRESSION_HPP
+#define BOOST_ASTRONOMY_DETAIL_TILE_COMPRESSION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <limits>
+#include <algorithm>
+
+#include <boost/astronomy/detail/endian.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+// GZIP_1 and GZIP_2 tiles need zlib, define BOOST_ASTRONOMY_HAS_ZLIB and link
+// zlib to enable them (the CMake build does this when zlib is found)
+#if defined(BOOST_ASTRONOMY_HAS_ZLIB)
+#  include <zlib.h>
+#endif
+
+namespace boost { namespace astronomy { namespace detail {
+
+///@cond INTERNAL
+// reads bytes of a compressed tile, reading past the end returns zeros and
+// is reported by overrun() so the decoder needs no check on every byte
+struct tile_byte_reader
+{
+    unsigned char const* current;
+    unsigned char const* end;
+    bool overrun = false;
+
+    tile_byte_reader(unsigned char const* begin, std::size_t length) :
+        current(begin), end(begin + length) {}
+
+    std::uint64_t next()
+    {
+        if (current == end)
+        {
+            overrun = true;
+            return 0;
+        }
+        return *current++;
+    }
+};
+
+// number of bits needed to represent a byte value (0 for 0)
+inline int significant_bits(std::uint64_t byte)
+{
+    int bits = 0;
+    while (byte != 0)
+    {
+        bits++;
+        byte >>= 1;
+    }
+    return bits;
+}
+
+// decodes a RICE_1 tile of count pixels of type T (1, 2 or 4 bytes) into output
+// the first pixel is stored as it is, other pixels as differences from the previous
+// pixel coded block by block with a Rice parameter chosen for every block
+template <typename T>
+inline void rice_decode
+(
+    unsigned char const* input,
+    std::size_t length,
+    std::size_t block_size,
+    T* output,
+    std::size_t count
+)
+{
+    typedef typename unsigned_by_size<sizeof(T)>::type unsigned_type;
+    int const fsbits = sizeof(T) == 1 ? 3 : (sizeof(T) == 2 ? 4 : 5);
+    int const fsmax = sizeof(T) == 1 ? 6 : (sizeof(T) == 2 ? 14 : 25);
+    int const bbits = 8 * static_cast<int>(sizeof(T));
+    std::uint64_t const mask = std::numeric_limits<unsigned_type>::max();
+
+    if (count == 0)
+    {
+        return;
+    }
+    if (length < sizeof(T) || block_size == 0)
+    {
+        throw boost::astronomy::invalid_compressed_tile_exception();
+    }
+
+    tile_byte_reader reader(input, length);
+    std::uint64_t last = 0;
+    for (std::size_t i = 0; i < sizeof(T); i++)
+    {
+        last = (last << 8) | reader.next();
+    }
+
+    std::uint64_t bits = reader.next(); // bits not yet used, only the low nbits are valid
+    int nbits = 8;
+    std::size_t i = 0;
+    while (i < count)
+    {
+        nbits -= fsbits;
+        while (nbits < 0)
+        {
+            bits = (bits << 8) | reader.next();
+            nbits += 8;
+        }
+        int const fs = static_cast<int>(bits >> nbits) - 1;
+        bits &= (std::uint64_t(1) << nbits) - 1;
+
+        std::size_t const block_end = std::min(count, i + block_size);
+        if (fs < 0)
+        {
+            //all the differences of the block are zero
+            for (; i < block_end; i++)
+            {
+                output[i] = static_cast<T>(static_cast<unsigned_type>(last));
+            }
+            continue;
+        }
+
+        for (; i < block_end; i++)
+        {
+            std::uint64_t difference;
+            if (fs == fsmax)
+            {
+                //differences are stored as they are
+                int k = bbits - nbits;
+                difference = bits << k;
+                for (k -= 8; k >= 0; k -= 8)
+                {
+                    difference |= reader.next() << k;
+                }
+                if (nbits > 0)
+                {
+                    bits = reader.next();
+                    difference |= bits >> (-k);
+                    bits &= (std::uint64_t(1) << nbits) - 1;
+                }
+                else
+                {
+                    bits = 0;
+                }
+            }
+            else
+            {
+                //unary coded high bits followed by fs low bits
+                while (bits == 0)
+                {
+                    nbits += 8;
+                    bits = reader.next();
+                    if (reader.overrun)
+                    {
+                        throw boost::astronomy::invalid_compressed_tile_exception();
+                    }
+                }
+                int const zeros = nbits - significant_bits(bits);
+                nbits -= zeros + 1;
+                bits ^= std::uint64_t(1) << nbits;
+
+                nbits -= fs;
+                while (nbits < 0)
+                {
+                    bits = (bits << 8) | reader.next();
+                    nbits += 8;
+                }
+                difference = (static_cast<std::uint64_t>(zeros) << fs) | (bits >> nbits);
+                bits &= (std::uint64_t(1) << nbits) - 1;
+            }
+
+            difference &= mask;
+            difference = (difference & 1) == 0 ? difference >> 1 : ~(difference >> 1);
+            last = (last + difference) & mask;
+            output[i] = static_cast<T>(static_cast<unsigned_type>(last));
+        }
+
+        if (reader.overrun)
+        {
+            throw boost::astronomy::invalid_compressed_tile_exception();
+        }
+    }
+}
+
+// returns true if tiles compressed with GZIP_1 and GZIP_2 can be decoded
+inline constexpr bool has_gzip_support()
+{
+#if defined(BOOST_ASTRONOMY_HAS_ZLIB)
+    return true;
+#else
+    return false;
+#endif
+}
+
+// inflates a gzip (or zlib) stream which must decompress to exactly size bytes
+inline void gzip_decode
+(
+    unsigned char const* input,
+    std::size_t length,
+    unsigned char* output,
+    std::size_t size
+)
+{
+#if defined(BOOST_ASTRONOMY_HAS_ZLIB)
+    z_stream stream;
+    std::memset(&stream, 0, sizeof(stream));
+    //window bits of 15 + 32 detects gzip and zlib headers
+    if (inflateInit2(&stream, 15 + 32) != Z_OK)
+    {
+        throw boost::astronomy::invalid_compressed_tile_exception();
+    }
+
+    stream.next_in = const_cast<unsigned char*>(input);
+    stream.avail_in = static_cast<uInt>(length);
+    stream.next_out = output;
+    stream.avail_out = static_cast<uInt>(size);
+
+    int const status = inflate(&stream, Z_FINISH);
+    std::size_t const produced = size - stream.avail_out;
+    inflateEnd(&stream);
+
+    if (status != Z_STREAM_END || produced != size)
+    {
+        throw boost::astronomy::invalid_compressed_tile_exception();
+    }
+#else
+    (void)input;
+    (void)length;
+    (void)output;
+    (void)size;
+    throw boost::astronomy::unsupported_compression_exception();
+#endif
+}
+
+// GZIP_2 stores the most significant bytes of all the pixels first, then the
+// next bytes and so on, this restores the big endian pixels
+inline void unshuffle_bytes
+(
+    unsigned char const* shuffled,
+    unsigned char* output,
+    std::size_t count,
+    std::size_t pixel_size
+)
+{
+    for (std::size_t byte = 0; byte < pixel_size; byte++)
+    {
+        unsigned char const* plane = shuffled + byte * count;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            output[i * pixel_size + byte] = plane[i];
+        }
+    }
+}
+///@endcond
+
+}}} //namespace boost::astronomy::detail
+
+#endif // !BOOST_ASTRONOMY_DETAIL_TILE_COMPRESSION_HPP
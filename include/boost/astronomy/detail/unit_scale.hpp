@@ -0,0 +1,66 @@
+#ifndef BOOST_ASTRONOMY_DETAIL_UNIT_SCALE_HPP
+#define BOOST_ASTRONOMY_DETAIL_UNIT_SCALE_HPP
+
+#include <type_traits>
+
+#include <boost/units/quantity.hpp>
+#include <boost/units/conversion.hpp>
+
+namespace boost { namespace astronomy { namespace detail {
+
+///@cond INTERNAL
+// factor converting values of FromUnit into values of ToUnit
+// the same units are folded to a constexpr 1 so converting costs nothing, any other
+// ratio (parsec to meter, degree to radian, ...) is computed by boost::units once per
+// instantiation and read from a static constant afterwards
+template
+<
+    typename FromUnit,
+    typename ToUnit,
+    bool Same = std::is_same<FromUnit, ToUnit>::value
+>
+struct unit_scale
+{
+    static constexpr bool identity = false;
+
+    static double value()
+    {
+        static double const factor =
+            static_cast<double>(boost::units::conversion_factor(FromUnit(), ToUnit()));
+        return factor;
+    }
+};
+
+template <typename FromUnit, typename ToUnit>
+struct unit_scale<FromUnit, ToUnit, true>
+{
+    static constexpr bool identity = true;
+
+    static constexpr double value()
+    {
+        return 1;
+    }
+};
+
+template <typename FromUnit, typename ToUnit, bool Same>
+constexpr bool unit_scale<FromUnit, ToUnit, Same>::identity;
+
+template <typename FromUnit, typename ToUnit>
+constexpr bool unit_scale<FromUnit, ToUnit, true>::identity;
+
+// scale converting values of From quantity into values of To quantity
+template <typename To, typename From>
+struct quantity_scale : unit_scale<typename From::unit_type, typename To::unit_type> {};
+
+// converts quantity into To, equivalent to static_cast<To> for units which are not affine
+template <typename To, typename From>
+inline To convert_quantity(From const& quantity)
+{
+    return To::from_value(static_cast<typename To::value_type>(
+        static_cast<double>(quantity.value()) * quantity_scale<To, From>::value()));
+}
+///@endcond
+
+}}} //namespace boost::astronomy::detail
+
+#endif // !BOOST_ASTRONOMY_DETAIL_UNIT_SCALE_HPP
@@ -79,6 +79,96 @@ namespace boost
             }
         };
 
+        class unexpected_end_of_data_exception : public fits_exception
+        {
+        public:
+            const char* what() const throw()
+            {
+                return "Unexpected end of data while reading FITS file";
+            }
+        };
+
+        class invalid_image_section_exception : public fits_exception
+        {
+        public:
+            const char* what() const throw()
+            {
+                return "Image section lies outside the image";
+            }
+        };
+
+        class fits_write_exception : public fits_exception
+        {
+        public:
+            const char* what() const throw()
+            {
+                return "Could not write FITS file";
+            }
+        };
+
+        class fits_read_exception : public fits_exception
+        {
+        public:
+            const char* what() const throw()
+            {
+                return "Could not read FITS file";
+            }
+        };
+
+        class unsupported_compression_exception : public fits_exception
+        {
+        public:
+            const char* what() const throw()
+            {
+                return "Tile compression of the image is not supported";
+            }
+        };
+
+        class invalid_compressed_tile_exception : public fits_exception
+        {
+        public:
+            const char* what() const throw()
+            {
+                return "Compressed tile could not be decoded";
+            }
+        };
+
+        class invalid_ascii_field_exception : public fits_exception
+        {
+        public:
+            const char* what() const throw()
+            {
+                return "Field of ASCII table is not a valid number";
+            }
+        };
+
+        class invalid_wcs_exception : public fits_exception
+        {
+        public:
+            const char* what() const throw()
+            {
+                return "WCS keywords of the header are invalid or describe an unsupported projection";
+            }
+        };
+
+        class invalid_batch_file_exception : public std::exception
+        {
+        public:
+            const char* what() const throw()
+            {
+                return "Coordinate batch file is invalid or does not match the batch type";
+            }
+        };
+
+        class batch_file_write_exception : public std::exception
+        {
+        public:
+            const char* what() const throw()
+            {
+                return "Could not write coordinate batch file";
+            }
+        };
+
     } //namespace astronomy
 } //namespace boost
 #endif // !BOOST_ASTRONOMY_EXCEPTION_FITS_EXCEPTION_HPP
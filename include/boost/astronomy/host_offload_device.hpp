@@ -0,0 +1,297 @@
+#ifndef BOOST_ASTRONOMY_HOST_OFFLOAD_DEVICE_HPP
+#define BOOST_ASTRONOMY_HOST_OFFLOAD_DEVICE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <type_traits>
+#include <condition_variable>
+
+#include <boost/geometry/core/cs.hpp>
+
+#include <boost/astronomy/offload_device.hpp>
+#include <boost/astronomy/detail/batch_conversion.hpp>
+#include <boost/astronomy/io/image_statistics.hpp>
+
+namespace boost { namespace astronomy {
+
+///@cond INTERNAL
+namespace detail_host_offload {
+
+// calls f with the boost::geometry coordinate system of system
+template <typename Function>
+inline void dispatch_system(offload_system system, Function&& f)
+{
+    namespace bg = boost::geometry;
+    switch (system)
+    {
+    case offload_system::spherical:
+        f(bg::cs::spherical<bg::radian>());
+        break;
+    case offload_system::spherical_equatorial:
+        f(bg::cs::spherical_equatorial<bg::radian>());
+        break;
+    default:
+        f(bg::cs::cartesian());
+        break;
+    }
+}
+
+// calls f with a null pointer of the type of value
+template <typename Function>
+inline void dispatch_value(offload_value value, Function&& f)
+{
+    switch (value)
+    {
+    case offload_value::uint8:
+        f(static_cast<std::uint8_t*>(nullptr));
+        break;
+    case offload_value::int16:
+        f(static_cast<std::int16_t*>(nullptr));
+        break;
+    case offload_value::int32:
+        f(static_cast<std::int32_t*>(nullptr));
+        break;
+    case offload_value::int64:
+        f(static_cast<std::int64_t*>(nullptr));
+        break;
+    case offload_value::float32:
+        f(static_cast<float*>(nullptr));
+        break;
+    default:
+        f(static_cast<double*>(nullptr));
+        break;
+    }
+}
+
+// transform kernel on the 3 component arrays of a staging buffer, a block at a time
+template <typename T>
+inline typename std::enable_if<std::is_floating_point<T>::value>::type run_transform
+(
+    offload_kernel const& kernel,
+    std::size_t count,
+    T* buffer
+)
+{
+    namespace bad = boost::astronomy::detail;
+    T* c1 = buffer;
+    T* c2 = buffer + count;
+    T* c3 = buffer + 2 * count;
+    bad::dispatch_accuracy(kernel.accuracy, [&](auto math) {
+        typedef decltype(math) math_type;
+        dispatch_system(kernel.from, [&](auto from) {
+            dispatch_system(kernel.to, [&](auto to) {
+                std::size_t const block = 256;
+                T x[block], y[block], z[block];
+                for (std::size_t begin = 0; begin < count; begin += block)
+                {
+                    std::size_t const length = std::min(block, count - begin);
+                    bad::batch_to_cartesian<math_type>(from, length, c1 + begin, c2 + begin,
+                        c3 + begin, x, y, z);
+                    bad::batch_rotate(kernel.matrix, length, x, y, z, x, y, z);
+                    bad::batch_from_cartesian<math_type>(to, length, x, y, z, c1 + begin,
+                        c2 + begin, c3 + begin);
+                }
+            });
+        });
+    });
+}
+
+// integer components are not supported (see host_offload_device::supports)
+template <typename T>
+inline typename std::enable_if<!std::is_floating_point<T>::value>::type run_transform
+(
+    offload_kernel const&,
+    std::size_t,
+    T*
+)
+{
+    throw std::invalid_argument("transform kernel needs floating point components");
+}
+
+// runs kernel on count values of the staging buffer
+inline void run_kernel(offload_kernel const& kernel, std::size_t count, void* buffer)
+{
+    dispatch_value(kernel.value, [&](auto tag) {
+        typedef typename std::remove_pointer<decltype(tag)>::type value_type;
+        if (kernel.operation == offload_operation::statistics)
+        {
+            io::image_statistics const result = boost::astronomy::detail::range_statistics(
+                static_cast<value_type const*>(buffer), count);
+            offload_moments const moments = {static_cast<double>(result.count), result.min,
+                result.max, result.mean, result.m2};
+            std::memcpy(buffer, &moments, sizeof(moments));
+        }
+        else
+        {
+            run_transform(kernel, count, static_cast<value_type*>(buffer));
+        }
+    });
+}
+
+} // namespace detail_host_offload
+///@endcond
+
+//!offload_device running the kernels on one CPU thread per stream
+/*!
+The staging buffers are ordinary memory and every stream is a worker thread
+running its queued kernels in order with the CPU kernels of the library, so
+results match the CPU code paths. It serves as the reference for the devices
+wrapping an accelerator API and lets bulk operations run asynchronously on
+threads of their own, chunks() tells how the chunks were spread over the streams.
+*/
+struct host_offload_device : public offload_device
+{
+    //!starts the threads of stream_count streams with staging buffers of buffer_size bytes
+    explicit host_offload_device
+    (
+        std::size_t stream_count = 2,
+        std::size_t buffer_size = 1 << 22
+    )
+    {
+        this->buffer_bytes = std::max<std::size_t>(buffer_size, sizeof(offload_moments));
+        for (std::size_t i = 0; i < std::max<std::size_t>(stream_count, 1); i++)
+        {
+            this->states.emplace_back(new stream_state);
+            stream_state& state = *this->states.back();
+            state.buffer.resize((this->buffer_bytes + sizeof(double) - 1) / sizeof(double));
+            state.worker = std::thread([&state]() { run(state); });
+        }
+    }
+
+    host_offload_device(host_offload_device const&) = delete;
+    host_offload_device& operator=(host_offload_device const&) = delete;
+
+    //!waits for the queued kernels and stops the threads
+    ~host_offload_device()
+    {
+        for (auto& state : this->states)
+        {
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->stop = true;
+            }
+            state->changed.notify_all();
+            state->worker.join();
+        }
+    }
+
+    std::size_t streams() const
+    {
+        return this->states.size();
+    }
+
+    std::size_t staging_size() const
+    {
+        return this->buffer_bytes;
+    }
+
+    void* staging(std::size_t stream)
+    {
+        return this->states[stream]->buffer.data();
+    }
+
+    bool supports(offload_kernel const& kernel) const
+    {
+        return kernel.operation == offload_operation::statistics ||
+            kernel.value == offload_value::float32 || kernel.value == offload_value::float64;
+    }
+
+    void enqueue(std::size_t stream, offload_kernel const& kernel, std::size_t count)
+    {
+        stream_state& state = *this->states[stream];
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.jobs.emplace_back(kernel, count);
+        }
+        state.changed.notify_all();
+    }
+
+    void synchronize(std::size_t stream)
+    {
+        stream_state& state = *this->states[stream];
+        std::unique_lock<std::mutex> lock(state.mutex);
+        state.changed.wait(lock, [&state]() { return state.jobs.empty() && !state.running; });
+        if (state.error)
+        {
+            std::exception_ptr error = state.error;
+            state.error = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+    //!returns the number of chunks run by stream so far
+    std::size_t chunks(std::size_t stream) const
+    {
+        stream_state& state = *this->states[stream];
+        std::lock_guard<std::mutex> lock(state.mutex);
+        return state.chunks;
+    }
+
+protected:
+    struct stream_state
+    {
+        std::vector<double> buffer; //! staging buffer, double keeps every value type aligned
+        std::mutex mutex;
+        std::condition_variable changed;
+        std::deque<std::pair<offload_kernel, std::size_t>> jobs; //! kernels and their counts
+        bool running = false;
+        bool stop = false;
+        std::exception_ptr error; //! first error since the last synchronize
+        std::size_t chunks = 0;
+        std::thread worker;
+    };
+
+    std::vector<std::unique_ptr<stream_state>> states;
+    std::size_t buffer_bytes = 0;
+
+    //!loop of the thread of a stream
+    static void run(stream_state& state)
+    {
+        std::unique_lock<std::mutex> lock(state.mutex);
+        for (;;)
+        {
+            state.changed.wait(lock, [&state]() { return state.stop || !state.jobs.empty(); });
+            if (state.jobs.empty())
+            {
+                return;
+            }
+            std::pair<offload_kernel, std::size_t> const job = state.jobs.front();
+            state.jobs.pop_front();
+            state.running = true;
+            lock.unlock();
+
+            std::exception_ptr error;
+            try
+            {
+                detail_host_offload::run_kernel(job.first, job.second, state.buffer.data());
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+
+            lock.lock();
+            if (error && !state.error)
+            {
+                state.error = error;
+            }
+            state.running = false;
+            state.chunks++;
+            state.changed.notify_all();
+        }
+    }
+};
+
+}} //namespace boost::astronomy
+
+#endif // !BOOST_ASTRONOMY_HOST_OFFLOAD_DEVICE_HPP
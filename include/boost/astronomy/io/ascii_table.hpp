@@ -8,14 +8,22 @@
 #include <iterator>
 #include <cstdint>
 #include <string>
+#include <utility>
 #include <cmath>
 #include <numeric>
+#include <vector>
+#include <limits>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <type_traits>
 
 #include <boost/astronomy/io/column.hpp>
 #include <boost/astronomy/io/column_data.hpp>
 #include <boost/astronomy/io/table_extension.hpp>
-#include <boost/endian/conversion.hpp>
+#include <boost/astronomy/detail/ascii_number.hpp>
 #include <boost/cstdfloat.hpp>
+#include <boost/algorithm/string/trim.hpp>
 
 
 namespace boost { namespace astronomy {  namespace io {
@@ -26,22 +34,27 @@ public:
     ascii_table(std::fstream &file) : table_extension(file)
     {
         populate_column_data();
-        std::copy_n(std::istream_iterator<char>(file), naxis(1)*naxis(2), std::back_inserter(data));
-        set_unit_end(file);
+        read_data(file);
     }
 
-    ascii_table(std::fstream &file, hdu const& other) : table_extension(file, other)
+    ascii_table(std::fstream &file, hdu other) : table_extension(file, std::move(other))
     {
         populate_column_data();
-        std::copy_n(std::istream_iterator<char>(file), naxis(1)*naxis(2), std::back_inserter(data));
-        set_unit_end(file);
+        read_data(file);
     }
 
     ascii_table(std::fstream &file, std::streampos pos) : table_extension(file, pos)
     {
         populate_column_data();
-        std::copy_n(std::istream_iterator<char>(file), naxis(1)*naxis(2), std::back_inserter(data));
-        set_unit_end(file);
+        read_data(file);
+    }
+
+    //!creates table which refers to data stored in memory (e.g memory mapped file)
+    //!data is not copied so memory must remain valid for lifetime of the object
+    ascii_table(hdu other, char const* data_begin) :
+        table_extension(std::move(other), data_begin)
+    {
+        populate_column_data();
     }
 
     void populate_column_data()
@@ -89,88 +102,162 @@ public:
                 );
             }
             catch (std::out_of_range e) {/*Do Nothing*/ }
+
+            descriptors[i].type = get_type(col_metadata[i].TFORM());
+            descriptors[i].width = column_size(col_metadata[i].TFORM());
+
+            //fields must start on the first character or later and end within a row
+            std::size_t const start = col_metadata[i].TBCOL();
+            if (start < 1 || start - 1 > naxis(1) || descriptors[i].width > naxis(1) - (start - 1))
+            {
+                throw invalid_table_colum_format();
+            }
+            descriptors[i].offset = start - 1;
+            read_scaling(i);
         }
+        index_columns();
     }
 
-    void read_data(std::fstream &file)
+    std::unique_ptr<column> get_column(std::string const& name) const
     {
-        file.read(&data[0], naxis(1)*naxis(2));
-        set_unit_end(file);
+        std::size_t index = this->column_index(name);
+        if (index == this->tfields)
+        {
+            return std::unique_ptr<column>(nullptr);
+        }
+
+        boost::astronomy::detail::io_timer column_timer(io_event_kind::column,
+            this->descriptors[index].width * naxis(2));
+        switch (this->descriptors[index].type)
+        {
+        case 'A':
+        {
+            auto result = std::make_unique<column_data<char>>();
+            std::vector<char>& values = result->get_data();
+            values.reserve(naxis(2));
+            for (std::size_t row = 0; row < naxis(2); row++)
+            {
+                values.push_back(this->table_data()[row * naxis(1) + this->descriptors[index].offset]);
+            }
+            return std::move(result);
+        }
+        case 'I':
+        {
+            auto result = std::make_unique<column_data<std::int32_t>>();
+            result->get_data() = read_column<std::int32_t>(name);
+            return std::move(result);
+        }
+        case 'F':
+        case 'E':
+        {
+            auto result = std::make_unique<column_data<float>>();
+            result->get_data() = read_column<float>(name);
+            return std::move(result);
+        }
+        case 'D':
+        {
+            auto result = std::make_unique<column_data<double>>();
+            result->get_data() = read_column<double>(name);
+            return std::move(result);
+        }
+        default:
+            throw invalid_table_colum_format();
+        }
     }
 
-    std::unique_ptr<column> get_column(std::string name) const
+    //!parses the numeric column with given TTYPE into output which must have space for naxis(2) values
+    /*!
+    Iw columns can be read into integral or floating point types, Fw.d, Ew.d and Dw.d
+    columns only into floating point types. Fields are parsed in place without
+    copying them, rows are split into chunks parsed on up to threads threads
+    (0 uses all the hardware threads). Blank fields are 0 for integral types and NaN
+    otherwise; TSCAL and TZERO are not applied.
+    Throws invalid_ascii_field_exception if a field is not a number.
+    */
+    template <typename T>
+    void read_column(std::string const& name, T* output, std::size_t threads = 0) const
     {
-        for (auto col : col_metadata)
+        std::size_t const index = this->column_index(name);
+        if (index == this->tfields)
         {
-            if (col.TTYPE() == name)
+            throw key_not_defined_exception();
+        }
+
+        column_descriptor const& field = this->descriptors[index];
+        bool const integer = field.type == 'I';
+        if ((field.type != 'I' && field.type != 'F' && field.type != 'E' && field.type != 'D') ||
+            (!integer && !std::is_floating_point<T>::value))
+        {
+            throw invalid_table_colum_format();
+        }
+        std::size_t const decimals = decimal_digits(this->col_metadata[index].TFORM());
+
+        std::size_t const rows = naxis(2);
+        std::size_t const row_length = naxis(1);
+        char const* first = this->table_data() + field.offset;
+        auto parse_rows = [=](std::size_t begin, std::size_t end) {
+            for (std::size_t row = begin; row < end; row++)
             {
-                switch (get_type(col.TFORM()))
-                {
-                case 'A':
-                {
-                    auto result = std::make_unique<column_data<char>>();
-                    fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                        [](char const* element) -> char {
-                            return *element;
-                        }
-                    );
-                    return std::move(result);
-                }
-                case 'I':
-                {
-                    auto result = std::make_unique<column_data<std::int32_t>>();
-                    fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                        [](char const* element) -> std::int32_t {
-                            return boost::endian::big_to_native(*reinterpret_cast<const std::int32_t*>(element));
-                        }
-                    );
-                    return std::move(result);
-                }
-                case 'F':
-                {
-                    auto result = std::make_unique<column_data<float>>();
-                    fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                        [](char const* element) -> float {
-                            float result = (element[3] << 0) | (element[2] << 8) |
-                                            (element[1] << 16) | (element[0] << 24);
-                            return result;
-                        }
-                    );
-                    return std::move(result);
-                }
-                case 'E':
+                char const* value = first + row * row_length;
+                if (!parse_field(value, value + field.width, decimals, integer, output[row]))
                 {
-                    auto result = std::make_unique<column_data<float>>();
-                    fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                        [](char const* element) -> float {
-                            float result = (element[3] << 0) | (element[2] << 8) |
-                                            (element[1] << 16) | (element[0] << 24);
-                            return result;
-                        }
-                    );
-                    return std::move(result);
+                    throw invalid_ascii_field_exception();
                 }
-                case 'D':
+            }
+        };
+
+        std::size_t const rows_per_chunk = 1 << 14;
+        std::size_t const chunks = (rows + rows_per_chunk - 1) / rows_per_chunk;
+        if (threads == 0)
+        {
+            threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+        }
+        threads = std::max<std::size_t>(std::min(threads, chunks), 1);
+
+        std::atomic<std::size_t> next(0);
+        std::vector<std::exception_ptr> errors(threads);
+        auto worker = [&](std::size_t id) {
+            try
+            {
+                for (std::size_t chunk = next++; chunk < chunks; chunk = next++)
                 {
-                    auto result = std::make_unique<column_data<double>>();
-                    fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                        [](char const* element) -> double {
-                            double result = (element[7] << 0) | (element[6] << 8) |
-                                            (element[5] << 16) | (element[4] << 24) |
-                                            (element[3] << 32) | (element[2] << 40) |
-                                            (element[1] << 48) | (element[0] << 56);
-                            return result;
-                        }
-                    );
-                    return std::move(result);
-                }
-                default:
-                    throw invalid_table_colum_format();
+                    parse_rows(chunk * rows_per_chunk, std::min(rows, (chunk + 1) * rows_per_chunk));
                 }
             }
+            catch (...)
+            {
+                errors[id] = std::current_exception();
+                next = chunks;
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (std::size_t id = 1; id < threads; id++)
+        {
+            workers.emplace_back(worker, id);
+        }
+        worker(0);
+        for (auto& thread : workers)
+        {
+            thread.join();
+        }
+
+        for (auto const& error : errors)
+        {
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
         }
+    }
 
-        std::unique_ptr<column>(nullptr);
+    //!returns the parsed values of the numeric column with given TTYPE, see read_column above
+    template <typename T>
+    std::vector<T> read_column(std::string const& name, std::size_t threads = 0) const
+    {
+        std::vector<T> values(naxis(2));
+        read_column(name, values.data(), threads);
+        return values;
     }
 
     std::size_t column_size(std::string format) const
@@ -201,20 +288,59 @@ public:
     }
 
 private:
-    template<typename VectorType, typename Lambda>
-    void fill_column 
+    //!returns d of a Fw.d, Ew.d or Dw.d format, 0 if there is none
+    static std::size_t decimal_digits(std::string const& format)
+    {
+        std::string form = boost::trim_copy_if(format, [](char c) -> bool {
+                            return c == '\'' || c == ' ';
+                        });
+        std::size_t point = form.find('.');
+        if (point == std::string::npos || point + 1 == form.length())
+        {
+            return 0;
+        }
+        return boost::lexical_cast<std::size_t>(form.substr(point + 1));
+    }
+
+    template <typename T>
+    static typename std::enable_if<std::is_floating_point<T>::value, bool>::type parse_field
     (
-        std::vector<VectorType> &column_container,
-        std::size_t start,
-        std::size_t column_size,
-        Lambda lambda
-    ) const
+        char const* begin,
+        char const* end,
+        std::size_t decimals,
+        bool integer,
+        T& value
+    )
     {
-        column_container.reserve(naxis(2));
-        for (std::size_t i = 0; i < naxis(2); i++)
+        double parsed = 0;
+        if (integer)
         {
-            column_container.emplace_back(lambda(this->data.data() + (i * naxis(1) + start)));
+            std::int64_t number = 0;
+            if (!boost::astronomy::detail::trim_field(begin, end))
+            {
+                value = std::numeric_limits<T>::quiet_NaN();
+                return true;
+            }
+            bool const valid = boost::astronomy::detail::parse_ascii_integer(begin, end, number);
+            value = static_cast<T>(number);
+            return valid;
         }
+        bool const valid = boost::astronomy::detail::parse_ascii_real(begin, end, decimals, parsed);
+        value = static_cast<T>(parsed);
+        return valid;
+    }
+
+    template <typename T>
+    static typename std::enable_if<std::is_integral<T>::value, bool>::type parse_field
+    (
+        char const* begin,
+        char const* end,
+        std::size_t,
+        bool,
+        T& value
+    )
+    {
+        return boost::astronomy::detail::parse_ascii_integer(begin, end, value);
     }
 
 };
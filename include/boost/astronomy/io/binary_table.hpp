@@ -7,14 +7,18 @@
 #include <algorithm>
 #include <complex>
 #include <utility>
+#include <memory>
+#include <cstdint>
 
 #include <boost/lexical_cast.hpp>
-#include <boost/algorithm/string/trim.hpp>
-#include <boost/endian/conversion.hpp>
+
+#include <boost/astronomy/detail/endian.hpp>
 
 #include <boost/astronomy/io/table_extension.hpp>
 #include <boost/astronomy/io/column.hpp>
 #include <boost/astronomy/io/column_data.hpp>
+#include <boost/astronomy/io/column_view.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
 
 namespace boost { namespace astronomy { namespace io {
 
@@ -24,22 +28,28 @@ public:
     binary_table_extension(std::fstream &file) : table_extension(file)
     {
         populate_column_data();
-        std::copy_n(std::istream_iterator<char>(file), naxis(1)*naxis(2), std::back_inserter(data));
-        set_unit_end(file);
+        read_data(file);
     }
 
-    binary_table_extension(std::fstream &file, hdu const& other) : table_extension(file, other)
+    binary_table_extension(std::fstream &file, hdu other) :
+        table_extension(file, std::move(other))
     {
         populate_column_data();
-        std::copy_n(std::istream_iterator<char>(file), naxis(1)*naxis(2), std::back_inserter(data));
-        set_unit_end(file);
+        read_data(file);
     }
 
     binary_table_extension(std::fstream &file, std::streampos pos) : table_extension(file, pos)
     {
         populate_column_data();
-        std::copy_n(std::istream_iterator<char>(file), naxis(1)*naxis(2), std::back_inserter(data));
-        set_unit_end(file);
+        read_data(file);
+    }
+
+    //!creates table which refers to data stored in memory (e.g memory mapped file)
+    //!data is not copied so memory must remain valid for lifetime of the object
+    binary_table_extension(hdu other, char const* data_begin) :
+        table_extension(std::move(other), data_begin)
+    {
+        populate_column_data();
     }
 
     void populate_column_data()
@@ -55,7 +65,11 @@ public:
 
             col_metadata[i].TBCOL(start);
 
-            start += column_size(col_metadata[i].TFORM());
+            descriptors[i] = parse_tform(col_metadata[i].TFORM());
+            descriptors[i].offset = start;
+            read_scaling(i);
+
+            start += descriptors[i].width;
 
             try {
                 col_metadata[i].TTYPE(
@@ -103,426 +117,222 @@ public:
             }
             catch (std::out_of_range e) {/*Do Nothing*/ }
         }
+        index_columns();
     }
 
-    void read_data(std::fstream &file)
+    //!returns the values of column with given TTYPE or nullptr if there is no such column
+    //!name is compared to TTYPE without its quotes and trailing blanks ("FLUX" for 'FLUX    ')
+    //!fields with repeat count other than 1 are returned as std::vector per row
+    std::unique_ptr<column> get_column(std::string const& name) const
     {
-        file.read(&data[0], naxis(1)*naxis(2));
-        set_unit_end(file);
-    }
+        std::size_t index = this->column_index(name);
+        if (index == this->tfields)
+        {
+            return std::unique_ptr<column>(nullptr);
+        }
 
-    std::unique_ptr<column> get_column(std::string name) const
-    {
-        for (auto col : col_metadata)
+        column_descriptor const& field = this->descriptors[index];
+        boost::astronomy::detail::io_timer column_timer(io_event_kind::column,
+            field.width * this->naxis(2));
+        if (field.repeat == 1)
         {
-            if (col.TTYPE() == name)
+            switch (field.type)
             {
-                if (element_count(col.TFORM()) == 1)
-                {
-                    switch (get_type(col.TFORM()))
-                    {
-                    case 'L':
-                    {
-                        auto result = std::make_unique<column_data<bool>>();
-                        fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                            [](char const* element) -> bool {
-                                if (*element == 'T') return true;
-                                else return false;
-                            }
-                        );
-                        return std::move(result);
-                    }
-                    case 'X':
-                    {
-                        auto result = std::make_unique<column_data<char>>();
-                        fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                            [](char const* element) -> char {
-                                return *element;
-                            }
-                        );
-                        return std::move(result);
-                    }
-                    case 'B':
-                    {
-                        auto result = std::make_unique<column_data<std::uint8_t>>();
-                        fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                            [](char const* element) -> std::uint8_t {
-                                return static_cast<std::uint8_t>(*element);
-                            }
-                        );
-                        return std::move(result);
-                    }
-                    case 'I':
-                    {
-                        auto result = std::make_unique<column_data<std::int16_t>>();
-                        fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                            [](char const* element) -> std::int16_t {
-                                return boost::endian::big_to_native(*reinterpret_cast<const std::int16_t*>(element));
-                            }
-                        );
-                        return std::move(result);
-                    }
-                    case 'J':
-                    {
-                        auto result = std::make_unique<column_data<std::int32_t>>();
-                        fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                            [](char const* element) -> std::int32_t {
-                                return boost::endian::big_to_native(*reinterpret_cast<const std::int32_t*>(element));
-                            }
-                        );
-                        return std::move(result);
-                    }
-                    case 'A':
-                    {
-                        auto result = std::make_unique<column_data<char>>();
-                        fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                            [](char const* element) -> char {
-                                return *element;
-                            }
-                        );
-                        return std::move(result);
-                    }
-                    case 'E':
-                    {
-                        auto result = std::make_unique<column_data<float>>();
-                        fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                            [](char const* element) -> float {
-                                float result = (element[3] << 0) | (element[2] << 8) |
-                                                (element[1] << 16) | (element[0] << 24);
-                                return result;
-                            }
-                        );
-                        return std::move(result);
-                    }
-                    case 'D':
-                    {
-                        auto result = std::make_unique<column_data<double>>();
-                        fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                            [](char const* element) -> double {
-                                double result = (element[7] << 0) | (element[6] << 8) |
-                                                (element[5] << 16) | (element[4] << 24) |
-                                                (element[3] << 32) | (element[2] << 40) |
-                                                (element[1] << 48) | (element[0] << 56);
-                                return result;
-                            }
-                        );
-                        return std::move(result);
-                    }
-                    case 'C':
-                    {
-                        auto result = std::make_unique<column_data<std::complex<float>>>();
-                        fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                            [](char const* element) -> std::complex<float> {
-                                std::complex<float> result;
-                                float temp = (element[3] << 0) | (element[2] << 8) |
-                                                (element[1] << 16) | (element[0] << 24);
-                                result.real(temp);
-
-                                element += 4;
-                                temp = (element[3] << 0) | (element[2] << 8) |
-                                        (element[1] << 16) | (element[0] << 24);
-                                result.imag(temp);
-                                return result;
-                            }
-                        );
-                        return std::move(result);
-                    }
-                    case 'M':
-                    {
-                        auto result = std::make_unique<column_data<std::complex<double>>>();
-                        fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                            [](char const* element) -> std::complex<double> {
-                            std::complex<double> result;
-                            double temp = (element[7] << 0) | (element[6] << 8) |
-                                            (element[5] << 16) | (element[4] << 24) |
-                                            (element[3] << 32) | (element[2] << 40) |
-                                            (element[1] << 48) | (element[0] << 56);
-                            result.real(temp);
-
-                            element += 8;
-                            temp = (element[7] << 0) | (element[6] << 8) |
-                                    (element[5] << 16) | (element[4] << 24) |
-                                    (element[3] << 32) | (element[2] << 40) |
-                                    (element[1] << 48) | (element[0] << 56);
-                            result.imag(temp);
-                            return result;
-                            }
-                        );
-                        return std::move(result);
-                    }
-                    case 'P':
-                    {
-                        auto result = std::make_unique<column_data<std::pair<std::int32_t, std::int32_t>>>();
-                        fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                            [](char const* element) -> std::pair<std::int32_t, std::int32_t> {
-                                auto x = boost::endian::big_to_native(*reinterpret_cast<const std::int32_t*>(element));
-                                auto y = boost::endian::big_to_native(*(reinterpret_cast<const std::int32_t*>(element)+1));
-                                return std::make_pair(x,y);
-                            }
-                        );
-                        return std::move(result);
-                    }
-                    default:
-                        throw invalid_table_colum_format();
-                    }
-                }
-                else
-                {
-                    std::size_t num_of_element = element_count(col.TFORM());
-                    switch (get_type(col.TFORM()))
-                    {
-                    case 'L':
-                    {
-                        auto result = std::make_unique<column_data<std::vector<bool>>>();
-                        fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                            [num_of_element](char const* element) -> std::vector<bool> {
-                                std::vector<bool> values;
-                                values.reserve(num_of_element);
-                                for (std::size_t i = 0; i < num_of_element; i++)
-                                {
-                                    if (*element == 'T') values.emplace_back(true);
-                                    else values.emplace_back(false);
-                                }
-                                return values;
-                            }
-                        );
-                        return std::move(result);
-                    }
-                    case 'X':
-                    {
-                        auto result = std::make_unique<column_data<std::vector<char>>>();
-                        fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                            [num_of_element](char const* element) -> std::vector<char> {
-                                return std::vector<char>(element, element + num_of_element);
-                            }
-                        );
-                        return std::move(result);
-                    }
-                    case 'B':
-                    {
-                        auto result = std::make_unique<column_data<std::vector<std::uint8_t>>>();
-                        fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                            [num_of_element](char const* element) -> std::vector<std::uint8_t> {
-                                return std::vector<std::uint8_t>(
-                                    reinterpret_cast<const std::uint8_t*>(element), 
-                                    reinterpret_cast<const std::uint8_t*>(element)+ num_of_element
-                                    );
-                            }
-                        );
-                        return std::move(result);
-                    }
-                    case 'I':
-                    {
-                        auto result = std::make_unique<column_data<std::vector<std::int16_t>>>();
-                        fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                            [num_of_element](char const* element) -> std::vector<std::int16_t> {
-                                std::vector<std::int16_t> values;
-                                values.reserve(num_of_element);
-                                for (std::size_t i = 0; i < num_of_element; i++)
-                                {
-                                    values.emplace_back(
-                                        boost::endian::big_to_native(
-                                            *(reinterpret_cast<const std::int16_t*>(element) +
-                                             num_of_element
-                                        )));
-                                }
-                                return values;
-                            }
-                        );
-                        return std::move(result);
-                    }
-                    case 'J':
-                    {
-                        auto result = std::make_unique<column_data<std::vector<std::int32_t>>>();
-                        fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                            [num_of_element](char const* element) -> std::vector<std::int32_t> {
-                                std::vector<std::int32_t> values;
-                                values.reserve(num_of_element);
-                                for (std::size_t i = 0; i < num_of_element; i++)
-                                {
-                                    values.emplace_back(
-                                        boost::endian::big_to_native(
-                                            *(reinterpret_cast<const std::int32_t*>(element) +
-                                             num_of_element
-                                        )));
-                                }
-                                return values;
-                            }
-                        );
-                        return std::move(result);
-                    }
-                    case 'A':
-                    {
-                        auto result = std::make_unique<column_data<std::vector<char>>>();
-                        fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                            [num_of_element](char const* element) -> std::vector<char> {
-                                return std::vector<char>(element, element + num_of_element);
-                            }
-                        );
-                        return std::move(result);
-                    }
-                    case 'E':
-                    {
-                        auto result = std::make_unique<column_data<std::vector<float>>>();
-                        fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                            [num_of_element](char const* element) -> std::vector<float> {
-                                std::vector<float> values(
-                                    reinterpret_cast<const float*>(element), 
-                                    reinterpret_cast<const float*>(element) + num_of_element
-                                );
-
-                                std::transform(
-                                    values.begin(), 
-                                    values.end(), 
-                                    values.begin(), 
-                                    [](float var) -> float{
-                                        char *native = reinterpret_cast<char*>(&var);
-                                        return (native[3] << 0) | (native[2] << 8) |
-                                                (native[1] << 16) | (native[0] << 24);
-                                    });
-                                return values;
-                            }
-                        );
-                        return std::move(result);
-                    }
-                    case 'D':
-                    {
-                        auto result = std::make_unique<column_data<std::vector<double>>>();
-                        fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                            [num_of_element](char const* element) -> std::vector<double> {
-                                std::vector<double> values(
-                                    reinterpret_cast<const double*>(element), 
-                                    reinterpret_cast<const double*>(element) + num_of_element
-                                );
-
-                                std::transform(
-                                    values.begin(), 
-                                    values.end(), 
-                                    values.begin(), 
-                                    [](double var) -> float{
-                                        char *native = reinterpret_cast<char*>(&var);
-                                        return (native[7] << 0) | (native[6] << 8) |
-                                                (native[5] << 16) | (native[4] << 24) |
-                                                (native[3] << 32) | (native[2] << 40) |
-                                                (native[1] << 48) | (native[0] << 56);
-                                    });
-                                return values;
-                            }
-                        );
-                        return std::move(result);
-                    }
-                    case 'C':
-                    {
-                        auto result = std::make_unique<column_data<std::vector<std::complex<float>>>>();
-                        fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                            [num_of_element](char const* element) -> std::vector<std::complex<float>> {
-                                std::vector<std::complex<float>> values;
-                                values.reserve(num_of_element);
-                                for (auto i = reinterpret_cast<const float*>(element); i != i + num_of_element*2; i+=2)
-                                {
-                                    char const* char_ptr = reinterpret_cast<const char*>(i);
-                                    float real = (char_ptr[3] << 0) | (char_ptr[2] << 8) |
-                                                (char_ptr[1] << 16) | (char_ptr[0] << 24);
-                                    
-                                    char_ptr += 4;
-                                    float img = (char_ptr[3] << 0) | (char_ptr[2] << 8) |
-                                                (char_ptr[1] << 16) | (char_ptr[0] << 24);
-
-                                    values.emplace_back(real, img);
-                                }
-                                return values;
-                            }
-                        );
-                        return std::move(result);
-                    }
-                    case 'M':
-                    {
-                        auto result = std::make_unique<column_data<std::vector<std::complex<double>>>>();
-                        fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                            [num_of_element](char const* element) -> std::vector<std::complex<double>> {
-                            std::vector<std::complex<double>> values;
-                            values.reserve(num_of_element);
-                            for (auto i = reinterpret_cast<const double*>(element); i != i + num_of_element*2; i+=2)
-                                {
-                                    char const* char_ptr = reinterpret_cast<const char*>(i);
-                                    double real = (char_ptr[3] << 0) | (char_ptr[2] << 8) |
-                                                (char_ptr[1] << 16) | (char_ptr[0] << 24);
-                                    
-                                    char_ptr += 4;
-                                    double img = (char_ptr[3] << 0) | (char_ptr[2] << 8) |
-                                                (char_ptr[1] << 16) | (char_ptr[0] << 24);
-
-                                    values.emplace_back(real, img);
-                                }
-                            return values;
-                            }
-                        );
-                        return std::move(result);
-                    }
-                    case 'P':
-                    {
-                        auto result = std::make_unique<column_data<std::vector<std::pair<std::int32_t, std::int32_t>>>>();
-                        fill_column(result->get_data(), col.TBCOL(), column_size(col.TFORM()),
-                            [num_of_element](char const* element) -> std::vector<std::pair<std::int32_t, std::int32_t>> {
-                                std::vector<std::pair<std::int32_t, std::int32_t>> values;
-                                values.reserve(num_of_element);
-                                for (std::size_t i = 0; i < num_of_element; i++)
-                                {
-                                    values.emplace_back(
-                                        boost::endian::big_to_native(
-                                            *(reinterpret_cast<const std::int32_t*>(element) + i)),
-                                        boost::endian::big_to_native(
-                                            *(reinterpret_cast<const std::int32_t*>(element)+ i +1))
-                                        );
-                                }
-                                return values;
-                            }
-                        );
-                        return std::move(result);
-                    }
-                    default:
-                        throw invalid_table_colum_format();
-                    }
-                }
+            case 'L':
+                return make_column<bool>(field, &read_logical);
+            case 'X':
+            case 'A':
+                return make_column<char>(field, &read_big_endian<char>);
+            case 'B':
+                return make_column<std::uint8_t>(field, &read_big_endian<std::uint8_t>);
+            case 'I':
+                return make_column<std::int16_t>(field, &read_big_endian<std::int16_t>);
+            case 'J':
+                return make_column<std::int32_t>(field, &read_big_endian<std::int32_t>);
+            case 'K':
+                return make_column<std::int64_t>(field, &read_big_endian<std::int64_t>);
+            case 'E':
+                return make_column<float>(field, &read_big_endian<float>);
+            case 'D':
+                return make_column<double>(field, &read_big_endian<double>);
+            case 'C':
+                return make_column<std::complex<float>>(field, &read_complex<float>);
+            case 'M':
+                return make_column<std::complex<double>>(field, &read_complex<double>);
+            case 'P':
+                return make_column<std::pair<std::int32_t, std::int32_t>>(field, &read_descriptor);
+            case 'Q':
+                return make_column<std::pair<std::int64_t, std::int64_t>>(field, &read_long_descriptor);
+            default:
+                throw invalid_table_colum_format();
             }
         }
 
-        std::unique_ptr<column>(nullptr);
+        switch (field.type)
+        {
+        case 'L':
+            return make_array_column<bool>(field, field.repeat, &read_logical);
+        case 'X':
+            //bits are returned packed in bytes
+            return make_array_column<char>(field, field.width, &read_big_endian<char>);
+        case 'A':
+            return make_array_column<char>(field, field.repeat, &read_big_endian<char>);
+        case 'B':
+            return make_array_column<std::uint8_t>(field, field.repeat,
+                &read_big_endian<std::uint8_t>);
+        case 'I':
+            return make_array_column<std::int16_t>(field, field.repeat,
+                &read_big_endian<std::int16_t>);
+        case 'J':
+            return make_array_column<std::int32_t>(field, field.repeat,
+                &read_big_endian<std::int32_t>);
+        case 'K':
+            return make_array_column<std::int64_t>(field, field.repeat,
+                &read_big_endian<std::int64_t>);
+        case 'E':
+            return make_array_column<float>(field, field.repeat, &read_big_endian<float>);
+        case 'D':
+            return make_array_column<double>(field, field.repeat, &read_big_endian<double>);
+        case 'C':
+            return make_array_column<std::complex<float>>(field, field.repeat,
+                &read_complex<float>);
+        case 'M':
+            return make_array_column<std::complex<double>>(field, field.repeat,
+                &read_complex<double>);
+        case 'P':
+            return make_array_column<std::pair<std::int32_t, std::int32_t>>(field, field.repeat,
+                &read_descriptor);
+        case 'Q':
+            return make_array_column<std::pair<std::int64_t, std::int64_t>>(field, field.repeat,
+                &read_long_descriptor);
+        default:
+            throw invalid_table_colum_format();
+        }
+    }
+
+    //!returns view of the column with given TTYPE which reads the table data in place
+    //!T must have column_value_traits and match TFORM of the column (E -> float, 1J -> int32_t ...)
+    template <typename T>
+    column_view<T> get_column_view(std::string const& name) const
+    {
+        std::size_t index = this->column_index(name);
+        if (index == this->tfields)
+        {
+            throw key_not_defined_exception();
+        }
+
+        column_descriptor const& field = this->descriptors[index];
+        if (!column_value_traits<T>::accepts(field.type))
+        {
+            throw invalid_table_colum_format();
+        }
+        return column_view<T>(this->table_data() + field.offset, this->naxis(1),
+            this->naxis(2), field.width / sizeof(T));
+    }
+
+    //!returns the position of the heap of variable length arrays from the first row
+    std::size_t heap_offset() const
+    {
+        return this->has_key("THEAP") ? this->value_of<std::size_t>("THEAP") :
+            this->naxis(1) * this->naxis(2);
+    }
+
+    //!returns pointer to the first byte of the heap
+    char const* heap_data() const
+    {
+        return this->table_data() + heap_offset();
+    }
+
+    //!returns view of the variable length array stored at given row of the P or Q column
+    //!the view refers to the heap in place, T must match the element type (1PE -> float ...)
+    template <typename T>
+    column_view<T> get_array_view(std::string const& name, std::size_t row) const
+    {
+        column_descriptor const& field = array_field<T>(name);
+        std::pair<std::size_t, std::size_t> const location = array_location<T>(field, row);
+        return column_view<T>(heap_data() + location.second, location.first * sizeof(T),
+            1, location.first);
     }
 
-    std::size_t column_size(std::string format) const
+    //!gathers the variable length arrays of all the rows into one buffer in native byte order
+    template <typename T>
+    variable_arrays<T> read_arrays(std::string const& name) const
     {
-        std::string form = boost::trim_copy_if(format, [](char c) -> bool {
-                            return c == '\'' || c == ' ';
-                        });
-
-        return form.length() > 1 ?
-            boost::lexical_cast<std::size_t>(form.substr(0, form.length() - 1)) *
-                type_size(form[form.length() - 1]) :
-            type_size(form[0]);
+        column_descriptor const& field = array_field<T>(name);
+        std::size_t const rows = this->naxis(2);
+
+        variable_arrays<T> arrays;
+        arrays.offsets.resize(rows + 1);
+        std::vector<std::pair<std::size_t, std::size_t>> locations(rows);
+        for (std::size_t row = 0; row < rows; row++)
+        {
+            locations[row] = array_location<T>(field, row);
+            arrays.offsets[row + 1] = arrays.offsets[row] + locations[row].first;
+        }
+
+        arrays.values.resize(arrays.offsets[rows]);
+        for (std::size_t row = 0; row < rows; row++)
+        {
+            if (locations[row].first == 0)
+            {
+                continue;
+            }
+            column_view<T>(heap_data() + locations[row].second, locations[row].first * sizeof(T),
+                1, locations[row].first).copy_to(arrays.values.data() + arrays.offsets[row]);
+        }
+        return arrays;
     }
 
-    std::size_t element_count(std::string format) const
+    //!parses binary table TFORM of the form rTa into type, repeat count and width in bytes
+    static column_descriptor parse_tform(std::string const& format)
     {
-        std::string form = boost::trim_copy_if(format, [](char c) -> bool {
-                            return c == '\'' || c == ' ';
-                        });
+        std::size_t position = 0;
+        while (position < format.length() && (format[position] == '\'' || format[position] == ' '))
+        {
+            position++;
+        }
+
+        column_descriptor field;
+        bool has_repeat = false;
+        std::size_t repeat = 0;
+        while (position < format.length() && format[position] >= '0' && format[position] <= '9')
+        {
+            repeat = repeat * 10 + static_cast<std::size_t>(format[position] - '0');
+            has_repeat = true;
+            position++;
+        }
+        if (position == format.length())
+        {
+            throw invalid_table_colum_format();
+        }
 
-        return form.length() > 1 ?
-            boost::lexical_cast<std::size_t>(form.substr(0, form.length() - 1)) :
-            static_cast<std::size_t>(1);
+        field.type = format[position];
+        field.repeat = has_repeat ? repeat : 1;
+        if ((field.type == 'P' || field.type == 'Q') && position + 1 < format.length())
+        {
+            field.array_type = format[position + 1];
+        }
+        field.width = field.type == 'X' ? (field.repeat + 7) / 8 :
+            field.repeat * type_size(field.type);
+        return field;
     }
 
-    char get_type(std::string format) const
+    std::size_t column_size(std::string const& format) const
     {
-        std::string form = boost::trim_copy_if(format, [](char c) -> bool {
-                            return c == '\'' || c == ' ';
-                        });
+        return parse_tform(format).width;
+    }
 
-        return form[form.length() - 1];
+    std::size_t element_count(std::string const& format) const
+    {
+        return parse_tform(format).repeat;
     }
 
-    std::size_t type_size(char type) const
+    char get_type(std::string const& format) const
+    {
+        return parse_tform(format).type;
+    }
+
+    static std::size_t type_size(char type)
     {
         switch (type)
         {
@@ -536,6 +346,8 @@ public:
             return 2;
         case 'J':
             return 4;
+        case 'K':
+            return 8;
         case 'A':
             return 1;
         case 'E':
@@ -548,12 +360,135 @@ public:
             return 16;
         case 'P':
             return 8;
+        case 'Q':
+            return 16;
         default:
             throw invalid_table_colum_format();
         }
     }
 
 private:
+    //!returns the descriptor of P or Q column whose elements can be read as T
+    template <typename T>
+    column_descriptor const& array_field(std::string const& name) const
+    {
+        std::size_t index = this->column_index(name);
+        if (index == this->tfields)
+        {
+            throw key_not_defined_exception();
+        }
+
+        column_descriptor const& field = this->descriptors[index];
+        if ((field.type != 'P' && field.type != 'Q') ||
+            !column_value_traits<T>::accepts(field.array_type))
+        {
+            throw invalid_table_colum_format();
+        }
+        return field;
+    }
+
+    //!returns number of elements of type T and heap offset of the array at given row
+    template <typename T>
+    std::pair<std::size_t, std::size_t> array_location(column_descriptor const& field,
+        std::size_t row) const
+    {
+        char const* element = this->table_data() + row * this->naxis(1) + field.offset;
+        std::int64_t stored_count, stored_offset;
+        if (field.type == 'P')
+        {
+            stored_count = read_big_endian<std::int32_t>(element);
+            stored_offset = read_big_endian<std::int32_t>(element + 4);
+        }
+        else
+        {
+            stored_count = read_big_endian<std::int64_t>(element);
+            stored_offset = read_big_endian<std::int64_t>(element + 8);
+        }
+        if (stored_count < 0 || stored_offset < 0)
+        {
+            throw unexpected_end_of_data_exception();
+        }
+        std::size_t count = static_cast<std::size_t>(stored_count);
+        std::size_t const offset = static_cast<std::size_t>(stored_offset);
+
+        //bit arrays store the number of bits
+        if (field.array_type == 'X')
+        {
+            count = (count + 7) / 8;
+        }
+
+        //corrupt descriptors could wrap the end of the array around
+        std::size_t const heap_size = this->data_size() -
+            std::min(heap_offset(), this->data_size());
+        if (count != 0 && (offset > heap_size || count > (heap_size - offset) / sizeof(T)))
+        {
+            throw unexpected_end_of_data_exception();
+        }
+        return std::make_pair(count, offset);
+    }
+
+    template <typename T>
+    static T read_big_endian(char const* element)
+    {
+        return boost::astronomy::detail::load_big_endian<T>(element);
+    }
+
+    static bool read_logical(char const* element)
+    {
+        return *element == 'T';
+    }
+
+    template <typename T>
+    static std::complex<T> read_complex(char const* element)
+    {
+        return std::complex<T>(read_big_endian<T>(element),
+            read_big_endian<T>(element + sizeof(T)));
+    }
+
+    static std::pair<std::int32_t, std::int32_t> read_descriptor(char const* element)
+    {
+        return std::make_pair(read_big_endian<std::int32_t>(element),
+            read_big_endian<std::int32_t>(element + 4));
+    }
+
+    static std::pair<std::int64_t, std::int64_t> read_long_descriptor(char const* element)
+    {
+        return std::make_pair(read_big_endian<std::int64_t>(element),
+            read_big_endian<std::int64_t>(element + 8));
+    }
+
+    //!creates column with one value per row
+    template <typename Type>
+    std::unique_ptr<column> make_column(column_descriptor const& field,
+        Type (*read_element)(char const*)) const
+    {
+        auto result = std::make_unique<column_data<Type>>();
+        fill_column(result->get_data(), field.offset, field.width, read_element);
+        return std::move(result);
+    }
+
+    //!creates column with count values per row
+    template <typename Type>
+    std::unique_ptr<column> make_array_column(column_descriptor const& field, std::size_t count,
+        Type (*read_element)(char const*)) const
+    {
+        //columns with repeat 0 hold no value, every row gets an empty vector
+        std::size_t const element_size = count == 0 ? 0 : field.width / count;
+        auto result = std::make_unique<column_data<std::vector<Type>>>();
+        fill_column(result->get_data(), field.offset, field.width,
+            [count, element_size, read_element](char const* element) -> std::vector<Type> {
+                std::vector<Type> values;
+                values.reserve(count);
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    values.push_back(read_element(element + i * element_size));
+                }
+                return values;
+            }
+        );
+        return std::move(result);
+    }
+
     template<typename VectorType, typename Lambda>
     void fill_column 
     (
@@ -566,7 +501,7 @@ private:
         column_container.reserve(naxis(2));
         for (std::size_t i = 0; i < naxis(2); i++)
         {
-            column_container.emplace_back(lambda(this->data.data() + (i * naxis(1) + start)));
+            column_container.emplace_back(lambda(this->table_data() + (i * naxis(1) + start)));
         }
     }
 };
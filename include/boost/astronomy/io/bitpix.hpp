@@ -1,6 +1,13 @@
 #ifndef BOOST_ASTRONOMY_IO_BITPIX_HPP
 #define BOOST_ASTRONOMY_IO_BITPIX_HPP
 
+#include <cstddef>
+#include <cstdint>
+
+#include <boost/cstdfloat.hpp>
+
+#include <boost/astronomy/exception/fits_exception.hpp>
+
 namespace boost { namespace astronomy { namespace io {
 
 //! enum used to represetn different values of bitpix in header
@@ -13,6 +20,97 @@ enum class bitpix
     _B64 //! 64-bit IEEE double precesion floating point
 };
 
+//! maps the bitpix value to the type used to store a pixel in memory
+template <bitpix DataType>
+struct bitpix_traits {};
+
+template <>
+struct bitpix_traits<bitpix::B8>
+{
+    typedef std::uint8_t type;
+    static constexpr int value = 8;
+};
+
+template <>
+struct bitpix_traits<bitpix::B16>
+{
+    typedef std::int16_t type;
+    static constexpr int value = 16;
+};
+
+template <>
+struct bitpix_traits<bitpix::B32>
+{
+    typedef std::int32_t type;
+    static constexpr int value = 32;
+};
+
+template <>
+struct bitpix_traits<bitpix::_B32>
+{
+    typedef boost::float32_t type;
+    static constexpr int value = -32;
+};
+
+template <>
+struct bitpix_traits<bitpix::_B64>
+{
+    typedef boost::float64_t type;
+    static constexpr int value = -64;
+};
+
+//! returns the number of bytes used by a single pixel of given bitpix
+inline std::size_t bitpix_size(bitpix value)
+{
+    switch (value)
+    {
+    case bitpix::B8:
+        return 1;
+    case bitpix::B16:
+        return 2;
+    case bitpix::B32:
+        return 4;
+    case bitpix::_B32:
+        return 4;
+    case bitpix::_B64:
+        return 8;
+    }
+    return 0;
+}
+
+//! tag carrying a bitpix value as a compile time constant
+template <bitpix DataType>
+struct bitpix_constant
+{
+    static constexpr bitpix value = DataType;
+    typedef typename bitpix_traits<DataType>::type pixel_type;
+};
+
+template <bitpix DataType>
+constexpr bitpix bitpix_constant<DataType>::value;
+
+//! calls f with the bitpix_constant matching the runtime value and returns its result
+//! this is the only place where a runtime bitpix needs to be switched on, f is then
+//! instantiated once for every pixel type (use a generic lambda taking the tag by value)
+template <typename Function>
+auto dispatch_bitpix(bitpix value, Function&& f) -> decltype(f(bitpix_constant<bitpix::B8>()))
+{
+    switch (value)
+    {
+    case bitpix::B8:
+        return f(bitpix_constant<bitpix::B8>());
+    case bitpix::B16:
+        return f(bitpix_constant<bitpix::B16>());
+    case bitpix::B32:
+        return f(bitpix_constant<bitpix::B32>());
+    case bitpix::_B32:
+        return f(bitpix_constant<bitpix::_B32>());
+    case bitpix::_B64:
+        return f(bitpix_constant<bitpix::_B64>());
+    }
+    throw boost::astronomy::fits_exception();
+}
+
 }}} //namespace boost::astronomy::io
 
 #endif // !BOOST_ASTRONOMY_IO_BITPIX_HPP
@@ -3,43 +3,124 @@
 
 #include <string>
 #include <sstream>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <type_traits>
 
-#include <boost/algorithm/string/trim.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/type.hpp>
 
 #include <boost/astronomy/exception/fits_exception.hpp>
 
+namespace boost { namespace astronomy { namespace detail {
+
+///@cond INTERNAL
+// parses an integer from [begin, end) surrounded by optional spaces
+// returns false if the range is not a valid integer
+template <typename Integer>
+inline bool parse_integer(char const* begin, char const* end, Integer& result)
+{
+    while (begin != end && *begin == ' ') { begin++; }
+    while (end != begin && *(end - 1) == ' ') { end--; }
+
+    bool negative = false;
+    if (begin != end && (*begin == '+' || *begin == '-'))
+    {
+        negative = *begin == '-';
+        begin++;
+    }
+    if (begin == end || (negative && std::is_unsigned<Integer>::value))
+    {
+        return false;
+    }
+
+    Integer value = 0;
+    for (; begin != end; begin++)
+    {
+        if (*begin < '0' || *begin > '9')
+        {
+            return false;
+        }
+        value = static_cast<Integer>(value * 10 + (*begin - '0'));
+    }
+    result = negative ? static_cast<Integer>(0 - value) : value;
+    return true;
+}
+
+// parses a floating point number from [begin, end) surrounded by optional spaces
+// FITS 'D' exponents are accepted, returns false if the range is not a valid number
+template <typename Real>
+inline bool parse_real(char const* begin, char const* end, Real& result)
+{
+    while (begin != end && *begin == ' ') { begin++; }
+    while (end != begin && *(end - 1) == ' ') { end--; }
+
+    char buffer[80];
+    std::size_t const length = static_cast<std::size_t>(end - begin);
+    if (length == 0 || length >= sizeof(buffer))
+    {
+        return false;
+    }
+    for (std::size_t i = 0; i < length; i++)
+    {
+        buffer[i] = (begin[i] == 'D' || begin[i] == 'd') ? 'E' : begin[i];
+    }
+    buffer[length] = '\0';
+
+    char* parsed_end = nullptr;
+    double value = std::strtod(buffer, &parsed_end);
+    if (parsed_end != buffer + length)
+    {
+        return false;
+    }
+    result = static_cast<Real>(value);
+    return true;
+}
+///@endcond
+
+}}} //namespace boost::astronomy::detail
+
 namespace boost { namespace astronomy { namespace io {
 
 //!structure to store a card (80 byte key value pairs as well as comments and history cards)
+/*!
+The card is stored in a fixed 80 char array so that a header is a flat array of
+cards. Bounds of the value (excluding the comment) are found once when the card
+is created, numbers are parsed from them without creating any string.
+*/
 struct card
 {
 private:
-    std::string card_;
+    char card_[80]; //! the card as stored in the file
+    std::uint8_t value_begin_ = 10; //! first char of the value
+    std::uint8_t value_end_ = 80; //! one past the last char of the value
 
 public:
     card()
     {
-        this->card_.reserve(80);
+        std::memset(this->card_, ' ', sizeof(this->card_));
     }
     //! creating card from const char*
     //! it will read 80 char from provided pointer
-    card(char const* c) : card()
+    card(char const* c)
     {
-        this->card_.assign(c, 80);
+        std::memcpy(this->card_, c, sizeof(this->card_));
+        find_value();
     }
 
     //!a string is expected with lenght no more than 80 chars 
     //!this string will be directly stored in the card
     //!string must follow all the standerd of the key, value and comment for card
-    card(std::string str) : card()
+    card(std::string const& str)
     {
         if (str.length() > 80)
         {
             throw invalid_card_length_exception();
         }
-        this->card_ = str.append(80 - str.length(), ' ');
+        assign(str);
     }
 
     //!key, value and optional comments are expected
@@ -52,30 +133,7 @@ public:
         std::string const& comment = ""
     )
     {
-        if (key.length() > 8)
-        {
-            throw invalid_key_length_exception();
-        }
-        if ((comment.length() > 0) && (value.length() + comment.length() > 68))
-        {
-            throw invalid_value_length_exception();
-        }
-        else if (value.length() > 70)
-        {
-            throw invalid_value_length_exception();
-        }
-
-        if (comment.length())
-        {
-            this->card_ = std::string(key).append(8 - key.length(), ' ') +
-                "= " + value + " /" + comment +
-                std::string("").append(68 - value.length() + comment.length(), ' ');
-        }
-        else
-        {
-            this->card_ = std::string(key).append(8 - key.length(), ' ') + "= " +
-                std::string(value).append(70 - key.length(), ' ');
-        }
+        create_card(key, value, comment);
     }
 
     //!this overload supports date and string types
@@ -104,14 +162,12 @@ public:
 
         if (comment.length())
         {
-            this->card_ = std::string(key).append(8 - key.length(), ' ') +
-                "= " + value + " /" + comment +
-                std::string("").append(68 - value.length() + comment.length(), ' ');
+            assign(std::string(key).append(8 - key.length(), ' ') +
+                "= " + value + " /" + comment);
         }
         else
         {
-            this->card_ = std::string(key).append(8 - key.length(), ' ') +
-                "= " + std::string(value).append(70 - key.length(), ' ');
+            assign(std::string(key).append(8 - key.length(), ' ') + "= " + value);
         }
     }
 
@@ -120,11 +176,11 @@ public:
     {
         if (value)
         {
-            create_card(key, std::string("T").insert(0, ' ', 19), comment);
+            create_card(key, std::string("T").insert(0, 19, ' '), comment);
         }
         else
         {
-            create_card(key, std::string("F").insert(0, ' ', 19), comment);
+            create_card(key, std::string("F").insert(0, 19, ' '), comment);
         }
     }
 
@@ -136,7 +192,10 @@ public:
         stream << value;
 
         std::string val = stream.str();
-        val.insert(0, ' ', 20 - val.length());
+        if (val.length() < 20)
+        {
+            val.insert(0, 20 - val.length(), ' ');
+        }
         create_card(key, val, comment);
     }
 
@@ -171,8 +230,7 @@ public:
             throw invalid_value_length_exception();
         }
 
-        this->card_ = std::string(key).append(8 - key.length(), ' ') +
-            "  " + std::string(value).append(70 - key.length(), ' ');
+        assign(std::string(key).append(8 - key.length(), ' ') + "  " + value);
     }
 
     //!if whole value is set to true then string is returned with trailing spaces
@@ -180,9 +238,31 @@ public:
     {
         if (whole)
         {
-            return this->card_.substr(0, 8);
+            return std::string(this->card_, 8);
+        }
+        char const* begin = this->card_;
+        char const* end = this->card_ + 8;
+        while (begin != end && *begin == ' ') { begin++; }
+        while (end != begin && *(end - 1) == ' ') { end--; }
+        return std::string(begin, end);
+    }
+
+    //!returns true if the keyword of the card is key (key must not be longer than 8 chars)
+    bool key_is(char const* key) const
+    {
+        std::size_t const length = std::strlen(key);
+        if (length > 8 || std::memcmp(this->card_, key, length) != 0)
+        {
+            return false;
+        }
+        for (std::size_t i = length; i < 8; i++)
+        {
+            if (this->card_[i] != ' ')
+            {
+                return false;
+            }
         }
-        return boost::algorithm::trim_copy(this->card_.substr(0, 8));
+        return true;
     }
 
     /*!
@@ -198,7 +278,13 @@ public:
     //!returns value portion of card with comment as std::string 
     std::string value_with_comment() const
     {
-        return this->card_.substr(10);
+        return std::string(this->card_ + 10, 70);
+    }
+
+    //!returns the whole card of 80 chars
+    char const* data() const
+    {
+        return this->card_;
     }
 
     //!set value of current card
@@ -212,32 +298,113 @@ public:
         {
             throw invalid_value_length_exception();
         }
-        this->card_.append(70 - value.length(), ' ');
+        std::memset(this->card_ + 10, ' ', 70);
+        std::memcpy(this->card_ + 10, value.data(), value.length());
+        find_value();
     }
 
 private:
+    //!stores str padded with spaces to 80 chars
+    void assign(std::string const& str)
+    {
+        std::memset(this->card_, ' ', sizeof(this->card_));
+        std::memcpy(this->card_, str.data(), std::min<std::size_t>(str.length(), 80));
+        find_value();
+    }
+
+    //!finds the value between column 11 and the comment, '/' inside quoted strings
+    //!do not start the comment, quotes are escaped by writing them twice
+    void find_value()
+    {
+        std::size_t position = 10;
+        while (position < 80 && this->card_[position] == ' ')
+        {
+            position++;
+        }
+
+        if (position < 80 && this->card_[position] == '\'')
+        {
+            position++;
+            while (position < 80)
+            {
+                if (this->card_[position] == '\'')
+                {
+                    if (position + 1 < 80 && this->card_[position + 1] == '\'')
+                    {
+                        position += 2;
+                        continue;
+                    }
+                    break;
+                }
+                position++;
+            }
+        }
+
+        char const* slash = static_cast<char const*>(
+            std::memchr(this->card_ + position, '/', 80 - std::min<std::size_t>(position, 80)));
+        std::size_t end = slash != nullptr ? static_cast<std::size_t>(slash - this->card_) : 80;
+
+        std::size_t begin = 10;
+        while (begin < end && this->card_[begin] == ' ') { begin++; }
+        while (end > begin && this->card_[end - 1] == ' ') { end--; }
+
+        this->value_begin_ = static_cast<std::uint8_t>(begin);
+        this->value_end_ = static_cast<std::uint8_t>(end);
+    }
+
+    char const* value_begin() const
+    {
+        return this->card_ + this->value_begin_;
+    }
+
+    char const* value_end() const
+    {
+        return this->card_ + this->value_end_;
+    }
 
     template <typename ReturnType>
-    ReturnType value_imp(boost::type<ReturnType>) const
+    typename std::enable_if<std::is_integral<ReturnType>::value, ReturnType>::type
+    value_imp(boost::type<ReturnType>) const
     {
-        std::string val = boost::algorithm::trim_copy(
-            this->card_.substr(10, this->card_.find('/') - 10));
-        return boost::lexical_cast<ReturnType>(val);
+        ReturnType result = 0;
+        if (!boost::astronomy::detail::parse_integer(value_begin(), value_end(), result))
+        {
+            throw boost::bad_lexical_cast();
+        }
+        return result;
     }
 
-    bool value_imp(boost::type<bool>) const
+    template <typename ReturnType>
+    typename std::enable_if<std::is_floating_point<ReturnType>::value, ReturnType>::type
+    value_imp(boost::type<ReturnType>) const
     {
-        std::string val = boost::algorithm::trim_copy(
-            this->card_.substr(10, this->card_.find('/') - 10));
-        if (val == "T")
+        ReturnType result = 0;
+        if (!boost::astronomy::detail::parse_real(value_begin(), value_end(), result))
         {
-            return true;
+            throw boost::bad_lexical_cast();
         }
-        return false;
+        return result;
+    }
+
+    template <typename ReturnType>
+    typename std::enable_if<!std::is_arithmetic<ReturnType>::value, ReturnType>::type
+    value_imp(boost::type<ReturnType>) const
+    {
+        return boost::lexical_cast<ReturnType>(std::string(value_begin(), value_end()));
+    }
+
+    std::string value_imp(boost::type<std::string>) const
+    {
+        return std::string(value_begin(), value_end());
+    }
+
+    bool value_imp(boost::type<bool>) const
+    {
+        return value_end() - value_begin() == 1 && *value_begin() == 'T';
     }
 
 };
 
-}}} //namespace boost
+}}} //namespace boost::astronomy::io
 #endif // !BOOST_ASTRONOMY_IO_CARD_HPP
 
@@ -0,0 +1,333 @@
+#ifndef BOOST_ASTRONOMY_IO_CHECKSUM_HPP
+#define BOOST_ASTRONOMY_IO_CHECKSUM_HPP
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <algorithm>
+
+#include <boost/astronomy/io/hdu.hpp>
+#include <boost/astronomy/io/card.hpp>
+#include <boost/astronomy/io/mapped_fits.hpp>
+#include <boost/astronomy/io/fits_writer.hpp>
+#include <boost/astronomy/detail/endian.hpp>
+#include <boost/astronomy/detail/parallel_bands.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+//!state of the CHECKSUM or DATASUM card of an HDU
+enum class checksum_state
+{
+    missing, //! the card is not in the header
+    valid, //! the card matches the HDU
+    invalid //! the card does not match the HDU
+};
+
+//!result of the verification of the CHECKSUM and DATASUM cards of an HDU
+struct hdu_checksum
+{
+    checksum_state checksum = checksum_state::missing; //! CHECKSUM, sum of the whole HDU
+    checksum_state datasum = checksum_state::missing; //! DATASUM, sum of the data unit
+    std::uint32_t hdu_sum = 0; //! ones' complement sum of the header and the data unit
+    std::uint32_t data_sum = 0; //! ones' complement sum of the data unit
+
+    //!returns true when none of the cards present is invalid
+    bool valid() const
+    {
+        return this->checksum != checksum_state::invalid &&
+            this->datasum != checksum_state::invalid;
+    }
+};
+
+///@cond INTERNAL
+namespace detail_checksum {
+
+std::size_t const block_words = 720; // 32 bit words of a 2880 byte block
+std::size_t const min_blocks_per_thread = 256;
+
+// adds the carries above 32 bits back into the low bits
+inline std::uint32_t fold(std::uint64_t sum)
+{
+    while (sum >> 32)
+    {
+        sum = (sum & 0xffffffff) + (sum >> 32);
+    }
+    return static_cast<std::uint32_t>(sum);
+}
+
+// ones' complement sum of the big endian 32 bit words of size bytes, a last partial word
+// is completed with zeros as the padding of the data unit would be
+// every block is byte swapped in a copy with the SIMD swap of the library and its words
+// are added into a 64 bit accumulator, both loops vectorize
+inline std::uint32_t sum_words(char const* data, std::size_t size)
+{
+    std::uint32_t words[block_words];
+    std::uint64_t sum = 0;
+    while (size > 0)
+    {
+        std::size_t const bytes = std::min(size, sizeof(words));
+        std::size_t const count = (bytes + 3) / 4;
+        words[count - 1] = 0;
+        std::memcpy(words, data, bytes);
+        boost::astronomy::detail::big_to_native_array(words, count);
+
+        std::uint64_t block_sum = 0;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            block_sum += words[i];
+        }
+        sum += block_sum;
+        data += bytes;
+        size -= bytes;
+    }
+    return fold(sum);
+}
+
+// returns the characters between the quotes of a string value without trailing spaces
+inline std::string unquoted(std::string value)
+{
+    std::size_t const first = value.find('\'');
+    std::size_t const last = value.rfind('\'');
+    if (first != std::string::npos && last > first)
+    {
+        value = value.substr(first + 1, last - first - 1);
+    }
+    value.erase(value.find_last_not_of(' ') + 1);
+    return value;
+}
+
+// returns the position of the card with given key (before END) or cards.size()
+inline std::size_t find_card(std::vector<card> const& cards, char const* key)
+{
+    for (std::size_t i = 0; i < cards.size(); i++)
+    {
+        if (cards[i].key_is(key))
+        {
+            return i;
+        }
+    }
+    return cards.size();
+}
+
+} // namespace detail_checksum
+///@endcond
+
+//!Returns the ones' complement sum of two checksums
+//!sums of consecutive parts of a unit (starting at multiples of 4 bytes) add up to the
+//!checksum of the whole unit in any order
+inline std::uint32_t checksum_add(std::uint32_t a, std::uint32_t b)
+{
+    return detail_checksum::fold(static_cast<std::uint64_t>(a) + b);
+}
+
+//!Returns the FITS checksum (32 bit ones' complement sum of the big endian words) of size
+//!bytes, the blocks are shared by up to threads threads (0 uses all the hardware threads)
+inline std::uint32_t fits_checksum(char const* data, std::size_t size, std::size_t threads = 1)
+{
+    if (threads == 0)
+    {
+        threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    std::size_t const blocks = (size + 2879) / 2880;
+    std::size_t const bands = std::max<std::size_t>(std::min(threads,
+        blocks / detail_checksum::min_blocks_per_thread), 1);
+
+    std::vector<std::uint32_t> partial_sums(bands, 0);
+    boost::astronomy::detail::parallel_bands(bands, bands, 1,
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t band = begin; band < end; band++)
+            {
+                std::size_t const first = band * blocks / bands * 2880;
+                std::size_t const last = std::min(size, (band + 1) * blocks / bands * 2880);
+                partial_sums[band] = detail_checksum::sum_words(data + first, last - first);
+            }
+        });
+
+    std::uint32_t sum = 0;
+    for (std::uint32_t partial : partial_sums)
+    {
+        sum = checksum_add(sum, partial);
+    }
+    return sum;
+}
+
+//!Returns the 16 characters of the CHECKSUM card encoding the complement of sum
+/*!
+Uses the ASCII encoding of Seaman, Pence and Rots: the characters are alphanumeric
+and, stored from the 12th column of a card, they add ~sum to the sum of a header
+where they replace '0000000000000000'.
+*/
+inline std::string encode_checksum(std::uint32_t sum)
+{
+    static char const excluded[] = {0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x5b, 0x5c,
+        0x5d, 0x5e, 0x5f, 0x60};
+    std::uint32_t const value = ~sum;
+    char encoded[16];
+    for (std::size_t i = 0; i < 4; i++)
+    {
+        int const byte = static_cast<int>((value >> (24 - 8 * i)) & 0xff);
+        int characters[4];
+        std::fill(characters, characters + 4, byte / 4 + 0x30);
+        characters[0] += byte % 4;
+
+        //moves pairs of characters away from the punctuation keeping their sum
+        for (bool changed = true; changed; )
+        {
+            changed = false;
+            for (char excluded_character : excluded)
+            {
+                for (std::size_t j = 0; j < 4; j += 2)
+                {
+                    if (characters[j] == excluded_character ||
+                        characters[j + 1] == excluded_character)
+                    {
+                        characters[j]++;
+                        characters[j + 1]--;
+                        changed = true;
+                    }
+                }
+            }
+        }
+        for (std::size_t j = 0; j < 4; j++)
+        {
+            encoded[4 * j + i] = static_cast<char>(characters[j]);
+        }
+    }
+
+    //the characters start one byte before a 32 bit word of the card
+    std::string result(16, ' ');
+    for (std::size_t i = 0; i < 16; i++)
+    {
+        result[i] = encoded[(i + 15) % 16];
+    }
+    return result;
+}
+
+//!Returns the cards of a header with the DATASUM and CHECKSUM cards of given data sum
+/*!
+Existing DATASUM and CHECKSUM cards are replaced, otherwise they are added before
+END, which is appended when missing. data_sum is the fits_checksum of the data unit
+as written in the file (big endian, zero padding does not change it).
+*/
+inline std::vector<card> checksum_cards(std::vector<card> cards, std::uint32_t data_sum)
+{
+    namespace dcs = detail_checksum;
+    std::size_t end = dcs::find_card(cards, "END");
+    if (end == cards.size())
+    {
+        cards.emplace_back();
+        cards.back().create_commentary_card("END", "");
+    }
+
+    card const datasum_card("DATASUM", "'" + std::to_string(data_sum) + "'");
+    card const zero_card("CHECKSUM", "'0000000000000000'");
+    for (card const* added : {&zero_card, &datasum_card})
+    {
+        std::size_t const position = dcs::find_card(cards, added->key().c_str());
+        if (position < cards.size())
+        {
+            cards[position] = *added;
+        }
+        else
+        {
+            end = dcs::find_card(cards, "END");
+            cards.insert(cards.begin() + static_cast<std::ptrdiff_t>(end), *added);
+        }
+    }
+
+    end = dcs::find_card(cards, "END");
+    std::string unit;
+    for (std::size_t i = 0; i <= end; i++)
+    {
+        unit.append(cards[i].data(), 80);
+    }
+    unit.append(hdu::block_aligned_size(unit.size()) - unit.size(), ' ');
+    std::uint32_t const sum = checksum_add(dcs::sum_words(unit.data(), unit.size()), data_sum);
+
+    cards[dcs::find_card(cards, "CHECKSUM")] = card("CHECKSUM",
+        "'" + encode_checksum(sum) + "'");
+    return cards;
+}
+
+//!Writes an HDU with its DATASUM and CHECKSUM cards
+/*!
+bytes holds the data unit of size bytes already in FITS byte order (without its
+padding), it is summed on threads threads before the header is written.
+*/
+inline void write_checksummed
+(
+    fits_writer& writer,
+    std::vector<card> const& cards,
+    char const* bytes,
+    std::size_t size,
+    std::size_t threads = 1
+)
+{
+    writer.write_header(checksum_cards(cards, fits_checksum(bytes, size, threads)));
+    writer.write_raw_data(bytes, size);
+}
+
+//!Verifies the CHECKSUM and DATASUM cards of an HDU stored in memory
+/*!
+header_unit holds the header blocks as stored in the file and data the data unit of
+data_size bytes including its padding (zero padding may be left out).
+*/
+inline hdu_checksum verify_checksum
+(
+    hdu const& header,
+    char const* header_unit,
+    std::size_t header_size,
+    char const* data,
+    std::size_t data_size,
+    std::size_t threads = 1
+)
+{
+    hdu_checksum result;
+    result.data_sum = fits_checksum(data, data_size, threads);
+    result.hdu_sum = checksum_add(detail_checksum::sum_words(header_unit, header_size),
+        result.data_sum);
+
+    if (header.has_key("DATASUM"))
+    {
+        std::string const value = detail_checksum::unquoted(
+            header.value_of<std::string>("DATASUM"));
+        result.datasum = value == std::to_string(result.data_sum) ?
+            checksum_state::valid : checksum_state::invalid;
+    }
+    if (header.has_key("CHECKSUM"))
+    {
+        result.checksum = result.hdu_sum == 0 || result.hdu_sum == 0xffffffff ?
+            checksum_state::valid : checksum_state::invalid;
+    }
+    return result;
+}
+
+//!Verifies the CHECKSUM and DATASUM cards of every HDU of a mapped or buffered file
+/*!
+The blocks already in memory are summed, so verifying a buffered_fits read by the
+first stage of run_fits_pipeline costs no extra read of the file. The blocks of an
+HDU are shared by up to threads threads (0 uses all the hardware threads).
+*/
+inline std::vector<hdu_checksum> verify_checksums(mapped_fits const& fits, std::size_t threads = 0)
+{
+    std::vector<hdu_checksum> results;
+    char const* file_end = fits.begin() + fits.file_size();
+    for (std::size_t i = 0; i < fits.size(); i++)
+    {
+        hdu const& header = fits.get_header(i);
+        data_unit_view const unit = fits.get_data_unit(i);
+        std::size_t const header_size = hdu::block_aligned_size(header.get_cards().size() * 80);
+        std::size_t const data_size = std::min(hdu::block_aligned_size(unit.size),
+            static_cast<std::size_t>(file_end - unit.begin));
+        results.push_back(verify_checksum(header, unit.begin - header_size, header_size,
+            unit.begin, data_size, threads));
+    }
+    return results;
+}
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_CHECKSUM_HPP
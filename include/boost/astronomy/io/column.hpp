@@ -9,6 +9,18 @@
 
 namespace boost { namespace astronomy { namespace io {
 
+//!TFORM, TSCAL and TZERO of a table column parsed once when the header is read
+struct column_descriptor
+{
+    char type = 'A'; //! type code of the field (letter of binary TFORM, first of ASCII TFORM)
+    char array_type = 0; //! type code of elements of variable length arrays (P and Q fields)
+    std::size_t repeat = 1; //! number of elements in the field
+    std::size_t offset = 0; //! offset of the field from the beginning of a row in bytes
+    std::size_t width = 0; //! size of the field in bytes
+    double scale = 1; //! value of TSCAL
+    double zero = 0; //! value of TZERO
+};
+
 struct column
 {
 private:
@@ -18,7 +18,7 @@ private:
     std::vector<Type> column_data_;
 
 public:
-    std::vector<Type> get_data() const
+    std::vector<Type> const& get_data() const
     {
         return column_data_;
     }
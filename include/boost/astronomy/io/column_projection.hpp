@@ -0,0 +1,144 @@
+#ifndef BOOST_ASTRONOMY_IO_COLUMN_PROJECTION_HPP
+#define BOOST_ASTRONOMY_IO_COLUMN_PROJECTION_HPP
+
+#include <istream>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+#include <boost/astronomy/io/hdu.hpp>
+#include <boost/astronomy/io/binary_table.hpp>
+#include <boost/astronomy/io/column_view.hpp>
+#include <boost/astronomy/io/image_section.hpp>
+#include <boost/astronomy/detail/endian.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+//!Reads only the requested columns of a binary table straight from the file
+/*!
+Columns are registered with add() along with the vector receiving their values.
+read() then walks the table in chunks of rows; for every chunk the byte ranges of
+the requested columns are read (ranges closer than max_gap bytes are fetched in
+a single read), written directly into the vectors and converted to native byte
+order in place. Neither the full table nor a full row is ever kept in memory.
+Columns with a repeat count are stored row after row, repeat values per row.
+*/
+struct binary_table_projection
+{
+protected:
+    //!column selected by add()
+    struct requested_column
+    {
+        std::size_t offset; //! offset of the column inside a row
+        std::size_t length; //! bytes of the column in a row
+        char* destination; //! first byte of the vector receiving values
+        void (*to_native)(char*, std::size_t); //! converts given bytes into native order
+    };
+
+    std::istream* file = nullptr; //! stream containing the table
+    binary_table_extension table; //! header and column metadata of the table
+    std::streamoff data_offset = 0; //! position of the first row in the file
+    std::vector<requested_column> requested; //! columns to be read
+
+public:
+    //!creates projection of the binary table whose data unit starts at data_start
+    binary_table_projection(std::istream& stream, hdu const& header, std::streamoff data_start) :
+        file(&stream), table(checked_header(header), nullptr), data_offset(data_start) {}
+
+    //!returns the number of rows in the table
+    std::size_t rows() const
+    {
+        return this->table.naxis(2);
+    }
+
+    //!returns the header and column metadata of the table
+    binary_table_extension const& get_table() const
+    {
+        return this->table;
+    }
+
+    //!requests the column with given name to be read into values
+    //!values is resized to hold all the rows, it must not be resized until read() returns
+    template <typename T>
+    binary_table_projection& add(std::string const& name, std::vector<T>& values)
+    {
+        std::size_t index = this->table.column_index(name);
+        if (index == this->table.columns())
+        {
+            throw key_not_defined_exception();
+        }
+
+        column_descriptor const& field = this->table.get_descriptors()[index];
+        if (!column_value_traits<T>::accepts(field.type))
+        {
+            throw invalid_table_colum_format();
+        }
+
+        std::size_t const length = field.width;
+        std::size_t const repeat = length / sizeof(T);
+        values.resize(this->rows() * repeat);
+
+        requested_column request;
+        request.offset = field.offset;
+        request.length = length;
+        request.destination = reinterpret_cast<char*>(values.data());
+        request.to_native = &bytes_to_native<typename column_value_traits<T>::scalar_type>;
+        this->requested.push_back(request);
+        return *this;
+    }
+
+    //!reads all the requested columns rows_per_chunk rows at a time
+    void read(std::size_t rows_per_chunk = 4096, std::size_t max_gap = 2880)
+    {
+        std::size_t const row_length = this->table.naxis(1);
+        rows_per_chunk = std::max<std::size_t>(rows_per_chunk, 1);
+
+        std::vector<boost::astronomy::detail::section_segment> segments;
+        for (std::size_t first_row = 0; first_row < this->rows(); first_row += rows_per_chunk)
+        {
+            std::size_t const chunk_rows = std::min(rows_per_chunk, this->rows() - first_row);
+
+            segments.clear();
+            for (auto const& request : this->requested)
+            {
+                for (std::size_t row = first_row; row < first_row + chunk_rows; row++)
+                {
+                    segments.push_back(boost::astronomy::detail::section_segment{
+                        this->data_offset + static_cast<std::streamoff>(row * row_length + request.offset),
+                        request.length, request.destination + row * request.length});
+                }
+            }
+            boost::astronomy::detail::read_section_segments(*this->file, segments, max_gap);
+
+            for (auto const& request : this->requested)
+            {
+                request.to_native(request.destination + first_row * request.length,
+                    chunk_rows * request.length);
+            }
+        }
+    }
+
+protected:
+    static hdu const& checked_header(hdu const& header)
+    {
+        if (!header.has_key("XTENSION") ||
+            header.value_of<std::string>("XTENSION") != "'BINTABLE'")
+        {
+            throw wrong_extension_type();
+        }
+        return header;
+    }
+
+    template <typename Scalar>
+    static void bytes_to_native(char* bytes, std::size_t length)
+    {
+        boost::astronomy::detail::big_to_native_array(reinterpret_cast<Scalar*>(bytes),
+            length / sizeof(Scalar));
+    }
+};
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_COLUMN_PROJECTION_HPP
@@ -0,0 +1,298 @@
+#ifndef BOOST_ASTRONOMY_IO_COLUMN_VIEW_HPP
+#define BOOST_ASTRONOMY_IO_COLUMN_VIEW_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <complex>
+#include <iterator>
+#include <vector>
+
+#include <boost/astronomy/detail/endian.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+//!describes which TFORM types can be read as values of type T
+//!scalar_type is the type whose bytes are swapped and scalars is the number of them in T
+template <typename T>
+struct column_value_traits {};
+
+template <>
+struct column_value_traits<char>
+{
+    typedef char scalar_type;
+    static constexpr std::size_t scalars = 1;
+    static bool accepts(char type) { return type == 'A' || type == 'L' || type == 'X'; }
+    static char load(char const* source) { return *source; }
+};
+
+template <>
+struct column_value_traits<std::uint8_t>
+{
+    typedef std::uint8_t scalar_type;
+    static constexpr std::size_t scalars = 1;
+    static bool accepts(char type) { return type == 'B'; }
+    static std::uint8_t load(char const* source) { return static_cast<std::uint8_t>(*source); }
+};
+
+template <>
+struct column_value_traits<std::int16_t>
+{
+    typedef std::int16_t scalar_type;
+    static constexpr std::size_t scalars = 1;
+    static bool accepts(char type) { return type == 'I'; }
+    static std::int16_t load(char const* source)
+    {
+        return boost::astronomy::detail::load_big_endian<std::int16_t>(source);
+    }
+};
+
+template <>
+struct column_value_traits<std::int32_t>
+{
+    typedef std::int32_t scalar_type;
+    static constexpr std::size_t scalars = 1;
+    static bool accepts(char type) { return type == 'J'; }
+    static std::int32_t load(char const* source)
+    {
+        return boost::astronomy::detail::load_big_endian<std::int32_t>(source);
+    }
+};
+
+template <>
+struct column_value_traits<std::int64_t>
+{
+    typedef std::int64_t scalar_type;
+    static constexpr std::size_t scalars = 1;
+    static bool accepts(char type) { return type == 'K'; }
+    static std::int64_t load(char const* source)
+    {
+        return boost::astronomy::detail::load_big_endian<std::int64_t>(source);
+    }
+};
+
+template <>
+struct column_value_traits<float>
+{
+    typedef float scalar_type;
+    static constexpr std::size_t scalars = 1;
+    static bool accepts(char type) { return type == 'E'; }
+    static float load(char const* source)
+    {
+        return boost::astronomy::detail::load_big_endian<float>(source);
+    }
+};
+
+template <>
+struct column_value_traits<double>
+{
+    typedef double scalar_type;
+    static constexpr std::size_t scalars = 1;
+    static bool accepts(char type) { return type == 'D'; }
+    static double load(char const* source)
+    {
+        return boost::astronomy::detail::load_big_endian<double>(source);
+    }
+};
+
+template <>
+struct column_value_traits<std::complex<float>>
+{
+    typedef float scalar_type;
+    static constexpr std::size_t scalars = 2;
+    static bool accepts(char type) { return type == 'C'; }
+    static std::complex<float> load(char const* source)
+    {
+        return std::complex<float>(boost::astronomy::detail::load_big_endian<float>(source),
+            boost::astronomy::detail::load_big_endian<float>(source + sizeof(float)));
+    }
+};
+
+template <>
+struct column_value_traits<std::complex<double>>
+{
+    typedef double scalar_type;
+    static constexpr std::size_t scalars = 2;
+    static bool accepts(char type) { return type == 'M'; }
+    static std::complex<double> load(char const* source)
+    {
+        return std::complex<double>(boost::astronomy::detail::load_big_endian<double>(source),
+            boost::astronomy::detail::load_big_endian<double>(source + sizeof(double)));
+    }
+};
+
+//!Read only view of a column of a binary table which refers to the table data in place
+/*!
+The view stores only the address of the column in the first row, the row
+length (stride) and the number of rows and values per row, so creating it
+needs no allocation. Values are converted from big endian when they are
+accessed; copy_to() converts whole columns into caller provided storage.
+Values of a column with repeat count r are visited row after row, r values
+per row. The view is valid as long as the table data it refers to.
+*/
+template <typename T>
+struct column_view
+{
+public:
+    typedef T value_type;
+    typedef column_value_traits<T> traits_type;
+
+    //!random access iterator returning values of the column by value
+    struct const_iterator
+    {
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef T const* pointer;
+        typedef T reference;
+
+        column_view const* view = nullptr;
+        std::size_t index = 0;
+
+        T operator*() const { return (*view)[index]; }
+        T operator[](difference_type n) const { return (*view)[index + n]; }
+
+        const_iterator& operator++() { ++index; return *this; }
+        const_iterator& operator--() { --index; return *this; }
+        const_iterator operator++(int) { const_iterator before = *this; ++index; return before; }
+        const_iterator operator--(int) { const_iterator before = *this; --index; return before; }
+        const_iterator& operator+=(difference_type n) { index += n; return *this; }
+        const_iterator& operator-=(difference_type n) { index -= n; return *this; }
+        const_iterator operator+(difference_type n) const { const_iterator it = *this; return it += n; }
+        const_iterator operator-(difference_type n) const { const_iterator it = *this; return it -= n; }
+
+        difference_type operator-(const_iterator const& other) const
+        {
+            return static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+        }
+
+        bool operator==(const_iterator const& other) const { return index == other.index; }
+        bool operator!=(const_iterator const& other) const { return index != other.index; }
+        bool operator<(const_iterator const& other) const { return index < other.index; }
+        bool operator>(const_iterator const& other) const { return index > other.index; }
+        bool operator<=(const_iterator const& other) const { return index <= other.index; }
+        bool operator>=(const_iterator const& other) const { return index >= other.index; }
+    };
+
+protected:
+    char const* first = nullptr; //! column in the first row
+    std::size_t stride = 0; //! bytes from a row to the next one
+    std::size_t row_count = 0; //! number of rows
+    std::size_t per_row = 1; //! values of the column in every row
+
+public:
+    column_view() {}
+
+    //!creates view of rows rows starting at start, each holding repeat values of type T
+    column_view(char const* start, std::size_t row_bytes, std::size_t rows, std::size_t repeat) :
+        first(start), stride(row_bytes), row_count(rows), per_row(repeat) {}
+
+    //!returns the number of values (rows * repeat) in the column
+    std::size_t size() const
+    {
+        return this->row_count * this->per_row;
+    }
+
+    //!returns true when the column has no values
+    bool empty() const
+    {
+        return this->size() == 0;
+    }
+
+    //!returns the number of rows in the column
+    std::size_t rows() const
+    {
+        return this->row_count;
+    }
+
+    //!returns the number of values in every row
+    std::size_t repeat() const
+    {
+        return this->per_row;
+    }
+
+    //!returns the value at given position counting values row after row
+    T operator[](std::size_t index) const
+    {
+        return (*this)(index / this->per_row, index % this->per_row);
+    }
+
+    //!returns the value at given position inside the given row
+    T operator()(std::size_t row, std::size_t element) const
+    {
+        return traits_type::load(this->first + row * this->stride + element * sizeof(T));
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator{this, 0};
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator{this, this->size()};
+    }
+
+    //!converts all the values in native byte order into destination holding size() values
+    void copy_to(T* destination) const
+    {
+        std::size_t const row_length = this->per_row * sizeof(T);
+        char* target = reinterpret_cast<char*>(destination);
+        if (this->stride == row_length)
+        {
+            std::memcpy(target, this->first, row_length * this->row_count);
+        }
+        else
+        {
+            for (std::size_t row = 0; row < this->row_count; row++)
+            {
+                std::memcpy(target + row * row_length, this->first + row * this->stride, row_length);
+            }
+        }
+        boost::astronomy::detail::big_to_native_array(
+            reinterpret_cast<typename traits_type::scalar_type*>(destination),
+            this->size() * traits_type::scalars);
+    }
+
+    //!returns all the values in native byte order
+    std::vector<T> to_vector() const
+    {
+        std::vector<T> values(this->size());
+        if (!values.empty())
+        {
+            this->copy_to(values.data());
+        }
+        return values;
+    }
+};
+
+//!Variable length arrays of all the rows of a column gathered into one buffer
+//!array of row r is values[offsets[r]] to values[offsets[r + 1]] (excluded)
+template <typename T>
+struct variable_arrays
+{
+    std::vector<T> values; //! elements of all the arrays in native byte order
+    std::vector<std::size_t> offsets; //! position of array of every row in values, rows + 1 entries
+
+    //!returns the number of rows
+    std::size_t rows() const
+    {
+        return this->offsets.empty() ? 0 : this->offsets.size() - 1;
+    }
+
+    //!returns the number of elements in the array of given row
+    std::size_t length(std::size_t row) const
+    {
+        return this->offsets[row + 1] - this->offsets[row];
+    }
+
+    //!returns the first element of the array of given row
+    T const* data(std::size_t row) const
+    {
+        return this->values.data() + this->offsets[row];
+    }
+};
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_COLUMN_VIEW_HPP
@@ -0,0 +1,499 @@
+#ifndef BOOST_ASTRONOMY_IO_COMPRESSED_IMAGE_HPP
+#define BOOST_ASTRONOMY_IO_COMPRESSED_IMAGE_HPP
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <type_traits>
+
+#include <boost/astronomy/io/hdu.hpp>
+#include <boost/astronomy/io/bitpix.hpp>
+#include <boost/astronomy/io/binary_table.hpp>
+#include <boost/astronomy/io/image_section.hpp>
+#include <boost/astronomy/detail/endian.hpp>
+#include <boost/astronomy/detail/tile_compression.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+//!algorithms used to compress the tiles of an image
+enum class tile_compression
+{
+    rice_1, //! Rice coding of pixel differences (RICE_1 or RICE_ONE)
+    gzip_1, //! gzip of big endian pixels
+    gzip_2 //! gzip of big endian pixels with bytes shuffled by significance
+};
+
+//!Image stored as compressed tiles in a binary table (the FITS tiled image convention)
+/*!
+Every row of the table holds one tile in its COMPRESSED_DATA column, tiles
+are boxes of ZTILEn pixels (smaller at the edges) ordered along ZNAXIS1 first.
+Tiles are independent so they are decoded on up to the given number of threads,
+reading a section decodes only the tiles overlapping it. Only lossless
+compression is supported, i.e. integer images and floating point images
+compressed with GZIP without quantization. The COMPRESSED_DATA column may hold
+either 32 bit (1PB) or 64 bit (1QB) array descriptors. Rice tiles are decoded
+as integers of BYTEPIX bytes (4 when it is absent) and converted to the pixel
+type. The table must outlive this object.
+*/
+template <bitpix DataType>
+struct compressed_image
+{
+public:
+    typedef typename bitpix_traits<DataType>::type pixel_type;
+
+protected:
+    binary_table_extension const* table = nullptr; //! table holding the tiles
+    tile_compression compression = tile_compression::rice_1; //! algorithm used for tiles
+    std::vector<std::size_t> shape; //! ZNAXISn of the image
+    std::vector<std::size_t> tile_shape; //! ZTILEn of the tiles
+    std::vector<std::size_t> tiles_per_axis; //! number of tiles along every axis
+    std::size_t block_size = 32; //! pixels in a Rice block
+    std::size_t byte_pixel = 4; //! bytes of the pixels Rice coding worked on (BYTEPIX)
+    column_descriptor data_column; //! COMPRESSED_DATA column
+    std::size_t heap_offset = 0; //! position of the heap in table data
+
+public:
+    //!reads the compression keywords of the table
+    compressed_image(binary_table_extension const& tiles) : table(&tiles)
+    {
+        if (!is_compressed_image(tiles))
+        {
+            throw wrong_extension_type();
+        }
+        if (tiles.value_of<int>("ZBITPIX") != bitpix_traits<DataType>::value)
+        {
+            throw wrong_extension_type();
+        }
+
+        std::string const algorithm = string_value(tiles, "ZCMPTYPE");
+        if (algorithm == "RICE_1" || algorithm == "RICE_ONE")
+        {
+            compression = tile_compression::rice_1;
+        }
+        else if (algorithm == "GZIP_1")
+        {
+            compression = tile_compression::gzip_1;
+        }
+        else if (algorithm == "GZIP_2")
+        {
+            compression = tile_compression::gzip_2;
+        }
+        else
+        {
+            throw unsupported_compression_exception();
+        }
+
+        //quantized floating point images and Rice coded floats are lossy
+        if (tiles.column_index("ZSCALE") != tiles.columns() ||
+            (compression == tile_compression::rice_1 && !std::is_integral<pixel_type>::value))
+        {
+            throw unsupported_compression_exception();
+        }
+
+        std::size_t const dimensions = tiles.value_of<std::size_t>("ZNAXIS");
+        for (std::size_t axis = 1; axis <= dimensions; axis++)
+        {
+            std::string const number = std::to_string(axis);
+            shape.push_back(tiles.value_of<std::size_t>("ZNAXIS" + number));
+            std::size_t const tile = tiles.has_key("ZTILE" + number) ?
+                tiles.value_of<std::size_t>("ZTILE" + number) : (axis == 1 ? shape.back() : 1);
+            tile_shape.push_back(std::max<std::size_t>(tile, 1));
+            tiles_per_axis.push_back((shape.back() + tile_shape.back() - 1) / tile_shape.back());
+        }
+
+        read_parameters(tiles);
+
+        std::size_t const column = tiles.column_index("COMPRESSED_DATA");
+        if (column == tiles.columns())
+        {
+            throw unsupported_compression_exception();
+        }
+        data_column = tiles.get_descriptors()[column];
+        if (data_column.type != 'P' && data_column.type != 'Q')
+        {
+            throw invalid_table_colum_format();
+        }
+
+        heap_offset = tiles.heap_offset();
+
+        if (tile_count() != tiles.naxis(2))
+        {
+            throw invalid_compressed_tile_exception();
+        }
+    }
+
+    //!returns true if the HDU is a binary table holding a tile compressed image
+    static bool is_compressed_image(hdu const& header)
+    {
+        return header.has_key("ZIMAGE") && header.value_of<bool>("ZIMAGE") &&
+            header.has_key("XTENSION") &&
+            header.value_of<std::string>("XTENSION") == "'BINTABLE'";
+    }
+
+    //!returns the size of the image along every axis (ZNAXISn)
+    std::vector<std::size_t> const& get_shape() const
+    {
+        return this->shape;
+    }
+
+    //!returns the size of tiles along every axis (ZTILEn)
+    std::vector<std::size_t> const& get_tile_shape() const
+    {
+        return this->tile_shape;
+    }
+
+    //!returns the algorithm used to compress tiles
+    tile_compression get_compression() const
+    {
+        return this->compression;
+    }
+
+    //!returns the number of tiles in the image
+    std::size_t tile_count() const
+    {
+        std::size_t count = this->tiles_per_axis.empty() ? 0 : 1;
+        for (std::size_t tiles : this->tiles_per_axis)
+        {
+            count *= tiles;
+        }
+        return count;
+    }
+
+    //!decodes the whole image, pixels are returned along ZNAXIS1 first
+    //!threads equal to 0 uses all the hardware threads
+    std::vector<pixel_type> read(std::size_t threads = 0) const
+    {
+        image_section whole(std::vector<std::size_t>(this->shape.size(), 0), this->shape);
+        return read_section(whole, threads);
+    }
+
+    //!decodes only the tiles overlapping the section and returns the pixels of the section
+    std::vector<pixel_type> read_section(image_section const& section, std::size_t threads = 0) const
+    {
+        std::size_t const dimensions = this->shape.size();
+        if (dimensions == 0 || section.first.size() != dimensions ||
+            section.shape.size() != dimensions)
+        {
+            throw invalid_image_section_exception();
+        }
+        for (std::size_t axis = 0; axis < dimensions; axis++)
+        {
+            if (section.shape[axis] == 0 ||
+                section.first[axis] + section.shape[axis] > this->shape[axis])
+            {
+                throw invalid_image_section_exception();
+            }
+        }
+
+        //tiles overlapping the section, odometer over the range of tiles on every axis
+        std::vector<std::size_t> first_tile(dimensions), last_tile(dimensions);
+        for (std::size_t axis = 0; axis < dimensions; axis++)
+        {
+            first_tile[axis] = section.first[axis] / this->tile_shape[axis];
+            last_tile[axis] = (section.first[axis] + section.shape[axis] - 1) / this->tile_shape[axis];
+        }
+
+        std::vector<std::size_t> tiles;
+        std::vector<std::size_t> index(first_tile);
+        while (true)
+        {
+            std::size_t tile = 0;
+            for (std::size_t axis = dimensions; axis-- > 0;)
+            {
+                tile = tile * this->tiles_per_axis[axis] + index[axis];
+            }
+            tiles.push_back(tile);
+
+            std::size_t axis = 0;
+            for (; axis < dimensions; axis++)
+            {
+                if (++index[axis] <= last_tile[axis])
+                {
+                    break;
+                }
+                index[axis] = first_tile[axis];
+            }
+            if (axis == dimensions)
+            {
+                break;
+            }
+        }
+
+        std::vector<pixel_type> pixels(section.size());
+        decode_tiles(tiles, section, pixels.data(), threads);
+        return pixels;
+    }
+
+protected:
+    //!reads BLOCKSIZE and BYTEPIX from the ZNAMEn/ZVALn pairs
+    void read_parameters(hdu const& header)
+    {
+        for (std::size_t i = 1; header.has_key("ZNAME" + std::to_string(i)); i++)
+        {
+            std::string const number = std::to_string(i);
+            std::string const name = string_value(header, "ZNAME" + number);
+            if (name == "BLOCKSIZE")
+            {
+                this->block_size = header.value_of<std::size_t>("ZVAL" + number);
+            }
+            else if (name == "BYTEPIX")
+            {
+                this->byte_pixel = header.value_of<std::size_t>("ZVAL" + number);
+            }
+        }
+
+        //Rice codes differences of 1, 2 or 4 byte integers
+        if (this->compression == tile_compression::rice_1 &&
+            this->byte_pixel != 1 && this->byte_pixel != 2 && this->byte_pixel != 4)
+        {
+            throw unsupported_compression_exception();
+        }
+    }
+
+    //!returns string value of the key without quotes and trailing spaces
+    static std::string string_value(hdu const& header, std::string const& key)
+    {
+        std::string value = header.value_of<std::string>(key);
+        if (value.length() >= 2 && value.front() == '\'' && value.back() == '\'')
+        {
+            value = value.substr(1, value.length() - 2);
+        }
+        return value.substr(0, value.find_last_not_of(' ') + 1);
+    }
+
+    //!returns first pixel and shape of the tile with given index
+    void tile_box
+    (
+        std::size_t tile,
+        std::vector<std::size_t>& first,
+        std::vector<std::size_t>& box
+    ) const
+    {
+        for (std::size_t axis = 0; axis < this->shape.size(); axis++)
+        {
+            std::size_t const position = tile % this->tiles_per_axis[axis];
+            tile /= this->tiles_per_axis[axis];
+            first[axis] = position * this->tile_shape[axis];
+            box[axis] = std::min(this->tile_shape[axis], this->shape[axis] - first[axis]);
+        }
+    }
+
+    //!decodes the tile at given row of the table into pixels (native byte order)
+    void decode_tile(std::size_t tile, std::vector<pixel_type>& pixels,
+        std::vector<unsigned char>& scratch) const
+    {
+        char const* row = this->table->table_data() + tile * this->table->naxis(1) +
+            this->data_column.offset;
+        std::size_t length, offset;
+        if (this->data_column.type == 'P')
+        {
+            length = static_cast<std::size_t>(
+                boost::astronomy::detail::load_big_endian<std::int32_t>(row));
+            offset = static_cast<std::size_t>(
+                boost::astronomy::detail::load_big_endian<std::int32_t>(row + 4));
+        }
+        else
+        {
+            length = static_cast<std::size_t>(
+                boost::astronomy::detail::load_big_endian<std::int64_t>(row));
+            offset = static_cast<std::size_t>(
+                boost::astronomy::detail::load_big_endian<std::int64_t>(row + 8));
+        }
+        //64 bit descriptors could wrap the end of the tile around
+        std::size_t const heap_size = this->table->data_size() -
+            std::min(this->heap_offset, this->table->data_size());
+        if (offset > heap_size || length > heap_size - offset)
+        {
+            throw invalid_compressed_tile_exception();
+        }
+
+        unsigned char const* input = reinterpret_cast<unsigned char const*>(
+            this->table->table_data() + this->heap_offset + offset);
+        std::size_t const bytes = pixels.size() * sizeof(pixel_type);
+
+        switch (this->compression)
+        {
+        case tile_compression::rice_1:
+            rice_tile(input, length, pixels, scratch);
+            return;
+        case tile_compression::gzip_1:
+            boost::astronomy::detail::gzip_decode(input, length,
+                reinterpret_cast<unsigned char*>(pixels.data()), bytes);
+            break;
+        case tile_compression::gzip_2:
+            scratch.resize(bytes);
+            boost::astronomy::detail::gzip_decode(input, length, scratch.data(), bytes);
+            boost::astronomy::detail::unshuffle_bytes(scratch.data(),
+                reinterpret_cast<unsigned char*>(pixels.data()), pixels.size(), sizeof(pixel_type));
+            break;
+        }
+        boost::astronomy::detail::big_to_native_array(pixels.data(), pixels.size());
+    }
+
+    template <typename T = pixel_type>
+    typename std::enable_if<std::is_integral<T>::value>::type
+    rice_tile(unsigned char const* input, std::size_t length, std::vector<T>& pixels,
+        std::vector<unsigned char>& scratch) const
+    {
+        switch (this->byte_pixel)
+        {
+        case 1:
+            rice_tile_as<std::uint8_t>(input, length, pixels, scratch);
+            break;
+        case 2:
+            rice_tile_as<std::int16_t>(input, length, pixels, scratch);
+            break;
+        default:
+            rice_tile_as<std::int32_t>(input, length, pixels, scratch);
+            break;
+        }
+    }
+
+    template <typename T = pixel_type>
+    typename std::enable_if<!std::is_integral<T>::value>::type
+    rice_tile(unsigned char const*, std::size_t, std::vector<T>&, std::vector<unsigned char>&) const
+    {
+        throw unsupported_compression_exception();
+    }
+
+    //!decodes a tile Rice coded as Coded integers and converts them to the pixel type
+    template <typename Coded, typename T>
+    void rice_tile_as(unsigned char const* input, std::size_t length, std::vector<T>& pixels,
+        std::vector<unsigned char>& scratch) const
+    {
+        //integers of the same size only differ in sign, which the decoder ignores
+        if (sizeof(Coded) == sizeof(T))
+        {
+            boost::astronomy::detail::rice_decode(input, length, this->block_size,
+                pixels.data(), pixels.size());
+            return;
+        }
+
+        scratch.resize(pixels.size() * sizeof(Coded));
+        Coded* coded = reinterpret_cast<Coded*>(scratch.data());
+        boost::astronomy::detail::rice_decode(input, length, this->block_size,
+            coded, pixels.size());
+        for (std::size_t i = 0; i < pixels.size(); i++)
+        {
+            pixels[i] = static_cast<T>(coded[i]);
+        }
+    }
+
+    //!copies the part of the tile lying inside the section, rows along axis 0 are copied at once
+    void copy_overlap
+    (
+        std::vector<pixel_type> const& pixels,
+        std::vector<std::size_t> const& tile_first,
+        std::vector<std::size_t> const& tile_box_shape,
+        image_section const& section,
+        pixel_type* destination
+    ) const
+    {
+        std::size_t const dimensions = this->shape.size();
+        std::vector<std::size_t> begin(dimensions), end(dimensions);
+        for (std::size_t axis = 0; axis < dimensions; axis++)
+        {
+            begin[axis] = std::max(tile_first[axis], section.first[axis]);
+            end[axis] = std::min(tile_first[axis] + tile_box_shape[axis],
+                section.first[axis] + section.shape[axis]);
+        }
+
+        std::vector<std::size_t> index(begin);
+        std::size_t const row_length = end[0] - begin[0];
+        while (true)
+        {
+            std::size_t source = 0, target = 0;
+            for (std::size_t axis = dimensions; axis-- > 0;)
+            {
+                source = source * tile_box_shape[axis] + (index[axis] - tile_first[axis]);
+                target = target * section.shape[axis] + (index[axis] - section.first[axis]);
+            }
+            std::memcpy(destination + target, pixels.data() + source, row_length * sizeof(pixel_type));
+
+            std::size_t axis = 1;
+            for (; axis < dimensions; axis++)
+            {
+                if (++index[axis] < end[axis])
+                {
+                    break;
+                }
+                index[axis] = begin[axis];
+            }
+            if (axis >= dimensions)
+            {
+                break;
+            }
+        }
+    }
+
+    //!decodes the tiles on up to threads threads copying their pixels into destination
+    void decode_tiles
+    (
+        std::vector<std::size_t> const& tiles,
+        image_section const& section,
+        pixel_type* destination,
+        std::size_t threads
+    ) const
+    {
+        if (threads == 0)
+        {
+            threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+        }
+        threads = std::max<std::size_t>(std::min(threads, tiles.size()), 1);
+
+        std::atomic<std::size_t> next(0);
+        std::vector<std::exception_ptr> errors(threads);
+        auto worker = [this, &tiles, &section, destination, &next, &errors](std::size_t id) {
+            try
+            {
+                std::size_t const dimensions = this->shape.size();
+                std::vector<std::size_t> first(dimensions), box(dimensions);
+                std::vector<pixel_type> pixels;
+                std::vector<unsigned char> scratch;
+                for (std::size_t i = next++; i < tiles.size(); i = next++)
+                {
+                    tile_box(tiles[i], first, box);
+                    image_section const tile(first, box);
+                    pixels.resize(tile.size());
+                    decode_tile(tiles[i], pixels, scratch);
+                    copy_overlap(pixels, first, box, section, destination);
+                }
+            }
+            catch (...)
+            {
+                errors[id] = std::current_exception();
+                next = tiles.size();
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (std::size_t id = 1; id < threads; id++)
+        {
+            workers.emplace_back(worker, id);
+        }
+        worker(0);
+        for (auto& thread : workers)
+        {
+            thread.join();
+        }
+
+        for (auto const& error : errors)
+        {
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+};
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_COMPRESSED_IMAGE_HPP
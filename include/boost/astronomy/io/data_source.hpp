@@ -0,0 +1,402 @@
+#ifndef BOOST_ASTRONOMY_IO_DATA_SOURCE_HPP
+#define BOOST_ASTRONOMY_IO_DATA_SOURCE_HPP
+
+#include <string>
+#include <vector>
+#include <map>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <future>
+#include <fstream>
+#include <streambuf>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+//!Random access storage holding a FITS file (local file, memory, object storage...)
+/*!
+A source only has to serve byte ranges, which maps directly onto range requests
+of HTTP or S3 like object stores. read_range may be called from several threads
+at once so every implementation must be thread safe.
+*/
+struct data_source
+{
+    virtual ~data_source() {}
+
+    //!returns the size of the stored file in bytes
+    virtual std::uint64_t size() const = 0;
+
+    //!copies upto length bytes starting at offset into buffer and returns the bytes copied
+    //!less than length bytes are returned only at the end of the file
+    virtual std::size_t read_range(std::uint64_t offset, char* buffer, std::size_t length) = 0;
+
+    //!hints that the given range will be read soon, sources without a cache ignore it
+    virtual void prefetch(std::uint64_t offset, std::size_t length)
+    {
+        (void)offset;
+        (void)length;
+    }
+};
+
+//!data_source reading a local file, reads are serialized on a single stream
+struct file_source : public data_source
+{
+protected:
+    std::mutex mutex; //! protects the stream
+    std::fstream file; //! opened file
+    std::uint64_t file_size = 0; //! size of the file
+
+public:
+    explicit file_source(std::string const& file_path) :
+        file(file_path, std::ios_base::in | std::ios_base::binary)
+    {
+        if (!file)
+        {
+            throw fits_exception();
+        }
+        file.seekg(0, std::ios_base::end);
+        file_size = static_cast<std::uint64_t>(file.tellg());
+    }
+
+    std::uint64_t size() const
+    {
+        return this->file_size;
+    }
+
+    std::size_t read_range(std::uint64_t offset, char* buffer, std::size_t length)
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->file.clear();
+        this->file.seekg(static_cast<std::streamoff>(offset));
+        this->file.read(buffer, static_cast<std::streamsize>(length));
+        return static_cast<std::size_t>(this->file.gcount());
+    }
+};
+
+//!data_source serving a file already held in memory
+struct memory_source : public data_source
+{
+protected:
+    std::string content; //! bytes of the file
+
+public:
+    explicit memory_source(std::string bytes) : content(std::move(bytes)) {}
+
+    std::uint64_t size() const
+    {
+        return this->content.size();
+    }
+
+    std::size_t read_range(std::uint64_t offset, char* buffer, std::size_t length)
+    {
+        if (offset >= this->content.size())
+        {
+            return 0;
+        }
+        length = std::min<std::size_t>(length, this->content.size() - static_cast<std::size_t>(offset));
+        std::memcpy(buffer, this->content.data() + offset, length);
+        return length;
+    }
+};
+
+//!Caching data_source which coalesces reads and fetches blocks asynchronously
+/*!
+The wrapped source is read in blocks of block_size bytes. All the missing blocks
+of a read which are next to each other are fetched with a single request, and
+the read_ahead blocks following every read (or prefetch) are requested in the
+background so that a sequential scan never waits for a round trip. Fetches run
+on their own threads, so requests for different parts of a file (e.g. the data units
+of several HDUs passed to prefetch) are in flight at the same time.
+Atmost max_blocks blocks are kept, least recently used blocks are dropped first.
+*/
+struct prefetching_source : public data_source
+{
+protected:
+    typedef std::shared_ptr<std::vector<char> const> run_buffer;
+
+    //!block of the file which is cached or being fetched
+    struct cached_block
+    {
+        std::shared_future<run_buffer> run; //! bytes of the request which fetched this block
+        std::size_t offset = 0; //! position of the block inside the fetched run
+        std::list<std::uint64_t>::iterator use; //! position of the block in recent_use
+    };
+
+    std::shared_ptr<data_source> source; //! source actually holding the file
+    std::size_t block_size; //! size of every cached block
+    std::size_t read_ahead; //! blocks fetched after every read
+    std::size_t max_blocks; //! blocks kept in the cache
+    std::uint64_t file_size; //! size of the file
+
+    mutable std::mutex mutex; //! protects blocks and counters
+    std::map<std::uint64_t, cached_block> blocks; //! cached blocks by block index
+    std::list<std::uint64_t> recent_use; //! indexes of the cached blocks, most recently used first
+    std::size_t request_count = 0; //! requests sent to the wrapped source
+
+public:
+    prefetching_source
+    (
+        std::shared_ptr<data_source> wrapped,
+        std::size_t block_bytes = 1 << 20,
+        std::size_t ahead_blocks = 2,
+        std::size_t block_limit = 64
+    ) :
+        source(std::move(wrapped)),
+        block_size(std::max<std::size_t>(block_bytes, 1)),
+        read_ahead(ahead_blocks),
+        max_blocks(std::max<std::size_t>(block_limit, 1)),
+        file_size(this->source->size()) {}
+
+    ~prefetching_source()
+    {
+        //fetches still running refer to the wrapped source
+        for (auto& block : blocks)
+        {
+            block.second.run.wait();
+        }
+    }
+
+    std::uint64_t size() const
+    {
+        return this->file_size;
+    }
+
+    //!returns the number of requests sent to the wrapped source so far
+    std::size_t requests() const
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->request_count;
+    }
+
+    std::size_t read_range(std::uint64_t offset, char* buffer, std::size_t length)
+    {
+        if (offset >= this->file_size || length == 0)
+        {
+            return 0;
+        }
+        length = std::min<std::size_t>(length, static_cast<std::size_t>(this->file_size - offset));
+
+        std::uint64_t const first = offset / this->block_size;
+        std::uint64_t const last = (offset + length - 1) / this->block_size;
+
+        //evicted blocks are destroyed after the lock is released, the last reference to
+        //a fetch which is still running waits for it to finish
+        std::vector<cached_block> dropped;
+        std::vector<cached_block> needed;
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            request_blocks(first, last + this->read_ahead);
+            for (std::uint64_t index = first; index <= last; index++)
+            {
+                needed.push_back(this->blocks[index]);
+            }
+            evict(first, last, dropped);
+        }
+
+        //waiting outside the lock so that other readers and fetches proceed
+        std::size_t copied = 0;
+        for (std::uint64_t index = first; index <= last; index++)
+        {
+            cached_block const& block = needed[static_cast<std::size_t>(index - first)];
+            run_buffer const& run = block.run.get();
+
+            std::uint64_t const block_begin = index * this->block_size;
+            std::uint64_t const begin = std::max(offset, block_begin);
+            std::uint64_t const end = std::min<std::uint64_t>(offset + length,
+                block_begin + this->block_size);
+            std::size_t const position = block.offset + static_cast<std::size_t>(begin - block_begin);
+            if (position >= run->size())
+            {
+                break;
+            }
+
+            std::size_t const count = std::min<std::size_t>(static_cast<std::size_t>(end - begin),
+                run->size() - position);
+            std::memcpy(buffer + (begin - offset), run->data() + position, count);
+            copied += count;
+        }
+        return copied;
+    }
+
+    void prefetch(std::uint64_t offset, std::size_t length)
+    {
+        if (offset >= this->file_size || length == 0)
+        {
+            return;
+        }
+        length = std::min<std::size_t>(length, static_cast<std::size_t>(this->file_size - offset));
+
+        std::lock_guard<std::mutex> lock(this->mutex);
+        request_blocks(offset / this->block_size, (offset + length - 1) / this->block_size);
+    }
+
+protected:
+    //!starts fetching the blocks in [first, last] which are neither cached nor being fetched
+    //!consecutive missing blocks are fetched by a single request, mutex must be held
+    void request_blocks(std::uint64_t first, std::uint64_t last)
+    {
+        std::uint64_t const block_count = (this->file_size + this->block_size - 1) / this->block_size;
+        last = std::min(last, block_count - 1);
+
+        std::uint64_t index = first;
+        while (index <= last)
+        {
+            auto found = this->blocks.find(index);
+            if (found != this->blocks.end())
+            {
+                this->recent_use.splice(this->recent_use.begin(), this->recent_use,
+                    found->second.use);
+                index++;
+                continue;
+            }
+
+            std::uint64_t run_end = index + 1;
+            while (run_end <= last && this->blocks.find(run_end) == this->blocks.end())
+            {
+                run_end++;
+            }
+
+            std::uint64_t const run_offset = index * this->block_size;
+            std::size_t const run_length = static_cast<std::size_t>(std::min<std::uint64_t>(
+                (run_end - index) * this->block_size, this->file_size - run_offset));
+
+            std::shared_ptr<data_source> const fetch_source = this->source;
+            std::shared_future<run_buffer> run = std::async(std::launch::async,
+                [fetch_source, run_offset, run_length]() {
+                    std::shared_ptr<std::vector<char>> bytes =
+                        std::make_shared<std::vector<char>>(run_length);
+                    std::size_t const read = fetch_source->read_range(run_offset, bytes->data(), run_length);
+                    bytes->resize(read);
+                    return run_buffer(bytes);
+                }).share();
+            this->request_count++;
+
+            for (std::uint64_t block = index; block < run_end; block++)
+            {
+                cached_block& entry = this->blocks[block];
+                entry.run = run;
+                entry.offset = static_cast<std::size_t>((block - index) * this->block_size);
+                entry.use = this->recent_use.insert(this->recent_use.begin(), block);
+            }
+            index = run_end;
+        }
+    }
+
+    //!moves least recently used blocks outside [keep_first, keep_last] into dropped until
+    //!atmost max_blocks are left, mutex must be held
+    void evict
+    (
+        std::uint64_t keep_first,
+        std::uint64_t keep_last,
+        std::vector<cached_block>& dropped
+    )
+    {
+        //the kept blocks were just used so they are at the front of recent_use
+        auto candidate = this->recent_use.end();
+        while (this->blocks.size() > this->max_blocks && candidate != this->recent_use.begin())
+        {
+            --candidate;
+            std::uint64_t const index = *candidate;
+            if (index >= keep_first && index <= keep_last)
+            {
+                continue;
+            }
+
+            auto block = this->blocks.find(index);
+            dropped.push_back(std::move(block->second));
+            this->blocks.erase(block);
+            candidate = this->recent_use.erase(candidate);
+        }
+    }
+};
+
+//!std::streambuf reading a data_source so that std::istream based readers work on any source
+//!(e.g. read_image_sections or binary_table_projection), only input and seeking are supported
+struct source_streambuf : public std::streambuf
+{
+protected:
+    data_source* source; //! source being read
+    std::vector<char> buffer; //! bytes currently available to the stream
+    std::uint64_t buffer_offset = 0; //! position of the first byte of buffer in the source
+
+public:
+    explicit source_streambuf(data_source& input, std::size_t buffer_size = 1 << 16) :
+        source(&input), buffer(std::max<std::size_t>(buffer_size, 1))
+    {
+        setg(buffer.data(), buffer.data(), buffer.data());
+    }
+
+protected:
+    int_type underflow()
+    {
+        std::uint64_t const position = this->buffer_offset + static_cast<std::uint64_t>(gptr() - eback());
+        std::size_t const read = this->source->read_range(position, this->buffer.data(), this->buffer.size());
+        this->buffer_offset = position;
+        setg(this->buffer.data(), this->buffer.data(), this->buffer.data() + read);
+        return read == 0 ? traits_type::eof() : traits_type::to_int_type(this->buffer[0]);
+    }
+
+    std::streamsize xsgetn(char* destination, std::streamsize count)
+    {
+        //large reads bypass the buffer so that they reach the source as a single range
+        std::streamsize const available = egptr() - gptr();
+        if (count <= available || count < static_cast<std::streamsize>(this->buffer.size()))
+        {
+            return std::streambuf::xsgetn(destination, count);
+        }
+
+        std::memcpy(destination, gptr(), static_cast<std::size_t>(available));
+        std::uint64_t const position = this->buffer_offset + static_cast<std::uint64_t>(egptr() - eback());
+        std::size_t const read = this->source->read_range(position, destination + available,
+            static_cast<std::size_t>(count - available));
+        this->buffer_offset = position + read;
+        setg(this->buffer.data(), this->buffer.data(), this->buffer.data());
+        return available + static_cast<std::streamsize>(read);
+    }
+
+    pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode)
+    {
+        std::int64_t position = static_cast<std::int64_t>(offset);
+        if (direction == std::ios_base::cur)
+        {
+            position += static_cast<std::int64_t>(this->buffer_offset + (gptr() - eback()));
+        }
+        else if (direction == std::ios_base::end)
+        {
+            position += static_cast<std::int64_t>(this->source->size());
+        }
+        return seekpos(pos_type(static_cast<off_type>(position)), std::ios_base::in);
+    }
+
+    pos_type seekpos(pos_type position, std::ios_base::openmode)
+    {
+        std::int64_t const target = static_cast<std::int64_t>(static_cast<off_type>(position));
+        if (target < 0)
+        {
+            return pos_type(off_type(-1));
+        }
+
+        std::uint64_t const wanted = static_cast<std::uint64_t>(target);
+        if (wanted >= this->buffer_offset &&
+            wanted <= this->buffer_offset + static_cast<std::uint64_t>(egptr() - eback()))
+        {
+            setg(eback(), eback() + (wanted - this->buffer_offset), egptr());
+        }
+        else
+        {
+            this->buffer_offset = wanted;
+            setg(this->buffer.data(), this->buffer.data(), this->buffer.data());
+        }
+        return position;
+    }
+};
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_DATA_SOURCE_HPP
@@ -2,6 +2,7 @@
 #define BOOST_ASTRONOMY_IO_EXTENSION_HDU_HPP
 
 #include <string>
+#include <utility>
 #include <vector>
 #include <cstddef>
 #include <valarray>
@@ -27,7 +28,14 @@ public:
         extname = this->value_of<std::string>("EXTNAME");
     }
 
-    extension_hdu(std::fstream &file, hdu const& other) : hdu(other)
+    extension_hdu(hdu other) : hdu(std::move(other))
+    {
+        gcount = this->value_of<int>("GCOUNT");
+        pcount = this->value_of<int>("PCOUNT");
+        extname = this->value_of<std::string>("EXTNAME");
+    }
+
+    extension_hdu(std::fstream &file, hdu other) : hdu(std::move(other))
     {
         gcount = this->value_of<int>("GCOUNT");
         pcount = this->value_of<int>("PCOUNT");
@@ -5,61 +5,136 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <utility>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <algorithm>
 
 #include <boost/astronomy/io/primary_hdu.hpp>
 #include <boost/astronomy/io/extension_hdu.hpp>
 #include <boost/astronomy/io/image_extension.hpp>
 #include <boost/astronomy/io/ascii_table.hpp>
+#include <boost/astronomy/io/binary_table.hpp>
+#include <boost/astronomy/io/image_section.hpp>
+#include <boost/astronomy/io/column_projection.hpp>
+#include <boost/astronomy/io/compressed_image.hpp>
+#include <boost/astronomy/io/scaled_image.hpp>
+#include <boost/astronomy/io/visit_image.hpp>
+#include <boost/astronomy/io/io_counters.hpp>
+#include <boost/astronomy/io/header_cache.hpp>
+#include <boost/astronomy/detail/monotonic_arena.hpp>
 #include <boost/astronomy/exception/fits_exception.hpp>
 
 namespace boost { namespace astronomy { namespace io {
 
+//!decides how much of the file is read when it is opened
+enum class fits_open_mode
+{
+    primary, //! primary HDU is read including its data
+    directory //! only headers are read, data units are read on first access
+};
+
+//!decides where HDU objects of a fits instance are allocated
+enum class hdu_allocation
+{
+    heap, //! every HDU is allocated separately
+    arena //! HDUs are allocated from one arena released when the last of them is destroyed
+};
+
 struct fits 
 {
 protected:
     std::fstream fits_file; //!FITS to be processed
+    std::string file_path; //!path of the file, used to open a stream per loading thread
     std::vector<std::shared_ptr<hdu>> hdu_; //!Stores all th HDU in file
+    std::vector<hdu_directory_entry> directory; //!location of all the HDU in file
+    std::shared_ptr<boost::astronomy::detail::monotonic_arena> arena; //!memory of HDUs in arena mode
+    io_counters io_totals; //!io done through this object, see counters()
+    io_hook io_callback; //!receives the io events of this object
 
 public:
     fits() {}
 
+    //!opens the file and reads it according to the open mode
+    //!in directory mode all the headers are indexed and data units are skipped
+    //!in arena mode all the HDU objects share one monotonic buffer instead of separate allocations
+    //!hook receives the io events from the opening on, see set_io_hook
     fits
     (
-        std::string file_path,
+        std::string const& path,
+        fits_open_mode open_mode,
+        hdu_allocation allocation = hdu_allocation::heap,
+        io_hook hook = io_hook()
+    ) : file_path(path), io_callback(std::move(hook))
+    {
+        io_counter_scope scope(this->io_totals, this->io_callback);
+        if (allocation == hdu_allocation::arena)
+        {
+            arena = std::make_shared<boost::astronomy::detail::monotonic_arena>();
+        }
+
+        fits_file.open(path, std::ios_base::in | std::ios_base::binary);
+        if (open_mode == fits_open_mode::directory)
+        {
+            read_directory();
+        }
+        else
+        {
+            read_primary_hdu();
+        }
+    }
+
+    fits
+    (
+        std::string path,
         std::ios_base::openmode mode = std::ios_base::in | std::ios_base::binary
-    )
+    ) : file_path(path)
     {
-        fits_file.open(file_path, std::ios_base::in | std::ios_base::binary | mode);
+        io_counter_scope scope(this->io_totals, this->io_callback);
+        fits_file.open(path, std::ios_base::in | std::ios_base::binary | mode);
         read_primary_hdu();
         //read_extensions();
     }
 
-    void read_primary_hdu()
+    //!opens the file in directory mode taking the headers from its index in cache
+    //!when that index is up to date, otherwise the headers are parsed and, if
+    //!cache.update is set, the index is written for the next opens
+    fits
+    (
+        std::string const& path,
+        header_cache const& cache,
+        hdu_allocation allocation = hdu_allocation::heap,
+        io_hook hook = io_hook()
+    ) : file_path(path), io_callback(std::move(hook))
     {
-        hdu_.emplace_back(std::make_shared<hdu>(fits_file));
-                    
-        switch (hdu_[0]->value_of<int>(std::string("BITPIX")))
-        {
-        case 8:
-            hdu_[0] = std::make_shared<primary_hdu<bitpix::B8>>(fits_file, *hdu_[0]);
-            break;
-        case 16:
-            hdu_[0] = std::make_shared<primary_hdu<bitpix::B16>>(fits_file, *hdu_[0]);
-            break;
-        case 32:
-            hdu_[0] = std::make_shared<primary_hdu<bitpix::B32>>(fits_file, *hdu_[0]);
-            break;
-        case -32:
-            hdu_[0] = std::make_shared<primary_hdu<bitpix::_B32>>(fits_file, *hdu_[0]);
-            break;
-        case -64:
-            hdu_[0] = std::make_shared<primary_hdu<bitpix::_B64>>(fits_file, *hdu_[0]);
-            break;
-        default:
-            throw fits_exception();
+        io_counter_scope scope(this->io_totals, this->io_callback);
+        if (allocation == hdu_allocation::arena)
+        {
+            arena = std::make_shared<boost::astronomy::detail::monotonic_arena>();
+        }
+
+        fits_file.open(path, std::ios_base::in | std::ios_base::binary);
+        if (read_cached_directory(cache))
+        {
+            return;
+        }
+
+        detail_header_cache::file_stamp stamp;
+        bool const stamped = detail_header_cache::stamp_file(path, stamp);
+        read_directory();
+        if (stamped && cache.update)
+        {
+            detail_header_cache::write_index(cache, path, stamp, hdu_, directory);
         }
     }
 
+    void read_primary_hdu()
+    {
+        hdu_.emplace_back(make_hdu<hdu>(arena, fits_file));
+        hdu_[0] = read_data_unit(fits_file, std::move(*hdu_[0]), true, arena);
+    }
+
     void read_extensions()
     {
         //if no extension then return
@@ -68,47 +143,381 @@ public:
             return;
         }
 
-        while (!fits_file.eof())
+        std::streamoff file_size = size_of_file();
+        while (fits_file.tellg() < file_size)
         {
             //this statement allows up to read all the cards stored
             //It gives us the benefit of knowing which kind of data we need to store
-            hdu_.emplace_back(std::make_shared<hdu>(fits_file));
+            hdu header(fits_file);
+            hdu_.emplace_back(read_data_unit(fits_file, std::move(header), false, arena));
+        }
+    }
+
+    //!reads headers of all the HDUs and records the location of their data units
+    //!data units are skipped using seek and are read only when HDU is accessed
+    void read_directory()
+    {
+        hdu_.clear();
+        directory.clear();
+
+        std::streamoff file_size = size_of_file();
+        fits_file.seekg(0);
+
+        while (fits_file.tellg() < file_size)
+        {
+            hdu_directory_entry entry;
+            entry.header_offset = fits_file.tellg();
+
+            hdu_.emplace_back(make_hdu<hdu>(arena, fits_file));
+
+            entry.data_offset = fits_file.tellg();
+            entry.data_size = hdu_.back()->data_size();
+            directory.push_back(entry);
+
+            //skipping the data unit
+            fits_file.seekg(entry.data_offset +
+                static_cast<std::streamoff>(hdu::block_aligned_size(entry.data_size)));
+            boost::astronomy::detail::count_io(io_event_kind::seek);
+        }
+        fits_file.clear();
+    }
+
+    //!takes the headers and locations of all the HDUs from the index of the file in cache
+    //!returns false (nothing read) if the file has no up to date index
+    bool read_cached_directory(header_cache const& cache)
+    {
+        std::vector<hdu> headers;
+        std::vector<hdu_directory_entry> entries;
+        if (!read_header_index(cache, this->file_path, headers, entries))
+        {
+            return false;
+        }
+
+        hdu_.clear();
+        for (auto& header : headers)
+        {
+            hdu_.emplace_back(make_hdu<hdu>(arena, std::move(header)));
+        }
+        directory = std::move(entries);
+        return true;
+    }
+
+    //!returns the location of all the HDUs (filled by read_directory)
+    std::vector<hdu_directory_entry> const& get_directory() const
+    {
+        return this->directory;
+    }
+
+    //!returns the io done through this object since it was opened or reset_counters()
+    //!counters stay 0 unless BOOST_ASTRONOMY_IO_INSTRUMENTATION is defined
+    /*!
+    Opening the file, loading data units (get_hdu, load_all), reading sections and scaled
+    images are counted. Work done later on the HDUs themselves, such as get_column on a
+    table, is only counted by an io_counter_scope opened around it.
+    */
+    io_counters counters() const
+    {
+        return this->io_totals;
+    }
+
+    void reset_counters()
+    {
+        this->io_totals = io_counters();
+    }
+
+    //!sets the callback receiving every io event of this object as it is recorded
+    //!it is called from the loading threads of load_all, so it must be thread safe
+    void set_io_hook(io_hook hook)
+    {
+        this->io_callback = std::move(hook);
+    }
+
+    //!returns the number of HDUs read or indexed
+    std::size_t size() const
+    {
+        return this->hdu_.size();
+    }
+
+    //!returns the HDU at given index
+    //!if file is opened in directory mode then data unit is read on first access
+    std::shared_ptr<hdu> get_hdu(std::size_t index)
+    {
+        if (index < directory.size() && !directory[index].loaded)
+        {
+            io_counter_scope scope(this->io_totals, this->io_callback);
+            fits_file.clear();
+            fits_file.seekg(directory[index].data_offset);
+            boost::astronomy::detail::count_io(io_event_kind::seek);
+            //the header is copied so that it remains usable if reading the data throws
+            hdu_[index] = read_data_unit(fits_file, *hdu_[index], index == 0, arena);
+            directory[index].loaded = true;
+        }
+        return hdu_.at(index);
+    }
+
+    //!reads the data units of all the HDUs which are not loaded yet using upto max_threads threads
+    //!file must be opened in directory mode, max_threads equal to 0 uses all the hardware threads
+    /*!
+    Data units are independent once the directory is known, so every thread opens
+    its own stream on the file and decodes whole HDUs taken from a shared counter.
+    The first exception thrown by any thread is rethrown after all threads finish,
+    the HDUs read before it are marked loaded and the others keep their headers.
+    */
+    void load_all(std::size_t max_threads = 0)
+    {
+        std::vector<std::size_t> pending;
+        for (std::size_t i = 0; i < directory.size(); i++)
+        {
+            if (!directory[i].loaded)
+            {
+                pending.push_back(i);
+            }
+        }
+        if (pending.empty())
+        {
+            return;
+        }
 
-            if (hdu_.back()->value_of<std::string>("XTENSION") == "'IMAGE   '")
+        if (max_threads == 0)
+        {
+            max_threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+        }
+        std::size_t const threads = std::min(max_threads, pending.size());
+
+        std::atomic<std::size_t> next(0);
+        std::vector<std::exception_ptr> errors(threads);
+        std::vector<io_counters> worker_counters(threads);
+        std::vector<char> finished(pending.size(), 0);
+        auto worker = [this, &pending, &next, &errors, &worker_counters, &finished]
+            (std::size_t id) {
+            io_counter_scope scope(worker_counters[id], this->io_callback);
+            try
             {
-                switch (hdu_.back()->value_of<int>(std::string("BITPIX")))
+                std::fstream file(this->file_path, std::ios_base::in | std::ios_base::binary);
+                for (std::size_t i = next++; i < pending.size(); i = next++)
                 {
-                case 8:
-                    hdu_.back() =
-                        std::make_shared<image_extension<bitpix::B8>>(fits_file, *hdu_.back());
-                    break;
-                case 16:
-                    hdu_.back() =
-                        std::make_shared<image_extension<bitpix::B16>>(fits_file, *hdu_.back());
-                    break;
-                case 32:
-                    hdu_.back() =
-                        std::make_shared<image_extension<bitpix::B32>>(fits_file, *hdu_.back());
-                    break;
-                case -32:
-                    hdu_.back() =
-                        std::make_shared<image_extension<bitpix::_B32>>(fits_file, *hdu_.back());
-                    break;
-                case -64:
-                    hdu_.back() =
-                        std::make_shared<image_extension<bitpix::_B64>>(fits_file, *hdu_.back());
-                    break;
-                default:
-                    throw fits_exception();
-                    break;
+                    std::size_t const index = pending[i];
+                    file.clear();
+                    file.seekg(this->directory[index].data_offset);
+                    boost::astronomy::detail::count_io(io_event_kind::seek);
+                    this->hdu_[index] = read_data_unit(file, *this->hdu_[index], index == 0,
+                        this->arena);
+                    finished[i] = 1;
                 }
             }
-            else if (hdu_.back()->value_of<std::string>("XTENSION") == "'TABLE   '")
+            catch (...)
             {
-                hdu_.back() = std::make_shared<ascii_table>(fits_file, *hdu_.back());
+                errors[id] = std::current_exception();
+                next = pending.size();
             }
-                        
+        };
+
+        std::vector<std::thread> workers;
+        for (std::size_t id = 1; id < threads; id++)
+        {
+            workers.emplace_back(worker, id);
+        }
+        worker(0);
+        for (auto& thread : workers)
+        {
+            thread.join();
+        }
+        for (auto const& counters : worker_counters)
+        {
+            this->io_totals.merge(counters);
+        }
+        for (std::size_t i = 0; i < pending.size(); i++)
+        {
+            directory[pending[i]].loaded = finished[i] != 0;
+        }
+
+        for (auto const& error : errors)
+        {
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+    //!reads only the pixels inside the section of the image HDU at given index
+    //!file must be opened in directory mode, data unit of the HDU is not loaded
+    template <bitpix DataType>
+    std::vector<typename bitpix_traits<DataType>::type> read_section
+    (
+        std::size_t index,
+        image_section const& section
+    )
+    {
+        io_counter_scope scope(this->io_totals, this->io_callback);
+        return read_image_section<DataType>(fits_file, *hdu_.at(index),
+            directory.at(index).data_offset, section);
+    }
+
+    //!reads many sections of the image HDU at given index in one go
+    //!rows of the sections lying close to each other in the file are read together
+    template <bitpix DataType>
+    std::vector<std::vector<typename bitpix_traits<DataType>::type>> read_sections
+    (
+        std::size_t index,
+        std::vector<image_section> const& sections
+    )
+    {
+        io_counter_scope scope(this->io_totals, this->io_callback);
+        return read_image_sections<DataType>(fits_file, *hdu_.at(index),
+            directory.at(index).data_offset, sections);
+    }
+
+    //!returns a projection reading only the requested columns of binary table at given index
+    //!file must be opened in directory mode, data unit of the HDU is not loaded
+    binary_table_projection project_columns(std::size_t index)
+    {
+        return binary_table_projection(fits_file, *hdu_.at(index), directory.at(index).data_offset);
+    }
+
+    //!stores bzero + bscale * pixel of the image HDU at given index into output, BLANK pixels become NaN
+    //!output (float or double) must have space for image_pixel_count() of the header values
+    /*!
+    An HDU which is already loaded is scaled from memory, otherwise (directory mode) the pixels
+    are decoded straight from the file without storing the image or marking the HDU loaded.
+    */
+    template <typename Output>
+    void read_scaled_image(std::size_t index, Output* output)
+    {
+        hdu const& header = *hdu_.at(index);
+        if (index != 0 && (!header.has_key("XTENSION") ||
+            header.value_of<std::string>("XTENSION") != "'IMAGE   '"))
+        {
+            throw wrong_extension_type();
+        }
+
+        if (index < directory.size() && !directory[index].loaded)
+        {
+            io_counter_scope scope(this->io_totals, this->io_callback);
+            fits_file.clear();
+            fits_file.seekg(directory[index].data_offset);
+            boost::astronomy::detail::count_io(io_event_kind::seek);
+            read_scaled_pixels(fits_file, header, output);
+            return;
         }
+
+        image_scaling const scaling = image_scaling::from_header(header);
+        visit_image(header, [&](auto const& img) {
+            boost::astronomy::detail::scale_pixels(img.pixels(), img.size(), scaling, output);
+        });
+    }
+
+    //!returns the scaled pixels of the image HDU at given index, see read_scaled_image
+    template <typename Output>
+    std::vector<Output> read_scaled_image(std::size_t index)
+    {
+        std::vector<Output> output(image_pixel_count(*hdu_.at(index)));
+        read_scaled_image(index, output.data());
+        return output;
+    }
+
+    //!decodes the tile compressed image stored in the binary table at given index
+    //!tiles are decoded on up to threads threads (0 uses all the hardware threads)
+    template <bitpix DataType>
+    std::vector<typename bitpix_traits<DataType>::type> read_compressed_image
+    (
+        std::size_t index,
+        std::size_t threads = 0
+    )
+    {
+        return compressed_image<DataType>(compressed_table(index)).read(threads);
+    }
+
+    //!decodes only the tiles of the compressed image at given index which overlap the section
+    template <bitpix DataType>
+    std::vector<typename bitpix_traits<DataType>::type> read_compressed_section
+    (
+        std::size_t index,
+        image_section const& section,
+        std::size_t threads = 0
+    )
+    {
+        return compressed_image<DataType>(compressed_table(index)).read_section(section, threads);
+    }
+
+protected:
+    //!returns the binary table at given index which must hold a tile compressed image
+    binary_table_extension const& compressed_table(std::size_t index)
+    {
+        auto table = std::dynamic_pointer_cast<binary_table_extension>(get_hdu(index));
+        if (table == nullptr || !compressed_image<bitpix::B8>::is_compressed_image(*table))
+        {
+            throw wrong_extension_type();
+        }
+        return *table;
+    }
+
+    //!creates HDU of given type in the arena if there is one, otherwise on the heap
+    template <typename HDU, typename... Args>
+    static std::shared_ptr<hdu> make_hdu
+    (
+        std::shared_ptr<boost::astronomy::detail::monotonic_arena> const& arena,
+        Args&&... args
+    )
+    {
+        if (arena)
+        {
+            return std::allocate_shared<HDU>(boost::astronomy::detail::arena_allocator<HDU>(arena),
+                std::forward<Args>(args)...);
+        }
+        return std::make_shared<HDU>(std::forward<Args>(args)...);
+    }
+
+    //!size of the opened file in bytes
+    std::streamoff size_of_file()
+    {
+        std::streampos current = fits_file.tellg();
+        fits_file.seekg(0, std::ios_base::end);
+        std::streamoff file_size = fits_file.tellg();
+        fits_file.seekg(current);
+        return file_size;
+    }
+
+    //!creates HDU of appropriate type from the header and reads its data unit
+    //!file must be positioned at the beginning of data unit
+    //!the header is moved into the created HDU
+    static std::shared_ptr<hdu> read_data_unit
+    (
+        std::fstream& fits_file,
+        hdu header,
+        bool primary,
+        std::shared_ptr<boost::astronomy::detail::monotonic_arena> const& arena
+    )
+    {
+        if (primary)
+        {
+            return dispatch_bitpix(header.bitpix(), [&](auto tag) {
+                return make_hdu<primary_hdu<decltype(tag)::value>>(arena, fits_file, std::move(header));
+            });
+        }
+
+        std::string xtension = header.value_of<std::string>("XTENSION");
+        if (xtension == "'IMAGE   '")
+        {
+            return dispatch_bitpix(header.bitpix(), [&](auto tag) {
+                return make_hdu<image_extension<decltype(tag)::value>>(arena, fits_file,
+                    std::move(header));
+            });
+        }
+        else if (xtension == "'TABLE   '")
+        {
+            return make_hdu<ascii_table>(arena, fits_file, std::move(header));
+        }
+        else if (xtension == "'BINTABLE'")
+        {
+            return make_hdu<binary_table_extension>(arena, fits_file, std::move(header));
+        }
+
+        //unknown extensions are kept as header only and their data is skipped
+        fits_file.seekg(fits_file.tellg() +
+            static_cast<std::streamoff>(hdu::block_aligned_size(header.data_size())));
+        boost::astronomy::detail::count_io(io_event_kind::seek);
+        return make_hdu<hdu>(arena, std::move(header));
     }
 };
 
@@ -0,0 +1,266 @@
+#ifndef BOOST_ASTRONOMY_IO_FITS_PIPELINE_HPP
+#define BOOST_ASTRONOMY_IO_FITS_PIPELINE_HPP
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <utility>
+#include <cstddef>
+#include <exception>
+#include <algorithm>
+#include <type_traits>
+
+#include <boost/astronomy/io/mapped_fits.hpp>
+#include <boost/astronomy/detail/bounded_queue.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+//!threads and queue sizes of run_fits_pipeline
+struct pipeline_options
+{
+    std::size_t queue_capacity = 4; //! items waiting between two consecutive stages
+    std::size_t read_threads = 1; //! threads reading files, one per disk is usually enough
+    std::size_t decode_threads = 1; //! threads running the decode function
+    std::size_t process_threads = 0; //! threads running the process function, 0 uses all cores
+    std::size_t write_threads = 1; //! threads running the write function
+};
+
+//!work done by the stages of run_fits_pipeline
+//!busy times are summed over the threads of a stage and exclude the waits on the queues
+struct pipeline_statistics
+{
+    std::size_t files = 0; //! files which went through all the stages
+    double read_seconds = 0;
+    double decode_seconds = 0;
+    double process_seconds = 0;
+    double write_seconds = 0;
+    std::size_t max_queued = 0; //! largest number of items waiting between two stages
+};
+
+//!file read into memory by the first stage of run_fits_pipeline
+struct pipeline_file
+{
+    std::size_t index = 0; //! position of the file in the list of paths
+    std::string path;
+    std::vector<char> bytes; //! complete content of the file
+};
+
+//!decode function of run_fits_pipeline parsing the headers of the file in memory
+//!images and tables are then viewed without copies, see mapped_fits
+struct decode_buffered_fits
+{
+    buffered_fits operator() (pipeline_file& file) const
+    {
+        return buffered_fits(std::move(file.bytes));
+    }
+};
+
+///@cond INTERNAL
+namespace detail_pipeline {
+
+// value passed between two stages with the index of its file
+template <typename T>
+struct staged
+{
+    std::size_t index = 0;
+    T value;
+};
+
+inline std::size_t thread_count(std::size_t threads)
+{
+    return threads != 0 ? threads :
+        std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+// runs f and adds its duration to seconds
+template <typename Function>
+inline auto timed(double& seconds, Function&& f) -> decltype(f())
+{
+    struct add_duration
+    {
+        double& total;
+        std::chrono::steady_clock::time_point start;
+        ~add_duration()
+        {
+            total += std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                this->start).count();
+        }
+    } scope{seconds, std::chrono::steady_clock::now()};
+    return f();
+}
+
+} // namespace detail_pipeline
+///@endcond
+
+//!Streams files through read, decode, process and write stages running concurrently
+/*!
+Every stage has its own threads and hands its results to the next one through a
+queue of at most options.queue_capacity items. A stage faster than the next one
+blocks on the full queue instead of piling up files in memory, so disks and cores
+are kept busy together while at most a few files per stage are in flight.
+
+ - read: files are read as a whole into a pipeline_file, in the order of paths
+ - decode: decode(pipeline_file&) returns the decoded value D of the file, e.g.
+   decode_buffered_fits giving a buffered_fits
+ - process: process(index, D&) returns the result R of the file
+ - write: write(index, R&) stores the result, e.g. with a fits_writer
+
+index is the position of the file in paths, results reach the write stage in the
+order the process threads finish them. Each function is called concurrently by
+the threads of its stage, D and R must be default constructible and movable.
+The first exception thrown by a stage stops all the stages and is rethrown once
+every thread has finished.
+*/
+template <typename Decode, typename Process, typename Write>
+pipeline_statistics run_fits_pipeline
+(
+    std::vector<std::string> const& paths,
+    Decode decode,
+    Process process,
+    Write write,
+    pipeline_options const& options = pipeline_options()
+)
+{
+    namespace dpl = detail_pipeline;
+    using decoded_type = typename std::decay<
+        decltype(decode(std::declval<pipeline_file&>()))>::type;
+    using result_type = typename std::decay<decltype(process(std::size_t(),
+        std::declval<decoded_type&>()))>::type;
+
+    std::size_t const readers = std::min(dpl::thread_count(options.read_threads),
+        std::max<std::size_t>(paths.size(), 1));
+    std::size_t const decoders = dpl::thread_count(options.decode_threads);
+    std::size_t const processors = dpl::thread_count(options.process_threads);
+    std::size_t const writers = dpl::thread_count(options.write_threads);
+
+    boost::astronomy::detail::bounded_queue<pipeline_file> read_queue(options.queue_capacity,
+        readers);
+    boost::astronomy::detail::bounded_queue<dpl::staged<decoded_type>> decode_queue(
+        options.queue_capacity, decoders);
+    boost::astronomy::detail::bounded_queue<dpl::staged<result_type>> process_queue(
+        options.queue_capacity, processors);
+
+    pipeline_statistics statistics;
+    std::mutex mutex;
+    std::exception_ptr error;
+    std::atomic<std::size_t> next(0);
+
+    // runs the loop of a thread of a stage, the first exception cancels all the queues
+    auto run_stage = [&](double pipeline_statistics::* busy, auto loop) {
+        double seconds = 0;
+        try
+        {
+            loop(seconds);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!error)
+            {
+                error = std::current_exception();
+            }
+            read_queue.cancel();
+            decode_queue.cancel();
+            process_queue.cancel();
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        statistics.*busy += seconds;
+    };
+
+    std::vector<std::thread> threads;
+    for (std::size_t id = 0; id < readers; id++)
+    {
+        threads.emplace_back([&]() {
+            run_stage(&pipeline_statistics::read_seconds, [&](double& seconds) {
+                for (std::size_t i = next++; i < paths.size(); i = next++)
+                {
+                    pipeline_file file;
+                    file.index = i;
+                    file.path = paths[i];
+                    file.bytes = dpl::timed(seconds, [&]() {
+                        return buffered_fits::read_file(file.path);
+                    });
+                    if (!read_queue.push(std::move(file)))
+                    {
+                        return;
+                    }
+                }
+            });
+            read_queue.close();
+        });
+    }
+    for (std::size_t id = 0; id < decoders; id++)
+    {
+        threads.emplace_back([&]() {
+            run_stage(&pipeline_statistics::decode_seconds, [&](double& seconds) {
+                pipeline_file file;
+                while (read_queue.pop(file))
+                {
+                    dpl::staged<decoded_type> item;
+                    item.index = file.index;
+                    item.value = dpl::timed(seconds, [&]() { return decode(file); });
+                    if (!decode_queue.push(std::move(item)))
+                    {
+                        return;
+                    }
+                }
+            });
+            decode_queue.close();
+        });
+    }
+    for (std::size_t id = 0; id < processors; id++)
+    {
+        threads.emplace_back([&]() {
+            run_stage(&pipeline_statistics::process_seconds, [&](double& seconds) {
+                dpl::staged<decoded_type> item;
+                while (decode_queue.pop(item))
+                {
+                    dpl::staged<result_type> result;
+                    result.index = item.index;
+                    result.value = dpl::timed(seconds, [&]() {
+                        return process(item.index, item.value);
+                    });
+                    item.value = decoded_type();
+                    if (!process_queue.push(std::move(result)))
+                    {
+                        return;
+                    }
+                }
+            });
+            process_queue.close();
+        });
+    }
+    for (std::size_t id = 0; id < writers; id++)
+    {
+        threads.emplace_back([&]() {
+            run_stage(&pipeline_statistics::write_seconds, [&](double& seconds) {
+                dpl::staged<result_type> result;
+                while (process_queue.pop(result))
+                {
+                    dpl::timed(seconds, [&]() { write(result.index, result.value); });
+                    std::lock_guard<std::mutex> lock(mutex);
+                    statistics.files++;
+                }
+            });
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+    statistics.max_queued = std::max({read_queue.max_size(), decode_queue.max_size(),
+        process_queue.max_size()});
+    return statistics;
+}
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_FITS_PIPELINE_HPP
@@ -0,0 +1,228 @@
+#ifndef BOOST_ASTRONOMY_IO_FITS_WRITER_HPP
+#define BOOST_ASTRONOMY_IO_FITS_WRITER_HPP
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+
+#include <boost/astronomy/io/hdu.hpp>
+#include <boost/astronomy/io/card.hpp>
+#include <boost/astronomy/io/primary_hdu.hpp>
+#include <boost/astronomy/io/image_extension.hpp>
+#include <boost/astronomy/io/binary_table.hpp>
+#include <boost/astronomy/detail/endian.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+//!Writes HDUs into a FITS file through a large block aligned buffer
+/*!
+Headers and data units are appended to the buffer and padded to multiples of
+2880 bytes (headers with spaces, data with zeros), the buffer is written to the
+file only when it is full so the file sees few large writes. Pixels are copied
+into the buffer and converted to big endian there in bulk, the image itself is
+never modified. HDUs are written in the order of the calls, the first one
+must be the primary HDU.
+*/
+struct fits_writer
+{
+protected:
+    std::ofstream file; //! file being written
+    std::vector<char> buffer; //! bytes not yet written to file
+    std::size_t used = 0; //! bytes of buffer in use
+
+public:
+    //!creates (or truncates) the file, buffer_size is rounded up to a multiple of 2880 bytes
+    fits_writer(std::string const& file_path, std::size_t buffer_size = 1 << 22) :
+        file(file_path, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc),
+        buffer(hdu::block_aligned_size(std::max<std::size_t>(buffer_size, 1)))
+    {
+        if (!this->file)
+        {
+            throw fits_write_exception();
+        }
+    }
+
+    fits_writer(fits_writer&& other) = default;
+    fits_writer& operator=(fits_writer&& other) = default;
+
+    //!writes whatever is left in the buffer, errors are ignored (call close() to see them)
+    ~fits_writer()
+    {
+        try
+        {
+            flush();
+        }
+        catch (...)
+        {
+        }
+    }
+
+    //!writes the cards followed by END card (if not already present) and pads the header
+    void write_header(std::vector<card> const& cards)
+    {
+        std::size_t length = 0;
+        for (auto const& header_card : cards)
+        {
+            append(header_card.data(), 80);
+            length += 80;
+            if (header_card.key_is("END"))
+            {
+                break;
+            }
+        }
+
+        if (cards.empty() || !cards[length / 80 - 1].key_is("END"))
+        {
+            card end;
+            end.create_commentary_card("END", "");
+            append(end.data(), 80);
+            length += 80;
+        }
+        pad(length, ' ');
+    }
+
+    //!writes all the cards of the header
+    void write_header(hdu const& header)
+    {
+        write_header(header.get_cards());
+    }
+
+    //!writes count pixels in native byte order as a big endian data unit including padding
+    template <typename PixelType>
+    void write_data(PixelType const* pixels, std::size_t count)
+    {
+        std::size_t written = 0;
+        while (written < count)
+        {
+            if (this->used == this->buffer.size())
+            {
+                flush();
+            }
+            std::size_t const chunk = std::min(count - written,
+                (this->buffer.size() - this->used) / sizeof(PixelType));
+            if (chunk == 0)
+            {
+                flush();
+                continue;
+            }
+
+            char* destination = this->buffer.data() + this->used;
+            std::memcpy(destination, pixels + written, chunk * sizeof(PixelType));
+            boost::astronomy::detail::native_to_big_array(
+                reinterpret_cast<PixelType*>(destination), chunk);
+            this->used += chunk * sizeof(PixelType);
+            written += chunk;
+        }
+        pad(count * sizeof(PixelType), '\0');
+    }
+
+    //!writes bytes which are already in FITS byte order as a data unit including padding
+    void write_raw_data(char const* bytes, std::size_t size)
+    {
+        append(bytes, size);
+        pad(size, '\0');
+    }
+
+    //!writes the header and image of primary HDU
+    template <bitpix DataType>
+    void write(primary_hdu<DataType> const& primary)
+    {
+        write_header(primary);
+        write_image(primary.get_data(), primary.data_size());
+    }
+
+    //!writes the header and image of image extension
+    template <bitpix DataType>
+    void write(image_extension<DataType> const& extension)
+    {
+        write_header(extension);
+        write_image(extension.get_data(), extension.data_size());
+    }
+
+    //!writes the header, rows and heap of binary table
+    void write(binary_table_extension const& table)
+    {
+        write_header(table);
+        write_raw_data(table.table_data(), table.data_size());
+    }
+
+    //!writes the buffered bytes to the file
+    void flush()
+    {
+        if (this->used == 0)
+        {
+            return;
+        }
+        this->file.write(this->buffer.data(), static_cast<std::streamsize>(this->used));
+        this->used = 0;
+        if (!this->file)
+        {
+            throw fits_write_exception();
+        }
+    }
+
+    //!flushes the buffer and closes the file
+    void close()
+    {
+        flush();
+        this->file.close();
+        if (this->file.fail())
+        {
+            throw fits_write_exception();
+        }
+    }
+
+protected:
+    //!writes the pixels of image, image must have as many pixels as described by the header
+    template <typename ImageType>
+    void write_image(ImageType const& image, std::size_t data_size)
+    {
+        if (image.size() * sizeof(*image.pixels()) != data_size)
+        {
+            throw fits_write_exception();
+        }
+        write_data(image.pixels(), image.size());
+    }
+
+    //!appends bytes to the buffer writing the buffer whenever it becomes full
+    void append(char const* bytes, std::size_t size)
+    {
+        while (size > 0)
+        {
+            if (this->used == this->buffer.size())
+            {
+                flush();
+            }
+            std::size_t const chunk = std::min(size, this->buffer.size() - this->used);
+            std::memcpy(this->buffer.data() + this->used, bytes, chunk);
+            this->used += chunk;
+            bytes += chunk;
+            size -= chunk;
+        }
+    }
+
+    //!pads a unit of given length to the next multiple of 2880 bytes
+    void pad(std::size_t length, char fill)
+    {
+        std::size_t remaining = hdu::block_aligned_size(length) - length;
+        while (remaining > 0)
+        {
+            if (this->used == this->buffer.size())
+            {
+                flush();
+            }
+            std::size_t const chunk = std::min(remaining, this->buffer.size() - this->used);
+            std::memset(this->buffer.data() + this->used, fill, chunk);
+            this->used += chunk;
+            remaining -= chunk;
+        }
+    }
+};
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_FITS_WRITER_HPP
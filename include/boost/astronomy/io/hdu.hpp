@@ -5,17 +5,18 @@
 #include <fstream>
 #include <vector>
 #include <cstddef>
-#include <unordered_map>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
 #include <memory>
-
-#include <boost/algorithm/string/trim.hpp>
-#include <boost/lexical_cast.hpp>
+#include <algorithm>
 
 #include <boost/astronomy/io/bitpix.hpp>
 #include <boost/astronomy/io/image.hpp>
 #include <boost/astronomy/exception/fits_exception.hpp>
 #include <boost/astronomy/io/card.hpp>
 #include <boost/astronomy/io/column.hpp>
+#include <boost/astronomy/io/io_counters.hpp>
 
 namespace boost { namespace astronomy { namespace io {
 
@@ -26,16 +27,30 @@ struct hdu
 protected:
     boost::astronomy::io::bitpix bitpix_value; //! stores the BITPIX value (enum bitpix)
     std::vector<std::size_t> naxis_; //! values of all naxis (NAXIS, NAXIS1, NAXIS2...)
+    std::size_t pcount_ = 0; //! value of PCOUNT (0 if not present)
+    std::size_t gcount_ = 1; //! value of GCOUNT (1 if not present)
 
     //! Stores the each card in header unit (80 char key value pair)
     std::vector<card> cards;
 
-    //! stores the card-key index (used for faster searching)
-    std::unordered_map<std::string, std::size_t> key_index; 
+    //! keyword of a card and its position, kept sorted by keyword for searching
+    struct key_entry
+    {
+        char key[8]; //! keyword padded with spaces
+        std::uint32_t card; //! position of the card in cards
+    };
+
+    //! stores the card-key index (used for faster searching), a single allocation per header
+    std::vector<key_entry> key_index;
 
 public:
     hdu() {}
 
+    hdu(hdu const& other) = default;
+    hdu(hdu&& other) = default;
+    hdu& operator=(hdu const& other) = default;
+    hdu& operator=(hdu&& other) = default;
+
     hdu(std::string const& file_name)
     {
         std::fstream file(file_name, std::ios_base::in | std::ios_base::binary);
@@ -60,69 +75,78 @@ public:
         read_header(file, pos);
     }
 
+    //!Reads the header from the memory starting at begin (must be aligned to a 2880 byte block)
+    hdu(char const* begin, char const* end)
+    {
+        read_header(begin, end);
+    }
+
     //!Starts reading the header from current streampos of file
+    //!header is read a whole 2880 byte block at a time
     void read_header(std::fstream &file)
     {
-        cards.reserve(36); //reserves the space of atleast 1 HDU unit 
-        char _80_char_from_file[80]; //used as buffer to read a card consisting of 80 char
+        namespace bad = boost::astronomy::detail;
+        char block[2880]; //used as buffer to read a block of 36 cards
+        bad::io_timer header_timer(io_event_kind::header);
 
-        //reading file card by card until END card is found
-        while (true)
+        //reading file block by block until END card is found
+        for (std::size_t blocks = 1; ; blocks++)
         {
-            //read from file and create push card into the vector
-            file.read(_80_char_from_file, 80);
-            cards.emplace_back(_80_char_from_file);
-
-            //store the index of the card in map
-            this->key_index[this->cards.back().key()] = this->cards.size() - 1;
+            {
+                bad::io_timer read_timer(io_event_kind::read);
+                file.read(block, sizeof(block));
+                read_timer.set_bytes(static_cast<std::size_t>(file.gcount()));
+            }
+            if (file.gcount() != static_cast<std::streamsize>(sizeof(block)))
+            {
+                throw unexpected_end_of_data_exception();
+            }
 
-            //check if end card is found
-            if(this->cards.back().key(true) == "END     ")
+            header_timer.set_bytes(blocks * sizeof(block));
+            if (append_cards(block, sizeof(block) / 80))
             {
                 break;
             }
         }
-        set_unit_end(file);    //set cursor to the end of the HDU unit
+        set_header_values();
+    }
 
-        //finding and storing bitpix value
-                    
-        switch (cards[key_index["BITPIX"]].value<int>())
-        {
-        case 8:
-            this->bitpix_value = io::bitpix::B8;
-            break;
-        case 16:
-            this->bitpix_value = io::bitpix::B16;
-            break;
-        case 32:
-            this->bitpix_value = io::bitpix::B32;
-            break;
-        case -32:
-            this->bitpix_value = io::bitpix::_B32;
-            break;
-        case -64:
-            this->bitpix_value = io::bitpix::_B64;
-            break;
-        default:
-            throw fits_exception();
-            break;
-        }
-                    
-        //setting naxis values
-        naxis_.emplace_back(cards[key_index["NAXIS"]].value<std::size_t>());
-        naxis_.reserve(naxis_[0]);
-                    
-        for (std::size_t i = 1; i <= naxis_[0]; i++)
+    //!Reads the header from memory, cards are read until END card is found
+    //!returns the pointer to the first byte after the header unit
+    char const* read_header(char const* begin, char const* end)
+    {
+        boost::astronomy::detail::io_timer header_timer(io_event_kind::header);
+        char const* current = begin;
+
+        //reading memory block by block until END card is found
+        while (true)
         {
-            naxis_.emplace_back(cards[key_index["NAXIS" +
-                boost::lexical_cast<std::string>(i)]].value<std::size_t>());
+            std::size_t const available = static_cast<std::size_t>(end - current) / 80;
+            if (available == 0)
+            {
+                throw unexpected_end_of_data_exception();
+            }
+
+            std::size_t const before = this->cards.size();
+            bool const found_end = append_cards(current, std::min<std::size_t>(available, 36));
+            current += (this->cards.size() - before) * 80;
+            if (found_end)
+            {
+                break;
+            }
         }
+        set_header_values();
+
+        std::size_t const size = block_aligned_size(static_cast<std::size_t>(current - begin));
+        header_timer.set_bytes(size);
+        return begin + size;
     }
 
     //!starts reading file from the position specified
     void read_header(std::fstream &file, std::streampos pos)
     {
         file.seekg(pos);
+        boost::astronomy::detail::count_io(io_event_kind::seek);
         read_header(file);
     }
 
@@ -146,23 +170,246 @@ public:
 
     //!returns the value of perticular key 
     template <typename ReturnType>
-    ReturnType value_of(std::string const& key)// const
+    ReturnType value_of(std::string const& key) const
+    {
+        std::size_t const position = find_key(key);
+        if (position == this->cards.size())
+        {
+            throw std::out_of_range("key is not present in header: " + key);
+        }
+        return this->cards[position].value<ReturnType>();
+    }
+
+    //!returns all the cards of the header including the END card
+    std::vector<card> const& get_cards() const
+    {
+        return this->cards;
+    }
+
+    //!returns true if the card with given key is present in header
+    bool has_key(std::string const& key) const
+    {
+        return find_key(key) != this->cards.size();
+    }
+
+    //!returns the size of data unit in bytes (excluding the padding of last block)
+    //!size = |BITPIX| / 8 * GCOUNT * (PCOUNT + NAXIS1 * NAXIS2 * ... * NAXISn)
+    std::size_t data_size() const
+    {
+        if (this->naxis_[0] == 0)
+        {
+            return 0;
+        }
+
+        std::size_t elements = 1;
+        for (std::size_t i = 1; i <= this->naxis_[0]; i++)
+        {
+            elements *= this->naxis_[i];
+        }
+
+        return bitpix_size(this->bitpix_value) * this->gcount_ * (this->pcount_ + elements);
+    }
+
+    //!returns the size rounded up to the multiple of FITS block size (2880 bytes)
+    static std::size_t block_aligned_size(std::size_t size)
+    {
+        return ((size + 2879) / 2880) * 2880;
+    }
+
+    //!appends the parsed header to out: the values set from the cards, the cards and the
+    //!sorted key index in native byte order, see header_cache
+    void save_parsed(std::string& out) const
+    {
+        std::uint64_t const values[] = {static_cast<std::uint64_t>(this->bitpix_value),
+            this->pcount_, this->gcount_, this->naxis_.size(), this->cards.size(),
+            this->key_index.size()};
+        out.append(reinterpret_cast<char const*>(values), sizeof(values));
+        for (std::size_t axis : this->naxis_)
+        {
+            std::uint64_t const value = axis;
+            out.append(reinterpret_cast<char const*>(&value), sizeof(value));
+        }
+        for (auto const& header_card : this->cards)
+        {
+            out.append(header_card.data(), 80);
+        }
+        out.append(reinterpret_cast<char const*>(this->key_index.data()),
+            this->key_index.size() * sizeof(key_entry));
+    }
+
+    //!restores a header saved by save_parsed without parsing its cards again
+    //!returns the first byte after the saved header or nullptr if the bytes are not valid
+    char const* load_parsed(char const* begin, char const* end)
     {
-        return this->cards[key_index.at(key)].value<ReturnType>();
+        std::uint64_t values[6];
+        if (static_cast<std::size_t>(end - begin) < sizeof(values))
+        {
+            return nullptr;
+        }
+        std::memcpy(values, begin, sizeof(values));
+        begin += sizeof(values);
+
+        std::uint64_t const axes = values[3], card_count = values[4], keys = values[5];
+        std::uint64_t const available = static_cast<std::uint64_t>(end - begin);
+        if (values[0] > static_cast<std::uint64_t>(io::bitpix::_B64) || axes == 0 ||
+            axes > 1000 || card_count > available / 80 || keys > card_count ||
+            axes * 8 + card_count * 80 + keys * sizeof(key_entry) > available)
+        {
+            return nullptr;
+        }
+
+        this->bitpix_value = static_cast<io::bitpix>(values[0]);
+        this->pcount_ = static_cast<std::size_t>(values[1]);
+        this->gcount_ = static_cast<std::size_t>(values[2]);
+        this->naxis_.resize(static_cast<std::size_t>(axes));
+        for (auto& axis : this->naxis_)
+        {
+            std::uint64_t value;
+            std::memcpy(&value, begin, sizeof(value));
+            axis = static_cast<std::size_t>(value);
+            begin += sizeof(value);
+        }
+        if (this->naxis_[0] + 1 != this->naxis_.size())
+        {
+            return nullptr;
+        }
+
+        this->cards.clear();
+        this->cards.reserve(static_cast<std::size_t>(card_count));
+        for (std::uint64_t i = 0; i < card_count; i++, begin += 80)
+        {
+            this->cards.emplace_back(begin);
+        }
+        this->key_index.resize(static_cast<std::size_t>(keys));
+        std::memcpy(this->key_index.data(), begin, this->key_index.size() * sizeof(key_entry));
+        begin += this->key_index.size() * sizeof(key_entry);
+        for (auto const& entry : this->key_index)
+        {
+            if (entry.card >= card_count)
+            {
+                return nullptr;
+            }
+        }
+        return begin;
     }
 
     void set_unit_end(std::fstream &file) const
     {
         //set cursor to the end of the HDU unit
-        file.seekg((file.tellg() + (2880 - (file.tellg() % 2880))));    
+        std::streamoff remainder = file.tellg() % 2880;
+        if (remainder != 0)
+        {
+            file.seekg(file.tellg() + (2880 - remainder));
+            boost::astronomy::detail::count_io(io_event_kind::seek);
+        }
     }
 
-    virtual std::unique_ptr<column> get_column(std::string name) const
+    virtual std::unique_ptr<column> get_column(std::string const& name) const
     {
         throw wrong_extension_type();
     }
+
+    virtual ~hdu() {}
+
+protected:
+    //!appends count cards stored from begin and indexes them by keyword
+    //!returns true if END card is found, cards after it are ignored
+    bool append_cards(char const* begin, std::size_t count)
+    {
+        if (this->cards.capacity() < this->cards.size() + count)
+        {
+            this->cards.reserve(std::max(2 * this->cards.capacity(), this->cards.size() + count));
+            this->key_index.reserve(this->cards.capacity());
+        }
+        for (std::size_t i = 0; i < count; i++)
+        {
+            char const* raw = begin + i * 80;
+            this->cards.emplace_back(raw);
+            if (this->cards.back().key_is("END"))
+            {
+                return true;
+            }
+
+            key_entry entry;
+            std::memcpy(entry.key, raw, 8);
+            entry.card = static_cast<std::uint32_t>(this->cards.size() - 1);
+            this->key_index.push_back(entry);
+        }
+        return false;
+    }
+
+    //!sorts the key index, cards with the same keyword keep their order
+    void sort_keys()
+    {
+        std::stable_sort(this->key_index.begin(), this->key_index.end(),
+            [](key_entry const& lhs, key_entry const& rhs) {
+                return std::memcmp(lhs.key, rhs.key, 8) < 0;
+            });
+    }
+
+    //!returns position of the last card with given keyword or cards.size() if there is none
+    std::size_t find_key(std::string const& key) const
+    {
+        if (key.length() > 8)
+        {
+            return this->cards.size();
+        }
+        char padded[8];
+        std::memset(padded, ' ', 8);
+        std::memcpy(padded, key.data(), key.length());
+
+        auto last = std::upper_bound(this->key_index.begin(), this->key_index.end(), padded,
+            [](char const* value, key_entry const& entry) {
+                return std::memcmp(value, entry.key, 8) < 0;
+            });
+        if (last == this->key_index.begin() || std::memcmp((last - 1)->key, padded, 8) != 0)
+        {
+            return this->cards.size();
+        }
+        return (last - 1)->card;
+    }
+
+    //!sets bitpix, naxis, pcount and gcount values from the cards read
+    void set_header_values()
+    {
+        sort_keys();
+
+        switch (value_of<int>("BITPIX"))
+        {
+        case 8:
+            this->bitpix_value = io::bitpix::B8;
+            break;
+        case 16:
+            this->bitpix_value = io::bitpix::B16;
+            break;
+        case 32:
+            this->bitpix_value = io::bitpix::B32;
+            break;
+        case -32:
+            this->bitpix_value = io::bitpix::_B32;
+            break;
+        case -64:
+            this->bitpix_value = io::bitpix::_B64;
+            break;
+        default:
+            throw fits_exception();
+            break;
+        }
+
+        //setting naxis values
+        naxis_.clear();
+        naxis_.emplace_back(value_of<std::size_t>("NAXIS"));
+        naxis_.reserve(naxis_[0] + 1);
+
+        for (std::size_t i = 1; i <= naxis_[0]; i++)
+        {
+            naxis_.emplace_back(value_of<std::size_t>("NAXIS" + std::to_string(i)));
+        }
+
+        pcount_ = has_key("PCOUNT") ? value_of<std::size_t>("PCOUNT") : 0;
+        gcount_ = has_key("GCOUNT") ? value_of<std::size_t>("GCOUNT") : 1;
+    }
 };
 }}} //namespace boost::astronomy::io
 
 #endif // !BOOST_ASTRONOMY_IO_HDU_HPP
-
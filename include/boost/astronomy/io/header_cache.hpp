@@ -0,0 +1,344 @@
+#ifndef BOOST_ASTRONOMY_IO_HEADER_CACHE_HPP
+#define BOOST_ASTRONOMY_IO_HEADER_CACHE_HPP
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include <boost/static_assert.hpp>
+
+#if defined(_WIN32)
+#include <boost/winapi/file_management.hpp>
+#endif
+
+#include <boost/astronomy/io/hdu.hpp>
+#include <boost/astronomy/io/io_counters.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+//!location of an HDU inside the FITS file
+struct hdu_directory_entry
+{
+    std::streamoff header_offset = 0; //! position of first card of the header
+    std::streamoff data_offset = 0; //! position of first byte of the data unit
+    std::size_t data_size = 0; //! size of data unit in bytes (without padding)
+    bool loaded = false; //! true if data unit is read into memory
+};
+
+//!Where the parsed headers of the FITS files opened through it are kept between opens
+/*!
+The index of a file holds its HDU directory and every parsed header (the values
+of BITPIX, NAXISn, PCOUNT and GCOUNT, the cards and the sorted key index) in a
+compact binary file, so that later opens read one small file instead of parsing
+the header blocks spread over the FITS file. An index is only used while the
+size and modification time of the FITS file are the ones it was made from.
+
+Without a directory the index is a sidecar next to the file (path + ".hdx"),
+otherwise all the indexes are kept in directory, named after a hash of the path
+of their file, which also stores the path to tell apart files with the same hash.
+Indexes are replaced atomically (written to a temporary file then renamed), so
+several processes may open the same files at once.
+*/
+struct header_cache
+{
+    std::string directory; //! shared directory of the indexes, empty for sidecar files
+    bool update = true; //! writes the index of files which have none or a stale one
+
+    header_cache() {}
+
+    explicit header_cache(std::string const& cache_directory, bool update_index = true) :
+        directory(cache_directory), update(update_index) {}
+
+    //!returns the path of the index of the FITS file at fits_path
+    std::string index_path(std::string const& fits_path) const
+    {
+        if (this->directory.empty())
+        {
+            return fits_path + ".hdx";
+        }
+
+        //FNV-1a hash keeps the names stable across runs and platforms
+        std::uint64_t hash = 14695981039346656037ull;
+        for (char c : fits_path)
+        {
+            hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+        }
+        char name[17];
+        std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(hash));
+        return this->directory + "/" + name + ".hdx";
+    }
+};
+
+///@cond INTERNAL
+namespace detail_header_cache {
+
+std::uint32_t const format_version = 1;
+std::uint32_t const byte_order_mark = 0x01020304;
+char const magic[8] = {'A', 'S', 'T', 'R', 'O', 'H', 'D', 'X'};
+
+// size and modification time identifying the content of a file
+struct file_stamp
+{
+    std::uint64_t size = 0;
+    std::int64_t seconds = 0;
+    std::int64_t nanoseconds = 0;
+};
+
+// start of every index, all the values are in the byte order of the writer
+// followed by the path of the FITS file and then by every HDU: its index_entry
+// and its header saved by hdu::save_parsed
+struct index_header
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order;
+    std::uint64_t size; //! stamp of the FITS file
+    std::int64_t seconds;
+    std::int64_t nanoseconds;
+    std::uint64_t path_length; //! bytes of the path following the header
+    std::uint64_t hdu_count;
+    std::uint64_t reserved;
+};
+
+BOOST_STATIC_ASSERT_MSG(sizeof(index_header) == 64, "unexpected padding of header index");
+
+struct index_entry
+{
+    std::int64_t header_offset;
+    std::int64_t data_offset;
+    std::uint64_t data_size;
+};
+
+// returns false if the file cannot be found
+inline bool stamp_file(std::string const& path, file_stamp& stamp)
+{
+#if defined(_WIN32)
+    struct _stat64 info;
+    if (_stat64(path.c_str(), &info) != 0)
+    {
+        return false;
+    }
+#else
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0)
+    {
+        return false;
+    }
+#endif
+    stamp.size = static_cast<std::uint64_t>(info.st_size);
+    stamp.seconds = static_cast<std::int64_t>(info.st_mtime);
+#if defined(__linux__)
+    stamp.nanoseconds = static_cast<std::int64_t>(info.st_mtim.tv_nsec);
+#elif defined(__APPLE__)
+    stamp.nanoseconds = static_cast<std::int64_t>(info.st_mtimespec.tv_nsec);
+#endif
+    return true;
+}
+
+// moves the file at from to the path to, replacing the file already there if any
+inline bool replace_file(std::string const& from, std::string const& to)
+{
+#if defined(_WIN32)
+    //std::rename does not replace an existing file on Windows
+    boost::winapi::DWORD_ const replace_existing = 0x1; // MOVEFILE_REPLACE_EXISTING
+    return boost::winapi::move_file(from.c_str(), to.c_str(), replace_existing) != 0;
+#else
+    return std::rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
+// reads the whole file into bytes, returns false if it cannot be read
+inline bool read_file(std::string const& path, std::string& bytes)
+{
+    std::ifstream file(path, std::ios_base::in | std::ios_base::binary);
+    if (!file)
+    {
+        return false;
+    }
+    file.seekg(0, std::ios_base::end);
+    std::streamoff const size = file.tellg();
+    if (size <= 0)
+    {
+        return false;
+    }
+    bytes.resize(static_cast<std::size_t>(size));
+    file.seekg(0);
+    boost::astronomy::detail::io_timer timer(io_event_kind::read, bytes.size());
+    file.read(&bytes[0], static_cast<std::streamsize>(size));
+    return file.gcount() == static_cast<std::streamsize>(size);
+}
+
+} // namespace detail_header_cache
+///@endcond
+
+//!Reads the index of the FITS file at fits_path kept by cache into headers and directory
+//!returns false (leaving both unchanged) when there is no valid index matching the file
+inline bool read_header_index
+(
+    header_cache const& cache,
+    std::string const& fits_path,
+    std::vector<hdu>& headers,
+    std::vector<hdu_directory_entry>& directory
+)
+{
+    namespace dhc = detail_header_cache;
+    dhc::file_stamp stamp;
+    std::string bytes;
+    if (!dhc::stamp_file(fits_path, stamp) ||
+        !dhc::read_file(cache.index_path(fits_path), bytes) ||
+        bytes.size() < sizeof(dhc::index_header))
+    {
+        return false;
+    }
+
+    dhc::index_header header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    char const* current = bytes.data() + sizeof(header);
+    char const* const end = bytes.data() + bytes.size();
+    if (std::memcmp(header.magic, dhc::magic, sizeof(dhc::magic)) != 0 ||
+        header.version != dhc::format_version || header.byte_order != dhc::byte_order_mark ||
+        header.size != stamp.size || header.seconds != stamp.seconds ||
+        header.nanoseconds != stamp.nanoseconds ||
+        header.path_length != fits_path.size() ||
+        header.path_length > static_cast<std::uint64_t>(end - current) ||
+        fits_path.compare(0, fits_path.size(), current, fits_path.size()) != 0)
+    {
+        return false;
+    }
+    current += fits_path.size();
+
+    std::vector<hdu> parsed;
+    std::vector<hdu_directory_entry> entries;
+    for (std::uint64_t i = 0; i < header.hdu_count; i++)
+    {
+        dhc::index_entry stored;
+        if (static_cast<std::size_t>(end - current) < sizeof(stored))
+        {
+            return false;
+        }
+        std::memcpy(&stored, current, sizeof(stored));
+        current += sizeof(stored);
+
+        hdu_directory_entry entry;
+        entry.header_offset = static_cast<std::streamoff>(stored.header_offset);
+        entry.data_offset = static_cast<std::streamoff>(stored.data_offset);
+        entry.data_size = static_cast<std::size_t>(stored.data_size);
+        entries.push_back(entry);
+
+        parsed.emplace_back();
+        current = parsed.back().load_parsed(current, end);
+        if (current == nullptr)
+        {
+            return false;
+        }
+    }
+    if (current != end)
+    {
+        return false;
+    }
+
+    headers = std::move(parsed);
+    directory = std::move(entries);
+    return true;
+}
+
+///@cond INTERNAL
+namespace detail_header_cache {
+
+// writes the index of the file at fits_path whose headers were read while it had stamp
+// nothing is written if the file has changed since
+inline bool write_index
+(
+    header_cache const& cache,
+    std::string const& fits_path,
+    file_stamp const& stamp,
+    std::vector<std::shared_ptr<hdu>> const& headers,
+    std::vector<hdu_directory_entry> const& directory
+)
+{
+    file_stamp current;
+    if (headers.size() != directory.size() || !stamp_file(fits_path, current) ||
+        current.size != stamp.size || current.seconds != stamp.seconds ||
+        current.nanoseconds != stamp.nanoseconds)
+    {
+        return false;
+    }
+
+    index_header header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.version = format_version;
+    header.byte_order = byte_order_mark;
+    header.size = stamp.size;
+    header.seconds = stamp.seconds;
+    header.nanoseconds = stamp.nanoseconds;
+    header.path_length = fits_path.size();
+    header.hdu_count = headers.size();
+
+    std::string bytes(reinterpret_cast<char const*>(&header), sizeof(header));
+    bytes += fits_path;
+    for (std::size_t i = 0; i < headers.size(); i++)
+    {
+        index_entry const stored = {static_cast<std::int64_t>(directory[i].header_offset),
+            static_cast<std::int64_t>(directory[i].data_offset),
+            static_cast<std::uint64_t>(directory[i].data_size)};
+        bytes.append(reinterpret_cast<char const*>(&stored), sizeof(stored));
+        headers[i]->save_parsed(bytes);
+    }
+
+    //unique name so that concurrent writers never mix their bytes
+    std::string const path = cache.index_path(fits_path);
+    std::string const temporary = path + ".tmp" + std::to_string(
+        std::hash<std::thread::id>()(std::this_thread::get_id()) ^ static_cast<std::size_t>(
+        std::chrono::steady_clock::now().time_since_epoch().count()));
+    {
+        std::ofstream file(temporary, std::ios_base::out | std::ios_base::binary |
+            std::ios_base::trunc);
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        if (!file)
+        {
+            file.close();
+            std::remove(temporary.c_str());
+            return false;
+        }
+    }
+    if (!replace_file(temporary, path))
+    {
+        std::remove(temporary.c_str());
+        return false;
+    }
+    return true;
+}
+
+} // namespace detail_header_cache
+///@endcond
+
+//!Writes the index of the FITS file at fits_path for cache from its headers and directory
+//!returns false if it could not be written, which only costs the next open a parse
+inline bool write_header_index
+(
+    header_cache const& cache,
+    std::string const& fits_path,
+    std::vector<std::shared_ptr<hdu>> const& headers,
+    std::vector<hdu_directory_entry> const& directory
+)
+{
+    detail_header_cache::file_stamp stamp;
+    return detail_header_cache::stamp_file(fits_path, stamp) &&
+        detail_header_cache::write_index(cache, fits_path, stamp, headers, directory);
+}
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_HEADER_CACHE_HPP
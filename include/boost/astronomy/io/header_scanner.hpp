@@ -0,0 +1,203 @@
+#ifndef BOOST_ASTRONOMY_IO_HEADER_SCANNER_HPP
+#define BOOST_ASTRONOMY_IO_HEADER_SCANNER_HPP
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <thread>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+
+#include <boost/astronomy/io/card.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+//!Keyword values of the primary headers of many files stored column by column
+/*!
+Column k holds the card of keywords[k] for every file in the order of paths.
+Cards are kept as read so values are parsed only when requested.
+*/
+struct header_table
+{
+    std::vector<std::string> paths; //! files which were scanned
+    std::vector<std::string> keywords; //! keywords which were searched
+    std::vector<char> readable; //! non zero if the header of the file was read till END
+    std::vector<std::vector<card>> cards; //! cards[k][file] is the card of keywords[k]
+    std::vector<std::vector<char>> found; //! found[k][file] is non zero if the card is present
+
+    //!returns the number of files
+    std::size_t rows() const
+    {
+        return this->paths.size();
+    }
+
+    //!returns the column of given keyword, throws key_not_defined_exception if it was not searched
+    std::size_t keyword_index(std::string const& keyword) const
+    {
+        auto position = std::find(this->keywords.begin(), this->keywords.end(), keyword);
+        if (position == this->keywords.end())
+        {
+            throw key_not_defined_exception();
+        }
+        return static_cast<std::size_t>(position - this->keywords.begin());
+    }
+
+    //!returns true if the header of given file contains the keyword
+    bool has_value(std::string const& keyword, std::size_t file) const
+    {
+        return this->found[keyword_index(keyword)][file] != 0;
+    }
+
+    //!returns the value of keyword in the given file
+    template <typename T>
+    T value(std::string const& keyword, std::size_t file) const
+    {
+        std::size_t const k = keyword_index(keyword);
+        if (!this->found[k][file])
+        {
+            throw key_not_defined_exception();
+        }
+        return this->cards[k][file].value<T>();
+    }
+
+    //!returns the values of keyword for all the files, missing values are replaced by fallback
+    template <typename T>
+    std::vector<T> column(std::string const& keyword, T const& fallback = T()) const
+    {
+        std::size_t const k = keyword_index(keyword);
+        std::vector<T> values(this->rows(), fallback);
+        for (std::size_t file = 0; file < this->rows(); file++)
+        {
+            if (this->found[k][file])
+            {
+                values[file] = this->cards[k][file].value<T>();
+            }
+        }
+        return values;
+    }
+};
+
+}}} //namespace boost::astronomy::io
+
+namespace boost { namespace astronomy { namespace detail {
+
+///@cond INTERNAL
+// scans the primary header of a file for the keywords padded to 8 chars
+// header blocks are read until END is found or all the keywords are found
+inline void scan_header
+(
+    std::string const& path,
+    std::vector<std::string> const& padded_keywords,
+    io::header_table& table,
+    std::size_t file
+)
+{
+    std::ifstream stream(path, std::ios_base::in | std::ios_base::binary);
+    if (!stream)
+    {
+        return;
+    }
+
+    char block[2880];
+    std::size_t remaining = padded_keywords.size();
+    while (stream.read(block, sizeof(block)))
+    {
+        for (std::size_t offset = 0; offset < sizeof(block); offset += 80)
+        {
+            char const* raw = block + offset;
+            if (std::memcmp(raw, "END     ", 8) == 0)
+            {
+                table.readable[file] = 1;
+                return;
+            }
+
+            for (std::size_t k = 0; k < padded_keywords.size(); k++)
+            {
+                if (!table.found[k][file] && std::memcmp(raw, padded_keywords[k].data(), 8) == 0)
+                {
+                    table.cards[k][file] = io::card(raw);
+                    table.found[k][file] = 1;
+                    remaining--;
+                    break;
+                }
+            }
+
+            if (remaining == 0)
+            {
+                table.readable[file] = 1;
+                return;
+            }
+        }
+    }
+}
+///@endcond
+
+}}} //namespace boost::astronomy::detail
+
+namespace boost { namespace astronomy { namespace io {
+
+//!reads the given keywords from the primary header of every file using upto threads threads
+/*!
+Only the header blocks preceding the last wanted keyword (or END) are read, data
+units are never touched. Files are handed to threads one at a time from a shared
+counter so that slow files do not hold back the others, threads equal to 0 uses
+all the hardware threads. Files which cannot be opened or whose header ends
+before END are reported through header_table::readable.
+*/
+inline header_table scan_headers
+(
+    std::vector<std::string> const& paths,
+    std::vector<std::string> const& keywords,
+    std::size_t threads = 0
+)
+{
+    std::vector<std::string> padded_keywords;
+    for (auto const& keyword : keywords)
+    {
+        if (keyword.length() > 8)
+        {
+            throw invalid_key_length_exception();
+        }
+        padded_keywords.push_back(std::string(keyword).append(8 - keyword.length(), ' '));
+    }
+
+    header_table table;
+    table.paths = paths;
+    table.keywords = keywords;
+    table.readable.assign(paths.size(), 0);
+    table.cards.assign(keywords.size(), std::vector<card>(paths.size()));
+    table.found.assign(keywords.size(), std::vector<char>(paths.size(), 0));
+
+    if (threads == 0)
+    {
+        threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    threads = std::max<std::size_t>(std::min(threads, paths.size()), 1);
+
+    std::atomic<std::size_t> next(0);
+    auto worker = [&]() {
+        for (std::size_t file = next++; file < paths.size(); file = next++)
+        {
+            boost::astronomy::detail::scan_header(paths[file], padded_keywords, table, file);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (std::size_t t = 1; t < threads; t++)
+    {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : workers)
+    {
+        thread.join();
+    }
+    return table;
+}
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_HEADER_SCANNER_HPP
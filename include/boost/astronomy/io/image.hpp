@@ -12,10 +12,12 @@
 #include <cmath>
 #include <numeric>
 
-#include <boost/endian/conversion.hpp>
 #include <boost/cstdfloat.hpp>
 
 #include <boost/astronomy/io/bitpix.hpp>
+#include <boost/astronomy/io/image_statistics.hpp>
+#include <boost/astronomy/io/io_counters.hpp>
+#include <boost/astronomy/detail/endian.hpp>
 
 
 namespace boost { namespace astronomy { namespace io {
@@ -25,17 +27,31 @@ struct image_buffer
 {
 protected:
     std::valarray<PixelType> data; //! stores the image
-    std::size_t width; //! width of image 
-    std::size_t height; //! height of image
+    std::size_t width = 0; //! width of image 
+    std::size_t height = 0; //! height of image
     //std::fstream image_file; //! image file
 
-    //! Used purly for Type punning
-    union pixel_data
+    //! reads all the pixels of the image in one go from current position of image_file
+    //! and converts them from big endian to native byte order
+    void read_big_endian(std::istream &image_file)
     {
-        PixelType pixel;
-        std::uint8_t byte[sizeof(PixelType)];
-        //char byte[sizeof(PixelType)];
-    };
+        if (this->data.size() == 0)
+        {
+            return;
+        }
+
+        namespace bad = boost::astronomy::detail;
+        std::size_t const bytes = this->data.size() * sizeof(PixelType);
+        //the pixels are always sized by read_image just before they are read
+        bad::count_io(io_event_kind::allocation, bytes);
+        {
+            bad::io_timer read_timer(io_event_kind::read, bytes);
+            image_file.read(reinterpret_cast<char*>(std::begin(this->data)),
+                static_cast<std::streamsize>(bytes));
+        }
+        bad::io_timer swap_timer(io_event_kind::byte_swap, bytes);
+        bad::big_to_native_array(std::begin(this->data), this->data.size());
+    }
 
 public:
     image_buffer() {}
@@ -71,42 +87,85 @@ public:
             std::end(this->data), 0.0) / this->data.size());
     }
 
-    //! returns the median of all the pixel values in the image 
-    //! Note: uses additional space of order O(n) where n is the number of total pixels
-    PixelType median() const
+    //! returns min, max, mean and variance of all the pixel values in a single pass
+    //! the image is split across given number of threads (0 uses all hardware threads)
+    //! Note: NaN pixels are not counted
+    image_statistics statistics(std::size_t threads = 0) const
     {
-        std::valarray<PixelType> soreted_array = this->data;
-        std::nth_element(std::begin(soreted_array),
-            std::begin(soreted_array) + soreted_array.size() / 2, std::end(soreted_array));
+        if (this->data.size() == 0)
+        {
+            return image_statistics();
+        }
 
-        return soreted_array[soreted_array.size() / 2];
+        return boost::astronomy::detail::compute_statistics(std::begin(this->data),
+            this->data.size(), threads);
     }
 
-    //! returns the standard deviation of all the pixel values in the image 
-    //! Note: uses additional space of order O(n) where n is the number of total pixels
-    double std_dev() const
+    //! returns the statistics of all the pixel values computed on an offload device
+    //! a chunk at a time, the threads are used when the device does not support the pixels
+    image_statistics statistics
+    (
+        boost::astronomy::offload_device& device,
+        std::size_t threads = 0
+    ) const
     {
         if (this->data.size() == 0)
         {
-            return 0;
+            return image_statistics();
         }
 
-        double avg = this->mean();
+        return boost::astronomy::detail::compute_statistics(std::begin(this->data),
+            this->data.size(), threads, &device);
+    }
 
-        std::valarray<double> diff(this->data.size());
-        for (size_t i = 0; i < diff.size(); i++)
+    //! returns the median of all the pixel values in the image
+    //! Note: the image is not copied, the median is found by refining a histogram
+    PixelType median() const
+    {
+        image_statistics stats = this->statistics();
+        if (stats.count == 0)
         {
-            diff[i] = this->data[i] - avg;
+            return PixelType();
         }
-                    
-        diff *= diff;
-        return std::sqrt(diff.sum() / (diff.size() - 1));
+
+        return boost::astronomy::detail::select_rank(std::begin(this->data), this->data.size(),
+            stats.count / 2, stats.min, stats.max);
+    }
+
+    //! returns the standard deviation of all the pixel values in the image
+    double std_dev() const
+    {
+        return this->statistics().std_dev();
     }
 
-    PixelType operator() (std::size_t x, std::size_t y)
+    PixelType operator() (std::size_t x, std::size_t y) const
     {
         return this->data[(x*this->width) + y];
     }
+
+    //! returns the total number of pixels in the image
+    std::size_t size() const
+    {
+        return this->data.size();
+    }
+
+    //! returns the number of pixels in a row (NAXIS1)
+    std::size_t get_width() const
+    {
+        return this->width;
+    }
+
+    //! returns the number of rows (NAXIS2)
+    std::size_t get_height() const
+    {
+        return this->height;
+    }
+
+    //! returns the pointer to the first pixel, pixels are stored row after row
+    PixelType const* pixels() const
+    {
+        return this->data.size() == 0 ? nullptr : std::begin(this->data);
+    }
 };
 
 
@@ -149,8 +208,7 @@ public:
 
     void read_image_logic(std::fstream &image_file)
     {
-        image_file.read((char*)std::begin(data), width*height);
-        //std::copy_n(std::istreambuf_iterator<char>(file.rdbuf()), width*height, std::begin(data));
+        this->read_big_endian(image_file);
     }
 
     void read_image
@@ -162,6 +220,8 @@ public:
     )
     {
         std::fstream image_file(file);
+        this->width = width;
+        this->height = height;
         data.resize(width*height);
         image_file.seekg(start);
 
@@ -177,6 +237,8 @@ public:
 
     void read_image(std::fstream &file, std::size_t width, std::size_t height, std::streamoff start)
     {
+        this->width = width;
+        this->height = height;
         data.resize(width*height);
         file.seekg(start);
 
@@ -225,11 +287,7 @@ public:
 
     void read_image_logic(std::fstream &image_file)
     {
-        for (std::size_t i = 0; i < height*width; i++)
-        {
-            image_file.read((char*)&data[i], 2);
-            data[i] = boost::endian::big_to_native(data[i]);
-        }
+        this->read_big_endian(image_file);
     }
 
     void read_image
@@ -241,7 +299,8 @@ public:
     )
     {
         std::fstream image_file(file);
-        image_file.open(file);
+        this->width = width;
+        this->height = height;
         data.resize(width*height);
         image_file.seekg(start);
 
@@ -257,6 +316,8 @@ public:
 
     void read_image(std::fstream &file, std::size_t width, std::size_t height, std::streamoff start)
     {
+        this->width = width;
+        this->height = height;
         data.resize(width*height);
         file.seekg(start);
 
@@ -305,11 +366,7 @@ public:
 
     void read_image_logic(std::fstream &image_file)
     {
-        for (std::size_t i = 0; i < height*width; i++)
-        {
-            image_file.read((char*)&data[i], 4);
-            data[i] = boost::endian::big_to_native(data[i]);
-        }
+        this->read_big_endian(image_file);
     }
 
     //!reads image
@@ -322,6 +379,8 @@ public:
     )
     {
         std::fstream image_file(file);
+        this->width = width;
+        this->height = height;
         data.resize(width*height);
         image_file.seekg(start);
 
@@ -337,6 +396,8 @@ public:
 
     void read_image(std::fstream &file, std::size_t width, std::size_t height, std::streamoff start)
     {
+        this->width = width;
+        this->height = height;
         data.resize(width*height);
         file.seekg(start);
 
@@ -385,13 +446,7 @@ public:
 
     void read_image_logic(std::fstream &image_file)
     {
-        pixel_data single_pixel;
-        for (std::size_t i = 0; i < height*width; i++)
-        {
-            image_file.read((char*)single_pixel.byte, 4);
-            data[i] = (single_pixel.byte[3] << 0) | (single_pixel.byte[2] << 8) |
-                (single_pixel.byte[1] << 16) | (single_pixel.byte[0] << 24);
-        }
+        this->read_big_endian(image_file);
     }
 
     void read_image
@@ -403,6 +458,8 @@ public:
     )
     {
         std::fstream image_file(file);
+        this->width = width;
+        this->height = height;
         data.resize(width*height);
         image_file.seekg(start);
 
@@ -417,6 +474,8 @@ public:
 
     void read_image(std::fstream &file, std::size_t width, std::size_t height, std::streamoff start)
     {
+        this->width = width;
+        this->height = height;
         data.resize(width*height);
         file.seekg(start);
 
@@ -465,15 +524,7 @@ public:
 
     void read_image_logic(std::fstream &image_file)
     {
-        pixel_data single_pixel;
-        for (std::size_t i = 0; i < height*width; i++)
-        {
-            image_file.read((char*)single_pixel.byte, 8);
-            data[i] = (single_pixel.byte[7] << 0) | (single_pixel.byte[6] << 8) |
-                (single_pixel.byte[5] << 16) | (single_pixel.byte[4] << 24) |
-                (single_pixel.byte[3] << 32) | (single_pixel.byte[2] << 40) |
-                (single_pixel.byte[1] << 48) | (single_pixel.byte[0] << 56);
-        }
+        this->read_big_endian(image_file);
     }
 
     void read_image
@@ -485,6 +536,8 @@ public:
     )
     {
         std::fstream image_file(file);
+        this->width = width;
+        this->height = height;
         data.resize(width*height);
         image_file.seekg(start);
 
@@ -500,6 +553,8 @@ public:
 
     void read_image(std::fstream &file, std::size_t width, std::size_t height, std::streamoff start)
     {
+        this->width = width;
+        this->height = height;
         data.resize(width*height);
         file.seekg(start);
 
@@ -0,0 +1,425 @@
+#ifndef BOOST_ASTRONOMY_IO_IMAGE_BACKGROUND_HPP
+#define BOOST_ASTRONOMY_IO_IMAGE_BACKGROUND_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+
+#include <boost/astronomy/io/image.hpp>
+#include <boost/astronomy/io/image_statistics.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+//!options of background_map
+struct background_options
+{
+    std::size_t mesh_size = 64; //! meshes are mesh_size x mesh_size pixels, less on the last ones
+    std::size_t filter_size = 3; //! median filter over filter_size x filter_size meshes
+    double clip_sigma = 3; //! pixels further than clip_sigma std_dev from the median are rejected
+    std::size_t clip_iterations = 10; //! maximum number of clipping iterations
+    double min_fraction = 0.5; //! valid meshes keep at least this fraction of their pixels
+    std::size_t threads = 0; //! threads sharing the meshes, 0 uses all the hardware threads
+};
+
+///@cond INTERNAL
+namespace detail_background {
+
+// clipped background and rms of the pixels of a mesh, values are sorted on return
+// the pixels kept form a range of the sorted values, the running sums only lose the
+// newly rejected pixels as in robust_statistics
+inline bool mesh_estimate
+(
+    std::vector<double>& values,
+    std::size_t pixels,
+    background_options const& options,
+    double& background,
+    double& rms
+)
+{
+    if (values.empty() ||
+        static_cast<double>(values.size()) < options.min_fraction * static_cast<double>(pixels))
+    {
+        return false;
+    }
+    std::sort(values.begin(), values.end());
+    std::size_t first = 0;
+    std::size_t last = values.size();
+    double const shift = values[values.size() / 2];
+    double sum = 0, sum_squares = 0;
+    for (double value : values)
+    {
+        sum += value - shift;
+        sum_squares += (value - shift) * (value - shift);
+    }
+
+    double mean = 0, std_dev = 0, median = 0;
+    for (std::size_t iteration = 0; ; iteration++)
+    {
+        double const count = static_cast<double>(last - first);
+        mean = shift + sum / count;
+        std_dev = last - first > 1 ?
+            std::sqrt(std::max(0.0, (sum_squares - sum * sum / count) / (count - 1))) : 0;
+        std::size_t const middle = first + (last - first) / 2;
+        median = (last - first) % 2 == 1 ? values[middle] :
+            0.5 * (values[middle - 1] + values[middle]);
+        if (iteration == options.clip_iterations)
+        {
+            break;
+        }
+
+        double const low = median - options.clip_sigma * std_dev;
+        double const high = median + options.clip_sigma * std_dev;
+        std::size_t const old_first = first, old_last = last;
+        while (first < last && values[first] < low)
+        {
+            sum -= values[first] - shift;
+            sum_squares -= (values[first] - shift) * (values[first] - shift);
+            first++;
+        }
+        while (last > first && values[last - 1] > high)
+        {
+            last--;
+            sum -= values[last] - shift;
+            sum_squares -= (values[last] - shift) * (values[last] - shift);
+        }
+        if (first == last)
+        {
+            return false;
+        }
+        if (first == old_first && last == old_last)
+        {
+            break;
+        }
+    }
+
+    //mode estimate of crowded fields (Bertin and Arnouts 1996)
+    background = std_dev > 0 && (mean - median) / std_dev > 0.3 ? median :
+        2.5 * median - 1.5 * mean;
+    rms = std_dev;
+    return true;
+}
+
+// median of the valid values of a window of the mesh grid
+inline double window_median
+(
+    std::vector<double> const& grid,
+    std::size_t columns,
+    std::size_t rows,
+    std::size_t column,
+    std::size_t row,
+    std::size_t radius,
+    std::vector<double>& window
+)
+{
+    window.clear();
+    std::size_t const first_row = row > radius ? row - radius : 0;
+    std::size_t const first_column = column > radius ? column - radius : 0;
+    for (std::size_t j = first_row; j < std::min(rows, row + radius + 1); j++)
+    {
+        for (std::size_t i = first_column; i < std::min(columns, column + radius + 1); i++)
+        {
+            window.push_back(grid[j * columns + i]);
+        }
+    }
+    std::size_t const middle = window.size() / 2;
+    std::nth_element(window.begin(), window.begin() + middle, window.end());
+    double median = window[middle];
+    if (window.size() % 2 == 0)
+    {
+        median = 0.5 * (median + *std::max_element(window.begin(), window.begin() + middle));
+    }
+    return median;
+}
+
+// centre of a mesh along an axis in pixels, the last mesh may be shorter than the others
+inline double mesh_centre(std::size_t mesh, std::size_t size, std::size_t mesh_size)
+{
+    std::size_t const first = mesh * mesh_size;
+    return 0.5 * static_cast<double>(first + std::min(size, first + mesh_size)) - 0.5;
+}
+
+// position of the pixel between the centres of the meshes along an axis: index of the
+// mesh before it and weight of the mesh after it
+inline void mesh_position
+(
+    std::size_t pixel,
+    std::size_t size,
+    std::size_t mesh_size,
+    std::size_t meshes,
+    std::size_t& index,
+    double& fraction
+)
+{
+    double const position = static_cast<double>(pixel);
+    index = std::min(pixel / mesh_size, meshes - 1);
+    if (index > 0 && position < mesh_centre(index, size, mesh_size))
+    {
+        index--;
+    }
+    double const centre = mesh_centre(index, size, mesh_size);
+    if (index + 1 == meshes || !(position > centre))
+    {
+        fraction = 0;
+        return;
+    }
+    fraction = (position - centre) / (mesh_centre(index + 1, size, mesh_size) - centre);
+}
+
+} // namespace detail_background
+///@endcond
+
+//!Background and rms of an image estimated on a mesh of pixel blocks
+/*!
+Every mesh is sigma clipped around its median and gives the mode estimate of its
+sky (2.5 median - 1.5 mean, or the median for crowded meshes), meshes are estimated
+independently by a pool of threads. Meshes with too few pixels left take the median
+of all the valid meshes, then the grid is median filtered (over the meshes inside
+the grid next to its edges) and the full resolution maps are bilinear interpolations
+between the mesh centres (constant beyond the outer centres). Blank (NaN) pixels are ignored.
+*/
+class background_map
+{
+public:
+    background_map() {}
+
+    //!estimates the background of width x height pixels stored row after row
+    template <typename PixelType>
+    background_map
+    (
+        PixelType const* pixels,
+        std::size_t width,
+        std::size_t height,
+        background_options const& options = background_options()
+    ) :
+        image_width(width), image_height(height),
+        mesh_size(std::max<std::size_t>(options.mesh_size, 1))
+    {
+        this->columns = (width + this->mesh_size - 1) / this->mesh_size;
+        this->rows = (height + this->mesh_size - 1) / this->mesh_size;
+        std::size_t const meshes = this->columns * this->rows;
+        this->sky.assign(meshes, 0.0);
+        this->noise.assign(meshes, 0.0);
+        std::vector<char> valid(meshes, 0);
+
+        boost::astronomy::detail::parallel_bands(this->rows, options.threads, 1,
+            [&](std::size_t begin, std::size_t end) {
+                std::vector<double> values;
+                for (std::size_t j = begin; j < end; j++)
+                {
+                    for (std::size_t i = 0; i < this->columns; i++)
+                    {
+                        std::size_t const top = j * this->mesh_size;
+                        std::size_t const left = i * this->mesh_size;
+                        std::size_t const bottom = std::min(height, top + this->mesh_size);
+                        std::size_t const right = std::min(width, left + this->mesh_size);
+                        values.clear();
+                        for (std::size_t y = top; y < bottom; y++)
+                        {
+                            for (std::size_t x = left; x < right; x++)
+                            {
+                                PixelType const pixel = pixels[y * width + x];
+                                if (!boost::astronomy::detail::is_blank(pixel))
+                                {
+                                    values.push_back(static_cast<double>(pixel));
+                                }
+                            }
+                        }
+                        std::size_t const mesh = j * this->columns + i;
+                        valid[mesh] = detail_background::mesh_estimate(values,
+                            (bottom - top) * (right - left), options, this->sky[mesh],
+                            this->noise[mesh]) ? 1 : 0;
+                    }
+                }
+            });
+
+        this->fill_invalid(valid);
+        if (options.filter_size > 1)
+        {
+            this->filter(options.filter_size / 2);
+        }
+    }
+
+    //!estimates the background of all the pixels of an image
+    template <typename PixelType>
+    background_map
+    (
+        image_buffer<PixelType> const& image,
+        background_options const& options = background_options()
+    ) : background_map(image.pixels(), image.get_width(), image.get_height(), options) {}
+
+    //!returns the number of meshes along a row of the image
+    std::size_t mesh_columns() const
+    {
+        return this->columns;
+    }
+
+    //!returns the number of meshes along a column of the image
+    std::size_t mesh_rows() const
+    {
+        return this->rows;
+    }
+
+    //!returns the background of the mesh at given row and column of the mesh grid
+    double mesh_background(std::size_t row, std::size_t column) const
+    {
+        return this->sky[row * this->columns + column];
+    }
+
+    //!returns the rms of the mesh at given row and column of the mesh grid
+    double mesh_rms(std::size_t row, std::size_t column) const
+    {
+        return this->noise[row * this->columns + column];
+    }
+
+    //!returns the background of every pixel, row after row
+    std::vector<double> background(std::size_t threads = 0) const
+    {
+        return this->interpolate(this->sky, threads);
+    }
+
+    //!returns the rms of every pixel, row after row
+    std::vector<double> rms(std::size_t threads = 0) const
+    {
+        return this->interpolate(this->noise, threads);
+    }
+
+    //!subtracts the background from width x height pixels stored row after row
+    template <typename PixelType>
+    std::vector<double> subtract(PixelType const* pixels, std::size_t threads = 0) const
+    {
+        std::vector<double> result = this->background(threads);
+        for (std::size_t i = 0; i < result.size(); i++)
+        {
+            result[i] = static_cast<double>(pixels[i]) - result[i];
+        }
+        return result;
+    }
+
+    //!subtracts the background from the pixels of an image
+    template <typename PixelType>
+    std::vector<double> subtract
+    (
+        image_buffer<PixelType> const& image,
+        std::size_t threads = 0
+    ) const
+    {
+        return this->subtract(image.pixels(), threads);
+    }
+
+private:
+    std::size_t image_width = 0;
+    std::size_t image_height = 0;
+    std::size_t mesh_size = 1;
+    std::size_t columns = 0;
+    std::size_t rows = 0;
+    std::vector<double> sky; //! background of the meshes, row after row
+    std::vector<double> noise; //! rms of the meshes, row after row
+
+    void fill_invalid(std::vector<char> const& valid)
+    {
+        std::vector<double> sky_values, noise_values;
+        for (std::size_t mesh = 0; mesh < valid.size(); mesh++)
+        {
+            if (valid[mesh])
+            {
+                sky_values.push_back(this->sky[mesh]);
+                noise_values.push_back(this->noise[mesh]);
+            }
+        }
+        if (sky_values.size() == valid.size())
+        {
+            return;
+        }
+
+        double sky_median = 0, noise_median = 0;
+        if (!sky_values.empty())
+        {
+            std::vector<double> window;
+            sky_median = detail_background::window_median(sky_values, sky_values.size(), 1,
+                0, 0, sky_values.size(), window);
+            noise_median = detail_background::window_median(noise_values, noise_values.size(), 1,
+                0, 0, noise_values.size(), window);
+        }
+        for (std::size_t mesh = 0; mesh < valid.size(); mesh++)
+        {
+            if (!valid[mesh])
+            {
+                this->sky[mesh] = sky_median;
+                this->noise[mesh] = noise_median;
+            }
+        }
+    }
+
+    void filter(std::size_t radius)
+    {
+        std::vector<double> sky_filtered(this->sky.size()), noise_filtered(this->noise.size());
+        std::vector<double> window;
+        for (std::size_t j = 0; j < this->rows; j++)
+        {
+            for (std::size_t i = 0; i < this->columns; i++)
+            {
+                sky_filtered[j * this->columns + i] = detail_background::window_median(this->sky,
+                    this->columns, this->rows, i, j, radius, window);
+                noise_filtered[j * this->columns + i] = detail_background::window_median(
+                    this->noise, this->columns, this->rows, i, j, radius, window);
+            }
+        }
+        this->sky.swap(sky_filtered);
+        this->noise.swap(noise_filtered);
+    }
+
+    // bilinear interpolation of the mesh values at the centres of the meshes, the
+    // positions along the rows are computed once and every row is a vectorizable loop
+    std::vector<double> interpolate(std::vector<double> const& grid, std::size_t threads) const
+    {
+        namespace dbg = detail_background;
+        std::vector<double> result(this->image_width * this->image_height);
+        if (result.empty())
+        {
+            return result;
+        }
+
+        std::vector<std::size_t> first(this->image_width), second(this->image_width);
+        std::vector<double> weight(this->image_width);
+        for (std::size_t x = 0; x < this->image_width; x++)
+        {
+            dbg::mesh_position(x, this->image_width, this->mesh_size, this->columns, first[x],
+                weight[x]);
+            second[x] = std::min(first[x] + 1, this->columns - 1);
+        }
+
+        boost::astronomy::detail::parallel_bands(this->image_height, threads, 64,
+            [&](std::size_t begin, std::size_t end) {
+                std::vector<double> upper(this->columns), lower(this->columns);
+                for (std::size_t y = begin; y < end; y++)
+                {
+                    std::size_t j;
+                    double fraction;
+                    dbg::mesh_position(y, this->image_height, this->mesh_size, this->rows, j,
+                        fraction);
+                    std::size_t const next = std::min(j + 1, this->rows - 1);
+                    for (std::size_t i = 0; i < this->columns; i++)
+                    {
+                        upper[i] = grid[j * this->columns + i];
+                        lower[i] = grid[next * this->columns + i];
+                    }
+
+                    double* out = result.data() + y * this->image_width;
+                    for (std::size_t x = 0; x < this->image_width; x++)
+                    {
+                        double const a = upper[first[x]] + weight[x] *
+                            (upper[second[x]] - upper[first[x]]);
+                        double const b = lower[first[x]] + weight[x] *
+                            (lower[second[x]] - lower[first[x]]);
+                        out[x] = a + fraction * (b - a);
+                    }
+                }
+            });
+        return result;
+    }
+};
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_IMAGE_BACKGROUND_HPP
@@ -0,0 +1,479 @@
+#ifndef BOOST_ASTRONOMY_IO_IMAGE_COADD_HPP
+#define BOOST_ASTRONOMY_IO_IMAGE_COADD_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include <limits>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+
+#include <boost/astronomy/io/bitpix.hpp>
+#include <boost/astronomy/io/image.hpp>
+#include <boost/astronomy/io/image_tile_reader.hpp>
+#include <boost/astronomy/coordinate/wcs.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+//!interpolation kernels used to resample input frames on the output grid
+enum class resample_kernel
+{
+    nearest, //! value of the pixel containing the point
+    bilinear, //! linear interpolation of the 2 x 2 nearest pixels
+    lanczos //! windowed sinc of 2a x 2a pixels, a given by resample_options::lanczos_order
+};
+
+//!options of image_coadd
+struct resample_options
+{
+    resample_kernel kernel = resample_kernel::bilinear;
+    std::size_t lanczos_order = 3; //! a of the Lanczos kernel, from 1 to 5
+    std::size_t tile_size = 256; //! output tiles are tile_size x tile_size pixels
+    std::size_t threads = 0; //! threads accumulating the tiles, 0 uses all the hardware threads
+};
+
+///@cond INTERNAL
+namespace detail_coadd {
+
+std::size_t const max_taps = 10;
+
+// normalized weights of the kernel taps around coordinate t of an axis of size pixels
+// taps outside of the axis are dropped and the others normalized to a sum of 1
+struct kernel_taps
+{
+    std::size_t first = 0;
+    std::size_t count = 0;
+    double weights[max_taps];
+
+    bool compute(resample_options const& options, double t, std::size_t size)
+    {
+        this->count = 0;
+        if (!(t >= -0.5 && t <= static_cast<double>(size) - 0.5))
+        {
+            return false;
+        }
+
+        if (options.kernel == resample_kernel::nearest)
+        {
+            double const nearest = std::min(std::floor(t + 0.5), static_cast<double>(size - 1));
+            this->first = static_cast<std::size_t>(nearest);
+            this->count = 1;
+            this->weights[0] = 1;
+            return true;
+        }
+
+        double const base = std::floor(t);
+        std::ptrdiff_t const order = options.kernel == resample_kernel::bilinear ? 1 :
+            static_cast<std::ptrdiff_t>(std::min<std::size_t>(
+                std::max<std::size_t>(options.lanczos_order, 1), max_taps / 2));
+        std::ptrdiff_t const lowest = static_cast<std::ptrdiff_t>(base) - order + 1;
+        std::ptrdiff_t const begin = std::max<std::ptrdiff_t>(lowest, 0);
+        std::ptrdiff_t const end = std::min<std::ptrdiff_t>(lowest + 2 * order,
+            static_cast<std::ptrdiff_t>(size));
+
+        double total = 0;
+        if (options.kernel == resample_kernel::bilinear)
+        {
+            for (std::ptrdiff_t i = begin; i < end; i++)
+            {
+                double const weight = 1 - std::abs(t - static_cast<double>(i));
+                this->weights[this->count++] = weight;
+                total += weight;
+            }
+        }
+        else
+        {
+            total = this->lanczos(t - static_cast<double>(begin), order, end - begin);
+        }
+        if (!(std::abs(total) > 1e-12))
+        {
+            this->count = 0;
+            return false;
+        }
+        for (std::size_t i = 0; i < this->count; i++)
+        {
+            this->weights[i] /= total;
+        }
+        this->first = static_cast<std::size_t>(begin);
+        return true;
+    }
+
+private:
+    std::ptrdiff_t step_order = 0;
+    double step_sine = 0;
+    double step_cosine = 1;
+
+    // stores the weights a sinc(x) sinc(x / a) of taps at x, x - 1... and returns their sum
+    // sin(pi x) only changes sign from a tap to the next and sin(pi x / a) is rotated by
+    // the angle pi / a, so the taps need three trigonometric functions instead of two each
+    double lanczos(double x, std::ptrdiff_t order, std::ptrdiff_t taps)
+    {
+        double const pi = 3.141592653589793238462643383279502884;
+        double const a = static_cast<double>(order);
+        if (this->step_order != order)
+        {
+            this->step_order = order;
+            this->step_sine = std::sin(pi / a);
+            this->step_cosine = std::cos(pi / a);
+        }
+
+        double sine = std::sin(pi * x);
+        double window_sine = std::sin(pi * x / a);
+        double window_cosine = std::cos(pi * x / a);
+        double total = 0;
+        for (std::ptrdiff_t i = 0; i < taps; i++, x -= 1)
+        {
+            double weight = 1;
+            if (!(std::abs(x) < 1e-12))
+            {
+                weight = std::abs(x) < a ? a * sine * window_sine / (pi * pi * x * x) : 0;
+            }
+            this->weights[this->count++] = weight;
+            total += weight;
+
+            sine = -sine;
+            double const next_sine = window_sine * this->step_cosine -
+                window_cosine * this->step_sine;
+            window_cosine = window_cosine * this->step_cosine + window_sine * this->step_sine;
+            window_sine = next_sine;
+        }
+        return total;
+    }
+};
+
+} // namespace detail_coadd
+///@endcond
+
+//!Resamples frames with their own WCS onto a common grid and accumulates weighted sums
+/*!
+The output grid is split into tiles accumulated independently by a pool of threads,
+every output pixel is mapped through the output WCS to the sky and through the WCS of
+the frame back to a pixel of the frame which is interpolated with the kernel. The
+frame weight (inverse variance...) multiplies the interpolated value into sums() and
+is added to weights() for every output pixel falling on the frame, mean() is their ratio.
+
+Frames are taken row after row: the kernel weights are separable and normalized over
+the whole frame, so the rows read so far add their part of every output pixel and a
+frame streamed through image_tile_reader only keeps one tile of rows in memory. Values
+are the raw pixels of the data unit (BZERO and BSCALE are not applied) and NaN pixels
+make the output pixels they reach NaN.
+*/
+class image_coadd
+{
+public:
+    //!creates empty co-add of width x height pixels described by output_wcs
+    image_coadd
+    (
+        coordinate::wcs_transform const& output_wcs,
+        std::size_t width,
+        std::size_t height,
+        resample_options const& options = resample_options()
+    ) :
+        grid(output_wcs), grid_width(width), grid_height(height), settings(options),
+        sum(width * height, 0.0), weight(width * height, 0.0)
+    {
+        this->settings.tile_size = std::max<std::size_t>(this->settings.tile_size, 1);
+    }
+
+    //!resamples the row major pixels of a frame of width x height pixels
+    template <typename PixelType>
+    void add
+    (
+        PixelType const* pixels,
+        std::size_t width,
+        std::size_t height,
+        coordinate::wcs_transform const& frame_wcs,
+        double frame_weight = 1
+    )
+    {
+        frame_footprint const footprint = this->map_frame(frame_wcs, width, height);
+        this->add_rows(footprint, frame_wcs, pixels, 0, height, frame_weight);
+        this->frame_count++;
+    }
+
+    //!resamples all the pixels of an image
+    template <typename PixelType>
+    void add
+    (
+        image_buffer<PixelType> const& frame,
+        coordinate::wcs_transform const& frame_wcs,
+        double frame_weight = 1
+    )
+    {
+        this->add(frame.pixels(), frame.get_width(), frame.get_height(), frame_wcs, frame_weight);
+    }
+
+    //!resamples the first plane of an image HDU read tile after tile by reader
+    template <bitpix DataType>
+    void add
+    (
+        image_tile_reader<DataType>& reader,
+        coordinate::wcs_transform const& frame_wcs,
+        double frame_weight = 1
+    )
+    {
+        std::size_t const width = reader.row_width();
+        std::size_t const height = reader.plane_rows();
+        frame_footprint const footprint = this->map_frame(frame_wcs, width, height);
+        image_tile<DataType> tile;
+        while (reader.next(tile) && tile.first_row < height)
+        {
+            this->add_rows(footprint, frame_wcs, tile.pixels.data(), tile.first_row,
+                std::min(tile.rows, height - tile.first_row), frame_weight);
+        }
+        this->frame_count++;
+    }
+
+    //!resamples the first plane of an image HDU with the WCS of its header
+    template <bitpix DataType>
+    void add(image_tile_reader<DataType>& reader, double frame_weight = 1)
+    {
+        this->add(reader, coordinate::make_wcs(reader.get_header()), frame_weight);
+    }
+
+    //!returns the weighted means of the frames, NaN where no frame contributes
+    std::vector<double> mean() const
+    {
+        std::vector<double> result(this->sum.size(), std::numeric_limits<double>::quiet_NaN());
+        for (std::size_t i = 0; i < result.size(); i++)
+        {
+            if (this->weight[i] > 0)
+            {
+                result[i] = this->sum[i] / this->weight[i];
+            }
+        }
+        return result;
+    }
+
+    //!returns the sums of weight times interpolated value, row after row
+    std::vector<double> const& sums() const
+    {
+        return this->sum;
+    }
+
+    //!returns the sums of the weights of the frames covering every pixel
+    std::vector<double> const& weights() const
+    {
+        return this->weight;
+    }
+
+    std::size_t get_width() const
+    {
+        return this->grid_width;
+    }
+
+    std::size_t get_height() const
+    {
+        return this->grid_height;
+    }
+
+    //!returns the number of frames added
+    std::size_t frames() const
+    {
+        return this->frame_count;
+    }
+
+private:
+    // rows of the frame reached by the kernel from every output tile, empty when
+    // first_row > last_row
+    struct frame_footprint
+    {
+        std::size_t frame_width = 0;
+        std::size_t frame_height = 0;
+        std::vector<std::size_t> first_row;
+        std::vector<std::size_t> last_row;
+    };
+
+    // positions of the pixels of one output tile in the frame
+    struct tile_map
+    {
+        std::vector<double> column;
+        std::vector<double> row;
+        std::vector<double> lon;
+        std::vector<double> lat;
+        std::vector<double> frame_column;
+        std::vector<double> frame_row;
+    };
+
+    coordinate::wcs_transform grid;
+    std::size_t grid_width;
+    std::size_t grid_height;
+    resample_options settings;
+    std::vector<double> sum;
+    std::vector<double> weight;
+    std::size_t frame_count = 0;
+
+    std::size_t tile_columns() const
+    {
+        return (this->grid_width + this->settings.tile_size - 1) / this->settings.tile_size;
+    }
+
+    std::size_t tile_count() const
+    {
+        return this->tile_columns() *
+            ((this->grid_height + this->settings.tile_size - 1) / this->settings.tile_size);
+    }
+
+    // maps the pixels of tile into the frame, returns the number of pixels of the tile
+    std::size_t map_tile
+    (
+        std::size_t tile,
+        coordinate::wcs_transform const& frame_wcs,
+        tile_map& map
+    ) const
+    {
+        std::size_t const size = this->settings.tile_size;
+        std::size_t const first_column = tile % this->tile_columns() * size;
+        std::size_t const first_row = tile / this->tile_columns() * size;
+        std::size_t const columns = std::min(size, this->grid_width - first_column);
+        std::size_t const rows = std::min(size, this->grid_height - first_row);
+        std::size_t const count = columns * rows;
+        if (map.column.size() < count)
+        {
+            for (auto* values : {&map.column, &map.row, &map.lon, &map.lat, &map.frame_column,
+                &map.frame_row})
+            {
+                values->resize(count);
+            }
+        }
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            map.column[i] = static_cast<double>(first_column + i % columns);
+            map.row[i] = static_cast<double>(first_row + i / columns);
+        }
+        this->grid.pixel_to_sky(count, map.column.data(), map.row.data(), map.lon.data(),
+            map.lat.data());
+        frame_wcs.sky_to_pixel(count, map.lon.data(), map.lat.data(), map.frame_column.data(),
+            map.frame_row.data());
+        return count;
+    }
+
+    // calls f(tile, map) for every tile on the threads of the pool
+    template <typename Function>
+    void for_each_tile(Function&& f) const
+    {
+        std::size_t const tiles = this->tile_count();
+        std::size_t threads = this->settings.threads;
+        if (threads == 0)
+        {
+            threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+        }
+        threads = std::max<std::size_t>(std::min(threads, tiles), 1);
+
+        std::atomic<std::size_t> next(0);
+        auto worker = [&]() {
+            tile_map map;
+            for (std::size_t tile = next++; tile < tiles; tile = next++)
+            {
+                f(tile, map);
+            }
+        };
+        std::vector<std::thread> workers;
+        for (std::size_t id = 1; id < threads; id++)
+        {
+            workers.emplace_back(worker);
+        }
+        worker();
+        for (auto& thread : workers)
+        {
+            thread.join();
+        }
+    }
+
+    // finds the rows of the frame needed by every tile
+    frame_footprint map_frame
+    (
+        coordinate::wcs_transform const& frame_wcs,
+        std::size_t width,
+        std::size_t height
+    ) const
+    {
+        frame_footprint footprint;
+        footprint.frame_width = width;
+        footprint.frame_height = height;
+        footprint.first_row.assign(this->tile_count(), std::numeric_limits<std::size_t>::max());
+        footprint.last_row.assign(this->tile_count(), 0);
+        this->for_each_tile([&](std::size_t tile, tile_map& map) {
+            std::size_t const count = this->map_tile(tile, frame_wcs, map);
+            detail_coadd::kernel_taps columns, rows;
+            for (std::size_t i = 0; i < count; i++)
+            {
+                if (columns.compute(this->settings, map.frame_column[i], width) &&
+                    rows.compute(this->settings, map.frame_row[i], height))
+                {
+                    footprint.first_row[tile] = std::min(footprint.first_row[tile], rows.first);
+                    footprint.last_row[tile] = std::max(footprint.last_row[tile],
+                        rows.first + rows.count - 1);
+                }
+            }
+        });
+        return footprint;
+    }
+
+    // adds the part of rows [first_row, first_row + rows) of the frame to every tile
+    // the weight of a pixel is added with the row containing its centre
+    template <typename PixelType>
+    void add_rows
+    (
+        frame_footprint const& footprint,
+        coordinate::wcs_transform const& frame_wcs,
+        PixelType const* pixels,
+        std::size_t first_row,
+        std::size_t rows,
+        double frame_weight
+    )
+    {
+        std::size_t const width = footprint.frame_width;
+        std::size_t const height = footprint.frame_height;
+        std::size_t const end_row = first_row + rows;
+        this->for_each_tile([&](std::size_t tile, tile_map& map) {
+            if (footprint.first_row[tile] > footprint.last_row[tile] ||
+                footprint.last_row[tile] < first_row || footprint.first_row[tile] >= end_row)
+            {
+                return;
+            }
+
+            std::size_t const count = this->map_tile(tile, frame_wcs, map);
+            resample_options centre = this->settings;
+            centre.kernel = resample_kernel::nearest;
+            detail_coadd::kernel_taps column_taps, row_taps, centre_taps;
+            for (std::size_t i = 0; i < count; i++)
+            {
+                if (!column_taps.compute(this->settings, map.frame_column[i], width) ||
+                    !row_taps.compute(this->settings, map.frame_row[i], height))
+                {
+                    continue;
+                }
+                std::size_t const begin = std::max(row_taps.first, first_row);
+                std::size_t const end = std::min(row_taps.first + row_taps.count, end_row);
+
+                double value = 0;
+                for (std::size_t row = begin; row < end; row++)
+                {
+                    PixelType const* line = pixels + (row - first_row) * width + column_taps.first;
+                    double row_value = 0;
+                    for (std::size_t c = 0; c < column_taps.count; c++)
+                    {
+                        row_value += column_taps.weights[c] * static_cast<double>(line[c]);
+                    }
+                    value += row_taps.weights[row - row_taps.first] * row_value;
+                }
+
+                std::size_t const output = static_cast<std::size_t>(map.row[i]) * this->grid_width +
+                    static_cast<std::size_t>(map.column[i]);
+                this->sum[output] += frame_weight * value;
+                centre_taps.compute(centre, map.frame_row[i], height);
+                if (centre_taps.first >= first_row && centre_taps.first < end_row)
+                {
+                    this->weight[output] += frame_weight;
+                }
+            }
+        });
+    }
+};
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_IMAGE_COADD_HPP
@@ -0,0 +1,542 @@
+#ifndef BOOST_ASTRONOMY_IO_IMAGE_CONVOLUTION_HPP
+#define BOOST_ASTRONOMY_IO_IMAGE_CONVOLUTION_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include <complex>
+#include <algorithm>
+
+#include <boost/astronomy/io/image.hpp>
+#include <boost/astronomy/io/image_statistics.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+//!values of the pixels beyond the edges of the image seen by a convolution kernel
+enum class convolution_edge
+{
+    zero, //! pixels outside of the image are 0
+    extend //! pixels outside of the image repeat the nearest edge pixel
+};
+
+//!algorithm used by convolve for a 2D kernel
+enum class convolution_method
+{
+    automatic, //! direct for kernels up to fft_threshold taps, fft for larger ones
+    direct, //! sums over the kernel for every pixel, cost proportional to the kernel size
+    fft //! products of the Fourier transforms of the zero padded image and kernel
+};
+
+//!options of convolve and convolve_separable
+struct convolution_options
+{
+    convolution_edge edge = convolution_edge::extend;
+    convolution_method method = convolution_method::automatic;
+    std::size_t fft_threshold = 256; //! taps of the largest kernel convolved directly
+    std::size_t threads = 0; //! threads sharing the rows, 0 uses all the hardware threads
+};
+
+//!2D kernel of width x height taps stored row after row
+//!the centre of a kernel of n taps along an axis is tap n / 2
+struct convolution_kernel
+{
+    std::size_t width = 0;
+    std::size_t height = 0;
+    std::vector<double> values;
+
+    convolution_kernel() {}
+
+    convolution_kernel(std::size_t kernel_width, std::size_t kernel_height) :
+        width(kernel_width), height(kernel_height), values(kernel_width * kernel_height, 0.0) {}
+
+    //!creates the kernel whose tap (i, j) is column[i] * row[j]
+    convolution_kernel(std::vector<double> const& row, std::vector<double> const& column) :
+        width(row.size()), height(column.size()), values(row.size() * column.size())
+    {
+        for (std::size_t i = 0; i < this->height; i++)
+        {
+            for (std::size_t j = 0; j < this->width; j++)
+            {
+                this->values[i * this->width + j] = column[i] * row[j];
+            }
+        }
+    }
+
+    //!returns tap at row i and column j
+    double& operator() (std::size_t i, std::size_t j)
+    {
+        return this->values[i * this->width + j];
+    }
+
+    double operator() (std::size_t i, std::size_t j) const
+    {
+        return this->values[i * this->width + j];
+    }
+};
+
+//!Returns the normalized 1D gaussian of given sigma in pixels over 2 radius + 1 taps
+//!radius equal to 0 uses 3 sigma rounded up
+inline std::vector<double> gaussian_kernel(double sigma, std::size_t radius = 0)
+{
+    if (radius == 0)
+    {
+        radius = static_cast<std::size_t>(std::ceil(3 * sigma));
+    }
+    std::vector<double> taps(2 * radius + 1);
+    double total = 0;
+    for (std::size_t i = 0; i < taps.size(); i++)
+    {
+        double const x = static_cast<double>(i) - static_cast<double>(radius);
+        taps[i] = std::exp(-0.5 * x * x / (sigma * sigma));
+        total += taps[i];
+    }
+    for (double& tap : taps)
+    {
+        tap /= total;
+    }
+    return taps;
+}
+
+///@cond INTERNAL
+namespace detail_convolution {
+
+// columns processed together by the vertical sums so that the rows under the kernel
+// stay in cache
+std::size_t const column_block = 2048;
+
+// margins of the padded image for a kernel of size taps with centre size / 2:
+// convolution reads size - 1 - size / 2 pixels before a pixel and size / 2 after it
+inline std::size_t before(std::size_t size)
+{
+    return size - 1 - size / 2;
+}
+
+// copies row of the image as doubles between margins set as given by edge
+// blank pixels are read as 0
+template <typename PixelType>
+inline void load_row
+(
+    PixelType const* row,
+    std::size_t width,
+    std::size_t left,
+    std::size_t right,
+    convolution_edge edge,
+    double* padded
+)
+{
+    for (std::size_t c = 0; c < width; c++)
+    {
+        padded[left + c] = boost::astronomy::detail::is_blank(row[c]) ? 0.0 :
+            static_cast<double>(row[c]);
+    }
+    double const first = edge == convolution_edge::extend ? padded[left] : 0.0;
+    double const last = edge == convolution_edge::extend ? padded[left + width - 1] : 0.0;
+    std::fill(padded, padded + left, first);
+    std::fill(padded + left + width, padded + left + width + right, last);
+}
+
+// image row read for row, the nearest one beyond the edges when they are extended and
+// -1 when the row is outside of the image and the edges are 0
+inline std::ptrdiff_t source_row
+(
+    std::ptrdiff_t row,
+    std::size_t height,
+    convolution_edge edge
+)
+{
+    std::ptrdiff_t const last = static_cast<std::ptrdiff_t>(height) - 1;
+    if (row >= 0 && row <= last)
+    {
+        return row;
+    }
+    if (edge == convolution_edge::zero)
+    {
+        return -1;
+    }
+    return row < 0 ? 0 : last;
+}
+
+// out[c] += weight * in[c] for count values, the loop of all the direct convolutions
+inline void add_scaled(double* out, double const* in, double weight, std::size_t count)
+{
+    for (std::size_t c = 0; c < count; c++)
+    {
+        out[c] += weight * in[c];
+    }
+}
+
+// convolution of the rows [begin, end) of the output by a kernel of kernel_height rows
+// applied to the padded rows of source (stride values apart), every kernel row is a
+// set of taps (flipped) applied horizontally to one source row
+template <typename RowTaps>
+inline void vertical_sums
+(
+    double const* source,
+    std::size_t stride,
+    std::size_t width,
+    std::size_t height,
+    std::size_t kernel_height,
+    convolution_edge edge,
+    std::size_t begin,
+    std::size_t end,
+    RowTaps&& row_taps,
+    double* output
+)
+{
+    std::ptrdiff_t const above = static_cast<std::ptrdiff_t>(before(kernel_height));
+    for (std::size_t r = begin; r < end; r++)
+    {
+        double* out = output + r * width;
+        std::fill(out, out + width, 0.0);
+        for (std::size_t first = 0; first < width; first += column_block)
+        {
+            std::size_t const count = std::min(column_block, width - first);
+            for (std::size_t i = 0; i < kernel_height; i++)
+            {
+                // tap kernel_height - 1 - i of the kernel reads row r + i - above
+                std::ptrdiff_t const row = source_row(static_cast<std::ptrdiff_t>(r + i) - above,
+                    height, edge);
+                if (row >= 0)
+                {
+                    row_taps(kernel_height - 1 - i, source + static_cast<std::size_t>(row) * stride
+                        + first, out + first, count);
+                }
+            }
+        }
+    }
+}
+
+// radix 2 fast Fourier transform of a fixed size
+struct fft_plan
+{
+    std::size_t size = 0;
+    std::vector<std::size_t> reversed;
+    std::vector<std::complex<double>> twiddles;
+
+    explicit fft_plan(std::size_t n) : size(n), reversed(n), twiddles(n / 2)
+    {
+        double const pi = 3.141592653589793238462643383279502884;
+        std::size_t bits = 0;
+        while ((std::size_t(1) << bits) < n)
+        {
+            bits++;
+        }
+        for (std::size_t i = 0; i < n; i++)
+        {
+            std::size_t r = 0;
+            for (std::size_t b = 0; b < bits; b++)
+            {
+                r |= ((i >> b) & 1) << (bits - 1 - b);
+            }
+            this->reversed[i] = r;
+        }
+        for (std::size_t k = 0; k < n / 2; k++)
+        {
+            double const angle = -2 * pi * static_cast<double>(k) / static_cast<double>(n);
+            this->twiddles[k] = std::complex<double>(std::cos(angle), std::sin(angle));
+        }
+    }
+
+    // in place transform, the inverse is not divided by the size
+    void transform(std::complex<double>* data, bool inverse) const
+    {
+        for (std::size_t i = 0; i < this->size; i++)
+        {
+            if (i < this->reversed[i])
+            {
+                std::swap(data[i], data[this->reversed[i]]);
+            }
+        }
+        for (std::size_t half = 1; half < this->size; half *= 2)
+        {
+            std::size_t const step = this->size / (2 * half);
+            for (std::size_t first = 0; first < this->size; first += 2 * half)
+            {
+                for (std::size_t k = 0; k < half; k++)
+                {
+                    std::complex<double> twiddle = this->twiddles[k * step];
+                    if (inverse)
+                    {
+                        twiddle = std::conj(twiddle);
+                    }
+                    std::complex<double> const odd = twiddle * data[first + k + half];
+                    data[first + k + half] = data[first + k] - odd;
+                    data[first + k] += odd;
+                }
+            }
+        }
+    }
+};
+
+inline std::size_t power_of_two(std::size_t n)
+{
+    std::size_t p = 1;
+    while (p < n)
+    {
+        p *= 2;
+    }
+    return p;
+}
+
+// 2D transform of rows x columns values, rows then columns split across threads
+inline void transform_2d
+(
+    std::vector<std::complex<double>>& data,
+    std::size_t rows,
+    std::size_t columns,
+    bool inverse,
+    std::size_t threads
+)
+{
+    fft_plan const row_plan(columns);
+    fft_plan const column_plan(rows);
+    boost::astronomy::detail::parallel_bands(rows, threads, 16,
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t r = begin; r < end; r++)
+            {
+                row_plan.transform(data.data() + r * columns, inverse);
+            }
+        });
+    boost::astronomy::detail::parallel_bands(columns, threads, 16,
+        [&](std::size_t begin, std::size_t end) {
+            std::vector<std::complex<double>> column(rows);
+            for (std::size_t c = begin; c < end; c++)
+            {
+                for (std::size_t r = 0; r < rows; r++)
+                {
+                    column[r] = data[r * columns + c];
+                }
+                column_plan.transform(column.data(), inverse);
+                for (std::size_t r = 0; r < rows; r++)
+                {
+                    data[r * columns + c] = column[r];
+                }
+            }
+        });
+}
+
+// convolution by the product of transforms, the image (real part) and the kernel
+// (imaginary part) share one forward transform
+template <typename PixelType>
+inline std::vector<double> fft_convolve
+(
+    PixelType const* pixels,
+    std::size_t width,
+    std::size_t height,
+    convolution_kernel const& kernel,
+    convolution_options const& options
+)
+{
+    std::size_t const columns = power_of_two(width + kernel.width - 1);
+    std::size_t const rows = power_of_two(height + kernel.height - 1);
+    std::size_t const left = before(kernel.width);
+    std::size_t const right = kernel.width / 2;
+    std::size_t const above = before(kernel.height);
+    std::size_t const below = kernel.height / 2;
+
+    //padded image wrapped around the transform so that no margin overlaps the pixels
+    std::vector<std::complex<double>> data(rows * columns);
+    std::vector<double> padded(width + left + right);
+    for (std::size_t r = 0; r < height + above + below; r++)
+    {
+        std::ptrdiff_t const source = source_row(static_cast<std::ptrdiff_t>(r) -
+            static_cast<std::ptrdiff_t>(above), height, options.edge);
+        if (source < 0)
+        {
+            continue;
+        }
+        load_row(pixels + static_cast<std::size_t>(source) * width, width, left, right,
+            options.edge, padded.data());
+        std::size_t const row = (r + rows - above) % rows;
+        for (std::size_t c = 0; c < padded.size(); c++)
+        {
+            data[row * columns + (c + columns - left) % columns].real(padded[c]);
+        }
+    }
+    for (std::size_t i = 0; i < kernel.height; i++)
+    {
+        std::size_t const row = (i + rows - kernel.height / 2) % rows;
+        for (std::size_t j = 0; j < kernel.width; j++)
+        {
+            data[row * columns + (j + columns - kernel.width / 2) % columns].imag(kernel(i, j));
+        }
+    }
+
+    transform_2d(data, rows, columns, false, options.threads);
+
+    //the spectra of the real inputs are the even and odd parts of the joint transform
+    std::vector<std::complex<double>> product(rows * columns);
+    std::complex<double> const half_i(0, 0.5);
+    for (std::size_t u = 0; u < rows; u++)
+    {
+        std::size_t const mirror_u = (rows - u) % rows;
+        for (std::size_t v = 0; v < columns; v++)
+        {
+            std::complex<double> const z = data[u * columns + v];
+            std::complex<double> const mirror = std::conj(data[mirror_u * columns +
+                (columns - v) % columns]);
+            product[u * columns + v] = (z + mirror) * 0.5 * (-half_i) * (z - mirror);
+        }
+    }
+
+    transform_2d(product, rows, columns, true, options.threads);
+
+    std::vector<double> result(width * height);
+    double const scale = 1.0 / static_cast<double>(rows * columns);
+    for (std::size_t r = 0; r < height; r++)
+    {
+        for (std::size_t c = 0; c < width; c++)
+        {
+            result[r * width + c] = product[r * columns + c].real() * scale;
+        }
+    }
+    return result;
+}
+
+} // namespace detail_convolution
+///@endcond
+
+//!Convolves the row major pixels by a separable kernel, row taps then column taps
+/*!
+Both passes add scaled copies of contiguous rows so that the loops vectorize, the
+vertical pass goes over blocks of columns small enough to keep the rows under the
+kernel in cache, and the rows of the result are shared by the threads. Blank (NaN)
+pixels are read as 0.
+*/
+template <typename PixelType>
+std::vector<double> convolve_separable
+(
+    PixelType const* pixels,
+    std::size_t width,
+    std::size_t height,
+    std::vector<double> const& row_kernel,
+    std::vector<double> const& column_kernel,
+    convolution_options const& options = convolution_options()
+)
+{
+    namespace dcv = detail_convolution;
+    std::vector<double> result(width * height);
+    if (result.empty() || row_kernel.empty() || column_kernel.empty())
+    {
+        return result;
+    }
+
+    std::size_t const left = dcv::before(row_kernel.size());
+    std::size_t const right = row_kernel.size() / 2;
+    std::vector<double> rows(width * height);
+    boost::astronomy::detail::parallel_bands(height, options.threads, 16,
+        [&](std::size_t begin, std::size_t end) {
+            std::vector<double> padded(width + left + right);
+            for (std::size_t r = begin; r < end; r++)
+            {
+                dcv::load_row(pixels + r * width, width, left, right, options.edge,
+                    padded.data());
+                double* out = rows.data() + r * width;
+                std::fill(out, out + width, 0.0);
+                for (std::size_t j = 0; j < row_kernel.size(); j++)
+                {
+                    dcv::add_scaled(out, padded.data() + j, row_kernel[row_kernel.size() - 1 - j],
+                        width);
+                }
+            }
+        });
+
+    boost::astronomy::detail::parallel_bands(height, options.threads, 16,
+        [&](std::size_t begin, std::size_t end) {
+            dcv::vertical_sums(rows.data(), width, width, height, column_kernel.size(),
+                options.edge, begin, end,
+                [&](std::size_t tap, double const* source, double* out, std::size_t count) {
+                    dcv::add_scaled(out, source, column_kernel[tap], count);
+                }, result.data());
+        });
+    return result;
+}
+
+//!Convolves all the pixels of an image by a separable kernel
+template <typename PixelType>
+std::vector<double> convolve_separable
+(
+    image_buffer<PixelType> const& image,
+    std::vector<double> const& row_kernel,
+    std::vector<double> const& column_kernel,
+    convolution_options const& options = convolution_options()
+)
+{
+    return convolve_separable(image.pixels(), image.get_width(), image.get_height(), row_kernel,
+        column_kernel, options);
+}
+
+//!Convolves the row major pixels by a 2D kernel
+/*!
+Kernels up to options.fft_threshold taps are applied directly from padded copies of
+the rows with the same vectorized loops as convolve_separable. Larger kernels are
+multiplied in the Fourier domain over the image padded to powers of two, with edges
+set as for the direct method. Blank (NaN) pixels are read as 0.
+*/
+template <typename PixelType>
+std::vector<double> convolve
+(
+    PixelType const* pixels,
+    std::size_t width,
+    std::size_t height,
+    convolution_kernel const& kernel,
+    convolution_options const& options = convolution_options()
+)
+{
+    namespace dcv = detail_convolution;
+    if (width * height == 0 || kernel.values.empty())
+    {
+        return std::vector<double>(width * height);
+    }
+    bool const use_fft = options.method == convolution_method::fft ||
+        (options.method == convolution_method::automatic &&
+            kernel.values.size() > options.fft_threshold);
+    if (use_fft)
+    {
+        return dcv::fft_convolve(pixels, width, height, kernel, options);
+    }
+
+    std::size_t const left = dcv::before(kernel.width);
+    std::size_t const right = kernel.width / 2;
+    std::size_t const stride = width + left + right;
+    std::vector<double> padded(stride * height);
+    boost::astronomy::detail::parallel_bands(height, options.threads, 16,
+        [&](std::size_t begin, std::size_t end) {
+            for (std::size_t r = begin; r < end; r++)
+            {
+                dcv::load_row(pixels + r * width, width, left, right, options.edge,
+                    padded.data() + r * stride);
+            }
+        });
+
+    std::vector<double> result(width * height);
+    boost::astronomy::detail::parallel_bands(height, options.threads, 16,
+        [&](std::size_t begin, std::size_t end) {
+            dcv::vertical_sums(padded.data(), stride, width, height, kernel.height, options.edge,
+                begin, end,
+                [&](std::size_t tap, double const* source, double* out, std::size_t count) {
+                    for (std::size_t j = 0; j < kernel.width; j++)
+                    {
+                        dcv::add_scaled(out, source + j, kernel(tap, kernel.width - 1 - j),
+                            count);
+                    }
+                }, result.data());
+        });
+    return result;
+}
+
+//!Convolves all the pixels of an image by a 2D kernel
+template <typename PixelType>
+std::vector<double> convolve
+(
+    image_buffer<PixelType> const& image,
+    convolution_kernel const& kernel,
+    convolution_options const& options = convolution_options()
+)
+{
+    return convolve(image.pixels(), image.get_width(), image.get_height(), kernel, options);
+}
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_IMAGE_CONVOLUTION_HPP
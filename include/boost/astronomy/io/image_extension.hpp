@@ -2,13 +2,17 @@
 #define BOOST_ASTRONOMY_IO_IMAGE_EXTENSION_HDU_HPP
 
 #include <string>
+#include <utility>
 #include <vector>
 #include <cstddef>
 #include <valarray>
+#include <numeric>
+#include <functional>
 
 #include <boost/astronomy/io/hdu.hpp>
 #include <boost/astronomy/io/extension_hdu.hpp>
 #include <boost/astronomy/io/image.hpp>
+#include <boost/astronomy/io/scaled_image.hpp>
 
 namespace boost { namespace astronomy { namespace io {
 
@@ -33,14 +37,14 @@ public:
             data.read_image(file, this->naxis(1), this->naxis(2));
             break;
         default:
-            data.read_image(file, this->naxis(1), std::accumulate(this->naxis_.begin()+ 1,
-                this->naxis_.end(), 0, std::multiplies<std::size_t>()));
+            data.read_image(file, this->naxis(1), std::accumulate(this->naxis_.begin() + 2,
+                this->naxis_.end(), static_cast<std::size_t>(1), std::multiplies<std::size_t>()));
             break;
         }
         set_unit_end(file);
     }
 
-    image_extension(std::fstream &file, hdu const& other) : extension_hdu(file, other)
+    image_extension(std::fstream &file, hdu other) : extension_hdu(file, std::move(other))
     {
         //read image according to dimension specified by naxis
         switch (this->naxis())
@@ -54,8 +58,8 @@ public:
             data.read_image(file, this->naxis(1), this->naxis(2));
             break;
         default:
-            data.read_image(file, this->naxis(1), std::accumulate(this->naxis_.begin()+ 1,
-                this->naxis_.end(), 0, std::multiplies<std::size_t>()));
+            data.read_image(file, this->naxis(1), std::accumulate(this->naxis_.begin() + 2,
+                this->naxis_.end(), static_cast<std::size_t>(1), std::multiplies<std::size_t>()));
             break;
         }
         set_unit_end(file);
@@ -75,12 +79,28 @@ public:
             data.read_image(file, this->naxis(1), this->naxis(2));
             break;
         default:
-            data.read_image(file, this->naxis(1), std::accumulate(this->naxis_.begin()+ 1,
-                this->naxis_.end(), 0, std::multiplies<std::size_t>()));
+            data.read_image(file, this->naxis(1), std::accumulate(this->naxis_.begin() + 2,
+                this->naxis_.end(), static_cast<std::size_t>(1), std::multiplies<std::size_t>()));
             break;
         }
         set_unit_end(file);
     }
+
+    //!reads the pixels straight into scaled applying BSCALE, BZERO and BLANK in a single pass
+    //!the stored image is not kept so get_data() is empty, scaled (float or double) must
+    //!have space for image_pixel_count(other) values
+    template <typename Output>
+    image_extension(std::fstream &file, hdu other, Output* scaled) : extension_hdu(file, std::move(other))
+    {
+        read_scaled_pixels(file, *this, scaled);
+        set_unit_end(file);
+    }
+
+    //!returnes the stored data
+    image<DataType> const& get_data() const
+    {
+        return this->data;
+    }
 };
 
 }}} //namespace boost::astronomy::io
@@ -0,0 +1,218 @@
+#ifndef BOOST_ASTRONOMY_IO_IMAGE_SECTION_HPP
+#define BOOST_ASTRONOMY_IO_IMAGE_SECTION_HPP
+
+#include <istream>
+#include <vector>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+
+#include <boost/astronomy/io/hdu.hpp>
+#include <boost/astronomy/io/bitpix.hpp>
+#include <boost/astronomy/detail/endian.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+//!N dimensional box inside an image, axis 0 corresponds to NAXIS1
+struct image_section
+{
+    std::vector<std::size_t> first; //! index of first pixel of the box along every axis
+    std::vector<std::size_t> shape; //! number of pixels of the box along every axis
+
+    image_section() {}
+
+    image_section(std::vector<std::size_t> const& start, std::vector<std::size_t> const& lengths) :
+        first(start), shape(lengths) {}
+
+    //!returns the number of pixels inside the section
+    std::size_t size() const
+    {
+        std::size_t pixels = this->shape.empty() ? 0 : 1;
+        for (std::size_t length : this->shape)
+        {
+            pixels *= length;
+        }
+        return pixels;
+    }
+};
+
+}}} //namespace boost::astronomy::io
+
+namespace boost { namespace astronomy { namespace detail {
+
+///@cond INTERNAL
+// part of a row of the image which is copied to a section
+struct section_segment
+{
+    std::streamoff offset; // position of the segment in the file
+    std::size_t length; // length of the segment in bytes
+    char* destination; // where the segment is copied
+};
+
+// appends the row segments making the section, rows are contiguous along NAXIS1
+inline void append_section_segments
+(
+    boost::astronomy::io::hdu const& header,
+    std::streamoff data_offset,
+    boost::astronomy::io::image_section const& section,
+    char* destination,
+    std::vector<section_segment>& segments
+)
+{
+    std::vector<std::size_t> naxis = header.all_naxis();
+    std::size_t const dimensions = naxis[0];
+    if (dimensions == 0 || section.first.size() != dimensions || section.shape.size() != dimensions)
+    {
+        throw boost::astronomy::invalid_image_section_exception();
+    }
+
+    for (std::size_t axis = 0; axis < dimensions; axis++)
+    {
+        if (section.shape[axis] == 0 || section.first[axis] + section.shape[axis] > naxis[axis + 1])
+        {
+            throw boost::astronomy::invalid_image_section_exception();
+        }
+    }
+
+    std::size_t const pixel_size = boost::astronomy::io::bitpix_size(header.bitpix());
+    std::size_t const row_length = section.shape[0] * pixel_size;
+
+    //index of the current row of the section along axes other than NAXIS1
+    std::vector<std::size_t> index(section.first.begin(), section.first.end());
+    std::size_t const rows = section.size() / section.shape[0];
+
+    for (std::size_t row = 0; row < rows; row++)
+    {
+        std::size_t pixel = 0;
+        for (std::size_t axis = dimensions; axis-- > 0;)
+        {
+            pixel = pixel * naxis[axis + 1] + index[axis];
+        }
+
+        segments.push_back(section_segment{data_offset +
+            static_cast<std::streamoff>(pixel * pixel_size), row_length, destination});
+        destination += row_length;
+
+        //moving to next row like an odometer
+        for (std::size_t axis = 1; axis < dimensions; axis++)
+        {
+            if (++index[axis] < section.first[axis] + section.shape[axis])
+            {
+                break;
+            }
+            index[axis] = section.first[axis];
+        }
+    }
+}
+
+// reads all the segments sorting them by offset, segments closer than max_gap
+// bytes are read with a single read and the bytes between them are discarded
+inline void read_section_segments
+(
+    std::istream& file,
+    std::vector<section_segment>& segments,
+    std::size_t max_gap
+)
+{
+    std::sort(segments.begin(), segments.end(),
+        [](section_segment const& lhs, section_segment const& rhs) {
+            return lhs.offset < rhs.offset;
+        });
+
+    std::vector<char> buffer;
+    std::size_t begin = 0;
+    while (begin < segments.size())
+    {
+        std::streamoff const run_offset = segments[begin].offset;
+        std::streamoff run_end = run_offset + static_cast<std::streamoff>(segments[begin].length);
+
+        std::size_t end = begin + 1;
+        while (end < segments.size() &&
+            segments[end].offset <= run_end + static_cast<std::streamoff>(max_gap))
+        {
+            run_end = std::max(run_end,
+                segments[end].offset + static_cast<std::streamoff>(segments[end].length));
+            end++;
+        }
+
+        buffer.resize(static_cast<std::size_t>(run_end - run_offset));
+        file.clear();
+        file.seekg(run_offset);
+        file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        if (static_cast<std::size_t>(file.gcount()) != buffer.size())
+        {
+            throw boost::astronomy::unexpected_end_of_data_exception();
+        }
+
+        for (std::size_t i = begin; i < end; i++)
+        {
+            std::memcpy(segments[i].destination,
+                buffer.data() + (segments[i].offset - run_offset), segments[i].length);
+        }
+        begin = end;
+    }
+}
+///@endcond
+
+}}} //namespace boost::astronomy::detail
+
+namespace boost { namespace astronomy { namespace io {
+
+//!reads only the pixels of all the sections of the image HDU whose data unit starts at data_offset
+/*!
+Every section is read as a set of row segments, segments of all the sections are
+sorted by their position and the ones lying within max_gap bytes of each other are
+fetched with a single read. Pixels of each section are returned along NAXIS1 first.
+*/
+template <bitpix DataType>
+std::vector<std::vector<typename bitpix_traits<DataType>::type>> read_image_sections
+(
+    std::istream& file,
+    hdu const& header,
+    std::streamoff data_offset,
+    std::vector<image_section> const& sections,
+    std::size_t max_gap = 2880
+)
+{
+    typedef typename bitpix_traits<DataType>::type pixel_type;
+    if (header.bitpix() != DataType)
+    {
+        throw wrong_extension_type();
+    }
+
+    std::vector<std::vector<pixel_type>> pixels(sections.size());
+    std::vector<boost::astronomy::detail::section_segment> segments;
+    for (std::size_t i = 0; i < sections.size(); i++)
+    {
+        pixels[i].resize(sections[i].size());
+        boost::astronomy::detail::append_section_segments(header, data_offset, sections[i],
+            reinterpret_cast<char*>(pixels[i].data()), segments);
+    }
+
+    boost::astronomy::detail::read_section_segments(file, segments, max_gap);
+
+    for (auto& section_pixels : pixels)
+    {
+        boost::astronomy::detail::big_to_native_array(section_pixels.data(), section_pixels.size());
+    }
+    return pixels;
+}
+
+//!reads only the pixels inside the section of the image HDU whose data unit starts at data_offset
+template <bitpix DataType>
+std::vector<typename bitpix_traits<DataType>::type> read_image_section
+(
+    std::istream& file,
+    hdu const& header,
+    std::streamoff data_offset,
+    image_section const& section
+)
+{
+    return read_image_sections<DataType>(file, header, data_offset,
+        std::vector<image_section>(1, section)).front();
+}
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_IMAGE_SECTION_HPP
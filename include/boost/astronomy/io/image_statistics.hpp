@@ -0,0 +1,389 @@
+#ifndef BOOST_ASTRONOMY_IO_IMAGE_STATISTICS_HPP
+#define BOOST_ASTRONOMY_IO_IMAGE_STATISTICS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include <thread>
+#include <limits>
+#include <algorithm>
+#include <type_traits>
+
+#include <boost/astronomy/detail/parallel_bands.hpp>
+#include <boost/astronomy/offload_device.hpp>
+#include <boost/astronomy/detail/offload_chunks.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+//!Summary statistics of the pixels of an image computed in a single pass
+//!NaN pixels (blank floating point pixels) are not counted
+struct image_statistics
+{
+    std::size_t count = 0; //! number of pixels used
+    double min = 0; //! minimum pixel value
+    double max = 0; //! maximum pixel value
+    double mean = 0; //! mean of pixel values
+    double m2 = 0; //! sum of squared differences from the mean
+
+    //!returns the sample variance of pixel values
+    double variance() const
+    {
+        return this->count > 1 ? this->m2 / static_cast<double>(this->count - 1) : 0;
+    }
+
+    //!returns the sample standard deviation of pixel values
+    double std_dev() const
+    {
+        return std::sqrt(this->variance());
+    }
+
+    //!merges statistics of another set of pixels into this one (Chan et al.)
+    void merge(image_statistics const& other)
+    {
+        if (other.count == 0)
+        {
+            return;
+        }
+        if (this->count == 0)
+        {
+            *this = other;
+            return;
+        }
+
+        double const total = static_cast<double>(this->count + other.count);
+        double const delta = other.mean - this->mean;
+        this->mean += delta * static_cast<double>(other.count) / total;
+        this->m2 += other.m2 + delta * delta *
+            static_cast<double>(this->count) * static_cast<double>(other.count) / total;
+        this->min = std::min(this->min, other.min);
+        this->max = std::max(this->max, other.max);
+        this->count += other.count;
+    }
+};
+
+}}} //namespace boost::astronomy::io
+
+namespace boost { namespace astronomy { namespace detail {
+
+///@cond INTERNAL
+// NaN test which also compiles for integer pixel types
+template <typename T>
+inline typename std::enable_if<std::is_floating_point<T>::value, bool>::type is_blank(T value)
+{
+    return std::isnan(value);
+}
+
+template <typename T>
+inline typename std::enable_if<!std::is_floating_point<T>::value, bool>::type is_blank(T)
+{
+    return false;
+}
+
+// statistics of a block small enough to stay in cache, the block is traversed twice
+// (sum then squared differences) so that both loops are vectorizable and stable
+template <typename PixelType>
+inline io::image_statistics block_statistics(PixelType const* data, std::size_t size)
+{
+    io::image_statistics result;
+    double sum = 0;
+    double minimum = std::numeric_limits<double>::infinity();
+    double maximum = -std::numeric_limits<double>::infinity();
+    std::size_t count = 0;
+
+    for (std::size_t i = 0; i < size; i++)
+    {
+        double const value = static_cast<double>(data[i]);
+        if (!is_blank(data[i]))
+        {
+            sum += value;
+            minimum = std::min(minimum, value);
+            maximum = std::max(maximum, value);
+            count++;
+        }
+    }
+    if (count == 0)
+    {
+        return result;
+    }
+
+    double const mean = sum / static_cast<double>(count);
+    double m2 = 0;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        if (!is_blank(data[i]))
+        {
+            double const difference = static_cast<double>(data[i]) - mean;
+            m2 += difference * difference;
+        }
+    }
+
+    result.count = count;
+    result.min = minimum;
+    result.max = maximum;
+    result.mean = mean;
+    result.m2 = m2;
+    return result;
+}
+
+// statistics of a contiguous range computed block by block
+template <typename PixelType>
+inline io::image_statistics range_statistics(PixelType const* data, std::size_t size)
+{
+    std::size_t const block = 4096;
+    io::image_statistics result;
+    for (std::size_t begin = 0; begin < size; begin += block)
+    {
+        result.merge(block_statistics(data + begin, std::min(block, size - begin)));
+    }
+    return result;
+}
+
+// statistics of all the pixels, the range is split across threads
+// threads equal to 0 uses all the hardware threads
+template <typename PixelType>
+inline io::image_statistics compute_statistics
+(
+    PixelType const* data,
+    std::size_t size,
+    std::size_t threads
+)
+{
+    std::size_t const min_pixels_per_thread = 1 << 18;
+    if (threads == 0)
+    {
+        threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    threads = std::max<std::size_t>(std::min(threads, size / min_pixels_per_thread), 1);
+
+    if (threads == 1)
+    {
+        return range_statistics(data, size);
+    }
+
+    std::vector<io::image_statistics> partial(threads);
+    std::vector<std::thread> workers;
+    std::size_t const chunk = (size + threads - 1) / threads;
+    for (std::size_t t = 1; t < threads; t++)
+    {
+        std::size_t const begin = std::min(size, t * chunk);
+        std::size_t const length = std::min(chunk, size - begin);
+        workers.emplace_back([&partial, data, begin, length, t]() {
+            partial[t] = range_statistics(data + begin, length);
+        });
+    }
+    partial[0] = range_statistics(data, std::min(chunk, size));
+
+    io::image_statistics result = partial[0];
+    for (std::size_t t = 1; t < threads; t++)
+    {
+        workers[t - 1].join();
+        result.merge(partial[t]);
+    }
+    return result;
+}
+
+// statistics of all the pixels computed a chunk at a time on device when it runs the
+// statistics kernel for PixelType, otherwise on threads threads
+template <typename PixelType>
+inline io::image_statistics compute_statistics
+(
+    PixelType const* data,
+    std::size_t size,
+    std::size_t threads,
+    offload_device* device
+)
+{
+    offload_kernel kernel;
+    kernel.operation = offload_operation::statistics;
+    kernel.value = offload_value_of<PixelType>::value;
+    if (!offload_value_of<PixelType>::supported || !use_offload(device, 1, kernel, size,
+        std::max(sizeof(PixelType), sizeof(offload_moments))))
+    {
+        return compute_statistics(data, size, threads);
+    }
+
+    io::image_statistics result;
+    offload_chunks(*device, kernel, size, sizeof(PixelType),
+        [data](void* staging, std::size_t begin, std::size_t length) {
+            std::memcpy(staging, data + begin, length * sizeof(PixelType));
+        },
+        [&result](void* staging, std::size_t, std::size_t) {
+            offload_moments moments;
+            std::memcpy(&moments, staging, sizeof(moments));
+            io::image_statistics chunk;
+            chunk.count = static_cast<std::size_t>(moments.count);
+            chunk.min = moments.min;
+            chunk.max = moments.max;
+            chunk.mean = moments.mean;
+            chunk.m2 = moments.m2;
+            result.merge(chunk);
+        });
+    return result;
+}
+
+// bounds of the histogram bins of select_rank_of, integers keep all their digits
+template <typename Value>
+using rank_key = typename std::conditional<std::is_integral<Value>::value, Value, double>::type;
+
+// distance from low to value (value >= low) in units which only need to grow with value
+// halves keep the distance between the largest doubles finite
+inline double rank_distance(double low, double value)
+{
+    return value * 0.5 - low * 0.5;
+}
+
+// the unsigned difference is exact for any two integers
+template <typename Integer>
+inline double rank_distance(Integer low, Integer value)
+{
+    return static_cast<double>(static_cast<std::uint64_t>(value) -
+        static_cast<std::uint64_t>(low));
+}
+
+// returns the value of rank k (0 based) among the values of size items without copying them,
+// value_at(i, value) stores the value of item i and returns false for the items to skip,
+// low and high are the minimum and maximum of the values which are not skipped
+// a histogram with exact bin bounds is refined around the wanted rank until the
+// remaining candidates are few enough to be selected with nth_element
+template <typename Value, typename ValueAt>
+inline Value select_rank_of
+(
+    std::size_t size,
+    std::size_t k,
+    double low,
+    double high,
+    ValueAt value_at
+)
+{
+    typedef rank_key<Value> key_type;
+    std::size_t const bins = 4096;
+    std::size_t const small_enough = 1 << 16;
+    Value item;
+
+    //infinite values leave no width to split into bins
+    if (!std::isfinite(low) || !std::isfinite(high))
+    {
+        std::vector<Value> values;
+        for (std::size_t i = 0; i < size; i++)
+        {
+            if (value_at(i, item))
+            {
+                values.push_back(item);
+            }
+        }
+        std::nth_element(values.begin(), values.begin() + k, values.end());
+        return values[k];
+    }
+
+    key_type bottom, top;
+    if (std::numeric_limits<key_type>::digits > std::numeric_limits<double>::digits)
+    {
+        //the double bounds may have lost the last digits of 64 bit integers
+        bottom = std::numeric_limits<key_type>::max();
+        top = std::numeric_limits<key_type>::lowest();
+        for (std::size_t i = 0; i < size; i++)
+        {
+            if (value_at(i, item))
+            {
+                bottom = std::min(bottom, static_cast<key_type>(item));
+                top = std::max(top, static_cast<key_type>(item));
+            }
+        }
+    }
+    else
+    {
+        bottom = static_cast<key_type>(low);
+        top = static_cast<key_type>(high);
+    }
+
+    std::vector<std::size_t> counts(bins);
+    std::vector<key_type> bin_min(bins), bin_max(bins);
+
+    while (true)
+    {
+        if (!(top > bottom))
+        {
+            return static_cast<Value>(bottom);
+        }
+
+        std::fill(counts.begin(), counts.end(), 0);
+        std::fill(bin_min.begin(), bin_min.end(), top);
+        std::fill(bin_max.begin(), bin_max.end(), bottom);
+
+        double const scale = static_cast<double>(bins) / rank_distance(bottom, top);
+        std::size_t below = 0;
+        for (std::size_t i = 0; i < size; i++)
+        {
+            if (!value_at(i, item))
+            {
+                continue;
+            }
+            key_type const value = static_cast<key_type>(item);
+            if (value < bottom)
+            {
+                below++;
+            }
+            else if (value <= top)
+            {
+                std::size_t bin = std::min(bins - 1,
+                    static_cast<std::size_t>(rank_distance(bottom, value) * scale));
+                counts[bin]++;
+                bin_min[bin] = std::min(bin_min[bin], value);
+                bin_max[bin] = std::max(bin_max[bin], value);
+            }
+        }
+
+        //rank of wanted value among the values inside [bottom, top]
+        std::size_t rank = k - below;
+        std::size_t bin = 0;
+        while (rank >= counts[bin])
+        {
+            rank -= counts[bin];
+            bin++;
+        }
+
+        if (counts[bin] <= small_enough)
+        {
+            std::vector<Value> candidates;
+            candidates.reserve(counts[bin]);
+            for (std::size_t i = 0; i < size; i++)
+            {
+                if (value_at(i, item) && static_cast<key_type>(item) >= bin_min[bin] &&
+                    static_cast<key_type>(item) <= bin_max[bin])
+                {
+                    candidates.push_back(item);
+                }
+            }
+            std::nth_element(candidates.begin(), candidates.begin() + rank, candidates.end());
+            return candidates[rank];
+        }
+
+        bottom = bin_min[bin];
+        top = bin_max[bin];
+    }
+}
+
+// returns the value of rank k (0 based) among the non blank pixels without copying them,
+// low and high are the minimum and maximum of the non blank pixels
+template <typename PixelType>
+inline PixelType select_rank
+(
+    PixelType const* data,
+    std::size_t size,
+    std::size_t k,
+    double low,
+    double high
+)
+{
+    return select_rank_of<PixelType>(size, k, low, high, [data](std::size_t i, PixelType& value) {
+        value = data[i];
+        return !is_blank(value);
+    });
+}
+///@endcond
+
+}}} //namespace boost::astronomy::detail
+
+#endif // !BOOST_ASTRONOMY_IO_IMAGE_STATISTICS_HPP
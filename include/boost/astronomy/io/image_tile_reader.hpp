@@ -0,0 +1,231 @@
+#ifndef BOOST_ASTRONOMY_IO_IMAGE_TILE_READER_HPP
+#define BOOST_ASTRONOMY_IO_IMAGE_TILE_READER_HPP
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <memory>
+#include <future>
+#include <cstddef>
+#include <algorithm>
+
+#include <boost/astronomy/io/hdu.hpp>
+#include <boost/astronomy/io/bitpix.hpp>
+#include <boost/astronomy/detail/endian.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+//!Consecutive rows of an image returned by image_tile_reader
+/*!
+Rows are counted over the whole data unit, so for a cube the rows of
+every plane follow the rows of the previous plane (row = y + NAXIS2 * z).
+*/
+template <bitpix DataType>
+struct image_tile
+{
+    typedef typename bitpix_traits<DataType>::type pixel_type;
+
+    std::vector<pixel_type> pixels; //! pixels of the tile in native byte order, row after row
+    std::size_t first_row = 0; //! index of the first row of the tile in the image
+    std::size_t rows = 0; //! number of rows in the tile
+    std::size_t width = 0; //! number of pixels in every row (NAXIS1)
+
+    //! returns pixel at the given column of the given row of the tile
+    pixel_type operator() (std::size_t row, std::size_t column) const
+    {
+        return this->pixels[row * this->width + column];
+    }
+};
+
+//!Reads an image HDU in fixed sized tiles of rows keeping only O(tile) pixels in memory
+/*!
+A tile of one row streams the image row by row and a tile of plane_rows()
+rows streams a cube plane by plane. When read ahead is enabled the next tile
+is read and decoded on a background thread while the current one is processed.
+*/
+template <bitpix DataType>
+struct image_tile_reader
+{
+public:
+    typedef image_tile<DataType> tile_type;
+    typedef typename bitpix_traits<DataType>::type pixel_type;
+
+protected:
+    std::unique_ptr<std::fstream> file; //! stream used only by this reader
+    hdu header; //! header of the image HDU
+    std::streamoff data_offset = 0; //! position of first byte of the data unit
+    std::size_t width = 0; //! pixels in a row
+    std::size_t total_rows = 0; //! rows in all the planes of the image
+    std::size_t rows_per_tile = 1; //! rows returned by every call to next
+    std::size_t next_row = 0; //! first row of the tile to be read next
+    bool read_ahead = true; //! tiles are read on a background thread
+    std::future<tile_type> pending; //! tile being read in background
+
+public:
+    //!opens the file and reads the header of the image HDU starting at header_offset
+    //!header offsets of all the HDUs are available from fits::get_directory()
+    image_tile_reader
+    (
+        std::string const& file_path,
+        std::streamoff header_offset,
+        std::size_t tile_rows,
+        bool background = true
+    ) :
+        file(new std::fstream(file_path, std::ios_base::in | std::ios_base::binary)),
+        rows_per_tile(std::max<std::size_t>(tile_rows, 1)),
+        read_ahead(background)
+    {
+        file->seekg(header_offset);
+        header.read_header(*file);
+        data_offset = file->tellg();
+
+        if (header.bitpix() != DataType)
+        {
+            throw wrong_extension_type();
+        }
+
+        if (header.naxis() > 0)
+        {
+            std::vector<std::size_t> naxis = header.all_naxis();
+            width = naxis[1];
+            total_rows = 1;
+            for (std::size_t i = 2; i < naxis.size(); i++)
+            {
+                total_rows *= naxis[i];
+            }
+        }
+
+        if (this->read_ahead)
+        {
+            start_next_tile();
+        }
+    }
+
+    image_tile_reader(image_tile_reader&& other) = default;
+    image_tile_reader& operator=(image_tile_reader&& other) = default;
+
+    ~image_tile_reader()
+    {
+        if (pending.valid())
+        {
+            pending.wait();
+        }
+    }
+
+    //!returns the header of the image HDU
+    hdu const& get_header() const
+    {
+        return this->header;
+    }
+
+    //!returns the number of pixels in a row
+    std::size_t row_width() const
+    {
+        return this->width;
+    }
+
+    //!returns the number of rows of all the planes of the image
+    std::size_t row_count() const
+    {
+        return this->total_rows;
+    }
+
+    //!returns the number of rows in a single plane (NAXIS2)
+    std::size_t plane_rows() const
+    {
+        return this->header.naxis() >= 2 ? this->header.naxis(2) : this->total_rows;
+    }
+
+    //!returns the number of tiles in which image is returned
+    std::size_t tile_count() const
+    {
+        return (this->total_rows + this->rows_per_tile - 1) / this->rows_per_tile;
+    }
+
+    //!reads the next tile of the image into tile
+    //!returns false when all the rows of the image are already read
+    bool next(tile_type& tile)
+    {
+        if (this->read_ahead)
+        {
+            if (!pending.valid())
+            {
+                return false;
+            }
+            tile = pending.get();
+            start_next_tile();
+            return true;
+        }
+
+        if (this->next_row >= this->total_rows)
+        {
+            return false;
+        }
+        tile = read_tile(file.get(), tile_offset(this->next_row), this->width,
+            this->next_row, tile_rows(this->next_row));
+        this->next_row += this->rows_per_tile;
+        return true;
+    }
+
+protected:
+    //!position in file of the first pixel of the given row
+    std::streamoff tile_offset(std::size_t row) const
+    {
+        return this->data_offset +
+            static_cast<std::streamoff>(row * this->width * sizeof(pixel_type));
+    }
+
+    //!number of rows in the tile starting at given row
+    std::size_t tile_rows(std::size_t row) const
+    {
+        return std::min(this->rows_per_tile, this->total_rows - row);
+    }
+
+    //!schedules the read of the next tile on a background thread
+    void start_next_tile()
+    {
+        if (this->next_row >= this->total_rows)
+        {
+            pending = std::future<tile_type>();
+            return;
+        }
+
+        pending = std::async(std::launch::async, &image_tile_reader::read_tile, file.get(),
+            tile_offset(this->next_row), this->width, this->next_row, tile_rows(this->next_row));
+        this->next_row += this->rows_per_tile;
+    }
+
+    //!reads and decodes rows starting at offset, only one read is active on a stream at a time
+    static tile_type read_tile
+    (
+        std::fstream* stream,
+        std::streamoff offset,
+        std::size_t width,
+        std::size_t first_row,
+        std::size_t rows
+    )
+    {
+        tile_type tile;
+        tile.first_row = first_row;
+        tile.rows = rows;
+        tile.width = width;
+        tile.pixels.resize(width * rows);
+
+        stream->clear();
+        stream->seekg(offset);
+        stream->read(reinterpret_cast<char*>(tile.pixels.data()),
+            static_cast<std::streamsize>(tile.pixels.size() * sizeof(pixel_type)));
+        if (static_cast<std::size_t>(stream->gcount()) != tile.pixels.size() * sizeof(pixel_type))
+        {
+            throw unexpected_end_of_data_exception();
+        }
+
+        boost::astronomy::detail::big_to_native_array(tile.pixels.data(), tile.pixels.size());
+        return tile;
+    }
+};
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_IMAGE_TILE_READER_HPP
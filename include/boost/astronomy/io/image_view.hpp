@@ -0,0 +1,82 @@
+#ifndef BOOST_ASTRONOMY_IO_IMAGE_VIEW_HPP
+#define BOOST_ASTRONOMY_IO_IMAGE_VIEW_HPP
+
+#include <cstddef>
+#include <cstring>
+
+#include <boost/astronomy/io/bitpix.hpp>
+#include <boost/astronomy/detail/endian.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+//!Non owning view of an image stored in FITS format (big endian) in memory
+//!Pixels are converted to native byte order only when they are accessed
+template <bitpix DataType>
+struct image_view
+{
+public:
+    typedef typename bitpix_traits<DataType>::type pixel_type;
+
+protected:
+    char const* raw = nullptr; //! first byte of the image
+    std::size_t width = 0; //! width of image
+    std::size_t height = 0; //! height of image
+
+public:
+    image_view() {}
+
+    image_view(char const* data, std::size_t columns, std::size_t rows) :
+        raw(data), width(columns), height(rows) {}
+
+    //! returns the pixel at given position (same indexing as image_buffer)
+    pixel_type operator() (std::size_t x, std::size_t y) const
+    {
+        return this->at((x * this->width) + y);
+    }
+
+    //! returns the pixel stored at given index
+    pixel_type at(std::size_t index) const
+    {
+        return boost::astronomy::detail::load_big_endian<pixel_type>
+            (this->raw + index * sizeof(pixel_type));
+    }
+
+    //! returns the total number of pixels in the view
+    std::size_t size() const
+    {
+        return this->width * this->height;
+    }
+
+    std::size_t get_width() const
+    {
+        return this->width;
+    }
+
+    std::size_t get_height() const
+    {
+        return this->height;
+    }
+
+    //! returns the pointer to the big endian data of the image
+    char const* raw_data() const
+    {
+        return this->raw;
+    }
+
+    //! converts all the pixels into native byte order and stores them in output
+    //! output must have space for atleast size() pixels
+    void copy_to(pixel_type* output) const
+    {
+        if (this->size() == 0)
+        {
+            return;
+        }
+
+        std::memcpy(output, this->raw, this->size() * sizeof(pixel_type));
+        boost::astronomy::detail::big_to_native_array(output, this->size());
+    }
+};
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_IMAGE_VIEW_HPP
@@ -0,0 +1,214 @@
+#ifndef BOOST_ASTRONOMY_IO_IO_COUNTERS_HPP
+#define BOOST_ASTRONOMY_IO_IO_COUNTERS_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <functional>
+
+namespace boost { namespace astronomy { namespace io {
+
+//!kinds of work recorded by the io instrumentation
+enum class io_event_kind
+{
+    read, //! bytes read from a stream, seconds spent in the read call
+    seek, //! change of the position of a stream
+    allocation, //! buffer allocated for the data read (pixels, rows of a table)
+    header, //! header cards parsed, bytes of the header unit
+    byte_swap, //! values converted from big endian to native byte order
+    column //! values of a table column gathered from the rows
+};
+
+//!one piece of work recorded by the io instrumentation
+struct io_event
+{
+    io_event_kind kind;
+    std::size_t bytes = 0; //! bytes read, allocated, parsed or converted
+    double seconds = 0; //! wall time of the work, 0 for seeks and allocations
+
+    io_event(io_event_kind event_kind, std::size_t event_bytes = 0, double event_seconds = 0)
+        : kind(event_kind), bytes(event_bytes), seconds(event_seconds) {}
+};
+
+//!callback receiving every event recorded while a scope using it is open
+//!events of io on other threads (fits::load_all) are delivered on those threads
+typedef std::function<void(io_event const&)> io_hook;
+
+//!Snapshot of the io done by fits, hdu, image and table extensions
+/*!
+The counters are only filled when BOOST_ASTRONOMY_IO_INSTRUMENTATION is defined,
+otherwise the io code records nothing and every counter stays 0. Header, byte swap
+and column times are wall times of the whole phase, read times those of the read
+calls themselves, so header_seconds includes the reads of the header blocks.
+*/
+struct io_counters
+{
+    std::uint64_t bytes_read = 0; //! bytes read from streams
+    std::uint64_t read_calls = 0; //! number of read calls
+    std::uint64_t seeks = 0; //! number of seeks
+    std::uint64_t allocations = 0; //! number of data buffers allocated
+    std::uint64_t allocated_bytes = 0; //! bytes of the data buffers
+    std::uint64_t header_bytes = 0; //! bytes of the header units parsed
+    std::uint64_t swapped_bytes = 0; //! bytes converted to native byte order
+    std::uint64_t column_bytes = 0; //! bytes of the column values gathered
+    double read_seconds = 0; //! time spent in read calls
+    double header_seconds = 0; //! time spent reading and parsing headers
+    double byte_swap_seconds = 0; //! time spent converting to native byte order
+    double column_seconds = 0; //! time spent gathering table columns
+
+    //!adds the event to the counters
+    void record(io_event const& event)
+    {
+        switch (event.kind)
+        {
+        case io_event_kind::read:
+            this->bytes_read += event.bytes;
+            this->read_calls++;
+            this->read_seconds += event.seconds;
+            break;
+        case io_event_kind::seek:
+            this->seeks++;
+            break;
+        case io_event_kind::allocation:
+            this->allocations++;
+            this->allocated_bytes += event.bytes;
+            break;
+        case io_event_kind::header:
+            this->header_bytes += event.bytes;
+            this->header_seconds += event.seconds;
+            break;
+        case io_event_kind::byte_swap:
+            this->swapped_bytes += event.bytes;
+            this->byte_swap_seconds += event.seconds;
+            break;
+        case io_event_kind::column:
+            this->column_bytes += event.bytes;
+            this->column_seconds += event.seconds;
+            break;
+        }
+    }
+
+    //!adds the counters of other to these
+    void merge(io_counters const& other)
+    {
+        this->bytes_read += other.bytes_read;
+        this->read_calls += other.read_calls;
+        this->seeks += other.seeks;
+        this->allocations += other.allocations;
+        this->allocated_bytes += other.allocated_bytes;
+        this->header_bytes += other.header_bytes;
+        this->swapped_bytes += other.swapped_bytes;
+        this->column_bytes += other.column_bytes;
+        this->read_seconds += other.read_seconds;
+        this->header_seconds += other.header_seconds;
+        this->byte_swap_seconds += other.byte_swap_seconds;
+        this->column_seconds += other.column_seconds;
+    }
+};
+
+//!Records the io done by the calling thread into counters while it is alive
+/*!
+Scopes nest: an event is recorded by every scope open on the thread, innermost
+first, and passed to the hook of each of them. fits opens a scope on its own
+counters around everything it reads; opening one around calls on an hdu, an image
+or a table (get_column, ...) attributes their work to any counters.
+*/
+class io_counter_scope
+{
+public:
+    explicit io_counter_scope(io_counters& target, io_hook event_hook = io_hook())
+        : counters(&target), hook(std::move(event_hook)), outer(current())
+    {
+        current() = this;
+    }
+
+    io_counter_scope(io_counter_scope const&) = delete;
+    io_counter_scope& operator=(io_counter_scope const&) = delete;
+
+    ~io_counter_scope()
+    {
+        current() = this->outer;
+    }
+
+    //!records event into the counters of all the scopes open on the calling thread
+    static void record(io_event const& event)
+    {
+        for (io_counter_scope* scope = current(); scope != nullptr; scope = scope->outer)
+        {
+            scope->counters->record(event);
+            if (scope->hook)
+            {
+                scope->hook(event);
+            }
+        }
+    }
+
+private:
+    io_counters* counters;
+    io_hook hook;
+    io_counter_scope* outer;
+
+    static io_counter_scope*& current()
+    {
+        thread_local io_counter_scope* scope = nullptr;
+        return scope;
+    }
+};
+
+}}} //namespace boost::astronomy::io
+
+namespace boost { namespace astronomy { namespace detail {
+
+///@cond INTERNAL
+// records an event when BOOST_ASTRONOMY_IO_INSTRUMENTATION is defined, nothing otherwise
+inline void count_io(io::io_event_kind kind, std::size_t bytes = 0)
+{
+#if defined(BOOST_ASTRONOMY_IO_INSTRUMENTATION)
+    io::io_counter_scope::record(io::io_event(kind, bytes));
+#else
+    (void)kind;
+    (void)bytes;
+#endif
+}
+
+// records the wall time from construction to destruction as an event of given kind
+// the clock is not read unless BOOST_ASTRONOMY_IO_INSTRUMENTATION is defined
+class io_timer
+{
+public:
+    explicit io_timer(io::io_event_kind event_kind, std::size_t event_bytes = 0)
+        : kind(event_kind), bytes(event_bytes)
+    {
+#if defined(BOOST_ASTRONOMY_IO_INSTRUMENTATION)
+        this->start = std::chrono::steady_clock::now();
+#endif
+    }
+
+    io_timer(io_timer const&) = delete;
+    io_timer& operator=(io_timer const&) = delete;
+
+    //!changes the bytes recorded, for work whose size is only known at the end
+    void set_bytes(std::size_t count)
+    {
+        this->bytes = count;
+    }
+
+    ~io_timer()
+    {
+#if defined(BOOST_ASTRONOMY_IO_INSTRUMENTATION)
+        io::io_counter_scope::record(io::io_event(this->kind, this->bytes,
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - this->start).count()));
+#endif
+    }
+
+private:
+    io::io_event_kind kind;
+    std::size_t bytes;
+    std::chrono::steady_clock::time_point start;
+};
+///@endcond
+
+}}} //namespace boost::astronomy::detail
+
+#endif // !BOOST_ASTRONOMY_IO_IO_COUNTERS_HPP
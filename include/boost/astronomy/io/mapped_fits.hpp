@@ -0,0 +1,232 @@
+#ifndef BOOST_ASTRONOMY_IO_MAPPED_FITS_HPP
+#define BOOST_ASTRONOMY_IO_MAPPED_FITS_HPP
+
+#include <string>
+#include <fstream>
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <algorithm>
+#include <numeric>
+#include <functional>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <boost/astronomy/io/hdu.hpp>
+#include <boost/astronomy/io/image_view.hpp>
+#include <boost/astronomy/io/binary_table.hpp>
+#include <boost/astronomy/io/ascii_table.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+//!location of the data unit of an HDU inside the mapped file
+struct data_unit_view
+{
+    char const* begin = nullptr; //! first byte of the data unit
+    std::size_t size = 0; //! size of data unit in bytes (without padding)
+};
+
+//!Read only access to a FITS file which is mapped into memory as a whole
+/*!
+Headers of all the HDUs are parsed once when the file is opened,
+data units are never copied. Images and tables are returned as views
+referring to the mapped 2880 byte blocks, so the mapped_fits object
+must outlive all the views obtained from it.
+*/
+struct mapped_fits
+{
+protected:
+    boost::interprocess::file_mapping file_map; //! mapping of the FITS file
+    boost::interprocess::mapped_region region; //! complete file mapped into memory
+    std::vector<hdu> headers; //! header of every HDU in the file
+    std::vector<data_unit_view> data_units; //! data unit of every HDU in the file
+    char const* first = nullptr; //! first byte of the file
+    std::size_t length = 0; //! size of the file in bytes
+
+    //!for files held in memory by derived classes, see read_headers
+    mapped_fits() {}
+
+    //!parses the headers of all the HDUs of the file stored at data
+    void read_headers(char const* data, std::size_t size)
+    {
+        this->first = data;
+        this->length = size;
+        this->headers.clear();
+        this->data_units.clear();
+
+        char const* current = data;
+        char const* end = data + size;
+
+        //reading headers one by one, data units are skipped
+        while (end - current >= 2880)
+        {
+            headers.emplace_back();
+            current = headers.back().read_header(current, end);
+
+            data_unit_view unit;
+            unit.begin = current;
+            unit.size = headers.back().data_size();
+            if (static_cast<std::size_t>(end - current) < unit.size)
+            {
+                throw unexpected_end_of_data_exception();
+            }
+            data_units.push_back(unit);
+
+            //padding of last block may be missing at the end of file
+            current += std::min(static_cast<std::size_t>(end - current),
+                hdu::block_aligned_size(unit.size));
+        }
+    }
+
+public:
+    mapped_fits(std::string const& file_path) :
+        file_map(file_path.c_str(), boost::interprocess::read_only),
+        region(file_map, boost::interprocess::read_only)
+    {
+        this->read_headers(static_cast<char const*>(region.get_address()), region.get_size());
+    }
+
+    //!returns first byte of the mapped file
+    char const* begin() const
+    {
+        return this->first;
+    }
+
+    //!returns total size of the mapped file in bytes
+    std::size_t file_size() const
+    {
+        return this->length;
+    }
+
+    //!returns number of HDUs present in the file
+    std::size_t size() const
+    {
+        return headers.size();
+    }
+
+    //!returns the header of HDU at given index
+    hdu const& get_header(std::size_t index) const
+    {
+        return headers.at(index);
+    }
+
+    //!returns location of data unit of HDU at given index
+    data_unit_view get_data_unit(std::size_t index) const
+    {
+        return data_units.at(index);
+    }
+
+    //!returns the image stored in HDU at given index without copying it
+    template <bitpix DataType>
+    image_view<DataType> get_image(std::size_t index) const
+    {
+        hdu const& header = get_header(index);
+        if (header.bitpix() != DataType)
+        {
+            throw wrong_extension_type();
+        }
+
+        switch (header.naxis())
+        {
+        case 0:
+            return image_view<DataType>();
+        case 1:
+            return image_view<DataType>(data_units[index].begin, header.naxis(1), 1);
+        default:
+        {
+            std::vector<std::size_t> naxis = header.all_naxis();
+            return image_view<DataType>(data_units[index].begin, header.naxis(1),
+                std::accumulate(naxis.begin() + 2, naxis.end(), static_cast<std::size_t>(1),
+                    std::multiplies<std::size_t>()));
+        }
+        }
+    }
+
+    //!calls f with the image_view<DataType> of the HDU at given index
+    //!the BITPIX of the header is switched on only once before calling f
+    template <typename Function>
+    auto visit_image(std::size_t index, Function&& f) const
+        -> decltype(f(std::declval<image_view<bitpix::B8> const&>()))
+    {
+        return dispatch_bitpix(get_header(index).bitpix(), [&](auto tag)
+            -> decltype(f(std::declval<image_view<bitpix::B8> const&>())) {
+            return f(this->get_image<decltype(tag)::value>(index));
+        });
+    }
+
+    //!returns the binary table stored in HDU at given index without copying its data
+    binary_table_extension get_binary_table(std::size_t index) const
+    {
+        hdu const& header = get_header(index);
+        if (!header.has_key("XTENSION") ||
+            header.value_of<std::string>("XTENSION") != "'BINTABLE'")
+        {
+            throw wrong_extension_type();
+        }
+        return binary_table_extension(header, data_units[index].begin);
+    }
+
+    //!returns the ascii table stored in HDU at given index without copying its data
+    ascii_table get_ascii_table(std::size_t index) const
+    {
+        hdu const& header = get_header(index);
+        if (!header.has_key("XTENSION") ||
+            header.value_of<std::string>("XTENSION") != "'TABLE   '")
+        {
+            throw wrong_extension_type();
+        }
+        return ascii_table(header, data_units[index].begin);
+    }
+};
+
+//!FITS file read into memory as a whole, with the accessors of mapped_fits
+/*!
+The bytes are owned by the object, so it can be moved between threads (e.g. from the
+stages of run_fits_pipeline) while the views obtained from it stay valid.
+*/
+struct buffered_fits : public mapped_fits
+{
+protected:
+    std::vector<char> bytes; //! content of the file
+
+public:
+    buffered_fits() {}
+
+    //!parses the headers of the file whose content is given
+    explicit buffered_fits(std::vector<char> content) : bytes(std::move(content))
+    {
+        this->read_headers(this->bytes.data(), this->bytes.size());
+    }
+
+    //!reads the complete file and parses its headers
+    explicit buffered_fits(std::string const& file_path) :
+        buffered_fits(read_file(file_path)) {}
+
+    buffered_fits(buffered_fits&& other) = default;
+    buffered_fits& operator=(buffered_fits&& other) = default;
+
+    //!returns the content of the file at given path
+    static std::vector<char> read_file(std::string const& file_path)
+    {
+        std::ifstream file(file_path, std::ios_base::in | std::ios_base::binary);
+        if (!file)
+        {
+            throw fits_read_exception();
+        }
+        file.seekg(0, std::ios_base::end);
+        std::vector<char> content(static_cast<std::size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(content.data(), static_cast<std::streamsize>(content.size()));
+        if (static_cast<std::size_t>(file.gcount()) != content.size())
+        {
+            throw unexpected_end_of_data_exception();
+        }
+        return content;
+    }
+};
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_MAPPED_FITS_HPP
@@ -3,13 +3,17 @@
 
 //#include <map>
 #include <string>
+#include <utility>
 #include <vector>
 #include <cstddef>
 #include <valarray>
+#include <numeric>
+#include <functional>
 #include <fstream>
 
 #include <boost/astronomy/io/hdu.hpp>
 #include <boost/astronomy/io/image.hpp>
+#include <boost/astronomy/io/scaled_image.hpp>
 
 namespace boost { namespace astronomy { namespace io {
 
@@ -42,16 +46,17 @@ public:
             data.read_image(file, this->naxis(1), this->naxis(2));
             break;
         default:
-            data.read_image(file, this->naxis(1), std::accumulate(this->naxis_.begin()+1,
-                this->naxis_.end(), 0, std::multiplies<std::size_t>()));
+            data.read_image(file, this->naxis(1), std::accumulate(this->naxis_.begin() + 2,
+                this->naxis_.end(), static_cast<std::size_t>(1), std::multiplies<std::size_t>()));
             break;
         }
 
         set_unit_end(file);    //set cursor to the end of the HDU unit
     }
 
-    //!This constructore should be used when boost::astronomy::io::hdu object already exist for the file 
-    primary_hdu(std::fstream &file, hdu const& other) : hdu(other)
+    //!This constructore should be used when boost::astronomy::io::hdu object already exist for the file
+    //!the header is moved into the new object when other is an rvalue
+    primary_hdu(std::fstream &file, hdu other) : hdu(std::move(other))
     {
         simple = this->value_of<bool>("SIMPLE");
         extend = this->value_of<bool>("EXTEND");
@@ -68,16 +73,29 @@ public:
             data.read_image(file, this->naxis(1), this->naxis(2));
             break;
         default:
-            data.read_image(file, this->naxis(1), std::accumulate(this->naxis_.begin()+ 1,
-                this->naxis_.end(), 0, std::multiplies<std::size_t>()));
+            data.read_image(file, this->naxis(1), std::accumulate(this->naxis_.begin() + 2,
+                this->naxis_.end(), static_cast<std::size_t>(1), std::multiplies<std::size_t>()));
             break;
         }
 
         set_unit_end(file);    //set cursor to the end of the HDU unit
     }
 
+    //!reads the pixels straight into scaled applying BSCALE, BZERO and BLANK in a single pass
+    //!the stored image is not kept so get_data() is empty, scaled (float or double) must
+    //!have space for image_pixel_count(other) values
+    template <typename Output>
+    primary_hdu(std::fstream &file, hdu other, Output* scaled) : hdu(std::move(other))
+    {
+        simple = this->value_of<bool>("SIMPLE");
+        extend = this->value_of<bool>("EXTEND");
+
+        read_scaled_pixels(file, *this, scaled);
+        set_unit_end(file);    //set cursor to the end of the HDU unit
+    }
+
     //!returnes the stored data
-    image<DataType> get_data() const
+    image<DataType> const& get_data() const
     {
         return this->data;
     }
@@ -0,0 +1,297 @@
+#ifndef BOOST_ASTRONOMY_IO_ROBUST_STATISTICS_HPP
+#define BOOST_ASTRONOMY_IO_ROBUST_STATISTICS_HPP
+
+#include <cstddef>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <algorithm>
+
+#include <boost/astronomy/io/image.hpp>
+#include <boost/astronomy/io/image_statistics.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+//!value around which pixels are clipped in sigma clipping
+enum class clip_center
+{
+    median, //! median of the pixels not yet rejected
+    mean //! mean of the pixels not yet rejected
+};
+
+//!outcome of sigma clipping
+struct sigma_clip_result
+{
+    std::size_t iterations = 0; //! iterations which rejected atleast one pixel
+    std::size_t count = 0; //! number of pixels left after clipping
+    double mean = 0; //! mean of pixels left after clipping
+    double std_dev = 0; //! sample standard deviation of pixels left after clipping
+    double median = 0; //! median of pixels left after clipping
+    double lower_bound = 0; //! pixels below this value are rejected
+    double upper_bound = 0; //! pixels above this value are rejected
+};
+
+//!Robust statistics (sigma clipping, MAD, biweight) of the pixels of an image_buffer
+/*!
+No copy of the pixels is made: clipping only ever rejects the pixels outside a
+range of values, so the pixels which are not rejected are the non NaN pixels of
+the image inside [low, high]. Every clipping iteration is one pass over the image
+which subtracts the newly rejected pixels from the running sums and tightens the
+bounds. The median and the MAD are selected by refining a histogram of the
+remaining pixels (see image_buffer::median), without sorting them.
+The image must outlive this object as all the results are read from its pixels.
+*/
+template <typename PixelType>
+struct robust_statistics
+{
+protected:
+    image_buffer<PixelType> const* image = nullptr; //! image whose pixels are used
+    double low = 0; //! minimum of the pixels which are not rejected
+    double high = 0; //! maximum of the pixels which are not rejected
+    std::size_t kept = 0; //! number of pixels which are not rejected
+    double shift = 0; //! value subtracted from pixels in running sums for stability
+    double sum = 0; //! sum of (pixel - shift) over pixels not rejected
+    double sum_squares = 0; //! sum of (pixel - shift)^2 over pixels not rejected
+
+public:
+    robust_statistics(image_buffer<PixelType> const& source) : image(&source)
+    {
+        reset();
+    }
+
+    //!accepts all the pixels again undoing previous clipping
+    void reset()
+    {
+        image_statistics const all = boost::astronomy::detail::range_statistics(
+            this->image->pixels(), this->image->size());
+        this->kept = all.count;
+        this->low = all.count == 0 ? 0 : all.min;
+        this->high = all.count == 0 ? 0 : all.max;
+        this->shift = all.mean;
+        this->sum = 0;
+        this->sum_squares = all.m2;
+    }
+
+    //!returns the number of pixels which are not rejected
+    std::size_t count() const
+    {
+        return this->kept;
+    }
+
+    //!returns the mean of pixels which are not rejected
+    double mean() const
+    {
+        return this->count() == 0 ? 0 : this->shift + this->sum / static_cast<double>(this->count());
+    }
+
+    //!returns the sample standard deviation of pixels which are not rejected
+    double std_dev() const
+    {
+        if (this->count() < 2)
+        {
+            return 0;
+        }
+        double const n = static_cast<double>(this->count());
+        return std::sqrt(std::max(0.0, (this->sum_squares - this->sum * this->sum / n) / (n - 1)));
+    }
+
+    //!returns the median (element of rank n / 2) of pixels which are not rejected
+    double median() const
+    {
+        if (this->count() == 0)
+        {
+            return 0;
+        }
+        PixelType const* pixels = this->image->pixels();
+        double const bottom = this->low, top = this->high;
+        return static_cast<double>(boost::astronomy::detail::select_rank_of<PixelType>(
+            this->image->size(), this->count() / 2, bottom, top,
+            [pixels, bottom, top](std::size_t i, PixelType& value) {
+                value = pixels[i];
+                return is_kept(value, bottom, top);
+            }));
+    }
+
+    //!returns the median absolute deviation from the median of pixels which are not rejected
+    double mad() const
+    {
+        if (this->count() == 0)
+        {
+            return 0;
+        }
+        double const center = this->median();
+        PixelType const* pixels = this->image->pixels();
+        double const bottom = this->low, top = this->high;
+        return boost::astronomy::detail::select_rank_of<double>(this->image->size(),
+            this->count() / 2, 0, std::max(top - center, center - bottom),
+            [pixels, bottom, top, center](std::size_t i, double& deviation) {
+                deviation = std::abs(static_cast<double>(pixels[i]) - center);
+                return is_kept(pixels[i], bottom, top);
+            });
+    }
+
+    //!returns the biweight location of pixels which are not rejected
+    double biweight_location(double tuning = 6.0) const
+    {
+        double const center = this->median();
+        double const spread = tuning * this->mad();
+        if (!(spread > 0))
+        {
+            return center;
+        }
+
+        double numerator = 0, denominator = 0;
+        for_each_kept([&](double value) {
+            double const u = (value - center) / spread;
+            if (std::abs(u) < 1)
+            {
+                double const weight = (1 - u * u) * (1 - u * u);
+                numerator += (value - center) * weight;
+                denominator += weight;
+            }
+        });
+        return center + numerator / denominator;
+    }
+
+    //!returns the biweight midvariance of pixels which are not rejected
+    double biweight_midvariance(double tuning = 9.0) const
+    {
+        double const center = this->median();
+        double const spread = tuning * this->mad();
+        if (!(spread > 0))
+        {
+            return 0;
+        }
+
+        double numerator = 0, denominator = 0;
+        for_each_kept([&](double value) {
+            double const u = (value - center) / spread;
+            if (std::abs(u) < 1)
+            {
+                double const difference = value - center;
+                double const weight = (1 - u * u);
+                numerator += difference * difference * weight * weight * weight * weight;
+                denominator += weight * (1 - 5 * u * u);
+            }
+        });
+        return static_cast<double>(this->count()) * numerator / (denominator * denominator);
+    }
+
+    //!rejects pixels further than lower (upper) standard deviations below (above) the center
+    //!and repeats until no pixel is rejected or max_iterations is reached
+    sigma_clip_result sigma_clip
+    (
+        double lower = 3.0,
+        double upper = 3.0,
+        std::size_t max_iterations = 5,
+        clip_center center = clip_center::median
+    )
+    {
+        sigma_clip_result result;
+        for (std::size_t iteration = 0; iteration < max_iterations && this->count() > 1; iteration++)
+        {
+            double const middle = center == clip_center::median ? this->median() : this->mean();
+            double const deviation = this->std_dev();
+            result.lower_bound = middle - lower * deviation;
+            result.upper_bound = middle + upper * deviation;
+
+            std::size_t const rejected = reject_outside(result.lower_bound, result.upper_bound);
+            if (rejected == 0)
+            {
+                break;
+            }
+            result.iterations++;
+        }
+
+        result.count = this->count();
+        result.mean = this->mean();
+        result.std_dev = this->std_dev();
+        result.median = this->median();
+        if (result.iterations == 0 && this->count() > 0)
+        {
+            result.lower_bound = this->low;
+            result.upper_bound = this->high;
+        }
+        return result;
+    }
+
+    //!returns a bitmask which is true for every rejected pixel, in the order of image pixels
+    std::vector<bool> mask() const
+    {
+        std::vector<bool> rejected(this->image->size(), true);
+        if (this->count() == 0)
+        {
+            return rejected;
+        }
+
+        PixelType const* pixels = this->image->pixels();
+        for (std::size_t i = 0; i < rejected.size(); i++)
+        {
+            rejected[i] = !is_kept(pixels[i], this->low, this->high);
+        }
+        return rejected;
+    }
+
+protected:
+    //!true if pixel is not NaN and inside [bottom, top]
+    static bool is_kept(PixelType pixel, double bottom, double top)
+    {
+        double const value = static_cast<double>(pixel);
+        return !boost::astronomy::detail::is_blank(pixel) && value >= bottom && value <= top;
+    }
+
+    //!calls f with the value of every pixel which is not rejected
+    template <typename Function>
+    void for_each_kept(Function f) const
+    {
+        if (this->count() == 0)
+        {
+            return;
+        }
+        PixelType const* pixels = this->image->pixels();
+        for (std::size_t i = 0; i < this->image->size(); i++)
+        {
+            if (is_kept(pixels[i], this->low, this->high))
+            {
+                f(static_cast<double>(pixels[i]));
+            }
+        }
+    }
+
+    //!rejects the pixels outside [bottom, top] in one pass updating the running sums
+    //!and the bounds of the remaining pixels, returns the number of pixels rejected
+    std::size_t reject_outside(double bottom, double top)
+    {
+        std::size_t const before = this->count();
+        double kept_min = std::numeric_limits<double>::infinity();
+        double kept_max = -std::numeric_limits<double>::infinity();
+        for_each_kept([&](double value) {
+            if (value < bottom || value > top)
+            {
+                remove_from_sums(value);
+                this->kept--;
+            }
+            else
+            {
+                kept_min = std::min(kept_min, value);
+                kept_max = std::max(kept_max, value);
+            }
+        });
+        if (this->kept != 0)
+        {
+            this->low = kept_min;
+            this->high = kept_max;
+        }
+        return before - this->count();
+    }
+
+    void remove_from_sums(double value)
+    {
+        this->sum -= value - this->shift;
+        this->sum_squares -= (value - this->shift) * (value - this->shift);
+    }
+};
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_ROBUST_STATISTICS_HPP
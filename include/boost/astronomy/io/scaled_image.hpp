@@ -0,0 +1,194 @@
+#ifndef BOOST_ASTRONOMY_IO_SCALED_IMAGE_HPP
+#define BOOST_ASTRONOMY_IO_SCALED_IMAGE_HPP
+
+#include <istream>
+#include <vector>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <algorithm>
+#include <type_traits>
+
+#include <boost/astronomy/io/hdu.hpp>
+#include <boost/astronomy/io/bitpix.hpp>
+#include <boost/astronomy/detail/endian.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+//!linear scaling of stored pixel values into physical values
+//!physical = bzero + bscale * stored, stored pixels equal to blank are undefined
+struct image_scaling
+{
+    double bscale = 1; //! value of BSCALE
+    double bzero = 0; //! value of BZERO
+    bool has_blank = false; //! true when BLANK is present (only used for integer images)
+    long long blank = 0; //! value of BLANK
+
+    //!reads BSCALE, BZERO and BLANK from the header, missing keys keep their defaults
+    static image_scaling from_header(hdu const& header)
+    {
+        image_scaling scaling;
+        if (header.has_key("BSCALE"))
+        {
+            scaling.bscale = header.value_of<double>("BSCALE");
+        }
+        if (header.has_key("BZERO"))
+        {
+            scaling.bzero = header.value_of<double>("BZERO");
+        }
+        if (header.has_key("BLANK"))
+        {
+            scaling.has_blank = true;
+            scaling.blank = header.value_of<long long>("BLANK");
+        }
+        return scaling;
+    }
+};
+
+//!returns the number of pixels in the data unit of an image HDU
+inline std::size_t image_pixel_count(hdu const& header)
+{
+    std::vector<std::size_t> naxis = header.all_naxis();
+    if (naxis.empty() || naxis[0] == 0)
+    {
+        return 0;
+    }
+
+    std::size_t pixels = 1;
+    for (std::size_t axis = 1; axis < naxis.size(); axis++)
+    {
+        pixels *= naxis[axis];
+    }
+    return pixels;
+}
+
+}}} //namespace boost::astronomy::io
+
+namespace boost { namespace astronomy { namespace detail {
+
+///@cond INTERNAL
+// applies the scaling to native pixels, kept branch free so that the loop is vectorized
+template <typename PixelType, typename Output>
+inline typename std::enable_if<std::is_integral<PixelType>::value>::type scale_pixels
+(
+    PixelType const* pixels,
+    std::size_t count,
+    io::image_scaling const& scaling,
+    Output* output
+)
+{
+    Output const bscale = static_cast<Output>(scaling.bscale);
+    Output const bzero = static_cast<Output>(scaling.bzero);
+    if (!scaling.has_blank || scaling.blank < static_cast<long long>(std::numeric_limits<PixelType>::min())
+        || scaling.blank > static_cast<long long>(std::numeric_limits<PixelType>::max()))
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            output[i] = bzero + bscale * static_cast<Output>(pixels[i]);
+        }
+        return;
+    }
+
+    PixelType const blank = static_cast<PixelType>(scaling.blank);
+    Output const undefined = std::numeric_limits<Output>::quiet_NaN();
+    for (std::size_t i = 0; i < count; i++)
+    {
+        Output const value = bzero + bscale * static_cast<Output>(pixels[i]);
+        output[i] = pixels[i] == blank ? undefined : value;
+    }
+}
+
+// floating point images mark undefined pixels with NaN which survives the scaling
+template <typename PixelType, typename Output>
+inline typename std::enable_if<std::is_floating_point<PixelType>::value>::type scale_pixels
+(
+    PixelType const* pixels,
+    std::size_t count,
+    io::image_scaling const& scaling,
+    Output* output
+)
+{
+    Output const bscale = static_cast<Output>(scaling.bscale);
+    Output const bzero = static_cast<Output>(scaling.bzero);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        output[i] = bzero + bscale * static_cast<Output>(pixels[i]);
+    }
+}
+
+// decodes count big endian pixels in chunks small enough to stay in cache, fill(bytes, length)
+// copies the next length bytes of the data unit into bytes
+template <typename PixelType, typename Output, typename Fill>
+inline void decode_scaled_chunks
+(
+    std::size_t count,
+    io::image_scaling const& scaling,
+    Output* output,
+    Fill&& fill
+)
+{
+    std::size_t const chunk = 4096;
+    std::vector<PixelType> pixels(std::min(chunk, count));
+    for (std::size_t begin = 0; begin < count; begin += chunk)
+    {
+        std::size_t const length = std::min(chunk, count - begin);
+        fill(reinterpret_cast<char*>(pixels.data()), length * sizeof(PixelType));
+        big_to_native_array(pixels.data(), length);
+        scale_pixels(pixels.data(), length, scaling, output + begin);
+    }
+}
+///@endcond
+
+}}} //namespace boost::astronomy::detail
+
+namespace boost { namespace astronomy { namespace io {
+
+//!reads the pixels of the data unit starting at the current position of file and stores
+//!bzero + bscale * pixel into output in a single pass, BLANK pixels become NaN
+/*!
+Pixels are read, byte swapped and scaled a few thousand at a time so the stored
+image is never kept in memory. Output must be float or double and have space for
+image_pixel_count(header) values. The file is left after the last pixel.
+*/
+template <typename Output>
+void read_scaled_pixels(std::istream& file, hdu const& header, Output* output)
+{
+    static_assert(std::is_floating_point<Output>::value, "scaled pixels are stored as float or double");
+
+    image_scaling const scaling = image_scaling::from_header(header);
+    std::size_t const count = image_pixel_count(header);
+    dispatch_bitpix(header.bitpix(), [&](auto tag) {
+        typedef typename decltype(tag)::pixel_type pixel_type;
+        boost::astronomy::detail::decode_scaled_chunks<pixel_type>(count, scaling, output,
+            [&file](char* bytes, std::size_t length) {
+                file.read(bytes, static_cast<std::streamsize>(length));
+                if (static_cast<std::size_t>(file.gcount()) != length)
+                {
+                    throw unexpected_end_of_data_exception();
+                }
+            });
+    });
+}
+
+//!same as read_scaled_pixels for a data unit already in memory (e.g. mapped_fits)
+template <typename Output>
+void decode_scaled_pixels(char const* data, hdu const& header, Output* output)
+{
+    static_assert(std::is_floating_point<Output>::value, "scaled pixels are stored as float or double");
+
+    image_scaling const scaling = image_scaling::from_header(header);
+    std::size_t const count = image_pixel_count(header);
+    dispatch_bitpix(header.bitpix(), [&](auto tag) {
+        typedef typename decltype(tag)::pixel_type pixel_type;
+        boost::astronomy::detail::decode_scaled_chunks<pixel_type>(count, scaling, output,
+            [&data](char* bytes, std::size_t length) {
+                std::memcpy(bytes, data, length);
+                data += length;
+            });
+    });
+}
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_SCALED_IMAGE_HPP
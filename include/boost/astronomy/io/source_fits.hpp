@@ -0,0 +1,154 @@
+#ifndef BOOST_ASTRONOMY_IO_SOURCE_FITS_HPP
+#define BOOST_ASTRONOMY_IO_SOURCE_FITS_HPP
+
+#include <istream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <boost/astronomy/io/hdu.hpp>
+#include <boost/astronomy/io/fits.hpp>
+#include <boost/astronomy/io/bitpix.hpp>
+#include <boost/astronomy/io/data_source.hpp>
+#include <boost/astronomy/io/image_section.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+//!Lazily reads a FITS file stored in any data_source (e.g. object storage)
+/*!
+Only the headers are read when the object is created, the directory of all
+HDUs is built exactly like fits_open_mode::directory does. Each header is fetched
+with range reads and when the source is a prefetching_source the blocks after
+it are already in flight while the header is being parsed. Data units and
+cutouts are fetched on demand, cutouts go through read_image_sections, so
+the row segments of a section are coalesced into few range requests.
+*/
+struct source_fits
+{
+protected:
+    std::shared_ptr<data_source> source; //! source holding the file
+    std::vector<hdu> headers; //! header of every HDU in the file
+    std::vector<hdu_directory_entry> directory; //! location of every HDU in the file
+
+public:
+    //!reads the headers of all the HDUs stored in source
+    explicit source_fits(std::shared_ptr<data_source> storage) : source(std::move(storage))
+    {
+        std::uint64_t const size = this->source->size();
+        std::uint64_t offset = 0;
+        std::vector<char> blocks;
+
+        while (offset + 2880 <= size)
+        {
+            read_header_blocks(offset, blocks);
+
+            hdu_directory_entry entry;
+            entry.header_offset = static_cast<std::streamoff>(offset);
+            this->headers.emplace_back();
+            char const* data = this->headers.back().read_header(blocks.data(),
+                blocks.data() + blocks.size());
+            entry.data_offset = entry.header_offset + (data - blocks.data());
+            entry.data_size = this->headers.back().data_size();
+            this->directory.push_back(entry);
+
+            offset = static_cast<std::uint64_t>(entry.data_offset) +
+                hdu::block_aligned_size(entry.data_size);
+        }
+    }
+
+    //!returns the number of HDUs in the file
+    std::size_t size() const
+    {
+        return this->headers.size();
+    }
+
+    //!returns the header of HDU at given index
+    hdu const& get_header(std::size_t index) const
+    {
+        return this->headers.at(index);
+    }
+
+    //!returns the location of all the HDUs
+    std::vector<hdu_directory_entry> const& get_directory() const
+    {
+        return this->directory;
+    }
+
+    //!returns the source the file is read from
+    data_source& get_source() const
+    {
+        return *this->source;
+    }
+
+    //!requests the data units of the given HDUs to be fetched in background
+    //!has effect only when the source caches data (prefetching_source)
+    void prefetch_data(std::vector<std::size_t> const& indices)
+    {
+        for (std::size_t index : indices)
+        {
+            hdu_directory_entry const& entry = this->directory.at(index);
+            this->source->prefetch(static_cast<std::uint64_t>(entry.data_offset), entry.data_size);
+        }
+    }
+
+    //!returns the data unit (without padding) of HDU at given index as stored in the file
+    //!it can be viewed with image_view or binary_table_extension(header, data)
+    std::vector<char> read_data(std::size_t index)
+    {
+        hdu_directory_entry const& entry = this->directory.at(index);
+        std::vector<char> data(entry.data_size);
+        if (entry.data_size != 0 && this->source->read_range(static_cast<std::uint64_t>(entry.data_offset),
+            data.data(), data.size()) != data.size())
+        {
+            throw unexpected_end_of_data_exception();
+        }
+        return data;
+    }
+
+    //!reads only the pixels of the sections of the image HDU at given index
+    template <bitpix DataType>
+    std::vector<std::vector<typename bitpix_traits<DataType>::type>> read_image_sections
+    (
+        std::size_t index,
+        std::vector<image_section> const& sections,
+        std::size_t max_gap = 2880
+    )
+    {
+        source_streambuf buffer(*this->source);
+        std::istream stream(&buffer);
+        return io::read_image_sections<DataType>(stream, this->headers.at(index),
+            this->directory.at(index).data_offset, sections, max_gap);
+    }
+
+protected:
+    //!reads blocks starting at offset until the block holding the END card
+    void read_header_blocks(std::uint64_t offset, std::vector<char>& blocks)
+    {
+        blocks.clear();
+        while (true)
+        {
+            std::size_t const begin = blocks.size();
+            blocks.resize(begin + 2880);
+            if (this->source->read_range(offset + begin, blocks.data() + begin, 2880) != 2880)
+            {
+                throw unexpected_end_of_data_exception();
+            }
+
+            for (std::size_t card = begin; card < blocks.size(); card += 80)
+            {
+                if (std::memcmp(blocks.data() + card, "END     ", 8) == 0)
+                {
+                    return;
+                }
+            }
+        }
+    }
+};
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_SOURCE_FITS_HPP
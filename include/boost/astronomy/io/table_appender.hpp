@@ -0,0 +1,378 @@
+#ifndef BOOST_ASTRONOMY_IO_TABLE_APPENDER_HPP
+#define BOOST_ASTRONOMY_IO_TABLE_APPENDER_HPP
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <utility>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+
+#include <boost/astronomy/io/hdu.hpp>
+#include <boost/astronomy/io/card.hpp>
+#include <boost/astronomy/io/column.hpp>
+#include <boost/astronomy/io/column_view.hpp>
+#include <boost/astronomy/io/binary_table.hpp>
+#include <boost/astronomy/detail/endian.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+//!column of a binary table written by table_appender
+struct table_column
+{
+    std::string name; //! TTYPE
+    std::string format; //! binary TFORM (e.g. 1J, 3E, 16A), variable length arrays are rejected
+    std::string unit; //! TUNIT, not written when empty
+};
+
+//!where table_appender writes the table
+enum class table_append_mode
+{
+    create, //! creates (or truncates) the file with an empty primary HDU before the table
+    extend //! adds the table after the last HDU of an existing FITS file
+};
+
+//!options of table_appender
+struct table_appender_options
+{
+    std::size_t batch_rows = 1 << 16; //! rows buffered in memory before whole blocks are written
+    std::size_t checkpoint_rows = 0; //! rows between automatic checkpoints, 0 for explicit ones
+};
+
+//!Writes a growing BINTABLE at the end of a FITS file without rewriting it
+/*!
+Rows are given column by column, every column is converted to big endian directly
+into its place in a buffer of rows. Whenever the buffer is full the complete 2880
+byte blocks of the data unit are written and the rest of the last block stays in
+the buffer, so the file only sees large block aligned writes and no row is written
+twice. checkpoint() also writes the last partial block followed by its padding and
+patches the NAXIS2 card of the header in place, after which the file is a valid
+FITS file holding all the rows appended so far. Later rows overwrite the padding.
+*/
+class table_appender
+{
+public:
+    //!writes the header of the table with NAXIS2 = 0 and given EXTNAME
+    table_appender
+    (
+        std::string const& file_path,
+        std::vector<table_column> const& table_columns,
+        std::string const& extname = "EVENTS",
+        table_append_mode mode = table_append_mode::create,
+        table_appender_options const& options = table_appender_options()
+    ) : checkpoint_rows(options.checkpoint_rows)
+    {
+        this->fields.reserve(table_columns.size());
+        for (auto const& column : table_columns)
+        {
+            column_descriptor field = binary_table_extension::parse_tform(column.format);
+            if (field.type == 'P' || field.type == 'Q')
+            {
+                throw invalid_table_colum_format();
+            }
+            field.offset = this->width;
+            this->width += field.width;
+            this->fields.push_back(field);
+        }
+        if (this->width == 0)
+        {
+            throw invalid_table_colum_format();
+        }
+
+        std::ios_base::openmode const open_mode = std::ios_base::in | std::ios_base::out |
+            std::ios_base::binary;
+        std::vector<card> cards;
+        if (mode == table_append_mode::create)
+        {
+            this->file.open(file_path, open_mode | std::ios_base::trunc);
+            cards.emplace_back();
+            cards.back().create_card("SIMPLE", true);
+            cards.emplace_back();
+            cards.back().create_card("BITPIX", 8);
+            cards.emplace_back();
+            cards.back().create_card("NAXIS", 0);
+            cards.emplace_back();
+            cards.back().create_card("EXTEND", true);
+            this->write_cards(cards);
+            cards.clear();
+        }
+        else
+        {
+            this->file.open(file_path, open_mode);
+            this->file.seekp(0, std::ios_base::end);
+            std::streamoff const size = this->file.tellp();
+            if (!this->file || size <= 0 || size % 2880 != 0)
+            {
+                throw fits_write_exception();
+            }
+        }
+        if (!this->file)
+        {
+            throw fits_write_exception();
+        }
+
+        this->header_offset = this->file.tellp();
+        cards.emplace_back("XTENSION", "'BINTABLE'");
+        cards.emplace_back();
+        cards.back().create_card("BITPIX", 8);
+        cards.emplace_back();
+        cards.back().create_card("NAXIS", 2);
+        cards.emplace_back();
+        cards.back().create_card("NAXIS1", this->width);
+        cards.emplace_back();
+        cards.back().create_card("NAXIS2", 0);
+        cards.emplace_back();
+        cards.back().create_card("PCOUNT", 0);
+        cards.emplace_back();
+        cards.back().create_card("GCOUNT", 1);
+        cards.emplace_back();
+        cards.back().create_card("TFIELDS", table_columns.size());
+        for (std::size_t i = 0; i < table_columns.size(); i++)
+        {
+            std::string const number = std::to_string(i + 1);
+            cards.emplace_back("TTYPE" + number, quoted(table_columns[i].name));
+            cards.emplace_back("TFORM" + number, quoted(table_columns[i].format));
+            if (!table_columns[i].unit.empty())
+            {
+                cards.emplace_back("TUNIT" + number, quoted(table_columns[i].unit));
+            }
+        }
+        cards.emplace_back("EXTNAME", quoted(extname));
+        this->data_offset = this->header_offset + this->write_cards(cards);
+        this->naxis2_offset = this->header_offset + 4 * 80;
+
+        this->buffer.resize(std::max<std::size_t>(options.batch_rows, 1) * this->width + 2880);
+        this->checkpoint();
+    }
+
+    table_appender(table_appender&& other) = default;
+    table_appender& operator=(table_appender&& other) = default;
+
+    //!checkpoints the rows appended so far, errors are ignored (call close() to see them)
+    ~table_appender()
+    {
+        try
+        {
+            if (this->file.is_open())
+            {
+                this->checkpoint();
+            }
+        }
+        catch (...)
+        {
+        }
+    }
+
+    //!appends count rows, values of the i-th column are read from the i-th pointer
+    /*!
+    Every pointer holds count x repeat values of the type matching TFORM of its column
+    (E -> float, 2J -> 2 std::int32_t per row, 16A -> 16 chars per row, 12X -> 2 bytes
+    per row...), in the order of the rows.
+    */
+    template <typename... T>
+    void append_rows(std::size_t count, T const*... values)
+    {
+        if (sizeof...(T) != this->fields.size())
+        {
+            throw invalid_table_colum_format();
+        }
+        this->check_types<T...>(std::make_index_sequence<sizeof...(T)>());
+
+        std::size_t done = 0;
+        while (done < count)
+        {
+            std::size_t free_rows = (this->buffer.size() - this->used) / this->width;
+            if (free_rows == 0)
+            {
+                this->write_blocks();
+                free_rows = (this->buffer.size() - this->used) / this->width;
+            }
+            std::size_t rows = std::min(count - done, free_rows);
+            if (this->checkpoint_rows != 0)
+            {
+                rows = std::min(rows, this->checkpoint_rows - this->since_checkpoint);
+            }
+
+            this->store_columns(std::make_index_sequence<sizeof...(T)>(), done, rows, values...);
+            this->used += rows * this->width;
+            this->row_count += rows;
+            this->since_checkpoint += rows;
+            done += rows;
+            if (this->checkpoint_rows != 0 && this->since_checkpoint == this->checkpoint_rows)
+            {
+                this->checkpoint();
+            }
+        }
+    }
+
+    //!writes all the buffered rows and the padding and sets NAXIS2 to the number of rows
+    void checkpoint()
+    {
+        this->file.seekp(this->data_offset + static_cast<std::streamoff>(this->written));
+        this->file.write(this->buffer.data(), static_cast<std::streamsize>(this->used));
+        std::size_t const padding = hdu::block_aligned_size(this->used) - this->used;
+        char const zeros[2880] = {};
+        this->file.write(zeros, static_cast<std::streamsize>(padding));
+
+        card naxis2;
+        naxis2.create_card("NAXIS2", this->row_count);
+        this->file.seekp(this->naxis2_offset);
+        this->file.write(naxis2.data(), 80);
+        this->file.flush();
+        if (!this->file)
+        {
+            throw fits_write_exception();
+        }
+        this->since_checkpoint = 0;
+    }
+
+    //!checkpoints and closes the file
+    void close()
+    {
+        this->checkpoint();
+        this->file.close();
+        if (this->file.fail())
+        {
+            throw fits_write_exception();
+        }
+    }
+
+    //!returns the number of rows appended so far
+    std::size_t rows() const
+    {
+        return this->row_count;
+    }
+
+    //!returns the size of a row in bytes (NAXIS1)
+    std::size_t row_width() const
+    {
+        return this->width;
+    }
+
+    //!returns the type, repeat count and offset of every column
+    std::vector<column_descriptor> const& get_descriptors() const
+    {
+        return this->fields;
+    }
+
+private:
+    std::fstream file; //! file being written
+    std::vector<column_descriptor> fields; //! columns of the table
+    std::size_t width = 0; //! bytes of a row
+    std::streamoff header_offset = 0; //! position of the XTENSION card
+    std::streamoff naxis2_offset = 0; //! position of the NAXIS2 card
+    std::streamoff data_offset = 0; //! position of the first row
+    std::size_t written = 0; //! bytes of complete blocks of the data unit written to file
+    std::vector<char> buffer; //! rows following the written blocks
+    std::size_t used = 0; //! bytes of buffer in use
+    std::size_t row_count = 0; //! rows appended
+    std::size_t since_checkpoint = 0; //! rows appended after the last checkpoint
+    std::size_t checkpoint_rows = 0; //! rows between automatic checkpoints
+
+    //!returns the string value of a card, at least 8 characters between quotes
+    static std::string quoted(std::string value)
+    {
+        if (value.length() < 8)
+        {
+            value.append(8 - value.length(), ' ');
+        }
+        return "'" + value + "'";
+    }
+
+    //!writes the cards, END and padding at the current position and returns the bytes written
+    std::streamoff write_cards(std::vector<card> const& cards)
+    {
+        std::string unit;
+        for (auto const& header_card : cards)
+        {
+            unit.append(header_card.data(), 80);
+        }
+        unit += std::string("END").append(77, ' ');
+        unit.append(hdu::block_aligned_size(unit.size()) - unit.size(), ' ');
+        this->file.write(unit.data(), static_cast<std::streamsize>(unit.size()));
+        return static_cast<std::streamoff>(unit.size());
+    }
+
+    //!writes the complete blocks of the buffer and keeps the rest of the last one
+    void write_blocks()
+    {
+        std::size_t const blocks = this->used / 2880 * 2880;
+        this->file.seekp(this->data_offset + static_cast<std::streamoff>(this->written));
+        this->file.write(this->buffer.data(), static_cast<std::streamsize>(blocks));
+        if (!this->file)
+        {
+            throw fits_write_exception();
+        }
+        std::memmove(this->buffer.data(), this->buffer.data() + blocks, this->used - blocks);
+        this->used -= blocks;
+        this->written += blocks;
+    }
+
+    //!throws when a pointer type does not match TFORM of its column
+    template <typename... T, std::size_t... I>
+    void check_types(std::index_sequence<I...>) const
+    {
+        bool const accepted[] = {true,
+            column_value_traits<T>::accepts(this->fields[I].type)...};
+        for (bool ok : accepted)
+        {
+            if (!ok)
+            {
+                throw invalid_table_colum_format();
+            }
+        }
+    }
+
+    //!converts rows values of every column starting at row first into the buffer
+    template <std::size_t... I, typename... T>
+    void store_columns
+    (
+        std::index_sequence<I...>,
+        std::size_t first,
+        std::size_t rows,
+        T const*... values
+    )
+    {
+        int const expand[] = {0, (this->store_column(this->fields[I], values, first, rows), 0)...};
+        (void)expand;
+    }
+
+    //!converts rows values of a column starting at row first into the buffer
+    template <typename T>
+    void store_column
+    (
+        column_descriptor const& field,
+        T const* values,
+        std::size_t first,
+        std::size_t rows
+    )
+    {
+        typedef typename column_value_traits<T>::scalar_type scalar_type;
+        std::size_t const scalars = field.width / sizeof(scalar_type);
+        scalar_type const* source = reinterpret_cast<scalar_type const*>(values) + first * scalars;
+        char* destination = this->buffer.data() + this->used + field.offset;
+        if (sizeof(scalar_type) == 1)
+        {
+            for (std::size_t r = 0; r < rows; r++)
+            {
+                std::memcpy(destination + r * this->width, source + r * scalars, scalars);
+            }
+            return;
+        }
+        for (std::size_t r = 0; r < rows; r++)
+        {
+            char* row = destination + r * this->width;
+            for (std::size_t e = 0; e < scalars; e++)
+            {
+                boost::astronomy::detail::store_big_endian(source[r * scalars + e],
+                    row + e * sizeof(scalar_type));
+            }
+        }
+    }
+};
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_TABLE_APPENDER_HPP
@@ -4,8 +4,12 @@
 #include <cstddef>
 #include <fstream>
 #include <string>
+#include <utility>
+#include <vector>
+#include <unordered_map>
 #include <boost/astronomy/io/extension_hdu.hpp>
 #include <boost/astronomy/io/column.hpp>
+#include <boost/astronomy/io/io_counters.hpp>
 
 namespace boost { namespace astronomy { namespace io {
 
@@ -15,27 +19,124 @@ struct table_extension : public extension_hdu
 protected:
     std::size_t tfields;
     std::vector<column> col_metadata;
+    std::vector<column_descriptor> descriptors; //! parsed format of every column
+    std::unordered_map<std::string, std::size_t> name_index; //! TTYPE to position of column
     std::vector<char> data;
+    char const* mapped_data = nullptr; //!table data when viewed from memory instead of copying
 
 public:
     table_extension() {}
 
+    //!creates table which refers to data stored in memory, data is not copied
+    //!memory must remain valid for lifetime of the object
+    table_extension(hdu other, char const* data_begin) :
+        extension_hdu(std::move(other)), mapped_data(data_begin)
+    {
+        tfields = this->value_of<std::size_t>("TFIELDS");
+        col_metadata.resize(tfields);
+        descriptors.resize(tfields);
+    }
+
     table_extension(std::fstream &file) : extension_hdu(file)
     {
         tfields = this->value_of<std::size_t>("TFIELDS");
-        col_metadata.reserve(tfields);
+        col_metadata.resize(tfields);
+        descriptors.resize(tfields);
     }
 
-    table_extension(std::fstream &file, hdu const& other) : extension_hdu(file, other)
+    table_extension(std::fstream &file, hdu other) : extension_hdu(file, std::move(other))
     {
         tfields = this->value_of<std::size_t>("TFIELDS");
-        col_metadata.reserve(tfields);
+        col_metadata.resize(tfields);
+        descriptors.resize(tfields);
     }
 
     table_extension(std::fstream &file, std::streampos pos) : extension_hdu(file, pos)
     {
         tfields = this->value_of<std::size_t>("TFIELDS");
-        col_metadata.reserve(tfields);
+        col_metadata.resize(tfields);
+        descriptors.resize(tfields);
+    }
+
+    //!reads the rows (and heap if any) of the table in a single read
+    void read_data(std::fstream &file)
+    {
+        namespace bad = boost::astronomy::detail;
+        data.resize(this->data_size());
+        bad::count_io(io_event_kind::allocation, data.size());
+        {
+            bad::io_timer read_timer(io_event_kind::read, data.size());
+            file.read(data.data(), static_cast<std::streamsize>(data.size()));
+        }
+        set_unit_end(file);
+    }
+
+    //!returns the number of columns in the table
+    std::size_t columns() const
+    {
+        return this->tfields;
+    }
+
+    //!returns the metadata of all the columns
+    std::vector<column> const& get_columns() const
+    {
+        return this->col_metadata;
+    }
+
+    //!returns the parsed format of all the columns
+    std::vector<column_descriptor> const& get_descriptors() const
+    {
+        return this->descriptors;
+    }
+
+    //!returns the position of column with given TTYPE in get_columns()
+    //!returns columns() if there is no such column
+    std::size_t column_index(std::string const& name) const
+    {
+        auto position = this->name_index.find(name);
+        return position == this->name_index.end() ? this->tfields : position->second;
+    }
+
+    //!returns pointer to the first row of table data
+    char const* table_data() const
+    {
+        return this->mapped_data != nullptr ? this->mapped_data : this->data.data();
+    }
+
+protected:
+    //!builds the index from TTYPE to column position, first column wins for duplicate names
+    void index_columns()
+    {
+        this->name_index.clear();
+        for (std::size_t i = 0; i < this->col_metadata.size(); i++)
+        {
+            std::string name = column_name(this->col_metadata[i]);
+            if (!name.empty())
+            {
+                this->name_index.emplace(name, i);
+            }
+        }
+    }
+
+    //!reads TSCALn and TZEROn of column at given position into its descriptor
+    void read_scaling(std::size_t i)
+    {
+        std::string const number = std::to_string(i + 1);
+        this->descriptors[i].scale = this->has_key("TSCAL" + number) ?
+            this->value_of<double>("TSCAL" + number) : 1.0;
+        this->descriptors[i].zero = this->has_key("TZERO" + number) ?
+            this->value_of<double>("TZERO" + number) : 0.0;
+    }
+
+    //!returns TTYPE of the column without quotes and trailing spaces
+    static std::string column_name(column const& col)
+    {
+        std::string name = col.TTYPE();
+        if (name.length() >= 2 && name.front() == '\'' && name.back() == '\'')
+        {
+            name = name.substr(1, name.length() - 2);
+        }
+        return name.substr(0, name.find_last_not_of(' ') + 1);
     }
 };
 
@@ -0,0 +1,51 @@
+#ifndef BOOST_ASTRONOMY_IO_VISIT_IMAGE_HPP
+#define BOOST_ASTRONOMY_IO_VISIT_IMAGE_HPP
+
+#include <utility>
+
+#include <boost/astronomy/io/hdu.hpp>
+#include <boost/astronomy/io/bitpix.hpp>
+#include <boost/astronomy/io/image.hpp>
+#include <boost/astronomy/io/primary_hdu.hpp>
+#include <boost/astronomy/io/image_extension.hpp>
+#include <boost/astronomy/exception/fits_exception.hpp>
+
+namespace boost { namespace astronomy { namespace io {
+
+//!calls f with the typed image stored in the primary HDU or image extension
+/*!
+The BITPIX of the header is switched on once and f is called with
+image<DataType> const&, so a generic lambda gets an image of the actual pixel
+type and its loops over pixels() are compiled (and inlined) for that type:
+
+    double total = visit_image(*fits_file.get_hdu(1), [](auto const& img) {
+        return std::accumulate(img.pixels(), img.pixels() + img.size(), 0.0);
+    });
+
+f must return the same type for every pixel type.
+Throws wrong_extension_type when the HDU does not hold an image in memory
+(a table, or a header whose data unit was not loaded).
+*/
+template <typename Function>
+auto visit_image(hdu const& header, Function&& f)
+    -> decltype(f(std::declval<image<bitpix::B8> const&>()))
+{
+    return dispatch_bitpix(header.bitpix(), [&](auto tag)
+        -> decltype(f(std::declval<image<bitpix::B8> const&>())) {
+        constexpr bitpix DataType = decltype(tag)::value;
+
+        if (auto primary = dynamic_cast<primary_hdu<DataType> const*>(&header))
+        {
+            return f(primary->get_data());
+        }
+        if (auto extension = dynamic_cast<image_extension<DataType> const*>(&header))
+        {
+            return f(extension->get_data());
+        }
+        throw wrong_extension_type();
+    });
+}
+
+}}} //namespace boost::astronomy::io
+
+#endif // !BOOST_ASTRONOMY_IO_VISIT_IMAGE_HPP
@@ -0,0 +1,111 @@
+#ifndef BOOST_ASTRONOMY_OFFLOAD_DEVICE_HPP
+#define BOOST_ASTRONOMY_OFFLOAD_DEVICE_HPP
+
+#include <cstddef>
+
+#include <boost/astronomy/coordinate/conversion_accuracy.hpp>
+
+namespace boost { namespace astronomy {
+
+//!type of the values staged for an offload_device
+enum class offload_value
+{
+    uint8,
+    int16,
+    int32,
+    int64,
+    float32,
+    float64
+};
+
+//!coordinate systems of the components handled by the transform kernel of an offload_device
+enum class offload_system
+{
+    cartesian,
+    spherical, //! (phi, theta, r) with theta measured from z axis, radian
+    spherical_equatorial //! (lambda, delta, r) with delta measured from xy plane, radian
+};
+
+//!operations run by an offload_device on the chunks of a bulk operation
+enum class offload_operation
+{
+    //! in place on the 3 component arrays: from -> cartesian -> matrix -> to
+    transform,
+    //! offload_moments of the non NaN values, written at the start of the staging buffer
+    statistics
+};
+
+//!kernel run by an offload_device on every chunk of a bulk operation
+/*!
+The CPU code paths compute the same values: the transform kernel rotates the
+cartesian components given by batch_to_cartesian with matrix and converts them
+back with batch_from_cartesian using the trigonometric functions of accuracy
+(a device may use its own functions of the same accuracy). The statistics
+kernel gives the count, min, max, mean and m2 of io::image_statistics.
+*/
+struct offload_kernel
+{
+    offload_operation operation = offload_operation::transform;
+    offload_value value = offload_value::float64;
+    offload_system from = offload_system::cartesian;
+    offload_system to = offload_system::cartesian;
+    coordinate::conversion_accuracy accuracy = coordinate::conversion_accuracy::exact;
+    double matrix[3][3] = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}}; //! row major rotation
+};
+
+//!result of the statistics kernel for a chunk, merged on the host
+struct offload_moments
+{
+    double count;
+    double min;
+    double max;
+    double mean;
+    double m2; //! sum of squared differences from the mean
+};
+
+//!Accelerator running the kernels of bulk operations asynchronously (GPU, FPGA...)
+/*!
+Every stream has its own staging buffer in page locked host memory and runs the
+work queued on it in order. For every chunk the host copies the values from the
+batch or image into the staging buffer of a stream and queues the kernel, the
+device then uploads the buffer, runs the kernel and downloads the results into
+the same buffer without blocking the host. While a stream works on its chunk the
+host packs and unpacks the chunks of the other streams, so with two streams or
+more the copies over the bus, the kernels and the host copies all overlap.
+
+A transform chunk of count points stores the 3 component arrays one after the
+other (count values each) and the kernel replaces them by the results. A
+statistics chunk stores count pixels and the kernel writes its offload_moments at
+the start of the buffer.
+
+A device is used by one bulk operation at a time. Implementations wrap e.g.
+CUDA streams with cudaHostAlloc buffers or SYCL queues with host USM, the library
+itself only ships host_offload_device which runs the kernels on CPU threads.
+*/
+struct offload_device
+{
+    virtual ~offload_device() {}
+
+    //!returns the number of streams, 1 or more
+    virtual std::size_t streams() const = 0;
+
+    //!returns the size in bytes of the staging buffer of every stream
+    virtual std::size_t staging_size() const = 0;
+
+    //!returns the staging buffer of stream aligned for all the offload_value types
+    virtual void* staging(std::size_t stream) = 0;
+
+    //!returns true if the device can run kernel
+    virtual bool supports(offload_kernel const& kernel) const = 0;
+
+    //!queues on stream the upload of the staging buffer, the kernel on count values
+    //!(points or pixels) and the download of the results, returns without waiting
+    virtual void enqueue(std::size_t stream, offload_kernel const& kernel, std::size_t count) = 0;
+
+    //!waits for all the work queued on stream, throws the errors of the device
+    virtual void synchronize(std::size_t stream) = 0;
+};
+
+}} //namespace boost::astronomy
+
+#endif // !BOOST_ASTRONOMY_OFFLOAD_DEVICE_HPP
@@ -0,0 +1,80 @@
+#define BOOST_TEST_MODULE alt_az_track_test
+
+#include <cmath>
+#include <boost/test/unit_test.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/systems/si/plane_angle.hpp>
+#include <boost/units/systems/si/dimensionless.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/astronomy/coordinate/alt_az_track.hpp>
+#include <boost/astronomy/coordinate/representation_batch.hpp>
+
+using namespace std;
+using namespace boost::astronomy::coordinate;
+using namespace boost::units::si;
+using namespace boost::units;
+namespace bpt = boost::posix_time;
+
+double const degree_to_radian = 0.017453292519943295769;
+
+BOOST_AUTO_TEST_SUITE(alt_az_track_interpolation)
+
+BOOST_AUTO_TEST_CASE(matches_exact_transform)
+{
+    observing_site site;
+    site.latitude = 19.82 * degree_to_radian;
+    site.longitude = -155.47 * degree_to_radian;
+    site.pressure = 61500;
+    site.temperature = 2;
+    site.relative_humidity = 0.2;
+
+    spherical_equatorial_representation_batch<double> targets;
+    for (int i = 0; i < 500; i++)
+    {
+        targets.push_back((0.73 * i) * degree_to_radian * radians,
+            (-85.0 + 0.35 * i) * degree_to_radian * radians, quantity<si::dimensionless>(2.0));
+    }
+
+    bpt::ptime const start = bpt::time_from_string("2024-11-02 05:00:00");
+    double const tolerance = 1e-9;
+    alt_az_track track(targets, site, start, start + bpt::hours(6), tolerance);
+    BOOST_CHECK(track.max_error() <= tolerance);
+    BOOST_CHECK(track.segments() < 20);
+
+    time_transform_cache cache;
+    for (int step = 0; step <= 100; step++)
+    {
+        bpt::ptime const time = start + bpt::seconds(step * 216) + bpt::milliseconds(step * 37);
+        auto const interpolated = track.at<spherical_equatorial_representation_batch<double>>(time);
+        auto const exact = transform_batch_to_alt_az(targets, time, site, cache);
+        for (std::size_t i = 0; i < targets.size(); i++)
+        {
+            //the azimuth is checked through the distance on the sky
+            double const alt = exact.data<1>()[i];
+            double const daz = std::remainder(interpolated.data<0>()[i] - exact.data<0>()[i],
+                6.28318530717958647693);
+            BOOST_CHECK_SMALL(interpolated.data<1>()[i] - alt, 2 * tolerance);
+            BOOST_CHECK_SMALL(daz * std::cos(alt), 2 * tolerance);
+            BOOST_CHECK_SMALL(interpolated.data<2>()[i] - 2.0, 1e-15);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(empty_interval)
+{
+    observing_site site;
+    spherical_equatorial_representation_batch<double> targets;
+    targets.push_back(1.0 * radians, 0.5 * radians, quantity<si::dimensionless>(1.0));
+
+    bpt::ptime const start = bpt::time_from_string("2024-11-02 05:00:00");
+    alt_az_track track(targets, site, start, start);
+    BOOST_CHECK_EQUAL(track.segments(), 1u);
+
+    time_transform_cache cache;
+    auto const interpolated = track.at<spherical_equatorial_representation_batch<double>>(start);
+    auto const exact = transform_batch_to_alt_az(targets, start, site, cache);
+    BOOST_CHECK_SMALL(interpolated.data<0>()[0] - exact.data<0>()[0], 1e-9);
+    BOOST_CHECK_SMALL(interpolated.data<1>()[0] - exact.data<1>()[0], 1e-9);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
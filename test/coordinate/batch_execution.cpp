@@ -0,0 +1,175 @@
+#define BOOST_TEST_MODULE batch_execution_test
+
+#include <cmath>
+#include <mutex>
+#include <vector>
+#include <utility>
+#include <atomic>
+#include <stdexcept>
+#include <algorithm>
+#include <boost/test/unit_test.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/systems/si/plane_angle.hpp>
+#include <boost/units/systems/si/length.hpp>
+#include <boost/astronomy/coordinate/frame_transform.hpp>
+#include <boost/astronomy/coordinate/epoch_propagation.hpp>
+#include <boost/astronomy/coordinate/representation_batch.hpp>
+
+using namespace std;
+using namespace boost::astronomy::coordinate;
+using namespace boost::units::si;
+using namespace boost::units;
+
+typedef spherical_equatorial_representation_batch<double, quantity<si::plane_angle>,
+    quantity<si::plane_angle>, quantity<si::length>> position_batch;
+typedef cartesian_representation_batch<double, quantity<si::length>, quantity<si::length>,
+    quantity<si::length>> metre_batch;
+
+position_batch make_positions(std::size_t count)
+{
+    position_batch points(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        double const t = static_cast<double>(i);
+        points.data<0>()[i] = std::fmod(0.7548776662466927 * t, 1.0) * 6.283185307179586;
+        points.data<1>()[i] = (std::fmod(0.6180339887498949 * t, 1.0) - 0.5) * 3.0;
+        points.data<2>()[i] = 1e16 * (1 + std::fmod(0.5 * t, 7.0));
+    }
+    return points;
+}
+
+template <typename Batch>
+bool same_points(Batch const& a, Batch const& b)
+{
+    bool same = a.size() == b.size();
+    for (std::size_t i = 0; same && i < a.size(); i++)
+    {
+        same = !(a.template data<0>()[i] < b.template data<0>()[i]) &&
+            !(a.template data<0>()[i] > b.template data<0>()[i]) &&
+            !(a.template data<1>()[i] < b.template data<1>()[i]) &&
+            !(a.template data<1>()[i] > b.template data<1>()[i]) &&
+            !(a.template data<2>()[i] < b.template data<2>()[i]) &&
+            !(a.template data<2>()[i] > b.template data<2>()[i]);
+    }
+    return same;
+}
+
+batch_execution small_ranges(std::size_t threads, bool pin = false)
+{
+    batch_execution execution(threads, pin);
+    execution.min_points_per_thread = 1000;
+    return execution;
+}
+
+BOOST_AUTO_TEST_SUITE(parallel_batches)
+
+BOOST_AUTO_TEST_CASE(ranges_of_whole_blocks)
+{
+    std::mutex lock;
+    std::vector<std::pair<std::size_t, std::size_t>> ranges;
+    boost::astronomy::detail::parallel_ranges(10000, small_ranges(4, true),
+        [&](std::size_t begin, std::size_t length) {
+            std::lock_guard<std::mutex> guard(lock);
+            ranges.emplace_back(begin, length);
+        });
+    std::sort(ranges.begin(), ranges.end());
+
+    BOOST_REQUIRE_EQUAL(ranges.size(), 4u);
+    std::size_t end = 0;
+    for (auto const& range : ranges)
+    {
+        BOOST_CHECK_EQUAL(range.first, end);
+        BOOST_CHECK_EQUAL(range.first % 256, 0u);
+        end = range.first + range.second;
+    }
+    BOOST_CHECK_EQUAL(end, 10000u);
+
+    //too few points for more threads
+    BOOST_CHECK_EQUAL(boost::astronomy::detail::execution_threads(2500, small_ranges(8)), 2u);
+    BOOST_CHECK_EQUAL(boost::astronomy::detail::execution_threads(10, small_ranges(0)), 1u);
+    BOOST_CHECK_EQUAL(boost::astronomy::detail::execution_threads(1 << 20, 3), 3u);
+
+    std::size_t calls = 0;
+    boost::astronomy::detail::parallel_ranges(0, small_ranges(4),
+        [&](std::size_t, std::size_t length) { calls += length + 1; });
+    BOOST_CHECK_EQUAL(calls, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(range_errors_reach_the_caller)
+{
+    //thrown by a worker and by the calling thread, every range still runs to the end
+    for (std::size_t failing : {std::size_t(0), std::size_t(2560)})
+    {
+        std::atomic<std::size_t> done(0);
+        BOOST_CHECK_THROW(boost::astronomy::detail::parallel_ranges(10000, small_ranges(4, true),
+            [&](std::size_t begin, std::size_t) {
+                done++;
+                if (begin == failing)
+                {
+                    throw std::runtime_error("range failed");
+                }
+            }), std::runtime_error);
+        BOOST_CHECK_EQUAL(done.load(), 4u);
+    }
+
+#if defined(__linux__)
+    //the calling thread gets its own affinity back
+    cpu_set_t before, after;
+    pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &before);
+    boost::astronomy::detail::parallel_ranges(10000, small_ranges(4, true),
+        [](std::size_t, std::size_t) {});
+    pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &after);
+    BOOST_TEST(CPU_EQUAL(&before, &after));
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(threaded_transforms_and_conversions)
+{
+    position_batch const points = make_positions(12345);
+
+    //every point gets the same result whichever thread rotates it
+    position_batch const serial = transform_batch<icrs_axes, galactic_axes>(points);
+    position_batch const threaded = transform_batch<icrs_axes, galactic_axes>(points,
+        conversion_accuracy::exact, small_ranges(4, true));
+    BOOST_TEST(same_points(serial, threaded));
+    BOOST_TEST(same_points(transform_batch<icrs_axes, galactic_axes>(points,
+        conversion_accuracy::fast), transform_batch<icrs_axes, galactic_axes>(points,
+        conversion_accuracy::fast, small_ranges(3))));
+
+    metre_batch const cartesian(points);
+    metre_batch const threaded_cartesian = cartesian.to_representation<metre_batch>(
+        conversion_accuracy::exact, small_ranges(5));
+    BOOST_TEST(same_points(cartesian, threaded_cartesian));
+    BOOST_TEST(same_points(transform_batch<galactic_axes, supergalactic_axes>(cartesian),
+        transform_batch<galactic_axes, supergalactic_axes>(cartesian, conversion_accuracy::exact,
+        small_ranges(0))));
+
+    //conversions back and forth, points of the same system are copied
+    position_batch const back = threaded_cartesian.to_representation<position_batch>(
+        conversion_accuracy::exact, small_ranges(4, true));
+    BOOST_TEST(same_points(position_batch(cartesian), back));
+    BOOST_TEST(same_points(points, points.to_representation<position_batch>(
+        conversion_accuracy::exact, small_ranges(2))));
+}
+
+BOOST_AUTO_TEST_CASE(threaded_epoch_propagation)
+{
+    position_batch serial = make_positions(9000);
+    space_motion_batch<double> serial_motions(serial.size());
+    for (std::size_t i = 0; i < serial.size(); i++)
+    {
+        serial_motions.pm_lon_coslat_data()[i] = 1e-15 * static_cast<double>(i % 101);
+        serial_motions.pm_lat_data()[i] = -2e-15 * static_cast<double>(i % 37);
+        serial_motions.radial_velocity_data()[i] = 1e4 * static_cast<double>(i % 13) - 5e4;
+    }
+    position_batch threaded = serial;
+    space_motion_batch<double> threaded_motions = serial_motions;
+
+    propagate_epoch(serial, serial_motions, 3e9);
+    propagate_epoch(threaded, threaded_motions, 3e9, small_ranges(4, true));
+    BOOST_TEST(same_points(serial, threaded));
+    BOOST_TEST(std::equal(serial_motions.pm_lat_data(), serial_motions.pm_lat_data() + serial.size(),
+        threaded_motions.pm_lat_data()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
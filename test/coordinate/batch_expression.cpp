@@ -0,0 +1,122 @@
+#define BOOST_TEST_MODULE batch_expression_test
+
+#include <cmath>
+#include <boost/test/unit_test.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/systems/si/length.hpp>
+#include <boost/units/systems/si/time.hpp>
+#include <boost/units/systems/si/velocity.hpp>
+#include <boost/units/systems/si/plane_angle.hpp>
+#include <boost/units/systems/si/prefixes.hpp>
+#include <boost/astronomy/coordinate/batch_expression.hpp>
+#include <boost/astronomy/coordinate/representation_batch.hpp>
+
+using namespace std;
+using namespace boost::astronomy::coordinate;
+using namespace boost::units::si;
+using namespace boost::units;
+
+typedef cartesian_representation_batch<double, quantity<si::length>, quantity<si::length>,
+    quantity<si::length>> metre_batch;
+typedef cartesian_representation_batch<double, quantity<si::velocity>, quantity<si::velocity>,
+    quantity<si::velocity>> velocity_batch;
+
+typedef make_scaled_unit<si::length, scale<10, static_rational<3>>>::type kilometre_unit;
+typedef cartesian_representation_batch<double, quantity<kilometre_unit>, quantity<kilometre_unit>,
+    quantity<kilometre_unit>> kilometre_batch;
+
+metre_batch make_positions(int count, double seed)
+{
+    metre_batch points;
+    for (int i = 0; i < count; i++)
+    {
+        points.push_back((seed + i) * meters, (2 * seed - 0.5 * i) * meters, (seed * i) * meters);
+    }
+    return points;
+}
+
+BOOST_AUTO_TEST_SUITE(lazy_batch_expressions)
+
+BOOST_AUTO_TEST_CASE(fused_expressions)
+{
+    metre_batch const a = make_positions(1000, 1.5);
+    metre_batch const c = make_positions(1000, -3.0);
+    velocity_batch b;
+    for (int i = 0; i < 1000; i++)
+    {
+        b.push_back((0.5 * i) * meters_per_second, -2.0 * meters_per_second,
+            (1e-3 * i) * meters_per_second);
+    }
+    quantity<si::time> const dt = 20.0 * seconds;
+
+    //velocities times a time are lengths
+    metre_batch const result = evaluate(a + b * dt - c);
+    BOOST_REQUIRE_EQUAL(result.size(), a.size());
+    for (std::size_t i = 0; i < a.size(); i++)
+    {
+        BOOST_CHECK_CLOSE(result.x_data()[i], a.x_data()[i] + b.x_data()[i] * 20 - c.x_data()[i],
+            1e-12);
+        BOOST_CHECK_CLOSE(result.y_data()[i], a.y_data()[i] + b.y_data()[i] * 20 - c.y_data()[i],
+            1e-12);
+        BOOST_CHECK_SMALL(result.z_data()[i] - (a.z_data()[i] + b.z_data()[i] * 20 - c.z_data()[i]),
+            1e-9);
+    }
+
+    //numbers keep the units, quotients by quantities divide them
+    auto const mean = evaluate((a + c) / 2.0);
+    auto const speed = evaluate(a / dt);
+    BOOST_CHECK_CLOSE(mean.x_data()[10], (a.x_data()[10] + c.x_data()[10]) / 2, 1e-12);
+    BOOST_CHECK_CLOSE(speed.get_x(10).value(), a.x_data()[10] / 20, 1e-12);
+    BOOST_TEST((std::is_same<decltype(speed.get_x(0)), quantity<si::velocity>>::value));
+    BOOST_CHECK_CLOSE(evaluate(3.0 * (a - c)).y_data()[7], 3 * (a.y_data()[7] - c.y_data()[7]), 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(units_and_systems)
+{
+    metre_batch const a = make_positions(600, 2.0);
+    kilometre_batch const km(make_positions(600, 0.25), conversion_accuracy::exact);
+
+    //the unit of the first operand is kept
+    metre_batch const in_metre = evaluate(a + km);
+    kilometre_batch const in_kilometre = evaluate(km + a);
+    for (std::size_t i = 0; i < a.size(); i++)
+    {
+        BOOST_CHECK_CLOSE(in_metre.x_data()[i], a.x_data()[i] + 1000 * km.x_data()[i], 1e-12);
+        BOOST_CHECK_CLOSE(in_kilometre.x_data()[i] * 1000, in_metre.x_data()[i], 1e-12);
+    }
+
+    //assign converts into the quantities of the batch and resizes it
+    kilometre_batch assigned(make_positions(3, 9.0));
+    assign(assigned, a - a + a);
+    BOOST_REQUIRE_EQUAL(assigned.size(), a.size());
+    BOOST_CHECK_CLOSE(assigned.z_data()[100] * 1000, a.z_data()[100], 1e-12);
+
+    //spherical batches are read as cartesian components
+    auto const spherical = make_spherical_equatorial_representation_batch(a);
+    metre_batch const twice = evaluate(spherical + a);
+    for (std::size_t i = 0; i < a.size(); i++)
+    {
+        BOOST_CHECK_SMALL(twice.x_data()[i] - 2 * a.x_data()[i], 1e-9);
+        BOOST_CHECK_SMALL(twice.y_data()[i] - 2 * a.y_data()[i], 1e-9);
+    }
+
+    //the smallest operand gives the size
+    BOOST_CHECK_EQUAL(evaluate(a + make_positions(10, 1.0)).size(), 10u);
+    BOOST_CHECK_EQUAL(evaluate(a - metre_batch()).size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(single_precision)
+{
+    metre_batch const a = make_positions(300, 0.5);
+    cartesian_representation_batch<float, quantity<si::length, float>, quantity<si::length, float>,
+        quantity<si::length, float>> const single(a);
+
+    auto const mixed = evaluate(single * 2.0f + a);
+    BOOST_TEST((std::is_same<decltype(mixed)::type, double>::value));
+    for (std::size_t i = 0; i < a.size(); i++)
+    {
+        BOOST_CHECK_CLOSE(mixed.x_data()[i], 3 * a.x_data()[i], 1e-5);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
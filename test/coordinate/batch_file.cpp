@@ -0,0 +1,229 @@
+#define BOOST_TEST_MODULE batch_file_test
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <boost/test/unit_test.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/systems/si/plane_angle.hpp>
+#include <boost/units/systems/si/length.hpp>
+#include <boost/units/systems/si/angular_velocity.hpp>
+#include <boost/units/systems/si/velocity.hpp>
+#include <boost/units/systems/angle/degrees.hpp>
+#include <boost/units/base_units/astronomical/parsec.hpp>
+#include <boost/astronomy/coordinate/batch_file.hpp>
+#include <boost/astronomy/coordinate/representation_batch.hpp>
+#include <boost/astronomy/coordinate/separation.hpp>
+#include <boost/astronomy/coordinate/kd_tree.hpp>
+#include <boost/astronomy/coordinate/cross_match.hpp>
+
+using namespace std;
+using namespace boost::astronomy::coordinate;
+using namespace boost::units::si;
+using namespace boost::units;
+namespace bud = boost::units::degree;
+namespace ba = boost::astronomy;
+
+typedef boost::units::astronomical::parsec_base_unit::unit_type parsec_unit;
+typedef spherical_equatorial_representation_batch<double, quantity<si::plane_angle>,
+    quantity<si::plane_angle>, quantity<si::length>> metre_batch;
+typedef spherical_equatorial_representation_batch<double, quantity<si::plane_angle>,
+    quantity<si::plane_angle>, quantity<parsec_unit>> parsec_batch;
+
+metre_batch make_points(int count)
+{
+    metre_batch points;
+    for (int i = 0; i < count; i++)
+    {
+        double const u = std::fmod(0.6180339887498949 * i, 1.0);
+        double const v = std::fmod(0.7548776662466927 * i, 1.0);
+        points.push_back((6.283185307179586 * v) * radians, std::asin(2 * u - 1) * radians,
+            (1e16 * (1 + i % 7)) * meters);
+    }
+    return points;
+}
+
+template <typename Pointer, typename OtherPointer>
+bool same_values(Pointer first, OtherPointer second, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; i++)
+    {
+        if (first[i] < second[i] || first[i] > second[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+struct temporary_file
+{
+    std::string path;
+
+    explicit temporary_file(std::string const& name) : path(name) {}
+
+    ~temporary_file()
+    {
+        std::remove(path.c_str());
+    }
+};
+
+BOOST_AUTO_TEST_SUITE(batch_file)
+
+BOOST_AUTO_TEST_CASE(stream_round_trip)
+{
+    metre_batch const points = make_points(1000);
+    space_motion_batch<double> motions;
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        motions.push_back((1e-15 * static_cast<double>(i)) * radians_per_second,
+            -2e-15 * radians_per_second, (100.0 + static_cast<double>(i)) * meters_per_second);
+    }
+
+    std::stringstream stream;
+    write_batch(stream, points, motions, batch_frame::icrs);
+    BOOST_CHECK_EQUAL(stream.str().size() % 64, 0u);
+
+    metre_batch read;
+    space_motion_batch<double> read_motions;
+    BOOST_TEST((read_batch(stream, read, read_motions) == batch_frame::icrs));
+    BOOST_REQUIRE_EQUAL(read.size(), points.size());
+    BOOST_TEST(same_values(read.data<0>(), points.data<0>(), points.size()));
+    BOOST_TEST(same_values(read.data<1>(), points.data<1>(), points.size()));
+    BOOST_TEST(same_values(read.data<2>(), points.data<2>(), points.size()));
+    BOOST_TEST(same_values(read_motions.pm_lon_coslat_data(), motions.pm_lon_coslat_data(),
+        points.size()));
+    BOOST_TEST(same_values(read_motions.radial_velocity_data(), motions.radial_velocity_data(),
+        points.size()));
+
+    //several batches follow each other on a stream and motions may be skipped
+    std::stringstream wire;
+    write_batch(wire, points, motions, batch_frame::galactic);
+    write_batch(wire, make_cartesian_representation_batch(points));
+    metre_batch first;
+    cartesian_representation_batch<double, quantity<si::length>, quantity<si::length>,
+        quantity<si::length>> second;
+    BOOST_TEST((read_batch(wire, first) == batch_frame::galactic));
+    BOOST_TEST((read_batch(wire, second) == batch_frame::none));
+    BOOST_CHECK_EQUAL(first.size(), points.size());
+    BOOST_CHECK_EQUAL(second.size(), points.size());
+    BOOST_CHECK_CLOSE(second.x_data()[10], make_cartesian_representation_batch(points).x_data()[10],
+        1e-12);
+
+    //empty batches
+    std::stringstream empty_stream;
+    write_batch(empty_stream, metre_batch());
+    metre_batch empty = points;
+    read_batch(empty_stream, empty);
+    BOOST_TEST(empty.empty());
+}
+
+BOOST_AUTO_TEST_CASE(units_and_mismatches)
+{
+    metre_batch const points = make_points(100);
+    std::stringstream stream;
+    write_batch(stream, points);
+    std::string const bytes = stream.str();
+
+    //distances are converted into the units of the batch read
+    std::stringstream parsec_stream(bytes);
+    parsec_batch in_parsec;
+    read_batch(parsec_stream, in_parsec);
+    double const parsec_in_metre = conversion_factor(parsec_unit(), si::meter);
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        BOOST_CHECK_CLOSE(in_parsec.data<2>()[i] * parsec_in_metre, points.data<2>()[i], 1e-12);
+    }
+
+    //other systems, coordinate types and dimensions are rejected
+    std::stringstream wrong_system(bytes);
+    spherical_representation_batch<double, quantity<si::plane_angle>, quantity<si::plane_angle>,
+        quantity<si::length>> spherical;
+    BOOST_CHECK_THROW(read_batch(wrong_system, spherical), ba::invalid_batch_file_exception);
+
+    std::stringstream wrong_type(bytes);
+    spherical_equatorial_representation_batch<float, quantity<si::plane_angle, float>,
+        quantity<si::plane_angle, float>, quantity<si::length, float>> single;
+    BOOST_CHECK_THROW(read_batch(wrong_type, single), ba::invalid_batch_file_exception);
+
+    std::stringstream wrong_dimension(bytes);
+    spherical_equatorial_representation_batch<double> dimensionless;
+    BOOST_CHECK_THROW(read_batch(wrong_dimension, dimensionless), ba::invalid_batch_file_exception);
+
+    std::stringstream no_motions(bytes);
+    metre_batch read;
+    space_motion_batch<double> motions;
+    BOOST_CHECK_THROW(read_batch(no_motions, read, motions), ba::invalid_batch_file_exception);
+
+    std::stringstream truncated(bytes.substr(0, bytes.size() - 8));
+    BOOST_CHECK_THROW(read_batch(truncated, read), ba::invalid_batch_file_exception);
+
+    std::string corrupted = bytes;
+    corrupted[0] = 'X';
+    std::stringstream corrupted_stream(corrupted);
+    BOOST_CHECK_THROW(read_batch(corrupted_stream, read), ba::invalid_batch_file_exception);
+
+    //views cannot convert units
+    std::vector<double> aligned((bytes.size() + sizeof(double) - 1) / sizeof(double));
+    std::memcpy(aligned.data(), bytes.data(), bytes.size());
+    char const* memory = reinterpret_cast<char const*>(aligned.data());
+    BOOST_CHECK_EQUAL(batch_view<metre_batch>(memory, bytes.size()).size(), points.size());
+    BOOST_CHECK_THROW(batch_view<parsec_batch>(memory, bytes.size()), ba::invalid_batch_file_exception);
+    BOOST_CHECK_THROW(batch_view<metre_batch>(memory, bytes.size() - 1),
+        ba::invalid_batch_file_exception);
+}
+
+BOOST_AUTO_TEST_CASE(mapped_files_in_place)
+{
+    temporary_file const file("batch_file_test_catalogue.bin");
+    metre_batch const catalogue = make_points(20000);
+    write_batch(file.path, catalogue, batch_frame::icrs);
+
+    mapped_batch<metre_batch> const mapped(file.path);
+    BOOST_REQUIRE_EQUAL(mapped.size(), catalogue.size());
+    BOOST_TEST((mapped.frame() == batch_frame::icrs));
+    BOOST_TEST(!mapped.has_motions());
+    BOOST_TEST(same_values(mapped.data<0>(), catalogue.data<0>(), catalogue.size()));
+    BOOST_TEST(same_values(mapped.data<2>(), catalogue.data<2>(), catalogue.size()));
+    BOOST_CHECK_EQUAL(reinterpret_cast<std::uintptr_t>(mapped.data<1>()) % 64, 0u);
+    BOOST_CHECK_CLOSE(bg::get<1>(mapped.get_point(7)), catalogue.data<1>()[7], 1e-12);
+
+    //algorithms reading batches use the mapped arrays directly
+    auto const mapped_separation = separation(mapped, catalogue);
+    for (auto const& angle : mapped_separation)
+    {
+        BOOST_CHECK_SMALL(angle.value(), 1e-7);
+    }
+
+    sky_kd_tree const tree(mapped);
+    std::vector<neighbour> const nearest = tree.batch_nearest(mapped, 1);
+    for (std::size_t i = 0; i < 100; i++)
+    {
+        BOOST_CHECK_EQUAL(nearest[i].index, i);
+    }
+
+    catalog_index const index(mapped, 1e-3);
+    BOOST_TEST(index.match_all(catalogue).size() >= catalogue.size());
+
+    metre_batch const copy = mapped.to_batch();
+    BOOST_TEST(same_values(copy.data<0>(), catalogue.data<0>(), catalogue.size()));
+}
+
+BOOST_AUTO_TEST_CASE(frame_tags)
+{
+    typedef spherical_representation<double, quantity<bud::plane_angle>,
+        quantity<bud::plane_angle>, quantity<si::length>> representation_type;
+    typedef spherical_coslat_differential<double, quantity<bud::plane_angle>,
+        quantity<bud::plane_angle>, quantity<si::velocity>> differential_type;
+
+    BOOST_TEST((batch_frame_of<icrs<representation_type, differential_type>>::value ==
+        batch_frame::icrs));
+    BOOST_TEST((batch_frame_of<galactic<representation_type, differential_type>>::value ==
+        batch_frame::galactic));
+    BOOST_TEST((batch_frame_of<heliocentric<representation_type, differential_type>>::value ==
+        batch_frame::heliocentric));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -113,6 +113,23 @@ BOOST_AUTO_TEST_CASE(cartesian_representation_copy_constructor_with_different_un
     BOOST_TEST((std::is_same<decltype(point2.get_z()), quantity<si::length>>::value));
 }
 
+BOOST_AUTO_TEST_CASE(cartesian_representation_folded_unit_conversion)
+{
+    namespace bad = boost::astronomy::detail;
+    typedef quantity<si::length> meters;
+    typedef quantity<decltype(si::kilo*meter)> kilometers;
+
+    //same units are folded to a factor of one
+    BOOST_TEST((bad::unit_scale<si::length, si::length>::identity));
+    BOOST_TEST((!bad::quantity_scale<meters, kilometers>::identity));
+
+    //folded factor gives the same result as boost::units conversion
+    kilometers distance = 2.5*si::kilo*meter;
+    BOOST_CHECK_CLOSE(bad::convert_quantity<meters>(distance).value(),
+        static_cast<meters>(distance).value(), 1e-12);
+    BOOST_CHECK_CLOSE(bad::convert_quantity<kilometers>(1500.0*meter).value(), 1.5, 1e-12);
+}
+
 BOOST_AUTO_TEST_CASE(cartesian_representation_geometry_point_constructor)
 {
     //constructing from boost::geometry::model::point
@@ -0,0 +1,165 @@
+#define BOOST_TEST_MODULE cross_match_test
+
+#include <cmath>
+#include <vector>
+#include <boost/test/unit_test.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/systems/si/plane_angle.hpp>
+#include <boost/units/systems/si/length.hpp>
+#include <boost/astronomy/coordinate/cross_match.hpp>
+#include <boost/astronomy/coordinate/representation_batch.hpp>
+
+using namespace std;
+using namespace boost::astronomy::coordinate;
+using namespace boost::units::si;
+using namespace boost::units;
+
+double const arcsecond = 4.84813681109536e-6;
+
+//points spread over the whole sky with a crowded region around both poles
+spherical_equatorial_representation_batch<double> make_catalog(int count, double seed)
+{
+    spherical_equatorial_representation_batch<double> points;
+    for (int i = 0; i < count; i++)
+    {
+        double const u = std::fmod(seed + 0.6180339887498949 * i, 1.0);
+        double const v = std::fmod(seed * 3 + 0.7548776662466927 * i, 1.0);
+        double const lat = i % 25 == 0 ? (u < 0.5 ? 1.0 : -1.0) * (1.55 + 0.02 * v) :
+            std::asin(2 * u - 1);
+        points.push_back((6.283185307179586 * v) * radians, lat * radians,
+            quantity<si::dimensionless>(1.0));
+    }
+    return points;
+}
+
+std::vector<match_pair> brute_force
+(
+    spherical_equatorial_representation_batch<double> const& first,
+    spherical_equatorial_representation_batch<double> const& second,
+    double radius
+)
+{
+    std::vector<match_pair> pairs;
+    for (std::size_t i = 0; i < first.size(); i++)
+    {
+        for (std::size_t j = 0; j < second.size(); j++)
+        {
+            double const lon1 = first.data<0>()[i], lat1 = first.data<1>()[i];
+            double const lon2 = second.data<0>()[j], lat2 = second.data<1>()[j];
+            double const cosine = std::sin(lat1) * std::sin(lat2) +
+                std::cos(lat1) * std::cos(lat2) * std::cos(lon1 - lon2);
+            double const separation = std::acos(std::max(-1.0, std::min(1.0, cosine)));
+            if (separation <= radius)
+            {
+                pairs.push_back(match_pair{i, j, separation});
+            }
+        }
+    }
+    return pairs;
+}
+
+void check_pairs(std::vector<match_pair> const& result, std::vector<match_pair> const& expected)
+{
+    BOOST_REQUIRE_EQUAL(result.size(), expected.size());
+    for (std::size_t i = 0; i < result.size(); i++)
+    {
+        BOOST_CHECK_EQUAL(result[i].first, expected[i].first);
+        BOOST_CHECK_EQUAL(result[i].second, expected[i].second);
+        BOOST_CHECK_SMALL(result[i].separation - expected[i].separation, 1e-9);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(cross_match_pairs)
+
+BOOST_AUTO_TEST_CASE(matches_brute_force)
+{
+    auto const first = make_catalog(2000, 0.1);
+    auto const second = make_catalog(2500, 0.35);
+
+    for (double radius : {0.01, 0.05, 0.3})
+    {
+        std::vector<match_pair> const expected = brute_force(first, second, radius);
+        BOOST_TEST(!expected.empty());
+        check_pairs(cross_match(first, second, radius), expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(small_radius_and_other_representations)
+{
+    //every point of second is moved by 0.8 arcseconds from the point of first
+    auto const first = make_catalog(20000, 0.2);
+    spherical_equatorial_representation_batch<double> second;
+    for (std::size_t i = 0; i < first.size(); i++)
+    {
+        double const lat = first.data<1>()[i];
+        double const shifted = lat > 0 ? lat - 0.8 * arcsecond : lat + 0.8 * arcsecond;
+        second.push_back(first.data<0>()[i] * radians, shifted * radians,
+            quantity<si::dimensionless>(2.0));
+    }
+
+    catalog_index const index(make_cartesian_representation_batch(second), arcsecond);
+    BOOST_TEST(2 * index.get_grid().max_pixel_radius() >= arcsecond);
+    BOOST_CHECK_EQUAL(index.size(), second.size());
+
+    //neighbouring points of the crowded regions may match each other as well
+    std::vector<match_pair> const pairs = index.match_all(first);
+    std::size_t shifted_pairs = 0;
+    for (match_pair const& pair : pairs)
+    {
+        BOOST_TEST(pair.separation <= arcsecond);
+        if (pair.first == pair.second)
+        {
+            BOOST_CHECK_CLOSE(pair.separation, 0.8 * arcsecond, 1e-3);
+            shifted_pairs++;
+        }
+    }
+    BOOST_CHECK_EQUAL(shifted_pairs, first.size());
+
+    BOOST_TEST(catalog_index(second, 0.5 * arcsecond).match_all(first).empty());
+}
+
+BOOST_AUTO_TEST_CASE(threads_and_streams)
+{
+    auto const first = make_catalog(70000, 0.4);
+    auto const second = make_catalog(140000, 0.7);
+    double const radius = 0.004;
+
+    catalog_index const index(second, radius, 2);
+    std::vector<match_pair> const single = catalog_index(second, radius).match_all(first);
+    std::vector<match_pair> const parallel = index.match_all(first, 4);
+    BOOST_TEST(!single.empty());
+    check_pairs(parallel, single);
+
+    //pairs of consecutive parts of the batch are streamed into the sink
+    std::size_t streamed = 0;
+    std::size_t calls = 0;
+    bool indices_in_part = true;
+    for (std::size_t begin = 0; begin < first.size(); begin += 20000)
+    {
+        std::size_t const count = std::min<std::size_t>(20000, first.size() - begin);
+        index.match(first, begin, count, [&](std::vector<match_pair> const& pairs) {
+            streamed += pairs.size();
+            calls++;
+            for (match_pair const& pair : pairs)
+            {
+                indices_in_part = indices_in_part && pair.first >= begin && pair.first < begin + count;
+            }
+        }, 3);
+    }
+    BOOST_CHECK_EQUAL(streamed, single.size());
+    BOOST_TEST(calls > 4);
+    BOOST_TEST(indices_in_part);
+}
+
+BOOST_AUTO_TEST_CASE(empty_catalogues)
+{
+    spherical_equatorial_representation_batch<double> empty;
+    auto const points = make_catalog(100, 0.5);
+    BOOST_TEST(cross_match(empty, points, 0.1).empty());
+    BOOST_TEST(cross_match(points, empty, 0.1).empty());
+
+    //a radius covering the sphere matches every pair
+    BOOST_CHECK_EQUAL(cross_match(points, points, 4.0).size(), 100u * 100u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
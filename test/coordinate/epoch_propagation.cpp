@@ -0,0 +1,234 @@
+#define BOOST_TEST_MODULE epoch_propagation_test
+
+#include <cmath>
+#include <vector>
+#include <boost/test/unit_test.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/systems/si/plane_angle.hpp>
+#include <boost/units/systems/si/length.hpp>
+#include <boost/units/systems/si/angular_velocity.hpp>
+#include <boost/units/systems/si/velocity.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/astronomy/coordinate/epoch_propagation.hpp>
+#include <boost/astronomy/coordinate/representation_batch.hpp>
+
+using namespace std;
+using namespace boost::astronomy::coordinate;
+using namespace boost::units::si;
+using namespace boost::units;
+namespace bpt = boost::posix_time;
+
+typedef spherical_equatorial_representation_batch<double, quantity<si::plane_angle>,
+    quantity<si::plane_angle>, quantity<si::length>> position_batch;
+
+double const degree_to_radian = 0.017453292519943295;
+double const julian_year = 31557600.0;
+double const mas_per_year = 4.84813681109536e-9 / julian_year; //radian per second
+double const parsec = 3.0856775814913673e16; //metre
+
+//Barnard's star and random stars with a wide range of distances and motions
+void make_stars(int count, position_batch& positions, space_motion_batch<double>& motions)
+{
+    positions.push_back(269.452 * degree_to_radian * radians, 4.6933 * degree_to_radian * radians,
+        (parsec / 0.54831) * meters);
+    motions.push_back((-801.551 * mas_per_year) * radians_per_second,
+        (10362.394 * mas_per_year) * radians_per_second, -110.51e3 * meters_per_second);
+
+    for (int i = 1; i < count; i++)
+    {
+        double const u = std::fmod(0.6180339887498949 * i, 1.0);
+        double const v = std::fmod(0.7548776662466927 * i, 1.0);
+        positions.push_back((6.283185307179586 * v) * radians, std::asin(2 * u - 1) * radians,
+            (parsec * (1 + 5000 * u * v)) * meters);
+        motions.push_back(((v - 0.5) * 2000 * mas_per_year) * radians_per_second,
+            ((u - 0.5) * 3000 * mas_per_year) * radians_per_second,
+            ((u - v) * 300e3) * meters_per_second);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(epoch_propagation)
+
+BOOST_AUTO_TEST_CASE(straight_line_motion)
+{
+    position_batch positions;
+    space_motion_batch<double> motions;
+    make_stars(2000, positions, motions);
+    position_batch const start = positions;
+    space_motion_batch<double> const start_motions = motions;
+
+    double const seconds = 100 * julian_year;
+    propagate_epoch(positions, motions, seconds);
+
+    for (std::size_t i = 0; i < positions.size(); i++)
+    {
+        //expected position from the cartesian position and velocity in long double
+        long double const lon = start.data<0>()[i], lat = start.data<1>()[i];
+        long double const d = start.data<2>()[i];
+        long double const r[3] = {std::cos(lat) * std::cos(lon), std::cos(lat) * std::sin(lon),
+            std::sin(lat)};
+        long double const east[3] = {-std::sin(lon), std::cos(lon), 0};
+        long double const north[3] = {-std::sin(lat) * std::cos(lon), -std::sin(lat) * std::sin(lon),
+            std::cos(lat)};
+        long double p[3];
+        for (int k = 0; k < 3; k++)
+        {
+            long double const velocity = d * start_motions.pm_lon_coslat_data()[i] * east[k] +
+                d * start_motions.pm_lat_data()[i] * north[k] +
+                start_motions.radial_velocity_data()[i] * r[k];
+            p[k] = d * r[k] + velocity * seconds;
+        }
+        long double const distance = std::sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+
+        double const x = std::cos(positions.data<1>()[i]) * std::cos(positions.data<0>()[i]);
+        double const y = std::cos(positions.data<1>()[i]) * std::sin(positions.data<0>()[i]);
+        double const z = std::sin(positions.data<1>()[i]);
+        BOOST_CHECK_SMALL(x - static_cast<double>(p[0] / distance), 1e-13);
+        BOOST_CHECK_SMALL(y - static_cast<double>(p[1] / distance), 1e-13);
+        BOOST_CHECK_SMALL(z - static_cast<double>(p[2] / distance), 1e-13);
+        BOOST_CHECK_CLOSE(positions.data<2>()[i], static_cast<double>(distance), 1e-10);
+        BOOST_TEST(positions.data<0>()[i] >= 0);
+    }
+
+    //Barnard's star moves about 17.3 arcminutes in a century
+    double const moved = std::hypot(
+        (positions.data<0>()[0] - start.data<0>()[0]) * std::cos(start.data<1>()[0]),
+        positions.data<1>()[0] - start.data<1>()[0]) / degree_to_radian * 60;
+    BOOST_CHECK_CLOSE(moved, 17.3, 1.0);
+    //the radial velocity grows as the star goes past the sun
+    BOOST_TEST(motions.radial_velocity_data()[0] > start_motions.radial_velocity_data()[0]);
+}
+
+BOOST_AUTO_TEST_CASE(round_trip_and_short_intervals)
+{
+    position_batch positions;
+    space_motion_batch<double> motions;
+    make_stars(3000, positions, motions);
+    position_batch const start = positions;
+    space_motion_batch<double> const start_motions = motions;
+
+    propagate_epoch(positions, motions, 50 * julian_year);
+    propagate_epoch(positions, motions, -50 * julian_year);
+    for (std::size_t i = 0; i < positions.size(); i++)
+    {
+        BOOST_CHECK_SMALL(positions.data<0>()[i] - start.data<0>()[i], 1e-12);
+        BOOST_CHECK_SMALL(positions.data<1>()[i] - start.data<1>()[i], 1e-12);
+        BOOST_CHECK_CLOSE(positions.data<2>()[i], start.data<2>()[i], 1e-10);
+        BOOST_CHECK_SMALL((motions.pm_lat_data()[i] - start_motions.pm_lat_data()[i]) / mas_per_year,
+            1e-6);
+        BOOST_CHECK_SMALL((motions.pm_lon_coslat_data()[i] - start_motions.pm_lon_coslat_data()[i]) /
+            mas_per_year, 1e-6);
+        BOOST_CHECK_SMALL(motions.radial_velocity_data()[i] - start_motions.radial_velocity_data()[i],
+            1e-6);
+    }
+
+    //over a day the positions move by the proper motions
+    double const day = 86400;
+    propagate_epoch(positions, motions, day, 1, conversion_accuracy::fast);
+    for (std::size_t i = 1; i < positions.size(); i++)
+    {
+        double const lat = start.data<1>()[i];
+        double const dlon = (positions.data<0>()[i] - start.data<0>()[i]) * std::cos(lat);
+        double const dlat = positions.data<1>()[i] - start.data<1>()[i];
+        BOOST_CHECK_SMALL(dlon - start_motions.pm_lon_coslat_data()[i] * day, 1e-14);
+        BOOST_CHECK_SMALL(dlat - start_motions.pm_lat_data()[i] * day, 1e-14);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(distant_and_resting_points)
+{
+    position_batch positions;
+    space_motion_batch<double> motions;
+    positions.push_back(1.0 * radians, 0.5 * radians, 0.0 * meters);
+    motions.push_back((1e-10) * radians_per_second, 0.0 * radians_per_second,
+        1e5 * meters_per_second);
+    positions.push_back(2.0 * radians, -0.3 * radians, (10 * parsec) * meters);
+    motions.push_back(0.0 * radians_per_second, 0.0 * radians_per_second, 0.0 * meters_per_second);
+    positions.push_back(4.0 * radians, 0.2 * radians, (10 * parsec) * meters);
+    motions.push_back(0.0 * radians_per_second, 0.0 * radians_per_second, 3e4 * meters_per_second);
+
+    double const seconds = 1000 * julian_year;
+    propagate_epoch(positions, motions, seconds);
+
+    //without distance the point follows its proper motion along a great circle
+    double const sin_lat = std::sin(positions.data<1>()[0]), cos_lat = std::cos(positions.data<1>()[0]);
+    double const cos_moved = std::sin(0.5) * sin_lat +
+        std::cos(0.5) * cos_lat * std::cos(positions.data<0>()[0] - 1.0);
+    BOOST_CHECK_CLOSE(std::acos(cos_moved), std::atan(1e-10 * seconds), 1e-8);
+    BOOST_TEST(positions.data<0>()[0] > 1.0);
+    BOOST_CHECK_EQUAL(positions.data<2>()[0], 0.0);
+    BOOST_CHECK_EQUAL(motions.radial_velocity_data()[0], 1e5);
+
+    BOOST_CHECK_CLOSE(positions.data<0>()[1], 2.0, 1e-12);
+    BOOST_CHECK_CLOSE(positions.data<1>()[1], -0.3, 1e-12);
+    BOOST_CHECK_CLOSE(positions.data<2>()[1], 10 * parsec, 1e-12);
+
+    //moving straight away keeps the direction
+    BOOST_CHECK_CLOSE(positions.data<0>()[2], 4.0, 1e-12);
+    BOOST_CHECK_CLOSE(positions.data<1>()[2], 0.2, 1e-12);
+    BOOST_CHECK_CLOSE(positions.data<2>()[2], 10 * parsec + 3e4 * seconds, 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(threads_epochs_and_parts)
+{
+    position_batch positions;
+    space_motion_batch<double> motions;
+    make_stars(200000, positions, motions);
+    position_batch threaded = positions;
+    space_motion_batch<double> threaded_motions = motions;
+    position_batch streamed = positions;
+    space_motion_batch<double> streamed_motions = motions;
+
+    bpt::ptime const from = bpt::time_from_string("2016-01-01 00:00:00");
+    bpt::ptime const to = bpt::time_from_string("2025-06-15 12:00:00");
+    double const seconds = static_cast<double>((to - from).total_seconds());
+
+    propagate_epoch(positions, motions, from, to);
+    propagate_epoch(threaded, threaded_motions, seconds, 4);
+    for (std::size_t begin = 0; begin < streamed.size(); begin += 70000)
+    {
+        propagate_epoch(streamed, streamed_motions, begin,
+            std::min<std::size_t>(70000, streamed.size() - begin), seconds);
+    }
+
+    bool same = true;
+    for (std::size_t i = 0; i < positions.size(); i++)
+    {
+        same = same && !(positions.data<0>()[i] < threaded.data<0>()[i]) &&
+            !(positions.data<0>()[i] > threaded.data<0>()[i]) &&
+            !(positions.data<1>()[i] < streamed.data<1>()[i]) &&
+            !(positions.data<1>()[i] > streamed.data<1>()[i]) &&
+            !(motions.pm_lat_data()[i] < threaded_motions.pm_lat_data()[i]) &&
+            !(motions.pm_lat_data()[i] > threaded_motions.pm_lat_data()[i]);
+    }
+    BOOST_TEST(same);
+}
+
+BOOST_AUTO_TEST_CASE(single_precision_batches)
+{
+    position_batch positions;
+    space_motion_batch<double> motions;
+    make_stars(1000, positions, motions);
+
+    spherical_equatorial_representation_batch<float, quantity<si::plane_angle, float>,
+        quantity<si::plane_angle, float>, quantity<si::length, float>> float_positions(positions);
+    space_motion_batch<float> float_motions;
+    for (std::size_t i = 0; i < motions.size(); i++)
+    {
+        float_motions.push_back(
+            static_cast<float>(motions.pm_lon_coslat_data()[i]) * radians_per_second,
+            static_cast<float>(motions.pm_lat_data()[i]) * radians_per_second,
+            static_cast<float>(motions.radial_velocity_data()[i]) * meters_per_second);
+    }
+
+    propagate_epoch(positions, motions, 20 * julian_year);
+    propagate_epoch(float_positions, float_motions, 20 * julian_year);
+    for (std::size_t i = 0; i < positions.size(); i++)
+    {
+        BOOST_CHECK_SMALL(std::remainder(static_cast<double>(float_positions.data<0>()[i]) -
+            positions.data<0>()[i], 6.283185307179586), 1e-5);
+        BOOST_CHECK_SMALL(static_cast<double>(float_positions.data<1>()[i]) -
+            positions.data<1>()[i], 1e-6);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,146 @@
+#define BOOST_TEST_MODULE frame_transform_test
+
+#include <cmath>
+#include <boost/test/unit_test.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/systems/si/plane_angle.hpp>
+#include <boost/units/systems/si/length.hpp>
+#include <boost/units/systems/angle/degrees.hpp>
+#include <boost/astronomy/coordinate/frame_transform.hpp>
+#include <boost/astronomy/coordinate/geocentric.hpp>
+#include <boost/astronomy/coordinate/representation_batch.hpp>
+
+using namespace std;
+using namespace boost::astronomy::coordinate;
+using namespace boost::units::si;
+using namespace boost::units;
+namespace bud = boost::units::degree;
+
+typedef spherical_representation<double, quantity<bud::plane_angle>, quantity<bud::plane_angle>,
+    quantity<si::length>> representation_type;
+typedef spherical_coslat_differential<double, quantity<bud::plane_angle>,
+    quantity<bud::plane_angle>, quantity<si::length>> differential_type;
+
+typedef icrs<representation_type, differential_type> icrs_type;
+typedef galactic<representation_type, differential_type> galactic_type;
+typedef supergalactic<representation_type, differential_type> supergalactic_type;
+typedef geocentric<representation_type, differential_type> geocentric_type;
+
+BOOST_AUTO_TEST_SUITE(frame_transform_matrices)
+
+BOOST_AUTO_TEST_CASE(composite_rotations_are_orthonormal)
+{
+    constexpr rotation_matrix rotation = frame_rotation<ecliptic_axes, supergalactic_axes>::value;
+    rotation_matrix const product = multiply(rotation, transpose(rotation));
+    for (std::size_t row = 0; row < 3; row++)
+    {
+        for (std::size_t column = 0; column < 3; column++)
+        {
+            BOOST_CHECK_SMALL(product(row, column) - (row == column ? 1.0 : 0.0), 1e-12);
+        }
+    }
+
+    //frames map to the axes they are expressed in
+    BOOST_TEST((std::is_same<frame_axes<geocentric_type>::type, ecliptic_axes>::value));
+    BOOST_TEST((std::is_same<frame_axes<icrs_type>::type, icrs_axes>::value));
+}
+
+BOOST_AUTO_TEST_CASE(constant_poles_and_identities)
+{
+    double const degree = 0.017453292519943295;
+    constexpr rotation_matrix to_galactic = galactic_axes::from_icrs();
+    double const ra = galactic_axes::pole_ra() * degree, dec = galactic_axes::pole_dec() * degree;
+    double const pole_z = to_galactic(2, 0) * std::cos(dec) * std::cos(ra) +
+        to_galactic(2, 1) * std::cos(dec) * std::sin(ra) + to_galactic(2, 2) * std::sin(dec);
+    BOOST_CHECK_CLOSE(pole_z, 1.0, 1e-9);
+    //the north celestial pole is the third column of the matrix
+    BOOST_CHECK_CLOSE(std::atan2(to_galactic(1, 2), to_galactic(0, 2)) / degree,
+        galactic_axes::celestial_pole_l(), 1e-5);
+
+    galactic_type pole(supergalactic_axes::pole_b() * bud::degrees,
+        supergalactic_axes::pole_l() * bud::degrees, 1.0 * meters);
+    BOOST_CHECK_CLOSE(transform_frame<supergalactic_type>(pole).get_sgb().value(), 90.0, 1e-6);
+    BOOST_CHECK_CLOSE(std::acos(ecliptic_axes::from_icrs()(1, 1)) / degree * 3600,
+        ecliptic_axes::obliquity(), 1e-6);
+
+    //frames sharing their axes are not rotated
+    static_assert(frame_rotation<geocentric_type, ecliptic_axes>::identity, "same axes");
+    static_assert(!frame_rotation<icrs_type, galactic_type>::identity, "other axes");
+    icrs_type const point(-12.5 * bud::degrees, -30.0 * bud::degrees, 4.0 * meters);
+    auto const same = transform_frame<icrs_type>(point);
+    BOOST_CHECK_CLOSE(same.get_ra().value(), 330.0, 1e-10);
+    BOOST_CHECK_CLOSE(same.get_dec().value(), -12.5, 1e-10);
+    BOOST_CHECK_CLOSE(same.get_distance().value(), 4.0, 1e-12);
+
+    cartesian_representation_batch<double> batch;
+    batch.push_back(quantity<si::dimensionless>(0.25), quantity<si::dimensionless>(-1.5),
+        quantity<si::dimensionless>(3.0));
+    auto const copied = transform_batch<galactic_type, galactic_axes>(batch);
+    BOOST_CHECK_EQUAL(copied.y_data()[0], -1.5);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(frame_transform_points)
+
+BOOST_AUTO_TEST_CASE(icrs_to_galactic)
+{
+    //north galactic pole and galactic center of Hipparcos
+    icrs_type pole(27.12825 * bud::degrees, 192.85948 * bud::degrees, 10.0 * meters);
+    auto galactic_pole = transform_frame<galactic_type>(pole);
+    BOOST_CHECK_CLOSE(galactic_pole.get_b().value(), 90.0, 1e-4);
+    BOOST_CHECK_CLOSE(galactic_pole.get_distance().value(), 10.0, 1e-10);
+
+    icrs_type center(-28.936175 * bud::degrees, 266.404996 * bud::degrees, 1.0 * meters);
+    auto galactic_center = transform_frame<galactic_type>(center);
+    BOOST_CHECK_SMALL(galactic_center.get_b().value(), 1e-4);
+    BOOST_CHECK_SMALL(std::remainder(galactic_center.get_l().value(), 360.0), 1e-4);
+
+    auto back = transform_frame<icrs_type>(galactic_center);
+    BOOST_CHECK_CLOSE(back.get_dec().value(), -28.936175, 1e-8);
+    BOOST_CHECK_CLOSE(back.get_ra().value(), 266.404996, 1e-8);
+}
+
+BOOST_AUTO_TEST_CASE(supergalactic_and_ecliptic)
+{
+    galactic_type pole(6.32 * bud::degrees, 47.37 * bud::degrees, 1.0 * meters);
+    auto supergalactic_pole = transform_frame<supergalactic_type>(pole);
+    BOOST_CHECK_CLOSE(supergalactic_pole.get_sgb().value(), 90.0, 1e-6);
+
+    //north ecliptic pole lies at ra = 270 degree, dec = 90 - obliquity
+    icrs_type ecliptic_pole(66.5607205556 * bud::degrees, 270.0 * bud::degrees, 1.0 * meters);
+    auto ecliptic = transform_frame<geocentric_type>(ecliptic_pole);
+    BOOST_CHECK_CLOSE(ecliptic.get_lat().value(), 90.0, 1e-5);
+}
+
+BOOST_AUTO_TEST_CASE(batch_matches_points)
+{
+    cartesian_representation_batch<double, quantity<si::length>, quantity<si::length>,
+        quantity<si::length>> batch;
+    for (int i = 0; i < 700; i++)
+    {
+        batch.push_back((i % 9 - 4.0) * meter, (i % 5 - 2.5) * meter, (i % 7 - 3.0) * meter);
+    }
+
+    auto rotated = transform_batch<icrs_axes, galactic_axes>(batch);
+    rotation_matrix const& rotation = frame_rotation<icrs_type, galactic_type>::value;
+    for (std::size_t i = 0; i < batch.size(); i++)
+    {
+        double const x = batch.x_data()[i], y = batch.y_data()[i], z = batch.z_data()[i];
+        BOOST_CHECK_SMALL(rotated.y_data()[i] -
+            (rotation(1, 0) * x + rotation(1, 1) * y + rotation(1, 2) * z), 1e-12);
+    }
+
+    //rotating spherical equatorial batch gives the same directions
+    auto equatorial = make_spherical_equatorial_representation_batch(batch);
+    auto rotated_equatorial = transform_batch<icrs_axes, galactic_axes>(equatorial,
+        conversion_accuracy::fast);
+    auto rotated_back = make_cartesian_representation_batch(rotated_equatorial);
+    for (std::size_t i = 0; i < batch.size(); i++)
+    {
+        BOOST_CHECK_SMALL(rotated_back.x_data()[i] - rotated.x_data()[i], 1e-10);
+        BOOST_CHECK_SMALL(rotated_back.z_data()[i] - rotated.z_data()[i], 1e-10);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,328 @@
+#define BOOST_TEST_MODULE healpix_test
+
+#include <cmath>
+#include <set>
+#include <vector>
+#include <boost/test/unit_test.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/systems/si/plane_angle.hpp>
+#include <boost/units/systems/si/length.hpp>
+#include <boost/units/systems/angle/degrees.hpp>
+#include <boost/astronomy/coordinate/healpix.hpp>
+#include <boost/astronomy/coordinate/representation_batch.hpp>
+#include <boost/astronomy/coordinate/icrs.hpp>
+
+using namespace std;
+using namespace boost::astronomy::coordinate;
+using namespace boost::units::si;
+using namespace boost::units;
+namespace bud = boost::units::degree;
+
+typedef spherical_representation<double, quantity<bud::plane_angle>, quantity<bud::plane_angle>,
+    quantity<si::length>> representation_type;
+typedef spherical_coslat_differential<double, quantity<bud::plane_angle>,
+    quantity<bud::plane_angle>, quantity<si::length>> differential_type;
+typedef icrs<representation_type, differential_type> icrs_type;
+
+double const degree_to_radian = 0.017453292519943295;
+
+//angle between two directions given by longitude and latitude
+double separation(double lon1, double lat1, double lon2, double lat2)
+{
+    double const cosine = std::sin(lat1) * std::sin(lat2) +
+        std::cos(lat1) * std::cos(lat2) * std::cos(lon1 - lon2);
+    return std::acos(std::max(-1.0, std::min(1.0, cosine)));
+}
+
+std::set<std::int64_t> range_pixels(std::vector<pixel_range> const& ranges)
+{
+    std::set<std::int64_t> pixels;
+    for (std::size_t i = 0; i < ranges.size(); i++)
+    {
+        BOOST_TEST(ranges[i].first < ranges[i].last);
+        if (i > 0)
+        {
+            //ranges are sorted and never touch each other
+            BOOST_TEST(ranges[i - 1].last < ranges[i].first);
+        }
+        for (std::int64_t pixel = ranges[i].first; pixel < ranges[i].last; pixel++)
+        {
+            pixels.insert(pixel);
+        }
+    }
+    return pixels;
+}
+
+BOOST_AUTO_TEST_SUITE(healpix_numbering)
+
+BOOST_AUTO_TEST_CASE(base_pixels)
+{
+    healpix grid(0);
+    BOOST_CHECK_EQUAL(grid.pixels(), 12);
+
+    double lon, lat;
+    grid.pixel_center(0, healpix_scheme::nested, lon, lat);
+    BOOST_CHECK_CLOSE(lon, 0.7853981633974483, 1e-10);
+    BOOST_CHECK_CLOSE(lat, std::asin(2.0 / 3.0), 1e-10);
+
+    grid.pixel_center(4, healpix_scheme::nested, lon, lat);
+    BOOST_CHECK_SMALL(lon, 1e-12);
+    BOOST_CHECK_SMALL(lat, 1e-12);
+
+    //the base pixels have the same numbers in both schemes
+    for (std::int64_t pixel = 0; pixel < 12; pixel++)
+    {
+        BOOST_CHECK_EQUAL(grid.nested_to_ring(pixel), pixel);
+    }
+
+    healpix fine(29);
+    BOOST_CHECK_EQUAL(fine.nside(), std::int64_t(1) << 29);
+    BOOST_CHECK_EQUAL(fine.pixels(), 12 * (std::int64_t(1) << 58));
+}
+
+BOOST_AUTO_TEST_CASE(centers_and_schemes_agree)
+{
+    for (int order : {1, 2, 4})
+    {
+        healpix grid(order);
+        std::set<std::int64_t> ring_numbers;
+        double previous_lat = 2;
+        for (std::int64_t pixel = 0; pixel < grid.pixels(); pixel++)
+        {
+            std::int64_t const ring = grid.nested_to_ring(pixel);
+            ring_numbers.insert(ring);
+            BOOST_CHECK_EQUAL(grid.ring_to_nested(ring), pixel);
+
+            double lon, lat;
+            grid.pixel_center(pixel, healpix_scheme::nested, lon, lat);
+            BOOST_CHECK_EQUAL(grid.pixel(lon, lat, healpix_scheme::nested), pixel);
+            BOOST_CHECK_EQUAL(grid.pixel(lon, lat, healpix_scheme::ring), ring);
+
+            //rings are numbered from north to south
+            grid.pixel_center(pixel, healpix_scheme::ring, lon, lat);
+            BOOST_CHECK(lat <= previous_lat + 1e-12);
+            previous_lat = lat;
+        }
+        BOOST_CHECK_EQUAL(static_cast<std::int64_t>(ring_numbers.size()), grid.pixels());
+    }
+
+    //centers of some pixels of the finest grid
+    healpix grid(29);
+    for (std::int64_t pixel = 0; pixel < grid.pixels(); pixel += grid.pixels() / 997)
+    {
+        double lon, lat;
+        grid.pixel_center(pixel, healpix_scheme::nested, lon, lat);
+        BOOST_CHECK_EQUAL(grid.pixel(lon, lat, healpix_scheme::nested), pixel);
+        BOOST_CHECK_EQUAL(grid.ring_to_nested(grid.nested_to_ring(pixel)), pixel);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(pixels_have_equal_area)
+{
+    healpix grid(2);
+    std::vector<int> counts(static_cast<std::size_t>(grid.pixels()));
+    std::size_t const points = 192000;
+    for (std::size_t i = 0; i < points; i++)
+    {
+        //uniform points on the sphere from a Fibonacci lattice
+        double const z = 1 - (2 * static_cast<double>(i) + 1) / static_cast<double>(points);
+        double const lon = std::fmod(2.399963229728653 * static_cast<double>(i), 6.283185307179586);
+        counts[static_cast<std::size_t>(grid.pixel(lon, std::asin(z), healpix_scheme::ring))]++;
+    }
+    for (int count : counts)
+    {
+        BOOST_CHECK(count > 950 && count < 1050);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(frames_and_sky_points)
+{
+    healpix grid(10);
+    icrs_type star(-28.936175 * bud::degrees, 266.404996 * bud::degrees, 1.0 * meters);
+    std::int64_t const expected = grid.pixel(266.404996 * degree_to_radian,
+        -28.936175 * degree_to_radian, healpix_scheme::nested);
+    BOOST_CHECK_EQUAL(grid.pixel(star, healpix_scheme::nested), expected);
+    BOOST_CHECK_EQUAL(grid.pixel(sky_point<icrs_type>(star), healpix_scheme::nested), expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(healpix_batches)
+
+BOOST_AUTO_TEST_CASE(batch_pixels_match_points)
+{
+    healpix grid(12);
+    spherical_equatorial_representation_batch<double> points;
+    for (int i = 0; i < 5000; i++)
+    {
+        double const lon = std::fmod(0.731 * i, 6.283185307179586) - 3.0;
+        double const lat = std::asin(1 - (2 * i + 1) / 5000.0);
+        points.push_back(lon * radians, lat * radians, quantity<si::dimensionless>(1.0 + i % 3));
+    }
+
+    auto const cartesian = make_cartesian_representation_batch(points);
+    auto const spherical = make_spherical_representation_batch(points);
+    std::vector<std::int64_t> const nested = grid.batch_pixels(points, healpix_scheme::nested);
+    std::vector<std::int64_t> const ring = grid.batch_pixels(cartesian, healpix_scheme::ring);
+    std::vector<std::int64_t> const from_spherical = grid.batch_pixels(spherical,
+        healpix_scheme::nested);
+    std::vector<std::int64_t> const fast = grid.batch_pixels(points, healpix_scheme::nested,
+        conversion_accuracy::fast);
+
+    std::size_t differences = 0;
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        double const lon = points.data<0>()[i];
+        double const lat = points.data<1>()[i];
+        BOOST_CHECK_EQUAL(nested[i], grid.pixel(lon, lat, healpix_scheme::nested));
+        BOOST_CHECK_EQUAL(grid.ring_to_nested(ring[i]), nested[i]);
+        differences += from_spherical[i] != nested[i];
+        differences += fast[i] != nested[i];
+    }
+    //only points lying on pixel boundaries may change pixel with rounding
+    BOOST_CHECK(differences < 5);
+}
+
+BOOST_AUTO_TEST_CASE(parallel_and_streamed_indexing)
+{
+    healpix grid(8);
+    cartesian_representation_batch<float, quantity<si::length, float>, quantity<si::length, float>,
+        quantity<si::length, float>> points;
+    for (int i = 0; i < 300000; i++)
+    {
+        points.push_back(std::cos(0.37f * static_cast<float>(i)) * meter,
+            std::sin(0.11f * static_cast<float>(i)) * meter, static_cast<float>(i % 7 - 3) * meter);
+    }
+
+    std::vector<std::int64_t> const single = grid.batch_pixels(points, healpix_scheme::ring);
+    std::vector<std::int64_t> const parallel = grid.batch_pixels(points, healpix_scheme::ring,
+        conversion_accuracy::exact, 4);
+    BOOST_TEST(single == parallel);
+
+    //indexing the batch in consecutive parts gives the same pixels
+    std::vector<std::int64_t> streamed(points.size());
+    for (std::size_t begin = 0; begin < points.size(); begin += 70000)
+    {
+        std::size_t const count = std::min<std::size_t>(70000, points.size() - begin);
+        grid.batch_pixels(points, begin, count, healpix_scheme::ring, streamed.data() + begin);
+    }
+    BOOST_TEST(single == streamed);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(healpix_queries)
+
+BOOST_AUTO_TEST_CASE(cone_query)
+{
+    healpix grid(5);
+    double const cones[][3] = {{0.3, 0.5, 0.2}, {6.2, -0.1, 0.05}, {1.0, 1.5, 0.3},
+        {2.0, -1.45, 0.25}, {4.0, 0.0, 1.7}};
+    for (auto const& cone : cones)
+    {
+        std::set<std::int64_t> expected_nested, expected_ring;
+        for (std::int64_t pixel = 0; pixel < grid.pixels(); pixel++)
+        {
+            double lon, lat;
+            grid.pixel_center(pixel, healpix_scheme::nested, lon, lat);
+            if (separation(lon, lat, cone[0], cone[1]) <= cone[2])
+            {
+                expected_nested.insert(pixel);
+                expected_ring.insert(grid.nested_to_ring(pixel));
+            }
+        }
+
+        BOOST_TEST(range_pixels(grid.query_cone(cone[0], cone[1], cone[2],
+            healpix_scheme::nested, false)) == expected_nested);
+        BOOST_TEST(range_pixels(grid.query_cone(cone[0], cone[1], cone[2],
+            healpix_scheme::ring, false)) == expected_ring);
+
+        //inclusive queries add only pixels close to the border of the cone
+        for (healpix_scheme scheme : {healpix_scheme::nested, healpix_scheme::ring})
+        {
+            std::set<std::int64_t> const inclusive = range_pixels(grid.query_cone(cone[0], cone[1],
+                cone[2], scheme));
+            std::set<std::int64_t> const& inner =
+                scheme == healpix_scheme::nested ? expected_nested : expected_ring;
+            BOOST_TEST(std::includes(inclusive.begin(), inclusive.end(), inner.begin(), inner.end()));
+            for (std::int64_t pixel : inclusive)
+            {
+                double lon, lat;
+                grid.pixel_center(pixel, scheme, lon, lat);
+                BOOST_CHECK(separation(lon, lat, cone[0], cone[1]) <=
+                    cone[2] + 2 * grid.max_pixel_radius());
+            }
+        }
+    }
+
+    BOOST_CHECK_EQUAL(grid.query_cone(1.0, 0.0, 4.0, healpix_scheme::ring).front().last,
+        grid.pixels());
+    BOOST_TEST(grid.query_cone(1.0, 0.0, -1.0, healpix_scheme::ring, false).empty());
+}
+
+BOOST_AUTO_TEST_CASE(polygon_query)
+{
+    healpix grid(6);
+    spherical_equatorial_representation_batch<double> vertices;
+    double const corners[][2] = {{0.2, -0.3}, {0.9, -0.25}, {1.0, 0.4}, {0.3, 0.5}};
+    for (auto const& corner : corners)
+    {
+        vertices.push_back(corner[0] * radians, corner[1] * radians, quantity<si::dimensionless>(1.0));
+    }
+
+    //inner side of a great circle through a and b is where the triple product is positive
+    auto inside = [&](double lon, double lat) {
+        double const v[3] = {std::cos(lat) * std::cos(lon), std::cos(lat) * std::sin(lon), std::sin(lat)};
+        for (int i = 0; i < 4; i++)
+        {
+            double const* a = corners[i];
+            double const* b = corners[(i + 1) % 4];
+            double const va[3] = {std::cos(a[1]) * std::cos(a[0]), std::cos(a[1]) * std::sin(a[0]),
+                std::sin(a[1])};
+            double const vb[3] = {std::cos(b[1]) * std::cos(b[0]), std::cos(b[1]) * std::sin(b[0]),
+                std::sin(b[1])};
+            double const n[3] = {va[1] * vb[2] - va[2] * vb[1], va[2] * vb[0] - va[0] * vb[2],
+                va[0] * vb[1] - va[1] * vb[0]};
+            if (n[0] * v[0] + n[1] * v[1] + n[2] * v[2] < 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    std::set<std::int64_t> expected_nested, expected_ring;
+    for (std::int64_t pixel = 0; pixel < grid.pixels(); pixel++)
+    {
+        double lon, lat;
+        grid.pixel_center(pixel, healpix_scheme::nested, lon, lat);
+        if (inside(lon, lat))
+        {
+            expected_nested.insert(pixel);
+            expected_ring.insert(grid.nested_to_ring(pixel));
+        }
+    }
+    BOOST_TEST(!expected_nested.empty());
+    BOOST_TEST(range_pixels(grid.query_polygon(vertices, healpix_scheme::nested, false)) ==
+        expected_nested);
+    BOOST_TEST(range_pixels(grid.query_polygon(vertices, healpix_scheme::ring, false)) ==
+        expected_ring);
+
+    std::set<std::int64_t> const inclusive = range_pixels(grid.query_polygon(vertices,
+        healpix_scheme::nested));
+    BOOST_TEST(std::includes(inclusive.begin(), inclusive.end(), expected_nested.begin(),
+        expected_nested.end()));
+    BOOST_TEST(inclusive.size() < expected_nested.size() * 2);
+
+    //vertices in the opposite order give the same pixels
+    spherical_equatorial_representation_batch<double> reversed;
+    for (int i = 3; i >= 0; i--)
+    {
+        reversed.push_back(corners[i][0] * radians, corners[i][1] * radians,
+            quantity<si::dimensionless>(1.0));
+    }
+    BOOST_TEST(range_pixels(grid.query_polygon(reversed, healpix_scheme::nested, false)) ==
+        expected_nested);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,190 @@
+#define BOOST_TEST_MODULE offload_device_test
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <stdexcept>
+#include <boost/test/unit_test.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/systems/si/plane_angle.hpp>
+#include <boost/units/systems/si/length.hpp>
+#include <boost/astronomy/coordinate/frame_transform.hpp>
+#include <boost/astronomy/coordinate/representation_batch.hpp>
+#include <boost/astronomy/host_offload_device.hpp>
+#include <boost/astronomy/io/image.hpp>
+
+using namespace std;
+using namespace boost::astronomy::coordinate;
+using boost::astronomy::offload_device;
+using boost::astronomy::host_offload_device;
+using namespace boost::units::si;
+using namespace boost::units;
+
+typedef spherical_equatorial_representation_batch<double, quantity<si::plane_angle>,
+    quantity<si::plane_angle>, quantity<si::length>> position_batch;
+typedef cartesian_representation_batch<double, quantity<si::length>, quantity<si::length>,
+    quantity<si::length>> metre_batch;
+typedef cartesian_representation_batch<float, quantity<si::length, float>,
+    quantity<si::length, float>, quantity<si::length, float>> float_metre_batch;
+
+position_batch make_positions(std::size_t count)
+{
+    position_batch points(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        double const t = static_cast<double>(i);
+        points.data<0>()[i] = std::fmod(0.7548776662466927 * t, 1.0) * 6.283185307179586;
+        points.data<1>()[i] = (std::fmod(0.6180339887498949 * t, 1.0) - 0.5) * 3.0;
+        points.data<2>()[i] = 1e16 * (1 + std::fmod(0.5 * t, 7.0));
+    }
+    return points;
+}
+
+template <typename Batch>
+bool same_points(Batch const& a, Batch const& b)
+{
+    bool same = a.size() == b.size();
+    for (std::size_t i = 0; same && i < a.size(); i++)
+    {
+        same = !(a.template data<0>()[i] < b.template data<0>()[i]) &&
+            !(a.template data<0>()[i] > b.template data<0>()[i]) &&
+            !(a.template data<1>()[i] < b.template data<1>()[i]) &&
+            !(a.template data<1>()[i] > b.template data<1>()[i]) &&
+            !(a.template data<2>()[i] < b.template data<2>()[i]) &&
+            !(a.template data<2>()[i] > b.template data<2>()[i]);
+    }
+    return same;
+}
+
+//! execution offloading every batch to device
+batch_execution on_device(offload_device& device)
+{
+    batch_execution execution;
+    execution.device = &device;
+    execution.min_offload_points = 1;
+    return execution;
+}
+
+//! host device whose n-th synchronize fails as a lost device would
+struct failing_device : public host_offload_device
+{
+    std::size_t calls = 0;
+    std::size_t failing_call;
+
+    failing_device(std::size_t failing) : host_offload_device(2, 3 * 8 * 1000),
+        failing_call(failing) {}
+
+    void synchronize(std::size_t stream)
+    {
+        host_offload_device::synchronize(stream);
+        if (++calls == failing_call)
+        {
+            throw std::runtime_error("device lost");
+        }
+    }
+};
+
+//! image of a single row holding values
+template <typename PixelType>
+struct row_image : public boost::astronomy::io::image_buffer<PixelType>
+{
+    explicit row_image(std::vector<PixelType> const& values)
+        : boost::astronomy::io::image_buffer<PixelType>(values.size(), 1)
+    {
+        std::copy(values.begin(), values.end(), std::begin(this->data));
+    }
+};
+
+BOOST_AUTO_TEST_SUITE(offload)
+
+BOOST_AUTO_TEST_CASE(transforms_match_cpu_over_streams)
+{
+    //chunks of 1000 points alternate over the 2 streams
+    host_offload_device device(2, 3 * sizeof(double) * 1000);
+    position_batch const points = make_positions(9500);
+    rotation_matrix const rotation = frame_rotation<icrs_axes, galactic_axes>::value;
+
+    for (conversion_accuracy accuracy : {conversion_accuracy::exact, conversion_accuracy::fast})
+    {
+        BOOST_TEST(same_points(transform_batch(rotation, points, accuracy, on_device(device)),
+            transform_batch(rotation, points, accuracy)));
+    }
+    BOOST_TEST(device.chunks(0) == 10u);
+    BOOST_TEST(device.chunks(1) == 10u);
+
+    metre_batch const cartesian = points.to_representation<metre_batch>(
+        conversion_accuracy::exact, on_device(device));
+    BOOST_TEST(same_points(cartesian, points.to_representation<metre_batch>()));
+    BOOST_TEST(same_points(transform_batch(rotation, cartesian, conversion_accuracy::exact,
+        on_device(device)), transform_batch(rotation, cartesian)));
+    BOOST_TEST(device.chunks(0) + device.chunks(1) == 40u);
+}
+
+BOOST_AUTO_TEST_CASE(cpu_paths_without_device)
+{
+    host_offload_device device(2, 3 * sizeof(double) * 1000);
+    position_batch const points = make_positions(5000);
+
+    //below the threshold of the execution
+    batch_execution execution = on_device(device);
+    execution.min_offload_points = 10000;
+    transform_batch<icrs_axes, galactic_axes>(points, conversion_accuracy::exact, execution);
+
+    //conversions between coordinate types
+    metre_batch const cartesian = points.to_representation<metre_batch>();
+    float_metre_batch const narrowed = cartesian.to_representation<float_metre_batch>(
+        conversion_accuracy::exact, on_device(device));
+    BOOST_TEST(narrowed.size() == cartesian.size());
+    BOOST_TEST(device.chunks(0) + device.chunks(1) == 0u);
+
+    //the default execution has no device
+    BOOST_TEST(batch_execution().device == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(device_errors_reach_the_caller)
+{
+    position_batch const points = make_positions(9500);
+    rotation_matrix const rotation = frame_rotation<icrs_axes, galactic_axes>::value;
+    failing_device device(4);
+    BOOST_CHECK_THROW(transform_batch(rotation, points, conversion_accuracy::exact,
+        on_device(device)), std::runtime_error);
+
+    //all the streams were drained, the device can be used again
+    BOOST_TEST(same_points(transform_batch(rotation, points, conversion_accuracy::exact,
+        on_device(device)), transform_batch(rotation, points)));
+}
+
+BOOST_AUTO_TEST_CASE(image_statistics_on_device)
+{
+    std::vector<float> values(100000);
+    for (std::size_t i = 0; i < values.size(); i++)
+    {
+        values[i] = 1e4f + static_cast<float>((i * 7919) % 1000) / 10.0f;
+    }
+    values[777] = std::numeric_limits<float>::quiet_NaN();
+    row_image<float> const frame(values);
+
+    host_offload_device device(3, 4096 * sizeof(float));
+    boost::astronomy::io::image_statistics const expected = frame.statistics(1);
+    boost::astronomy::io::image_statistics const stats = frame.statistics(device);
+    BOOST_TEST(stats.count == expected.count);
+    BOOST_TEST(stats.min == expected.min);
+    BOOST_TEST(stats.max == expected.max);
+    BOOST_TEST(stats.mean == expected.mean, boost::test_tools::tolerance(1e-12));
+    BOOST_TEST(stats.variance() == expected.variance(), boost::test_tools::tolerance(1e-9));
+    BOOST_TEST(device.chunks(0) + device.chunks(1) + device.chunks(2) == 25u);
+
+    std::vector<std::int16_t> counts(30000);
+    for (std::size_t i = 0; i < counts.size(); i++)
+    {
+        counts[i] = static_cast<std::int16_t>((i * 31) % 20000 - 10000);
+    }
+    row_image<std::int16_t> const counts_frame(counts);
+    boost::astronomy::io::image_statistics const counts_stats = counts_frame.statistics(device);
+    BOOST_TEST(counts_stats.count == counts.size());
+    BOOST_TEST(counts_stats.mean == counts_frame.statistics(1).mean,
+        boost::test_tools::tolerance(1e-12));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
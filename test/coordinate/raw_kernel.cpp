@@ -0,0 +1,87 @@
+#define BOOST_TEST_MODULE raw_kernel_test
+#define BOOST_ASTRONOMY_CHECK_RAW_KERNELS
+
+#include <boost/test/unit_test.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/systems/si/length.hpp>
+#include <boost/units/systems/si/time.hpp>
+#include <boost/units/systems/si/velocity.hpp>
+#include <boost/units/systems/si/plane_angle.hpp>
+#include <boost/units/systems/si/prefixes.hpp>
+#include <boost/astronomy/coordinate/raw_kernel.hpp>
+#include <boost/astronomy/coordinate/representation_batch.hpp>
+
+using namespace std;
+using namespace boost::astronomy::coordinate;
+using namespace boost::units::si;
+using namespace boost::units;
+
+typedef cartesian_representation_batch<double, quantity<si::length>, quantity<si::length>,
+    quantity<si::length>> metre_batch;
+typedef make_scaled_unit<si::velocity, scale<10, static_rational<3>>>::type kilometre_per_second;
+typedef cartesian_representation_batch<float, quantity<kilometre_per_second, float>,
+    quantity<kilometre_per_second, float>, quantity<kilometre_per_second, float>> velocity_batch;
+
+BOOST_AUTO_TEST_SUITE(raw_kernels)
+
+BOOST_AUTO_TEST_CASE(components_and_units)
+{
+    metre_batch points;
+    for (int i = 0; i < 100; i++)
+    {
+        points.push_back((1.0 * i) * meters, 2.0 * meters, (-0.5 * i) * meters);
+    }
+
+    raw_components<double> const raw = expect_units<si::length>(points);
+    BOOST_CHECK_EQUAL(raw.size(), points.size());
+    BOOST_TEST(raw.component1 == points.x_data());
+    BOOST_TEST(raw.valid());
+    BOOST_TEST(raw.has_units<si::length>());
+    BOOST_TEST(!raw.has_units<si::time>());
+
+    raw_scale(raw, 3.0);
+    BOOST_CHECK_CLOSE(points.x_data()[10], 30.0, 1e-12);
+    BOOST_CHECK_CLOSE(points.z_data()[10], -15.0, 1e-12);
+
+    //angles of other batches are stored in radian
+    auto const spherical = make_spherical_representation_batch(points);
+    auto const angles = make_raw_components(spherical);
+    BOOST_TEST((std::is_same<decltype(angles), raw_components<double const> const>::value));
+    BOOST_TEST((angles.has_units<si::plane_angle, si::plane_angle, si::length>()));
+
+    //resizing the batch leaves the components dangling
+    points.resize(5000);
+    BOOST_TEST(!raw.valid());
+    BOOST_TEST(make_raw_components(points).valid());
+}
+
+BOOST_AUTO_TEST_CASE(scaled_rates)
+{
+    metre_batch positions;
+    velocity_batch velocities;
+    for (int i = 0; i < 1000; i++)
+    {
+        positions.push_back((1e3 * i) * meters, 0.0 * meters, 1e6 * meters);
+        velocities.push_back(quantity<kilometre_per_second, float>::from_value(0.5f),
+            quantity<kilometre_per_second, float>::from_value(static_cast<float>(i)),
+            quantity<kilometre_per_second, float>::from_value(-1.0f));
+    }
+
+    //kilometres per second times seconds are added in metres
+    add_scaled(positions, velocities, 60.0 * seconds);
+    for (std::size_t i = 0; i < positions.size(); i++)
+    {
+        BOOST_CHECK_CLOSE(positions.x_data()[i], 1e3 * static_cast<double>(i) + 0.5 * 60e3, 1e-12);
+        BOOST_CHECK_CLOSE(positions.y_data()[i] + 1, static_cast<double>(i) * 60e3 + 1, 1e-12);
+        BOOST_CHECK_CLOSE(positions.z_data()[i], 1e6 - 60e3, 1e-12);
+    }
+
+    //the raw kernel stops at the smaller batch
+    metre_batch few;
+    few.push_back(1.0 * meters, 1.0 * meters, 1.0 * meters);
+    raw_add_scaled(make_raw_components(few), make_raw_components(positions), 2.0);
+    BOOST_CHECK_CLOSE(few.x_data()[0], 1 + 2 * positions.x_data()[0], 1e-12);
+    BOOST_CHECK_EQUAL(few.size(), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
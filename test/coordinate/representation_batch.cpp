@@ -0,0 +1,226 @@
+#define BOOST_TEST_MODULE representation_batch_test
+
+#include <cmath>
+#include <vector>
+#include <boost/test/unit_test.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/systems/si/plane_angle.hpp>
+#include <boost/units/systems/si/prefixes.hpp>
+#include <boost/units/systems/si/length.hpp>
+#include <boost/units/systems/angle/degrees.hpp>
+#include <boost/astronomy/coordinate/representation.hpp>
+#include <boost/astronomy/coordinate/representation_batch.hpp>
+#include <boost/astronomy/coordinate/arithmetic.hpp>
+
+using namespace std;
+using namespace boost::astronomy::coordinate;
+using namespace boost::units::si;
+using namespace boost::units;
+namespace bud = boost::units::degree;
+
+typedef decltype(si::kilo * meters) kilo_length_t;
+
+typedef cartesian_representation_batch<double, quantity<si::length>, quantity<si::length>,
+    quantity<si::length>> cartesian_batch;
+
+BOOST_AUTO_TEST_SUITE(representation_batch_storage)
+
+BOOST_AUTO_TEST_CASE(cartesian_batch_components)
+{
+    cartesian_batch batch;
+    batch.push_back(1.0 * meter, 2.0 * meter, 3.0 * meter);
+    batch.push_back(4.0 * meter, 5.0 * meter, 6.0 * meter);
+
+    BOOST_TEST(batch.size() == 2u);
+    BOOST_CHECK_CLOSE(batch.get_y(1).value(), 5.0, 0.001);
+    BOOST_CHECK_CLOSE(batch.x_data()[1], 4.0, 0.001);
+    BOOST_CHECK_CLOSE(batch.z_data()[0], 3.0, 0.001);
+
+    //element access returns the single point type
+    auto point = batch[0];
+    BOOST_TEST((std::is_same<decltype(point), cartesian_batch::value_type>::value));
+    BOOST_CHECK_CLOSE(point.get_z().value(), 3.0, 0.001);
+
+    batch.set_x_y_z(0, 7.0 * meter, 8.0 * meter, 9.0 * meter);
+    BOOST_CHECK_CLOSE(batch.get_x(0).value(), 7.0, 0.001);
+}
+
+BOOST_AUTO_TEST_CASE(spherical_batch_stores_radian)
+{
+    spherical_representation_batch<double, quantity<bud::plane_angle>,
+        quantity<bud::plane_angle>, quantity<si::length>> batch;
+    batch.push_back(90.0 * bud::degrees, 45.0 * bud::degrees, 2.0 * meter);
+
+    BOOST_CHECK_CLOSE(batch.lat_data()[0], 1.5707963267948966, 0.001);
+    BOOST_CHECK_CLOSE(batch.get_lon(0).value(), 45.0, 0.001);
+    BOOST_CHECK_CLOSE(batch[0].get_lat().value(), 90.0, 0.001);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(representation_batch_conversion)
+
+BOOST_AUTO_TEST_CASE(cartesian_batch_unit_conversion)
+{
+    cartesian_representation_batch<double, quantity<si::length>, quantity<si::length>,
+        quantity<si::length>> batch;
+    batch.push_back(1500.0 * meter, 20.0 * meter, 3.0 * meter);
+
+    auto converted = make_cartesian_representation_batch<double, quantity<kilo_length_t>,
+        quantity<kilo_length_t>, quantity<kilo_length_t>>(batch);
+    BOOST_CHECK_CLOSE(converted.get_x(0).value(), 1.5, 0.001);
+    BOOST_CHECK_CLOSE(converted.get_y(0).value(), 0.02, 0.001);
+    BOOST_CHECK_CLOSE(converted.z_data()[0], 0.003, 0.001);
+}
+
+BOOST_AUTO_TEST_CASE(batch_matches_single_points)
+{
+    std::vector<cartesian_batch::value_type> points;
+    for (int i = 0; i < 600; i++)
+    {
+        points.push_back(make_cartesian_representation((i % 7 - 3.0) * meter,
+            (i % 11 - 5.0) * meter, (i % 5 - 2.0) * meter));
+    }
+    cartesian_batch batch(points);
+
+    auto spherical = make_spherical_representation_batch(batch);
+    auto equatorial = make_spherical_equatorial_representation_batch(batch);
+    BOOST_TEST(spherical.size() == points.size());
+
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        auto expected = make_spherical_representation(points[i]);
+        BOOST_CHECK_CLOSE(spherical.get_dist(i).value(), expected.get_dist().value(), 0.001);
+        if (expected.get_dist().value() > 0)
+        {
+            BOOST_CHECK_CLOSE(spherical.get_lat(i).value() + 1, expected.get_lat().value() + 1, 0.001);
+            BOOST_CHECK_CLOSE(spherical.get_lon(i).value() + 4, expected.get_lon().value() + 4, 0.001);
+
+            auto expected_equatorial = make_spherical_equatorial_representation(points[i]);
+            BOOST_CHECK_CLOSE(equatorial.get_lat(i).value() + 2,
+                expected_equatorial.get_lat().value() + 2, 0.001);
+        }
+    }
+
+    //converting back returns the original points
+    auto back = make_cartesian_representation_batch(equatorial);
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        BOOST_CHECK_CLOSE(back.get_x(i).value() + 10, points[i].get_x().value() + 10, 0.001);
+        BOOST_CHECK_CLOSE(back.get_y(i).value() + 10, points[i].get_y().value() + 10, 0.001);
+        BOOST_CHECK_CLOSE(back.get_z(i).value() + 10, points[i].get_z().value() + 10, 0.001);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(batch_to_representation)
+{
+    cartesian_batch batch;
+    batch.push_back(0.0 * meter, 0.0 * meter, 5.0 * meter);
+
+    auto spherical = batch.to_representation<spherical_representation_batch<double,
+        quantity<si::plane_angle>, quantity<si::plane_angle>, quantity<si::length>>>();
+    BOOST_CHECK_CLOSE(spherical.get_dist(0).value(), 5.0, 0.001);
+    BOOST_CHECK_SMALL(spherical.get_lat(0).value(), 0.001);
+
+    auto equatorial = spherical.to_representation<spherical_equatorial_representation_batch
+        <double, quantity<si::plane_angle>, quantity<si::plane_angle>, quantity<si::length>>>();
+    BOOST_CHECK_CLOSE(equatorial.get_lon(0).value(), 1.5707963267948966, 0.001);
+
+    auto cartesian = equatorial.to_representation<cartesian_batch>();
+    BOOST_CHECK_CLOSE(cartesian.get_z(0).value(), 5.0, 0.001);
+    BOOST_CHECK_SMALL(cartesian.get_x(0).value(), 0.001);
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_conversion_accuracy)
+{
+    cartesian_batch batch;
+    for (int i = 0; i < 2000; i++)
+    {
+        double const t = i * 0.7853;
+        batch.push_back(std::cos(t) * (i % 13 - 6.0) * meter, std::sin(3 * t) * (i % 7 + 1.0) * meter,
+            (i % 17 - 8.0) * meter);
+    }
+
+    auto exact = make_spherical_equatorial_representation_batch(batch);
+    auto fast = make_spherical_equatorial_representation_batch(batch, conversion_accuracy::fast);
+    auto coarse = make_spherical_equatorial_representation_batch(batch, conversion_accuracy::coarse);
+    for (std::size_t i = 0; i < batch.size(); i++)
+    {
+        BOOST_CHECK_SMALL(fast.lat_data()[i] - exact.lat_data()[i], 1e-14);
+        BOOST_CHECK_SMALL(fast.lon_data()[i] - exact.lon_data()[i], 1e-14);
+        BOOST_CHECK_SMALL(coarse.lat_data()[i] - exact.lat_data()[i], 1e-6);
+        BOOST_CHECK_SMALL(coarse.lon_data()[i] - exact.lon_data()[i], 1e-6);
+    }
+
+    auto back_exact = exact.to_representation<cartesian_batch>();
+    auto back_fast = exact.to_representation<cartesian_batch>(conversion_accuracy::fast);
+    auto spherical_fast = fast.to_representation<spherical_representation_batch<double,
+        quantity<si::plane_angle>, quantity<si::plane_angle>, quantity<si::length>>>(
+        conversion_accuracy::fast);
+    auto spherical_exact = make_spherical_representation_batch(exact);
+    for (std::size_t i = 0; i < batch.size(); i++)
+    {
+        BOOST_CHECK_SMALL(back_fast.x_data()[i] - back_exact.x_data()[i], 1e-12);
+        BOOST_CHECK_SMALL(back_fast.y_data()[i] - back_exact.y_data()[i], 1e-12);
+        BOOST_CHECK_SMALL(back_fast.z_data()[i] - back_exact.z_data()[i], 1e-12);
+        BOOST_CHECK_SMALL(spherical_fast.lon_data()[i] - spherical_exact.lon_data()[i], 1e-12);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(representation_batch_arithmetic)
+
+BOOST_AUTO_TEST_CASE(cartesian_batch_matches_single_points)
+{
+    typedef cartesian_representation_batch<double, quantity<si::length>, quantity<kilo_length_t>,
+        quantity<si::length>> mixed_batch;
+    mixed_batch batch1;
+    cartesian_batch batch2;
+    for (int i = 0; i < 300; i++)
+    {
+        batch1.push_back((i % 7 - 3.0) * meter, (i % 3 + 1.0) * si::kilo * meters,
+            (i % 5 - 2.0) * meter);
+        batch2.push_back((i % 11 - 5.0) * meter, 4.0 * meter, (i % 13 + 0.5) * meter);
+    }
+
+    auto dots = dot(batch1, batch2);
+    auto crosses = cross(batch1, batch2);
+    auto magnitudes = magnitude(batch1);
+    auto units = unit_vector(batch1);
+    BOOST_TEST((std::is_same<decltype(dots[0]), decltype(dot(batch1[0], batch2[0]))&>::value));
+    BOOST_TEST((std::is_same<decltype(magnitudes[0]), quantity<si::length>&>::value));
+
+    for (std::size_t i = 0; i < batch1.size(); i++)
+    {
+        BOOST_CHECK_CLOSE(dots[i].value(), dot(batch1[i], batch2[i]).value(), 1e-10);
+        BOOST_CHECK_CLOSE(magnitudes[i].value(), magnitude(batch1[i]).value(), 1e-10);
+
+        auto expected = cross(batch1[i], batch2[i]);
+        BOOST_CHECK_CLOSE(crosses.get_x(i).value() + 1e4, expected.get_x().value() + 1e4, 1e-10);
+        BOOST_CHECK_CLOSE(crosses.get_y(i).value() + 1e4, expected.get_y().value() + 1e4, 1e-10);
+        BOOST_CHECK_CLOSE(crosses.get_z(i).value() + 1e4, expected.get_z().value() + 1e4, 1e-10);
+
+        auto unit = unit_vector(batch1[i]);
+        BOOST_CHECK_CLOSE(units.get_x(i).value() + 2, unit.get_x().value() + 2, 1e-10);
+        BOOST_CHECK_CLOSE(units.get_y(i).value() + 2, unit.get_y().value() + 2, 1e-10);
+        BOOST_CHECK_CLOSE(units.get_z(i).value() + 2, unit.get_z().value() + 2, 1e-10);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(spherical_batch_arithmetic)
+{
+    spherical_representation_batch<double, quantity<bud::plane_angle>,
+        quantity<bud::plane_angle>, quantity<si::length>> spherical;
+    cartesian_batch cartesian;
+    spherical.push_back(30.0 * bud::degrees, 60.0 * bud::degrees, 2.0 * meter);
+    cartesian.push_back(1.0 * meter, 2.0 * meter, 3.0 * meter);
+
+    auto dots = dot(spherical, cartesian);
+    BOOST_CHECK_CLOSE(dots[0].value(), dot(spherical[0], cartesian[0]).value(), 1e-10);
+    BOOST_CHECK_CLOSE(magnitude(spherical)[0].value(), 2.0, 1e-10);
+    BOOST_CHECK_CLOSE(unit_vector(spherical).get_dist(0).value(), 1.0, 1e-10);
+    BOOST_CHECK_CLOSE(unit_vector(spherical).get_lon(0).value(), 60.0, 1e-10);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,219 @@
+#define BOOST_TEST_MODULE separation_test
+
+#include <cmath>
+#include <vector>
+#include <boost/test/unit_test.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/systems/si/plane_angle.hpp>
+#include <boost/units/systems/si/length.hpp>
+#include <boost/units/systems/angle/degrees.hpp>
+#include <boost/astronomy/coordinate/separation.hpp>
+#include <boost/astronomy/coordinate/kd_tree.hpp>
+#include <boost/astronomy/coordinate/representation_batch.hpp>
+#include <boost/astronomy/coordinate/representation.hpp>
+#include <boost/astronomy/coordinate/icrs.hpp>
+
+using namespace std;
+using namespace boost::astronomy::coordinate;
+using namespace boost::units::si;
+using namespace boost::units;
+namespace bud = boost::units::degree;
+
+typedef spherical_representation<double, quantity<bud::plane_angle>, quantity<bud::plane_angle>,
+    quantity<si::length>> representation_type;
+typedef spherical_coslat_differential<double, quantity<bud::plane_angle>,
+    quantity<bud::plane_angle>, quantity<si::length>> differential_type;
+typedef icrs<representation_type, differential_type> icrs_type;
+
+double const degree_to_radian = 0.017453292519943295;
+
+//separation computed in long double with the Vincenty formula
+double reference_separation(double lon1, double lat1, double lon2, double lat2)
+{
+    long double const phi1 = lat1, phi2 = lat2;
+    long double const dlon = static_cast<long double>(lon2) - lon1;
+    long double const a = std::cos(phi2) * std::sin(dlon);
+    long double const b = std::cos(phi1) * std::sin(phi2) -
+        std::sin(phi1) * std::cos(phi2) * std::cos(dlon);
+    return static_cast<double>(std::atan2(std::sqrt(a * a + b * b),
+        std::sin(phi1) * std::sin(phi2) + std::cos(phi1) * std::cos(phi2) * std::cos(dlon)));
+}
+
+spherical_equatorial_representation_batch<double> make_points(int count, double seed)
+{
+    spherical_equatorial_representation_batch<double> points;
+    for (int i = 0; i < count; i++)
+    {
+        double const u = std::fmod(seed + 0.6180339887498949 * i, 1.0);
+        double const v = std::fmod(seed * 3 + 0.7548776662466927 * i, 1.0);
+        points.push_back((6.283185307179586 * v - 3.0) * radians, std::asin(2 * u - 1) * radians,
+            quantity<si::dimensionless>(1.0 + i % 4));
+    }
+    return points;
+}
+
+BOOST_AUTO_TEST_SUITE(batch_separation)
+
+BOOST_AUTO_TEST_CASE(equatorial_batches)
+{
+    auto const first = make_points(3000, 0.1);
+    auto second = make_points(3000, 0.6);
+
+    //nearly coincident and nearly antipodal pairs
+    for (std::size_t i = 0; i < 100; i++)
+    {
+        double const lon = first.data<0>()[i], lat = first.data<1>()[i];
+        second.data<0>()[i] = i % 2 == 0 ? lon + 1e-9 : lon + 3.141592653589793;
+        second.data<1>()[i] = i % 2 == 0 ? lat - 2e-9 : -lat + 1e-8;
+    }
+
+    auto const exact = separation(first, second);
+    auto const fast = separation(first, second, conversion_accuracy::fast);
+    BOOST_REQUIRE_EQUAL(exact.size(), first.size());
+    for (std::size_t i = 0; i < first.size(); i++)
+    {
+        double const expected = reference_separation(first.data<0>()[i], first.data<1>()[i],
+            second.data<0>()[i], second.data<1>()[i]);
+        BOOST_CHECK_SMALL(exact[i].value() - expected, 1e-15 + 1e-14 * expected);
+        BOOST_CHECK_SMALL(fast[i].value() - expected, 1e-14);
+    }
+
+    auto const cartesian = make_cartesian_representation_batch(second);
+    auto const mixed = separation(first, cartesian);
+    auto const spherical = separation(make_spherical_representation_batch(first), cartesian);
+    for (std::size_t i = 0; i < first.size(); i++)
+    {
+        BOOST_CHECK_SMALL(mixed[i].value() - exact[i].value(), 1e-14);
+        BOOST_CHECK_SMALL(spherical[i].value() - exact[i].value(), 1e-14);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(float_batches)
+{
+    auto const first = make_points(1000, 0.2);
+    auto const second = make_points(1000, 0.8);
+    spherical_equatorial_representation_batch<float, quantity<si::plane_angle, float>,
+        quantity<si::plane_angle, float>, quantity<si::dimensionless, float>> first_float(first),
+        second_float(second);
+
+    auto const exact = separation(first, second);
+    auto const single = separation(first_float, second_float, conversion_accuracy::fast);
+    for (std::size_t i = 0; i < first.size(); i++)
+    {
+        BOOST_CHECK_SMALL(static_cast<double>(single[i].value()) - exact[i].value(), 2e-6);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(to_single_point)
+{
+    auto const points = make_points(2000, 0.3);
+    spherical_equatorial_representation<double, quantity<bud::plane_angle>,
+        quantity<bud::plane_angle>> const target(12.5 * bud::degrees, 40.0 * bud::degrees,
+        quantity<si::dimensionless>(1.0));
+
+    for (conversion_accuracy accuracy : {conversion_accuracy::exact, conversion_accuracy::fast})
+    {
+        auto const result = separation(points, target, accuracy);
+        BOOST_REQUIRE_EQUAL(result.size(), points.size());
+        for (std::size_t i = 0; i < points.size(); i++)
+        {
+            //like component 0 of batches the first component is the longitude of boost::geometry
+            double const expected = reference_separation(points.data<0>()[i], points.data<1>()[i],
+                12.5 * degree_to_radian, 40.0 * degree_to_radian);
+            BOOST_CHECK_SMALL(result[i].value() - expected, 1e-13);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sky_point_collections)
+{
+    std::vector<sky_point<icrs_type>> first, second;
+    for (int i = 0; i < 50; i++)
+    {
+        first.push_back(icrs_type((-80.0 + 3.1 * i) * bud::degrees, (7.3 * i) * bud::degrees,
+            1.0 * meters));
+        second.push_back(icrs_type((-79.0 + 3.0 * i) * bud::degrees, (7.3 * i + 0.5) * bud::degrees,
+            2.0 * meters));
+    }
+
+    auto const result = separation(first, second);
+    BOOST_REQUIRE_EQUAL(result.size(), first.size());
+    for (int i = 0; i < 50; i++)
+    {
+        double const expected = reference_separation((7.3 * i) * degree_to_radian,
+            (-80.0 + 3.1 * i) * degree_to_radian, (7.3 * i + 0.5) * degree_to_radian,
+            (-79.0 + 3.0 * i) * degree_to_radian);
+        BOOST_CHECK_SMALL(result[static_cast<std::size_t>(i)].value() - expected, 1e-13);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(nearest_neighbours)
+
+BOOST_AUTO_TEST_CASE(matches_brute_force)
+{
+    auto const catalogue = make_points(5000, 0.45);
+    sky_kd_tree const tree(make_cartesian_representation_batch(catalogue));
+    BOOST_CHECK_EQUAL(tree.size(), catalogue.size());
+
+    auto const queries = make_points(300, 0.9);
+    std::size_t const k = 5;
+    std::vector<neighbour> const found = tree.batch_nearest(queries, k);
+    BOOST_REQUIRE_EQUAL(found.size(), queries.size() * k);
+
+    for (std::size_t i = 0; i < queries.size(); i++)
+    {
+        std::vector<std::pair<double, std::size_t>> all;
+        for (std::size_t j = 0; j < catalogue.size(); j++)
+        {
+            all.emplace_back(reference_separation(queries.data<0>()[i], queries.data<1>()[i],
+                catalogue.data<0>()[j], catalogue.data<1>()[j]), j);
+        }
+        std::partial_sort(all.begin(), all.begin() + k, all.end());
+        for (std::size_t n = 0; n < k; n++)
+        {
+            BOOST_CHECK_EQUAL(found[i * k + n].index, all[n].second);
+            BOOST_CHECK_SMALL(found[i * k + n].separation - all[n].first, 1e-12);
+        }
+
+        std::vector<neighbour> const single = tree.nearest(queries.data<0>()[i],
+            queries.data<1>()[i], k);
+        BOOST_REQUIRE_EQUAL(single.size(), k);
+        BOOST_CHECK_EQUAL(single.front().index, all.front().second);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(threads_and_small_trees)
+{
+    auto const catalogue = make_points(20000, 0.15);
+    sky_kd_tree const tree(catalogue);
+    auto const queries = make_points(20000, 0.55);
+
+    std::vector<neighbour> const single = tree.batch_nearest(queries, 3);
+    std::vector<neighbour> const parallel = tree.batch_nearest(queries, 3, 4);
+    BOOST_REQUIRE_EQUAL(single.size(), parallel.size());
+    for (std::size_t i = 0; i < single.size(); i++)
+    {
+        BOOST_CHECK_EQUAL(single[i].index, parallel[i].index);
+    }
+
+    //a point of the catalogue is its own nearest neighbour
+    std::vector<neighbour> const self = tree.batch_nearest(catalogue, 1);
+    for (std::size_t i = 0; i < catalogue.size(); i++)
+    {
+        BOOST_CHECK_EQUAL(self[i].index, i);
+        BOOST_CHECK_SMALL(self[i].separation, 1e-7);
+    }
+
+    auto const few = make_points(3, 0.25);
+    sky_kd_tree const small(few);
+    BOOST_CHECK_EQUAL(small.nearest(0.0, 0.0, 10).size(), 3u);
+    BOOST_CHECK_EQUAL(small.batch_nearest(queries, 10).size(), queries.size() * 3);
+    BOOST_TEST(small.nearest(0.0, 0.0, 0).empty());
+
+    spherical_equatorial_representation_batch<double> empty;
+    BOOST_TEST(sky_kd_tree(empty).nearest(1.0, 1.0, 4).empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,191 @@
+#define BOOST_TEST_MODULE single_precision_test
+
+#include <cmath>
+#include <vector>
+#include <boost/test/unit_test.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/systems/si/plane_angle.hpp>
+#include <boost/units/systems/si/length.hpp>
+#include <boost/units/systems/angle/degrees.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/astronomy/coordinate/representation.hpp>
+#include <boost/astronomy/coordinate/representation_batch.hpp>
+#include <boost/astronomy/coordinate/arithmetic.hpp>
+#include <boost/astronomy/coordinate/frame_transform.hpp>
+#include <boost/astronomy/coordinate/time_transform.hpp>
+
+using namespace std;
+using namespace boost::astronomy::coordinate;
+using namespace boost::units::si;
+using namespace boost::units;
+namespace bud = boost::units::degree;
+namespace bpt = boost::posix_time;
+namespace bad = boost::astronomy::detail;
+
+typedef cartesian_representation_batch<float, quantity<si::length, float>,
+    quantity<si::length, float>, quantity<si::length, float>> float_cartesian_batch;
+typedef cartesian_representation_batch<double, quantity<si::length>, quantity<si::length>,
+    quantity<si::length>> double_cartesian_batch;
+
+//a float resolves about 6e-8 radian (12 milliarcsecond) on the unit sphere
+double const float_angle = 3e-7;
+
+double_cartesian_batch sample_points()
+{
+    double_cartesian_batch points;
+    for (int i = 0; i < 1000; i++)
+    {
+        double const t = i * 0.6173;
+        points.push_back(std::cos(t) * (i % 13 - 6.5) * meter, std::sin(2 * t) * (i % 7 + 1.0) * meter,
+            (i % 17 - 8.0) * meter);
+    }
+    return points;
+}
+
+BOOST_AUTO_TEST_SUITE(single_precision_kernels)
+
+BOOST_AUTO_TEST_CASE(float_trigonometry_accuracy)
+{
+    double sin_error = 0, atan_error = 0;
+    for (int i = -20000; i <= 20000; i++)
+    {
+        float const angle = static_cast<float>(i) * 1e-3f;
+        float sine, cosine;
+        bad::polynomial_trigonometry::sincos(angle, sine, cosine);
+        sin_error = std::max(sin_error, std::abs(sine - std::sin(static_cast<double>(angle))));
+        sin_error = std::max(sin_error, std::abs(cosine - std::cos(static_cast<double>(angle))));
+
+        float const y = std::sin(angle), x = std::cos(3 * angle);
+        atan_error = std::max(atan_error, std::abs(bad::coarse_polynomial_trigonometry::atan2(y, x) -
+            std::atan2(static_cast<double>(y), static_cast<double>(x))));
+    }
+    BOOST_CHECK_SMALL(sin_error, 3e-7);
+    BOOST_CHECK_SMALL(atan_error, 5e-7);
+}
+
+BOOST_AUTO_TEST_CASE(float_batch_conversion_matches_double)
+{
+    double_cartesian_batch const points = sample_points();
+    float_cartesian_batch const single_points = make_cartesian_representation_batch<float,
+        quantity<si::length, float>, quantity<si::length, float>, quantity<si::length, float>>(points);
+
+    auto const reference = make_spherical_equatorial_representation_batch(points);
+    conversion_accuracy const accuracies[] = {conversion_accuracy::exact,
+        conversion_accuracy::fast, conversion_accuracy::coarse};
+    for (conversion_accuracy accuracy : accuracies)
+    {
+        auto const equatorial = make_spherical_equatorial_representation_batch(single_points, accuracy);
+        BOOST_TEST((std::is_same<decltype(equatorial.lat_data()), float const*>::value));
+
+        auto const back = make_cartesian_representation_batch(equatorial, accuracy);
+        for (std::size_t i = 0; i < points.size(); i++)
+        {
+            double const distance = reference.dist_data()[i];
+            BOOST_CHECK_SMALL(equatorial.dist_data()[i] - distance, distance * float_angle);
+            BOOST_CHECK_SMALL(equatorial.lat_data()[i] - reference.lat_data()[i], float_angle);
+            BOOST_CHECK_SMALL(std::remainder(equatorial.lon_data()[i] - reference.lon_data()[i],
+                6.283185307179586), float_angle * 10 / std::max(distance, 0.1));
+            BOOST_CHECK_SMALL(back.x_data()[i] - points.x_data()[i], distance * float_angle * 2);
+            BOOST_CHECK_SMALL(back.z_data()[i] - points.z_data()[i], distance * float_angle * 2);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(mixed_precision_conversion)
+{
+    double_cartesian_batch const points = sample_points();
+
+    //double cartesian points are converted in double and rounded once into float angles
+    spherical_equatorial_representation_batch<float> const single_equatorial(points);
+    auto const reference = make_spherical_equatorial_representation_batch(points);
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        BOOST_CHECK_SMALL(single_equatorial.lat_data()[i] -
+            static_cast<float>(reference.lat_data()[i]), 1e-30f);
+    }
+
+    //and back into double points
+    double_cartesian_batch const back(single_equatorial);
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        double const distance = reference.dist_data()[i];
+        BOOST_CHECK_SMALL(back.y_data()[i] - points.y_data()[i], distance * float_angle);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(single_precision_pipelines)
+
+BOOST_AUTO_TEST_CASE(float_arithmetic_keeps_wide_differences)
+{
+    //nearly parallel unit vectors 1e-5 radian apart
+    float_cartesian_batch first, second;
+    double_cartesian_batch first_double, second_double;
+    for (int i = 0; i < 300; i++)
+    {
+        float const angle = static_cast<float>(i) * 0.02f;
+        float const other = angle + 1e-5f;
+        first.push_back(std::cos(angle) * meter, std::sin(angle) * meter, 0.0f * meter);
+        second.push_back(std::cos(other) * meter, std::sin(other) * meter, 0.0f * meter);
+        first_double.push_back(static_cast<double>(first.x_data()[i]) * meter,
+            static_cast<double>(first.y_data()[i]) * meter, 0.0 * meter);
+        second_double.push_back(static_cast<double>(second.x_data()[i]) * meter,
+            static_cast<double>(second.y_data()[i]) * meter, 0.0 * meter);
+    }
+
+    auto const products = cross(first, second);
+    auto const reference = cross(first_double, second_double);
+    auto const magnitudes = magnitude(first);
+    auto const units = unit_vector(second);
+    for (std::size_t i = 0; i < first.size(); i++)
+    {
+        BOOST_CHECK_CLOSE(static_cast<double>(products.z_data()[i]), reference.z_data()[i], 1e-4);
+        BOOST_CHECK_SMALL(magnitudes[i].value() - 1.0f, 3e-7f);
+        BOOST_CHECK_SMALL(units.x_data()[i] - second.x_data()[i], 3e-7f);
+    }
+
+    //single points of float keep float quantities
+    auto const point = make_spherical_representation(first[1]);
+    BOOST_TEST((std::is_same<decltype(point.get_dist()), quantity<si::length, float>>::value));
+    BOOST_CHECK_SMALL(static_cast<double>(dot(first[1], second[1]).value()) - 1.0, 1e-6);
+}
+
+BOOST_AUTO_TEST_CASE(float_transforms_match_double)
+{
+    double const degree_to_radian = 0.017453292519943295;
+    spherical_equatorial_representation_batch<double> points;
+    for (int i = 0; i < 300; i++)
+    {
+        //float angles above 2 pi would be rounded to about 5e-7 radian
+        points.push_back(std::fmod(1.7 * i, 360.0) * degree_to_radian * radians,
+            (-80.0 + 0.5 * i) * degree_to_radian * radians, quantity<si::dimensionless>(1.0));
+    }
+    spherical_equatorial_representation_batch<float> const single_points(points);
+
+    auto const galactic = transform_batch<icrs_axes, galactic_axes>(points);
+    auto const single_galactic = transform_batch<icrs_axes, galactic_axes>(single_points,
+        conversion_accuracy::fast);
+
+    time_transform_cache cache;
+    bpt::ptime const time = bpt::time_from_string("2024-06-01 03:30:00");
+    observing_site site;
+    site.latitude = -30.24 * degree_to_radian;
+    site.longitude = -70.74 * degree_to_radian;
+    site.pressure = 74000.0;
+    site.temperature = 8.0;
+    auto const observed = transform_batch_to_alt_az(points, time, site, cache);
+    auto const single_observed = transform_batch_to_alt_az(single_points, time, site, cache,
+        conversion_accuracy::fast);
+
+    //rounding of the float inputs and of every step adds up to a few float_angle
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        BOOST_CHECK_SMALL(single_galactic.lat_data()[i] - galactic.lat_data()[i], float_angle * 4);
+        BOOST_CHECK_SMALL(single_observed.lat_data()[i] - observed.lat_data()[i], float_angle * 4);
+        BOOST_CHECK_SMALL(std::cos(observed.lat_data()[i]) * std::remainder(
+            single_observed.lon_data()[i] - observed.lon_data()[i], 6.283185307179586), float_angle * 4);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
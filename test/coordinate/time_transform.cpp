@@ -0,0 +1,178 @@
+#define BOOST_TEST_MODULE time_transform_test
+
+#include <cmath>
+#include <boost/test/unit_test.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/systems/si/plane_angle.hpp>
+#include <boost/units/systems/si/length.hpp>
+#include <boost/units/systems/si/pressure.hpp>
+#include <boost/units/systems/angle/degrees.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/astronomy/coordinate/time_transform.hpp>
+#include <boost/astronomy/coordinate/alt_az.hpp>
+#include <boost/astronomy/coordinate/cirs.hpp>
+#include <boost/astronomy/coordinate/representation_batch.hpp>
+
+using namespace std;
+using namespace boost::astronomy::coordinate;
+using namespace boost::units::si;
+using namespace boost::units;
+namespace bud = boost::units::degree;
+namespace bpt = boost::posix_time;
+
+typedef spherical_representation<double, quantity<bud::plane_angle>, quantity<bud::plane_angle>,
+    quantity<si::length>> representation_type;
+typedef spherical_coslat_differential<double, quantity<bud::plane_angle>,
+    quantity<bud::plane_angle>, quantity<si::length>> differential_type;
+
+typedef icrs<representation_type, differential_type> icrs_type;
+typedef cirs<representation_type, differential_type> cirs_type;
+typedef alt_az<representation_type, differential_type> alt_az_type;
+typedef spherical_equatorial_representation<double, quantity<bud::plane_angle>,
+    quantity<bud::plane_angle>> location_type;
+
+double const degree_to_radian = 0.017453292519943295769;
+
+BOOST_AUTO_TEST_SUITE(earth_orientation_terms)
+
+BOOST_AUTO_TEST_CASE(against_sofa)
+{
+    //values from the test suite of SOFA
+    double const days = 54388.0 + 2400000.5 - 2451545.0;
+    BOOST_CHECK_SMALL(earth_rotation_angle(days) - 0.4022837240028158102, 1e-12);
+    BOOST_CHECK_SMALL(mean_obliquity(days / 36525.0) - 0.4090749229387258204, 1e-14);
+
+    //the ten terms of nutation are good to 0.1"
+    nutation_angles nut = nutation((53736.0 + 2400000.5 - 2451545.0) / 36525.0);
+    BOOST_CHECK_SMALL(nut.longitude - -0.9632552291148362783e-5, 5e-7);
+    BOOST_CHECK_SMALL(nut.obliquity - 0.4063197106621159367e-4, 5e-7);
+
+    refraction_constants refraction = refraction_constants::from_weather(80000, 10, 0.9, 0.4);
+    BOOST_CHECK_SMALL(refraction.a - 0.2264949956241415009e-3, 1e-15);
+    BOOST_CHECK_SMALL(refraction.b - -0.2598658261729343970e-6, 1e-18);
+
+    BOOST_CHECK_SMALL(refraction_constants::from_weather(0, 10, 0.9).a, 1e-20);
+}
+
+BOOST_AUTO_TEST_CASE(cirs_matrix_is_orthonormal)
+{
+    earth_orientation orientation = earth_orientation::at(
+        observation_epoch::from_utc(bpt::time_from_string("2025-01-01 00:00:00")));
+    rotation_matrix const product = multiply(orientation.gcrs_to_cirs,
+        transpose(orientation.gcrs_to_cirs));
+    for (std::size_t row = 0; row < 3; row++)
+    {
+        for (std::size_t column = 0; column < 3; column++)
+        {
+            BOOST_CHECK_SMALL(product(row, column) - (row == column ? 1.0 : 0.0), 1e-12);
+        }
+    }
+
+    //aberration never exceeds 20.5"
+    double const v = std::sqrt(orientation.earth_velocity[0] * orientation.earth_velocity[0] +
+        orientation.earth_velocity[1] * orientation.earth_velocity[1] +
+        orientation.earth_velocity[2] * orientation.earth_velocity[2]);
+    BOOST_CHECK(v > 9.5e-5 && v < 1.02e-4);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(time_transform_cache_reuse)
+
+BOOST_AUTO_TEST_CASE(icrs_to_cirs_precesses)
+{
+    time_transform_cache cache;
+    bpt::ptime const time = bpt::time_from_string("2025-01-01 00:00:00");
+
+    //25 years of precession move the equinox 0.139 degree north, aberration and nutation
+    //add at most 30"
+    icrs_type equinox(0.0 * bud::degrees, 0.0 * bud::degrees, 1.0 * meters);
+    cirs_type apparent = transform_to_cirs<cirs_type>(equinox, time, cache);
+    BOOST_CHECK_SMALL(apparent.get_data().get_lat().value() - 0.139, 0.01);
+    BOOST_CHECK(apparent.get_obs_time() == time);
+
+    transform_to_cirs<cirs_type>(equinox, time, cache);
+    BOOST_CHECK_EQUAL(cache.misses(), 1u);
+    BOOST_CHECK_EQUAL(cache.hits(), 1u);
+
+    transform_to_cirs<cirs_type>(equinox, time + bpt::hours(1), cache);
+    BOOST_CHECK_EQUAL(cache.misses(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(polaris_altitude_is_site_latitude)
+{
+    time_transform_cache cache;
+    alt_az_type parameters;
+    parameters.set_frame_parameters(location_type(52.0 * bud::degrees, 4.0 * bud::degrees,
+        quantity<si::dimensionless>(1.0)),
+        0.0 * pascals, 10.0 * boost::units::celsius::degrees,
+        bpt::time_from_string("2024-03-20 21:00:00"), 0.5);
+
+    icrs_type polaris(89.264109 * bud::degrees, 37.954561 * bud::degrees, 1.0 * meters);
+    alt_az_type observed = transform_to_alt_az(polaris, parameters, cache);
+    BOOST_CHECK_SMALL(observed.get_alt().value() - 52.0, 0.75);
+    BOOST_CHECK(observed.get_obs_time() == parameters.get_obs_time());
+
+    //the sky turns while polaris stays
+    for (int hour = 1; hour < 24; hour++)
+    {
+        parameters.set_obs_time(bpt::time_from_string("2024-03-20 21:00:00") + bpt::hours(hour));
+        BOOST_CHECK_SMALL(transform_to_alt_az(polaris, parameters, cache).get_alt().value() - 52.0,
+            0.75);
+    }
+
+    //refraction only raises the source by about an arcminute at 45 degrees
+    parameters.set_pressure(101325.0 * pascals);
+    alt_az_type refracted = transform_to_alt_az(polaris, parameters, cache);
+    parameters.set_pressure(0.0 * pascals);
+    alt_az_type vacuum = transform_to_alt_az(polaris, parameters, cache);
+    double const shift = refracted.get_alt().value() - vacuum.get_alt().value();
+    BOOST_CHECK(shift > 0.5 / 60 && shift < 1.5 / 60);
+}
+
+BOOST_AUTO_TEST_CASE(batch_matches_points)
+{
+    time_transform_cache cache;
+    bpt::ptime const time = bpt::time_from_string("2024-06-01 03:30:00");
+    alt_az_type parameters;
+    parameters.set_frame_parameters(location_type(-30.24 * bud::degrees, -70.74 * bud::degrees,
+        quantity<si::dimensionless>(1.0)),
+        74000.0 * pascals, 8.0 * boost::units::celsius::degrees, time, 0.0);
+    observing_site const site = observing_site::of(parameters);
+    BOOST_CHECK_SMALL(site.latitude - -30.24 * degree_to_radian, 1e-12);
+    BOOST_CHECK_SMALL(site.longitude - -70.74 * degree_to_radian, 1e-12);
+
+    spherical_equatorial_representation_batch<double> points;
+    std::vector<icrs_type> sources;
+    for (int i = 0; i < 300; i++)
+    {
+        double const ra = 1.7 * i;
+        double const dec = -80.0 + 0.5 * i;
+        sources.push_back(icrs_type(dec * bud::degrees, ra * bud::degrees, 1.0 * meters));
+        points.push_back(ra * degree_to_radian * radians, dec * degree_to_radian * radians,
+            quantity<si::dimensionless>(1.0));
+    }
+
+    auto const apparent = transform_batch_to_cirs(points, time, cache);
+    auto const observed = transform_batch_to_alt_az(points, time, site, cache);
+    for (std::size_t i = 0; i < sources.size(); i++)
+    {
+        cirs_type point = transform_to_cirs<cirs_type>(sources[i], time, cache);
+        double ra = apparent.template data<0>()[i] / degree_to_radian;
+        ra = ra < 0 ? ra + 360 : ra;
+        BOOST_CHECK_SMALL(std::remainder(ra - point.get_data().get_lon().value(), 360.0), 1e-9);
+        BOOST_CHECK_SMALL(apparent.template data<1>()[i] / degree_to_radian -
+            point.get_data().get_lat().value(), 1e-9);
+
+        alt_az_type horizontal = transform_to_alt_az(sources[i], parameters, cache);
+        BOOST_CHECK_SMALL(observed.template data<1>()[i] / degree_to_radian -
+            horizontal.get_alt().value(), 1e-9);
+        BOOST_CHECK_SMALL(std::remainder(observed.template data<0>()[i] / degree_to_radian -
+            horizontal.get_az().value(), 360.0), 1e-9);
+    }
+
+    //one orientation and one site computed for 600 points of both batches and 600 single points
+    BOOST_CHECK_EQUAL(cache.misses(), 2u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,115 @@
+#define BOOST_TEST_MODULE trivial_storage_test
+
+#include <cstring>
+#include <type_traits>
+#include <vector>
+#include <boost/test/unit_test.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/systems/si/plane_angle.hpp>
+#include <boost/units/systems/si/length.hpp>
+#include <boost/units/systems/si/velocity.hpp>
+#include <boost/units/systems/angle/degrees.hpp>
+#include <boost/astronomy/detail/is_trivial_storage.hpp>
+#include <boost/astronomy/coordinate/representation.hpp>
+#include <boost/astronomy/coordinate/differential.hpp>
+#include <boost/astronomy/coordinate/frame.hpp>
+#include <boost/astronomy/coordinate/sky_point.hpp>
+
+using namespace std;
+using namespace boost::astronomy::coordinate;
+using namespace boost::units::si;
+using namespace boost::units;
+using boost::astronomy::detail::is_trivial_storage;
+namespace bud = boost::units::degree;
+
+typedef spherical_representation<double, quantity<bud::plane_angle>, quantity<bud::plane_angle>,
+    quantity<si::length>> representation_type;
+typedef spherical_coslat_differential<double, quantity<bud::plane_angle>,
+    quantity<bud::plane_angle>, quantity<si::velocity>> differential_type;
+typedef icrs<representation_type, differential_type> icrs_type;
+
+BOOST_STATIC_ASSERT((is_trivial_storage<representation_type>::value));
+BOOST_STATIC_ASSERT((is_trivial_storage<cartesian_representation<float>>::value));
+BOOST_STATIC_ASSERT((is_trivial_storage<spherical_equatorial_representation<double>>::value));
+BOOST_STATIC_ASSERT((is_trivial_storage<differential_type>::value));
+BOOST_STATIC_ASSERT((is_trivial_storage<cartesian_differential<double>>::value));
+BOOST_STATIC_ASSERT((is_trivial_storage<spherical_differential<double>>::value));
+BOOST_STATIC_ASSERT((is_trivial_storage<spherical_equatorial_differential<double>>::value));
+BOOST_STATIC_ASSERT((is_trivial_storage<icrs_type>::value));
+BOOST_STATIC_ASSERT((is_trivial_storage<galactic<representation_type, differential_type>>::value));
+BOOST_STATIC_ASSERT((is_trivial_storage<supergalactic<representation_type, differential_type>>::value));
+//frames holding an epoch besides their data can still be copied as bytes
+BOOST_STATIC_ASSERT((std::is_trivially_copyable<cirs<representation_type, differential_type>>::value));
+BOOST_STATIC_ASSERT((std::is_trivially_copyable
+    <geocentric<representation_type, differential_type>>::value));
+BOOST_STATIC_ASSERT((std::is_trivially_copyable
+    <heliocentric<representation_type, differential_type>>::value));
+BOOST_STATIC_ASSERT((is_trivial_storage<sky_point<icrs_type>>::value));
+BOOST_STATIC_ASSERT((is_trivial_storage<sky_point<galactic<representation_type, differential_type>>>::value));
+
+//a frame holds nothing but the values of its representation and differential
+BOOST_STATIC_ASSERT(sizeof(icrs_type) == 6 * sizeof(double));
+BOOST_STATIC_ASSERT(sizeof(sky_point<icrs_type>) == sizeof(icrs_type));
+
+BOOST_AUTO_TEST_SUITE(trivial_storage)
+
+BOOST_AUTO_TEST_CASE(byte_copies)
+{
+    std::vector<sky_point<icrs_type>> points;
+    for (int i = 0; i < 100; i++)
+    {
+        points.push_back(sky_point<icrs_type>(icrs_type((0.7 * i - 35) * bud::degrees,
+            (3.3 * i) * bud::degrees, (1.0 + i) * meters, (0.01 * i) * bud::degrees,
+            (-0.02 * i) * bud::degrees, (5.0 * i) * meters_per_second)));
+    }
+
+    //round trip through raw bytes like a memory mapped file or a message
+    std::vector<unsigned char> bytes(points.size() * sizeof(sky_point<icrs_type>));
+    std::memcpy(bytes.data(), points.data(), bytes.size());
+    std::vector<sky_point<icrs_type>> copies(points.size());
+    std::memcpy(copies.data(), bytes.data(), bytes.size());
+
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        icrs_type const original = points[i].get_point();
+        icrs_type const copy = copies[i].get_point();
+        BOOST_CHECK_EQUAL(copy.get_dec().value(), original.get_dec().value());
+        BOOST_CHECK_EQUAL(copy.get_ra().value(), original.get_ra().value());
+        BOOST_CHECK_EQUAL(copy.get_distance().value(), original.get_distance().value());
+        BOOST_CHECK_EQUAL(copy.get_pm_dec().value(), original.get_pm_dec().value());
+        BOOST_CHECK_EQUAL(copy.get_pm_ra_cosdec().value(), original.get_pm_ra_cosdec().value());
+        BOOST_CHECK_EQUAL(copy.get_radial_velocity().value(), original.get_radial_velocity().value());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(frames_from_own_types)
+{
+    representation_type const representation(-12.345678901234567 * bud::degrees,
+        271.98765432109876 * bud::degrees, 3.0e17 * meters);
+    differential_type const differential(1e-7 * bud::degrees, -2e-7 * bud::degrees,
+        -11.5 * meters_per_second);
+
+    //representation and differential of the frame types are stored bit for bit
+    icrs_type const star(representation, differential);
+    BOOST_CHECK(std::memcmp(&star, &representation, sizeof(representation)) == 0);
+    BOOST_CHECK_EQUAL(star.get_dec().value(), representation.get_lat().value());
+    BOOST_CHECK_EQUAL(star.get_ra().value(), representation.get_lon().value());
+    BOOST_CHECK_EQUAL(star.get_pm_ra_cosdec().value(), differential.get_dlon_coslat().value());
+
+    sky_point<icrs_type> const point(representation, differential);
+    BOOST_CHECK_EQUAL(point.get_point().get_distance().value(), 3.0e17);
+    BOOST_CHECK_EQUAL(point.get_point().get_radial_velocity().value(), -11.5);
+
+    galactic<representation_type, differential_type> const position(representation);
+    BOOST_CHECK_EQUAL(position.get_b().value(), representation.get_lat().value());
+    BOOST_CHECK_EQUAL(position.get_l().value(), representation.get_lon().value());
+
+    //other types are still converted
+    spherical_representation<double, quantity<si::plane_angle>, quantity<si::plane_angle>,
+        quantity<si::length>> const radians_representation(representation);
+    icrs_type const converted(radians_representation, differential);
+    BOOST_CHECK_CLOSE(converted.get_ra().value(), representation.get_lon().value(), 1e-12);
+    BOOST_CHECK_CLOSE(converted.get_dec().value(), representation.get_lat().value(), 1e-12);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,317 @@
+#define BOOST_TEST_MODULE wcs_test
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <boost/test/unit_test.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/systems/si/plane_angle.hpp>
+#include <boost/units/systems/si/dimensionless.hpp>
+#include <boost/astronomy/coordinate/wcs.hpp>
+#include <boost/astronomy/coordinate/representation_batch.hpp>
+#include <boost/astronomy/io/hdu.hpp>
+
+using namespace std;
+using namespace boost::astronomy::coordinate;
+using namespace boost::units;
+
+typedef spherical_equatorial_representation_batch<double, quantity<si::plane_angle>,
+    quantity<si::plane_angle>, quantity<si::dimensionless>> sky_batch;
+
+double const deg = 3.141592653589793 / 180;
+
+//! header unit of a primary HDU without data followed by the keywords
+boost::astronomy::io::hdu make_header(vector<pair<string, string>> keywords)
+{
+    keywords.insert(keywords.begin(), {{"SIMPLE", "T"}, {"BITPIX", "8"}, {"NAXIS", "0"}});
+    string content;
+    for (auto const& keyword : keywords)
+    {
+        string card = keyword.first;
+        card.append(8 - card.size(), ' ');
+        card += "= " + keyword.second;
+        content += card.append(80 - card.size(), ' ');
+    }
+    content += string("END").append(77, ' ');
+    content.append((2880 - content.size() % 2880) % 2880, ' ');
+
+    boost::astronomy::io::hdu header;
+    header.read_header(content.data(), content.data() + content.size());
+    return header;
+}
+
+//! hundred pixels spread over a 2000 x 2000 image
+void make_pixels(vector<double>& columns, vector<double>& rows)
+{
+    for (int i = 0; i < 100; i++)
+    {
+        columns.push_back(std::fmod(617.3 * i, 2000.0));
+        rows.push_back(std::fmod(1371.9 * i, 2000.0));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(wcs_projections)
+
+BOOST_AUTO_TEST_CASE(tan_matches_gnomonic_projection)
+{
+    //one arcsecond pixels with north up and east left, reference pixel at (511, 511)
+    double const scale = 1.0 / 3600;
+    wcs_transform const wcs(wcs_projection::tan, 512, 512, 150, 30, -scale, 0, 0, scale);
+
+    vector<double> columns, rows;
+    make_pixels(columns, rows);
+    vector<double> ra(columns.size()), dec(columns.size());
+    wcs.pixel_to_sky(columns.size(), columns.data(), rows.data(), ra.data(), dec.data());
+
+    double const ra0 = 150 * deg;
+    double const dec0 = 30 * deg;
+    for (size_t i = 0; i < columns.size(); i++)
+    {
+        double const xi = -(columns[i] - 511) * scale * deg;
+        double const eta = (rows[i] - 511) * scale * deg;
+        double const denominator = std::cos(dec0) - eta * std::sin(dec0);
+        double const expected_ra = ra0 + std::atan2(xi, denominator);
+        double const expected_dec = std::atan2(std::sin(dec0) + eta * std::cos(dec0),
+            std::sqrt(xi * xi + denominator * denominator));
+        BOOST_CHECK_SMALL(ra[i] - expected_ra, 1e-13);
+        BOOST_CHECK_SMALL(dec[i] - expected_dec, 1e-13);
+    }
+
+    //the reference pixel maps onto the reference point
+    double const column = 511, row = 511;
+    double lon, lat;
+    wcs.pixel_to_sky(1, &column, &row, &lon, &lat);
+    BOOST_CHECK_CLOSE(lon, ra0, 1e-12);
+    BOOST_CHECK_CLOSE(lat, dec0, 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(round_trip_of_every_projection)
+{
+    vector<double> columns, rows;
+    make_pixels(columns, rows);
+    //rotated and sheared pixels of 6 arcsecond around a point near the pole
+    wcs_projection const projections[] = {wcs_projection::tan, wcs_projection::sin,
+        wcs_projection::zea};
+    for (wcs_projection const projection : projections)
+    {
+        wcs_transform const wcs(projection, 1000.5, 980, 350, 85, -1.6e-3, 3e-4, 2e-4, 1.7e-3);
+        for (conversion_accuracy const accuracy : {conversion_accuracy::exact,
+            conversion_accuracy::fast})
+        {
+            vector<double> ra(columns.size()), dec(columns.size());
+            vector<double> back_columns(columns.size()), back_rows(columns.size());
+            wcs.pixel_to_sky(columns.size(), columns.data(), rows.data(), ra.data(), dec.data(),
+                accuracy);
+            wcs.sky_to_pixel(columns.size(), ra.data(), dec.data(), back_columns.data(),
+                back_rows.data(), accuracy);
+            for (size_t i = 0; i < columns.size(); i++)
+            {
+                BOOST_CHECK(ra[i] >= 0 && ra[i] < 2 * 3.141592653589793);
+                BOOST_CHECK_SMALL(back_columns[i] - columns[i], 1e-8);
+                BOOST_CHECK_SMALL(back_rows[i] - rows[i], 1e-8);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(radial_distances_of_projections)
+{
+    //the angular distance rho from the reference point is at R = tan(rho), sin(rho)
+    //and 2 sin(rho / 2) in TAN, SIN and ZEA
+    double const rho = 40 * deg;
+    double const radius[] = {std::tan(rho), std::sin(rho), 2 * std::sin(rho / 2)};
+    wcs_projection const projections[] = {wcs_projection::tan, wcs_projection::sin,
+        wcs_projection::zea};
+    for (int p = 0; p < 3; p++)
+    {
+        wcs_transform const wcs(projections[p], 1, 1, 20, -10, 1, 0, 0, 1);
+        double const column = 0, row = radius[p] / deg;
+        double lon, lat;
+        wcs.pixel_to_sky(1, &column, &row, &lon, &lat);
+        BOOST_CHECK_SMALL(lon - 20 * deg, 1e-12);
+        BOOST_CHECK_CLOSE(lat, 30 * deg, 1e-10);
+    }
+
+    //beyond the horizon of SIN and behind the tangent plane of TAN there is no point
+    wcs_transform const orthographic(wcs_projection::sin, 1, 1, 0, 0, 1, 0, 0, 1);
+    double const column = 70, row = 0;
+    double lon, lat;
+    orthographic.pixel_to_sky(1, &column, &row, &lon, &lat);
+    BOOST_CHECK(std::isnan(lon) && std::isnan(lat));
+
+    wcs_transform const gnomonic(wcs_projection::tan, 1, 1, 0, 0, 1, 0, 0, 1);
+    double const far_lon = 3.0, far_lat = 0;
+    double far_column, far_row;
+    gnomonic.sky_to_pixel(1, &far_lon, &far_lat, &far_column, &far_row);
+    BOOST_CHECK(std::isnan(far_column) && std::isnan(far_row));
+}
+
+BOOST_AUTO_TEST_CASE(sip_distortion_and_inverse)
+{
+    sip_distortion sip;
+    sip.a = sip_polynomial(2);
+    sip.b = sip_polynomial(2);
+    sip.a(2, 0) = 2e-6;
+    sip.a(1, 1) = -1e-6;
+    sip.b(0, 2) = 3e-6;
+    sip.b(1, 0) = 1e-4;
+    wcs_transform const distorted(wcs_projection::tan, 512, 512, 10, 20, -2e-4, 0, 0, 2e-4, sip);
+    wcs_transform const linear(wcs_projection::tan, 512, 512, 10, 20, -2e-4, 0, 0, 2e-4);
+
+    //the distorted pixel is the linear one shifted by the polynomials
+    double const column = 811, row = 111;
+    double const u = 300, v = -400;
+    double const shifted_column = column + 2e-6 * u * u - 1e-6 * u * v;
+    double const shifted_row = row + 3e-6 * v * v + 1e-4 * u;
+    double lon[2], lat[2];
+    distorted.pixel_to_sky(1, &column, &row, lon, lat);
+    linear.pixel_to_sky(1, &shifted_column, &shifted_row, lon + 1, lat + 1);
+    BOOST_CHECK_CLOSE(lon[0], lon[1], 1e-12);
+    BOOST_CHECK_CLOSE(lat[0], lat[1], 1e-12);
+
+    //without AP and BP the offsets are found by iteration
+    vector<double> columns, rows;
+    make_pixels(columns, rows);
+    vector<double> ra(columns.size()), dec(columns.size());
+    vector<double> back_columns(columns.size()), back_rows(columns.size());
+    distorted.pixel_to_sky(columns.size(), columns.data(), rows.data(), ra.data(), dec.data());
+    distorted.sky_to_pixel(columns.size(), ra.data(), dec.data(), back_columns.data(),
+        back_rows.data());
+    for (size_t i = 0; i < columns.size(); i++)
+    {
+        BOOST_CHECK_SMALL(back_columns[i] - columns[i], 1e-7);
+        BOOST_CHECK_SMALL(back_rows[i] - rows[i], 1e-7);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(keywords_of_header)
+{
+    auto const header = make_header({
+        {"CTYPE1", "'RA---TAN-SIP'"},
+        {"CTYPE2", "'DEC--TAN-SIP'"},
+        {"CRPIX1", "1024.5"},
+        {"CRPIX2", "1000"},
+        {"CRVAL1", "83.8"},
+        {"CRVAL2", "-5.4"},
+        {"CD1_1", "-1.5E-4"},
+        {"CD1_2", "1.0E-5"},
+        {"CD2_1", "1.0E-5"},
+        {"CD2_2", "1.5E-4"},
+        {"A_ORDER", "2"},
+        {"A_2_0", "1.0E-6"},
+        {"B_ORDER", "2"},
+        {"B_0_2", "-2.0E-6"},
+        {"AP_ORDER", "2"},
+        {"AP_2_0", "-1.0E-6"},
+        {"BP_ORDER", "2"},
+        {"BP_0_2", "2.0E-6"}
+    });
+    wcs_transform const wcs = make_wcs(header);
+    BOOST_CHECK(wcs.projection() == wcs_projection::tan);
+    BOOST_CHECK_EQUAL(wcs.distortion().a.order, 2u);
+    BOOST_CHECK_CLOSE(wcs.distortion().b(0, 2), -2e-6, 1e-12);
+    BOOST_CHECK_CLOSE(wcs.reference_longitude(), 83.8 * deg, 1e-12);
+    BOOST_CHECK_CLOSE(wcs.reference_latitude(), -5.4 * deg, 1e-12);
+
+    sip_distortion sip;
+    sip.a = sip_polynomial(2);
+    sip.b = sip_polynomial(2);
+    sip.a(2, 0) = 1e-6;
+    sip.b(0, 2) = -2e-6;
+    wcs_transform const expected(wcs_projection::tan, 1024.5, 1000, 83.8, -5.4, -1.5e-4, 1e-5,
+        1e-5, 1.5e-4, sip);
+    vector<double> columns, rows;
+    make_pixels(columns, rows);
+    vector<double> ra(columns.size()), dec(columns.size());
+    vector<double> expected_ra(columns.size()), expected_dec(columns.size());
+    wcs.pixel_to_sky(columns.size(), columns.data(), rows.data(), ra.data(), dec.data());
+    expected.pixel_to_sky(columns.size(), columns.data(), rows.data(), expected_ra.data(),
+        expected_dec.data());
+    for (size_t i = 0; i < columns.size(); i++)
+    {
+        BOOST_CHECK_CLOSE(ra[i], expected_ra[i], 1e-12);
+        BOOST_CHECK_CLOSE(dec[i], expected_dec[i], 1e-12);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(linear_keyword_conventions)
+{
+    //CD, CDELT with PC and CDELT with the legacy CROTA2 describe the same rotated pixels
+    double const angle = 30 * deg;
+    auto const cd = make_header({{"CTYPE1", "'GLON-ZEA'"}, {"CTYPE2", "'GLAT-ZEA'"},
+        {"CRPIX1", "50"}, {"CRPIX2", "60"}, {"CRVAL1", "120"}, {"CRVAL2", "45"},
+        {"CD1_1", to_string(-0.01 * std::cos(angle))},
+        {"CD1_2", to_string(-0.01 * std::sin(angle))},
+        {"CD2_1", to_string(-0.01 * std::sin(angle))},
+        {"CD2_2", to_string(0.01 * std::cos(angle))}});
+    auto const pc = make_header({{"CTYPE1", "'GLON-ZEA'"}, {"CTYPE2", "'GLAT-ZEA'"},
+        {"CRPIX1", "50"}, {"CRPIX2", "60"}, {"CRVAL1", "120"}, {"CRVAL2", "45"},
+        {"CDELT1", "-0.01"}, {"CDELT2", "0.01"},
+        {"PC1_1", to_string(std::cos(angle))}, {"PC1_2", to_string(std::sin(angle))},
+        {"PC2_1", to_string(-std::sin(angle))}, {"PC2_2", to_string(std::cos(angle))}});
+    auto const crota = make_header({{"CTYPE1", "'GLON-ZEA'"}, {"CTYPE2", "'GLAT-ZEA'"},
+        {"CRPIX1", "50"}, {"CRPIX2", "60"}, {"CRVAL1", "120"}, {"CRVAL2", "45"},
+        {"CDELT1", "-0.01"}, {"CDELT2", "0.01"}, {"CROTA2", "30"}});
+
+    wcs_transform const transforms[] = {make_wcs(cd), make_wcs(pc), make_wcs(crota)};
+    double const column = 10, row = 90;
+    double lon[3], lat[3];
+    for (int i = 0; i < 3; i++)
+    {
+        BOOST_CHECK(transforms[i].projection() == wcs_projection::zea);
+        transforms[i].pixel_to_sky(1, &column, &row, lon + i, lat + i);
+    }
+    BOOST_CHECK_CLOSE(lon[0], lon[1], 1e-4);
+    BOOST_CHECK_CLOSE(lat[0], lat[1], 1e-4);
+    BOOST_CHECK_CLOSE(lon[0], lon[2], 1e-4);
+    BOOST_CHECK_CLOSE(lat[0], lat[2], 1e-4);
+
+    //unsupported projections, swapped axes and missing CTYPE are rejected
+    BOOST_CHECK_THROW(make_wcs(make_header({{"CTYPE1", "'RA---AIT'"}, {"CTYPE2", "'DEC--AIT'"}})),
+        boost::astronomy::invalid_wcs_exception);
+    BOOST_CHECK_THROW(make_wcs(make_header({{"CTYPE1", "'DEC--TAN'"}, {"CTYPE2", "'RA---TAN'"}})),
+        boost::astronomy::invalid_wcs_exception);
+    BOOST_CHECK_THROW(make_wcs(make_header({{"CRVAL1", "10"}})),
+        boost::astronomy::invalid_wcs_exception);
+}
+
+BOOST_AUTO_TEST_CASE(pixel_grids_and_batches)
+{
+    wcs_transform const wcs(wcs_projection::sin, 40, 30, 200, -60, -0.01, 0, 0, 0.01);
+    size_t const width = 80, height = 50;
+    batch_execution execution(2);
+    execution.min_points_per_thread = 256;
+    sky_batch const grid = wcs.pixel_grid_to_sky<sky_batch>(width, height,
+        conversion_accuracy::exact, execution);
+    BOOST_REQUIRE_EQUAL(grid.size(), width * height);
+
+    //image_buffer pixel (x, y) is row x and column y
+    vector<double> columns, rows;
+    for (size_t x = 0; x < height; x++)
+    {
+        for (size_t y = 0; y < width; y++)
+        {
+            columns.push_back(static_cast<double>(y));
+            rows.push_back(static_cast<double>(x));
+        }
+    }
+    sky_batch const listed = wcs.pixel_to_sky<sky_batch>(columns.size(), columns.data(),
+        rows.data());
+    for (size_t i = 0; i < grid.size(); i++)
+    {
+        BOOST_CHECK_SMALL(grid.data<0>()[i] - listed.data<0>()[i], 1e-15);
+        BOOST_CHECK_SMALL(grid.data<1>()[i] - listed.data<1>()[i], 1e-15);
+        BOOST_CHECK_SMALL(grid.data<2>()[i] - 1.0, 1e-15);
+    }
+
+    vector<double> back_columns(grid.size()), back_rows(grid.size());
+    wcs.sky_to_pixel(grid, back_columns.data(), back_rows.data(), conversion_accuracy::exact,
+        execution);
+    for (size_t i = 0; i < grid.size(); i++)
+    {
+        BOOST_CHECK_SMALL(back_columns[i] - columns[i], 1e-8);
+        BOOST_CHECK_SMALL(back_rows[i] - rows[i], 1e-8);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
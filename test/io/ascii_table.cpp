@@ -0,0 +1,162 @@
+#define BOOST_TEST_MODULE ascii_table_test
+
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/ascii_table.hpp>
+
+#include "fits_test_file.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace {
+
+//! header of a table with an integer, a fixed point and two exponential columns
+std::string catalog_header(std::size_t rows)
+{
+    return fits_header({
+        fits_card("XTENSION", "'TABLE   '"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", "54"),
+        fits_card("NAXIS2", std::to_string(rows)),
+        fits_card("PCOUNT", "0"),
+        fits_card("GCOUNT", "1"),
+        fits_card("TFIELDS", "4"),
+        fits_card("TTYPE1", "'ID'"),
+        fits_card("TFORM1", "'I8'"),
+        fits_card("TBCOL1", "1"),
+        fits_card("TTYPE2", "'FLUX'"),
+        fits_card("TFORM2", "'F10.3'"),
+        fits_card("TBCOL2", "9"),
+        fits_card("TTYPE3", "'MAG'"),
+        fits_card("TFORM3", "'E14.6'"),
+        fits_card("TBCOL3", "19"),
+        fits_card("TTYPE4", "'RA'"),
+        fits_card("TFORM4", "'D22.14'"),
+        fits_card("TBCOL4", "33"),
+        fits_card("EXTNAME", "'CATALOG'")
+    });
+}
+
+std::string catalog_row(long id, char const* flux, double mag, double ra)
+{
+    char row[64];
+    std::snprintf(row, sizeof(row), "%8ld%10s%14.6E%22.14E", id, flux, mag, ra);
+    std::string text(row);
+    text[text.size() - 4] = 'D';
+    return text;
+}
+
+ascii_table table_from(std::string const& memory)
+{
+    hdu header;
+    char const* data = header.read_header(memory.data(), memory.data() + memory.size());
+    return ascii_table(header, data);
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(ascii_columns)
+
+BOOST_AUTO_TEST_CASE(parse_many_rows)
+{
+    std::size_t const rows = 40000;
+    std::string data;
+    std::vector<double> mags(rows), ras(rows);
+    for (std::size_t row = 0; row < rows; row++)
+    {
+        mags[row] = (static_cast<double>(row) - 20000.5) / 7.0;
+        ras[row] = 360.0 * static_cast<double>(row) / rows + 1e-9;
+        char flux[16];
+        std::snprintf(flux, sizeof(flux), "%.3f", static_cast<double>(row) * 0.25);
+        data += catalog_row(static_cast<long>(row) - 100, flux, mags[row], ras[row]);
+    }
+    std::string const memory = catalog_header(rows) + fits_pad_data(data);
+    ascii_table table = table_from(memory);
+
+    std::vector<std::int64_t> ids = table.read_column<std::int64_t>("ID", 3);
+    std::vector<float> flux = table.read_column<float>("FLUX", 2);
+    std::vector<double> mag = table.read_column<double>("MAG");
+    std::vector<double> ra = table.read_column<double>("RA", 4);
+    BOOST_REQUIRE(ids.size() == rows);
+
+    for (std::size_t row = 0; row < rows; row++)
+    {
+        BOOST_TEST(ids[row] == static_cast<std::int64_t>(row) - 100);
+        BOOST_TEST(flux[row] == static_cast<float>(static_cast<double>(row) * 0.25));
+
+        //values must match strtod of the same text exactly
+        char text[32];
+        std::snprintf(text, sizeof(text), "%.6E", mags[row]);
+        BOOST_TEST(mag[row] == std::strtod(text, nullptr));
+        std::snprintf(text, sizeof(text), "%.14E", ras[row]);
+        BOOST_TEST(ra[row] == std::strtod(text, nullptr));
+    }
+
+    auto column = table.get_column("RA");
+    BOOST_REQUIRE(column != nullptr);
+    BOOST_TEST(static_cast<column_data<double>&>(*column).get_data()[rows - 1] == ra[rows - 1]);
+    auto ids_column = table.get_column("ID");
+    BOOST_TEST(static_cast<column_data<std::int32_t>&>(*ids_column).get_data()[0] == -100);
+}
+
+BOOST_AUTO_TEST_CASE(special_fields)
+{
+    std::string data = catalog_row(7, "12345", 1.5, 2.5);
+    data += catalog_row(-9999999L, "", 0.0, -0.0);
+    data += catalog_row(1, "  -1.5E+02", 0.0, 0.0);
+    data.replace(data.size() - 22, 22, "1.2345678901234567D-30");
+    std::string const memory = catalog_header(3) + fits_pad_data(data);
+    ascii_table table = table_from(memory);
+
+    //a field without a decimal point has 3 implied decimals
+    std::vector<double> flux = table.read_column<double>("FLUX");
+    BOOST_TEST(flux[0] == 12.345);
+    BOOST_TEST(std::isnan(flux[1]));
+    BOOST_TEST(flux[2] == -150.0);
+
+    //more significant digits than the exact fast path handles
+    std::vector<double> ra = table.read_column<double>("RA");
+    BOOST_TEST(ra[2] == std::strtod("1.2345678901234567E-30", nullptr));
+    BOOST_TEST(std::signbit(ra[1]));
+
+    std::vector<std::int32_t> ids = table.read_column<std::int32_t>("ID");
+    BOOST_TEST(ids[1] == -9999999);
+    BOOST_CHECK_THROW(table.read_column<std::int16_t>("ID"), boost::astronomy::invalid_ascii_field_exception);
+    BOOST_CHECK_THROW(table.read_column<std::int32_t>("MAG"), boost::astronomy::invalid_table_colum_format);
+    BOOST_CHECK_THROW(table.read_column<double>("DEC"), boost::astronomy::key_not_defined_exception);
+}
+
+BOOST_AUTO_TEST_CASE(invalid_field)
+{
+    std::string data = catalog_row(7, "1.0", 1.5, 2.5);
+    data[12] = 'x';
+    std::string const memory = catalog_header(1) + fits_pad_data(data);
+    ascii_table table = table_from(memory);
+    BOOST_CHECK_THROW(table.read_column<double>("FLUX"), boost::astronomy::invalid_ascii_field_exception);
+    BOOST_TEST(table.read_column<double>("MAG")[0] == 1.5);
+}
+
+BOOST_AUTO_TEST_CASE(field_outside_row)
+{
+    std::string const data = fits_pad_data(catalog_row(7, "1.0", 1.5, 2.5));
+    std::string const good = fits_card("TBCOL4", "33");
+    for (char const* start : {"0", "34", "55"})
+    {
+        std::string header = catalog_header(1);
+        header.replace(header.find(good), good.size(), fits_card("TBCOL4", start));
+        BOOST_CHECK_THROW(table_from(header + data), boost::astronomy::invalid_table_colum_format);
+    }
+
+    //the last field may end on the last character of the row
+    BOOST_TEST(table_from(catalog_header(1) + data).read_column<double>("RA")[0] == 2.5);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
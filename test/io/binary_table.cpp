@@ -0,0 +1,329 @@
+#define BOOST_TEST_MODULE binary_table_test
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <complex>
+#include <cstdint>
+#include <numeric>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/fits.hpp>
+
+#include "fits_test_file.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace {
+
+//! table of 3 rows with columns of 4 + 16 + 2 + 16 = 38 bytes
+std::string table_file()
+{
+    std::string content = fits_header({
+        fits_card("SIMPLE", "T"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "0"),
+        fits_card("EXTEND", "T")
+    });
+    content += fits_header({
+        fits_card("XTENSION", "'BINTABLE'"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", "38"),
+        fits_card("NAXIS2", "3"),
+        fits_card("PCOUNT", "0"),
+        fits_card("GCOUNT", "1"),
+        fits_card("TFIELDS", "4"),
+        fits_card("TFORM1", "'E       '"),
+        fits_card("TTYPE1", "'FLUX    '"),
+        fits_card("TSCAL1", "2.5"),
+        fits_card("TZERO1", "-1.0"),
+        fits_card("TFORM2", "'2D'"),
+        fits_card("TTYPE2", "'POS'"),
+        fits_card("TFORM3", "'12X'"),
+        fits_card("TTYPE3", "'MASK'"),
+        fits_card("TFORM4", "'1M'"),
+        fits_card("TTYPE4", "'VIS'"),
+        fits_card("EXTNAME", "'SOURCES'")
+    });
+
+    std::string rows;
+    for (std::size_t row = 0; row < 3; row++)
+    {
+        double const value = static_cast<double>(row);
+        rows += fits_big_endian(std::vector<float>{1.5f + static_cast<float>(row)});
+        rows += fits_big_endian(std::vector<double>{value, -value});
+        rows += std::string(1, static_cast<char>(0xF0)) + std::string(1, static_cast<char>(row));
+        rows += fits_big_endian(std::vector<double>{value, 0.25});
+    }
+    return content + fits_pad_data(rows);
+}
+
+std::shared_ptr<binary_table_extension> load_table(fits& fits_file)
+{
+    return std::dynamic_pointer_cast<binary_table_extension>(fits_file.get_hdu(1));
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(binary_table)
+
+BOOST_AUTO_TEST_CASE(parsed_descriptors)
+{
+    fits_test_file file("binary_table_descriptors.fits", table_file());
+    fits fits_file(file.path, fits_open_mode::directory);
+    auto table = load_table(fits_file);
+    BOOST_REQUIRE(table != nullptr);
+
+    auto const& fields = table->get_descriptors();
+    BOOST_REQUIRE_EQUAL(fields.size(), 4u);
+    BOOST_TEST(fields[0].type == 'E');
+    BOOST_TEST(fields[0].scale == 2.5);
+    BOOST_TEST(fields[0].zero == -1.0);
+    BOOST_TEST(fields[1].repeat == 2u);
+    BOOST_TEST(fields[1].offset == 4u);
+    BOOST_TEST(fields[1].width == 16u);
+    BOOST_TEST(fields[2].width == 2u);
+    BOOST_TEST(fields[3].offset == 22u);
+    BOOST_TEST(fields[3].scale == 1.0);
+
+    BOOST_TEST(table->column_index("POS") == 1u);
+    BOOST_TEST(table->column_index("FLUX") == 0u);
+    BOOST_TEST(table->column_index("flux") == table->columns());
+}
+
+BOOST_AUTO_TEST_CASE(columns_by_name)
+{
+    fits_test_file file("binary_table_columns.fits", table_file());
+    fits fits_file(file.path, fits_open_mode::directory);
+    auto table = load_table(fits_file);
+    BOOST_REQUIRE(table != nullptr);
+
+    auto flux = table->get_column("FLUX");
+    auto flux_values = static_cast<column_data<float>&>(*flux).get_data();
+    BOOST_TEST(flux_values == (std::vector<float>{1.5f, 2.5f, 3.5f}));
+
+    auto pos = table->get_column("POS");
+    auto positions = static_cast<column_data<std::vector<double>>&>(*pos).get_data();
+    BOOST_REQUIRE_EQUAL(positions.size(), 3u);
+    BOOST_TEST(positions[2] == (std::vector<double>{2.0, -2.0}));
+
+    auto mask = table->get_column("MASK");
+    auto bits = static_cast<column_data<std::vector<char>>&>(*mask).get_data();
+    BOOST_TEST(bits[1].size() == 2u);
+    BOOST_TEST(bits[1][1] == 1);
+
+    auto vis = table->get_column("VIS");
+    auto visibilities = static_cast<column_data<std::complex<double>>&>(*vis).get_data();
+    BOOST_TEST((visibilities[1] == std::complex<double>(1.0, 0.25)));
+
+    BOOST_TEST(!table->get_column("MISSING"));
+}
+
+BOOST_AUTO_TEST_CASE(names_without_quotes_and_blanks)
+{
+    fits_test_file file("binary_table_names.fits", table_file());
+    fits fits_file(file.path, fits_open_mode::directory);
+    auto table = load_table(fits_file);
+    BOOST_REQUIRE(table != nullptr);
+
+    //TTYPE1 is 'FLUX    ', columns are looked up by the bare name only
+    BOOST_TEST(table->get_columns()[0].TTYPE() == "'FLUX    '");
+    BOOST_TEST(static_cast<bool>(table->get_column("FLUX")));
+    BOOST_TEST(!table->get_column("'FLUX    '"));
+    BOOST_TEST(!table->get_column("FLUX    "));
+    BOOST_TEST(table->column_index("'FLUX    '") == table->columns());
+}
+
+BOOST_AUTO_TEST_CASE(zero_repeat_columns)
+{
+    std::string const content = fits_header({
+        fits_card("SIMPLE", "T"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "0"),
+        fits_card("EXTEND", "T")
+    }) + fits_header({
+        fits_card("XTENSION", "'BINTABLE'"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", "4"),
+        fits_card("NAXIS2", "2"),
+        fits_card("PCOUNT", "0"),
+        fits_card("GCOUNT", "1"),
+        fits_card("TFIELDS", "3"),
+        fits_card("TFORM1", "'0J'"),
+        fits_card("TTYPE1", "'EMPTY'"),
+        fits_card("TFORM2", "'0X'"),
+        fits_card("TTYPE2", "'NOBITS'"),
+        fits_card("TFORM3", "'J'"),
+        fits_card("TTYPE3", "'ID'"),
+        fits_card("EXTNAME", "'EVENTS'")
+    }) + fits_pad_data(fits_big_endian(std::vector<std::int32_t>{7, 8}));
+    fits_test_file file("binary_table_zero_repeat.fits", content);
+    fits fits_file(file.path, fits_open_mode::directory);
+    auto table = load_table(fits_file);
+    BOOST_REQUIRE(table != nullptr);
+    BOOST_TEST(table->get_descriptors()[0].width == 0u);
+    BOOST_TEST(table->get_descriptors()[2].offset == 0u);
+
+    auto empty = table->get_column("EMPTY");
+    BOOST_REQUIRE(empty != nullptr);
+    auto const& values = static_cast<column_data<std::vector<std::int32_t>>&>(*empty).get_data();
+    BOOST_REQUIRE_EQUAL(values.size(), 2u);
+    BOOST_TEST(values[0].empty());
+    BOOST_TEST(values[1].empty());
+
+    auto bits = table->get_column("NOBITS");
+    BOOST_REQUIRE(bits != nullptr);
+    BOOST_TEST(static_cast<column_data<std::vector<char>>&>(*bits).get_data()[1].empty());
+
+    auto ids = table->get_column("ID");
+    BOOST_TEST(static_cast<column_data<std::int32_t>&>(*ids).get_data()[1] == 8);
+}
+
+BOOST_AUTO_TEST_CASE(column_views)
+{
+    fits_test_file file("binary_table_views.fits", table_file());
+    fits fits_file(file.path, fits_open_mode::directory);
+    auto table = load_table(fits_file);
+    BOOST_REQUIRE(table != nullptr);
+
+    column_view<float> flux = table->get_column_view<float>("FLUX");
+    BOOST_TEST(flux.size() == 3u);
+    BOOST_TEST(flux[1] == 2.5f);
+    BOOST_TEST(std::accumulate(flux.begin(), flux.end(), 0.0f) == 7.5f);
+    BOOST_TEST(flux.to_vector() == (std::vector<float>{1.5f, 2.5f, 3.5f}));
+
+    column_view<double> pos = table->get_column_view<double>("POS");
+    BOOST_TEST(pos.rows() == 3u);
+    BOOST_TEST(pos.repeat() == 2u);
+    BOOST_TEST(pos(2, 1) == -2.0);
+    BOOST_TEST(pos.to_vector() == (std::vector<double>{0.0, -0.0, 1.0, -1.0, 2.0, -2.0}));
+    BOOST_TEST(std::distance(pos.begin(), pos.end()) == 6);
+
+    std::vector<std::complex<double>> visibilities(3);
+    table->get_column_view<std::complex<double>>("VIS").copy_to(visibilities.data());
+    BOOST_TEST((visibilities[2] == std::complex<double>(2.0, 0.25)));
+
+    BOOST_CHECK_THROW(table->get_column_view<double>("FLUX"),
+        boost::astronomy::invalid_table_colum_format);
+    BOOST_CHECK_THROW(table->get_column_view<float>("MISSING"),
+        boost::astronomy::key_not_defined_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+namespace {
+
+//! table with a spectrum of variable length per row stored in the heap
+std::string spectra_file(bool long_descriptors)
+{
+    std::vector<std::vector<float>> const spectra{{1.0f, 2.0f, 3.0f}, {}, {-4.5f, 5.5f}};
+    std::string rows, heap;
+    for (auto const& spectrum : spectra)
+    {
+        if (long_descriptors)
+        {
+            rows += fits_big_endian(std::vector<std::int64_t>{
+                static_cast<std::int64_t>(spectrum.size()), static_cast<std::int64_t>(heap.size())});
+        }
+        else
+        {
+            rows += fits_big_endian(std::vector<std::int32_t>{
+                static_cast<std::int32_t>(spectrum.size()), static_cast<std::int32_t>(heap.size())});
+        }
+        rows += fits_big_endian(std::vector<std::int16_t>{static_cast<std::int16_t>(spectrum.size())});
+        heap += fits_big_endian(spectrum);
+    }
+
+    std::size_t const row_length = long_descriptors ? 18 : 10;
+    std::string content = fits_header({
+        fits_card("SIMPLE", "T"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "0"),
+        fits_card("EXTEND", "T")
+    });
+    content += fits_header({
+        fits_card("XTENSION", "'BINTABLE'"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", std::to_string(row_length)),
+        fits_card("NAXIS2", "3"),
+        fits_card("PCOUNT", std::to_string(heap.size() + 6)),
+        fits_card("GCOUNT", "1"),
+        fits_card("TFIELDS", "2"),
+        fits_card("TFORM1", long_descriptors ? "'1QE(3)'" : "'1PE(3)'"),
+        fits_card("TTYPE1", "'SPECTRUM'"),
+        fits_card("TFORM2", "'I'"),
+        fits_card("TTYPE2", "'LENGTH'"),
+        fits_card("THEAP", std::to_string(3 * row_length + 6)),
+        fits_card("EXTNAME", "'SPECTRA'")
+    });
+    return content + fits_pad_data(rows + std::string(6, '\0') + heap);
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(binary_table_heap)
+
+BOOST_AUTO_TEST_CASE(variable_length_arrays)
+{
+    for (bool long_descriptors : {false, true})
+    {
+        fits_test_file file("binary_table_heap.fits", spectra_file(long_descriptors));
+        fits fits_file(file.path, fits_open_mode::directory);
+        auto table = load_table(fits_file);
+        BOOST_REQUIRE(table != nullptr);
+        BOOST_TEST(table->get_descriptors()[0].array_type == 'E');
+
+        column_view<float> first = table->get_array_view<float>("SPECTRUM", 0);
+        BOOST_TEST(first.size() == 3u);
+        BOOST_TEST(first[2] == 3.0f);
+        BOOST_TEST(table->get_array_view<float>("SPECTRUM", 1).empty());
+        BOOST_TEST(table->get_array_view<float>("SPECTRUM", 2)[0] == -4.5f);
+
+        variable_arrays<float> arrays = table->read_arrays<float>("SPECTRUM");
+        BOOST_TEST(arrays.rows() == 3u);
+        BOOST_TEST(arrays.offsets == (std::vector<std::size_t>{0, 3, 3, 5}));
+        BOOST_TEST(arrays.values == (std::vector<float>{1.0f, 2.0f, 3.0f, -4.5f, 5.5f}));
+        BOOST_TEST(arrays.length(2) == 2u);
+        BOOST_TEST(arrays.data(2)[1] == 5.5f);
+
+        BOOST_CHECK_THROW(table->read_arrays<double>("SPECTRUM"),
+            boost::astronomy::invalid_table_colum_format);
+        BOOST_CHECK_THROW(table->read_arrays<std::int16_t>("LENGTH"),
+            boost::astronomy::invalid_table_colum_format);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(corrupt_array_descriptors)
+{
+    //count and offset of the first row, the table data starts after two header blocks
+    std::vector<std::pair<std::int64_t, std::int64_t>> const corrupt{{4, -20}, {-1, 0},
+        {3, 1000}, {0x7fffffff, 0}, {2, 14}};
+    for (bool long_descriptors : {false, true})
+    {
+        for (auto const& descriptor : corrupt)
+        {
+            std::string content = spectra_file(long_descriptors);
+            std::string const stored = long_descriptors ?
+                fits_big_endian(std::vector<std::int64_t>{descriptor.first, descriptor.second}) :
+                fits_big_endian(std::vector<std::int32_t>{
+                    static_cast<std::int32_t>(descriptor.first),
+                    static_cast<std::int32_t>(descriptor.second)});
+            content.replace(2 * 2880, stored.size(), stored);
+
+            fits_test_file file("binary_table_corrupt_heap.fits", content);
+            fits fits_file(file.path, fits_open_mode::directory);
+            auto table = load_table(fits_file);
+            BOOST_REQUIRE(table != nullptr);
+            BOOST_CHECK_THROW(table->read_arrays<float>("SPECTRUM"),
+                boost::astronomy::unexpected_end_of_data_exception);
+            BOOST_CHECK_THROW(table->get_array_view<float>("SPECTRUM", 0),
+                boost::astronomy::unexpected_end_of_data_exception);
+            BOOST_TEST(table->get_array_view<float>("SPECTRUM", 2)[0] == -4.5f);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,193 @@
+#define BOOST_TEST_MODULE catalog_columns_test
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <cstdint>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/units/quantity.hpp>
+#include <boost/units/systems/si/plane_angle.hpp>
+#include <boost/units/systems/si/length.hpp>
+#include <boost/units/base_units/astronomical/parsec.hpp>
+#include <boost/astronomy/io/fits.hpp>
+#include <boost/astronomy/coordinate/catalog_columns.hpp>
+#include <boost/astronomy/coordinate/frame_transform.hpp>
+#include <boost/astronomy/coordinate/representation_batch.hpp>
+
+#include "fits_test_file.hpp"
+
+using namespace boost::astronomy::io;
+using namespace boost::astronomy::coordinate;
+using namespace boost::units;
+
+namespace {
+
+typedef boost::units::astronomical::parsec_base_unit::unit_type parsec_unit;
+typedef spherical_equatorial_representation_batch<double, quantity<si::plane_angle>,
+    quantity<si::plane_angle>, quantity<parsec_unit>> parsec_batch;
+
+std::size_t const table_rows = 5000;
+double const degree_to_radian = 0.017453292519943295;
+double const mas_per_year = 4.84813681109536e-9 / 31557600.0;
+
+double star_ra(std::size_t row) { return std::fmod(0.7548776662466927 * static_cast<double>(row), 1.0) * 360; }
+double star_dec(std::size_t row) { return std::fmod(0.6180339887498949 * static_cast<double>(row), 1.0) * 180 - 90; }
+double star_parallax(std::size_t row) { return row % 10 == 0 ? -0.5 : 0.1 + static_cast<double>(row % 97); }
+double star_pmra(std::size_t row) { return static_cast<double>(row % 31) * 10 - 150; }
+double star_pmdec(std::size_t row) { return 200 - static_cast<double>(row % 17) * 20; }
+
+//! row of 4 + 5 * 8 = 44 bytes
+std::string table_row(std::size_t row)
+{
+    std::string bytes = fits_big_endian(std::vector<std::int32_t>{static_cast<std::int32_t>(row)});
+    bytes += fits_big_endian(std::vector<double>{star_ra(row), star_dec(row), star_parallax(row),
+        star_pmra(row), star_pmdec(row)});
+    return bytes;
+}
+
+std::string catalog_file()
+{
+    std::string content = fits_header({
+        fits_card("SIMPLE", "T"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "0"),
+        fits_card("EXTEND", "T")
+    });
+    content += fits_header({
+        fits_card("XTENSION", "'BINTABLE'"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", "44"),
+        fits_card("NAXIS2", std::to_string(table_rows)),
+        fits_card("PCOUNT", "0"),
+        fits_card("GCOUNT", "1"),
+        fits_card("TFIELDS", "6"),
+        fits_card("TFORM1", "'J'"),
+        fits_card("TTYPE1", "'SOURCE_ID'"),
+        fits_card("TFORM2", "'D'"),
+        fits_card("TTYPE2", "'RA'"),
+        fits_card("TFORM3", "'D'"),
+        fits_card("TTYPE3", "'DEC'"),
+        fits_card("TFORM4", "'D'"),
+        fits_card("TTYPE4", "'PARALLAX'"),
+        fits_card("TFORM5", "'D'"),
+        fits_card("TTYPE5", "'PMRA'"),
+        fits_card("TFORM6", "'D'"),
+        fits_card("TTYPE6", "'PMDEC'"),
+        fits_card("EXTNAME", "'GAIA'")
+    });
+
+    std::string rows;
+    for (std::size_t row = 0; row < table_rows; row++)
+    {
+        rows += table_row(row);
+    }
+    return content + fits_pad_data(rows);
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(catalog_columns_to_batches)
+
+BOOST_AUTO_TEST_CASE(positions_and_motions)
+{
+    fits_test_file file("catalog_columns_read.fits", catalog_file());
+    fits fits_file(file.path, fits_open_mode::directory);
+    auto table = std::dynamic_pointer_cast<binary_table_extension>(fits_file.get_hdu(1));
+    BOOST_REQUIRE(table != nullptr);
+
+    catalog_columns<> const columns = make_catalog_columns(*table, "RA", "DEC", "PARALLAX",
+        "PMRA", "PMDEC");
+    BOOST_REQUIRE_EQUAL(columns.rows(), table_rows);
+    BOOST_TEST(columns.radial_velocity.empty());
+
+    parsec_batch positions;
+    space_motion_batch<double> motions;
+    read_catalog(columns, positions, motions);
+    BOOST_REQUIRE_EQUAL(positions.size(), table_rows);
+    BOOST_REQUIRE_EQUAL(motions.size(), table_rows);
+    for (std::size_t row = 0; row < table_rows; row++)
+    {
+        BOOST_REQUIRE_CLOSE(positions.data<0>()[row], star_ra(row) * degree_to_radian, 1e-12);
+        BOOST_REQUIRE_CLOSE(positions.data<1>()[row], star_dec(row) * degree_to_radian, 1e-12);
+        if (star_parallax(row) > 0)
+        {
+            //a parallax of 1 arcsecond is at 1 parsec
+            BOOST_REQUIRE_CLOSE(positions.data<2>()[row], 1000 / star_parallax(row), 1e-6);
+        }
+        else
+        {
+            BOOST_REQUIRE_EQUAL(positions.data<2>()[row], 0.0);
+        }
+        BOOST_REQUIRE_CLOSE(motions.pm_lon_coslat_data()[row], star_pmra(row) * mas_per_year, 1e-12);
+        BOOST_REQUIRE_CLOSE(motions.pm_lat_data()[row], star_pmdec(row) * mas_per_year, 1e-12);
+        BOOST_REQUIRE_EQUAL(motions.radial_velocity_data()[row], 0.0);
+    }
+
+    //dimensionless batches lie on the unit sphere
+    spherical_equatorial_representation_batch<float, quantity<si::plane_angle, float>,
+        quantity<si::plane_angle, float>, quantity<si::dimensionless, float>> directions;
+    read_catalog(columns, directions);
+    BOOST_REQUIRE_EQUAL(directions.size(), table_rows);
+    BOOST_CHECK_EQUAL(directions.data<2>()[7], 1.0f);
+    BOOST_CHECK_CLOSE(directions.data<1>()[7], static_cast<float>(star_dec(7) * degree_to_radian),
+        1e-4);
+
+    //other units of the columns
+    catalog_units radian_columns;
+    radian_columns.angle = 1;
+    parsec_batch raw;
+    read_catalog(columns, raw, radian_columns);
+    BOOST_CHECK_CLOSE(raw.data<0>()[3], star_ra(3), 1e-12);
+
+    BOOST_CHECK_THROW(make_catalog_columns(*table, "RA", "DE"),
+        boost::astronomy::key_not_defined_exception);
+    BOOST_CHECK_THROW(make_catalog_columns<float>(*table, "RA", "DEC"),
+        boost::astronomy::invalid_table_colum_format);
+}
+
+BOOST_AUTO_TEST_CASE(blocks_through_kernels)
+{
+    fits_test_file file("catalog_columns_blocks.fits", catalog_file());
+    fits fits_file(file.path, fits_open_mode::directory);
+    auto table = std::dynamic_pointer_cast<binary_table_extension>(fits_file.get_hdu(1));
+    BOOST_REQUIRE(table != nullptr);
+    catalog_columns<> const columns = make_catalog_columns(*table, "RA", "DEC", "PARALLAX",
+        "PMRA", "PMDEC");
+
+    //the whole catalogue propagated and rotated at once
+    double const seconds = 10 * 31557600.0;
+    parsec_batch positions;
+    space_motion_batch<double> motions;
+    read_catalog(columns, positions, motions);
+    propagate_epoch(positions, motions, seconds);
+    parsec_batch const expected = transform_batch<icrs_axes, galactic_axes>(positions);
+
+    //the same kernels applied to every block while it is decoded
+    parsec_batch streamed(columns.rows());
+    std::vector<std::size_t> firsts;
+    for_each_catalog_block<parsec_batch>(columns,
+        [&](parsec_batch& block, space_motion_batch<double>& block_motions, std::size_t first) {
+            firsts.push_back(first);
+            propagate_epoch(block, block_motions, seconds);
+            parsec_batch const rotated = transform_batch<icrs_axes, galactic_axes>(block);
+            std::copy(rotated.data<0>(), rotated.data<0>() + rotated.size(),
+                streamed.data<0>() + first);
+            std::copy(rotated.data<1>(), rotated.data<1>() + rotated.size(),
+                streamed.data<1>() + first);
+        }, catalog_units(), 1000);
+
+    BOOST_CHECK_EQUAL(firsts.size(), 5u);
+    BOOST_CHECK_EQUAL(firsts.back(), 4000u);
+    BOOST_REQUIRE_EQUAL(streamed.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); i++)
+    {
+        BOOST_CHECK_SMALL(streamed.data<0>()[i] - expected.data<0>()[i], 1e-13);
+        BOOST_CHECK_SMALL(streamed.data<1>()[i] - expected.data<1>()[i], 1e-13);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,162 @@
+#define BOOST_TEST_MODULE checksum_test
+
+#include <string>
+#include <vector>
+#include <cctype>
+#include <cstdint>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/checksum.hpp>
+#include <boost/astronomy/io/mapped_fits.hpp>
+#include <boost/astronomy/io/fits_writer.hpp>
+
+#include "fits_test_file.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace {
+
+//! checksum computed with the 16 bit halves of the words as in the FITS checksum convention
+std::uint32_t reference_checksum(std::string const& data)
+{
+    std::uint64_t hi = 0;
+    std::uint64_t lo = 0;
+    for (std::size_t i = 0; i + 3 < data.size(); i += 4)
+    {
+        auto byte = [&](std::size_t j) {
+            return static_cast<std::uint64_t>(static_cast<unsigned char>(data[i + j]));
+        };
+        hi += (byte(0) << 8) + byte(1);
+        lo += (byte(2) << 8) + byte(3);
+    }
+    std::uint64_t hicarry = hi >> 16;
+    std::uint64_t locarry = lo >> 16;
+    while (hicarry != 0 || locarry != 0)
+    {
+        hi = (hi & 0xffff) + locarry;
+        lo = (lo & 0xffff) + hicarry;
+        hicarry = hi >> 16;
+        locarry = lo >> 16;
+    }
+    return static_cast<std::uint32_t>((hi << 16) + lo);
+}
+
+std::string pseudo_random_bytes(std::size_t size)
+{
+    std::string bytes(size, '\0');
+    std::uint32_t state = 12345;
+    for (auto& byte : bytes)
+    {
+        state = state * 1664525u + 1013904223u;
+        byte = static_cast<char>(state >> 24);
+    }
+    return bytes;
+}
+
+std::vector<card> image_cards(std::size_t width, std::size_t height)
+{
+    std::vector<card> cards(4);
+    cards[0].create_card("SIMPLE", true);
+    cards[1].create_card("BITPIX", 16);
+    cards[2].create_card("NAXIS", 2);
+    cards[3].create_card("NAXIS1", width);
+    cards.emplace_back();
+    cards.back().create_card("NAXIS2", height);
+    cards.emplace_back("OBJECT", "'M31     '");
+    return cards;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(fits_checksum_matches_reference_in_parallel)
+{
+    std::string const data = pseudo_random_bytes(2880 * 1100);
+    std::uint32_t const expected = reference_checksum(data);
+    BOOST_TEST(fits_checksum(data.data(), data.size()) == expected);
+    BOOST_TEST(fits_checksum(data.data(), data.size(), 4) == expected);
+
+    std::size_t const split = 2880 * 300 + 4 * 17;
+    BOOST_TEST(checksum_add(fits_checksum(data.data(), split),
+        fits_checksum(data.data() + split, data.size() - split)) == expected);
+
+    // a partial word counts as if completed with zero padding
+    std::string const odd = data.substr(0, 2881 * 3);
+    BOOST_TEST(fits_checksum(odd.data(), odd.size()) == reference_checksum(fits_pad_data(odd)));
+}
+
+BOOST_AUTO_TEST_CASE(checksum_cards_complement_the_header)
+{
+    std::string const data = fits_pad_data(fits_big_endian(std::vector<std::int16_t>(
+        {1, -2, 300, 32767, -32768, 7})));
+    std::vector<card> const cards = checksum_cards(image_cards(3, 2),
+        fits_checksum(data.data(), data.size()));
+
+    std::string header;
+    for (auto const& header_card : cards)
+    {
+        header.append(header_card.data(), 80);
+    }
+    header.append(hdu::block_aligned_size(header.size()) - header.size(), ' ');
+    BOOST_TEST(reference_checksum(header + data) == 0xffffffffu);
+
+    BOOST_REQUIRE_EQUAL(cards.size(), 9u);
+    BOOST_TEST(cards[6].key_is("CHECKSUM"));
+    BOOST_TEST(cards[7].key_is("DATASUM"));
+    BOOST_TEST(cards[8].key_is("END"));
+    std::string const encoded(cards[6].data() + 11, 16);
+    for (char c : encoded)
+    {
+        BOOST_TEST(std::isalnum(static_cast<unsigned char>(c)) != 0);
+    }
+
+    // existing cards are updated in place
+    BOOST_TEST(checksum_cards(cards, 0).size() == cards.size());
+}
+
+BOOST_AUTO_TEST_CASE(verify_checksums_of_written_file)
+{
+    std::vector<std::int16_t> pixels(40 * 30);
+    for (std::size_t i = 0; i < pixels.size(); i++)
+    {
+        pixels[i] = static_cast<std::int16_t>(i * 37);
+    }
+    std::string const data = fits_big_endian(pixels);
+    fits_test_file cleanup("checksum_written.fits", "");
+    {
+        fits_writer writer(cleanup.path);
+        write_checksummed(writer, image_cards(40, 30), data.data(), data.size(), 2);
+        writer.close();
+    }
+
+    buffered_fits const fits(cleanup.path);
+    std::vector<hdu_checksum> const results = verify_checksums(fits);
+    BOOST_REQUIRE_EQUAL(results.size(), 1u);
+    BOOST_TEST((results[0].checksum == checksum_state::valid));
+    BOOST_TEST((results[0].datasum == checksum_state::valid));
+    BOOST_TEST(results[0].valid());
+    BOOST_TEST(results[0].data_sum == fits_checksum(data.data(), data.size()));
+
+    std::vector<char> corrupted = buffered_fits::read_file(cleanup.path);
+    corrupted[2880 + 100] ^= 0x10;
+    std::vector<hdu_checksum> const bad = verify_checksums(buffered_fits(std::move(corrupted)), 1);
+    BOOST_TEST((bad[0].checksum == checksum_state::invalid));
+    BOOST_TEST((bad[0].datasum == checksum_state::invalid));
+    BOOST_TEST(!bad[0].valid());
+}
+
+BOOST_AUTO_TEST_CASE(missing_cards_are_reported)
+{
+    std::string const content = fits_header({
+        fits_card("SIMPLE", "                   T"),
+        fits_card("BITPIX", "                   8"),
+        fits_card("NAXIS", "                   1"),
+        fits_card("NAXIS1", "                   5")
+    }) + fits_pad_data("abcde");
+    buffered_fits const fits(std::vector<char>(content.begin(), content.end()));
+
+    hdu_checksum const result = verify_checksums(fits)[0];
+    BOOST_TEST((result.checksum == checksum_state::missing));
+    BOOST_TEST((result.datasum == checksum_state::missing));
+    BOOST_TEST(result.valid());
+    BOOST_TEST(result.data_sum == reference_checksum(fits_pad_data("abcde")));
+}
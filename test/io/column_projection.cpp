@@ -0,0 +1,128 @@
+#define BOOST_TEST_MODULE column_projection_test
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <complex>
+#include <cstdint>
+#include <cstring>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/fits.hpp>
+
+#include "fits_test_file.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace {
+
+std::size_t const table_rows = 1000;
+
+//! row of 4 + 8 + 6 + 8 + 8 = 34 bytes
+std::string table_row(std::size_t row)
+{
+    std::string bytes = fits_big_endian(std::vector<std::int32_t>{static_cast<std::int32_t>(row)});
+    bytes += fits_big_endian(std::vector<double>{0.5 * static_cast<double>(row)});
+    bytes += fits_big_endian(std::vector<std::int16_t>{
+        static_cast<std::int16_t>(row), 32, static_cast<std::int16_t>(-static_cast<int>(row))});
+    bytes += std::string("  OBJ") + std::to_string(row % 10) + "  ";
+    bytes += fits_big_endian(std::vector<float>{static_cast<float>(row), -1.0f});
+    return bytes;
+}
+
+std::string catalog_file()
+{
+    std::string content = fits_header({
+        fits_card("SIMPLE", "T"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "0"),
+        fits_card("EXTEND", "T")
+    });
+    content += fits_header({
+        fits_card("XTENSION", "'BINTABLE'"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", "34"),
+        fits_card("NAXIS2", std::to_string(table_rows)),
+        fits_card("PCOUNT", "0"),
+        fits_card("GCOUNT", "1"),
+        fits_card("TFIELDS", "5"),
+        fits_card("TFORM1", "'J'"),
+        fits_card("TTYPE1", "'ID'"),
+        fits_card("TFORM2", "'D'"),
+        fits_card("TTYPE2", "'RA'"),
+        fits_card("TFORM3", "'3I'"),
+        fits_card("TTYPE3", "'FLAGS'"),
+        fits_card("TFORM4", "'8A'"),
+        fits_card("TTYPE4", "'NAME    '"),
+        fits_card("TFORM5", "'C'"),
+        fits_card("TTYPE5", "'GAIN'"),
+        fits_card("EXTNAME", "'CATALOG'")
+    });
+
+    std::string rows;
+    for (std::size_t row = 0; row < table_rows; row++)
+    {
+        rows += table_row(row);
+    }
+    return content + fits_pad_data(rows);
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(binary_table_column_projection)
+
+BOOST_AUTO_TEST_CASE(selected_columns)
+{
+    fits_test_file file("column_projection_selected.fits", catalog_file());
+    fits fits_file(file.path, fits_open_mode::directory);
+
+    std::vector<double> ra;
+    std::vector<std::int16_t> flags;
+    std::vector<char> names;
+    std::vector<std::complex<float>> gain;
+
+    binary_table_projection projection = fits_file.project_columns(1);
+    projection.add("RA", ra).add("FLAGS", flags).add("NAME", names).add("GAIN", gain);
+    projection.read(64);
+
+    BOOST_REQUIRE_EQUAL(ra.size(), table_rows);
+    BOOST_REQUIRE_EQUAL(flags.size(), 3 * table_rows);
+    BOOST_REQUIRE_EQUAL(names.size(), 8 * table_rows);
+    for (std::size_t row = 0; row < table_rows; row++)
+    {
+        BOOST_REQUIRE_EQUAL(ra[row], 0.5 * static_cast<double>(row));
+        BOOST_REQUIRE_EQUAL(flags[3 * row], static_cast<std::int16_t>(row));
+        BOOST_REQUIRE_EQUAL(flags[3 * row + 1], 32);
+        BOOST_REQUIRE_EQUAL(flags[3 * row + 2], -static_cast<int>(row));
+        BOOST_REQUIRE_EQUAL(std::string(names.data() + 8 * row, 8),
+            "  OBJ" + std::to_string(row % 10) + "  ");
+        BOOST_REQUIRE(gain[row] == std::complex<float>(static_cast<float>(row), -1.0f));
+    }
+    BOOST_TEST(!fits_file.get_directory()[1].loaded);
+}
+
+BOOST_AUTO_TEST_CASE(invalid_requests)
+{
+    fits_test_file file("column_projection_invalid.fits", catalog_file());
+    fits fits_file(file.path, fits_open_mode::directory);
+
+    std::vector<float> values;
+    binary_table_projection projection = fits_file.project_columns(1);
+    BOOST_CHECK_THROW(projection.add("RA", values), boost::astronomy::invalid_table_colum_format);
+    BOOST_CHECK_THROW(projection.add("DEC", values), boost::astronomy::key_not_defined_exception);
+    BOOST_CHECK_THROW(fits_file.project_columns(0), boost::astronomy::wrong_extension_type);
+}
+
+BOOST_AUTO_TEST_CASE(table_loaded_with_whitespace_bytes)
+{
+    std::string content = catalog_file();
+    fits_test_file file("column_projection_whitespace.fits", content);
+    fits fits_file(file.path, fits_open_mode::directory);
+
+    auto table = std::dynamic_pointer_cast<binary_table_extension>(fits_file.get_hdu(1));
+    BOOST_REQUIRE(table != nullptr);
+    BOOST_TEST(std::memcmp(table->table_data(), content.data() + 2 * 2880, 34 * table_rows) == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,423 @@
+#define BOOST_TEST_MODULE compressed_image_test
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <limits>
+#include <cstdint>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/fits.hpp>
+#include <boost/astronomy/io/compressed_image.hpp>
+
+#include "fits_test_file.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace {
+
+//! writes bits most significant first
+struct bit_writer
+{
+    std::string bytes;
+    std::uint64_t buffer = 0;
+    int used = 0;
+
+    void put(std::uint64_t value, int bits)
+    {
+        for (int i = bits - 1; i >= 0; i--)
+        {
+            buffer = (buffer << 1) | ((value >> i) & 1);
+            if (++used == 8)
+            {
+                bytes.push_back(static_cast<char>(buffer));
+                buffer = 0;
+                used = 0;
+            }
+        }
+    }
+
+    std::string finish()
+    {
+        if (used > 0)
+        {
+            put(0, 8 - used);
+        }
+        return bytes;
+    }
+};
+
+//! Rice encoder following the FITS tiled image convention (reference for the decoder)
+template <typename T>
+std::string rice_encode(std::vector<T> const& pixels, std::size_t block_size)
+{
+    typedef typename boost::astronomy::detail::unsigned_by_size<sizeof(T)>::type unsigned_type;
+    int const fsbits = sizeof(T) == 1 ? 3 : (sizeof(T) == 2 ? 4 : 5);
+    int const fsmax = sizeof(T) == 1 ? 6 : (sizeof(T) == 2 ? 14 : 25);
+    int const bbits = 8 * static_cast<int>(sizeof(T));
+    std::uint64_t const mask = std::numeric_limits<unsigned_type>::max();
+
+    bit_writer writer;
+    std::uint64_t last = static_cast<unsigned_type>(pixels[0]);
+    writer.put(last, bbits);
+
+    for (std::size_t begin = 0; begin < pixels.size(); begin += block_size)
+    {
+        std::size_t const end = std::min(pixels.size(), begin + block_size);
+        std::vector<std::uint64_t> mapped;
+        std::uint64_t sum = 0;
+        for (std::size_t i = begin; i < end; i++)
+        {
+            std::uint64_t const value = static_cast<unsigned_type>(pixels[i]);
+            std::uint64_t const difference = (value - last) & mask;
+            last = value;
+            //zig zag mapping of signed difference
+            bool const negative = (difference >> (bbits - 1)) & 1;
+            mapped.push_back(negative ? ((~difference & mask) << 1) | 1 : difference << 1);
+            mapped.back() &= mask;
+            sum += mapped.back();
+        }
+
+        std::uint64_t const mean = sum / mapped.size();
+        int fs = 0;
+        while ((mean >> fs) > 1)
+        {
+            fs++;
+        }
+
+        if (sum == 0)
+        {
+            writer.put(0, fsbits);
+        }
+        else if (fs >= fsmax || mean > mask / 4)
+        {
+            writer.put(static_cast<std::uint64_t>(fsmax + 1), fsbits);
+            for (std::uint64_t value : mapped)
+            {
+                writer.put(value, bbits);
+            }
+        }
+        else
+        {
+            writer.put(static_cast<std::uint64_t>(fs + 1), fsbits);
+            for (std::uint64_t value : mapped)
+            {
+                writer.put(0, static_cast<int>(value >> fs));
+                writer.put(1, 1);
+                writer.put(value & ((std::uint64_t(1) << fs) - 1), fs);
+            }
+        }
+    }
+    return writer.finish();
+}
+
+//! binary table of a 2D image of width x height pixels split in tiles of tile_width x tile_height
+//! byte_pixels is written as BYTEPIX unless it is 0
+template <typename T>
+std::string compressed_file
+(
+    std::vector<T> const& image,
+    std::size_t width,
+    std::size_t height,
+    std::size_t tile_width,
+    std::size_t tile_height,
+    std::string const& algorithm,
+    std::string (*encode)(std::vector<T> const&),
+    bool long_descriptors = false,
+    std::size_t byte_pixels = sizeof(T)
+)
+{
+    std::string rows, heap;
+    std::size_t tiles = 0;
+    for (std::size_t y = 0; y < height; y += tile_height)
+    {
+        for (std::size_t x = 0; x < width; x += tile_width)
+        {
+            std::vector<T> tile;
+            for (std::size_t row = y; row < std::min(height, y + tile_height); row++)
+            {
+                for (std::size_t column = x; column < std::min(width, x + tile_width); column++)
+                {
+                    tile.push_back(image[row * width + column]);
+                }
+            }
+            std::string const bytes = encode(tile);
+            if (long_descriptors)
+            {
+                rows += fits_big_endian(std::vector<std::int64_t>{
+                    static_cast<std::int64_t>(bytes.size()),
+                    static_cast<std::int64_t>(heap.size())});
+            }
+            else
+            {
+                rows += fits_big_endian(std::vector<std::int32_t>{
+                    static_cast<std::int32_t>(bytes.size()),
+                    static_cast<std::int32_t>(heap.size())});
+            }
+            heap += bytes;
+            tiles++;
+        }
+    }
+
+    std::string content = fits_header({
+        fits_card("SIMPLE", "T"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "0"),
+        fits_card("EXTEND", "T")
+    });
+    std::vector<std::string> cards = {
+        fits_card("XTENSION", "'BINTABLE'"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", long_descriptors ? "16" : "8"),
+        fits_card("NAXIS2", std::to_string(tiles)),
+        fits_card("PCOUNT", std::to_string(heap.size())),
+        fits_card("GCOUNT", "1"),
+        fits_card("TFIELDS", "1"),
+        fits_card("TFORM1", std::string(long_descriptors ? "'1QB(" : "'1PB(") +
+            std::to_string(heap.size()) + ")'"),
+        fits_card("TTYPE1", "'COMPRESSED_DATA'"),
+        fits_card("ZIMAGE", "T"),
+        fits_card("ZBITPIX", std::to_string(8 * sizeof(T))),
+        fits_card("ZNAXIS", "2"),
+        fits_card("ZNAXIS1", std::to_string(width)),
+        fits_card("ZNAXIS2", std::to_string(height)),
+        fits_card("ZTILE1", std::to_string(tile_width)),
+        fits_card("ZTILE2", std::to_string(tile_height)),
+        fits_card("ZCMPTYPE", "'" + algorithm + "'"),
+        fits_card("ZNAME1", "'BLOCKSIZE'"),
+        fits_card("ZVAL1", "16"),
+        fits_card("EXTNAME", "'COMPRESSED_IMAGE'")
+    };
+    if (byte_pixels != 0)
+    {
+        cards.push_back(fits_card("ZNAME2", "'BYTEPIX'"));
+        cards.push_back(fits_card("ZVAL2", std::to_string(byte_pixels)));
+    }
+    content += fits_header(cards);
+    return content + fits_pad_data(rows + heap);
+}
+
+template <typename T>
+std::string rice_16(std::vector<T> const& pixels)
+{
+    return rice_encode(pixels, 16);
+}
+
+//! Rice coding of the pixels converted to Coded integers
+template <typename Coded, typename T>
+std::string rice_as(std::vector<T> const& pixels)
+{
+    return rice_encode(std::vector<Coded>(pixels.begin(), pixels.end()), 16);
+}
+
+//! image with smooth areas, noise and a few huge jumps to exercise all Rice block kinds
+template <typename T>
+std::vector<T> test_image(std::size_t width, std::size_t height)
+{
+    std::vector<T> image(width * height);
+    std::uint32_t state = 12345;
+    for (std::size_t i = 0; i < image.size(); i++)
+    {
+        state = state * 1103515245u + 12345u;
+        std::size_t const row = i / width;
+        if (row < 3)
+        {
+            image[i] = static_cast<T>(100);
+        }
+        else if (row < 6)
+        {
+            image[i] = static_cast<T>(1000 + (state >> 16) % 50);
+        }
+        else
+        {
+            image[i] = static_cast<T>(state);
+        }
+    }
+    return image;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(compressed_image_rice)
+
+BOOST_AUTO_TEST_CASE(rice_tiles_decode)
+{
+    std::size_t const width = 37, height = 11;
+    auto const image = test_image<std::int16_t>(width, height);
+    fits_test_file file("compressed_rice_16.fits",
+        compressed_file(image, width, height, 10, 4, "RICE_1", &rice_16<std::int16_t>));
+
+    fits fits_file(file.path, fits_open_mode::directory);
+    BOOST_TEST(fits_file.read_compressed_image<bitpix::B16>(1, 3) == image);
+
+    auto table = std::dynamic_pointer_cast<binary_table_extension>(fits_file.get_hdu(1));
+    compressed_image<bitpix::B16> compressed(*table);
+    BOOST_TEST(compressed.tile_count() == 12u);
+    BOOST_TEST((compressed.get_compression() == tile_compression::rice_1));
+
+    BOOST_CHECK_THROW(compressed_image<bitpix::B32>{*table}, boost::astronomy::wrong_extension_type);
+}
+
+BOOST_AUTO_TEST_CASE(rice_pixel_sizes)
+{
+    std::size_t const width = 20, height = 9;
+    auto const image32 = test_image<std::int32_t>(width, height);
+    fits_test_file file32("compressed_rice_32.fits",
+        compressed_file(image32, width, height, 20, 1, "RICE_1", &rice_16<std::int32_t>));
+    fits fits32(file32.path, fits_open_mode::directory);
+    BOOST_TEST(fits32.read_compressed_image<bitpix::B32>(1, 1) == image32);
+
+    auto const image8 = test_image<std::uint8_t>(width, height);
+    fits_test_file file8("compressed_rice_8.fits",
+        compressed_file(image8, width, height, 7, 3, "RICE_ONE", &rice_16<std::uint8_t>));
+    fits fits8(file8.path, fits_open_mode::directory);
+    BOOST_TEST(fits8.read_compressed_image<bitpix::B8>(1, 2) == image8);
+}
+
+BOOST_AUTO_TEST_CASE(rice_byte_pixels)
+{
+    std::size_t const width = 20, height = 9;
+
+    //without BYTEPIX the pixels were coded as 4 byte integers
+    auto const image16 = test_image<std::int16_t>(width, height);
+    fits_test_file file16("compressed_rice_default_bytepix.fits", compressed_file(image16, width,
+        height, 10, 3, "RICE_1", &rice_as<std::int32_t, std::int16_t>, false, 0));
+    fits fits16(file16.path, fits_open_mode::directory);
+    BOOST_TEST(fits16.read_compressed_image<bitpix::B16>(1) == image16);
+
+    auto const image8 = test_image<std::uint8_t>(width, height);
+    fits_test_file file8("compressed_rice_8_as_32.fits", compressed_file(image8, width,
+        height, 7, 3, "RICE_1", &rice_as<std::int32_t, std::uint8_t>, false, 4));
+    fits fits8(file8.path, fits_open_mode::directory);
+    BOOST_TEST(fits8.read_compressed_image<bitpix::B8>(1) == image8);
+
+    std::vector<std::int32_t> image32(image16.begin(), image16.end());
+    fits_test_file file32("compressed_rice_32_as_16.fits", compressed_file(image32, width,
+        height, 20, 1, "RICE_1", &rice_as<std::int16_t, std::int32_t>, false, 2));
+    fits fits32(file32.path, fits_open_mode::directory);
+    BOOST_TEST(fits32.read_compressed_image<bitpix::B32>(1) == image32);
+
+    fits_test_file odd("compressed_rice_odd_bytepix.fits", compressed_file(image32, width,
+        height, 20, 1, "RICE_1", &rice_16<std::int32_t>, false, 3));
+    fits odd_file(odd.path, fits_open_mode::directory);
+    auto table = std::dynamic_pointer_cast<binary_table_extension>(odd_file.get_hdu(1));
+    BOOST_CHECK_THROW(compressed_image<bitpix::B32>{*table},
+        boost::astronomy::unsupported_compression_exception);
+}
+
+BOOST_AUTO_TEST_CASE(long_descriptor_tiles)
+{
+    std::size_t const width = 37, height = 11;
+    auto const image = test_image<std::int16_t>(width, height);
+    fits_test_file file("compressed_rice_long.fits",
+        compressed_file(image, width, height, 10, 4, "RICE_1", &rice_16<std::int16_t>, true));
+
+    fits fits_file(file.path, fits_open_mode::directory);
+    BOOST_TEST(fits_file.read_compressed_image<bitpix::B16>(1, 2) == image);
+    auto const pixels = fits_file.read_compressed_section<bitpix::B16>(1,
+        image_section({8, 2}, {15, 5}));
+    BOOST_TEST(pixels[16] == image[3 * width + 9]);
+}
+
+BOOST_AUTO_TEST_CASE(section_decodes_overlapping_tiles)
+{
+    std::size_t const width = 37, height = 11;
+    auto const image = test_image<std::int16_t>(width, height);
+    fits_test_file file("compressed_rice_section.fits",
+        compressed_file(image, width, height, 10, 4, "RICE_1", &rice_16<std::int16_t>));
+    fits fits_file(file.path, fits_open_mode::directory);
+
+    image_section const section({8, 2}, {15, 5});
+    auto const pixels = fits_file.read_compressed_section<bitpix::B16>(1, section, 2);
+    BOOST_REQUIRE_EQUAL(pixels.size(), 75u);
+    for (std::size_t y = 0; y < 5; y++)
+    {
+        for (std::size_t x = 0; x < 15; x++)
+        {
+            BOOST_TEST(pixels[y * 15 + x] == image[(y + 2) * width + x + 8]);
+        }
+    }
+
+    BOOST_CHECK_THROW(fits_file.read_compressed_section<bitpix::B16>(1, image_section({30, 0}, {8, 1})),
+        boost::astronomy::invalid_image_section_exception);
+}
+
+BOOST_AUTO_TEST_CASE(corrupt_tile)
+{
+    std::vector<std::int16_t> const image(64, 5);
+    auto truncated = [](std::vector<std::int16_t> const& pixels) -> std::string {
+        return rice_encode(pixels, 16).substr(0, 1);
+    };
+    fits_test_file file("compressed_rice_corrupt.fits",
+        compressed_file(image, 8, 8, 8, 8, "RICE_1",
+            static_cast<std::string (*)(std::vector<std::int16_t> const&)>(truncated)));
+    fits fits_file(file.path, fits_open_mode::directory);
+    BOOST_CHECK_THROW(fits_file.read_compressed_image<bitpix::B16>(1),
+        boost::astronomy::invalid_compressed_tile_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#if defined(BOOST_ASTRONOMY_HAS_ZLIB)
+namespace {
+
+template <typename T>
+std::string gzip_tile(std::vector<T> const& pixels, bool shuffle)
+{
+    std::string raw = fits_big_endian(pixels);
+    if (shuffle)
+    {
+        std::string shuffled(raw.size(), '\0');
+        for (std::size_t i = 0; i < pixels.size(); i++)
+        {
+            for (std::size_t byte = 0; byte < sizeof(T); byte++)
+            {
+                shuffled[byte * pixels.size() + i] = raw[i * sizeof(T) + byte];
+            }
+        }
+        raw = shuffled;
+    }
+
+    uLongf length = compressBound(static_cast<uLong>(raw.size()));
+    std::string compressed(length, '\0');
+    compress2(reinterpret_cast<Bytef*>(&compressed[0]), &length,
+        reinterpret_cast<Bytef const*>(raw.data()), static_cast<uLong>(raw.size()), 6);
+    compressed.resize(length);
+    return compressed;
+}
+
+template <typename T>
+std::string gzip_1(std::vector<T> const& pixels)
+{
+    return gzip_tile(pixels, false);
+}
+
+template <typename T>
+std::string gzip_2(std::vector<T> const& pixels)
+{
+    return gzip_tile(pixels, true);
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(compressed_image_gzip)
+
+BOOST_AUTO_TEST_CASE(gzip_tiles_decode)
+{
+    std::size_t const width = 25, height = 10;
+    auto const image = test_image<std::int32_t>(width, height);
+
+    fits_test_file file1("compressed_gzip_1.fits",
+        compressed_file(image, width, height, 25, 3, "GZIP_1", &gzip_1<std::int32_t>));
+    fits fits1(file1.path, fits_open_mode::directory);
+    BOOST_TEST(fits1.read_compressed_image<bitpix::B32>(1, 2) == image);
+
+    fits_test_file file2("compressed_gzip_2.fits",
+        compressed_file(image, width, height, 6, 6, "GZIP_2", &gzip_2<std::int32_t>));
+    fits fits2(file2.path, fits_open_mode::directory);
+    BOOST_TEST(fits2.read_compressed_image<bitpix::B32>(1, 2) == image);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+#endif
@@ -0,0 +1,244 @@
+#define BOOST_TEST_MODULE data_source_test
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <condition_variable>
+#include <istream>
+#include <cstdint>
+#include <cstddef>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/data_source.hpp>
+#include <boost/astronomy/io/source_fits.hpp>
+
+#include "fits_test_file.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace {
+
+//! memory source counting the range requests it serves
+struct counting_source : public memory_source
+{
+    std::atomic<std::size_t> reads{0};
+
+    explicit counting_source(std::string bytes) : memory_source(std::move(bytes)) {}
+
+    std::size_t read_range(std::uint64_t offset, char* buffer, std::size_t length)
+    {
+        reads++;
+        return memory_source::read_range(offset, buffer, length);
+    }
+};
+
+//! memory source whose reads from gate_offset on wait until open() is called
+struct gated_source : public counting_source
+{
+    std::uint64_t gate_offset;
+    std::mutex mutex;
+    std::condition_variable opened;
+    bool is_open = false;
+
+    gated_source(std::string bytes, std::uint64_t gate) :
+        counting_source(std::move(bytes)), gate_offset(gate) {}
+
+    void open()
+    {
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->is_open = true;
+        }
+        this->opened.notify_all();
+    }
+
+    std::size_t read_range(std::uint64_t offset, char* buffer, std::size_t length)
+    {
+        if (offset >= this->gate_offset)
+        {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->opened.wait(lock, [this]() { return this->is_open; });
+        }
+        return counting_source::read_range(offset, buffer, length);
+    }
+};
+
+std::string numbered_bytes(std::size_t count)
+{
+    std::string bytes(count, '\0');
+    for (std::size_t i = 0; i < count; i++)
+    {
+        bytes[i] = static_cast<char>(i * 7 % 251);
+    }
+    return bytes;
+}
+
+std::string image_file()
+{
+    std::vector<std::int16_t> pixels(40 * 30);
+    for (std::size_t i = 0; i < pixels.size(); i++)
+    {
+        pixels[i] = static_cast<std::int16_t>(i);
+    }
+
+    std::string content = fits_header({
+        fits_card("SIMPLE", "T"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "0"),
+        fits_card("EXTEND", "T")
+    });
+    content += fits_header({
+        fits_card("XTENSION", "'IMAGE   '"),
+        fits_card("BITPIX", "16"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", "40"),
+        fits_card("NAXIS2", "30"),
+        fits_card("PCOUNT", "0"),
+        fits_card("GCOUNT", "1"),
+        fits_card("EXTNAME", "'SCI'")
+    });
+    return content + fits_pad_data(fits_big_endian(pixels));
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(range_sources)
+
+BOOST_AUTO_TEST_CASE(prefetching_reads_match_source)
+{
+    std::string const bytes = numbered_bytes(10000);
+    auto inner = std::make_shared<counting_source>(bytes);
+    prefetching_source cached(inner, 1000, 0, 4);
+
+    std::vector<char> buffer(3500);
+    BOOST_TEST(cached.read_range(1500, buffer.data(), buffer.size()) == 3500u);
+    BOOST_TEST(std::string(buffer.begin(), buffer.end()) == bytes.substr(1500, 3500));
+    //blocks 1 to 4 are missing and next to each other so one request fetches them
+    BOOST_TEST(cached.requests() == 1u);
+    BOOST_TEST(inner->reads.load() == 1u);
+
+    BOOST_TEST(cached.read_range(2000, buffer.data(), 100) == 100u);
+    BOOST_TEST(cached.requests() == 1u);
+
+    BOOST_TEST(cached.read_range(9950, buffer.data(), 100) == 50u);
+    BOOST_TEST(std::string(buffer.begin(), buffer.begin() + 50) == bytes.substr(9950));
+    BOOST_TEST(cached.read_range(10000, buffer.data(), 10) == 0u);
+
+    //only 4 blocks are kept, block 1 was used least recently
+    BOOST_TEST(cached.read_range(6000, buffer.data(), 2500) == 2500u);
+    BOOST_TEST(std::string(buffer.begin(), buffer.begin() + 2500) == bytes.substr(6000, 2500));
+    std::size_t const before = cached.requests();
+    cached.read_range(1100, buffer.data(), 10);
+    BOOST_TEST(cached.requests() == before + 1);
+}
+
+BOOST_AUTO_TEST_CASE(read_ahead_and_prefetch)
+{
+    std::string const bytes = numbered_bytes(8000);
+    auto inner = std::make_shared<counting_source>(bytes);
+    prefetching_source cached(inner, 1000, 2);
+
+    std::vector<char> buffer(1000);
+    cached.read_range(0, buffer.data(), 1000);
+    cached.read_range(1000, buffer.data(), 1000);
+    cached.read_range(2000, buffer.data(), 1000);
+    //block 0 with its two read ahead blocks, then the blocks after each read
+    BOOST_TEST(cached.requests() == 3u);
+
+    cached.prefetch(6000, 1500);
+    std::size_t const before = cached.requests();
+    BOOST_TEST(cached.read_range(6500, buffer.data(), 1000) == 1000u);
+    BOOST_TEST(std::string(buffer.begin(), buffer.end()) == bytes.substr(6500, 1000));
+    BOOST_TEST(cached.requests() == before);
+}
+
+BOOST_AUTO_TEST_CASE(evicting_running_fetch_does_not_block_cache)
+{
+    std::string const bytes = numbered_bytes(10000);
+    auto inner = std::make_shared<gated_source>(bytes, 5000);
+    prefetching_source cached(inner, 1000, 0, 1);
+
+    //block 5 stays in flight until the gate opens, the read of block 0 evicts it
+    cached.prefetch(5000, 1000);
+    std::vector<char> buffer(1000);
+    std::future<std::size_t> reader = std::async(std::launch::async, [&cached, &buffer]() {
+        return cached.read_range(0, buffer.data(), 1000);
+    });
+    while (inner->reads.load() == 0)
+    {
+        std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    //the reader waits for the evicted fetch without holding the cache
+    std::future<std::size_t> other = std::async(std::launch::async, [&cached]() {
+        return cached.requests();
+    });
+    bool const free = other.wait_for(std::chrono::seconds(5)) == std::future_status::ready;
+    inner->open();
+    BOOST_TEST(free);
+    BOOST_TEST(other.get() == 2u);
+    BOOST_TEST(reader.get() == 1000u);
+    BOOST_TEST(std::string(buffer.begin(), buffer.end()) == bytes.substr(0, 1000));
+}
+
+BOOST_AUTO_TEST_CASE(stream_over_source)
+{
+    std::string const bytes = numbered_bytes(5000);
+    memory_source source(bytes);
+    source_streambuf buffer(source, 256);
+    std::istream stream(&buffer);
+
+    std::vector<char> read(3000);
+    stream.seekg(1234);
+    stream.read(read.data(), 10);
+    BOOST_TEST(std::string(read.begin(), read.begin() + 10) == bytes.substr(1234, 10));
+    BOOST_TEST(stream.tellg() == 1244);
+
+    stream.read(read.data(), 3000);
+    BOOST_TEST(std::string(read.begin(), read.end()) == bytes.substr(1244, 3000));
+
+    stream.seekg(-6, std::ios_base::end);
+    stream.read(read.data(), 10);
+    BOOST_TEST(stream.gcount() == 6);
+    BOOST_TEST(std::string(read.begin(), read.begin() + 6) == bytes.substr(4994));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(fits_over_source)
+
+BOOST_AUTO_TEST_CASE(directory_and_cutout)
+{
+    std::string const content = image_file();
+    auto inner = std::make_shared<counting_source>(content);
+    source_fits file(std::make_shared<prefetching_source>(inner, 2880, 1));
+
+    BOOST_REQUIRE(file.size() == 2u);
+    BOOST_TEST(file.get_directory()[1].header_offset == 2880);
+    BOOST_TEST(file.get_directory()[1].data_offset == 2 * 2880);
+    BOOST_TEST(file.get_directory()[1].data_size == 2400u);
+    BOOST_TEST(file.get_header(1).value_of<std::string>("EXTNAME") == "'SCI'");
+    BOOST_TEST(file.read_data(0).empty());
+
+    std::vector<image_section> sections{image_section({5, 3}, {4, 2}), image_section({0, 29}, {40, 1})};
+    auto cutouts = file.read_image_sections<bitpix::B16>(1, sections);
+    BOOST_REQUIRE(cutouts.size() == 2u);
+    BOOST_TEST(cutouts[0][0] == 3 * 40 + 5);
+    BOOST_TEST(cutouts[0][7] == 4 * 40 + 8);
+    BOOST_TEST(cutouts[1][39] == 30 * 40 - 1);
+
+    //the file is three blocks, every one fetched once
+    BOOST_TEST(inner->reads.load() <= 3u);
+
+    std::vector<char> data = file.read_data(1);
+    BOOST_TEST(data.size() == 2400u);
+    BOOST_TEST(data[3] == 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,227 @@
+#define BOOST_TEST_MODULE fits_test
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/astronomy/io/fits.hpp>
+
+#include "fits_test_file.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace {
+
+std::string image_extension_hdu(std::string const& name, std::vector<std::int16_t> const& pixels)
+{
+    std::string content = fits_header({
+        fits_card("XTENSION", "'IMAGE   '"),
+        fits_card("BITPIX", "16"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", "2"),
+        fits_card("NAXIS2", std::to_string(pixels.size() / 2)),
+        fits_card("PCOUNT", "0"),
+        fits_card("GCOUNT", "1"),
+        fits_card("EXTNAME", "'" + name + "'")
+    });
+    return content + fits_pad_data(fits_big_endian(pixels));
+}
+
+std::string mosaic_file()
+{
+    std::string content = fits_header({
+        fits_card("SIMPLE", "T"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "0"),
+        fits_card("EXTEND", "T")
+    });
+    content += image_extension_hdu("CCD1", std::vector<std::int16_t>{1, 2, 3, 4});
+    content += image_extension_hdu("CCD2", std::vector<std::int16_t>(2 * 1000, 7));
+    content += image_extension_hdu("CCD3", std::vector<std::int16_t>{-1, -2, -3, -4});
+    return content;
+}
+
+//! mosaic whose second extension is an ASCII table failing to load because of its TFORM1
+std::string damaged_mosaic_file()
+{
+    std::string content = fits_header({
+        fits_card("SIMPLE", "T"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "0"),
+        fits_card("EXTEND", "T")
+    });
+    content += image_extension_hdu("CCD1", std::vector<std::int16_t>{1, 2, 3, 4});
+    content += fits_header({
+        fits_card("XTENSION", "'TABLE   '"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", "4"),
+        fits_card("NAXIS2", "2"),
+        fits_card("PCOUNT", "0"),
+        fits_card("GCOUNT", "1"),
+        fits_card("TFIELDS", "1"),
+        fits_card("TFORM1", "'Ix'"),
+        fits_card("TBCOL1", "1"),
+        fits_card("EXTNAME", "'CATALOG'")
+    });
+    content += fits_pad_data("   1   2");
+    content += image_extension_hdu("CCD3", std::vector<std::int16_t>{-1, -2, -3, -4});
+    return content;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(fits_directory)
+
+BOOST_AUTO_TEST_CASE(fits_directory_offsets)
+{
+    fits_test_file file("fits_directory_offsets.fits", mosaic_file());
+    fits fits_file(file.path, fits_open_mode::directory);
+
+    auto const& directory = fits_file.get_directory();
+    BOOST_TEST(fits_file.size() == 4u);
+    BOOST_TEST(directory.size() == 4u);
+
+    BOOST_TEST(directory[0].header_offset == 0);
+    BOOST_TEST(directory[0].data_offset == 2880);
+    BOOST_TEST(directory[0].data_size == 0u);
+
+    BOOST_TEST(directory[1].header_offset == 2880);
+    BOOST_TEST(directory[1].data_offset == 2 * 2880);
+    BOOST_TEST(directory[1].data_size == 8u);
+
+    BOOST_TEST(directory[2].data_size == 4000u);
+    BOOST_TEST(directory[3].header_offset == 6 * 2880);
+
+    for (auto const& entry : directory)
+    {
+        BOOST_TEST(!entry.loaded);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(fits_directory_lazy_load)
+{
+    fits_test_file file("fits_directory_lazy_load.fits", mosaic_file());
+    fits fits_file(file.path, fits_open_mode::directory);
+
+    auto ccd3 = std::dynamic_pointer_cast<image_extension<bitpix::B16>>(fits_file.get_hdu(3));
+    BOOST_REQUIRE(ccd3 != nullptr);
+    BOOST_TEST(fits_file.get_directory()[3].loaded);
+    BOOST_TEST(!fits_file.get_directory()[1].loaded);
+
+    auto image = ccd3->get_data();
+    BOOST_TEST(image(0, 0) == -1);
+    BOOST_TEST(image(1, 1) == -4);
+
+    auto ccd1 = std::dynamic_pointer_cast<image_extension<bitpix::B16>>(fits_file.get_hdu(1));
+    BOOST_REQUIRE(ccd1 != nullptr);
+    BOOST_TEST(ccd1->get_data()(1, 0) == 3);
+
+    auto primary = std::dynamic_pointer_cast<primary_hdu<bitpix::B8>>(fits_file.get_hdu(0));
+    BOOST_REQUIRE(primary != nullptr);
+    BOOST_TEST(primary->is_simple());
+}
+
+BOOST_AUTO_TEST_CASE(fits_directory_failed_load_keeps_header)
+{
+    fits_test_file file("fits_directory_failed_load.fits", damaged_mosaic_file());
+    fits fits_file(file.path, fits_open_mode::directory);
+
+    //every attempt fails the same way as the header is still there
+    BOOST_CHECK_THROW(fits_file.get_hdu(2), boost::bad_lexical_cast);
+    BOOST_TEST(!fits_file.get_directory()[2].loaded);
+    BOOST_CHECK_THROW(fits_file.get_hdu(2), boost::bad_lexical_cast);
+
+    auto ccd3 = std::dynamic_pointer_cast<image_extension<bitpix::B16>>(fits_file.get_hdu(3));
+    BOOST_REQUIRE(ccd3 != nullptr);
+    BOOST_TEST(ccd3->get_data()(1, 1) == -4);
+}
+
+BOOST_AUTO_TEST_CASE(fits_directory_parallel_load)
+{
+    std::string content = fits_header({
+        fits_card("SIMPLE", "T"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "0"),
+        fits_card("EXTEND", "T")
+    });
+    for (std::int16_t chip = 0; chip < 12; chip++)
+    {
+        content += image_extension_hdu("CCD" + std::to_string(chip),
+            std::vector<std::int16_t>(2 * (chip + 1) * 300, chip));
+    }
+    fits_test_file file("fits_directory_parallel_load.fits", content);
+    fits fits_file(file.path, fits_open_mode::directory);
+
+    auto first = std::dynamic_pointer_cast<image_extension<bitpix::B16>>(fits_file.get_hdu(1));
+    BOOST_REQUIRE(first != nullptr);
+
+    fits_file.load_all(3);
+    for (auto const& entry : fits_file.get_directory())
+    {
+        BOOST_TEST(entry.loaded);
+    }
+    BOOST_TEST(fits_file.get_hdu(1) == first);
+
+    for (std::int16_t chip = 0; chip < 12; chip++)
+    {
+        auto ccd = std::dynamic_pointer_cast<image_extension<bitpix::B16>>(
+            fits_file.get_hdu(static_cast<std::size_t>(chip) + 1));
+        BOOST_REQUIRE(ccd != nullptr);
+        auto image = ccd->get_data();
+        BOOST_TEST(image(0, 0) == chip);
+        BOOST_TEST(image((chip + 1) * 300 - 1, 1) == chip);
+    }
+    BOOST_TEST(std::dynamic_pointer_cast<primary_hdu<bitpix::B8>>(fits_file.get_hdu(0)) != nullptr);
+
+    fits_file.load_all();
+}
+
+BOOST_AUTO_TEST_CASE(fits_directory_failed_parallel_load)
+{
+    fits_test_file file("fits_directory_failed_parallel_load.fits", damaged_mosaic_file());
+    fits fits_file(file.path, fits_open_mode::directory);
+
+    //one thread loads the HDUs in order and stops at the damaged table
+    BOOST_CHECK_THROW(fits_file.load_all(1), boost::bad_lexical_cast);
+    auto const& directory = fits_file.get_directory();
+    BOOST_TEST(directory[0].loaded);
+    BOOST_TEST(directory[1].loaded);
+    BOOST_TEST(!directory[2].loaded);
+    BOOST_TEST(!directory[3].loaded);
+
+    //loaded HDUs are kept and the others are read again from their headers
+    std::shared_ptr<hdu> const ccd1 = fits_file.get_hdu(1);
+    BOOST_CHECK_THROW(fits_file.load_all(3), boost::bad_lexical_cast);
+    BOOST_TEST(fits_file.get_hdu(1) == ccd1);
+    BOOST_CHECK_THROW(fits_file.get_hdu(2), boost::bad_lexical_cast);
+    auto ccd3 = std::dynamic_pointer_cast<image_extension<bitpix::B16>>(fits_file.get_hdu(3));
+    BOOST_REQUIRE(ccd3 != nullptr);
+    BOOST_TEST(ccd3->get_data()(0, 0) == -1);
+}
+
+BOOST_AUTO_TEST_CASE(fits_directory_arena_allocation)
+{
+    fits_test_file file("fits_directory_arena_allocation.fits", mosaic_file());
+    std::shared_ptr<hdu> ccd;
+    {
+        fits fits_file(file.path, fits_open_mode::directory, hdu_allocation::arena);
+        fits_file.load_all(2);
+        for (auto const& entry : fits_file.get_directory())
+        {
+            BOOST_TEST(entry.loaded);
+        }
+        ccd = fits_file.get_hdu(3);
+    }
+
+    //HDUs keep the arena alive after the fits object is destroyed
+    auto ccd3 = std::dynamic_pointer_cast<image_extension<bitpix::B16>>(ccd);
+    BOOST_REQUIRE(ccd3 != nullptr);
+    BOOST_TEST(ccd3->value_of<std::string>("EXTNAME") == "'CCD3'");
+    BOOST_TEST(ccd3->get_data()(1, 1) == -4);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,194 @@
+#define BOOST_TEST_MODULE fits_pipeline_test
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <algorithm>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/fits_pipeline.hpp>
+#include <boost/astronomy/io/fits_writer.hpp>
+
+#include "fits_test_file.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace {
+
+std::size_t const file_count = 12;
+
+//! 4 x 3 image of 32 bit integers whose pixels are index * 100 + pixel number
+std::string image_file(std::size_t index)
+{
+    std::vector<std::int32_t> pixels(12);
+    for (std::size_t i = 0; i < pixels.size(); i++)
+    {
+        pixels[i] = static_cast<std::int32_t>(index * 100 + i);
+    }
+    return fits_header({
+        fits_card("SIMPLE", "T"),
+        fits_card("BITPIX", "32"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", "4"),
+        fits_card("NAXIS2", "3")
+    }) + fits_pad_data(fits_big_endian(pixels));
+}
+
+//! input files of the pipeline, removed with the object
+struct input_files
+{
+    std::vector<std::unique_ptr<fits_test_file>> files;
+    std::vector<std::string> paths;
+
+    explicit input_files(std::string const& prefix)
+    {
+        for (std::size_t i = 0; i < file_count; i++)
+        {
+            files.emplace_back(new fits_test_file(prefix + std::to_string(i) + ".fits",
+                image_file(i)));
+            paths.push_back(files.back()->path);
+        }
+    }
+};
+
+pipeline_options make_options(std::size_t capacity, std::size_t threads)
+{
+    pipeline_options options;
+    options.queue_capacity = capacity;
+    options.read_threads = 2;
+    options.decode_threads = 2;
+    options.process_threads = threads;
+    options.write_threads = 2;
+    return options;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(fits_pipeline)
+
+BOOST_AUTO_TEST_CASE(files_are_read_processed_and_written)
+{
+    input_files const inputs("fits_pipeline_input_");
+    std::vector<std::unique_ptr<fits_test_file>> outputs;
+    for (std::size_t i = 0; i < file_count; i++)
+    {
+        outputs.emplace_back(new fits_test_file("fits_pipeline_output_" + std::to_string(i) +
+            ".fits", ""));
+    }
+
+    //every image is doubled and written with the header of its file
+    struct doubled
+    {
+        std::vector<card> cards;
+        std::vector<std::int32_t> pixels;
+    };
+    pipeline_statistics const statistics = run_fits_pipeline(inputs.paths,
+        decode_buffered_fits(),
+        [](std::size_t, buffered_fits& fits) {
+            auto const image = fits.get_image<bitpix::B32>(0);
+            doubled result;
+            result.cards = fits.get_header(0).get_cards();
+            result.pixels.resize(image.size());
+            image.copy_to(result.pixels.data());
+            for (auto& pixel : result.pixels)
+            {
+                pixel *= 2;
+            }
+            return result;
+        },
+        [&outputs](std::size_t index, doubled& result) {
+            fits_writer writer(outputs[index]->path);
+            writer.write_header(result.cards);
+            writer.write_data(result.pixels.data(), result.pixels.size());
+            writer.close();
+        },
+        make_options(2, 3));
+
+    BOOST_TEST(statistics.files == file_count);
+    BOOST_TEST(statistics.max_queued <= 2u);
+    BOOST_TEST(statistics.read_seconds >= 0);
+    for (std::size_t i = 0; i < file_count; i++)
+    {
+        buffered_fits const written(outputs[i]->path);
+        auto const image = written.get_image<bitpix::B32>(0);
+        BOOST_REQUIRE_EQUAL(image.size(), 12u);
+        BOOST_TEST(image.at(0) == static_cast<std::int32_t>(i * 200));
+        BOOST_TEST(image.at(11) == static_cast<std::int32_t>(i * 200 + 22));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(slow_stage_holds_back_the_others)
+{
+    //files decoded but not written yet are bounded by the queues and the threads
+    input_files const inputs("fits_pipeline_slow_");
+    std::atomic<std::size_t> in_flight(0), max_in_flight(0);
+    std::vector<std::size_t> written;
+    pipeline_options const options = make_options(1, 1);
+    run_fits_pipeline(inputs.paths,
+        [&](pipeline_file& file) {
+            std::size_t const count = ++in_flight;
+            std::size_t previous = max_in_flight;
+            while (previous < count && !max_in_flight.compare_exchange_weak(previous, count))
+            {
+            }
+            return file.bytes.size();
+        },
+        [](std::size_t index, std::size_t& size) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            return index + size;
+        },
+        [&](std::size_t index, std::size_t&) {
+            written.push_back(index);
+            in_flight--;
+        },
+        [&options]() {
+            pipeline_options single_writer = options;
+            single_writer.write_threads = 1;
+            return single_writer;
+        }());
+
+    std::sort(written.begin(), written.end());
+    BOOST_REQUIRE_EQUAL(written.size(), file_count);
+    for (std::size_t i = 0; i < file_count; i++)
+    {
+        BOOST_TEST(written[i] == i);
+    }
+    //2 decoders, 2 queues of 1 item, 1 processor and 1 writer
+    BOOST_TEST(max_in_flight <= 6u);
+}
+
+BOOST_AUTO_TEST_CASE(first_exception_stops_the_pipeline)
+{
+    input_files const inputs("fits_pipeline_error_");
+    std::atomic<std::size_t> processed(0);
+    auto const fail_on_fifth = [&](std::size_t index, buffered_fits&) {
+        processed++;
+        if (index == 4)
+        {
+            throw std::runtime_error("bad frame");
+        }
+        return index;
+    };
+    BOOST_CHECK_THROW(run_fits_pipeline(inputs.paths, decode_buffered_fits(), fail_on_fifth,
+        [](std::size_t, std::size_t&) {}, make_options(1, 1)), std::runtime_error);
+    BOOST_TEST(processed < file_count);
+
+    std::vector<std::string> paths = inputs.paths;
+    paths.insert(paths.begin() + 3, "fits_pipeline_missing.fits");
+    BOOST_CHECK_THROW(run_fits_pipeline(paths, decode_buffered_fits(),
+        [](std::size_t index, buffered_fits&) { return index; },
+        [](std::size_t, std::size_t&) {}, make_options(2, 2)),
+        boost::astronomy::fits_read_exception);
+
+    pipeline_statistics const empty = run_fits_pipeline(std::vector<std::string>(),
+        decode_buffered_fits(), [](std::size_t index, buffered_fits&) { return index; },
+        [](std::size_t, std::size_t&) {});
+    BOOST_TEST(empty.files == 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
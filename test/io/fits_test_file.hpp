@@ -0,0 +1,73 @@
+#ifndef BOOST_ASTRONOMY_TEST_IO_FITS_TEST_FILE_HPP
+#define BOOST_ASTRONOMY_TEST_IO_FITS_TEST_FILE_HPP
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstddef>
+#include <cstdio>
+
+#include <boost/astronomy/detail/endian.hpp>
+
+//! Helpers to build small FITS files used by the io tests
+
+//! creates 80 char card with value written from column 11
+inline std::string fits_card(std::string const& key, std::string const& value)
+{
+    std::string card = key;
+    card.append(8 - key.length(), ' ');
+    card += "= " + value;
+    card.append(80 - card.length(), ' ');
+    return card;
+}
+
+//! creates a header unit with END card and padding of 2880 bytes block
+inline std::string fits_header(std::vector<std::string> const& cards)
+{
+    std::string header;
+    for (auto const& card : cards)
+    {
+        header += card;
+    }
+    header += std::string("END").append(77, ' ');
+    header.append((2880 - header.length() % 2880) % 2880, ' ');
+    return header;
+}
+
+//! pads data unit to the multiple of 2880 bytes
+inline std::string fits_pad_data(std::string data)
+{
+    data.append((2880 - data.length() % 2880) % 2880, '\0');
+    return data;
+}
+
+//! converts values into big endian bytes
+template <typename T>
+std::string fits_big_endian(std::vector<T> const& values)
+{
+    std::string bytes(values.size() * sizeof(T), '\0');
+    for (std::size_t i = 0; i < values.size(); i++)
+    {
+        boost::astronomy::detail::store_big_endian(values[i], &bytes[i * sizeof(T)]);
+    }
+    return bytes;
+}
+
+//! writes the content into file and removes it when object is destroyed
+struct fits_test_file
+{
+    std::string path;
+
+    fits_test_file(std::string const& file_path, std::string const& content) : path(file_path)
+    {
+        std::ofstream file(path, std::ios_base::out | std::ios_base::binary);
+        file.write(content.data(), content.size());
+    }
+
+    ~fits_test_file()
+    {
+        std::remove(path.c_str());
+    }
+};
+
+#endif // !BOOST_ASTRONOMY_TEST_IO_FITS_TEST_FILE_HPP
@@ -0,0 +1,123 @@
+#define BOOST_TEST_MODULE fits_writer_test
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <fstream>
+#include <iterator>
+#include <cstdint>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/fits.hpp>
+#include <boost/astronomy/io/fits_writer.hpp>
+
+#include "fits_test_file.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace {
+
+std::string source_file()
+{
+    std::string content = fits_header({
+        fits_card("SIMPLE", "T"),
+        fits_card("BITPIX", "-32"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", "3"),
+        fits_card("NAXIS2", "2"),
+        fits_card("EXTEND", "T")
+    });
+    content += fits_pad_data(fits_big_endian(std::vector<float>{1.5f, -2.0f, 3.0f, 4.0f, 5.0f, 6.25f}));
+    content += fits_header({
+        fits_card("XTENSION", "'IMAGE   '"),
+        fits_card("BITPIX", "16"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", "2"),
+        fits_card("NAXIS2", "2000"),
+        fits_card("PCOUNT", "0"),
+        fits_card("GCOUNT", "1"),
+        fits_card("EXTNAME", "'CCD'")
+    });
+    std::vector<std::int16_t> pixels(4000);
+    for (std::size_t i = 0; i < pixels.size(); i++)
+    {
+        pixels[i] = static_cast<std::int16_t>(i) - 2000;
+    }
+    content += fits_pad_data(fits_big_endian(pixels));
+    content += fits_header({
+        fits_card("XTENSION", "'BINTABLE'"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", "4"),
+        fits_card("NAXIS2", "3"),
+        fits_card("PCOUNT", "0"),
+        fits_card("GCOUNT", "1"),
+        fits_card("TFIELDS", "1"),
+        fits_card("TFORM1", "'J'"),
+        fits_card("TTYPE1", "'ID'"),
+        fits_card("EXTNAME", "'IDS'")
+    });
+    content += fits_pad_data(fits_big_endian(std::vector<std::int32_t>{7, -8, 9}));
+    return content;
+}
+
+std::string read_file(std::string const& path)
+{
+    std::ifstream file(path, std::ios_base::in | std::ios_base::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(fits_writer_output)
+
+BOOST_AUTO_TEST_CASE(round_trip_is_byte_identical)
+{
+    std::string const content = source_file();
+    fits_test_file source("fits_writer_source.fits", content);
+    fits_test_file copy("fits_writer_copy.fits", "");
+
+    fits input(source.path, fits_open_mode::directory);
+    {
+        //small buffer so that data units are split across many writes
+        fits_writer writer(copy.path, 1);
+        writer.write(*std::dynamic_pointer_cast<primary_hdu<bitpix::_B32>>(input.get_hdu(0)));
+        writer.write(*std::dynamic_pointer_cast<image_extension<bitpix::B16>>(input.get_hdu(1)));
+        writer.write(*std::dynamic_pointer_cast<binary_table_extension>(input.get_hdu(2)));
+        writer.close();
+    }
+
+    std::string const written = read_file(copy.path);
+    BOOST_TEST(written.size() == content.size());
+    BOOST_TEST((written == content));
+}
+
+BOOST_AUTO_TEST_CASE(header_from_cards)
+{
+    fits_test_file output("fits_writer_cards.fits", "");
+    {
+        std::vector<card> cards(5);
+        cards[0].create_card("SIMPLE", true);
+        cards[1].create_card("BITPIX", 32);
+        cards[2].create_card("NAXIS", 1);
+        cards[3].create_card("NAXIS1", 3);
+        cards[4].create_card("EXTEND", false);
+
+        fits_writer writer(output.path);
+        writer.write_header(cards);
+        std::vector<std::int32_t> pixels{1, -1, 65536};
+        writer.write_data(pixels.data(), pixels.size());
+    }
+
+    std::string const written = read_file(output.path);
+    BOOST_REQUIRE_EQUAL(written.size(), 2u * 2880);
+
+    fits input(output.path, fits_open_mode::directory);
+    auto primary = std::dynamic_pointer_cast<primary_hdu<bitpix::B32>>(input.get_hdu(0));
+    BOOST_REQUIRE(primary != nullptr);
+    BOOST_TEST(primary->is_simple());
+    BOOST_TEST(primary->get_data()(0, 2) == 65536);
+    BOOST_TEST(primary->get_data()(0, 1) == -1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,169 @@
+#define BOOST_TEST_MODULE header_test
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/astronomy/io/hdu.hpp>
+#include <boost/astronomy/io/card.hpp>
+#include <boost/astronomy/io/header_scanner.hpp>
+
+#include "fits_test_file.hpp"
+
+using namespace boost::astronomy::io;
+
+BOOST_AUTO_TEST_SUITE(card_values)
+
+BOOST_AUTO_TEST_CASE(numbers)
+{
+    BOOST_TEST(card(fits_card("NAXIS1", "  -42 / signed")).value<int>() == -42);
+    BOOST_TEST(card(fits_card("NAXIS1", "+7")).value<std::size_t>() == 7u);
+    BOOST_TEST(card(fits_card("EXPTIME", "1.5D2 / seconds")).value<double>() == 150.0);
+    BOOST_TEST(card(fits_card("EXPTIME", "-2.5E-1")).value<float>() == -0.25f);
+    BOOST_CHECK_THROW(card(fits_card("NAXIS1", "-3")).value<std::size_t>(), boost::bad_lexical_cast);
+    BOOST_CHECK_THROW(card(fits_card("NAXIS1", "1.5")).value<int>(), boost::bad_lexical_cast);
+    BOOST_CHECK_THROW(card(fits_card("OBJECT", "'M31'")).value<double>(), boost::bad_lexical_cast);
+}
+
+BOOST_AUTO_TEST_CASE(strings_and_logicals)
+{
+    BOOST_TEST(card(fits_card("OBJECT", "'a/b''s'  / comment")).value<std::string>() == "'a/b''s'");
+    BOOST_TEST(card(fits_card("SIMPLE", "T / conforms")).value<bool>());
+    BOOST_TEST(!card(fits_card("EXTEND", "F")).value<bool>());
+    BOOST_TEST(card(fits_card("OBJECT", "'M31'")).key() == "OBJECT");
+    BOOST_TEST(card(fits_card("OBJECT", "'M31'")).key_is("OBJECT"));
+    BOOST_TEST(!card(fits_card("OBJECTS", "'M31'")).key_is("OBJECT"));
+}
+
+BOOST_AUTO_TEST_CASE(created_cards_are_80_chars)
+{
+    card with_comment("EXTNAME", "'SCI'", "science frame");
+    BOOST_TEST(std::string(with_comment.data(), 80) ==
+        fits_card("EXTNAME", "'SCI' /science frame"));
+    BOOST_TEST(with_comment.value<std::string>() == "'SCI'");
+
+    card number;
+    number.create_card("NAXIS", 3);
+    BOOST_TEST(number.value<int>() == 3);
+    BOOST_TEST(std::string(number.data(), 80).length() == 80u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(header_blocks)
+
+BOOST_AUTO_TEST_CASE(header_spanning_blocks)
+{
+    std::vector<std::string> cards{
+        fits_card("SIMPLE", "T"),
+        fits_card("BITPIX", "-32"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", "3"),
+        fits_card("NAXIS2", "5")
+    };
+    for (int i = 0; i < 40; i++)
+    {
+        cards.push_back(fits_card("KEY" + std::to_string(i), std::to_string(i * 10)));
+    }
+    fits_test_file file("header_blocks.fits", fits_header(cards) + fits_pad_data(std::string(60, '\0')));
+
+    std::fstream stream(file.path, std::ios_base::in | std::ios_base::binary);
+    hdu header(stream);
+    BOOST_TEST(stream.tellg() == 2 * 2880);
+    BOOST_TEST((header.bitpix() == bitpix::_B32));
+    BOOST_TEST(header.naxis(2) == 5u);
+    BOOST_TEST(header.value_of<int>("KEY39") == 390);
+    BOOST_TEST(header.data_size() == 60u);
+    BOOST_TEST(!header.has_key("END"));
+
+    std::string const memory = fits_header(cards);
+    hdu from_memory;
+    char const* header_end = from_memory.read_header(memory.data(), memory.data() + memory.size());
+    BOOST_TEST((header_end == memory.data() + 2 * 2880));
+    BOOST_TEST(from_memory.value_of<int>("KEY0") == 0);
+}
+
+BOOST_AUTO_TEST_CASE(duplicate_keys_and_moves)
+{
+    std::string const memory = fits_header({
+        fits_card("SIMPLE", "T"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "0"),
+        fits_card("ZETA", "1"),
+        fits_card("ALPHA", "2"),
+        fits_card("ZETA", "3")
+    });
+    hdu header;
+    header.read_header(memory.data(), memory.data() + memory.size());
+    BOOST_TEST(header.value_of<int>("ZETA") == 3);
+    BOOST_TEST(header.value_of<int>("ALPHA") == 2);
+    BOOST_TEST(!header.has_key("ALPH"));
+    BOOST_CHECK_THROW(header.value_of<int>("BETA"), std::out_of_range);
+
+    hdu moved(std::move(header));
+    BOOST_TEST(moved.value_of<int>("ZETA") == 3);
+    BOOST_TEST(moved.get_cards().size() == 7u);
+}
+
+BOOST_AUTO_TEST_CASE(truncated_header)
+{
+    std::string content = fits_header({fits_card("SIMPLE", "T"), fits_card("BITPIX", "8")});
+    content.resize(2000);
+    fits_test_file file("header_truncated.fits", content);
+
+    std::fstream stream(file.path, std::ios_base::in | std::ios_base::binary);
+    BOOST_CHECK_THROW(hdu header(stream), boost::astronomy::unexpected_end_of_data_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(header_scanner)
+
+BOOST_AUTO_TEST_CASE(scan_many_files)
+{
+    std::vector<fits_test_file> files;
+    files.reserve(4);
+    for (int i = 0; i < 3; i++)
+    {
+        std::vector<std::string> cards{
+            fits_card("SIMPLE", "T"),
+            fits_card("BITPIX", "16"),
+            fits_card("NAXIS", "0"),
+            fits_card("EXPTIME", std::to_string(10 * (i + 1)) + ".0 / seconds")
+        };
+        if (i != 1)
+        {
+            cards.push_back(fits_card("FILTER", "'V'"));
+        }
+        files.emplace_back("header_scan_" + std::to_string(i) + ".fits", fits_header(cards));
+    }
+    files.emplace_back("header_scan_truncated.fits",
+        fits_header({fits_card("SIMPLE", "T")}).substr(0, 1000));
+
+    std::vector<std::string> paths;
+    for (auto const& file : files)
+    {
+        paths.push_back(file.path);
+    }
+    paths.push_back("header_scan_missing.fits");
+
+    header_table table = scan_headers(paths, {"EXPTIME", "FILTER"}, 2);
+    BOOST_TEST(table.rows() == 5u);
+    BOOST_TEST(table.readable == (std::vector<char>{1, 1, 1, 0, 0}));
+
+    BOOST_TEST(table.column<double>("EXPTIME", -1.0) ==
+        (std::vector<double>{10.0, 20.0, 30.0, -1.0, -1.0}));
+    BOOST_TEST(table.has_value("FILTER", 0));
+    BOOST_TEST(!table.has_value("FILTER", 1));
+    BOOST_TEST(table.value<std::string>("FILTER", 2) == "'V'");
+    BOOST_CHECK_THROW(table.value<std::string>("FILTER", 1),
+        boost::astronomy::key_not_defined_exception);
+    BOOST_CHECK_THROW(table.column<double>("DATE-OBS"), boost::astronomy::key_not_defined_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,258 @@
+#define BOOST_TEST_MODULE header_cache_test
+#define BOOST_ASTRONOMY_IO_INSTRUMENTATION
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+
+#if defined(_WIN32)
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/fits.hpp>
+#include <boost/astronomy/io/header_cache.hpp>
+
+#include "fits_test_file.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace {
+
+//! primary image of width x 10 16 bit pixels and a binary table of 50 rows
+std::string cached_file(std::size_t width)
+{
+    std::vector<std::int16_t> pixels(width * 10);
+    for (std::size_t i = 0; i < pixels.size(); i++)
+    {
+        pixels[i] = static_cast<std::int16_t>(3 * i);
+    }
+    std::string content = fits_header({
+        fits_card("SIMPLE", "T"),
+        fits_card("BITPIX", "16"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", std::to_string(width)),
+        fits_card("NAXIS2", "10"),
+        fits_card("EXTEND", "T"),
+        fits_card("OBJECT", "'M31'")
+    });
+    content += fits_pad_data(fits_big_endian(pixels));
+
+    content += fits_header({
+        fits_card("XTENSION", "'BINTABLE'"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", "4"),
+        fits_card("NAXIS2", "50"),
+        fits_card("PCOUNT", "0"),
+        fits_card("GCOUNT", "1"),
+        fits_card("TFIELDS", "1"),
+        fits_card("TFORM1", "'J'"),
+        fits_card("TTYPE1", "'ID'"),
+        fits_card("EXTNAME", "'SOURCES'")
+    });
+    std::string rows;
+    for (std::size_t row = 0; row < 50; row++)
+    {
+        rows += fits_big_endian(std::vector<std::int32_t>{static_cast<std::int32_t>(row)});
+    }
+    return content + fits_pad_data(rows);
+}
+
+bool exists(std::string const& path)
+{
+    return std::ifstream(path).good();
+}
+
+void make_directory(std::string const& path)
+{
+#if defined(_WIN32)
+    _mkdir(path.c_str());
+#else
+    mkdir(path.c_str(), 0755);
+#endif
+}
+
+void remove_directory(std::string const& path)
+{
+#if defined(_WIN32)
+    _rmdir(path.c_str());
+#else
+    rmdir(path.c_str());
+#endif
+}
+
+//! removes the index of a test file
+struct index_cleanup
+{
+    std::string path;
+
+    ~index_cleanup()
+    {
+        std::remove(path.c_str());
+    }
+};
+
+void check_contents(fits& fits_file, std::size_t width)
+{
+    BOOST_REQUIRE_EQUAL(fits_file.size(), 2u);
+    BOOST_TEST(fits_file.get_directory()[1].data_size == 200u);
+    auto primary = std::dynamic_pointer_cast<primary_hdu<bitpix::B16>>(fits_file.get_hdu(0));
+    BOOST_REQUIRE(primary != nullptr);
+    BOOST_TEST(primary->value_of<std::string>("OBJECT") == "'M31'");
+    BOOST_TEST(primary->naxis(1) == width);
+    BOOST_TEST(primary->get_data()(9, width - 1) ==
+        static_cast<std::int16_t>(3 * (10 * width - 1)));
+
+    auto table = std::dynamic_pointer_cast<binary_table_extension>(fits_file.get_hdu(1));
+    BOOST_REQUIRE(table != nullptr);
+    BOOST_TEST(table->value_of<std::string>("EXTNAME") == "'SOURCES'");
+    auto ids = table->get_column("ID");
+    BOOST_REQUIRE(ids != nullptr);
+    BOOST_TEST(static_cast<column_data<std::int32_t>&>(*ids).get_data()[49] == 49);
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(header_cache_index)
+
+BOOST_AUTO_TEST_CASE(second_open_skips_header_parsing)
+{
+    fits_test_file file("header_cache_sidecar.fits", cached_file(100));
+    index_cleanup index{header_cache().index_path(file.path)};
+    BOOST_TEST(index.path == file.path + ".hdx");
+
+    fits parsed(file.path, header_cache());
+    BOOST_TEST(parsed.counters().header_bytes == 2u * 2880);
+    BOOST_TEST(exists(index.path));
+    check_contents(parsed, 100);
+
+    fits cached(file.path, header_cache());
+    io_counters const opened = cached.counters();
+    BOOST_TEST(opened.header_bytes == 0u);
+    BOOST_TEST(opened.read_calls == 1u);
+    BOOST_TEST(opened.seeks == 0u);
+    BOOST_REQUIRE_EQUAL(cached.get_directory().size(), parsed.get_directory().size());
+    for (std::size_t i = 0; i < cached.size(); i++)
+    {
+        BOOST_TEST(cached.get_directory()[i].data_offset == parsed.get_directory()[i].data_offset);
+        BOOST_TEST(cached.get_directory()[i].header_offset ==
+            parsed.get_directory()[i].header_offset);
+    }
+    check_contents(cached, 100);
+    BOOST_TEST(cached.counters().header_bytes == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(stale_index_is_rebuilt)
+{
+    index_cleanup index{"header_cache_stale.fits.hdx"};
+    {
+        fits_test_file file("header_cache_stale.fits", cached_file(100));
+        fits first(file.path, header_cache());
+    }
+    BOOST_TEST(exists(index.path));
+
+    fits_test_file file("header_cache_stale.fits", cached_file(1500));
+    fits reopened(file.path, header_cache());
+    BOOST_TEST(reopened.counters().header_bytes == 2u * 2880);
+    check_contents(reopened, 1500);
+
+    fits cached(file.path, header_cache());
+    BOOST_TEST(cached.counters().header_bytes == 0u);
+    check_contents(cached, 1500);
+}
+
+BOOST_AUTO_TEST_CASE(shared_directory_and_read_only_cache)
+{
+    std::string const directory = "header_cache_shared";
+    make_directory(directory);
+    header_cache const shared(directory);
+    fits_test_file file("header_cache_shared.fits", cached_file(20));
+    index_cleanup index{shared.index_path(file.path)};
+    BOOST_TEST(index.path.compare(0, directory.size() + 1, directory + "/") == 0);
+    BOOST_TEST(index.path != shared.index_path("other.fits"));
+
+    //a cache which is not updated only reads the existing indexes
+    fits not_updated(file.path, header_cache(directory, false));
+    BOOST_TEST(!exists(index.path));
+
+    fits parsed(file.path, shared);
+    BOOST_TEST(exists(index.path));
+    BOOST_TEST(!exists(file.path + ".hdx"));
+    fits cached(file.path, header_cache(directory, false));
+    BOOST_TEST(cached.counters().header_bytes == 0u);
+    check_contents(cached, 20);
+
+    std::remove(index.path.c_str());
+    remove_directory(directory);
+}
+
+BOOST_AUTO_TEST_CASE(damaged_index_falls_back_to_parsing)
+{
+    fits_test_file file("header_cache_damaged.fits", cached_file(100));
+    index_cleanup index{file.path + ".hdx"};
+    {
+        fits first(file.path, header_cache());
+    }
+    std::ifstream saved(index.path, std::ios_base::binary);
+    std::string const bytes((std::istreambuf_iterator<char>(saved)),
+        std::istreambuf_iterator<char>());
+    saved.close();
+
+    std::vector<hdu> headers;
+    std::vector<hdu_directory_entry> entries;
+    std::vector<std::string> damaged = {bytes.substr(0, bytes.size() - 7),
+        bytes.substr(0, 40), bytes + "x", bytes, bytes};
+    damaged[3][0] = 'X'; //magic
+    damaged[4][64 + file.path.size() + 24 + 8 * 3] = '\x7f'; //axes of the primary header
+    for (auto const& content : damaged)
+    {
+        {
+            std::ofstream out(index.path, std::ios_base::binary | std::ios_base::trunc);
+            out.write(content.data(), static_cast<std::streamsize>(content.size()));
+        }
+        BOOST_TEST(!read_header_index(header_cache(), file.path, headers, entries));
+        BOOST_TEST(headers.empty());
+
+        fits reopened(file.path, header_cache(std::string(), false));
+        BOOST_TEST(reopened.counters().header_bytes == 2u * 2880);
+        check_contents(reopened, 100);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(parsed_header_round_trip)
+{
+    std::string const header = fits_header({
+        fits_card("XTENSION", "'BINTABLE'"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", "4"),
+        fits_card("NAXIS2", "50"),
+        fits_card("PCOUNT", "16"),
+        fits_card("GCOUNT", "1"),
+        fits_card("TFIELDS", "1")
+    });
+    hdu parsed;
+    parsed.read_header(header.data(), header.data() + header.size());
+    std::string saved;
+    parsed.save_parsed(saved);
+
+    hdu restored;
+    BOOST_TEST(restored.load_parsed(saved.data(), saved.data() + saved.size()) ==
+        saved.data() + saved.size());
+    BOOST_TEST((restored.bitpix() == parsed.bitpix()));
+    BOOST_TEST(restored.all_naxis() == parsed.all_naxis());
+    BOOST_TEST(restored.data_size() == parsed.data_size());
+    BOOST_TEST(restored.get_cards().size() == parsed.get_cards().size());
+    BOOST_TEST(restored.value_of<int>("TFIELDS") == 1);
+    BOOST_TEST(restored.value_of<std::size_t>("PCOUNT") == 16u);
+    BOOST_TEST(restored.load_parsed(saved.data(), saved.data() + saved.size() - 1) == nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
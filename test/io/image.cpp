@@ -0,0 +1,210 @@
+#define BOOST_TEST_MODULE image_test
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstdint>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <numeric>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/image.hpp>
+
+#include "fits_test_file.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace {
+
+//! values covering a full SIMD register and a scalar tail
+template <typename T>
+std::vector<T> pixel_values(std::size_t count)
+{
+    std::vector<T> values(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        values[i] = static_cast<T>((i % 2 == 0 ? 1 : -1) * static_cast<T>(i * 3 + 1) / 2);
+    }
+    return values;
+}
+
+template <bitpix DataType>
+void check_decoded_image(std::string const& path)
+{
+    typedef typename bitpix_traits<DataType>::type pixel_type;
+    std::size_t const width = 7, height = 5;
+    std::vector<pixel_type> values = pixel_values<pixel_type>(width * height);
+
+    //a few bytes before the data to read from an unaligned start offset
+    fits_test_file file(path, "abc" + fits_big_endian(values));
+    std::fstream stream(path, std::ios_base::in | std::ios_base::binary);
+
+    image<DataType> decoded(stream, width, height, 3);
+    for (std::size_t x = 0; x < height; x++)
+    {
+        for (std::size_t y = 0; y < width; y++)
+        {
+            BOOST_REQUIRE_EQUAL(decoded(x, y), values[x * width + y]);
+        }
+    }
+}
+
+//! writes values as a big endian image and reads it back as one row
+template <bitpix DataType>
+image<DataType> load_row_image
+(
+    std::string const& path,
+    std::vector<typename bitpix_traits<DataType>::type> const& values
+)
+{
+    fits_test_file file(path, fits_big_endian(values));
+    std::fstream stream(path, std::ios_base::in | std::ios_base::binary);
+    return image<DataType>(stream, values.size(), 1, 0);
+}
+
+//! median as defined by image_buffer (element of rank n / 2) using a sorted copy
+template <typename T>
+T reference_median(std::vector<T> values)
+{
+    values.erase(std::remove_if(values.begin(), values.end(),
+        [](T value) { return std::isnan(value); }), values.end());
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(image_decode)
+
+BOOST_AUTO_TEST_CASE(integer_images)
+{
+    check_decoded_image<bitpix::B16>("image_b16_test.fits");
+    check_decoded_image<bitpix::B32>("image_b32_test.fits");
+}
+
+BOOST_AUTO_TEST_CASE(floating_point_images)
+{
+    check_decoded_image<bitpix::_B32>("image_f32_test.fits");
+    check_decoded_image<bitpix::_B64>("image_f64_test.fits");
+}
+
+BOOST_AUTO_TEST_CASE(bulk_byte_swap)
+{
+    //lengths around the register widths exercise both vector and scalar code
+    for (std::size_t count = 0; count < 70; count++)
+    {
+        std::vector<std::uint32_t> values(count), expected(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            values[i] = static_cast<std::uint32_t>(0x01020304u + i);
+            expected[i] = boost::endian::endian_reverse(values[i]);
+        }
+
+        boost::astronomy::detail::reverse_bytes<4>(
+            reinterpret_cast<unsigned char*>(values.data()), count);
+        BOOST_REQUIRE(values == expected);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(image_buffer_statistics)
+
+BOOST_AUTO_TEST_CASE(single_pass_statistics)
+{
+    //large enough to be split across threads
+    std::vector<float> values(600000);
+    for (std::size_t i = 0; i < values.size(); i++)
+    {
+        values[i] = 1e4f + static_cast<float>((i * 7919) % 1000) / 10.0f;
+    }
+    values[12345] = std::numeric_limits<float>::quiet_NaN();
+
+    double sum = 0, maximum = 0;
+    for (std::size_t i = 0; i < values.size(); i++)
+    {
+        sum += i == 12345 ? 0 : values[i];
+        maximum = i == 12345 ? maximum : std::max<double>(maximum, values[i]);
+    }
+    double const mean = sum / static_cast<double>(values.size() - 1);
+    double m2 = 0;
+    for (std::size_t i = 0; i < values.size(); i++)
+    {
+        m2 += i == 12345 ? 0 : (values[i] - mean) * (values[i] - mean);
+    }
+
+    auto frame = load_row_image<bitpix::_B32>("image_statistics_test.fits", values);
+    for (std::size_t threads : {1u, 4u})
+    {
+        image_statistics stats = frame.statistics(threads);
+        BOOST_TEST(stats.count == values.size() - 1);
+        BOOST_TEST(stats.min == 1e4);
+        BOOST_TEST(stats.max == maximum);
+        BOOST_TEST(stats.mean == mean, boost::test_tools::tolerance(1e-12));
+        BOOST_TEST(stats.variance() == m2 / static_cast<double>(values.size() - 2),
+            boost::test_tools::tolerance(1e-9));
+    }
+    BOOST_TEST(frame.median() == reference_median(values));
+}
+
+BOOST_AUTO_TEST_CASE(median_without_copy)
+{
+    //many repeated values force the histogram to be refined
+    std::vector<std::int16_t> counts(200000);
+    for (std::size_t i = 0; i < counts.size(); i++)
+    {
+        counts[i] = static_cast<std::int16_t>(i % 3 == 0 ? 100 : (i * 31) % 20000 - 10000);
+    }
+    auto frame = load_row_image<bitpix::B16>("image_median_test.fits", counts);
+    BOOST_TEST(frame.median() == reference_median(counts));
+
+    std::vector<double> spread = {5.0, -1e300, 3.0, 1e300, 4.0, 1e-300, 2.0};
+    auto small = load_row_image<bitpix::_B64>("image_median_small_test.fits", spread);
+    BOOST_TEST(small.median() == reference_median(spread));
+    BOOST_TEST(small.std_dev() == small.statistics().std_dev());
+
+    std::vector<std::uint8_t> constant(50000, 9);
+    auto flat = load_row_image<bitpix::B8>("image_median_flat_test.fits", constant);
+    BOOST_TEST(flat.median() == 9);
+    BOOST_TEST(flat.statistics().variance() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(median_of_extreme_values)
+{
+    double const infinity = std::numeric_limits<double>::infinity();
+    std::vector<double> infinite = {3.0, infinity, -infinity, 1.0, 2.0};
+    auto with_infinity = load_row_image<bitpix::_B64>("image_median_infinite_test.fits", infinite);
+    BOOST_TEST(with_infinity.median() == 2.0);
+    infinite = {infinity, 1.0, infinity, std::nan(""), infinity, 2.0};
+    auto mostly_infinite = load_row_image<bitpix::_B64>("image_median_infinite_test.fits",
+        infinite);
+    BOOST_TEST(mostly_infinite.median() == infinity);
+
+    //the range between the largest doubles does not fit in a double
+    std::vector<double> wide(200000);
+    for (std::size_t i = 0; i < wide.size(); i++)
+    {
+        wide[i] = i % 4 == 0 ? 1.7e308 : (i % 4 == 1 ? -1.7e308 : static_cast<double>(i % 1000));
+    }
+    auto wide_frame = load_row_image<bitpix::_B64>("image_median_wide_test.fits", wide);
+    BOOST_TEST(wide_frame.median() == reference_median(wide));
+
+    //64 bit integers which are the same once converted to double
+    std::int64_t const big = (std::int64_t(1) << 62) + 1;
+    std::vector<std::int64_t> close(100000);
+    for (std::size_t i = 0; i < close.size(); i++)
+    {
+        close[i] = big + static_cast<std::int64_t>((i * 7919) % 1000) - 500;
+    }
+    double const low = static_cast<double>(*std::min_element(close.begin(), close.end()));
+    double const high = static_cast<double>(*std::max_element(close.begin(), close.end()));
+    BOOST_TEST(boost::astronomy::detail::select_rank(close.data(), close.size(), close.size() / 2,
+        low, high) == reference_median(close));
+    std::vector<std::int64_t> const same(10, big);
+    BOOST_TEST(boost::astronomy::detail::select_rank(same.data(), same.size(), 5,
+        static_cast<double>(big), static_cast<double>(big)) == big);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,136 @@
+#define BOOST_TEST_MODULE image_background_test
+
+#include <cmath>
+#include <vector>
+#include <random>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/image_background.hpp>
+
+using namespace boost::astronomy::io;
+
+namespace {
+
+std::size_t const frame_width = 200;
+std::size_t const frame_height = 150;
+
+//! sky of the test frame, a plane rising along both axes
+double sky(std::size_t row, std::size_t column)
+{
+    return 100 + 0.05 * static_cast<double>(column) + 0.1 * static_cast<double>(row);
+}
+
+//! sky with gaussian noise of given rms and a few bright sources
+std::vector<float> frame_pixels(double noise)
+{
+    std::mt19937 generator(42);
+    std::normal_distribution<double> distribution(0, noise);
+    std::vector<float> pixels(frame_width * frame_height);
+    for (std::size_t row = 0; row < frame_height; row++)
+    {
+        for (std::size_t column = 0; column < frame_width; column++)
+        {
+            double value = sky(row, column) + distribution(generator);
+            for (std::size_t source = 0; source < 6; source++)
+            {
+                double const offset = static_cast<double>(source);
+                double const dx = static_cast<double>(column) - 17 - 31 * offset;
+                double const dy = static_cast<double>(row) - 20 - 22 * offset;
+                value += 500 * std::exp(-(dx * dx + dy * dy) / 8);
+            }
+            pixels[row * frame_width + column] = static_cast<float>(value);
+        }
+    }
+    return pixels;
+}
+
+background_options make_options(std::size_t threads)
+{
+    background_options options;
+    options.mesh_size = 32;
+    options.threads = threads;
+    return options;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(image_background)
+
+BOOST_AUTO_TEST_CASE(mesh_grid)
+{
+    std::vector<float> const pixels = frame_pixels(2);
+    background_map const map(pixels.data(), frame_width, frame_height, make_options(2));
+    BOOST_REQUIRE_EQUAL(map.mesh_columns(), 7u);
+    BOOST_REQUIRE_EQUAL(map.mesh_rows(), 5u);
+    for (std::size_t j = 1; j < 4; j++)
+    {
+        for (std::size_t i = 1; i < 6; i++)
+        {
+            BOOST_CHECK_SMALL(map.mesh_background(j, i) - sky(32 * j + 16, 32 * i + 16), 0.5);
+            BOOST_CHECK_CLOSE(map.mesh_rms(j, i), 2, 15);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(full_resolution_maps)
+{
+    std::vector<float> const pixels = frame_pixels(2);
+    background_map const map(pixels.data(), frame_width, frame_height, make_options(3));
+    std::vector<double> const background = map.background();
+    std::vector<double> const rms = map.rms(2);
+    BOOST_REQUIRE_EQUAL(background.size(), pixels.size());
+    //between the centres of the meshes whose filter windows are inside the grid
+    for (std::size_t row = 48; row <= 112; row += 4)
+    {
+        for (std::size_t column = 48; column <= 176; column += 4)
+        {
+            BOOST_CHECK_SMALL(background[row * frame_width + column] - sky(row, column), 0.5);
+            BOOST_CHECK_CLOSE(rms[row * frame_width + column], 2, 15);
+        }
+    }
+
+    //the subtracted frame is mostly noise around 0
+    std::vector<double> const subtracted = map.subtract(pixels.data());
+    double sum = 0;
+    for (std::size_t i = 0; i < subtracted.size(); i++)
+    {
+        sum += subtracted[i] - (static_cast<double>(pixels[i]) - background[i]);
+    }
+    BOOST_CHECK_SMALL(sum, 1e-6);
+}
+
+BOOST_AUTO_TEST_CASE(threads_give_the_same_map)
+{
+    std::vector<float> const pixels = frame_pixels(3);
+    background_map const single(pixels.data(), frame_width, frame_height, make_options(1));
+    background_map const shared(pixels.data(), frame_width, frame_height, make_options(4));
+    std::vector<double> const expected = single.background(1);
+    std::vector<double> const result = shared.background(4);
+    for (std::size_t i = 0; i < expected.size(); i++)
+    {
+        BOOST_REQUIRE_SMALL(result[i] - expected[i], 1e-12);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(blank_meshes)
+{
+    //most of the first mesh is blank, it takes the median of the others
+    std::vector<float> pixels(frame_width * frame_height, 10);
+    for (std::size_t row = 0; row < 32; row++)
+    {
+        for (std::size_t column = 0; column < 30; column++)
+        {
+            pixels[row * frame_width + column] = std::nanf("");
+        }
+    }
+    pixels[3 * frame_width + 60] = 1000;
+    background_options options = make_options(2);
+    options.filter_size = 1;
+    background_map const map(pixels.data(), frame_width, frame_height, options);
+    BOOST_CHECK_CLOSE(map.mesh_background(0, 0), 10, 1e-9);
+    BOOST_CHECK_CLOSE(map.mesh_background(0, 1), 10, 1e-9);
+    BOOST_CHECK_SMALL(map.mesh_rms(0, 1), 1e-9);
+    BOOST_CHECK_CLOSE(map.background()[5 * frame_width + 5], 10, 1e-9);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
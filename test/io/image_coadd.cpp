@@ -0,0 +1,183 @@
+#define BOOST_TEST_MODULE image_coadd_test
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/image_coadd.hpp>
+#include <boost/astronomy/io/image_tile_reader.hpp>
+
+#include "fits_test_file.hpp"
+
+using namespace boost::astronomy::io;
+using boost::astronomy::coordinate::wcs_transform;
+using boost::astronomy::coordinate::wcs_projection;
+
+namespace {
+
+std::size_t const frame_width = 40;
+std::size_t const frame_height = 30;
+
+//! TAN projection of 2 arcsecond pixels with the reference point on given pixel
+wcs_transform frame_wcs(double crpix1, double crpix2)
+{
+    return wcs_transform(wcs_projection::tan, crpix1, crpix2, 210, 54, -2.0 / 3600, 0, 0,
+        2.0 / 3600);
+}
+
+//! smooth pattern of a 40 x 30 frame, row after row
+std::vector<float> frame_pixels()
+{
+    std::vector<float> pixels(frame_width * frame_height);
+    for (std::size_t row = 0; row < frame_height; row++)
+    {
+        for (std::size_t column = 0; column < frame_width; column++)
+        {
+            pixels[row * frame_width + column] = static_cast<float>(
+                std::sin(0.2 * static_cast<double>(column)) * 10 + static_cast<double>(row));
+        }
+    }
+    return pixels;
+}
+
+resample_options small_tiles(resample_kernel kernel)
+{
+    resample_options options;
+    options.kernel = kernel;
+    options.tile_size = 16;
+    options.threads = 3;
+    return options;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(image_coaddition)
+
+BOOST_AUTO_TEST_CASE(same_grid_keeps_the_pixels)
+{
+    std::vector<float> const pixels = frame_pixels();
+    for (resample_kernel kernel : {resample_kernel::nearest, resample_kernel::bilinear,
+        resample_kernel::lanczos})
+    {
+        image_coadd coadd(frame_wcs(20, 15), frame_width, frame_height, small_tiles(kernel));
+        coadd.add(pixels.data(), frame_width, frame_height, frame_wcs(20, 15));
+        BOOST_REQUIRE_EQUAL(coadd.frames(), 1u);
+        std::vector<double> const mean = coadd.mean();
+        for (std::size_t i = 0; i < pixels.size(); i++)
+        {
+            BOOST_REQUIRE_SMALL(mean[i] - pixels[i], 1e-6);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(shifted_frames)
+{
+    //the frame starts 3 columns and 2 rows after the output grid
+    std::vector<float> const pixels = frame_pixels();
+    image_coadd coadd(frame_wcs(23, 17), frame_width, frame_height,
+        small_tiles(resample_kernel::nearest));
+    coadd.add(pixels.data(), frame_width, frame_height, frame_wcs(20, 15));
+    std::vector<double> const mean = coadd.mean();
+    for (std::size_t row = 0; row < frame_height; row++)
+    {
+        for (std::size_t column = 0; column < frame_width; column++)
+        {
+            double const value = mean[row * frame_width + column];
+            if (row < 2 || column < 3)
+            {
+                BOOST_CHECK(std::isnan(value));
+                BOOST_CHECK_EQUAL(coadd.weights()[row * frame_width + column], 0);
+            }
+            else
+            {
+                BOOST_CHECK_CLOSE(value, pixels[(row - 2) * frame_width + column - 3], 1e-6);
+            }
+        }
+    }
+
+    //half a pixel along the rows interpolates a linear ramp exactly
+    std::vector<float> ramp(frame_width * frame_height);
+    for (std::size_t i = 0; i < ramp.size(); i++)
+    {
+        ramp[i] = static_cast<float>(i % frame_width) * 2;
+    }
+    image_coadd bilinear(frame_wcs(20.5, 15), frame_width, frame_height,
+        small_tiles(resample_kernel::bilinear));
+    bilinear.add(ramp.data(), frame_width, frame_height, frame_wcs(20, 15));
+    BOOST_CHECK_CLOSE(bilinear.mean()[5 * frame_width + 10], 19, 1e-6);
+    BOOST_CHECK_CLOSE(bilinear.mean()[7 * frame_width + 30], 59, 1e-6);
+
+    //and Lanczos interpolates the smooth pattern between its pixels
+    image_coadd lanczos(frame_wcs(20.5, 15), frame_width, frame_height,
+        small_tiles(resample_kernel::lanczos));
+    lanczos.add(pixels.data(), frame_width, frame_height, frame_wcs(20, 15));
+    for (std::size_t column = 4; column < frame_width - 4; column++)
+    {
+        double const expected = std::sin(0.2 * (static_cast<double>(column) - 0.5)) * 10 + 12;
+        BOOST_CHECK_SMALL(lanczos.mean()[12 * frame_width + column] - expected, 0.002);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(weighted_sums)
+{
+    std::vector<std::int16_t> const ones(frame_width * frame_height, 1);
+    std::vector<std::int16_t> const fours(frame_width * frame_height, 4);
+    image_coadd coadd(frame_wcs(20, 15), frame_width, frame_height,
+        small_tiles(resample_kernel::lanczos));
+    coadd.add(ones.data(), frame_width, frame_height, frame_wcs(20, 15), 1);
+    coadd.add(fours.data(), frame_width, frame_height, frame_wcs(18.3, 14.6), 3);
+
+    std::size_t const inside = 10 * frame_width + 10;
+    BOOST_CHECK_CLOSE(coadd.weights()[inside], 4, 1e-9);
+    BOOST_CHECK_CLOSE(coadd.sums()[inside], 13, 1e-9);
+    BOOST_CHECK_CLOSE(coadd.mean()[inside], 3.25, 1e-9);
+
+    //the second frame starts 1.7 columns after the first one of the grid
+    std::size_t const outside = 10 * frame_width + 1;
+    BOOST_CHECK_CLOSE(coadd.weights()[outside], 1, 1e-9);
+    BOOST_CHECK_CLOSE(coadd.mean()[outside], 1, 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(frames_streamed_from_file)
+{
+    std::vector<float> const pixels = frame_pixels();
+    std::string const content = fits_header({
+        fits_card("SIMPLE", "T"),
+        fits_card("BITPIX", "-32"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", std::to_string(frame_width)),
+        fits_card("NAXIS2", std::to_string(frame_height)),
+        fits_card("CTYPE1", "'RA---TAN'"),
+        fits_card("CTYPE2", "'DEC--TAN'"),
+        fits_card("CRPIX1", "20"),
+        fits_card("CRPIX2", "15"),
+        fits_card("CRVAL1", "210"),
+        fits_card("CRVAL2", "54"),
+        fits_card("CDELT1", "-5.5555555555555556E-04"),
+        fits_card("CDELT2", "5.5555555555555556E-04")
+    }) + fits_pad_data(fits_big_endian(pixels));
+    fits_test_file file("image_coadd_frame.fits", content);
+
+    //a rotated output grid seen by a Lanczos kernel reading 4 rows at a time
+    wcs_transform const output(wcs_projection::tan, 25, 20, 210.001, 54.002, -4e-4, 3e-4, 3e-4,
+        4e-4);
+    image_coadd streamed(output, 50, 40, small_tiles(resample_kernel::lanczos));
+    image_tile_reader<bitpix::_B32> reader(file.path, 0, 4);
+    streamed.add(reader);
+
+    image_coadd in_memory(output, 50, 40, small_tiles(resample_kernel::lanczos));
+    in_memory.add(pixels.data(), frame_width, frame_height, frame_wcs(20, 15));
+
+    std::size_t covered = 0;
+    for (std::size_t i = 0; i < 50 * 40; i++)
+    {
+        BOOST_REQUIRE_SMALL(streamed.sums()[i] - in_memory.sums()[i], 1e-9);
+        BOOST_REQUIRE_SMALL(streamed.weights()[i] - in_memory.weights()[i], 1e-12);
+        covered += streamed.weights()[i] > 0 ? 1 : 0;
+    }
+    BOOST_CHECK(covered > 500 && covered < 50 * 40);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,201 @@
+#define BOOST_TEST_MODULE image_convolution_test
+
+#include <cmath>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/image_convolution.hpp>
+
+using namespace boost::astronomy::io;
+
+namespace {
+
+std::size_t const frame_width = 37;
+std::size_t const frame_height = 23;
+
+//! irregular pattern of a 37 x 23 frame, row after row
+std::vector<float> frame_pixels()
+{
+    std::vector<float> pixels(frame_width * frame_height);
+    for (std::size_t i = 0; i < pixels.size(); i++)
+    {
+        pixels[i] = static_cast<float>((i * 7919) % 101) - 40;
+    }
+    return pixels;
+}
+
+//! kernel of given size whose taps all differ
+convolution_kernel asymmetric_kernel(std::size_t width, std::size_t height)
+{
+    convolution_kernel kernel(width, height);
+    for (std::size_t i = 0; i < height; i++)
+    {
+        for (std::size_t j = 0; j < width; j++)
+        {
+            kernel(i, j) = 1 + static_cast<double>((i * 5 + j * 3) % 11) * 0.1;
+        }
+    }
+    return kernel;
+}
+
+//! convolution summing over the kernel for every pixel
+std::vector<double> reference
+(
+    std::vector<float> const& pixels,
+    convolution_kernel const& kernel,
+    convolution_edge edge
+)
+{
+    std::vector<double> result(pixels.size());
+    long const width = static_cast<long>(frame_width);
+    long const height = static_cast<long>(frame_height);
+    for (long r = 0; r < height; r++)
+    {
+        for (long c = 0; c < width; c++)
+        {
+            double sum = 0;
+            for (long i = 0; i < static_cast<long>(kernel.height); i++)
+            {
+                for (long j = 0; j < static_cast<long>(kernel.width); j++)
+                {
+                    long row = r + static_cast<long>(kernel.height / 2) - i;
+                    long column = c + static_cast<long>(kernel.width / 2) - j;
+                    bool const outside = row < 0 || row >= height || column < 0 ||
+                        column >= width;
+                    if (outside && edge == convolution_edge::zero)
+                    {
+                        continue;
+                    }
+                    row = std::min(std::max(row, 0L), height - 1);
+                    column = std::min(std::max(column, 0L), width - 1);
+                    sum += kernel(static_cast<std::size_t>(i), static_cast<std::size_t>(j)) *
+                        pixels[static_cast<std::size_t>(row * width + column)];
+                }
+            }
+            result[static_cast<std::size_t>(r * width + c)] = sum;
+        }
+    }
+    return result;
+}
+
+convolution_options make_options
+(
+    convolution_edge edge,
+    convolution_method method,
+    std::size_t threads = 3
+)
+{
+    convolution_options options;
+    options.edge = edge;
+    options.method = method;
+    options.threads = threads;
+    return options;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(image_convolution)
+
+BOOST_AUTO_TEST_CASE(direct_convolution)
+{
+    std::vector<float> const pixels = frame_pixels();
+    for (convolution_edge edge : {convolution_edge::zero, convolution_edge::extend})
+    {
+        for (std::size_t size : {1u, 2u, 3u, 6u})
+        {
+            convolution_kernel const kernel = asymmetric_kernel(size, size + 1);
+            std::vector<double> const expected = reference(pixels, kernel, edge);
+            std::vector<double> const result = convolve(pixels.data(), frame_width,
+                frame_height, kernel, make_options(edge, convolution_method::direct));
+            BOOST_REQUIRE_EQUAL(result.size(), expected.size());
+            for (std::size_t i = 0; i < result.size(); i++)
+            {
+                BOOST_REQUIRE_SMALL(result[i] - expected[i], 1e-9);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(fft_convolution)
+{
+    std::vector<float> const pixels = frame_pixels();
+    for (convolution_edge edge : {convolution_edge::zero, convolution_edge::extend})
+    {
+        for (std::size_t size : {3u, 8u, 19u})
+        {
+            convolution_kernel const kernel = asymmetric_kernel(size, size - 1);
+            std::vector<double> const expected = reference(pixels, kernel, edge);
+            std::vector<double> const result = convolve(pixels.data(), frame_width,
+                frame_height, kernel, make_options(edge, convolution_method::fft));
+            for (std::size_t i = 0; i < result.size(); i++)
+            {
+                BOOST_REQUIRE_SMALL(result[i] - expected[i], 1e-6);
+            }
+        }
+    }
+
+    //large kernels go to the fft on their own
+    convolution_kernel const kernel = asymmetric_kernel(17, 17);
+    std::vector<double> const automatic = convolve(pixels.data(), frame_width, frame_height,
+        kernel);
+    std::vector<double> const direct = convolve(pixels.data(), frame_width, frame_height,
+        kernel, make_options(convolution_edge::extend, convolution_method::direct, 1));
+    for (std::size_t i = 0; i < direct.size(); i++)
+    {
+        BOOST_REQUIRE_SMALL(automatic[i] - direct[i], 1e-6);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(separable_convolution)
+{
+    std::vector<float> const pixels = frame_pixels();
+    std::vector<double> const row = {0.5, 1, 2, -1};
+    std::vector<double> const column = gaussian_kernel(1.2);
+    BOOST_REQUIRE_EQUAL(column.size(), 9u);
+    double total = 0;
+    for (double tap : column)
+    {
+        total += tap;
+    }
+    BOOST_CHECK_CLOSE(total, 1, 1e-12);
+    BOOST_CHECK_CLOSE(column[4] / column[5], std::exp(1 / (2 * 1.2 * 1.2)), 1e-9);
+
+    convolution_kernel const kernel(row, column);
+    for (convolution_edge edge : {convolution_edge::zero, convolution_edge::extend})
+    {
+        std::vector<double> const expected = reference(pixels, kernel, edge);
+        for (std::size_t threads : {1u, 4u})
+        {
+            std::vector<double> const result = convolve_separable(pixels.data(), frame_width,
+                frame_height, row, column,
+                make_options(edge, convolution_method::automatic, threads));
+            for (std::size_t i = 0; i < result.size(); i++)
+            {
+                BOOST_REQUIRE_SMALL(result[i] - expected[i], 1e-9);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(blank_pixels_and_integers)
+{
+    std::vector<float> pixels(frame_width * frame_height, 2);
+    pixels[5 * frame_width + 6] = std::nanf("");
+    std::vector<double> const taps = {1, 1, 1};
+    std::vector<double> const result = convolve_separable(pixels.data(), frame_width,
+        frame_height, taps, taps);
+    BOOST_CHECK_CLOSE(result[5 * frame_width + 6], 16, 1e-9);
+    BOOST_CHECK_CLOSE(result[4 * frame_width + 7], 16, 1e-9);
+    BOOST_CHECK_CLOSE(result[10 * frame_width + 10], 18, 1e-9);
+
+    std::vector<std::int16_t> const counts(frame_width * frame_height, 3);
+    std::vector<double> const zero_edge = convolve(counts.data(), frame_width, frame_height,
+        convolution_kernel(taps, taps),
+        make_options(convolution_edge::zero, convolution_method::automatic));
+    BOOST_CHECK_CLOSE(zero_edge[0], 12, 1e-9);
+    BOOST_CHECK_CLOSE(zero_edge[frame_width + 1], 27, 1e-9);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,147 @@
+#define BOOST_TEST_MODULE image_section_test
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstdint>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/fits.hpp>
+#include <boost/astronomy/io/image_section.hpp>
+
+#include "fits_test_file.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace {
+
+//! value of pixel at (x, y, z) in the test images
+std::int16_t pixel_value(std::size_t x, std::size_t y, std::size_t z)
+{
+    return static_cast<std::int16_t>(x + 10 * y + 100 * z);
+}
+
+//! primary HDU holding a 10 x 8 frame followed by a 4 x 3 x 5 cube extension
+std::string frame_and_cube_file()
+{
+    std::vector<std::int16_t> frame, cube;
+    for (std::size_t y = 0; y < 8; y++)
+    {
+        for (std::size_t x = 0; x < 10; x++)
+        {
+            frame.push_back(pixel_value(x, y, 0));
+        }
+    }
+    for (std::size_t z = 0; z < 5; z++)
+    {
+        for (std::size_t y = 0; y < 3; y++)
+        {
+            for (std::size_t x = 0; x < 4; x++)
+            {
+                cube.push_back(pixel_value(x, y, z));
+            }
+        }
+    }
+
+    std::string content = fits_header({
+        fits_card("SIMPLE", "T"),
+        fits_card("BITPIX", "16"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", "10"),
+        fits_card("NAXIS2", "8"),
+        fits_card("EXTEND", "T")
+    });
+    content += fits_pad_data(fits_big_endian(frame));
+    content += fits_header({
+        fits_card("XTENSION", "'IMAGE   '"),
+        fits_card("BITPIX", "16"),
+        fits_card("NAXIS", "3"),
+        fits_card("NAXIS1", "4"),
+        fits_card("NAXIS2", "3"),
+        fits_card("NAXIS3", "5"),
+        fits_card("PCOUNT", "0"),
+        fits_card("GCOUNT", "1"),
+        fits_card("EXTNAME", "'CUBE'")
+    });
+    return content + fits_pad_data(fits_big_endian(cube));
+}
+
+//! expected pixels of a section, NAXIS1 varying fastest
+std::vector<std::int16_t> expected_pixels(image_section const& section)
+{
+    std::vector<std::int16_t> pixels;
+    std::size_t const depth = section.first.size() > 2 ? section.shape[2] : 1;
+    std::size_t const z0 = section.first.size() > 2 ? section.first[2] : 0;
+    for (std::size_t z = z0; z < z0 + depth; z++)
+    {
+        for (std::size_t y = section.first[1]; y < section.first[1] + section.shape[1]; y++)
+        {
+            for (std::size_t x = section.first[0]; x < section.first[0] + section.shape[0]; x++)
+            {
+                pixels.push_back(pixel_value(x, y, z));
+            }
+        }
+    }
+    return pixels;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(image_section_reads)
+
+BOOST_AUTO_TEST_CASE(single_section)
+{
+    fits_test_file file("image_section_single.fits", frame_and_cube_file());
+    fits fits_file(file.path, fits_open_mode::directory);
+
+    image_section stamp({2, 3}, {3, 4});
+    BOOST_TEST(stamp.size() == 12u);
+
+    std::vector<std::int16_t> pixels = fits_file.read_section<bitpix::B16>(0, stamp);
+    BOOST_TEST(pixels == expected_pixels(stamp));
+    BOOST_TEST(!fits_file.get_directory()[0].loaded);
+
+    image_section planes({1, 0, 2}, {2, 3, 2});
+    BOOST_TEST(fits_file.read_section<bitpix::B16>(1, planes) == expected_pixels(planes));
+}
+
+BOOST_AUTO_TEST_CASE(batched_sections)
+{
+    fits_test_file file("image_section_batched.fits", frame_and_cube_file());
+    fits fits_file(file.path, fits_open_mode::directory);
+
+    std::vector<image_section> stamps = {
+        image_section({0, 0}, {10, 8}),
+        image_section({7, 6}, {3, 2}),
+        image_section({5, 1}, {4, 4}),
+        image_section({6, 2}, {2, 2})
+    };
+
+    auto pixels = fits_file.read_sections<bitpix::B16>(0, stamps);
+    BOOST_REQUIRE_EQUAL(pixels.size(), stamps.size());
+    for (std::size_t i = 0; i < stamps.size(); i++)
+    {
+        BOOST_TEST(pixels[i] == expected_pixels(stamps[i]));
+    }
+
+    //reading every segment separately gives the same pixels
+    std::fstream stream(file.path, std::ios_base::in | std::ios_base::binary);
+    auto separate = read_image_sections<bitpix::B16>(stream, *fits_file.get_hdu(0),
+        fits_file.get_directory()[0].data_offset, stamps, 0);
+    BOOST_TEST(separate == pixels);
+}
+
+BOOST_AUTO_TEST_CASE(invalid_sections)
+{
+    fits_test_file file("image_section_invalid.fits", frame_and_cube_file());
+    fits fits_file(file.path, fits_open_mode::directory);
+
+    BOOST_CHECK_THROW(fits_file.read_section<bitpix::B16>(0, image_section({8, 0}, {3, 1})),
+        boost::astronomy::invalid_image_section_exception);
+    BOOST_CHECK_THROW(fits_file.read_section<bitpix::B16>(1, image_section({0, 0}, {1, 1})),
+        boost::astronomy::invalid_image_section_exception);
+    BOOST_CHECK_THROW(fits_file.read_section<bitpix::B32>(0, image_section({0, 0}, {1, 1})),
+        boost::astronomy::wrong_extension_type);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
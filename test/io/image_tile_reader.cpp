@@ -0,0 +1,125 @@
+#define BOOST_TEST_MODULE image_tile_reader_test
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/fits.hpp>
+#include <boost/astronomy/io/image_tile_reader.hpp>
+
+#include "fits_test_file.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace {
+
+//! 5 x 3 x 4 cube where every pixel stores its own index
+std::vector<std::int32_t> cube_pixels()
+{
+    std::vector<std::int32_t> pixels(5 * 3 * 4);
+    for (std::size_t i = 0; i < pixels.size(); i++)
+    {
+        pixels[i] = static_cast<std::int32_t>(i) - 10;
+    }
+    return pixels;
+}
+
+std::string cube_file()
+{
+    std::string content = fits_header({
+        fits_card("SIMPLE", "T"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "0"),
+        fits_card("EXTEND", "T")
+    });
+    content += fits_header({
+        fits_card("XTENSION", "'IMAGE   '"),
+        fits_card("BITPIX", "32"),
+        fits_card("NAXIS", "3"),
+        fits_card("NAXIS1", "5"),
+        fits_card("NAXIS2", "3"),
+        fits_card("NAXIS3", "4"),
+        fits_card("PCOUNT", "0"),
+        fits_card("GCOUNT", "1"),
+        fits_card("EXTNAME", "'CUBE'")
+    });
+    return content + fits_pad_data(fits_big_endian(cube_pixels()));
+}
+
+//! reads all the tiles and checks that they cover the cube in order
+void check_all_tiles(image_tile_reader<bitpix::B32>& reader, std::size_t rows_per_tile)
+{
+    std::vector<std::int32_t> expected = cube_pixels();
+    image_tile<bitpix::B32> tile;
+    std::size_t row = 0, tiles = 0;
+
+    while (reader.next(tile))
+    {
+        BOOST_REQUIRE_EQUAL(tile.first_row, row);
+        BOOST_REQUIRE_EQUAL(tile.width, 5u);
+        BOOST_REQUIRE(tile.rows <= rows_per_tile);
+        for (std::size_t i = 0; i < tile.pixels.size(); i++)
+        {
+            BOOST_REQUIRE_EQUAL(tile.pixels[i], expected[row * 5 + i]);
+        }
+        row += tile.rows;
+        tiles++;
+    }
+
+    BOOST_TEST(row == 12u);
+    BOOST_TEST(tiles == reader.tile_count());
+    BOOST_TEST(!reader.next(tile));
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(image_tile_reading)
+
+BOOST_AUTO_TEST_CASE(rows_and_planes_with_read_ahead)
+{
+    fits_test_file file("image_tile_reader_planes.fits", cube_file());
+
+    image_tile_reader<bitpix::B32> rows(file.path, 2880, 1);
+    BOOST_TEST(rows.row_width() == 5u);
+    BOOST_TEST(rows.row_count() == 12u);
+    BOOST_TEST(rows.plane_rows() == 3u);
+    check_all_tiles(rows, 1);
+
+    image_tile_reader<bitpix::B32> planes(file.path, 2880, 3);
+    image_tile<bitpix::B32> plane;
+    BOOST_REQUIRE(planes.next(plane));
+    BOOST_REQUIRE(planes.next(plane));
+    BOOST_TEST(plane(2, 4) == 29 - 10);
+}
+
+BOOST_AUTO_TEST_CASE(user_sized_tiles_without_read_ahead)
+{
+    fits_test_file file("image_tile_reader_tiles.fits", cube_file());
+    fits fits_file(file.path, fits_open_mode::directory);
+
+    image_tile_reader<bitpix::B32> reader(file.path,
+        fits_file.get_directory()[1].header_offset, 5, false);
+    BOOST_TEST(reader.tile_count() == 3u);
+    check_all_tiles(reader, 5);
+}
+
+BOOST_AUTO_TEST_CASE(wrong_bitpix)
+{
+    fits_test_file file("image_tile_reader_bitpix.fits", cube_file());
+    BOOST_CHECK_THROW(image_tile_reader<bitpix::B16>(file.path, 2880, 1),
+        boost::astronomy::wrong_extension_type);
+}
+
+BOOST_AUTO_TEST_CASE(cube_loaded_by_image_extension)
+{
+    fits_test_file file("image_tile_reader_cube.fits", cube_file());
+    fits fits_file(file.path, fits_open_mode::directory);
+
+    auto cube = std::dynamic_pointer_cast<image_extension<bitpix::B32>>(fits_file.get_hdu(1));
+    BOOST_REQUIRE(cube != nullptr);
+    BOOST_TEST(cube->get_data()(11, 4) == 59 - 10);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
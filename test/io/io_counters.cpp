@@ -0,0 +1,140 @@
+#define BOOST_TEST_MODULE io_counters_test
+#define BOOST_ASTRONOMY_IO_INSTRUMENTATION
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/fits.hpp>
+#include <boost/astronomy/io/io_counters.hpp>
+
+#include "fits_test_file.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace {
+
+//! primary image of 100 x 10 16 bit pixels and a binary table of 50 rows
+std::string counted_file()
+{
+    std::vector<std::int16_t> pixels(1000);
+    for (std::size_t i = 0; i < pixels.size(); i++)
+    {
+        pixels[i] = static_cast<std::int16_t>(i);
+    }
+    std::string content = fits_header({
+        fits_card("SIMPLE", "T"),
+        fits_card("BITPIX", "16"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", "100"),
+        fits_card("NAXIS2", "10"),
+        fits_card("EXTEND", "T")
+    });
+    content += fits_pad_data(fits_big_endian(pixels));
+
+    content += fits_header({
+        fits_card("XTENSION", "'BINTABLE'"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", "12"),
+        fits_card("NAXIS2", "50"),
+        fits_card("PCOUNT", "0"),
+        fits_card("GCOUNT", "1"),
+        fits_card("TFIELDS", "2"),
+        fits_card("TFORM1", "'J'"),
+        fits_card("TTYPE1", "'ID'"),
+        fits_card("TFORM2", "'D'"),
+        fits_card("TTYPE2", "'FLUX'"),
+        fits_card("EXTNAME", "'SOURCES'")
+    });
+    std::string rows;
+    for (std::size_t row = 0; row < 50; row++)
+    {
+        rows += fits_big_endian(std::vector<std::int32_t>{static_cast<std::int32_t>(row)});
+        rows += fits_big_endian(std::vector<double>{0.5 * static_cast<double>(row)});
+    }
+    return content + fits_pad_data(rows);
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(io_instrumentation)
+
+BOOST_AUTO_TEST_CASE(phases_of_directory_reads)
+{
+    fits_test_file file("io_counters_directory.fits", counted_file());
+    std::vector<io_event_kind> kinds;
+    fits fits_file(file.path, fits_open_mode::directory, hdu_allocation::heap,
+        [&](io_event const& event) { kinds.push_back(event.kind); });
+
+    //the two headers of one block are read, both data units skipped
+    io_counters const opened = fits_file.counters();
+    BOOST_CHECK_EQUAL(opened.read_calls, 2u);
+    BOOST_CHECK_EQUAL(opened.bytes_read, 2u * 2880);
+    BOOST_CHECK_EQUAL(opened.header_bytes, 2u * 2880);
+    BOOST_CHECK_GE(opened.seeks, 2u);
+    BOOST_CHECK_EQUAL(opened.allocations, 0u);
+    BOOST_CHECK_GE(opened.header_seconds, opened.read_seconds);
+    BOOST_CHECK_EQUAL(kinds.size(), 2 * 2 + opened.seeks);
+
+    //pixels are allocated, read and swapped in one go
+    fits_file.get_hdu(0);
+    io_counters const image = fits_file.counters();
+    BOOST_CHECK_EQUAL(image.read_calls - opened.read_calls, 1u);
+    BOOST_CHECK_EQUAL(image.bytes_read - opened.bytes_read, 2000u);
+    BOOST_CHECK_EQUAL(image.swapped_bytes, 2000u);
+    BOOST_CHECK_EQUAL(image.allocations, 1u);
+    BOOST_CHECK_EQUAL(image.allocated_bytes, 2000u);
+
+    //columns are only counted by the scopes open around them
+    auto table = std::dynamic_pointer_cast<binary_table_extension>(fits_file.get_hdu(1));
+    BOOST_REQUIRE(table != nullptr);
+    BOOST_CHECK_EQUAL(fits_file.counters().allocated_bytes, 2000u + 600);
+    io_counters columns;
+    {
+        io_counter_scope scope(columns);
+        BOOST_REQUIRE(table->get_column("FLUX") != nullptr);
+        BOOST_REQUIRE(table->get_column("ID") != nullptr);
+    }
+    BOOST_CHECK_EQUAL(columns.column_bytes, 50u * 12);
+    BOOST_CHECK_EQUAL(columns.bytes_read, 0u);
+    BOOST_CHECK_EQUAL(fits_file.counters().column_bytes, 0u);
+
+    fits_file.reset_counters();
+    BOOST_CHECK_EQUAL(fits_file.counters().read_calls, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(nested_scopes_and_threads)
+{
+    fits_test_file file("io_counters_threads.fits", counted_file());
+    io_counters outer;
+    io_counter_scope scope(outer);
+
+    fits fits_file(file.path, fits_open_mode::directory);
+    BOOST_CHECK_EQUAL(outer.read_calls, fits_file.counters().read_calls);
+    BOOST_CHECK_EQUAL(outer.seeks, fits_file.counters().seeks);
+
+    //the counters of the loading threads are added to the file
+    fits_file.reset_counters();
+    fits_file.load_all(2);
+    io_counters const loaded = fits_file.counters();
+    BOOST_CHECK_EQUAL(loaded.read_calls, 2u);
+    BOOST_CHECK_EQUAL(loaded.bytes_read, 2000u + 600);
+    BOOST_CHECK_EQUAL(loaded.allocations, 2u);
+
+    //headers parsed from memory record their size but no read
+    std::string const header = fits_header({fits_card("SIMPLE", "T"), fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "0")});
+    io_counters memory;
+    {
+        io_counter_scope memory_scope(memory);
+        hdu parsed;
+        parsed.read_header(header.data(), header.data() + header.size());
+    }
+    BOOST_CHECK_EQUAL(memory.header_bytes, 2880u);
+    BOOST_CHECK_EQUAL(memory.read_calls, 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
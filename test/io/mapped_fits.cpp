@@ -0,0 +1,114 @@
+#define BOOST_TEST_MODULE mapped_fits_test
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/mapped_fits.hpp>
+
+#include "fits_test_file.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace {
+
+std::string image_and_table_file()
+{
+    std::string content = fits_header({
+        fits_card("SIMPLE", "T"),
+        fits_card("BITPIX", "16"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", "3"),
+        fits_card("NAXIS2", "2"),
+        fits_card("EXTEND", "T")
+    });
+    content += fits_pad_data(fits_big_endian(std::vector<std::int16_t>{1, -2, 3, 400, -500, 6}));
+
+    content += fits_header({
+        fits_card("XTENSION", "'BINTABLE'"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", "4"),
+        fits_card("NAXIS2", "3"),
+        fits_card("PCOUNT", "0"),
+        fits_card("GCOUNT", "1"),
+        fits_card("TFIELDS", "1"),
+        fits_card("TFORM1", "'J'"),
+        fits_card("TTYPE1", "'FLUX'"),
+        fits_card("EXTNAME", "'EVENTS'")
+    });
+    content += fits_pad_data(fits_big_endian(std::vector<std::int32_t>{7, -8, 70000}));
+    return content;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(mapped_fits_reader)
+
+BOOST_AUTO_TEST_CASE(mapped_fits_directory)
+{
+    fits_test_file file("mapped_fits_directory.fits", image_and_table_file());
+    mapped_fits fits(file.path);
+
+    BOOST_TEST(fits.size() == 2u);
+    BOOST_TEST(fits.file_size() == 4u * 2880u);
+
+    BOOST_TEST(fits.get_header(0).naxis(1) == 3u);
+    BOOST_TEST(fits.get_header(0).data_size() == 12u);
+    BOOST_TEST((fits.get_data_unit(0).begin == fits.begin() + 2880));
+
+    BOOST_TEST(fits.get_header(1).data_size() == 12u);
+    BOOST_TEST((fits.get_data_unit(1).begin == fits.begin() + 3 * 2880));
+}
+
+BOOST_AUTO_TEST_CASE(mapped_fits_image_view)
+{
+    fits_test_file file("mapped_fits_image_view.fits", image_and_table_file());
+    mapped_fits fits(file.path);
+
+    auto image = fits.get_image<bitpix::B16>(0);
+    BOOST_TEST(image.get_width() == 3u);
+    BOOST_TEST(image.get_height() == 2u);
+    BOOST_TEST(image.at(0) == 1);
+    BOOST_TEST(image.at(3) == 400);
+    BOOST_TEST(image(1, 1) == -500);
+    BOOST_TEST((image.raw_data() == fits.get_data_unit(0).begin));
+
+    std::vector<std::int16_t> pixels(image.size());
+    image.copy_to(pixels.data());
+    BOOST_TEST(pixels == (std::vector<std::int16_t>{1, -2, 3, 400, -500, 6}));
+
+    BOOST_CHECK_THROW(fits.get_image<bitpix::B32>(0), boost::astronomy::wrong_extension_type);
+}
+
+BOOST_AUTO_TEST_CASE(mapped_fits_binary_table_view)
+{
+    fits_test_file file("mapped_fits_binary_table_view.fits", image_and_table_file());
+    mapped_fits fits(file.path);
+
+    auto table = fits.get_binary_table(1);
+    BOOST_TEST((table.table_data() == fits.get_data_unit(1).begin));
+    BOOST_CHECK_THROW(fits.get_binary_table(0), boost::astronomy::wrong_extension_type);
+}
+
+BOOST_AUTO_TEST_CASE(buffered_fits_owns_the_file)
+{
+    fits_test_file file("buffered_fits_owns_the_file.fits", image_and_table_file());
+    buffered_fits read(file.path);
+    buffered_fits fits(std::move(read));
+
+    BOOST_TEST(fits.size() == 2u);
+    BOOST_TEST(fits.file_size() == 4u * 2880u);
+    BOOST_TEST((fits.get_data_unit(1).begin == fits.begin() + 3 * 2880));
+    BOOST_TEST(fits.get_image<bitpix::B16>(0)(1, 1) == -500);
+    BOOST_TEST((fits.get_binary_table(1).table_data() == fits.get_data_unit(1).begin));
+
+    BOOST_CHECK_THROW(buffered_fits("buffered_fits_missing.fits"),
+        boost::astronomy::fits_read_exception);
+    std::string const truncated = image_and_table_file().substr(0, 3 * 2880);
+    BOOST_CHECK_THROW(buffered_fits(std::vector<char>(truncated.begin(), truncated.end())),
+        boost::astronomy::unexpected_end_of_data_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
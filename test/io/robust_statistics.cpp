@@ -0,0 +1,167 @@
+#define BOOST_TEST_MODULE robust_statistics_test
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/robust_statistics.hpp>
+
+#include "fits_test_file.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace {
+
+//! sky background with a few bright sources and a blank pixel
+std::vector<float> frame_pixels()
+{
+    std::vector<float> pixels(2000);
+    for (std::size_t i = 0; i < pixels.size(); i++)
+    {
+        pixels[i] = 100.0f + static_cast<float>((i * 37) % 21) - 10.0f;
+    }
+    pixels[10] = 5000.0f;
+    pixels[500] = 800.0f;
+    pixels[1500] = -400.0f;
+    pixels[1999] = std::numeric_limits<float>::quiet_NaN();
+    return pixels;
+}
+
+image<bitpix::_B32> load_frame(std::string const& path, std::vector<float> const& pixels)
+{
+    fits_test_file file(path, fits_big_endian(pixels));
+    std::fstream stream(path, std::ios_base::in | std::ios_base::binary);
+    return image<bitpix::_B32>(stream, 50, pixels.size() / 50, 0);
+}
+
+double reference_median(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+//! sigma clipping recomputing everything from scratch in every iteration
+std::vector<double> reference_clip(std::vector<double> values, double sigma, std::size_t iterations)
+{
+    for (std::size_t iteration = 0; iteration < iterations; iteration++)
+    {
+        double const center = reference_median(values);
+        double mean = 0, m2 = 0;
+        for (double value : values)
+        {
+            mean += value / static_cast<double>(values.size());
+        }
+        for (double value : values)
+        {
+            m2 += (value - mean) * (value - mean);
+        }
+        double const deviation = std::sqrt(m2 / static_cast<double>(values.size() - 1));
+
+        std::vector<double> kept;
+        for (double value : values)
+        {
+            if (value >= center - sigma * deviation && value <= center + sigma * deviation)
+            {
+                kept.push_back(value);
+            }
+        }
+        if (kept.size() == values.size())
+        {
+            break;
+        }
+        values = kept;
+    }
+    return values;
+}
+
+std::vector<double> valid_values(std::vector<float> const& pixels)
+{
+    std::vector<double> values;
+    for (float pixel : pixels)
+    {
+        if (!std::isnan(pixel))
+        {
+            values.push_back(pixel);
+        }
+    }
+    return values;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(robust_statistics_of_image)
+
+BOOST_AUTO_TEST_CASE(sigma_clip_matches_recomputation)
+{
+    std::vector<float> pixels = frame_pixels();
+    auto frame = load_frame("robust_statistics_clip.fits", pixels);
+    robust_statistics<float> robust(frame);
+    BOOST_TEST(robust.count() == pixels.size() - 1);
+
+    sigma_clip_result result = robust.sigma_clip(3.0, 3.0, 10);
+    std::vector<double> expected = reference_clip(valid_values(pixels), 3.0, 10);
+
+    BOOST_TEST(result.iterations >= 1u);
+    BOOST_TEST(result.count == expected.size());
+    BOOST_TEST(result.median == reference_median(expected));
+
+    double mean = 0;
+    for (double value : expected)
+    {
+        mean += value / static_cast<double>(expected.size());
+    }
+    BOOST_TEST(result.mean == mean, boost::test_tools::tolerance(1e-9));
+
+    std::vector<bool> mask = robust.mask();
+    BOOST_TEST(mask[10]);
+    BOOST_TEST(mask[500]);
+    BOOST_TEST(mask[1500]);
+    BOOST_TEST(mask[1999]);
+    BOOST_TEST(!mask[0]);
+    BOOST_TEST(static_cast<std::size_t>(std::count(mask.begin(), mask.end(), false)) ==
+        result.count);
+
+    robust.reset();
+    BOOST_TEST(robust.count() == pixels.size() - 1);
+}
+
+BOOST_AUTO_TEST_CASE(mad_and_biweight)
+{
+    std::vector<float> pixels = frame_pixels();
+    auto frame = load_frame("robust_statistics_biweight.fits", pixels);
+    robust_statistics<float> robust(frame);
+
+    std::vector<double> values = valid_values(pixels);
+    double const median = reference_median(values);
+    std::vector<double> deviations;
+    for (double value : values)
+    {
+        deviations.push_back(std::abs(value - median));
+    }
+    double const mad = reference_median(deviations);
+    BOOST_TEST(robust.median() == median);
+    BOOST_TEST(robust.mad() == mad);
+
+    double numerator = 0, denominator = 0;
+    for (double value : values)
+    {
+        double const u = (value - median) / (6.0 * mad);
+        if (std::abs(u) < 1)
+        {
+            numerator += (value - median) * (1 - u * u) * (1 - u * u);
+            denominator += (1 - u * u) * (1 - u * u);
+        }
+    }
+    BOOST_TEST(robust.biweight_location() == median + numerator / denominator,
+        boost::test_tools::tolerance(1e-12));
+
+    //outliers barely move the biweight estimates
+    BOOST_TEST(std::abs(robust.biweight_location() - 100.0) < 1.0);
+    BOOST_TEST(std::sqrt(robust.biweight_midvariance()) < 10.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
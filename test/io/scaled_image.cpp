@@ -0,0 +1,160 @@
+#define BOOST_TEST_MODULE scaled_image_test
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/fits.hpp>
+#include <boost/astronomy/io/scaled_image.hpp>
+
+#include "fits_test_file.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace {
+
+//! primary header of a 16 bit image stored with an unsigned offset
+std::string unsigned_primary_header(std::size_t width, std::size_t height)
+{
+    return fits_header({
+        fits_card("SIMPLE", "T"),
+        fits_card("BITPIX", "16"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", std::to_string(width)),
+        fits_card("NAXIS2", std::to_string(height)),
+        fits_card("EXTEND", "T"),
+        fits_card("BSCALE", "2.0"),
+        fits_card("BZERO", "32768.0"),
+        fits_card("BLANK", "-32768")
+    });
+}
+
+std::vector<std::int16_t> stored_pixels(std::size_t count)
+{
+    std::vector<std::int16_t> pixels(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        pixels[i] = static_cast<std::int16_t>(static_cast<int>(i % 20000) - 10000);
+    }
+    pixels[3] = std::numeric_limits<std::int16_t>::min();
+    return pixels;
+}
+
+std::string float_extension(std::vector<float> const& pixels)
+{
+    std::string content = fits_header({
+        fits_card("XTENSION", "'IMAGE   '"),
+        fits_card("BITPIX", "-32"),
+        fits_card("NAXIS", "1"),
+        fits_card("NAXIS1", std::to_string(pixels.size())),
+        fits_card("PCOUNT", "0"),
+        fits_card("GCOUNT", "1"),
+        fits_card("BSCALE", "0.5"),
+        fits_card("BZERO", "1.0"),
+        fits_card("EXTNAME", "'FLOAT'")
+    });
+    return content + fits_pad_data(fits_big_endian(pixels));
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(scaled_decode)
+
+BOOST_AUTO_TEST_CASE(integer_pixels_with_blank)
+{
+    std::size_t const width = 100, height = 70;
+    std::vector<std::int16_t> pixels = stored_pixels(width * height);
+    std::string const memory = unsigned_primary_header(width, height) +
+        fits_pad_data(fits_big_endian(pixels));
+
+    hdu header;
+    char const* data = header.read_header(memory.data(), memory.data() + memory.size());
+    BOOST_TEST(image_pixel_count(header) == width * height);
+
+    image_scaling scaling = image_scaling::from_header(header);
+    BOOST_TEST(scaling.bscale == 2.0);
+    BOOST_TEST(scaling.bzero == 32768.0);
+    BOOST_TEST(scaling.has_blank);
+
+    std::vector<float> output(width * height);
+    decode_scaled_pixels(data, header, output.data());
+    for (std::size_t i = 0; i < output.size(); i++)
+    {
+        if (i == 3)
+        {
+            BOOST_TEST(std::isnan(output[i]));
+        }
+        else
+        {
+            BOOST_TEST(output[i] == 32768.0f + 2.0f * pixels[i]);
+        }
+    }
+
+    fits_test_file file("scaled_primary.fits", memory);
+    std::fstream stream(file.path, std::ios_base::in | std::ios_base::binary);
+    hdu from_file(stream);
+    std::vector<double> scaled(width * height);
+    primary_hdu<bitpix::B16> primary(stream, from_file, scaled.data());
+    BOOST_TEST(primary.is_extended());
+    BOOST_TEST(primary.get_data().size() == 0u);
+    BOOST_TEST(stream.tellg() == static_cast<std::streamoff>(memory.size()));
+    BOOST_TEST(std::isnan(scaled[3]));
+    BOOST_TEST(scaled[4] == 32768.0 + 2.0 * pixels[4]);
+    BOOST_TEST(scaled.back() == 32768.0 + 2.0 * pixels.back());
+}
+
+BOOST_AUTO_TEST_CASE(unscaled_bytes)
+{
+    std::string const memory = fits_header({
+        fits_card("SIMPLE", "T"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "1"),
+        fits_card("NAXIS1", "3")
+    }) + fits_pad_data(std::string("\x01\x80\xff", 3));
+
+    hdu header;
+    char const* data = header.read_header(memory.data(), memory.data() + memory.size());
+    std::vector<double> output(3);
+    decode_scaled_pixels(data, header, output.data());
+    BOOST_TEST(output[0] == 1.0);
+    BOOST_TEST(output[1] == 128.0);
+    BOOST_TEST(output[2] == 255.0);
+}
+
+BOOST_AUTO_TEST_CASE(fits_directory_images)
+{
+    std::size_t const width = 9, height = 4;
+    std::vector<std::int16_t> pixels = stored_pixels(width * height);
+    std::vector<float> values{1.0f, -3.0f, std::numeric_limits<float>::quiet_NaN(), 8.0f};
+    fits_test_file file("scaled_directory.fits", unsigned_primary_header(width, height) +
+        fits_pad_data(fits_big_endian(pixels)) + float_extension(values));
+
+    fits fits_file(file.path, fits_open_mode::directory);
+    std::vector<double> extension = fits_file.read_scaled_image<double>(1);
+    BOOST_TEST(!fits_file.get_directory()[1].loaded);
+    BOOST_REQUIRE(extension.size() == values.size());
+    BOOST_TEST(extension[0] == 1.5);
+    BOOST_TEST(extension[1] == -0.5);
+    BOOST_TEST(std::isnan(extension[2]));
+    BOOST_TEST(extension[3] == 5.0);
+
+    std::vector<float> from_file = fits_file.read_scaled_image<float>(0);
+    fits_file.get_hdu(0);
+    std::vector<float> from_memory = fits_file.read_scaled_image<float>(0);
+    BOOST_REQUIRE(from_memory.size() == width * height);
+    BOOST_TEST(std::isnan(from_memory[3]));
+    for (std::size_t i = 0; i < from_file.size(); i++)
+    {
+        if (i != 3)
+        {
+            BOOST_TEST(from_file[i] == from_memory[i]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
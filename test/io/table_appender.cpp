@@ -0,0 +1,205 @@
+#define BOOST_TEST_MODULE table_appender_test
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <complex>
+#include <cstdint>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/table_appender.hpp>
+#include <boost/astronomy/io/mapped_fits.hpp>
+
+#include "fits_test_file.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace {
+
+//! events of a detector, one vector per column
+struct events
+{
+    std::vector<double> time;
+    std::vector<std::int32_t> channel;
+    std::vector<float> position;
+    std::vector<char> flags;
+
+    explicit events(std::size_t count) : time(count), channel(count), position(2 * count),
+        flags(2 * count)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            time[i] = 0.25 * static_cast<double>(i);
+            channel[i] = static_cast<std::int32_t>(i * 7) - 100;
+            position[2 * i] = static_cast<float>(i);
+            position[2 * i + 1] = -static_cast<float>(i) / 2;
+            flags[2 * i] = static_cast<char>(i & 0xff);
+            flags[2 * i + 1] = static_cast<char>(0xf0);
+        }
+    }
+};
+
+std::vector<table_column> const event_columns = {
+    {"TIME", "1D", "s"},
+    {"PHA", "1J", ""},
+    {"XY", "2E", "pix"},
+    {"STATUS", "12X", ""}
+};
+
+table_appender_options small_batches(std::size_t checkpoint_rows = 0)
+{
+    table_appender_options options;
+    options.batch_rows = 50;
+    options.checkpoint_rows = checkpoint_rows;
+    return options;
+}
+
+//! appends the events from first to last in chunks of given size
+void append(table_appender& appender, events const& data, std::size_t first, std::size_t last,
+    std::size_t chunk)
+{
+    for (std::size_t row = first; row < last; row += chunk)
+    {
+        std::size_t const count = std::min(chunk, last - row);
+        appender.append_rows(count, data.time.data() + row, data.channel.data() + row,
+            data.position.data() + 2 * row, data.flags.data() + 2 * row);
+    }
+}
+
+//! checks the table stored in HDU at given index holds the first rows events
+void check_table(std::string const& path, std::size_t index, events const& data,
+    std::size_t rows)
+{
+    std::ifstream file(path, std::ios_base::binary | std::ios_base::ate);
+    BOOST_REQUIRE_EQUAL(static_cast<std::size_t>(file.tellg()) % 2880, 0u);
+
+    buffered_fits const fits(path);
+    BOOST_REQUIRE_EQUAL(fits.size(), index + 1);
+    binary_table_extension const table = fits.get_binary_table(index);
+    BOOST_REQUIRE_EQUAL(table.naxis(1), 8u + 4u + 8u + 2u);
+    BOOST_REQUIRE_EQUAL(table.naxis(2), rows);
+    BOOST_TEST(table.value_of<std::string>("TUNIT1") == "'s       '");
+
+    auto const time = table.get_column_view<double>("TIME");
+    auto const channel = table.get_column_view<std::int32_t>("PHA");
+    auto const position = table.get_column_view<float>("XY");
+    auto const status = table.get_column_view<char>("STATUS");
+    BOOST_REQUIRE_EQUAL(position.repeat(), 2u);
+    BOOST_REQUIRE_EQUAL(status.repeat(), 2u);
+    for (std::size_t i = 0; i < rows; i++)
+    {
+        BOOST_REQUIRE_EQUAL(time[i], data.time[i]);
+        BOOST_REQUIRE_EQUAL(channel[i], data.channel[i]);
+        BOOST_REQUIRE_EQUAL(position(i, 0), data.position[2 * i]);
+        BOOST_REQUIRE_EQUAL(position(i, 1), data.position[2 * i + 1]);
+        BOOST_REQUIRE_EQUAL(status(i, 0), data.flags[2 * i]);
+        BOOST_REQUIRE_EQUAL(status(i, 1), data.flags[2 * i + 1]);
+    }
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(table_appender_output)
+
+BOOST_AUTO_TEST_CASE(rows_appended_in_chunks)
+{
+    fits_test_file file("table_appender_chunks.fits", "");
+    events const data(1000);
+    {
+        table_appender appender(file.path, event_columns, "EVENTS",
+            table_append_mode::create, small_batches());
+        BOOST_TEST(appender.row_width() == 22u);
+        append(appender, data, 0, 1000, 37);
+        BOOST_TEST(appender.rows() == 1000u);
+        appender.close();
+    }
+    check_table(file.path, 1, data, 1000);
+
+    buffered_fits const fits(file.path);
+    BOOST_TEST(fits.get_header(0).value_of<bool>("EXTEND"));
+    BOOST_TEST(fits.get_header(1).value_of<std::string>("EXTNAME") == "'EVENTS  '");
+}
+
+BOOST_AUTO_TEST_CASE(checkpoints_leave_a_valid_file)
+{
+    fits_test_file file("table_appender_checkpoints.fits", "");
+    events const data(500);
+    table_appender appender(file.path, event_columns, "EVENTS", table_append_mode::create,
+        small_batches());
+    check_table(file.path, 1, data, 0);
+
+    append(appender, data, 0, 123, 10);
+    appender.checkpoint();
+    check_table(file.path, 1, data, 123);
+
+    //rows after the checkpoint overwrite its padding
+    append(appender, data, 123, 300, 64);
+    appender.checkpoint();
+    check_table(file.path, 1, data, 300);
+
+    append(appender, data, 300, 500, 200);
+    appender.close();
+    check_table(file.path, 1, data, 500);
+}
+
+BOOST_AUTO_TEST_CASE(automatic_checkpoints)
+{
+    fits_test_file file("table_appender_automatic.fits", "");
+    events const data(100);
+    table_appender appender(file.path, event_columns, "EVENTS", table_append_mode::create,
+        small_batches(40));
+    append(appender, data, 0, 95, 95);
+    BOOST_TEST(appender.rows() == 95u);
+    check_table(file.path, 1, data, 80);
+}
+
+BOOST_AUTO_TEST_CASE(table_after_existing_hdus)
+{
+    std::string const image = fits_header({
+        fits_card("SIMPLE", "T"),
+        fits_card("BITPIX", "16"),
+        fits_card("NAXIS", "1"),
+        fits_card("NAXIS1", "3"),
+        fits_card("EXTEND", "T")
+    }) + fits_pad_data(fits_big_endian(std::vector<std::int16_t>{1, 2, 3}));
+    fits_test_file file("table_appender_extend.fits", image);
+    events const data(60);
+    {
+        table_appender appender(file.path, event_columns, "EVENTS",
+            table_append_mode::extend, small_batches());
+        append(appender, data, 0, 60, 7);
+    }
+    check_table(file.path, 1, data, 60);
+    BOOST_TEST(buffered_fits(file.path).get_image<bitpix::B16>(0).at(2) == 3);
+
+    fits_test_file truncated("table_appender_truncated.fits", image.substr(0, 2900));
+    BOOST_CHECK_THROW(table_appender(truncated.path, event_columns, "EVENTS",
+        table_append_mode::extend), boost::astronomy::fits_write_exception);
+}
+
+BOOST_AUTO_TEST_CASE(columns_must_match)
+{
+    fits_test_file file("table_appender_columns.fits", "");
+    BOOST_CHECK_THROW(table_appender(file.path, {{"DATA", "1PE(10)", ""}}),
+        boost::astronomy::invalid_table_colum_format);
+
+    table_appender appender(file.path, {{"FLUX", "1E", ""}, {"ID", "1K", ""},
+        {"Z", "1M", ""}});
+    std::vector<float> const flux = {1.5f, 2.5f};
+    std::vector<std::int64_t> const id = {10000000000, -2};
+    std::vector<double> const wrong = {1, 2};
+    std::vector<std::complex<double>> const z = {{1, -1}, {2, 3}};
+    BOOST_CHECK_THROW(appender.append_rows(2, flux.data(), id.data()),
+        boost::astronomy::invalid_table_colum_format);
+    BOOST_CHECK_THROW(appender.append_rows(2, flux.data(), wrong.data(), z.data()),
+        boost::astronomy::invalid_table_colum_format);
+    appender.append_rows(2, flux.data(), id.data(), z.data());
+    appender.close();
+
+    binary_table_extension const table = buffered_fits(file.path).get_binary_table(1);
+    BOOST_TEST(table.get_column_view<std::int64_t>("ID")[0] == 10000000000);
+    BOOST_TEST(table.get_column_view<std::complex<double>>("Z")[1] ==
+        std::complex<double>(2, 3));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,117 @@
+#define BOOST_TEST_MODULE visit_image_test
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <numeric>
+#include <type_traits>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/astronomy/io/fits.hpp>
+#include <boost/astronomy/io/mapped_fits.hpp>
+#include <boost/astronomy/io/visit_image.hpp>
+
+#include "fits_test_file.hpp"
+
+using namespace boost::astronomy::io;
+
+namespace {
+
+std::string mixed_bitpix_file()
+{
+    std::string content = fits_header({
+        fits_card("SIMPLE", "T"),
+        fits_card("BITPIX", "16"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", "3"),
+        fits_card("NAXIS2", "2"),
+        fits_card("EXTEND", "T")
+    });
+    content += fits_pad_data(fits_big_endian(std::vector<std::int16_t>{1, -2, 3, 400, -500, 6}));
+
+    content += fits_header({
+        fits_card("XTENSION", "'IMAGE   '"),
+        fits_card("BITPIX", "-32"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", "2"),
+        fits_card("NAXIS2", "2"),
+        fits_card("PCOUNT", "0"),
+        fits_card("GCOUNT", "1"),
+        fits_card("EXTNAME", "'FLOAT'")
+    });
+    content += fits_pad_data(fits_big_endian(std::vector<float>{0.5f, 1.5f, 2.5f, -0.5f}));
+
+    content += fits_header({
+        fits_card("XTENSION", "'BINTABLE'"),
+        fits_card("BITPIX", "8"),
+        fits_card("NAXIS", "2"),
+        fits_card("NAXIS1", "4"),
+        fits_card("NAXIS2", "1"),
+        fits_card("PCOUNT", "0"),
+        fits_card("GCOUNT", "1"),
+        fits_card("TFIELDS", "1"),
+        fits_card("TTYPE1", "'VALUE'"),
+        fits_card("TFORM1", "'1J'"),
+        fits_card("EXTNAME", "'TABLE'")
+    });
+    content += fits_pad_data(fits_big_endian(std::vector<std::int32_t>{42}));
+    return content;
+}
+
+//! sums the pixels and reports the size of the pixel type seen by the kernel
+struct pixel_sum
+{
+    double sum;
+    std::size_t pixel_size;
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(visit_typed_image)
+
+BOOST_AUTO_TEST_CASE(loaded_hdus)
+{
+    fits_test_file file("visit_image_loaded.fits", mixed_bitpix_file());
+    fits fits_file(file.path, fits_open_mode::directory);
+
+    auto kernel = [](auto const& img) {
+        typedef typename std::remove_pointer<decltype(img.pixels())>::type pixel_type;
+        return pixel_sum{std::accumulate(img.pixels(), img.pixels() + img.size(), 0.0),
+            sizeof(pixel_type)};
+    };
+
+    pixel_sum primary = visit_image(*fits_file.get_hdu(0), kernel);
+    BOOST_TEST(primary.sum == -92.0);
+    BOOST_TEST(primary.pixel_size == 2u);
+
+    pixel_sum extension = visit_image(*fits_file.get_hdu(1), kernel);
+    BOOST_TEST(extension.sum == 4.0);
+    BOOST_TEST(extension.pixel_size == 4u);
+
+    bool is_float = visit_image(*fits_file.get_hdu(1), [](auto const& img) {
+        return std::is_floating_point<typename std::remove_pointer<decltype(img.pixels())>::type>::value;
+    });
+    BOOST_TEST(is_float);
+
+    BOOST_CHECK_THROW(visit_image(*fits_file.get_hdu(2), kernel), boost::astronomy::wrong_extension_type);
+}
+
+BOOST_AUTO_TEST_CASE(mapped_views)
+{
+    fits_test_file file("visit_image_mapped.fits", mixed_bitpix_file());
+    mapped_fits fits(file.path);
+
+    auto kernel = [](auto const& view) {
+        double sum = 0;
+        for (std::size_t i = 0; i < view.size(); i++)
+        {
+            sum += static_cast<double>(view.at(i));
+        }
+        return sum;
+    };
+    BOOST_TEST(fits.visit_image(0, kernel) == -92.0);
+    BOOST_TEST(fits.visit_image(1, kernel) == 4.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()